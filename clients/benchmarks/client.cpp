@@ -33,11 +33,22 @@
 #include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#ifndef WIN32
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
 
 #include "frequency_monitor.hpp"
 
@@ -1350,6 +1361,457 @@ void run_bench_gpu_test(int                parallel_devices,
         thread[id].join();
 }
 
+void stream_thread_run_bench(int                device_id,
+                             hipStream_t        stream,
+                             const Arguments&   arg,
+                             const std::string& filter,
+                             bool               any_stride)
+{
+    CHECK_HIP_ERROR(hipSetDevice(device_id));
+
+    // bind this thread's handle to its own stream (consumed by rocblas_local_handle)
+    t_set_stream_callback.reset(new std::function<void(rocblas_handle)>(
+        [=](rocblas_handle handle) { rocblas_set_stream(handle, stream); }));
+
+    Arguments   a(arg);
+    std::string name_filter = "";
+    run_bench_test(false, a, filter, name_filter, any_stride, false);
+}
+
+void run_bench_stream_test(int streams, Arguments& arg, const std::string& filter, bool any_stride)
+{
+    // initialization
+    rocblas_parallel_initialize(1);
+
+    int device_id;
+    CHECK_HIP_ERROR(hipGetDevice(&device_id));
+
+    // cold call on the default stream so one-time library setup is not measured
+    {
+        Arguments   a(arg);
+        std::string name_filter = "";
+        a.cold_iters            = 1;
+        a.iters                 = 0;
+        run_bench_test(false, a, filter, name_filter, any_stride, false);
+    }
+
+    std::vector<hipStream_t> stream_vec(streams);
+    for(auto& stream : stream_vec)
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    // synchronized launch of the same benchmark on every stream; each thread owns
+    // a handle bound to its stream, so device workspace and solution selection
+    // contend the same way concurrent client streams do in production
+    auto thread = std::make_unique<std::thread[]>(streams);
+
+    double wall_start = get_time_us_no_sync();
+
+    for(int id = 0; id < streams; ++id)
+        thread[id]
+            = std::thread(::stream_thread_run_bench, device_id, stream_vec[id], arg, filter, any_stride);
+
+    for(int id = 0; id < streams; ++id)
+        thread[id].join();
+
+    double wall_us = get_time_us_no_sync() - wall_start;
+
+    for(auto& stream : stream_vec)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // each stream reports its own perf line above; aggregate throughput is their
+    // sum since the hot loops overlap. Wall time includes per-thread setup.
+    rocblas_cout << "rocblas-bench INFO: ran " << streams
+                 << " concurrent streams, wall time " << wall_us << " us" << std::endl;
+}
+
+/* ============================================================================================ */
+/* scaling sweep (--scaling): the same benchmark at 1..N concurrent streams, with library       */
+/* contention counters read around each level to show where scaling breaks                      */
+
+void run_bench_scaling_test(int                max_streams,
+                            Arguments&         arg,
+                            const std::string& filter,
+                            bool               any_stride)
+{
+    // initialization
+    rocblas_parallel_initialize(1);
+
+    int device_id;
+    CHECK_HIP_ERROR(hipGetDevice(&device_id));
+
+    // cold call on the default stream so one-time library setup is not measured
+    {
+        Arguments   a(arg);
+        std::string name_filter = "";
+        a.cold_iters            = 1;
+        a.iters                 = 0;
+        run_bench_test(false, a, filter, name_filter, any_stride, false);
+    }
+
+    double                   base_wall_us = 0;
+    std::vector<std::string> rows;
+
+    for(int streams = 1; streams <= max_streams; ++streams)
+    {
+        std::vector<hipStream_t> stream_vec(streams);
+        for(auto& stream : stream_vec)
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+        // process-wide counters, sampled around this level only
+        uint64_t lock_waits_before = rocblas_internal_lock_wait_count();
+        size_t   stalls_before     = rocblas_internal_device_malloc_stall_count();
+
+        auto thread = std::make_unique<std::thread[]>(streams);
+
+        double wall_start = get_time_us_no_sync();
+
+        for(int id = 0; id < streams; ++id)
+            thread[id] = std::thread(
+                ::stream_thread_run_bench, device_id, stream_vec[id], arg, filter, any_stride);
+
+        for(int id = 0; id < streams; ++id)
+            thread[id].join();
+
+        double wall_us = get_time_us_no_sync() - wall_start;
+
+        for(auto& stream : stream_vec)
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+        if(streams == 1)
+            base_wall_us = wall_us;
+
+        // n streams do n times the single-stream work, so perfect scaling keeps
+        // the wall time flat: efficiency is the single-stream time over this one
+        double efficiency = wall_us > 0 ? base_wall_us / wall_us : 0.0;
+
+        std::ostringstream row;
+        row << streams << "," << wall_us << "," << efficiency << ","
+            << rocblas_internal_lock_wait_count() - lock_waits_before << ","
+            << rocblas_internal_device_malloc_stall_count() - stalls_before;
+        rows.push_back(row.str());
+    }
+
+    // summary table last, after the per-stream perf lines printed above
+    rocblas_cout << "streams,wall_us,efficiency,lock_waits,device_malloc_stalls" << std::endl;
+    for(const auto& row : rows)
+        rocblas_cout << row << std::endl;
+}
+
+/* ============================================================================================ */
+/* trace replay mode (--replay): execute a ROCBLAS_LAYER=2 bench trace in one process           */
+
+// one parsed line of a log_bench trace
+struct replay_call
+{
+    std::string       function;
+    rocblas_operation transA = rocblas_operation_none;
+    rocblas_operation transB = rocblas_operation_none;
+    rocblas_int       M = 0, N = 0, K = 0;
+    rocblas_int       lda = 0, ldb = 0, ldc = 0, ldd = 0;
+    rocblas_stride    stride_a = 0, stride_b = 0, stride_c = 0, stride_d = 0;
+    rocblas_int       batch_count = 1;
+    double            alpha = 1.0, alphai = 0.0, beta = 0.0, betai = 0.0;
+    rocblas_datatype  a_type{}, b_type{}, c_type{}, d_type{}, compute_type{};
+    uint32_t          flags = rocblas_gemm_flags_none;
+};
+
+// parse one trace line into a replay_call; returns false for lines this mode
+// cannot execute (empty lines, comments, functions outside the gemm family)
+bool replay_parse_line(const std::string& line, replay_call& call)
+{
+    std::map<std::string, std::string> opts;
+
+    std::istringstream iss(line);
+    std::string        tok, key;
+    while(iss >> tok)
+    {
+        bool negative_number = tok.size() > 1 && tok[0] == '-' && (isdigit(tok[1]) || tok[1] == '.');
+        if(tok[0] == '-' && !negative_number)
+        {
+            key = tok.substr(tok.find_first_not_of('-'));
+            opts[key];
+        }
+        else if(!key.empty())
+        {
+            opts[key] = tok;
+            key.clear();
+        }
+    }
+
+    auto str = [&](const char* name, const char* def) {
+        auto it = opts.find(name);
+        return it != opts.end() && !it->second.empty() ? it->second : std::string(def);
+    };
+    auto num = [&](const char* name, double def) {
+        auto it = opts.find(name);
+        return it != opts.end() && !it->second.empty() ? strtod(it->second.c_str(), nullptr) : def;
+    };
+
+    call.function = str("f", "");
+    if(call.function != "gemm" && call.function != "gemm_strided_batched"
+       && call.function != "gemm_ex" && call.function != "gemm_strided_batched_ex")
+        return false;
+
+    bool ex = call.function == "gemm_ex" || call.function == "gemm_strided_batched_ex";
+
+    rocblas_datatype precision = string2rocblas_datatype(str("r", "f32_r"));
+    call.a_type                = ex ? string2rocblas_datatype(str("a_type", "f32_r")) : precision;
+    call.b_type                = ex ? string2rocblas_datatype(str("b_type", "f32_r")) : precision;
+    call.c_type                = ex ? string2rocblas_datatype(str("c_type", "f32_r")) : precision;
+    call.d_type                = ex ? string2rocblas_datatype(str("d_type", "f32_r")) : precision;
+    call.compute_type = ex ? string2rocblas_datatype(str("compute_type", "f32_r")) : precision;
+    if(call.a_type == rocblas_datatype_invalid || call.b_type == rocblas_datatype_invalid
+       || call.c_type == rocblas_datatype_invalid || call.d_type == rocblas_datatype_invalid
+       || call.compute_type == rocblas_datatype_invalid)
+        return false;
+
+    call.transA = char2rocblas_operation(str("transposeA", "N")[0]);
+    call.transB = char2rocblas_operation(str("transposeB", "N")[0]);
+
+    call.M = rocblas_int(num("m", 128));
+    call.N = rocblas_int(num("n", 128));
+    call.K = rocblas_int(num("k", 128));
+
+    call.lda = rocblas_int(num("lda", call.transA == rocblas_operation_none ? call.M : call.K));
+    call.ldb = rocblas_int(num("ldb", call.transB == rocblas_operation_none ? call.K : call.N));
+    call.ldc = rocblas_int(num("ldc", call.M));
+    call.ldd = rocblas_int(num("ldd", call.ldc));
+
+    call.alpha  = num("alpha", 1.0);
+    call.alphai = num("alphai", 0.0);
+    call.beta   = num("beta", 0.0);
+    call.betai  = num("betai", 0.0);
+
+    call.batch_count = rocblas_int(num("batch_count", 1));
+    call.stride_a    = rocblas_stride(num("stride_a", 0));
+    call.stride_b    = rocblas_stride(num("stride_b", 0));
+    call.stride_c    = rocblas_stride(num("stride_c", 0));
+    call.stride_d    = rocblas_stride(num("stride_d", call.stride_c));
+    call.flags       = uint32_t(num("flags", rocblas_gemm_flags_none));
+
+    return call.M >= 0 && call.N >= 0 && call.K >= 0 && call.batch_count >= 1;
+}
+
+// fill an alpha/beta host scalar in the trace call's compute type
+void replay_scalar(rocblas_datatype compute_type, double re, double im, void* scalar)
+{
+    switch(compute_type)
+    {
+    case rocblas_datatype_f64_r:
+        *(double*)scalar = re;
+        break;
+    case rocblas_datatype_i32_r:
+        *(int32_t*)scalar = int32_t(re);
+        break;
+    case rocblas_datatype_f32_c:
+        *(rocblas_float_complex*)scalar = {float(re), float(im)};
+        break;
+    case rocblas_datatype_f64_c:
+        *(rocblas_double_complex*)scalar = {re, im};
+        break;
+    default: // f32_r computes for all real mixed-precision configurations
+        *(float*)scalar = float(re);
+        break;
+    }
+}
+
+int rocblas_bench_replay(const std::string& trace_path)
+{
+    std::ifstream trace(trace_path);
+    if(!trace)
+        throw std::invalid_argument("Cannot open --replay file " + trace_path);
+
+    // parse the whole trace up front so file I/O is off the timed path
+    std::vector<replay_call>      calls;
+    std::map<std::string, size_t> skipped;
+    std::string                   line;
+    while(std::getline(trace, line))
+    {
+        replay_call call;
+        if(replay_parse_line(line, call))
+            calls.push_back(call);
+        else if(line.find("-f ") != std::string::npos)
+        {
+            auto pos = line.find("-f ") + 3;
+            skipped[line.substr(pos, line.find(' ', pos) - pos)]++;
+        }
+    }
+
+    if(calls.empty())
+        throw std::invalid_argument("No replayable calls in --replay file " + trace_path);
+
+    // pool device memory: one allocation per operand sized for the largest call
+    size_t a_bytes = 0, b_bytes = 0, c_bytes = 0, d_bytes = 0;
+    for(const auto& c : calls)
+    {
+        size_t batch_elems_a = size_t(c.stride_a) * (c.batch_count - 1);
+        size_t batch_elems_b = size_t(c.stride_b) * (c.batch_count - 1);
+        size_t batch_elems_c = size_t(c.stride_c) * (c.batch_count - 1);
+        size_t batch_elems_d = size_t(c.stride_d) * (c.batch_count - 1);
+
+        size_t cols_a = c.transA == rocblas_operation_none ? c.K : c.M;
+        size_t cols_b = c.transB == rocblas_operation_none ? c.N : c.K;
+
+        a_bytes = std::max(a_bytes,
+                           (size_t(c.lda) * cols_a + batch_elems_a)
+                               * rocblas_sizeof_datatype(c.a_type));
+        b_bytes = std::max(b_bytes,
+                           (size_t(c.ldb) * cols_b + batch_elems_b)
+                               * rocblas_sizeof_datatype(c.b_type));
+        c_bytes = std::max(c_bytes,
+                           (size_t(c.ldc) * c.N + batch_elems_c)
+                               * rocblas_sizeof_datatype(c.c_type));
+        d_bytes = std::max(d_bytes,
+                           (size_t(c.ldd) * c.N + batch_elems_d)
+                               * rocblas_sizeof_datatype(c.d_type));
+    }
+
+    void *dA, *dB, *dC, *dD;
+    CHECK_HIP_ERROR(hipMalloc(&dA, a_bytes));
+    CHECK_HIP_ERROR(hipMalloc(&dB, b_bytes));
+    CHECK_HIP_ERROR(hipMalloc(&dC, c_bytes));
+    CHECK_HIP_ERROR(hipMalloc(&dD, d_bytes));
+
+    // nonzero normal values in every supported datatype interpretation
+    CHECK_HIP_ERROR(hipMemset(dA, 0x3c, a_bytes));
+    CHECK_HIP_ERROR(hipMemset(dB, 0x3c, b_bytes));
+    CHECK_HIP_ERROR(hipMemset(dC, 0x3c, c_bytes));
+    CHECK_HIP_ERROR(hipMemset(dD, 0x3c, d_bytes));
+
+    rocblas_local_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // events bracket every call so per-function GPU time can be split without
+    // synchronizing between calls; drained in batches to bound live event count
+    constexpr size_t c_replay_event_batch = 4096;
+
+    std::vector<hipEvent_t> events(c_replay_event_batch + 1);
+    for(auto& event : events)
+        CHECK_HIP_ERROR(hipEventCreate(&event));
+
+    struct replay_stats
+    {
+        size_t calls  = 0;
+        double gpu_ms = 0.0;
+    };
+    std::map<std::string, replay_stats> stats;
+    std::vector<replay_stats*>          batch_stats(c_replay_event_batch);
+
+    size_t batch_fill = 0;
+    size_t errors     = 0;
+
+    auto drain_events = [&] {
+        if(!batch_fill)
+            return;
+        CHECK_HIP_ERROR(hipEventSynchronize(events[batch_fill]));
+        for(size_t i = 0; i < batch_fill; i++)
+        {
+            float ms;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, events[i], events[i + 1]));
+            batch_stats[i]->gpu_ms += ms;
+        }
+        batch_fill = 0;
+    };
+
+    double wall_start = get_time_us_sync(stream);
+
+    for(const auto& c : calls)
+    {
+        alignas(16) char alpha[16], beta[16];
+        replay_scalar(c.compute_type, c.alpha, c.alphai, alpha);
+        replay_scalar(c.compute_type, c.beta, c.betai, beta);
+
+        // in-place C for the plain gemm functions, separate D for _ex calls
+        bool  ex = c.function == "gemm_ex" || c.function == "gemm_strided_batched_ex";
+        void* d  = ex ? dD : dC;
+
+        if(!batch_fill)
+            CHECK_HIP_ERROR(hipEventRecord(events[0], stream));
+
+        // every supported trace function maps onto gemm_strided_batched_ex
+        rocblas_status status = rocblas_gemm_strided_batched_ex(handle,
+                                                                c.transA,
+                                                                c.transB,
+                                                                c.M,
+                                                                c.N,
+                                                                c.K,
+                                                                alpha,
+                                                                dA,
+                                                                c.a_type,
+                                                                c.lda,
+                                                                c.stride_a,
+                                                                dB,
+                                                                c.b_type,
+                                                                c.ldb,
+                                                                c.stride_b,
+                                                                beta,
+                                                                dC,
+                                                                c.c_type,
+                                                                c.ldc,
+                                                                c.stride_c,
+                                                                d,
+                                                                ex ? c.d_type : c.c_type,
+                                                                ex ? c.ldd : c.ldc,
+                                                                ex ? c.stride_d : c.stride_c,
+                                                                c.batch_count,
+                                                                c.compute_type,
+                                                                rocblas_gemm_algo_standard,
+                                                                0,
+                                                                c.flags);
+        if(status != rocblas_status_success)
+        {
+            errors++;
+            continue;
+        }
+
+        CHECK_HIP_ERROR(hipEventRecord(events[batch_fill + 1], stream));
+        batch_stats[batch_fill] = &stats[c.function];
+        batch_stats[batch_fill]->calls++;
+
+        if(++batch_fill == c_replay_event_batch)
+            drain_events();
+    }
+
+    drain_events();
+
+    double wall_us = get_time_us_sync(stream) - wall_start;
+
+    for(auto& event : events)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dD));
+
+    // report per-function and aggregate timing
+    rocblas_cout << "function,calls,total-gpu-ms,avg-gpu-us" << std::endl;
+    double total_gpu_ms = 0.0;
+    size_t total_calls  = 0;
+    for(const auto& s : stats)
+    {
+        rocblas_cout << s.first << "," << s.second.calls << "," << s.second.gpu_ms << ","
+                     << s.second.gpu_ms * 1000.0 / s.second.calls << std::endl;
+        total_gpu_ms += s.second.gpu_ms;
+        total_calls += s.second.calls;
+    }
+    rocblas_cout << "replay-total," << total_calls << "," << total_gpu_ms << ","
+                 << total_gpu_ms * 1000.0 / total_calls << std::endl;
+    rocblas_cout << "rocblas-bench INFO: replay wall time " << wall_us / 1000.0 << " ms"
+                 << std::endl;
+
+    for(const auto& s : skipped)
+        rocblas_cout << "rocblas-bench INFO: skipped " << s.second << " unsupported " << s.first
+                     << " calls" << std::endl;
+    if(errors)
+        rocblas_cerr << "rocblas-bench WARNING: " << errors << " replayed calls failed"
+                     << std::endl;
+
+    return errors ? -1 : 0;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -1366,9 +1828,67 @@ void fix_batch(int argc, char* argv[])
         }
 }
 
-int main(int argc, char* argv[])
+// Each cold sample must come from a fresh process: code objects, Tensile
+// libraries and the device memory pool stay resident for the life of a
+// process, so any second in-process measurement is warm. The parent re-runs
+// its own command line with --cold_runs dropped and --cold appended, and
+// aggregates the cold_total_us lines the children print.
+int run_cold_runs(int argc, char* argv[], int cold_runs)
+{
+    std::string cmd;
+    for(int i = 0; i < argc; ++i)
+    {
+        std::string s(argv[i]);
+        if(s == "--cold_runs")
+        {
+            ++i; // skip its value
+            continue;
+        }
+        if(i)
+            cmd += ' ';
+        cmd += s;
+    }
+    cmd += " --cold";
+
+    std::vector<double> samples;
+    for(int run = 0; run < cold_runs; ++run)
+    {
+#ifdef WIN32
+        FILE* child = _popen(cmd.c_str(), "r");
+#else
+        FILE* child = popen(cmd.c_str(), "r");
+#endif
+        if(!child)
+            throw std::runtime_error("--cold_runs: could not launch " + cmd);
+
+        double us = -1;
+        char   line[1024];
+        while(fgets(line, sizeof(line), child))
+        {
+            if(!strncmp(line, "cold_total_us,", 14))
+                us = atof(line + 14);
+        }
+#ifdef WIN32
+        _pclose(child);
+#else
+        pclose(child);
+#endif
+        if(us < 0)
+            throw std::runtime_error("--cold_runs: child run produced no cold_total_us result");
+        samples.push_back(us);
+    }
+
+    std::sort(samples.begin(), samples.end());
+    rocblas_cout << "cold_runs,min_us,median_us,max_us" << std::endl;
+    rocblas_cout << samples.size() << "," << samples.front() << "," << samples[samples.size() / 2]
+                 << "," << samples.back() << std::endl;
+    return 0;
+}
+
+int rocblas_bench_run(int argc, char* argv[])
 try
 {
+    double cold_wall_start = get_time_us_no_sync();
     fix_batch(argc, argv);
     Arguments   arg;
     std::string function;
@@ -1382,8 +1902,14 @@ try
     std::string initialization;
     std::string filter;
     std::string name_filter;
+    std::string replay_file;
+    std::string yaml_out;
+    std::string roofline_out;
+    double      roofline_peak_gflops = 0.0;
     int32_t     device_id           = 0;
     int32_t     parallel_devices    = 0;
+    int32_t     streams             = 0;
+    int32_t     scaling             = 0;
     int32_t     flags               = 0;
     int32_t     geam_ex_op          = 0;
     int32_t     api                 = 0;
@@ -1396,8 +1922,12 @@ try
     uint32_t    math_mode           = 0;
     uint64_t    flush_batch_count   = 1;
     uint64_t    flush_memory_size   = 0;
+    uint64_t    rotating_mb         = 0;
     bool        fortran             = false;
     bool        eazy                = false;
+    bool        deterministic_clocks = false;
+    bool        cold                = false;
+    int32_t     cold_runs           = 0;
 
     arg.init(); // set all defaults
 
@@ -1573,6 +2103,11 @@ try
          value<int8_t>(&arg.norm_check)->default_value(0),
          "Norm check on GPU vs. CPU results? 0 = No, 1 = Yes (default: No)")
 
+        ("device_check",
+         bool_switch(&arg.device_check)->default_value(false),
+         "With --verify, compute the reference and the error norm on-device where supported, "
+         "avoiding the host BLAS reference for huge problems; only scalar norms come back to host")
+
         ("iters,i",
          value<int32_t>(&arg.iters)->default_value(10),
          "Iterations to run inside timing loop")
@@ -1581,6 +2116,19 @@ try
          value<int32_t>(&arg.cold_iters)->default_value(2),
          "Cold Iterations to run before entering the timing loop")
 
+        ("cold",
+         bool_switch(&cold)->default_value(false),
+         "Measure time-to-first-result: run the function exactly once with no warm-up"
+         " iterations and report the wall time from process start to the first completed"
+         " result, so one-time costs (lazy code-object loads, handle creation, first-touch"
+         " workspace allocation) that warmed-up timing loops never see stay on the clock")
+
+        ("cold_runs",
+         value<int32_t>(&cold_runs)->default_value(0),
+         "Fork this many fresh processes, each performing one --cold measurement, and report"
+         " min/median/max time-to-first-result; a fresh process is required per sample since"
+         " code objects stay loaded for the life of a process")
+
         ("algo",
          value<uint32_t>(&arg.algo)->default_value(0),
          "extended precision gemm algorithm")
@@ -1609,10 +2157,37 @@ try
          value<int32_t>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
 
+        ("deterministic_clocks",
+         value<bool>(&deterministic_clocks)->default_value(false),
+         "Pin the device to a stable performance level (fixed SCLK/MCLK) for the measurement "
+         "and restore the previous level on exit, making results comparable across runs and "
+         "nodes; changing the performance level requires elevated privileges")
+
         ("parallel_devices",
          value<int32_t>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
+        ("streams",
+         value<int32_t>(&streams)->default_value(0),
+         "Run the function concurrently on this many streams of one device, each with its own"
+         " handle and thread, and report per-stream performance (0 or 1 runs a single stream)")
+
+        ("scaling",
+         value<int32_t>(&scaling)->default_value(0),
+         "Sweep the function at 1..N concurrent streams of one device and report wall time,"
+         " scaling efficiency and library contention counters (lock waits and device_malloc"
+         " stalls) at each level")
+
+        ("graph",
+         bool_switch(&arg.graph_test)->default_value(false),
+         "Capture the function into a hipGraph and time replays of the instantiated graph"
+         " instead of individual calls, removing per-call launch overhead")
+
+        ("replay",
+         value<std::string>(&replay_file),
+         "Replay a ROCBLAS_LAYER=2 bench trace file back-to-back on one handle with pooled"
+         " device memory and report per-function and aggregate timing (gemm family only)")
+
         ("outofplace",
          bool_switch(&arg.outofplace)->default_value(false),
          "for gemm_ex C and D are stored in separate memory, for trmm B and C are stored in separate memory")
@@ -1637,6 +2212,34 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("yaml_out",
+         value<std::string>(&yaml_out),
+         "Append each benchmark result to this file as one structured YAML list item"
+         " (non-default arguments plus timing), written and flushed incrementally so"
+         " sweeps can be parsed without scraping stdout")
+
+        ("roofline_out",
+         value<std::string>(&roofline_out),
+         "Append a roofline-position record for each benchmark result to this file:"
+         " the arithmetic intensity from the analytic flop/byte models, the achieved"
+         " Gflops and GB/s, and the fraction of the binding ceiling, classifying each"
+         " shape as bandwidth- or compute-bound against the device's theoretical"
+         " memory bandwidth and the --roofline_peak_gflops ceiling. Intended to run"
+         " over an Arguments corpus (--yaml) as a fleet-wide performance audit")
+
+        ("roofline_peak_gflops",
+         value<double>(&roofline_peak_gflops)->default_value(0.0),
+         "Compute ceiling in Gflops for the precision under audit, used by"
+         " --roofline_out to place shapes against the compute roof; 0 leaves the"
+         " compute roof unknown so only bandwidth-relative positions are reported")
+
+        ("server",
+         value<std::string>(),
+         "Run as a benchmark server on the given local socket path, serving"
+         " newline-terminated rocblas-bench argument lines (one connection per"
+         " request) from a warm process so repeated invocations skip device and"
+         " library startup; the request 'shutdown' stops the server")
+
         ("function_filter",
          value<std::string>(&filter),
          "Simple strstr filter on function name only without wildcards")
@@ -1669,6 +2272,12 @@ try
          " dimensions is not loaded to cache and not included in the problem_memory_footprint."
          " If you specify flush_memory_size you cannot also specify flush_batch_count")
 
+        ("rotating",
+         value<uint64_t>(&rotating_mb)->default_value(0),
+         "megabytes of memory to rotate operand arrays through in the timing loop, defeating"
+         " cache reuse across iterations. Shorthand for --flush_memory_size with MB units;"
+         " cannot be combined with --flush_memory_size or --flush_batch_count")
+
         ("name_filter",
          value<std::string>(&name_filter),
          "Simple strstr filter on test name only without wildcards, only used with --yaml or --data")
@@ -1740,6 +2349,14 @@ try
 
     // transfer local variable state
 
+    if(rotating_mb)
+    {
+        if(arg.flush_memory_size || arg.flush_batch_count > 1)
+            throw std::invalid_argument(
+                "--rotating cannot be combined with --flush_memory_size or --flush_batch_count");
+        arg.flush_memory_size = rotating_mb << 20;
+    }
+
     arg.atomics_mode = atomics_not_allowed ? rocblas_atomics_not_allowed : rocblas_atomics_allowed;
 
     if(api)
@@ -1789,6 +2406,9 @@ try
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    if(!yaml_out.empty())
+        ArgumentModel_set_yaml_out(yaml_out);
+
     // Device Query
     rocblas_int device_count = query_device_property();
 
@@ -1798,9 +2418,23 @@ try
     if(device_id >= 0)
         set_device(device_id);
 
+    // after device selection, so the bandwidth ceiling is the audited device's
+    if(!roofline_out.empty())
+        ArgumentModel_set_roofline_out(roofline_out, roofline_peak_gflops);
+
     FrequencyMonitor& freq_monitor = getFrequencyMonitor();
     freq_monitor.set_device_id(device_id);
 
+    // the monitor restores the previous performance level when it is freed,
+    // so early returns below don't leave the clocks pinned
+    if(deterministic_clocks && !freq_monitor.lockClocks())
+        rocblas_cerr << "rocblas-bench warning: unable to pin device clocks, continuing with "
+                        "default clock management (try running with elevated privileges)"
+                     << std::endl;
+
+    if(!replay_file.empty())
+        return rocblas_bench_replay(replay_file);
+
     if(datafile)
         return rocblas_bench_datafile(filter, name_filter, any_stride);
 
@@ -1856,7 +2490,34 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
-    if(!parallel_devices)
+    if(streams > 1 && parallel_devices)
+        throw std::invalid_argument("--streams cannot be combined with --parallel_devices");
+
+    if(scaling > 1 && (streams > 1 || parallel_devices))
+        throw std::invalid_argument("--scaling cannot be combined with --streams or"
+                                    " --parallel_devices");
+
+    if((cold || cold_runs > 0) && (streams > 1 || scaling > 1 || parallel_devices))
+        throw std::invalid_argument(
+            "--cold cannot be combined with --streams, --scaling or --parallel_devices");
+
+    if(cold_runs > 0)
+        return run_cold_runs(argc, argv, cold_runs);
+
+    if(cold)
+    {
+        // single in-process sample: no warm-up and one timed call, so lazy
+        // initialization is included in the first-call timing below and in the
+        // cold_total_us wall time printed at exit
+        arg.cold_iters = 0;
+        arg.iters      = 1;
+    }
+
+    if(scaling > 1)
+        run_bench_scaling_test(scaling, arg, filter, any_stride);
+    else if(streams > 1)
+        run_bench_stream_test(streams, arg, filter, any_stride);
+    else if(!parallel_devices)
     {
         std::string name_filter = "";
         run_bench_test(true, arg, filter, name_filter, any_stride);
@@ -1864,6 +2525,10 @@ try
     else
         run_bench_gpu_test(parallel_devices, arg, filter, any_stride);
 
+    if(cold)
+        rocblas_cout << "cold_total_us," << get_time_us_no_sync() - cold_wall_start << std::endl;
+
+    freq_monitor.unlockClocks();
     freeFrequencyMonitor();
 
     int status = 0;
@@ -1876,3 +2541,131 @@ catch(const std::invalid_argument& exp)
     rocblas_cerr << exp.what() << std::endl;
     return -1;
 }
+
+#ifndef WIN32
+// Daemon mode (--server <socket>): one warm process serves benchmark requests
+// over a local stream socket, so interactive shape checks skip the per-process
+// startup path (device init, Tensile code-object load) every invocation pays.
+// Protocol: one connection per request carrying a newline-terminated
+// rocblas-bench argument line; the run's output streams back over the
+// connection followed by a final "rocblas-bench-status,<code>" line. The
+// single-word request "shutdown" stops the server.
+int rocblas_bench_server(const char* prog, const char* socket_path)
+{
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listen_fd < 0)
+    {
+        perror("rocblas-bench: socket");
+        return -1;
+    }
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if(strlen(socket_path) >= sizeof(addr.sun_path))
+    {
+        rocblas_cerr << "rocblas-bench: socket path too long: " << socket_path << std::endl;
+        close(listen_fd);
+        return -1;
+    }
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+
+    unlink(socket_path);
+    if(bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 1) < 0)
+    {
+        perror("rocblas-bench: bind/listen");
+        close(listen_fd);
+        return -1;
+    }
+
+    rocblas_cout << "rocblas-bench server listening on " << socket_path << std::endl;
+
+    bool shutdown = false;
+    while(!shutdown)
+    {
+        int conn = accept(listen_fd, nullptr, nullptr);
+        if(conn < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            perror("rocblas-bench: accept");
+            break;
+        }
+
+        std::string request;
+        for(char c; read(conn, &c, 1) == 1 && c != '\n';)
+            request.push_back(c);
+
+        std::vector<std::string> tokens;
+        std::istringstream       words(request);
+        for(std::string w; words >> w;)
+            tokens.push_back(w);
+
+        int status = 0;
+        if(tokens.size() == 1 && tokens[0] == "shutdown")
+            shutdown = true;
+        else if(!tokens.empty())
+        {
+            std::vector<char*> req_argv;
+            req_argv.push_back(const_cast<char*>(prog));
+            for(auto& t : tokens)
+                req_argv.push_back(const_cast<char*>(t.c_str()));
+
+            // Route the run's output to the connection. A fresh thread binds
+            // its rocblas_cout to whatever fd 1 is on first use, so the
+            // redirect must be in place before the run starts.
+            fflush(stdout);
+            int saved_stdout = dup(STDOUT_FILENO);
+            dup2(conn, STDOUT_FILENO);
+
+            std::thread([&] {
+                try
+                {
+                    status = rocblas_bench_run(int(req_argv.size()), req_argv.data());
+                }
+                catch(...)
+                {
+                    status = -2;
+                }
+            }).join();
+
+            // Flush and drop the per-connection output workers before
+            // restoring fd 1, so the duplicated connection descriptors close
+            // and the client sees end of output
+            fflush(stdout);
+            rocblas_internal_ostream::clear_workers();
+            dup2(saved_stdout, STDOUT_FILENO);
+            close(saved_stdout);
+        }
+
+        std::string status_line = "rocblas-bench-status," + std::to_string(status) + "\n";
+        if(write(conn, status_line.c_str(), status_line.size()) < 0)
+            perror("rocblas-bench: write");
+        close(conn);
+    }
+
+    close(listen_fd);
+    unlink(socket_path);
+    return 0;
+}
+#endif // !WIN32
+
+int main(int argc, char* argv[])
+{
+    for(int i = 1; i < argc; ++i)
+        if(!strcmp(argv[i], "--server"))
+        {
+            if(i + 1 >= argc)
+            {
+                rocblas_cerr << "rocblas-bench: --server requires a socket path" << std::endl;
+                return -1;
+            }
+#ifdef WIN32
+            rocblas_cerr << "rocblas-bench: --server is not supported on Windows" << std::endl;
+            return -1;
+#else
+            return rocblas_bench_server(argv[0], argv[i + 1]);
+#endif
+        }
+
+    return rocblas_bench_run(argc, argv);
+}
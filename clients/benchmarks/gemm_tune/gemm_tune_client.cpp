@@ -23,6 +23,7 @@
 
 #include "type_dispatch.hpp"
 
+#include <fstream>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -30,6 +31,31 @@
 
 static const auto DELIM = ",";
 
+// Scan, process and remove the --tuning_file option; the remaining options
+// are handled by rocblas_parse_data
+static std::string parse_tuning_file_option(int& argc, char** argv)
+{
+    std::string path;
+    char**      argv_p = argv + 1;
+    for(int i = 1; argv[i]; ++i)
+    {
+        if(!strcmp(argv[i], "--tuning_file"))
+        {
+            if(!argv[i + 1])
+            {
+                rocblas_cerr << "The --tuning_file option requires a path argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            path = argv[++i];
+            argc -= 2;
+        }
+        else
+            *argv_p++ = argv[i];
+    }
+    *argv_p = nullptr;
+    return path;
+}
+
 template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
 struct GEMMTunerDispatch
 {
@@ -98,6 +124,8 @@ struct GEMMTunerDispatch<Ti, To, Tc, std::enable_if_t<!std::is_same_v<Tc, void>>
 int main(int argc, char* argv[])
 {
 #if BUILD_WITH_TENSILE
+    std::string tuning_file = parse_tuning_file_option(argc, argv);
+
     // Get arguments from file
     if(!rocblas_parse_data(argc, argv))
     {
@@ -114,6 +142,11 @@ int main(int argc, char* argv[])
                      << "  - {'rocblas_function': 'rocblas_sgemm', 'transA': 'T', 'transB': 'N', "
                         "'M': 512, 'N': 8320, 'K': 512, 'alpha': 1, 'lda': 512, 'ldb': 512, "
                         "'beta': 0, 'ldc': 512, 'device': 0, 'cold_iters': 5, 'iters': 20}"
+                     << "\n\n"
+                     << "  With --tuning_file <path> the winning non-batched gemm_ex solutions "
+                        "are additionally"
+                     << "\n"
+                     << "  written to <path> in the format consumed by ROCBLAS_TUNING_FILE."
                      << std::endl;
         return EXIT_FAILURE;
     }
@@ -143,6 +176,12 @@ int main(int argc, char* argv[])
     rocblas_internal_ostream* current_os;
     bool*                     current_entry;
 
+    // consolidated tuning-table entries in the line format the library's
+    // ROCBLAS_TUNING_FILE loader parses; only non-batched gemm/gemm_ex wins
+    // qualify since the table is keyed without a batch count
+    rocblas_internal_ostream tuning_os;
+    size_t                   tuning_entries = 0;
+
     // Track unique args to avoid duplicates
     std::unordered_set<std::string> processed{};
 
@@ -193,6 +232,17 @@ int main(int argc, char* argv[])
             {
                 *current_entry = true;
                 *current_os << arg_key << DELIM << best_solution_index << "\n";
+
+                if(!tuning_file.empty() && arg.batch_count <= 1
+                   && (!strcmp(arg.function, "gemm") || !strcmp(arg.function, "gemm_ex")))
+                {
+                    tuning_os << "- { transA: " << arg.transA << ", transB: " << arg.transB
+                              << ", m: " << arg.M << ", n: " << arg.N << ", k: " << arg.K
+                              << ", a_type: " << rocblas_datatype2string(arg.a_type)
+                              << ", compute_type: " << rocblas_datatype2string(arg.compute_type)
+                              << ", solution_index: " << best_solution_index << " }\n";
+                    tuning_entries++;
+                }
             }
         }
     }
@@ -211,6 +261,40 @@ int main(int argc, char* argv[])
 
     rocblas_cout << std::endl;
 
+    if(!tuning_file.empty())
+    {
+        if(!tuning_entries)
+            rocblas_cout << "rocblas-gemm-tune WARN: no tuning-table entries found, "
+                         << tuning_file << " not written" << std::endl;
+        else
+        {
+            std::string arch = "unknown";
+
+            int             device = 0;
+            hipDeviceProp_t props;
+            if(hipGetDevice(&device) == hipSuccess
+               && hipGetDeviceProperties(&props, device) == hipSuccess)
+            {
+                arch = props.gcnArchName;
+                arch = arch.substr(0, arch.find(':')); // drop the feature suffixes
+            }
+
+            std::ofstream out(tuning_file);
+            if(!out)
+                rocblas_cerr << "rocblas-gemm-tune ERROR: cannot write " << tuning_file
+                             << std::endl;
+            else
+            {
+                out << "# rocBLAS gemm tuning table for " << arch << "\n"
+                    << "# generated by rocblas-gemm-tune; activate with ROCBLAS_TUNING_FILE="
+                    << tuning_file << "\n"
+                    << tuning_os.str();
+                rocblas_cout << "rocblas-gemm-tune INFO: wrote " << tuning_entries
+                             << " entries to " << tuning_file << std::endl;
+            }
+        }
+    }
+
     test_cleanup::cleanup();
     return EXIT_SUCCESS;
 
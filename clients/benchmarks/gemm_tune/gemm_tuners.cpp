@@ -114,12 +114,44 @@ int GEMMTunerBase<Tc>::get_best_solution()
 }
 
 /* GEMM Ex */
+
+// Number of operand copies to rotate through while timing. With the
+// default arguments the copies cover at least 32 MiB so timed iterations
+// don't re-run against cache-resident inputs; explicit flush_batch_count or
+// flush_memory_size arguments override as in the bench client.
+static size_t gemm_tune_flush_batch_count(const Arguments& arg, size_t cached_size)
+{
+    constexpr size_t default_flush_memory_size = 32 * 1024 * 1024;
+
+    size_t flush_memory_size = arg.flush_memory_size;
+    if(arg.flush_batch_count <= 1 && !flush_memory_size)
+        flush_memory_size = default_flush_memory_size;
+
+    return calculate_flush_batch_count(arg.flush_batch_count, flush_memory_size, cached_size);
+}
+
 template <typename Ti, typename To, typename Tc>
 GEMMTunerEx<Ti, To, Tc>::GEMMTunerEx(const Arguments& arg)
     : GEMMTunerBase<Tc>(arg)
-    , m_dA(this->m_A_row, this->m_A_col, this->m_lda)
-    , m_dB(this->m_B_row, this->m_B_col, this->m_ldb)
-    , m_dC(this->m_M, this->m_N, this->m_ldc)
+    , m_flush_batch_count(gemm_tune_flush_batch_count(
+          arg,
+          sizeof(Ti) * (size_t(this->m_lda) * this->m_A_col + size_t(this->m_ldb) * this->m_B_col)
+              + sizeof(To) * size_t(this->m_ldc) * this->m_N))
+    , m_dA(this->m_A_row,
+           this->m_A_col,
+           this->m_lda,
+           align_stride<Ti>(size_t(this->m_lda) * this->m_A_col),
+           m_flush_batch_count)
+    , m_dB(this->m_B_row,
+           this->m_B_col,
+           this->m_ldb,
+           align_stride<Ti>(size_t(this->m_ldb) * this->m_B_col),
+           m_flush_batch_count)
+    , m_dC(this->m_M,
+           this->m_N,
+           this->m_ldc,
+           align_stride<To>(size_t(this->m_ldc) * this->m_N),
+           m_flush_batch_count)
 {
     // Check device memory allocation
     CHECK_DEVICE_ALLOCATION(m_dA.memcheck());
@@ -144,10 +176,29 @@ GEMMTunerEx<Ti, To, Tc>::GEMMTunerEx(const Arguments& arg)
         hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
     rocblas_init_matrix<To>(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(m_dA.transfer_from(hA));
-    CHECK_HIP_ERROR(m_dB.transfer_from(hB));
-    CHECK_HIP_ERROR(m_dC.transfer_from(hC));
+    // copy data from CPU to the first copy, then replicate device-to-device
+    CHECK_HIP_ERROR(hipMemcpy(
+        m_dA[0], hA, sizeof(Ti) * size_t(this->m_lda) * this->m_A_col, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        m_dB[0], hB, sizeof(Ti) * size_t(this->m_ldb) * this->m_B_col, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        m_dC[0], hC, sizeof(To) * size_t(this->m_ldc) * this->m_N, hipMemcpyHostToDevice));
+
+    for(size_t j = 1; j < m_flush_batch_count; j++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(m_dA[j],
+                                  m_dA[0],
+                                  sizeof(Ti) * size_t(this->m_lda) * this->m_A_col,
+                                  hipMemcpyDeviceToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(m_dB[j],
+                                  m_dB[0],
+                                  sizeof(Ti) * size_t(this->m_ldb) * this->m_B_col,
+                                  hipMemcpyDeviceToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(m_dC[j],
+                                  m_dC[0],
+                                  sizeof(To) * size_t(this->m_ldc) * this->m_N,
+                                  hipMemcpyDeviceToDevice));
+    }
 }
 
 template <typename Ti, typename To, typename Tc>
@@ -160,17 +211,17 @@ rocblas_status GEMMTunerEx<Ti, To, Tc>::get_solutions(rocblas_int* solution_list
                                          this->m_N,
                                          this->m_K,
                                          &this->m_alpha,
-                                         m_dA,
+                                         m_dA[0],
                                          this->m_input_type,
                                          this->m_lda,
-                                         m_dB,
+                                         m_dB[0],
                                          this->m_input_type,
                                          this->m_ldb,
                                          &this->m_beta,
-                                         m_dC,
+                                         m_dC[0],
                                          this->m_output_type,
                                          this->m_ldc,
-                                         m_dC,
+                                         m_dC[0],
                                          this->m_output_type,
                                          this->m_ldc,
                                          this->m_compute_type,
@@ -183,6 +234,11 @@ rocblas_status GEMMTunerEx<Ti, To, Tc>::get_solutions(rocblas_int* solution_list
 template <typename Ti, typename To, typename Tc>
 rocblas_status GEMMTunerEx<Ti, To, Tc>::run_with_solution(int solution_idx)
 {
+    // advance through the operand copies so back-to-back calls never reuse
+    // the matrices still resident in cache
+    size_t j      = m_flush_index;
+    m_flush_index = (m_flush_index + 1) % m_flush_batch_count;
+
     return rocblas_gemm_ex(this->m_handle,
                            this->m_trans_A,
                            this->m_trans_B,
@@ -190,17 +246,17 @@ rocblas_status GEMMTunerEx<Ti, To, Tc>::run_with_solution(int solution_idx)
                            this->m_N,
                            this->m_K,
                            &this->m_alpha,
-                           m_dA,
+                           m_dA[j],
                            this->m_input_type,
                            this->m_lda,
-                           m_dB,
+                           m_dB[j],
                            this->m_input_type,
                            this->m_ldb,
                            &this->m_beta,
-                           m_dC,
+                           m_dC[j],
                            this->m_output_type,
                            this->m_ldc,
-                           m_dC,
+                           m_dC[j],
                            this->m_output_type,
                            this->m_ldc,
                            this->m_compute_type,
@@ -86,9 +86,14 @@ private:
     rocblas_status get_solutions(rocblas_int* solution_list, rocblas_int* size) override;
     rocblas_status run_with_solution(int solution_idx) override;
 
-    device_matrix<Ti> m_dA;
-    device_matrix<Ti> m_dB;
-    device_matrix<To> m_dC;
+    // operands rotate through flush_batch_count copies so timed iterations
+    // don't re-run against cache-resident inputs, as in the bench client
+    size_t m_flush_batch_count;
+    size_t m_flush_index = 0;
+
+    device_strided_batch_matrix<Ti> m_dA;
+    device_strided_batch_matrix<Ti> m_dB;
+    device_strided_batch_matrix<To> m_dC;
 };
 
 template <typename Ti, typename To = Ti, typename Tc = To>
@@ -22,6 +22,9 @@
 
 #include "argument_model.hpp"
 #include "frequency_monitor.hpp"
+#include "latency_monitor.hpp"
+#include <hip/hip_runtime_api.h>
+#include <memory>
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 static bool log_function_name = false;
@@ -85,4 +88,223 @@ void ArgumentModel_log_frequencies(rocblas_internal_ostream& name_line,
 
     name_line << ",median-MCLK";
     val_line << "," << frequency_monitor.getMedianMEMCLK();
+
+    if(frequency_monitor.throttlingDetected())
+        rocblas_cerr << "rocblas-bench warning: clock throttling detected during measurement, "
+                        "reported performance may not be comparable across runs"
+                     << std::endl;
+}
+
+void ArgumentModel_log_energy(rocblas_internal_ostream& name_line,
+                              rocblas_internal_ostream& val_line,
+                              double                    gflops)
+{
+    FrequencyMonitor& frequency_monitor = getFrequencyMonitor();
+    if(!frequency_monitor.enabled())
+        return;
+
+    double watts = frequency_monitor.getAveragePowerWatts();
+    if(watts > 0)
+    {
+        name_line << ",avg-power-W";
+        val_line << "," << watts;
+
+        name_line << ",energy-J";
+        val_line << "," << frequency_monitor.getEnergyJoules();
+
+        if(gflops > 0)
+        {
+            // joules to perform 1e9 floating point ops at the average power draw
+            name_line << ",J-per-Gflop";
+            val_line << "," << watts / gflops;
+        }
+    }
+
+    double ghz = frequency_monitor.getLowestAverageSYSCLK() / 1000.0;
+    if(gflops > 0 && ghz > 0)
+    {
+        // separates kernel efficiency from the clock the part sustained
+        name_line << ",Gflops-per-GHz";
+        val_line << "," << gflops / ghz;
+    }
+}
+
+// Structured results writer (--yaml_out). A plain stream singleton in the
+// style of the logging flags above; the stream is opened once and each result
+// is appended and flushed, so a killed sweep keeps everything measured so far.
+static std::unique_ptr<rocblas_internal_ostream> yaml_out_stream;
+
+void ArgumentModel_set_yaml_out(const std::string& path)
+{
+    yaml_out_stream = std::make_unique<rocblas_internal_ostream>(path);
+}
+
+void ArgumentModel_log_yaml_out(const Arguments& arg,
+                                rocblas_int      batch_count,
+                                double           gpu_us,
+                                double           gflops,
+                                double           gbytes,
+                                double           cpu_us,
+                                double           norm1,
+                                double           norm2,
+                                double           norm3,
+                                double           norm4)
+{
+    auto* os = yaml_out_stream.get();
+    if(!os)
+        return;
+
+    // same per-call normalization as log_perf: gpu time is cumulative over hot calls
+    rocblas_int hot_calls = arg.iters < 1 ? 1 : arg.iters;
+    if(hot_calls > 1)
+        gpu_us /= hot_calls;
+
+    const double c_per_usec_to_per_sec = 1e6;
+
+    // one YAML list item per result: the non-default Arguments fields (flow
+    // mapping printed by Arguments::operator<<) followed by the measurements
+    *os << "- args: " << arg;
+    *os << "  perf: { us: " << gpu_us;
+    if(gflops != ArgumentLogging::NA_value)
+        *os << ", rocblas-Gflops: " << gflops * batch_count / gpu_us * c_per_usec_to_per_sec;
+    if(gbytes != ArgumentLogging::NA_value)
+        *os << ", rocblas-GBps: " << gbytes * batch_count / gpu_us * c_per_usec_to_per_sec;
+    if(cpu_us != ArgumentLogging::NA_value)
+        *os << ", CPU-us: " << cpu_us;
+    if(norm1 != ArgumentLogging::NA_value)
+        *os << ", norm_error_1: " << norm1;
+    if(norm2 != ArgumentLogging::NA_value)
+        *os << ", norm_error_2: " << norm2;
+    if(norm3 != ArgumentLogging::NA_value)
+        *os << ", norm_error_3: " << norm3;
+    if(norm4 != ArgumentLogging::NA_value)
+        *os << ", norm_error_4: " << norm4;
+
+    // per-iteration latency distribution, when ROCBLAS_BENCH_LATENCY collection is on
+    LatencyMonitor& latency_monitor = getLatencyMonitor();
+    if(latency_monitor.enabled() && !latency_monitor.empty())
+        *os << ", latency-p50-us: " << latency_monitor.percentile(50.0)
+            << ", latency-p90-us: " << latency_monitor.percentile(90.0)
+            << ", latency-p99-us: " << latency_monitor.percentile(99.0)
+            << ", latency-max-us: " << latency_monitor.max()
+            << ", latency-stddev-us: " << latency_monitor.stddev();
+
+    *os << " }" << std::endl;
+    os->flush();
+}
+
+// Roofline audit writer (--roofline_out). Follows the yaml_out singleton
+// above: records are appended and flushed per result, so a killed sweep
+// keeps the audit of everything measured so far. The memory ceiling is the
+// device's theoretical bandwidth; the compute ceiling is only known when the
+// caller supplies it, since it depends on the precision and pipeline mix
+// under audit.
+static std::unique_ptr<rocblas_internal_ostream> roofline_out_stream;
+static double                                    roofline_peak_gflops = 0.0;
+static double                                    roofline_peak_gbps   = 0.0;
+
+void ArgumentModel_set_roofline_out(const std::string& path, double peak_gflops)
+{
+    roofline_out_stream  = std::make_unique<rocblas_internal_ostream>(path);
+    roofline_peak_gflops = peak_gflops;
+
+    // theoretical bandwidth of the active device: DDR transfers on the
+    // reported memory clock across the full bus width
+    int             dev = 0;
+    hipDeviceProp_t prop;
+    if(hipGetDevice(&dev) == hipSuccess && hipGetDeviceProperties(&prop, dev) == hipSuccess)
+        roofline_peak_gbps
+            = 2.0 * prop.memoryClockRate /*kHz*/ * 1e3 * (prop.memoryBusWidth / 8.0) / 1e9;
+
+    *roofline_out_stream << "# roofline ceilings: { peak-GBps: " << roofline_peak_gbps
+                         << ", peak-Gflops: ";
+    if(roofline_peak_gflops > 0)
+        *roofline_out_stream << roofline_peak_gflops;
+    else
+        *roofline_out_stream << "unknown";
+    *roofline_out_stream << " }" << std::endl;
+    roofline_out_stream->flush();
+}
+
+void ArgumentModel_log_roofline(
+    const Arguments& arg, rocblas_int batch_count, double gpu_us, double gflops, double gbytes)
+{
+    auto* os = roofline_out_stream.get();
+    if(!os)
+        return;
+
+    // same per-call normalization as log_perf: gpu time is cumulative over hot calls
+    rocblas_int hot_calls = arg.iters < 1 ? 1 : arg.iters;
+    if(hot_calls > 1)
+        gpu_us /= hot_calls;
+    if(gpu_us <= 0)
+        return;
+
+    const double c_per_usec_to_per_sec = 1e6;
+
+    bool has_flops = gflops != ArgumentLogging::NA_value;
+    bool has_bytes = gbytes != ArgumentLogging::NA_value;
+
+    double achieved_gflops
+        = has_flops ? gflops * batch_count / gpu_us * c_per_usec_to_per_sec : 0.0;
+    double achieved_gbps = has_bytes ? gbytes * batch_count / gpu_us * c_per_usec_to_per_sec : 0.0;
+
+    *os << "- args: " << arg;
+    *os << "  roofline: { us: " << gpu_us;
+
+    if(has_flops && has_bytes && gbytes > 0)
+        *os << ", intensity-flops-per-byte: " << gflops / gbytes;
+    if(has_flops)
+        *os << ", achieved-Gflops: " << achieved_gflops;
+    if(has_bytes)
+        *os << ", achieved-GBps: " << achieved_gbps;
+    if(has_bytes && roofline_peak_gbps > 0)
+        *os << ", pct-peak-bandwidth: " << 100.0 * achieved_gbps / roofline_peak_gbps;
+    if(has_flops && roofline_peak_gflops > 0)
+        *os << ", pct-peak-Gflops: " << 100.0 * achieved_gflops / roofline_peak_gflops;
+
+    // position against the binding ceiling: the shape sits in the
+    // bandwidth-bound region when its intensity is below the ridge point
+    if(has_flops && has_bytes && gbytes > 0 && roofline_peak_gbps > 0 && roofline_peak_gflops > 0)
+    {
+        double intensity = gflops / gbytes;
+        double ridge     = roofline_peak_gflops / roofline_peak_gbps;
+        bool   bw_bound  = intensity < ridge;
+        double roof      = bw_bound ? intensity * roofline_peak_gbps : roofline_peak_gflops;
+
+        *os << ", bound: " << (bw_bound ? "bandwidth" : "compute")
+            << ", pct-roof: " << 100.0 * achieved_gflops / roof;
+    }
+    else if(has_bytes && !has_flops && roofline_peak_gbps > 0)
+    {
+        // pure data-movement functions (copy, swap): the memory roof is the
+        // only roof
+        *os << ", bound: bandwidth, pct-roof: " << 100.0 * achieved_gbps / roofline_peak_gbps;
+    }
+
+    *os << " }" << std::endl;
+    os->flush();
+}
+
+void ArgumentModel_log_latencies(rocblas_internal_ostream& name_line,
+                                 rocblas_internal_ostream& val_line)
+{
+    LatencyMonitor& latency_monitor = getLatencyMonitor();
+    if(!latency_monitor.enabled() || latency_monitor.empty())
+        return;
+
+    name_line << ",latency-p50-us";
+    val_line << "," << latency_monitor.percentile(50.0);
+
+    name_line << ",latency-p90-us";
+    val_line << "," << latency_monitor.percentile(90.0);
+
+    name_line << ",latency-p99-us";
+    val_line << "," << latency_monitor.percentile(99.0);
+
+    name_line << ",latency-max-us";
+    val_line << "," << latency_monitor.max();
+
+    name_line << ",latency-stddev-us";
+    val_line << "," << latency_monitor.stddev();
 }
@@ -386,6 +386,30 @@ void rocblas_local_handle::rocblas_stream_end_capture()
     m_handle->set_stream_order_memory_allocation(false);
 }
 
+hipGraphExec_t rocblas_local_handle::rocblas_stream_end_capture_instantiate()
+{
+    hipGraph_t     graph;
+    hipGraphExec_t instance;
+
+    // END GRAPH CAPTURE
+    CHECK_HIP_ERROR(hipStreamEndCapture(m_graph_stream, &graph));
+    CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, NULL, NULL, 0));
+
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    return instance;
+}
+
+void rocblas_local_handle::rocblas_graph_replay_cleanup(hipGraphExec_t instance)
+{
+    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(m_handle, m_old_stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(m_graph_stream));
+    m_graph_stream = nullptr;
+
+    m_handle->set_stream_order_memory_allocation(false);
+}
+
 void rocblas_parallel_initialize_thread(int id, size_t& memory_used)
 {
     size_t before_init, after_init, total_memory;
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************/
+
+#include "device_timer.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+#define DEVICE_TIMER_HIP_CHECK_EXC(expr)                                                          \
+    do                                                                                            \
+    {                                                                                             \
+        hipError_t e = (expr);                                                                    \
+        if(e)                                                                                     \
+        {                                                                                         \
+            std::ostringstream msg;                                                               \
+            msg << "Error " << e << "(" << hipGetErrorName(e) << ") " << __FILE__ << ":"          \
+                << __LINE__ << ": " << #expr << " " << hipGetErrorString(e);                      \
+            throw std::runtime_error(msg.str());                                                  \
+        }                                                                                         \
+    } while(0)
+
+namespace
+{
+    // single-thread kernel reading the device wall clock (s_memrealtime on
+    // AMD hardware), which ticks at a constant rate independent of the
+    // shader clock
+    __global__ void device_timestamp_kernel(int64_t* stamp)
+    {
+        *stamp = wall_clock64();
+    }
+}
+
+bool DeviceTimer::enabled()
+{
+    static const char* env = getenv("ROCBLAS_BENCH_DEVICE_TIMER");
+    if(!(env != nullptr && *env != '0'))
+        return false;
+    init();
+    return us_per_tick != 0.0;
+}
+
+void DeviceTimer::init()
+{
+    if(device_stamps)
+        return;
+
+    int device = 0, rate_khz = 0;
+    DEVICE_TIMER_HIP_CHECK_EXC(hipGetDevice(&device));
+    // wall clock rate is reported in kHz; a zero rate means the device does
+    // not expose the constant-rate clock and the timer stays disabled
+    if(hipDeviceGetAttribute(&rate_khz, hipDeviceAttributeWallClockRate, device) == hipSuccess
+       && rate_khz > 0)
+    {
+        us_per_tick = 1000.0 / rate_khz;
+    }
+
+    DEVICE_TIMER_HIP_CHECK_EXC(hipMalloc(&device_stamps, 2 * sizeof(int64_t)));
+}
+
+void DeviceTimer::mark_start(hipStream_t stream)
+{
+    if(!enabled())
+        return;
+    hipLaunchKernelGGL(device_timestamp_kernel, dim3(1), dim3(1), 0, stream, device_stamps);
+    DEVICE_TIMER_HIP_CHECK_EXC(hipGetLastError());
+}
+
+void DeviceTimer::mark_stop(hipStream_t stream)
+{
+    if(!enabled())
+        return;
+    hipLaunchKernelGGL(device_timestamp_kernel, dim3(1), dim3(1), 0, stream, device_stamps + 1);
+    DEVICE_TIMER_HIP_CHECK_EXC(hipGetLastError());
+}
+
+double DeviceTimer::time_us(hipStream_t stream)
+{
+    if(!enabled())
+        return 0.0;
+    int64_t stamps[2];
+    DEVICE_TIMER_HIP_CHECK_EXC(hipStreamSynchronize(stream));
+    DEVICE_TIMER_HIP_CHECK_EXC(
+        hipMemcpy(stamps, device_stamps, sizeof(stamps), hipMemcpyDeviceToHost));
+    return double(stamps[1] - stamps[0]) * us_per_tick;
+}
+
+DeviceTimer::~DeviceTimer()
+{
+    if(device_stamps)
+        (void)hipFree(device_stamps);
+}
+
+DeviceTimer& getDeviceTimer()
+{
+    // one timer per thread so concurrent benchmark threads bracket their own
+    // streams with their own timestamp buffers
+    static thread_local DeviceTimer timer;
+    return timer;
+}
@@ -25,6 +25,7 @@
 #include "rocblas.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <future>
 #include <memory>
@@ -99,6 +100,7 @@ class FrequencyMonitorImp : public FrequencyMonitor
 public:
     const double cHzToMHz = 0.000001;
     const double cMhzToHz = 1000000;
+    const double cuWToW   = 0.000001;
 
     // deleting copy constructor
     FrequencyMonitorImp(const FrequencyMonitorImp& obj) = delete;
@@ -125,6 +127,8 @@ public:
 
     ~FrequencyMonitorImp()
     {
+        unlockClocks(); // restore the performance level if still pinned
+
         m_stop = true;
         m_exit = true;
 
@@ -254,6 +258,78 @@ public:
         return medianValueMHz(m_MEMCLK_array);
     }
 
+    double getAveragePowerWatts()
+    {
+        assertNotActive();
+        if(m_power_array.empty())
+            return 0.0;
+
+        return m_power_sum / double(m_power_array.size());
+    }
+
+    double getEnergyJoules()
+    {
+        assertNotActive();
+        return m_energy_J;
+    }
+
+    bool lockClocks()
+    {
+        InitROCmSMI();
+
+        if(m_clocksLocked)
+            return true;
+
+        // remember the level in effect so unlockClocks can put it back
+        if(rsmi_dev_perf_level_get(m_smiDeviceIndex, &m_savedPerfLevel) != RSMI_STATUS_SUCCESS)
+            m_savedPerfLevel = RSMI_DEV_PERF_LEVEL_AUTO;
+
+        // stable_peak pins SCLK and MCLK to fixed, sustainable frequencies;
+        // setting a performance level needs elevated privileges, so failure
+        // is reported rather than thrown and the run continues unlocked
+        if(rsmi_dev_perf_level_set_v1(m_smiDeviceIndex, RSMI_DEV_PERF_LEVEL_STABLE_PEAK)
+           != RSMI_STATUS_SUCCESS)
+            return false;
+
+        m_clocksLocked = true;
+        return true;
+    }
+
+    void unlockClocks()
+    {
+        if(!m_clocksLocked)
+            return;
+
+        rsmi_dev_perf_level_set_v1(m_smiDeviceIndex, m_savedPerfLevel);
+        m_clocksLocked = false;
+    }
+
+    bool throttlingDetected()
+    {
+        assertNotActive();
+
+        // samples more than 3% below the window's median indicate the clock
+        // was pulled down mid-measurement rather than just settling
+        const double cThrottleTolerance = 0.97;
+
+        for(int i = 0; i < m_XCDCount; i++)
+        {
+            auto data = m_SYSCLK_array[i]; // copy, medianValueMHz sorts in place
+            if(data.empty())
+                continue;
+
+            double median = medianValueMHz(data);
+            if(median <= 0)
+                continue;
+
+            // data is sorted by the median computation
+            double lowest = static_cast<double>(data.front()) * cHzToMHz;
+            if(lowest < cThrottleTolerance * median)
+                return true;
+        }
+        return false;
+    }
+
 private:
     void initThread()
     {
@@ -346,6 +422,21 @@ private:
                 m_MEMCLK_array.push_back(freq.frequency[freq.current]);
             }
 
+            // board power, integrated over the elapsed interval for energy
+            uint64_t power_uW = 0;
+            auto     now      = std::chrono::steady_clock::now();
+            auto     status3  = rsmi_dev_power_ave_get(m_smiDeviceIndex, 0, &power_uW);
+            if(status3 == RSMI_STATUS_SUCCESS)
+            {
+                double watts = power_uW * cuWToW;
+                if(!m_power_array.empty())
+                    m_energy_J
+                        += watts * std::chrono::duration<double>(now - m_lastPowerTime).count();
+                m_power_sum += watts;
+                m_power_array.push_back(watts);
+                m_lastPowerTime = now;
+            }
+
             // collect freq every 50ms regardless of success
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
@@ -370,6 +461,9 @@ private:
         m_SYSCLK_array = std::vector<std::vector<uint64_t>>(m_XCDCount, std::vector<uint64_t>{});
         m_MEMCLK_sum   = 0;
         m_MEMCLK_array.clear();
+        m_power_sum = 0.0;
+        m_power_array.clear();
+        m_energy_J = 0.0;
     }
 
     void wait()
@@ -467,6 +561,14 @@ private:
     uint64_t                           m_MEMCLK_sum;
     std::vector<uint64_t>              m_MEMCLK_array;
 
+    double                                m_power_sum = 0.0;
+    std::vector<double>                   m_power_array;
+    double                                m_energy_J = 0.0;
+    std::chrono::steady_clock::time_point m_lastPowerTime;
+
+    bool                  m_clocksLocked   = false;
+    rsmi_dev_perf_level_t m_savedPerfLevel = RSMI_DEV_PERF_LEVEL_AUTO;
+
 #else // WIN32
 
     // not supporting windows for now
@@ -521,6 +623,28 @@ public:
     {
         return 0.0;
     }
+
+    double getAveragePowerWatts()
+    {
+        return 0.0;
+    }
+
+    double getEnergyJoules()
+    {
+        return 0.0;
+    }
+
+    bool lockClocks()
+    {
+        return false;
+    }
+
+    void unlockClocks() {}
+
+    bool throttlingDetected()
+    {
+        return false;
+    }
 #endif
 };
 
@@ -29,9 +29,11 @@
 #include <string.h>
 #endif
 
+#include <hip/hip_runtime.h>
 #include <map>
 #include <mutex>
 #include <stdlib.h>
+#include <vector>
 
 #include "host_alloc.hpp"
 #include "rocblas_test.hpp"
@@ -41,6 +43,89 @@ static size_t                  mem_used{0};
 static std::map<void*, size_t> mem_allocated;
 static std::mutex              mem_mutex;
 
+// reusable size-bucketed pinned host pool; set env ROCBLAS_CLIENT_PINNED_POOL to enable,
+// optionally to a GB cap on cached blocks.  Large sweeps then reuse pinned blocks across
+// test cases instead of paying malloc/free and page faults on every case.
+static size_t pinned_pool_cap{0}; // cached byte limit, 0 is unbounded
+
+static bool pinned_pool_enabled()
+{
+    static bool enabled = [] {
+        auto* pool = getenv("ROCBLAS_CLIENT_PINNED_POOL");
+        if(pool)
+        {
+            size_t cap_GB;
+            if(sscanf(pool, "%zu", &cap_GB) == 1)
+                pinned_pool_cap = cap_GB << 30; // GB to B
+        }
+        return pool != nullptr;
+    }();
+    return enabled;
+}
+
+static std::map<size_t, std::vector<void*>> pool_free_blocks; // bucket size to cached blocks
+static std::map<void*, size_t>              pool_block_size; // in-use and cached blocks
+static size_t                               pool_cached_bytes{0};
+static std::mutex                           pool_mutex;
+
+// power of two buckets so sweeps over many nearby sizes reuse the same blocks
+inline size_t pool_bucket(size_t size)
+{
+    size_t bucket = 4096;
+    while(bucket < size)
+        bucket <<= 1;
+    return bucket;
+}
+
+static void* pool_malloc(size_t size)
+{
+    size_t bucket = pool_bucket(size);
+
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+
+        auto free_list = pool_free_blocks.find(bucket);
+        if(free_list != pool_free_blocks.end() && !free_list->second.empty())
+        {
+            void* ptr = free_list->second.back();
+            free_list->second.pop_back();
+            pool_cached_bytes -= bucket;
+            return ptr;
+        }
+    }
+
+    void* ptr = nullptr;
+    if(hipHostMalloc(&ptr, bucket, hipHostMallocDefault) != hipSuccess)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    pool_block_size[ptr] = bucket;
+    return ptr;
+}
+
+// returns false if ptr was not handed out by the pool and the caller must free it
+static bool pool_free(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    auto block = pool_block_size.find(ptr);
+    if(block == pool_block_size.end())
+        return false;
+
+    size_t bucket = block->second;
+    if(pinned_pool_cap && pool_cached_bytes + bucket > pinned_pool_cap)
+    {
+        // over the cap, release back to the runtime instead of caching
+        pool_block_size.erase(block);
+        (void)hipHostFree(ptr);
+        return true;
+    }
+
+    pool_free_blocks[bucket].push_back(ptr);
+    pool_cached_bytes += bucket;
+    return true;
+}
+
 inline void alloc_ptr_use(void* ptr, size_t size)
 {
     std::lock_guard<std::mutex> lock(mem_mutex);
@@ -183,7 +268,7 @@ void* host_malloc(size_t size)
 {
     if(host_mem_safe(size))
     {
-        void* ptr = malloc(size);
+        void* ptr = pinned_pool_enabled() ? pool_malloc(size) : malloc(size);
 
         static int value = -1;
 
@@ -213,7 +298,18 @@ void* host_calloc(size_t nmemb, size_t size)
 {
     if(host_mem_safe(nmemb * size))
     {
-        void* ptr = calloc(nmemb, size);
+        void* ptr;
+        if(pinned_pool_enabled())
+        {
+            // reused pool blocks hold stale data, so clear them as calloc would
+            ptr = pool_malloc(nmemb * size);
+            if(ptr)
+                memset(ptr, 0, nmemb * size);
+        }
+        else
+        {
+            ptr = calloc(nmemb, size);
+        }
         alloc_ptr_use(ptr, size);
         return ptr;
     }
@@ -223,6 +319,7 @@ void* host_calloc(size_t nmemb, size_t size)
 
 void host_free(void* ptr)
 {
-    free(ptr);
+    if(!pinned_pool_enabled() || !pool_free(ptr))
+        free(ptr);
     free_ptr_use(ptr);
 }
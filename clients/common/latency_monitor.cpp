@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************/
+
+#include "latency_monitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+bool LatencyMonitor::enabled()
+{
+    static const char* env = getenv("ROCBLAS_BENCH_LATENCY");
+    return env != nullptr && *env != '0';
+}
+
+void LatencyMonitor::start()
+{
+    samples.clear();
+    sorted = false;
+}
+
+void LatencyMonitor::record(double us)
+{
+    samples.push_back(us);
+    sorted = false;
+}
+
+bool LatencyMonitor::empty() const
+{
+    return samples.empty();
+}
+
+double LatencyMonitor::percentile(double p)
+{
+    if(samples.empty())
+        return 0.0;
+    if(!sorted)
+    {
+        std::sort(samples.begin(), samples.end());
+        sorted = true;
+    }
+    // nearest-rank on the sorted samples
+    size_t rank = size_t(p / 100.0 * double(samples.size()));
+    if(rank >= samples.size())
+        rank = samples.size() - 1;
+    return samples[rank];
+}
+
+double LatencyMonitor::max()
+{
+    return percentile(100.0);
+}
+
+double LatencyMonitor::stddev() const
+{
+    size_t n = samples.size();
+    if(n < 2)
+        return 0.0;
+    double mean = 0.0;
+    for(double s : samples)
+        mean += s;
+    mean /= double(n);
+    double var = 0.0;
+    for(double s : samples)
+        var += (s - mean) * (s - mean);
+    return std::sqrt(var / double(n - 1));
+}
+
+LatencyMonitor& getLatencyMonitor()
+{
+    // one monitor per thread so concurrent benchmark threads (e.g. the
+    // rocblas-bench --streams mode) collect and report independent samples
+    static thread_local LatencyMonitor monitor;
+    return monitor;
+}
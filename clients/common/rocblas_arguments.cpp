@@ -151,6 +151,7 @@ void Arguments::init()
     HMM                 = false;
     graph_test          = false;
     repeatability_check = false;
+    device_check        = false;
 
     use_hipblaslt = -1;
 }
@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// begin/end_sequence is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_blas1_sequence : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_begin_sequence(nullptr), rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_end_sequence(nullptr), rocblas_status_invalid_handle);
+
+            // end without a matching begin
+            EXPECT_ROCBLAS_STATUS(rocblas_end_sequence(handle), rocblas_status_internal_error);
+
+            // nested begin
+            CHECK_ROCBLAS_ERROR(rocblas_begin_sequence(handle));
+            EXPECT_ROCBLAS_STATUS(rocblas_begin_sequence(handle), rocblas_status_internal_error);
+
+            // an empty sequence replays as a no-op
+            CHECK_ROCBLAS_ERROR(rocblas_end_sequence(handle));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            const rocblas_int N       = 64;
+            const float       alpha_s = 3.0f;
+            const float       alpha_a = 2.0f;
+            const double      alpha_d = -2.0;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy1, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy2, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy3, (N, 1));
+            HOST_MEMCHECK(host_vector<double>, hdx, (N, 1));
+            HOST_MEMCHECK(host_vector<double>, hdy, (N, 1));
+
+            // small integers keep the reference comparison exact
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i]  = float(i % 5 - 2);
+                hy1[i] = float(i % 3 - 1);
+                hy2[i] = float(i % 7 - 3);
+                hy3[i] = -1.0f;
+                hdx[i] = double(i % 5 - 2);
+                hdy[i] = double(i % 3 - 1);
+            }
+
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy1, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy2, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy3, (N, 1));
+            DEVICE_MEMCHECK(device_vector<double>, ddx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<double>, ddy, (N, 1));
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy1.transfer_from(hy1));
+            CHECK_HIP_ERROR(dy2.transfer_from(hy2));
+            CHECK_HIP_ERROR(dy3.transfer_from(hy3));
+            CHECK_HIP_ERROR(ddx.transfer_from(hdx));
+            CHECK_HIP_ERROR(ddy.transfer_from(hdy));
+
+            // a mixed burst of independent operations recorded into one
+            // sequence and replayed by a single kernel at end_sequence
+            CHECK_ROCBLAS_ERROR(rocblas_begin_sequence(handle));
+            CHECK_ROCBLAS_ERROR(rocblas_sscal(handle, N, &alpha_s, dy1, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha_a, dx, 1, dy2, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_scopy(handle, N, dx, 1, dy3, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_daxpy(handle, N, &alpha_d, ddx, 1, ddy, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_end_sequence(handle));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            HOST_MEMCHECK(host_vector<float>, hres, (N, 1));
+            HOST_MEMCHECK(host_vector<double>, hdres, (N, 1));
+
+            CHECK_HIP_ERROR(hres.transfer_from(dy1));
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(alpha_s * hy1[i], hres[i]);
+
+            CHECK_HIP_ERROR(hres.transfer_from(dy2));
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(alpha_a * hx[i] + hy2[i], hres[i]);
+
+            CHECK_HIP_ERROR(hres.transfer_from(dy3));
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(hx[i], hres[i]);
+
+            CHECK_HIP_ERROR(hdres.transfer_from(ddy));
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(alpha_d * hdx[i] + hdy[i], hdres[i]);
+
+            // after end_sequence the handle is back to eager dispatch
+            CHECK_ROCBLAS_ERROR(rocblas_sscal(handle, N, &alpha_s, dy3, 1));
+            CHECK_HIP_ERROR(hres.transfer_from(dy3));
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(alpha_s * hx[i], hres[i]);
+        }
+    };
+
+    struct blas1_sequence : RocBLAS_Test<blas1_sequence, testing_blas1_sequence>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "blas1_sequence");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<blas1_sequence>(arg.name);
+        }
+    };
+
+    TEST_P(blas1_sequence, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_blas1_sequence<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(blas1_sequence)
+
+} // namespace
@@ -20,12 +20,16 @@
  *
  * ************************************************************************ */
 
+// trsm_ex_invert is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
 #include "blas3/common_trsm.hpp"
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
 #include "testing_trsm_batched_ex.hpp"
 #include "testing_trsm_ex.hpp"
+#include "testing_trsm_ex_invert.hpp"
 #include "testing_trsm_strided_batched_ex.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
@@ -39,6 +43,7 @@ namespace
     {
         TRSM,
         TRSM_EX,
+        TRSM_EX_INVERT,
         TRSM_BATCHED,
         TRSM_BATCHED_EX,
         TRSM_STRIDED_BATCHED,
@@ -65,6 +70,9 @@ namespace
                        || !strcmp(arg.function, "trsm_internal_interfaces");
             case TRSM_EX:
                 return !strcmp(arg.function, "trsm_ex") || !strcmp(arg.function, "trsm_ex_bad_arg");
+            case TRSM_EX_INVERT:
+                return !strcmp(arg.function, "trsm_ex_invert")
+                       || !strcmp(arg.function, "trsm_ex_invert_bad_arg");
             case TRSM_BATCHED:
                 return !strcmp(arg.function, "trsm_batched")
                        || !strcmp(arg.function, "trsm_batched_bad_arg")
@@ -158,6 +166,10 @@ namespace
                 testing_trsm_ex<T>(arg);
             else if(!strcmp(arg.function, "trsm_ex_bad_arg"))
                 testing_trsm_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "trsm_ex_invert"))
+                testing_trsm_ex_invert<T>(arg);
+            else if(!strcmp(arg.function, "trsm_ex_invert_bad_arg"))
+                testing_trsm_ex_invert_bad_arg<T>(arg);
             else if(!strcmp(arg.function, "trsm_batched"))
                 testing_trsm_batched<T>(arg);
             else if(!strcmp(arg.function, "trsm_batched_bad_arg"))
@@ -195,6 +207,13 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsm_ex);
 
+    using trsm_ex_invert = trsm_template<trsm_testing, TRSM_EX_INVERT>;
+    TEST_P(trsm_ex_invert, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(rocblas_simple_dispatch<trsm_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsm_ex_invert);
+
     using trsm_batched = trsm_template<trsm_testing, TRSM_BATCHED>;
     TEST_P(trsm_batched, blas3_tensile)
     {
@@ -29,6 +29,7 @@ enum class blas1_ex
     axpy_ex,
     axpy_batched_ex,
     axpy_strided_batched_ex,
+    axpby_ex,
     dot_ex,
     dotc_ex,
     dot_batched_ex,
@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "blas_ex/common_f8_convert.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // f8_convert testing template (b_type selects the f8/bf8 destination)
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct f8_convert_template : RocBLAS_Test<f8_convert_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<f8_convert_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "f8_convert")
+                   || !strcmp(arg.function, "f8_convert_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<f8_convert_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << rocblas_datatype2string(arg.b_type) << '_' << arg.N << '_'
+                     << arg.stride_x << '_' << arg.stride_y << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename T, typename = void>
+    struct f8_convert_testing : rocblas_test_invalid
+    {
+    };
+
+    // The conversion reads float or half sources
+    template <typename T>
+    struct f8_convert_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, rocblas_half>>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "f8_convert"))
+                testing_f8_convert<T>(arg);
+            else if(!strcmp(arg.function, "f8_convert_bad_arg"))
+                testing_f8_convert_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using f8_convert = f8_convert_template<f8_convert_testing>;
+    TEST_P(f8_convert, blas1_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<f8_convert_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(f8_convert);
+
+} // namespace
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "blas_ex/common_gemm_batched_ex_scaled.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // gemm_batched_ex_scaled testing template
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct gemm_batched_ex_scaled_template
+        : RocBLAS_Test<gemm_batched_ex_scaled_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<
+                gemm_batched_ex_scaled_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_batched_ex_scaled")
+                   || !strcmp(arg.function, "gemm_batched_ex_scaled_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_batched_ex_scaled_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.lda << '_'
+                     << arg.ldb << '_' << arg.ldc << '_' << arg.ldd << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename T, typename = void>
+    struct gemm_batched_ex_scaled_testing : rocblas_test_invalid
+    {
+    };
+
+    // The client suite exercises the float and double paths; the API accepts
+    // the same type combinations as gemm_batched_ex
+    template <typename T>
+    struct gemm_batched_ex_scaled_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_batched_ex_scaled"))
+                testing_gemm_batched_ex_scaled<T>(arg);
+            else if(!strcmp(arg.function, "gemm_batched_ex_scaled_bad_arg"))
+                testing_gemm_batched_ex_scaled_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_batched_ex_scaled = gemm_batched_ex_scaled_template<gemm_batched_ex_scaled_testing>;
+    TEST_P(gemm_batched_ex_scaled, blas3_tensile)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(
+            rocblas_simple_dispatch<gemm_batched_ex_scaled_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_batched_ex_scaled);
+
+} // namespace
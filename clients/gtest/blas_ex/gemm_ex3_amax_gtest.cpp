@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "blas_ex/common_gemm_ex3_amax.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // gemm_ex3_amax testing template
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct gemm_ex3_amax_template : RocBLAS_Test<gemm_ex3_amax_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<gemm_ex3_amax_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+#if(BUILD_WITH_TENSILE)
+            return !strcmp(arg.function, "gemm_ex3_amax")
+                   || !strcmp(arg.function, "gemm_ex3_amax_bad_arg");
+#else
+            return false;
+#endif
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_ex3_amax_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << rocblas_datatype2string(arg.b_type) << rocblas_datatype2string(arg.c_type)
+                     << rocblas_datatype2string(arg.d_type)
+                     << rocblas_computetype2string(arg.composite_compute_type);
+
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB)
+                     << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.lda << '_' << arg.ldb << '_' << arg.beta << '_' << arg.ldc << '_'
+                     << arg.ldd;
+            }
+
+            return std::move(name);
+        }
+    };
+
+#if(BUILD_WITH_TENSILE)
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename TiA, typename TiB = TiA, typename To = TiA, typename Tc = To, typename = void>
+    struct gemm_ex3_amax_testing : rocblas_test_invalid
+    {
+    };
+
+    // The suite verifies the reduction on f32 outputs; f8/bf8/f32 inputs are
+    // the combinations the yaml drives through it
+    template <typename TiA, typename TiB, typename To, typename Tc>
+    struct gemm_ex3_amax_testing<
+        TiA,
+        TiB,
+        To,
+        Tc,
+        std::enable_if_t<(std::is_same<TiA, rocblas_f8>{} || std::is_same<TiA, rocblas_bf8>{}
+                          || std::is_same<TiA, float>{})
+                         && (std::is_same<TiB, rocblas_f8>{} || std::is_same<TiB, rocblas_bf8>{}
+                             || std::is_same<TiB, float>{})
+                         && std::is_same<To, float>{} && std::is_same<Tc, float>{}>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_ex3_amax"))
+                testing_gemm_ex3_amax<TiA, TiB, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex3_amax_bad_arg"))
+                testing_gemm_ex3_amax_bad_arg<TiA, TiB, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_ex3_amax = gemm_ex3_amax_template<gemm_ex3_amax_testing>;
+    TEST_P(gemm_ex3_amax, blas3_tensile)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<gemm_ex3_amax_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex3_amax);
+
+#endif // BUILD_WITH_TENSILE
+
+} // namespace
@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas_ex/common_gemv_ex.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // gemv_ex testing template
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct gemv_ex_template : RocBLAS_Test<gemv_ex_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_blas1_ex_dispatch<gemv_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemv_ex") || !strcmp(arg.function, "gemv_ex_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemv_ex_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << rocblas_datatype2string(arg.c_type) << '_'
+                     << rocblas_datatype2string(arg.compute_type);
+
+                name << '_' << (char)std::toupper(arg.transA);
+
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.lda << '_'
+                     << arg.incx << '_' << arg.beta << '_' << arg.incy;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename Ti, typename Tx = Ti, typename Ty = Tx, typename Tex = Ty, typename = void>
+    struct gemv_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The test applies to the uniform s/d/c/z precisions and to the
+    // fp16/bf16 input combinations with fp32 compute, with fp16/bf16 or
+    // fp32 output
+    template <typename Ti, typename Tx, typename Ty, typename Tex>
+    struct gemv_ex_testing<
+        Ti,
+        Tx,
+        Ty,
+        Tex,
+        std::enable_if_t<
+            (std::is_same_v<
+                 Ti,
+                 Tx> && std::is_same_v<Tx, Ty> && std::is_same_v<Ty, Tex> && (std::is_same_v<Ti, float> || std::is_same_v<Ti, double> || std::is_same_v<Ti, rocblas_float_complex> || std::is_same_v<Ti, rocblas_double_complex>))
+            || (std::is_same_v<
+                    Ti,
+                    Tx> && std::is_same_v<Tex, float> && (std::is_same_v<Ti, rocblas_half> || std::is_same_v<Ti, rocblas_bfloat16>)&&(std::is_same_v<Ty, Ti> || std::is_same_v<Ty, float>))>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemv_ex"))
+                testing_gemv_ex<Ti, Tx, Ty, Tex>(arg);
+            else if(!strcmp(arg.function, "gemv_ex_bad_arg"))
+                testing_gemv_ex_bad_arg<Ti, Tx, Ty, Tex>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemv_ex = gemv_ex_template<gemv_ex_testing>;
+    TEST_P(gemv_ex, blas2)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_blas1_ex_dispatch<gemv_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemv_ex);
+
+} // namespace
@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "blas_ex/common_ger_multi.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // ger_multi testing template
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct ger_multi_template : RocBLAS_Test<ger_multi_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<ger_multi_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "ger_multi")
+                   || !strcmp(arg.function, "ger_multi_bad_arg")
+                   || !strcmp(arg.function, "ger_multi_strided_batched")
+                   || !strcmp(arg.function, "ger_multi_strided_batched_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<ger_multi_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            bool is_strided = strstr(arg.function, "strided_batched") != nullptr;
+            if(is_strided)
+                name << "_strided_batched";
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.lda << '_' << arg.ldb << '_' << arg.ldc;
+                if(is_strided)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename T, typename = void>
+    struct ger_multi_testing : rocblas_test_invalid
+    {
+    };
+
+    // The fused function is implemented for float and double only
+    template <typename T>
+    struct ger_multi_testing<T,
+                             std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "ger_multi"))
+                testing_ger_multi<T>(arg);
+            else if(!strcmp(arg.function, "ger_multi_bad_arg"))
+                testing_ger_multi_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "ger_multi_strided_batched"))
+                testing_ger_multi_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "ger_multi_strided_batched_bad_arg"))
+                testing_ger_multi_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using ger_multi = ger_multi_template<ger_multi_testing>;
+    TEST_P(ger_multi, blas2)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<ger_multi_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_multi);
+
+} // namespace
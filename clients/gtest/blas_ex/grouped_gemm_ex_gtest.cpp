@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas_ex/common_grouped_gemm_ex.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // grouped_gemm_ex testing template
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct grouped_gemm_ex_template
+        : RocBLAS_Test<grouped_gemm_ex_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_gemm_dispatch<grouped_gemm_ex_template::template type_filter_functor>(
+                arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "grouped_gemm_ex")
+                   || !strcmp(arg.function, "grouped_gemm_ex_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<grouped_gemm_ex_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << rocblas_datatype2string(arg.c_type)
+                     << rocblas_datatype2string(arg.compute_type);
+
+                name << '_' << (char)std::toupper(arg.transA) << (char)std::toupper(arg.transB);
+
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.beta << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct grouped_gemm_ex_testing : rocblas_test_invalid
+    {
+    };
+
+    // The test applies to the uniform s/d/c/z precisions and to the HPA
+    // half-in half-out float-compute combination
+    template <typename Ti, typename To, typename Tc>
+    struct grouped_gemm_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<
+            (std::is_same_v<
+                 Ti,
+                 To> && std::is_same_v<To, Tc> && (std::is_same_v<Ti, float> || std::is_same_v<Ti, double> || std::is_same_v<Ti, rocblas_float_complex> || std::is_same_v<Ti, rocblas_double_complex>))
+            || (std::is_same_v<
+                    Ti,
+                    To> && std::is_same_v<Ti, rocblas_half> && std::is_same_v<Tc, float>)>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "grouped_gemm_ex"))
+                testing_grouped_gemm_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "grouped_gemm_ex_bad_arg"))
+                testing_grouped_gemm_ex_bad_arg<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using grouped_gemm_ex = grouped_gemm_ex_template<grouped_gemm_ex_testing>;
+    TEST_P(grouped_gemm_ex, blas3_tensile)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_gemm_dispatch<grouped_gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(grouped_gemm_ex);
+
+} // namespace
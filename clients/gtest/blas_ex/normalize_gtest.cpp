@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "blas_ex/common_normalize.hpp"
+#include "client_utility.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // ----------------------------------------------------------------------------
+    // normalize testing template
+    // ----------------------------------------------------------------------------
+    template <template <typename...> class FILTER>
+    struct normalize_template : RocBLAS_Test<normalize_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<normalize_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "normalize")
+                   || !strcmp(arg.function, "normalize_bad_arg")
+                   || !strcmp(arg.function, "normalize_strided_batched")
+                   || !strcmp(arg.function, "normalize_strided_batched_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<normalize_template> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type);
+
+            bool is_strided = strstr(arg.function, "strided_batched") != nullptr;
+            if(is_strided)
+                name << "_strided_batched";
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.N << '_' << arg.incx;
+                if(is_strided)
+                    name << '_' << arg.stride_x << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename T, typename = void>
+    struct normalize_testing : rocblas_test_invalid
+    {
+    };
+
+    // The fused function is implemented for float and double only
+    template <typename T>
+    struct normalize_testing<T,
+                             std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "normalize"))
+                testing_normalize<T>(arg);
+            else if(!strcmp(arg.function, "normalize_bad_arg"))
+                testing_normalize_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "normalize_strided_batched"))
+                testing_normalize_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "normalize_strided_batched_bad_arg"))
+                testing_normalize_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using normalize = normalize_template<normalize_testing>;
+    TEST_P(normalize, blas1_ex)
+    {
+        RUN_TEST_ON_THREADS_STREAMS(rocblas_simple_dispatch<normalize_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(normalize);
+
+} // namespace
@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// call metrics is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "cblas_interface.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_test.hpp"
+#include "testing_macros.hpp"
+#include "unit.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_call_metrics : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            using T = float;
+
+            rocblas_local_handle handle{arg};
+
+            rocblas_call_metrics metrics{};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_call_metrics(nullptr, 1),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_call_metrics(nullptr, &metrics),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_call_metrics(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // collection is off by default, so the snapshot reads as zeros
+            CHECK_ROCBLAS_ERROR(rocblas_get_call_metrics(handle, &metrics));
+            EXPECT_EQ(0u, metrics.workgroup_size);
+            EXPECT_EQ(0u, metrics.workgroups);
+            EXPECT_EQ(0u, metrics.bytes_estimate);
+
+            const rocblas_int M = 64, N = 64, K = 64;
+            const rocblas_int lda = M, ldb = K, ldc = M;
+
+            HOST_MEMCHECK(host_matrix<T>, hA, (M, K, lda));
+            HOST_MEMCHECK(host_matrix<T>, hB, (K, N, ldb));
+            HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+            HOST_MEMCHECK(host_matrix<T>, hC_gold, (M, N, ldc));
+
+            DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+            DEVICE_MEMCHECK(device_matrix<T>, dB, (K, N, ldb));
+            DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+
+            // small integers keep the reference comparison exact
+            for(size_t i = 0; i < size_t(lda) * K; i++)
+                hA[0][i] = T(int(i % 5) - 2);
+            for(size_t i = 0; i < size_t(ldb) * N; i++)
+                hB[0][i] = T(int(i % 3) - 1);
+
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            const T h_alpha = 1, h_beta = 0;
+
+            for(size_t i = 0; i < size_t(ldc) * N; i++)
+                hC_gold[0][i] = 0;
+            ref_gemm<T>(rocblas_operation_none,
+                        rocblas_operation_none,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA,
+                        lda,
+                        hB,
+                        ldb,
+                        h_beta,
+                        hC_gold,
+                        ldc);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_set_call_metrics(handle, 1));
+
+            CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha,
+                                              dA,
+                                              lda,
+                                              dB,
+                                              ldb,
+                                              &h_beta,
+                                              dC,
+                                              ldc));
+
+            // collection must not perturb the computation itself
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+            unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+
+            CHECK_ROCBLAS_ERROR(rocblas_get_call_metrics(handle, &metrics));
+#if BUILD_WITH_TENSILE
+            // the Tensile backend records a snapshot of the launch
+            EXPECT_GT(metrics.workgroup_size, 0u);
+            EXPECT_GT(metrics.workgroups, 0u);
+            EXPECT_GT(metrics.cu_occupancy, 0.0);
+            EXPECT_LE(metrics.cu_occupancy, 1.0);
+            // at minimum each operand is touched once for this shape
+            const uint64_t min_bytes
+                = sizeof(T) * (uint64_t(M) * K + uint64_t(K) * N + uint64_t(M) * N);
+            EXPECT_GE(metrics.bytes_estimate, min_bytes);
+#endif
+
+            // toggling collection off clears the snapshot
+            CHECK_ROCBLAS_ERROR(rocblas_set_call_metrics(handle, 0));
+            CHECK_ROCBLAS_ERROR(rocblas_get_call_metrics(handle, &metrics));
+            EXPECT_EQ(0u, metrics.workgroup_size);
+            EXPECT_EQ(0u, metrics.workgroups);
+            EXPECT_EQ(0u, metrics.bytes_estimate);
+        }
+    };
+
+    struct call_metrics : RocBLAS_Test<call_metrics, testing_call_metrics>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "call_metrics");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<call_metrics>(arg.name);
+        }
+    };
+
+    TEST_P(call_metrics, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_call_metrics<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(call_metrics)
+
+} // namespace
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// set_call_tag is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#define setenv(A, B, C) _putenv_s(A, B)
+#define unsetenv(A) _putenv_s(A, "")
+#endif
+
+namespace
+{
+    template <typename...>
+    struct testing_call_tag : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_set_call_tag(nullptr, "tag"),
+                                  rocblas_status_invalid_handle);
+
+            // the tag rides along in the bench log, appended as "#<tag>";
+            // logging is configured by environment at handle creation
+            std::string bench_path = rocblas_tempname() + "_call_tag_bench.txt";
+
+            ASSERT_EQ(0, setenv("ROCBLAS_LAYER", "2", true));
+            ASSERT_EQ(0, setenv("ROCBLAS_LOG_BENCH_PATH", bench_path.c_str(), true));
+
+            const rocblas_int N     = 16;
+            const float       alpha = 1.0f;
+
+            {
+                rocblas_handle handle;
+                CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+                DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+                DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+                // tagged call, then an untagged one after clearing the tag
+                CHECK_ROCBLAS_ERROR(rocblas_set_call_tag(handle, "phase1"));
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+                CHECK_ROCBLAS_ERROR(rocblas_set_call_tag(handle, nullptr));
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+                CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            }
+
+            ASSERT_EQ(0, setenv("ROCBLAS_LAYER", "0", true));
+
+            // the workers flush on handle destruction
+            rocblas_internal_ostream::clear_workers();
+
+            std::ifstream            bench_file(bench_path);
+            ASSERT_TRUE(bench_file.good());
+
+            std::vector<std::string> lines;
+            for(std::string line; std::getline(bench_file, line);)
+                if(line.find("axpy") != std::string::npos)
+                    lines.push_back(line);
+            bench_file.close();
+            std::remove(bench_path.c_str());
+
+            ASSERT_EQ(2u, lines.size());
+            EXPECT_NE(std::string::npos, lines[0].find("#phase1"));
+            EXPECT_EQ(std::string::npos, lines[1].find("#phase1"));
+        }
+    };
+
+    struct call_tag : RocBLAS_Test<call_tag, testing_call_tag>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "call_tag");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<call_tag>(arg.name);
+        }
+    };
+
+    TEST_P(call_tag, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_call_tag<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(call_tag)
+
+} // namespace
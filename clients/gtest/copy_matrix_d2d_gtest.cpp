@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// the device-to-device matrix copies are beta APIs; the define must precede
+// the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    // one strided-batched copy through the given layout, verified
+    // element-wise, with the destination padding checked for overwrites
+    void copy_matrix_d2d_run_case(int            device,
+                                  int64_t        rows,
+                                  int64_t        cols,
+                                  int64_t        lda,
+                                  rocblas_stride stride_a,
+                                  int64_t        ldb,
+                                  rocblas_stride stride_b,
+                                  int64_t        batch_count)
+    {
+        const float  sentinel = -9999.0f;
+        const size_t size_a   = size_t(stride_a) * batch_count;
+        const size_t size_b   = size_t(stride_b) * batch_count;
+
+        HOST_MEMCHECK(host_vector<float>, ha, (size_a, 1));
+        HOST_MEMCHECK(host_vector<float>, hb, (size_b, 1));
+        DEVICE_MEMCHECK(device_vector<float>, da, (size_a, 1));
+        DEVICE_MEMCHECK(device_vector<float>, db, (size_b, 1));
+
+        for(size_t i = 0; i < size_a; i++)
+            ha[i] = float(i % 1013);
+        for(size_t i = 0; i < size_b; i++)
+            hb[i] = sentinel;
+
+        CHECK_HIP_ERROR(da.transfer_from(ha));
+        CHECK_HIP_ERROR(db.transfer_from(hb));
+
+        CHECK_ROCBLAS_ERROR(rocblas_copy_matrix_device_to_device_strided_batched(rows,
+                                                                                 cols,
+                                                                                 sizeof(float),
+                                                                                 da,
+                                                                                 device,
+                                                                                 lda,
+                                                                                 stride_a,
+                                                                                 db,
+                                                                                 device,
+                                                                                 ldb,
+                                                                                 stride_b,
+                                                                                 batch_count,
+                                                                                 nullptr));
+        CHECK_HIP_ERROR(hipStreamSynchronize(nullptr));
+        CHECK_HIP_ERROR(hb.transfer_from(db));
+
+        for(int64_t b = 0; b < batch_count; b++)
+            for(int64_t col = 0; col < cols; col++)
+                for(int64_t i = 0; i < ldb; i++)
+                {
+                    float expected = i < rows ? ha[b * stride_a + col * lda + i] : sentinel;
+                    EXPECT_EQ(expected, hb[b * stride_b + col * ldb + i])
+                        << "batch " << b << " col " << col << " row " << i;
+                }
+    }
+
+    template <typename...>
+    struct testing_copy_matrix_d2d : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            int device = 0;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+
+            const int64_t rows = 33, cols = 17;
+
+            DEVICE_MEMCHECK(device_vector<float>, dbuf, (size_t(rows) * cols, 1));
+
+            // zero-extent copies are quick returns, even with null pointers
+            EXPECT_ROCBLAS_STATUS(rocblas_copy_matrix_device_to_device(
+                                      0, cols, sizeof(float), nullptr, device, rows, nullptr,
+                                      device, rows, nullptr),
+                                  rocblas_status_success);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_copy_matrix_device_to_device(
+                                      -1, cols, sizeof(float), dbuf, device, rows, dbuf, device,
+                                      rows, nullptr),
+                                  rocblas_status_invalid_size);
+
+            // lda and ldb must cover the rows
+            EXPECT_ROCBLAS_STATUS(rocblas_copy_matrix_device_to_device(
+                                      rows, cols, sizeof(float), dbuf, device, rows - 1, dbuf,
+                                      device, rows, nullptr),
+                                  rocblas_status_invalid_size);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_copy_matrix_device_to_device(
+                                      rows, cols, 0, dbuf, device, rows, dbuf, device, rows,
+                                      nullptr),
+                                  rocblas_status_invalid_size);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_copy_matrix_device_to_device(
+                                      rows, cols, sizeof(float), nullptr, device, rows, dbuf,
+                                      device, rows, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // each layout drives a different coalescing path:
+            // whole batch contiguous on both sides
+            copy_matrix_d2d_run_case(
+                device, rows, cols, rows, rows * cols, rows, rows * cols, 3);
+            // packed matrices at padded batch strides
+            copy_matrix_d2d_run_case(
+                device, rows, cols, rows, rows * cols + 64, rows, rows * cols + 32, 3);
+            // pitched matrices laid out back to back
+            copy_matrix_d2d_run_case(
+                device, rows, cols, rows + 7, (rows + 7) * cols, rows + 3, (rows + 3) * cols, 3);
+            // irregular strides fall back to per-matrix transfers
+            copy_matrix_d2d_run_case(device,
+                                     rows,
+                                     cols,
+                                     rows + 7,
+                                     (rows + 7) * cols + 40,
+                                     rows + 3,
+                                     (rows + 3) * cols + 8,
+                                     3);
+            // the non-batched entry point forwards with batch_count == 1
+            {
+                const int64_t lda = rows + 2;
+
+                HOST_MEMCHECK(host_vector<float>, ha, (size_t(lda) * cols, 1));
+                HOST_MEMCHECK(host_vector<float>, hb, (size_t(rows) * cols, 1));
+                DEVICE_MEMCHECK(device_vector<float>, da, (size_t(lda) * cols, 1));
+
+                for(size_t i = 0; i < size_t(lda) * cols; i++)
+                    ha[i] = float(i % 1013);
+
+                CHECK_HIP_ERROR(da.transfer_from(ha));
+                CHECK_ROCBLAS_ERROR(rocblas_copy_matrix_device_to_device(
+                    rows, cols, sizeof(float), da, device, lda, dbuf, device, rows, nullptr));
+                CHECK_HIP_ERROR(hipStreamSynchronize(nullptr));
+                CHECK_HIP_ERROR(hb.transfer_from(dbuf));
+
+                for(int64_t col = 0; col < cols; col++)
+                    for(int64_t i = 0; i < rows; i++)
+                        EXPECT_EQ(ha[col * lda + i], hb[col * rows + i]);
+            }
+        }
+    };
+
+    struct copy_matrix_d2d : RocBLAS_Test<copy_matrix_d2d, testing_copy_matrix_d2d>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "copy_matrix_d2d");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<copy_matrix_d2d>(arg.name);
+        }
+    };
+
+    TEST_P(copy_matrix_d2d, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_copy_matrix_d2d<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(copy_matrix_d2d)
+
+} // namespace
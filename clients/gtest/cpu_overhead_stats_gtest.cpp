@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// cpu overhead stats is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_cpu_overhead_stats : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            uint64_t calls    = ~uint64_t(0);
+            double   total_us = -1;
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_cpu_overhead_stats(
+                    nullptr, rocblas_cpu_overhead_blas1, &calls, &total_us),
+                rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_cpu_overhead_stats(
+                    handle, rocblas_cpu_overhead_blas1, nullptr, &total_us),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_cpu_overhead_stats(handle, rocblas_cpu_overhead_blas1, &calls, nullptr),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_cpu_overhead_stats(
+                    handle, (rocblas_cpu_overhead_family)99, &calls, &total_us),
+                rocblas_status_invalid_value);
+
+            // the counters are always on and start at zero on a fresh handle
+            for(auto family : {rocblas_cpu_overhead_blas1,
+                               rocblas_cpu_overhead_blas2,
+                               rocblas_cpu_overhead_blas3,
+                               rocblas_cpu_overhead_blas_ex})
+            {
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_get_cpu_overhead_stats(handle, family, &calls, &total_us));
+                EXPECT_EQ(0u, calls);
+                EXPECT_EQ(0.0, total_us);
+            }
+
+            const rocblas_int N     = 64;
+            const float       alpha = 2.0f;
+            const int         n_axpy = 5;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            for(rocblas_int i = 0; i < N; i++)
+                hx[i] = float(i % 5 - 2);
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hx));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            for(int iter = 0; iter < n_axpy; iter++)
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+            // every instrumented call charges its own family
+            CHECK_ROCBLAS_ERROR(
+                rocblas_get_cpu_overhead_stats(handle, rocblas_cpu_overhead_blas1, &calls, &total_us));
+            EXPECT_EQ(uint64_t(n_axpy), calls);
+            EXPECT_GT(total_us, 0.0);
+
+            // and only its own family
+            CHECK_ROCBLAS_ERROR(
+                rocblas_get_cpu_overhead_stats(handle, rocblas_cpu_overhead_blas3, &calls, &total_us));
+            EXPECT_EQ(0u, calls);
+            EXPECT_EQ(0.0, total_us);
+
+            // counters accumulate monotonically across samples
+            uint64_t calls_before = 0;
+            double   us_before    = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_get_cpu_overhead_stats(
+                handle, rocblas_cpu_overhead_blas1, &calls_before, &us_before));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_ROCBLAS_ERROR(
+                rocblas_get_cpu_overhead_stats(handle, rocblas_cpu_overhead_blas1, &calls, &total_us));
+            EXPECT_EQ(calls_before + 1, calls);
+            EXPECT_GE(total_us, us_before);
+        }
+    };
+
+    struct cpu_overhead_stats : RocBLAS_Test<cpu_overhead_stats, testing_cpu_overhead_stats>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "cpu_overhead_stats");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<cpu_overhead_stats>(arg.name);
+        }
+    };
+
+    TEST_P(cpu_overhead_stats, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_cpu_overhead_stats<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(cpu_overhead_stats)
+
+} // namespace
@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// destroy_handle_deferred is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_destroy_handle_deferred : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_destroy_handle_deferred(nullptr),
+                                  rocblas_status_invalid_handle);
+
+            // work submitted before the deferred destroy must still complete
+            // normally; only the teardown itself is moved off this thread
+            const rocblas_int N     = 4096;
+            const float       alpha = 2.0f;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy_gold, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            // small integers keep the reference comparison exact
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i]      = float(i % 5 - 2);
+                hy[i]      = float(i % 3 - 1);
+                hy_gold[i] = alpha * hx[i] + hy[i];
+            }
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+            // returns without draining the stream; the handle is dead to us
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle_deferred(handle));
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(hy_gold[i], hy[i]);
+
+            // handle churn: the reaper must keep up with a burst of
+            // short-lived handles without leaking or deadlocking
+            for(int iter = 0; iter < 16; iter++)
+            {
+                rocblas_handle h;
+                CHECK_ROCBLAS_ERROR(rocblas_create_handle(&h));
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(h, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(h, N, &alpha, dx, 1, dy, 1));
+                CHECK_ROCBLAS_ERROR(rocblas_destroy_handle_deferred(h));
+            }
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+        }
+    };
+
+    struct destroy_handle_deferred
+        : RocBLAS_Test<destroy_handle_deferred, testing_destroy_handle_deferred>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "destroy_handle_deferred");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<destroy_handle_deferred>(arg.name);
+        }
+    };
+
+    TEST_P(destroy_handle_deferred, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_destroy_handle_deferred<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(destroy_handle_deferred)
+
+} // namespace
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// set_device_memory_callbacks is a beta API; the define must precede the
+// first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    // a minimal pass-through allocator that counts its traffic
+    struct callback_counters
+    {
+        int    allocs      = 0;
+        int    frees       = 0;
+        size_t bytes_live  = 0;
+        size_t bytes_total = 0;
+    };
+
+    void* counting_alloc(size_t size, void* user_data)
+    {
+        auto* counters = static_cast<callback_counters*>(user_data);
+        void* ptr      = nullptr;
+        if((hipMalloc)(&ptr, size) != hipSuccess)
+            return nullptr;
+        counters->allocs++;
+        counters->bytes_live += size;
+        counters->bytes_total += size;
+        return ptr;
+    }
+
+    void counting_free(void* ptr, size_t size, void* user_data)
+    {
+        auto* counters = static_cast<callback_counters*>(user_data);
+        counters->frees++;
+        counters->bytes_live -= size;
+        (void)(hipFree)(ptr);
+    }
+
+    template <typename...>
+    struct testing_device_memory_callbacks : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            callback_counters counters;
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_device_memory_callbacks(
+                                      nullptr, counting_alloc, counting_free, &counters),
+                                  rocblas_status_invalid_handle);
+
+            // both callbacks must be installed together
+            {
+                rocblas_local_handle handle{arg};
+                EXPECT_ROCBLAS_STATUS(
+                    rocblas_set_device_memory_callbacks(handle, counting_alloc, nullptr, nullptr),
+                    rocblas_status_invalid_pointer);
+                EXPECT_ROCBLAS_STATUS(
+                    rocblas_set_device_memory_callbacks(handle, nullptr, counting_free, nullptr),
+                    rocblas_status_invalid_pointer);
+            }
+
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_callbacks(
+                handle, counting_alloc, counting_free, &counters));
+
+            // a device-pointer-mode dot needs a workspace for its partial
+            // sums; with callbacks installed it must come from the allocator
+            const rocblas_int N = 1 << 20;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dresult, (1, 1));
+
+            // small integers keep the reference comparison exact
+            float dot_gold = 0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i] = float(i % 5 - 2);
+                hy[i] = float(i % 3 - 1);
+                dot_gold += hx[i] * hy[i];
+            }
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, dresult));
+
+            EXPECT_GT(counters.allocs, 0);
+            EXPECT_GT(counters.bytes_total, size_t(0));
+
+            float dot_result = 0;
+            CHECK_HIP_ERROR(
+                hipMemcpy(&dot_result, dresult, sizeof(float), hipMemcpyDeviceToHost));
+            EXPECT_EQ(dot_gold, dot_result);
+
+            // restoring the default allocator returns every outstanding block
+            CHECK_ROCBLAS_ERROR(
+                rocblas_set_device_memory_callbacks(handle, nullptr, nullptr, nullptr));
+            EXPECT_EQ(counters.allocs, counters.frees);
+            EXPECT_EQ(size_t(0), counters.bytes_live);
+
+            // later calls no longer touch the removed callbacks
+            int allocs_before = counters.allocs;
+            CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, dresult));
+            EXPECT_EQ(allocs_before, counters.allocs);
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(&dot_result, dresult, sizeof(float), hipMemcpyDeviceToHost));
+            EXPECT_EQ(dot_gold, dot_result);
+        }
+    };
+
+    struct device_memory_callbacks
+        : RocBLAS_Test<device_memory_callbacks, testing_device_memory_callbacks>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "device_memory_callbacks");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<device_memory_callbacks>(arg.name);
+        }
+    };
+
+    TEST_P(device_memory_callbacks, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_device_memory_callbacks<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(device_memory_callbacks)
+
+} // namespace
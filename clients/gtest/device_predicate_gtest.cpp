@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// set_device_predicate is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_device_predicate : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            DEVICE_MEMCHECK(device_vector<rocblas_int>, dpredicate, (1, 1));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_device_predicate(nullptr, dpredicate),
+                                  rocblas_status_invalid_handle);
+
+            const rocblas_int N     = 256;
+            const float       alpha = 2.0f;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy_input, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy_gold, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            // small integers keep the reference comparison exact
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i]       = float(i % 5 - 2);
+                hy_input[i] = float(i % 3 - 1);
+                hy_gold[i]  = alpha * hx[i] + hy_input[i];
+            }
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // a false predicate turns the launched kernel into a no-op
+            rocblas_int pred = 0;
+            CHECK_HIP_ERROR(
+                hipMemcpy(dpredicate, &pred, sizeof(rocblas_int), hipMemcpyHostToDevice));
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_predicate(handle, dpredicate));
+
+            CHECK_HIP_ERROR(dy.transfer_from(hy_input));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(hy_input[i], hy[i]);
+
+            // a true predicate lets the same call execute normally
+            pred = 1;
+            CHECK_HIP_ERROR(
+                hipMemcpy(dpredicate, &pred, sizeof(rocblas_int), hipMemcpyHostToDevice));
+
+            CHECK_HIP_ERROR(dy.transfer_from(hy_input));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(hy_gold[i], hy[i]);
+
+            // a null predicate detaches it from the handle
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_predicate(handle, nullptr));
+
+            CHECK_HIP_ERROR(dy.transfer_from(hy_input));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(hy_gold[i], hy[i]);
+        }
+    };
+
+    struct device_predicate : RocBLAS_Test<device_predicate, testing_device_predicate>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "device_predicate");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<device_predicate>(arg.name);
+        }
+    };
+
+    TEST_P(device_predicate, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_device_predicate<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(device_predicate)
+
+} // namespace
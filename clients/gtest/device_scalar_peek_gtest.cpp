@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// device scalar peek is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "cblas_interface.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_test.hpp"
+#include "testing_macros.hpp"
+#include "unit.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_device_scalar_peek : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            using T = float;
+
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_device_scalar_peek_mode(nullptr, 1),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_invalidate_device_scalar_cache(nullptr),
+                                  rocblas_status_invalid_handle);
+
+            const rocblas_int M = 32, N = 32, K = 32;
+            const rocblas_int lda = M, ldb = K, ldc = M;
+
+            HOST_MEMCHECK(host_matrix<T>, hA, (M, K, lda));
+            HOST_MEMCHECK(host_matrix<T>, hB, (K, N, ldb));
+            HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+            HOST_MEMCHECK(host_matrix<T>, hC_gold, (M, N, ldc));
+
+            DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+            DEVICE_MEMCHECK(device_matrix<T>, dB, (K, N, ldb));
+            DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+            DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1, 1));
+            DEVICE_MEMCHECK(device_vector<T>, d_beta, (1, 1));
+
+            // small integers keep the reference comparison exact
+            for(size_t i = 0; i < size_t(lda) * K; i++)
+                hA[0][i] = T(int(i % 5) - 2);
+            for(size_t i = 0; i < size_t(ldb) * N; i++)
+                hB[0][i] = T(int(i % 3) - 1);
+
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            const T h_beta = 0;
+            CHECK_HIP_ERROR(
+                hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+            auto run_and_check = [&](T expected_alpha) {
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  d_alpha,
+                                                  dA,
+                                                  lda,
+                                                  dB,
+                                                  ldb,
+                                                  d_beta,
+                                                  dC,
+                                                  ldc));
+
+                for(size_t i = 0; i < size_t(ldc) * N; i++)
+                    hC_gold[0][i] = 0;
+                ref_gemm<T>(rocblas_operation_none,
+                            rocblas_operation_none,
+                            M,
+                            N,
+                            K,
+                            expected_alpha,
+                            hA,
+                            lda,
+                            hB,
+                            ldb,
+                            h_beta,
+                            hC_gold,
+                            ldc);
+
+                CHECK_HIP_ERROR(hC.transfer_from(dC));
+                unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+            };
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_scalar_peek_mode(handle, 1));
+
+            // first call reads the scalars back once and seeds the cache
+            T h_alpha = 1;
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+            run_and_check(1);
+
+            // rewriting the scalar without invalidating breaks the caller's
+            // promise, and the call must keep using the cached value — this
+            // is what proves the synchronizing readback was skipped
+            h_alpha = 2;
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+            run_and_check(1);
+
+            // invalidation discards the cache, and the next call re-reads
+            CHECK_ROCBLAS_ERROR(rocblas_invalidate_device_scalar_cache(handle));
+            run_and_check(2);
+
+            // with peeking off every call reads the live device value again
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_scalar_peek_mode(handle, 0));
+            h_alpha = 3;
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+            run_and_check(3);
+        }
+    };
+
+    struct device_scalar_peek : RocBLAS_Test<device_scalar_peek, testing_device_scalar_peek>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "device_scalar_peek");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<device_scalar_peek>(arg.name);
+        }
+    };
+
+    TEST_P(device_scalar_peek, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_device_scalar_peek<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(device_scalar_peek)
+
+} // namespace
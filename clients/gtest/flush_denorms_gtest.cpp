@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// set_flush_denorms is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    template <typename...>
+    struct testing_flush_denorms : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_flush_denorms(nullptr, 1),
+                                  rocblas_status_invalid_handle);
+
+            const rocblas_int N     = 256;
+            const float       alpha = 1.0f;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy_input, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // with the policy on, denormal inputs are flushed and the sum of
+            // two denormals is exactly zero instead of another denormal
+            const float denorm = std::numeric_limits<float>::denorm_min();
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i]       = denorm * float(i % 7 + 1);
+                hy_input[i] = denorm * float(i % 3 + 1);
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_flush_denorms(handle, 1));
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy_input));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(0.0f, hy[i]);
+
+            // normal values are unaffected by the policy, in either setting
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i]       = float(i % 5 - 2);
+                hy_input[i] = float(i % 3 - 1);
+            }
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+            for(uint32_t flush : {1u, 0u})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_flush_denorms(handle, flush));
+
+                CHECK_HIP_ERROR(dy.transfer_from(hy_input));
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+                CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+                for(rocblas_int i = 0; i < N; i++)
+                    EXPECT_EQ(alpha * hx[i] + hy_input[i], hy[i]);
+            }
+        }
+    };
+
+    struct flush_denorms : RocBLAS_Test<flush_denorms, testing_flush_denorms>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "flush_denorms");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<flush_denorms>(arg.name);
+        }
+    };
+
+    TEST_P(flush_denorms, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_flush_denorms<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(flush_denorms)
+
+} // namespace
@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// gemm auto-batch is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "cblas_interface.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_test.hpp"
+#include "testing_macros.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    template <typename...>
+    struct testing_gemm_auto_batch : rocblas_test_valid
+    {
+        static constexpr rocblas_int M = 64, N = 64, K = 64;
+
+        template <typename T>
+        static void run_gemm_ex(rocblas_handle handle,
+                                const T*       alpha,
+                                const T*       dA,
+                                const T*       dB,
+                                const T*       beta,
+                                T*             dC)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                rocblas_operation_none,
+                                                rocblas_operation_none,
+                                                M,
+                                                N,
+                                                K,
+                                                alpha,
+                                                dA,
+                                                rocblas_datatype_f32_r,
+                                                M,
+                                                dB,
+                                                rocblas_datatype_f32_r,
+                                                K,
+                                                beta,
+                                                dC,
+                                                rocblas_datatype_f32_r,
+                                                M,
+                                                dC,
+                                                rocblas_datatype_f32_r,
+                                                M,
+                                                rocblas_datatype_f32_r,
+                                                rocblas_gemm_algo_standard,
+                                                0,
+                                                rocblas_gemm_flags_none));
+        }
+
+        void operator()(const Arguments& arg)
+        {
+            using T = float;
+
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_auto_batch(nullptr, 100, 4),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_auto_batch(handle, -1, 4),
+                                  rocblas_status_invalid_value);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_auto_batch(handle, 100, 0),
+                                  rocblas_status_invalid_value);
+
+            const rocblas_int lda = M, ldb = K, ldc = M;
+
+            HOST_MEMCHECK(host_matrix<T>, hA, (M, K, lda));
+            HOST_MEMCHECK(host_matrix<T>, hB, (K, N, ldb));
+            HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+            HOST_MEMCHECK(host_matrix<T>, hC_gold, (M, N, ldc));
+
+            DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+            DEVICE_MEMCHECK(device_matrix<T>, dB, (K, N, ldb));
+            DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+
+            // small integers keep the reference comparison exact
+            for(size_t i = 0; i < size_t(lda) * K; i++)
+                hA[0][i] = T(int(i % 5) - 2);
+            for(size_t i = 0; i < size_t(ldb) * N; i++)
+                hB[0][i] = T(int(i % 3) - 1);
+
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            const T h_alpha = 1, h_beta = 0;
+
+            for(size_t i = 0; i < size_t(ldc) * N; i++)
+                hC_gold[0][i] = 0;
+            ref_gemm<T>(rocblas_operation_none,
+                        rocblas_operation_none,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA,
+                        lda,
+                        hB,
+                        ldb,
+                        h_beta,
+                        hC_gold,
+                        ldc);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // lone caller: the window expires without company and the call
+            // must fall through to a normal dispatch with exact results
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_auto_batch(handle, 100, 4));
+            run_gemm_ex<T>(handle, &h_alpha, dA, dB, &h_beta, dC);
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+            unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+
+            // concurrent same-shape callers: these are candidates for one
+            // grouped dispatch; each caller still owns its own result
+            {
+                constexpr int n_threads = 2;
+
+                DEVICE_MEMCHECK(device_matrix<T>, dC2, (M, N, ldc));
+                T* dC_all[n_threads] = {(T*)dC, (T*)dC2};
+
+                auto worker = [&](int t) {
+                    rocblas_handle h;
+                    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&h));
+                    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(h, rocblas_pointer_mode_host));
+                    CHECK_ROCBLAS_ERROR(rocblas_set_gemm_auto_batch(h, 10000, n_threads));
+                    run_gemm_ex<T>(h, &h_alpha, (const T*)dA, (const T*)dB, &h_beta, dC_all[t]);
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+                    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(h));
+                };
+
+                std::thread t1(worker, 0), t2(worker, 1);
+                t1.join();
+                t2.join();
+
+                CHECK_HIP_ERROR(hC.transfer_from(dC));
+                unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+                CHECK_HIP_ERROR(hC.transfer_from(dC2));
+                unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+            }
+
+            // window of 0 disables the feature again
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_auto_batch(handle, 0, 4));
+            run_gemm_ex<T>(handle, &h_alpha, dA, dB, &h_beta, dC);
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+            unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+        }
+    };
+
+    struct gemm_auto_batch : RocBLAS_Test<gemm_auto_batch, testing_gemm_auto_batch>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_auto_batch");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<gemm_auto_batch>(arg.name);
+        }
+    };
+
+    TEST_P(gemm_auto_batch, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_auto_batch<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_auto_batch)
+
+} // namespace
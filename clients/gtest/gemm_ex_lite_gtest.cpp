@@ -0,0 +1,276 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// gemm_ex_lite is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "cblas_interface.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_test.hpp"
+#include "testing_macros.hpp"
+#include "unit.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_gemm_ex_lite : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            using T = float;
+
+            rocblas_local_handle handle{arg};
+
+            const rocblas_int M = 64, N = 64, K = 64;
+            const rocblas_int lda = M, ldb = K, ldc = M;
+
+            rocblas_gemm_ex_lite_desc desc = nullptr;
+
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_lite_create(nullptr,
+                                                              rocblas_operation_none,
+                                                              rocblas_operation_none,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              rocblas_datatype_f32_r,
+                                                              lda,
+                                                              rocblas_datatype_f32_r,
+                                                              ldb,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              0,
+                                                              rocblas_gemm_flags_none,
+                                                              &desc),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_lite_create(handle,
+                                                              rocblas_operation_none,
+                                                              rocblas_operation_none,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              rocblas_datatype_f32_r,
+                                                              lda,
+                                                              rocblas_datatype_f32_r,
+                                                              ldb,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              0,
+                                                              rocblas_gemm_flags_none,
+                                                              nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_lite_create(handle,
+                                                              rocblas_operation_none,
+                                                              rocblas_operation_none,
+                                                              -1,
+                                                              N,
+                                                              K,
+                                                              rocblas_datatype_f32_r,
+                                                              lda,
+                                                              rocblas_datatype_f32_r,
+                                                              ldb,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              0,
+                                                              rocblas_gemm_flags_none,
+                                                              &desc),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_lite_create(handle,
+                                                              rocblas_operation_none,
+                                                              rocblas_operation_none,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              rocblas_datatype_f32_r,
+                                                              M - 1,
+                                                              rocblas_datatype_f32_r,
+                                                              ldb,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              0,
+                                                              rocblas_gemm_flags_none,
+                                                              &desc),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_lite_create(handle,
+                                                              (rocblas_operation)99,
+                                                              rocblas_operation_none,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              rocblas_datatype_f32_r,
+                                                              lda,
+                                                              rocblas_datatype_f32_r,
+                                                              ldb,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              ldc,
+                                                              rocblas_datatype_f32_r,
+                                                              0,
+                                                              rocblas_gemm_flags_none,
+                                                              &desc),
+                                  rocblas_status_invalid_value);
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_gemm_ex_lite(
+                    handle, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_lite_destroy(nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // a degenerate shape is resolved to a per-call quick return at
+            // creation, so the call never dereferences its pointers
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_lite_create(handle,
+                                                            rocblas_operation_none,
+                                                            rocblas_operation_none,
+                                                            M,
+                                                            0,
+                                                            K,
+                                                            rocblas_datatype_f32_r,
+                                                            lda,
+                                                            rocblas_datatype_f32_r,
+                                                            ldb,
+                                                            rocblas_datatype_f32_r,
+                                                            ldc,
+                                                            rocblas_datatype_f32_r,
+                                                            ldc,
+                                                            rocblas_datatype_f32_r,
+                                                            0,
+                                                            rocblas_gemm_flags_none,
+                                                            &desc));
+            const T h_alpha = 1, h_beta = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_lite(
+                handle, desc, &h_alpha, nullptr, nullptr, &h_beta, nullptr, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_lite_destroy(desc));
+
+            // one descriptor, many calls: only the data pointers change
+            HOST_MEMCHECK(host_matrix<T>, hA, (M, K, lda));
+            HOST_MEMCHECK(host_matrix<T>, hB, (K, N, ldb));
+            HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+            HOST_MEMCHECK(host_matrix<T>, hC_gold, (M, N, ldc));
+
+            DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+            DEVICE_MEMCHECK(device_matrix<T>, dB, (K, N, ldb));
+            DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_lite_create(handle,
+                                                            rocblas_operation_none,
+                                                            rocblas_operation_none,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            rocblas_datatype_f32_r,
+                                                            lda,
+                                                            rocblas_datatype_f32_r,
+                                                            ldb,
+                                                            rocblas_datatype_f32_r,
+                                                            ldc,
+                                                            rocblas_datatype_f32_r,
+                                                            ldc,
+                                                            rocblas_datatype_f32_r,
+                                                            0,
+                                                            rocblas_gemm_flags_none,
+                                                            &desc));
+
+            for(int iter = 0; iter < 2; iter++)
+            {
+                // fresh data each round proves the call binds the pointers
+                // it is given, not a snapshot from creation
+                for(size_t i = 0; i < size_t(lda) * K; i++)
+                    hA[0][i] = T(int((i + iter) % 5) - 2);
+                for(size_t i = 0; i < size_t(ldb) * N; i++)
+                    hB[0][i] = T(int((i + iter) % 3) - 1);
+
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+                for(size_t i = 0; i < size_t(ldc) * N; i++)
+                    hC_gold[0][i] = 0;
+                ref_gemm<T>(rocblas_operation_none,
+                            rocblas_operation_none,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA,
+                            lda,
+                            hB,
+                            ldb,
+                            h_beta,
+                            hC_gold,
+                            ldc);
+
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_gemm_ex_lite(handle, desc, &h_alpha, dA, dB, &h_beta, dC, dC));
+
+                CHECK_HIP_ERROR(hC.transfer_from(dC));
+                unit_check_general<T>(M, N, ldc, (T*)hC_gold, (T*)hC);
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_lite_destroy(desc));
+        }
+    };
+
+    struct gemm_ex_lite : RocBLAS_Test<gemm_ex_lite, testing_gemm_ex_lite>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_ex_lite");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<gemm_ex_lite>(arg.name);
+        }
+    };
+
+    TEST_P(gemm_ex_lite, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_ex_lite<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex_lite)
+
+} // namespace
@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+    template <typename...>
+    struct testing_get_numerics_status : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_get_numerics_status(nullptr),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_check_numerics_mode(
+                                      nullptr, rocblas_check_numerics_mode_no_check, 0),
+                                  rocblas_status_invalid_handle);
+
+            const rocblas_check_numerics_mode fail_async = rocblas_check_numerics_mode(
+                rocblas_check_numerics_mode_fail | rocblas_check_numerics_mode_async);
+
+            // the checks are compiled out under ROCBLAS_FAST_DISPATCH
+            rocblas_status status = rocblas_set_check_numerics_mode(handle, fail_async, 0);
+            if(status == rocblas_status_not_implemented)
+            {
+                GTEST_SKIP() << "numeric checking not available in this build";
+                return;
+            }
+            CHECK_ROCBLAS_ERROR(status);
+
+            // nothing accumulated before any check has run
+            CHECK_ROCBLAS_ERROR(rocblas_get_numerics_status(handle));
+
+            const rocblas_int N     = 16;
+            const float       alpha = 1.0f;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N));
+            HOST_MEMCHECK(host_vector<float>, hy, (N));
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i] = 1.0f;
+                hy[i] = 2.0f;
+            }
+
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N));
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // a clean interval polls as success
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_get_numerics_status(handle));
+
+            // a NaN input is deferred by the async mode: the call itself
+            // succeeds and the failure surfaces at the next poll
+            hx[0] = std::numeric_limits<float>::quiet_NaN();
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            EXPECT_ROCBLAS_STATUS(rocblas_get_numerics_status(handle),
+                                  rocblas_status_check_numerics_fail);
+
+            // the poll clears the accumulated flags
+            CHECK_ROCBLAS_ERROR(rocblas_get_numerics_status(handle));
+
+            // a blas1 call outside the selected scope skips the checks
+            CHECK_ROCBLAS_ERROR(rocblas_set_check_numerics_mode(
+                handle, fail_async, rocblas_check_numerics_scope_blas2));
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_get_numerics_status(handle));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_check_numerics_mode(
+                handle, rocblas_check_numerics_mode_no_check, 0));
+        }
+    };
+
+    struct get_numerics_status : RocBLAS_Test<get_numerics_status, testing_get_numerics_status>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "get_numerics_status");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<get_numerics_status>(arg.name);
+        }
+    };
+
+    TEST_P(get_numerics_status, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_get_numerics_status<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(get_numerics_status)
+
+} // namespace
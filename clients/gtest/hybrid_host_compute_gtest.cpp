@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hybrid host compute is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_hybrid_host_compute : rocblas_test_valid
+    {
+        // runs a unit-stride sdot and saxpy of size N and checks both exactly;
+        // whether the call lands on the host or the device path is decided by
+        // the threshold installed on the handle, and the answer must not differ
+        static void run_blas1_case(rocblas_handle handle, rocblas_int N)
+        {
+            const float alpha = 2.0f;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            // small integers keep both reductions exact
+            double dot_gold = 0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i] = float(i % 5 - 2);
+                hy[i] = float(i % 3 - 1);
+                dot_gold += double(hx[i]) * double(hy[i]);
+            }
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            float dot_result = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, &dot_result));
+            EXPECT_EQ(float(dot_gold), dot_result);
+
+            CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+            HOST_MEMCHECK(host_vector<float>, hy_res, (N, 1));
+            CHECK_HIP_ERROR(hy_res.transfer_from(dy));
+            for(rocblas_int i = 0; i < N; i++)
+                EXPECT_EQ(alpha * hx[i] + hy[i], hy_res[i]);
+        }
+
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_hybrid_host_compute(nullptr, 128),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_hybrid_host_compute(handle, -1),
+                                  rocblas_status_invalid_size);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // below the threshold: the call computes on the host
+            CHECK_ROCBLAS_ERROR(rocblas_set_hybrid_host_compute(handle, 128));
+            run_blas1_case(handle, 64);
+
+            // above the threshold: the call stays on the device
+            run_blas1_case(handle, 256);
+
+            // threshold of 0 disables the hybrid path entirely
+            CHECK_ROCBLAS_ERROR(rocblas_set_hybrid_host_compute(handle, 0));
+            run_blas1_case(handle, 64);
+        }
+    };
+
+    struct hybrid_host_compute : RocBLAS_Test<hybrid_host_compute, testing_hybrid_host_compute>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "hybrid_host_compute");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<hybrid_host_compute>(arg.name);
+        }
+    };
+
+    TEST_P(hybrid_host_compute, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_hybrid_host_compute<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(hybrid_host_compute)
+
+} // namespace
@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// the kernel timeline is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    template <typename...>
+    struct testing_kernel_timeline : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            const uint32_t depth = 8;
+
+            uint32_t count = 0;
+            EXPECT_ROCBLAS_STATUS(rocblas_set_kernel_timeline(nullptr, depth),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_kernel_timeline(nullptr, &count, nullptr),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_kernel_timeline(handle, nullptr, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // sampling a handle without an enabled timeline reports zero entries
+            count = 99;
+            CHECK_ROCBLAS_ERROR(rocblas_get_kernel_timeline(handle, &count, nullptr));
+            EXPECT_EQ(0u, count);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_kernel_timeline(handle, depth));
+
+            const rocblas_int N     = 4096;
+            const float       alpha = 2.0f;
+            const int         calls = 3;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            for(rocblas_int i = 0; i < N; i++)
+                hx[i] = float(i % 5 - 2);
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hx));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            for(int i = 0; i < calls; i++)
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            // a NULL buffer only reports how many entries are available
+            count = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_get_kernel_timeline(handle, &count, nullptr));
+            EXPECT_GE(count, uint32_t(calls));
+            EXPECT_LE(count, depth);
+
+            std::vector<rocblas_kernel_timeline_entry> entries(count);
+            uint32_t                                   written = count;
+            CHECK_ROCBLAS_ERROR(rocblas_get_kernel_timeline(handle, &written, entries.data()));
+            EXPECT_EQ(count, written);
+
+            for(uint32_t i = 0; i < written; i++)
+            {
+                EXPECT_NE(nullptr, entries[i].kernel_name);
+                EXPECT_LE(0.0f, entries[i].duration_ms);
+                if(i)
+                {
+                    // entries come back oldest first
+                    EXPECT_LT(entries[i - 1].serial, entries[i].serial);
+                    EXPECT_LE(entries[i - 1].start_ms, entries[i].start_ms);
+                }
+            }
+
+            // a capacity smaller than the ring truncates the sample
+            rocblas_kernel_timeline_entry one;
+            uint32_t                      limited = 1;
+            CHECK_ROCBLAS_ERROR(rocblas_get_kernel_timeline(handle, &limited, &one));
+            EXPECT_EQ(1u, limited);
+
+            // depth 0 disables instrumentation and releases the ring
+            CHECK_ROCBLAS_ERROR(rocblas_set_kernel_timeline(handle, 0));
+            count = 99;
+            CHECK_ROCBLAS_ERROR(rocblas_get_kernel_timeline(handle, &count, nullptr));
+            EXPECT_EQ(0u, count);
+        }
+    };
+
+    struct kernel_timeline : RocBLAS_Test<kernel_timeline, testing_kernel_timeline>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "kernel_timeline");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<kernel_timeline>(arg.name);
+        }
+    };
+
+    TEST_P(kernel_timeline, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_kernel_timeline<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(kernel_timeline)
+
+} // namespace
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// make_batch_pointers is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    template <typename...>
+    struct testing_make_batch_pointers : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            const rocblas_int    batch_count  = 7;
+            const rocblas_stride stride       = 129; // elements
+            const rocblas_stride stride_bytes = stride * sizeof(float);
+
+            DEVICE_MEMCHECK(device_vector<float>, dbase, (size_t(stride) * batch_count));
+            DEVICE_MEMCHECK(device_vector<float*>, dpointers, (batch_count));
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_make_batch_pointers(
+                    nullptr, dbase, stride_bytes, batch_count, (void**)(float**)dpointers),
+                rocblas_status_invalid_handle);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_make_batch_pointers(
+                                      handle, dbase, stride_bytes, -1, (void**)(float**)dpointers),
+                                  rocblas_status_invalid_size);
+
+            // batch_count == 0 is a quick return, even with null pointers
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_make_batch_pointers(handle, nullptr, stride_bytes, 0, nullptr),
+                rocblas_status_success);
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_make_batch_pointers(
+                    handle, nullptr, stride_bytes, batch_count, (void**)(float**)dpointers),
+                rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_make_batch_pointers(handle, dbase, stride_bytes, batch_count, nullptr),
+                rocblas_status_invalid_pointer);
+
+            // pointers[i] = base + i * stride_bytes, written on the stream
+            CHECK_ROCBLAS_ERROR(rocblas_make_batch_pointers(
+                handle, dbase, stride_bytes, batch_count, (void**)(float**)dpointers));
+
+            std::vector<float*> hpointers(batch_count);
+            CHECK_HIP_ERROR(hipMemcpy(hpointers.data(),
+                                      dpointers,
+                                      sizeof(float*) * batch_count,
+                                      hipMemcpyDeviceToHost));
+
+            for(rocblas_int i = 0; i < batch_count; i++)
+                EXPECT_EQ((float*)dbase + i * stride, hpointers[i]);
+
+            // a zero stride aliases every batch instance onto base
+            CHECK_ROCBLAS_ERROR(
+                rocblas_make_batch_pointers(handle, dbase, 0, batch_count, (void**)(float**)dpointers));
+            CHECK_HIP_ERROR(hipMemcpy(hpointers.data(),
+                                      dpointers,
+                                      sizeof(float*) * batch_count,
+                                      hipMemcpyDeviceToHost));
+
+            for(rocblas_int i = 0; i < batch_count; i++)
+                EXPECT_EQ((float*)dbase, hpointers[i]);
+        }
+    };
+
+    struct make_batch_pointers
+        : RocBLAS_Test<make_batch_pointers, testing_make_batch_pointers>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "make_batch_pointers");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<make_batch_pointers>(arg.name);
+        }
+    };
+
+    TEST_P(make_batch_pointers, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_make_batch_pointers<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(make_batch_pointers)
+
+} // namespace
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// mapped host results is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_mapped_host_results : rocblas_test_valid
+    {
+        // runs the host-pointer-mode reduction family once and checks every
+        // result exactly; the zero-copy path and the staged path must agree
+        static void run_reductions(rocblas_handle handle, rocblas_int N)
+        {
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+            // small integers keep the host references exact
+            double      dot_gold  = 0;
+            double      asum_gold = 0;
+            rocblas_int amax_gold = 0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i] = float(i % 5 - 2);
+                hy[i] = float(i % 3 - 1);
+                dot_gold += double(hx[i]) * double(hy[i]);
+                asum_gold += std::abs(double(hx[i]));
+                if(std::abs(hx[i]) > std::abs(hx[amax_gold]))
+                    amax_gold = i;
+            }
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            float dot_result = -1;
+            CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, &dot_result));
+            EXPECT_EQ(float(dot_gold), dot_result);
+
+            float asum_result = -1;
+            CHECK_ROCBLAS_ERROR(rocblas_sasum(handle, N, dx, 1, &asum_result));
+            EXPECT_EQ(float(asum_gold), asum_result);
+
+            rocblas_int amax_result = -1;
+            CHECK_ROCBLAS_ERROR(rocblas_isamax(handle, N, dx, 1, &amax_result));
+            // BLAS amax is 1-based
+            EXPECT_EQ(amax_gold + 1, amax_result);
+        }
+
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_mapped_host_results(nullptr, 1),
+                                  rocblas_status_invalid_handle);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // zero-copy mode on; growing N forces the mapped buffer to be
+            // allocated and the finishing kernels to write through it
+            CHECK_ROCBLAS_ERROR(rocblas_set_mapped_host_results(handle, 1));
+            run_reductions(handle, 64);
+            run_reductions(handle, 1 << 16);
+
+            // back to the staged device-memory path
+            CHECK_ROCBLAS_ERROR(rocblas_set_mapped_host_results(handle, 0));
+            run_reductions(handle, 64);
+
+            // device pointer mode is unaffected by the opt-in
+            CHECK_ROCBLAS_ERROR(rocblas_set_mapped_host_results(handle, 1));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            const rocblas_int N = 64;
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dresult, (1, 1));
+
+            double asum_gold = 0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i] = float(i % 5 - 2);
+                asum_gold += std::abs(double(hx[i]));
+            }
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+            CHECK_ROCBLAS_ERROR(rocblas_sasum(handle, N, dx, 1, dresult));
+            float asum_result = -1;
+            CHECK_HIP_ERROR(hipMemcpy(&asum_result, dresult, sizeof(float), hipMemcpyDeviceToHost));
+            EXPECT_EQ(float(asum_gold), asum_result);
+        }
+    };
+
+    struct mapped_host_results : RocBLAS_Test<mapped_host_results, testing_mapped_host_results>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "mapped_host_results");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<mapped_host_results>(arg.name);
+        }
+    };
+
+    TEST_P(mapped_host_results, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_mapped_host_results<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(mapped_host_results)
+
+} // namespace
@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// reduction_signal/reduction_poll are beta APIs; the define must precede
+// the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_reduction_signal : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            // the flag must live in pinned, device-mapped host memory
+            rocblas_int* host_flag = nullptr;
+            CHECK_HIP_ERROR(
+                hipHostMalloc((void**)&host_flag, sizeof(rocblas_int), hipHostMallocMapped));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_reduction_signal(nullptr, host_flag),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_reduction_signal(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // pageable host memory has no device mapping and must be rejected
+            rocblas_int pageable_flag = 0;
+            EXPECT_ROCBLAS_STATUS(rocblas_reduction_signal(handle, &pageable_flag),
+                                  rocblas_status_invalid_pointer);
+
+            bool complete = false;
+            EXPECT_ROCBLAS_STATUS(rocblas_reduction_poll(nullptr, &complete),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_reduction_poll(host_flag, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // enqueue a device-pointer-mode dot followed by the signal, then
+            // poll until the flag flips; the result must be ready by then
+            const rocblas_int N = 1024;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+            HOST_MEMCHECK(host_vector<float>, hy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dresult, (1, 1));
+
+            // small integers keep the reference comparison exact
+            float dot_gold = 0;
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                hx[i] = float(i % 5 - 2);
+                hy[i] = float(i % 3 - 1);
+                dot_gold += hx[i] * hy[i];
+            }
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, dresult));
+            CHECK_ROCBLAS_ERROR(rocblas_reduction_signal(handle, host_flag));
+
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+            // the flag flips in stream order, so it is guaranteed set once
+            // the stream has drained; poll first to exercise the fast path
+            complete = false;
+            while(!complete)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_reduction_poll(host_flag, &complete));
+                if(!complete)
+                    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            }
+
+            float dot_result = 0;
+            CHECK_HIP_ERROR(
+                hipMemcpy(&dot_result, dresult, sizeof(float), hipMemcpyDeviceToHost));
+            EXPECT_EQ(dot_gold, dot_result);
+
+            CHECK_HIP_ERROR(hipHostFree(host_flag));
+        }
+    };
+
+    struct reduction_signal : RocBLAS_Test<reduction_signal, testing_reduction_signal>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "reduction_signal");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<reduction_signal>(arg.name);
+        }
+    };
+
+    TEST_P(reduction_signal, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_reduction_signal<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(reduction_signal)
+
+} // namespace
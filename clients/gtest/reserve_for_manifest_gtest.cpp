@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// reserve_for_manifest is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    template <typename...>
+    struct testing_reserve_for_manifest : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_reserve_for_manifest(nullptr, "manifest.txt"),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_reserve_for_manifest(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_reserve_for_manifest(handle, "/nonexistent/rocblas_manifest.txt"),
+                rocblas_status_invalid_value);
+
+            const rocblas_int N = 1 << 20;
+
+            // the contract is parity with the live size-query mechanism:
+            // measure the dot workspace the way the library itself would
+            size_t dot_size = 0;
+            {
+                DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+                DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+                DEVICE_MEMCHECK(device_vector<float>, dresult, (1, 1));
+
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+                CHECK_ALLOC_QUERY(rocblas_sdot(handle, N, dx, 1, dy, 1, dresult));
+                CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &dot_size));
+            }
+
+            std::string manifest_path = rocblas_tempname() + "_manifest.txt";
+            {
+                std::ofstream manifest(manifest_path);
+                manifest << "# serve-time manifest, tags ride along as comments\n";
+                manifest << "\n";
+                manifest << "./rocblas-bench -f dot -r f32_r -n " << N << " # phase1\n";
+                manifest << "./rocblas-bench -f dot -r f32_r -n 64\n";
+            }
+
+            // the reservation is the high-water mark over all records
+            CHECK_ROCBLAS_ERROR(rocblas_reserve_for_manifest(handle, manifest_path.c_str()));
+
+            size_t reserved = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &reserved));
+            EXPECT_EQ(dot_size, reserved);
+
+            // the reserved workspace serves the manifest's calls correctly
+            {
+                HOST_MEMCHECK(host_vector<float>, hx, (N, 1));
+                DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+                DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+
+                // small integers keep the reduction exact
+                double dot_gold = 0;
+                for(rocblas_int i = 0; i < N; i++)
+                {
+                    hx[i] = float(i % 3 - 1);
+                    dot_gold += double(hx[i]) * double(hx[i]);
+                }
+                CHECK_HIP_ERROR(dx.transfer_from(hx));
+                CHECK_HIP_ERROR(dy.transfer_from(hx));
+
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                float dot_result = -1;
+                CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, &dot_result));
+                EXPECT_EQ(float(dot_gold), dot_result);
+            }
+
+            // a manifest of workspace-free records leaves the size untouched
+            {
+                std::ofstream manifest(manifest_path);
+                manifest << "# nothing but comments and blanks\n\n";
+            }
+            CHECK_ROCBLAS_ERROR(rocblas_reserve_for_manifest(handle, manifest_path.c_str()));
+            size_t after = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &after));
+            EXPECT_EQ(reserved, after);
+
+            std::remove(manifest_path.c_str());
+        }
+    };
+
+    struct reserve_for_manifest
+        : RocBLAS_Test<reserve_for_manifest, testing_reserve_for_manifest>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "reserve_for_manifest");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<reserve_for_manifest>(arg.name);
+        }
+    };
+
+    TEST_P(reserve_for_manifest, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_reserve_for_manifest<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(reserve_for_manifest)
+
+} // namespace
@@ -22,6 +22,7 @@
 
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
+#include "testing_get_matrix_async_chunked.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
 #include "type_dispatch.hpp"
@@ -34,6 +35,7 @@ namespace
     {
         SET_GET_MATRIX,
         SET_GET_MATRIX_ASYNC,
+        GET_MATRIX_ASYNC_CHUNKED,
     };
 
     template <template <typename...> class FILTER, sync_type TRANSFER_TYPE>
@@ -56,6 +58,8 @@ namespace
                 return !strcmp(arg.function, "set_get_matrix");
             case SET_GET_MATRIX_ASYNC:
                 return !strcmp(arg.function, "set_get_matrix_async");
+            case GET_MATRIX_ASYNC_CHUNKED:
+                return !strcmp(arg.function, "get_matrix_async_chunked");
             }
             return false;
         }
@@ -74,6 +78,10 @@ namespace
             else
             {
                 name << arg.M << '_' << arg.N << '_' << arg.lda << '_' << arg.ldb << '_' << arg.ldd;
+
+                // the chunked variant scans over the chunk width as well
+                if(TRANSFER_TYPE == GET_MATRIX_ASYNC_CHUNKED)
+                    name << '_' << arg.K;
             }
 
             if(arg.api & c_API_64)
@@ -108,6 +116,8 @@ namespace
                 testing_set_get_matrix<T>(arg);
             else if(!strcmp(arg.function, "set_get_matrix_async"))
                 testing_set_get_matrix_async<T>(arg);
+            else if(!strcmp(arg.function, "get_matrix_async_chunked"))
+                testing_get_matrix_async_chunked<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -130,4 +140,13 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_matrix_async);
 
+    using get_matrix_async_chunked
+        = matrix_set_get_template<set_get_matrix_testing, GET_MATRIX_ASYNC_CHUNKED>;
+    TEST_P(get_matrix_async_chunked, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<set_get_matrix_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(get_matrix_async_chunked);
+
 } // namespace
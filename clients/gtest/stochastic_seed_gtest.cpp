@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// set_stochastic_seed is a beta API; the define must precede the first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_stochastic_seed : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_local_handle handle{arg};
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_stochastic_seed(nullptr, 42),
+                                  rocblas_status_invalid_handle);
+
+            // the SR_SEED_A/B/C/D environment variables pin the conversion
+            // streams and would defeat the reseeding check below
+            if(std::getenv("SR_SEED_A") || std::getenv("SR_SEED_B") || std::getenv("SR_SEED_C")
+               || std::getenv("SR_SEED_D"))
+            {
+                GTEST_SKIP() << "SR_SEED environment overrides are set";
+            }
+
+            // stochastically round a batch of values that sit between f8 grid
+            // points: re-seeding with the same value must reproduce the exact
+            // output sequence, because the per-call counter is reset too
+            const int64_t     N           = 4096;
+            const rocblas_int batch_count = 2;
+            const float       scale       = 1.0f;
+            const uint32_t    sr_flag     = rocblas_gemm_flags_stochastic_rounding;
+
+            HOST_MEMCHECK(host_vector<float>, hx, (N * batch_count, 1));
+            HOST_MEMCHECK(host_vector<rocblas_f8>, hy_1, (N * batch_count, 1));
+            HOST_MEMCHECK(host_vector<rocblas_f8>, hy_2, (N * batch_count, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N * batch_count, 1));
+            DEVICE_MEMCHECK(device_vector<rocblas_f8>, dy, (N * batch_count, 1));
+
+            for(int64_t i = 0; i < N * batch_count; i++)
+                hx[i] = 1.0f + 0.001f * float(i % 997);
+
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            auto convert = [&] {
+                // two calls so the per-call counter advances within a sequence
+                for(rocblas_int b = 0; b < batch_count; b++)
+                    CHECK_ROCBLAS_ERROR(rocblas_f8_convert(handle,
+                                                           N,
+                                                           &scale,
+                                                           (const float*)dx + b * N,
+                                                           rocblas_datatype_f32_r,
+                                                           N,
+                                                           (rocblas_f8*)dy + b * N,
+                                                           rocblas_datatype_f8_r,
+                                                           N,
+                                                           1,
+                                                           sr_flag));
+            };
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_seed(handle, 42));
+            convert();
+            CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_seed(handle, 42));
+            convert();
+            CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+
+            EXPECT_EQ(0,
+                      memcmp(hy_1.data(), hy_2.data(), sizeof(rocblas_f8) * N * batch_count));
+        }
+    };
+
+    struct stochastic_seed : RocBLAS_Test<stochastic_seed, testing_stochastic_seed>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "stochastic_seed");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<stochastic_seed>(arg.name);
+        }
+    };
+
+    TEST_P(stochastic_seed, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_stochastic_seed<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(stochastic_seed)
+
+} // namespace
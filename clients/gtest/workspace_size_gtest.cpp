@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// the workspace-size queries are beta APIs; the define must precede the
+// first rocblas.h
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "testing_macros.hpp"
+#include <cstring>
+
+namespace
+{
+    template <typename...>
+    struct testing_workspace_size : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const rocblas_int N           = 1 << 20;
+            const rocblas_int batch_count = 3;
+            size_t            size        = ~size_t(0);
+
+            // argument checking is shared across the query family
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_dot_workspace_size(N, 1, rocblas_datatype_f32_r, nullptr),
+                rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_dot_workspace_size(-1, 1, rocblas_datatype_f32_r, &size),
+                rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_dot_workspace_size(N, -1, rocblas_datatype_f32_r, &size),
+                rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_dot_workspace_size(N, 1, rocblas_datatype_f8_r, &size),
+                                  rocblas_status_not_implemented);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_asum_workspace_size(N, 1, rocblas_datatype_f16_r, &size),
+                rocblas_status_not_implemented);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_nrm2_workspace_size(N, 1, rocblas_datatype_f16_r, &size),
+                rocblas_status_not_implemented);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_iamax_workspace_size(N, 1, rocblas_datatype_f16_r, &size),
+                rocblas_status_not_implemented);
+            EXPECT_ROCBLAS_STATUS(rocblas_trsv_workspace_size(-1, 1, &size),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_trsm_workspace_size(rocblas_side_left,
+                                                              rocblas_operation_none,
+                                                              128,
+                                                              128,
+                                                              1,
+                                                              rocblas_datatype_f16_r,
+                                                              &size),
+                                  rocblas_status_not_implemented);
+
+            // every query must report exactly what the live call requests
+            // through the device memory size query mechanism
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            DEVICE_MEMCHECK(device_vector<float>, dx, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dy, (N, 1));
+            DEVICE_MEMCHECK(device_vector<float>, dresult, (1, 1));
+            DEVICE_MEMCHECK(device_vector<rocblas_int>, dindex, (1, 1));
+
+            size_t queried = 0;
+
+            CHECK_ROCBLAS_ERROR(rocblas_dot_workspace_size(N, 1, rocblas_datatype_f32_r, &size));
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(rocblas_sdot(handle, N, dx, 1, dy, 1, dresult));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &queried));
+            EXPECT_EQ(queried, size);
+
+            CHECK_ROCBLAS_ERROR(rocblas_asum_workspace_size(N, 1, rocblas_datatype_f32_r, &size));
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(rocblas_sasum(handle, N, dx, 1, dresult));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &queried));
+            EXPECT_EQ(queried, size);
+
+            CHECK_ROCBLAS_ERROR(rocblas_nrm2_workspace_size(N, 1, rocblas_datatype_f32_r, &size));
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(rocblas_snrm2(handle, N, dx, 1, dresult));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &queried));
+            EXPECT_EQ(queried, size);
+
+            CHECK_ROCBLAS_ERROR(
+                rocblas_iamax_workspace_size(N, 1, rocblas_datatype_f32_r, &size));
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(rocblas_isamax(handle, N, dx, 1, dindex));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &queried));
+            EXPECT_EQ(queried, size);
+
+            // trsv and trsm request their workspaces for a real solve
+            const rocblas_int M   = 272;
+            const rocblas_int K   = 63;
+            const rocblas_int lda = M, ldb = M;
+
+            DEVICE_MEMCHECK(device_matrix<float>, dA, (M, M, lda));
+            DEVICE_MEMCHECK(device_matrix<float>, dB, (M, K, ldb));
+
+            CHECK_ROCBLAS_ERROR(rocblas_trsv_workspace_size(M, 1, &size));
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(rocblas_strsv(handle,
+                                            rocblas_fill_lower,
+                                            rocblas_operation_none,
+                                            rocblas_diagonal_non_unit,
+                                            M,
+                                            dA,
+                                            lda,
+                                            dB,
+                                            1));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &queried));
+            EXPECT_EQ(queried, size);
+
+            const float alpha = 1.0f;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_workspace_size(
+                rocblas_side_left, rocblas_operation_none, M, K, 1, rocblas_datatype_f32_r, &size));
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(rocblas_strsm(handle,
+                                            rocblas_side_left,
+                                            rocblas_fill_lower,
+                                            rocblas_operation_none,
+                                            rocblas_diagonal_non_unit,
+                                            M,
+                                            K,
+                                            &alpha,
+                                            dA,
+                                            lda,
+                                            dB,
+                                            ldb));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &queried));
+            EXPECT_EQ(queried, size);
+
+            // batch_count scales the per-instance chunks
+            size_t size_batched = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_trsv_workspace_size(M, batch_count, &size_batched));
+            EXPECT_GE(size_batched, size_t(batch_count) * sizeof(rocblas_int));
+        }
+    };
+
+    struct workspace_size : RocBLAS_Test<workspace_size, testing_workspace_size>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "workspace_size");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<workspace_size>(arg.name);
+        }
+    };
+
+    TEST_P(workspace_size, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_workspace_size<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(workspace_size)
+
+} // namespace
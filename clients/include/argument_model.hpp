@@ -38,6 +38,43 @@ bool ArgumentModel_get_log_datatype();
 void ArgumentModel_log_frequencies(rocblas_internal_ostream& name_line,
                                    rocblas_internal_ostream& val_line);
 
+void ArgumentModel_log_energy(rocblas_internal_ostream& name_line,
+                              rocblas_internal_ostream& val_line,
+                              double                    gflops);
+
+void ArgumentModel_log_latencies(rocblas_internal_ostream& name_line,
+                                 rocblas_internal_ostream& val_line);
+
+// Structured results writer (--yaml_out): each result is appended to the file
+// as one YAML list item holding the non-default Arguments fields and the
+// measured performance, so sweeps can be parsed without scraping stdout
+void ArgumentModel_set_yaml_out(const std::string& path);
+
+void ArgumentModel_log_yaml_out(const Arguments& arg,
+                                rocblas_int      batch_count,
+                                double           gpu_us,
+                                double           gflops,
+                                double           gbytes,
+                                double           cpu_us,
+                                double           norm1,
+                                double           norm2,
+                                double           norm3,
+                                double           norm4);
+
+// Roofline audit writer (--roofline_out): combines each timed result's
+// analytic flop/byte model with the measured time into a roofline position
+// per shape — arithmetic intensity, achieved rates, and the fraction of the
+// binding ceiling — classifying bandwidth- vs compute-bound against the
+// device's theoretical memory bandwidth and an optional compute ceiling
+// supplied with --roofline_peak_gflops
+void ArgumentModel_set_roofline_out(const std::string& path, double peak_gflops);
+
+void ArgumentModel_log_roofline(const Arguments& arg,
+                                rocblas_int      batch_count,
+                                double           gpu_us,
+                                double           gflops,
+                                double           gbytes);
+
 // ArgumentModel template has a variadic list of argument enums
 template <rocblas_argument... Args>
 class ArgumentModel
@@ -87,6 +124,9 @@ public:
 
             name_line << ",rocblas-Gflops";
             val_line << ", " << rocblas_gflops;
+
+            // requires enablement for power and clock-normalized statistics
+            ArgumentModel_log_energy(name_line, val_line, rocblas_gflops);
         }
 
         if(gbytes != ArgumentLogging::NA_value)
@@ -101,6 +141,9 @@ public:
         name_line << ",us";
         val_line << ", " << gpu_us;
 
+        // requires enablement for per-iteration latency statistics
+        ArgumentModel_log_latencies(name_line, val_line);
+
         if(arg.unit_check || arg.norm_check)
         {
             if(cpu_us != ArgumentLogging::NA_value)
@@ -223,6 +266,7 @@ public:
 #endif
 
         if(arg.timing)
+        {
             log_perf(name_list,
                      value_list,
                      arg,
@@ -235,6 +279,21 @@ public:
                      norm3,
                      norm4);
 
+            ArgumentModel_log_yaml_out(arg,
+                                       has(e_batch_count) ? arg.batch_count : 1,
+                                       gpu_us,
+                                       gflops,
+                                       gpu_bytes,
+                                       cpu_us,
+                                       norm1,
+                                       norm2,
+                                       norm3,
+                                       norm4);
+
+            ArgumentModel_log_roofline(
+                arg, has(e_batch_count) ? arg.batch_count : 1, gpu_us, gflops, gpu_bytes);
+        }
+
         str << name_list << "\n" << value_list << std::endl;
     }
 };
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "device_timer.hpp"
+
 //!
 //! @brief Implementation of a common benchmark code
 //!
@@ -60,18 +62,28 @@ private:
 template <typename LAMBDA>
 double Benchmark<LAMBDA>::timer()
 {
+    DeviceTimer& device_timer = getDeviceTimer();
+
     double time_used;
     for(int iter = 0; iter < m_arg.iters + m_arg.cold_iters; iter++)
     {
         if(iter == m_arg.cold_iters)
+        {
             time_used = get_time_us_sync(m_stream);
+            device_timer.mark_start(m_stream);
+        }
 
         int flush_index = (iter + 1) % m_flush_batch_count;
 
         m_lambda_to_benchmark(flush_index);
     }
 
+    device_timer.mark_stop(m_stream);
     time_used = get_time_us_sync(m_stream) - time_used;
 
+    // device-timestamp bracketing replaces the host wall time when enabled
+    if(device_timer.enabled())
+        time_used = device_timer.time_us(m_stream);
+
     return time_used;
 }
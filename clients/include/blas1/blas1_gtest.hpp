@@ -44,6 +44,11 @@ enum class blas1
     axpy,
     axpy_batched,
     axpy_strided_batched,
+    axpby,
+    axpby_batched,
+    axpby_strided_batched,
+    axpy_dot,
+    axpy_dot_strided_batched,
     copy,
     copy_batched,
     copy_strided_batched,
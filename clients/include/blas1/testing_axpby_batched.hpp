@@ -0,0 +1,314 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// axpby_batched is a beta API without Fortran or ILP64 bindings; map the C
+// entry points directly
+template <typename T>
+static auto rocblas_axpby_batched_fn = nullptr;
+template <>
+static auto rocblas_axpby_batched_fn<float> = rocblas_saxpby_batched;
+template <>
+static auto rocblas_axpby_batched_fn<double> = rocblas_daxpby_batched;
+template <>
+static auto rocblas_axpby_batched_fn<rocblas_float_complex> = rocblas_caxpby_batched;
+template <>
+static auto rocblas_axpby_batched_fn<rocblas_double_complex> = rocblas_zaxpby_batched;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpby_batched_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N           = 100;
+        rocblas_int incx        = 1;
+        rocblas_int incy        = 1;
+        rocblas_int batch_count = 2;
+
+        DEVICE_MEMCHECK(device_vector<T>, alpha_d, (1));
+        DEVICE_MEMCHECK(device_vector<T>, zero_d, (1));
+        DEVICE_MEMCHECK(device_vector<T>, one_d, (1));
+
+        const T alpha_h(1), zero_h(0), one_h(1);
+
+        const T* alpha = &alpha_h;
+        const T* zero  = &zero_h;
+        const T* one   = &one_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+        }
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_batch_vector<T>, dx, (N, incx, batch_count));
+        DEVICE_MEMCHECK(device_batch_vector<T>, dy, (N, incy, batch_count));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_batched_fn<T>(nullptr,
+                                                          N,
+                                                          alpha,
+                                                          one,
+                                                          dx.ptr_on_device(),
+                                                          incx,
+                                                          dy.ptr_on_device(),
+                                                          incy,
+                                                          batch_count),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_batched_fn<T>(handle,
+                                                          N,
+                                                          nullptr,
+                                                          one,
+                                                          dx.ptr_on_device(),
+                                                          incx,
+                                                          dy.ptr_on_device(),
+                                                          incy,
+                                                          batch_count),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_batched_fn<T>(handle,
+                                                          N,
+                                                          alpha,
+                                                          nullptr,
+                                                          dx.ptr_on_device(),
+                                                          incx,
+                                                          dy.ptr_on_device(),
+                                                          incy,
+                                                          batch_count),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_axpby_batched_fn<T>(
+                    handle, N, alpha, one, nullptr, incx, dy.ptr_on_device(), incy, batch_count),
+                rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_axpby_batched_fn<T>(
+                    handle, N, alpha, one, dx.ptr_on_device(), incx, nullptr, incy, batch_count),
+                rocblas_status_invalid_pointer);
+        }
+
+        // If N == 0, then alpha, beta, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_batched_fn<T>(
+                handle, 0, nullptr, nullptr, nullptr, incx, nullptr, incy, batch_count),
+            rocblas_status_success);
+
+        // If batch_count == 0, then alpha, beta, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_batched_fn<T>(
+                                  handle, N, nullptr, nullptr, nullptr, incx, nullptr, incy, 0),
+                              rocblas_status_success);
+
+        // If alpha == 0 && beta == 1, then X and Y can be nullptr without error
+        if(pointer_mode == rocblas_pointer_mode_host)
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_axpby_batched_fn<T>(
+                    handle, N, zero, one, nullptr, incx, nullptr, incy, batch_count),
+                rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_axpby_batched(const Arguments& arg)
+{
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+    T           h_alpha     = arg.get_alpha<T>();
+    T           h_beta      = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_batched_fn<T>(
+                handle, N, nullptr, nullptr, nullptr, incx, nullptr, incy, batch_count),
+            rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_batch_vector<T>, hx, (N, incx, batch_count));
+    HOST_MEMCHECK(host_batch_vector<T>, hy, (N, incy, batch_count));
+    HOST_MEMCHECK(host_batch_vector<T>, hy_gold, (N, incy, batch_count));
+    HOST_MEMCHECK(host_vector<T>, halpha, (1));
+    HOST_MEMCHECK(host_vector<T>, hbeta, (1));
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_batch_vector<T>, dx, (N, incx, batch_count));
+    DEVICE_MEMCHECK(device_batch_vector<T>, dy, (N, incy, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<T>, d_beta, (1));
+
+    // Initialize data on host memory. The fused kernel always reads both x
+    // and y, so neither may be seeded with NaN.
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false, true);
+
+    hy_gold.copy_from(hy);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    double cpu_time_used;
+    double rocblas_error_host   = 0.0;
+    double rocblas_error_device = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_batched_fn<T>(handle,
+                                                            N,
+                                                            &h_alpha,
+                                                            &h_beta,
+                                                            dx.ptr_on_device(),
+                                                            incx,
+                                                            dy.ptr_on_device(),
+                                                            incy,
+                                                            batch_count));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy_gold));
+            CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+            CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_batched_fn<T>(handle,
+                                                            N,
+                                                            d_alpha,
+                                                            d_beta,
+                                                            dx.ptr_on_device(),
+                                                            incx,
+                                                            dy.ptr_on_device(),
+                                                            incy,
+                                                            batch_count));
+            handle.post_test(arg);
+        }
+
+        // CPU BLAS: y_i := beta * y_i then y_i += alpha * x_i
+        cpu_time_used = get_time_us_no_sync();
+
+        for(size_t b = 0; b < batch_count; b++)
+        {
+            ref_scal<T>(N, h_beta, (T*)hy_gold[b], incy < 0 ? -incy : incy);
+            ref_axpy<T>(N, h_alpha, (T*)hx[b], incx, (T*)hy_gold[b], incy);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+                unit_check_general<T>(1, N, incy, hy_gold, hy, batch_count);
+
+            if(arg.norm_check)
+                rocblas_error_host
+                    = norm_check_general<T>('F', 1, N, incy, hy_gold, hy, batch_count);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            if(arg.unit_check)
+                unit_check_general<T>(1, N, incy, hy_gold, hy, batch_count);
+
+            if(arg.norm_check)
+                rocblas_error_device
+                    = norm_check_general<T>('F', 1, N, incy, hy_gold, hy, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_batched_fn<T>(handle,
+                                                            N,
+                                                            &h_alpha,
+                                                            &h_beta,
+                                                            dx.ptr_on_device(),
+                                                            incx,
+                                                            dy.ptr_on_device(),
+                                                            incy,
+                                                            batch_count));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // axpby performs one extra multiply per element over axpy
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            1.5 * axpy_gflop_count<T>(N),
+            axpy_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_host,
+            rocblas_error_device);
+    }
+}
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "device_timer.hpp"
 #include "testing_common.hpp"
 
 #include "blas1/rocblas_axpy.hpp"
@@ -329,10 +330,15 @@ void testing_axpy(const Arguments& arg)
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
 
+        DeviceTimer& device_timer = getDeviceTimer();
+
         for(int iter = 0; iter < total_calls; iter++)
         {
             if(iter == number_cold_calls)
+            {
                 gpu_time_used = get_time_us_sync(stream);
+                device_timer.mark_start(stream);
+            }
 
             int flush_index = (iter + 1) % flush_batch_count;
             DAPI_DISPATCH(rocblas_axpy_fn,
@@ -345,8 +351,13 @@ void testing_axpy(const Arguments& arg)
                            incy));
         }
 
+        device_timer.mark_stop(stream);
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
+        // device-timestamp bracketing replaces the host wall time when enabled
+        if(device_timer.enabled())
+            gpu_time_used = device_timer.time_us(stream);
+
         ArgumentModel<e_N, e_alpha, e_incx, e_incy>{}.log_args<T>(rocblas_cout,
                                                                   arg,
                                                                   gpu_time_used,
@@ -0,0 +1,260 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// axpy_dot is a beta API without Fortran or ILP64 bindings; map the C entry
+// points directly
+template <typename T>
+static auto rocblas_axpy_dot_fn = nullptr;
+template <>
+static auto rocblas_axpy_dot_fn<float> = rocblas_saxpy_dot;
+template <>
+static auto rocblas_axpy_dot_fn<double> = rocblas_daxpy_dot;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_dot_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+
+        DEVICE_MEMCHECK(device_vector<T>, alpha_d, (1));
+
+        const T alpha_h(1);
+
+        const T* alpha = &alpha_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+        DEVICE_MEMCHECK(device_vector<T>, dy, (N, incy));
+        DEVICE_MEMCHECK(device_vector<T>, d_result, (1));
+
+        T  h_result;
+        T* result = pointer_mode == rocblas_pointer_mode_device ? (T*)d_result : &h_result;
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_fn<T>(nullptr, N, alpha, dx, incx, dy, incy, result),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, N, nullptr, dx, incx, dy, incy, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, N, alpha, nullptr, incx, dy, incy, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, N, alpha, dx, incx, nullptr, incy, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, N, alpha, dx, incx, dy, incy, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // If N <= 0, alpha, X and Y can be nullptr, but result is still written
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, 0, nullptr, nullptr, incx, nullptr, incy, result),
+            rocblas_status_success);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, 0, nullptr, nullptr, incx, nullptr, incy, nullptr),
+            rocblas_status_invalid_pointer);
+    }
+}
+
+template <typename T>
+void testing_axpy_dot(const Arguments& arg)
+{
+    rocblas_int N       = arg.N;
+    rocblas_int incx    = arg.incx;
+    rocblas_int incy    = arg.incy;
+    T           h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        T result = T(-1);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_fn<T>(handle, N, nullptr, nullptr, incx, nullptr, incy, &result),
+            rocblas_status_success);
+        // the dot product of an empty vector is zero
+        T cpu_0 = T(0);
+        unit_check_general<T>(1, 1, 1, &cpu_0, &result);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_vector<T>, hx, (N, incx));
+    HOST_MEMCHECK(host_vector<T>, hy, (N, incy));
+    HOST_MEMCHECK(host_vector<T>, hy_gold, (N, incy));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+    DEVICE_MEMCHECK(device_vector<T>, dy, (N, incy));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<T>, d_result, (1));
+
+    // Initialize data on host memory. The fused kernel always reads both x
+    // and y, so neither may be seeded with NaN.
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false, true);
+
+    // save a copy in hy_gold which will be output of CPU BLAS
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    double cpu_time_used;
+    double rocblas_error_host   = 0.0;
+    double rocblas_error_device = 0.0;
+
+    T result_host;
+    T result_device;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_axpy_dot_fn<T>(handle, N, &h_alpha, dx, incx, dy, incy, &result_host));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy_gold));
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_axpy_dot_fn<T>(handle, N, d_alpha, dx, incx, dy, incy, d_result));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(&result_device, d_result, sizeof(T), hipMemcpyDeviceToHost));
+        }
+
+        // CPU BLAS: y += alpha * x then result = (y, y)
+        cpu_time_used = get_time_us_no_sync();
+
+        T cpu_result;
+        ref_axpy<T>(N, h_alpha, (T*)hx, incx, (T*)hy_gold, incy);
+        ref_dot<T>(N, (T*)hy_gold, incy, (T*)hy_gold, incy, &cpu_result);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The fused reduction accumulates in a different order than the
+        // sequential reference, so the dot product is checked with a
+        // reduction-sized tolerance while the updated y is checked exactly
+        const double tol = N * sum_error_tolerance<T>;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, hy_gold, hy);
+                near_check_general<T>(1, 1, 1, &cpu_result, &result_host, tol);
+            }
+
+            if(arg.norm_check)
+                rocblas_error_host = norm_check_general<T>('F', 1, N, incy, hy_gold, hy)
+                                     + rocblas_abs(cpu_result - result_host);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, hy_gold, hy);
+                near_check_general<T>(1, 1, 1, &cpu_result, &result_device, tol);
+            }
+
+            if(arg.norm_check)
+                rocblas_error_device = norm_check_general<T>('F', 1, N, incy, hy_gold, hy)
+                                       + rocblas_abs(cpu_result - result_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(
+                rocblas_axpy_dot_fn<T>(handle, N, &h_alpha, dx, incx, dy, incy, &result_host));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // one fused pass: axpy flops plus dot flops, axpy memory traffic
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_gflop_count<T>(N) + dot_gflop_count<false, T>(N),
+            axpy_gbyte_count<T>(N),
+            cpu_time_used,
+            rocblas_error_host,
+            rocblas_error_device);
+    }
+}
@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// axpy_dot_strided_batched is a beta API without Fortran or ILP64 bindings;
+// map the C entry points directly
+template <typename T>
+static auto rocblas_axpy_dot_strided_batched_fn = nullptr;
+template <>
+static auto rocblas_axpy_dot_strided_batched_fn<float> = rocblas_saxpy_dot_strided_batched;
+template <>
+static auto rocblas_axpy_dot_strided_batched_fn<double> = rocblas_daxpy_dot_strided_batched;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_dot_strided_batched_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int    N           = 100;
+        rocblas_int    incx        = 1;
+        rocblas_int    incy        = 1;
+        rocblas_stride stridex     = N;
+        rocblas_stride stridey     = N;
+        rocblas_int    batch_count = 2;
+
+        DEVICE_MEMCHECK(device_vector<T>, alpha_d, (1));
+
+        const T alpha_h(1);
+
+        const T* alpha = &alpha_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_strided_batch_vector<T>, dx, (N, incx, stridex, batch_count));
+        DEVICE_MEMCHECK(device_strided_batch_vector<T>, dy, (N, incy, stridey, batch_count));
+        DEVICE_MEMCHECK(device_vector<T>, d_results, (batch_count));
+
+        HOST_MEMCHECK(host_vector<T>, h_results, (batch_count));
+
+        T* results = pointer_mode == rocblas_pointer_mode_device ? (T*)d_results : (T*)h_results;
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                nullptr, N, alpha, dx, incx, stridex, dy, incy, stridey, batch_count, results),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, N, nullptr, dx, incx, stridex, dy, incy, stridey, batch_count, results),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, N, alpha, nullptr, incx, stridex, dy, incy, stridey, batch_count, results),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, N, alpha, dx, incx, stridex, nullptr, incy, stridey, batch_count, results),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, N, alpha, dx, incx, stridex, dy, incy, stridey, batch_count, nullptr),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, N, alpha, dx, incx, stridex, dy, incy, stridey, -1, results),
+            rocblas_status_invalid_size);
+
+        // If N <= 0, alpha, X and Y can be nullptr, but results is still written
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, 0, nullptr, nullptr, incx, stridex, nullptr, incy, stridey, batch_count, results),
+            rocblas_status_success);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, 0, nullptr, nullptr, incx, stridex, nullptr, incy, stridey, batch_count, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // If batch_count == 0, nothing is written but results must still be valid
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot_strided_batched_fn<T>(
+                handle, N, nullptr, nullptr, incx, stridex, nullptr, incy, stridey, 0, results),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_axpy_dot_strided_batched(const Arguments& arg)
+{
+    rocblas_int    N           = arg.N;
+    rocblas_int    incx        = arg.incx;
+    rocblas_int    incy        = arg.incy;
+    rocblas_stride stridex     = arg.stride_x;
+    rocblas_stride stridey     = arg.stride_y;
+    rocblas_int    batch_count = arg.batch_count;
+    T              h_alpha     = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        // N <= 0 with a positive batch_count still zeroes all batch_count results
+        HOST_MEMCHECK(host_vector<T>, results, (std::max(batch_count, 1)));
+        for(rocblas_int b = 0; b < std::max(batch_count, 1); b++)
+            results[b] = T(-1);
+        EXPECT_ROCBLAS_STATUS(rocblas_axpy_dot_strided_batched_fn<T>(handle,
+                                                                     N,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     incx,
+                                                                     stridex,
+                                                                     nullptr,
+                                                                     incy,
+                                                                     stridey,
+                                                                     batch_count,
+                                                                     results),
+                              batch_count < 0 ? rocblas_status_invalid_size
+                                              : rocblas_status_success);
+        if(N <= 0 && batch_count > 0)
+        {
+            // the dot product of an empty vector is zero
+            HOST_MEMCHECK(host_vector<T>, results_gold, (batch_count));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                results_gold[b] = T(0);
+            unit_check_general<T>(1, batch_count, 1, results_gold, results);
+        }
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_strided_batch_vector<T>, hx, (N, incx, stridex, batch_count));
+    HOST_MEMCHECK(host_strided_batch_vector<T>, hy, (N, incy, stridey, batch_count));
+    HOST_MEMCHECK(host_strided_batch_vector<T>, hy_gold, (N, incy, stridey, batch_count));
+    HOST_MEMCHECK(host_vector<T>, halpha, (1));
+    HOST_MEMCHECK(host_vector<T>, h_results_host, (batch_count));
+    HOST_MEMCHECK(host_vector<T>, h_results_device, (batch_count));
+    HOST_MEMCHECK(host_vector<T>, h_results_gold, (batch_count));
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_strided_batch_vector<T>, dx, (N, incx, stridex, batch_count));
+    DEVICE_MEMCHECK(device_strided_batch_vector<T>, dy, (N, incy, stridey, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<T>, d_results, (batch_count));
+
+    // Initialize data on host memory. The fused kernel always reads both x
+    // and y, so neither may be seeded with NaN.
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false, true);
+
+    hy_gold.copy_from(hy);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    double cpu_time_used;
+    double rocblas_error_host   = 0.0;
+    double rocblas_error_device = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn<T>(handle,
+                                                                       N,
+                                                                       &h_alpha,
+                                                                       dx,
+                                                                       incx,
+                                                                       stridex,
+                                                                       dy,
+                                                                       incy,
+                                                                       stridey,
+                                                                       batch_count,
+                                                                       h_results_host));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy_gold));
+            CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn<T>(handle,
+                                                                       N,
+                                                                       d_alpha,
+                                                                       dx,
+                                                                       incx,
+                                                                       stridex,
+                                                                       dy,
+                                                                       incy,
+                                                                       stridey,
+                                                                       batch_count,
+                                                                       d_results));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(h_results_device.transfer_from(d_results));
+        }
+
+        // CPU BLAS: y_i += alpha * x_i then results_i = (y_i, y_i)
+        cpu_time_used = get_time_us_no_sync();
+
+        for(size_t b = 0; b < batch_count; b++)
+        {
+            ref_axpy<T>(N, h_alpha, (T*)hx[b], incx, (T*)hy_gold[b], incy);
+            ref_dot<T>(N, (T*)hy_gold[b], incy, (T*)hy_gold[b], incy, &h_results_gold[b]);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The fused reduction accumulates in a different order than the
+        // sequential reference, so the dot products are checked with a
+        // reduction-sized tolerance while the updated y is checked exactly
+        const double tol = N * sum_error_tolerance<T>;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, stridey, hy_gold, hy, batch_count);
+                near_check_general<T>(1, batch_count, 1, h_results_gold, h_results_host, tol);
+            }
+
+            if(arg.norm_check)
+                rocblas_error_host
+                    = norm_check_general<T>('F', 1, N, incy, stridey, hy_gold, hy, batch_count)
+                      + norm_check_general<T>(
+                          'F', 1, batch_count, 1, h_results_gold, h_results_host);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, stridey, hy_gold, hy, batch_count);
+                near_check_general<T>(1, batch_count, 1, h_results_gold, h_results_device, tol);
+            }
+
+            if(arg.norm_check)
+                rocblas_error_device
+                    = norm_check_general<T>('F', 1, N, incy, stridey, hy_gold, hy, batch_count)
+                      + norm_check_general<T>(
+                          'F', 1, batch_count, 1, h_results_gold, h_results_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_axpy_dot_strided_batched_fn<T>(handle,
+                                                                       N,
+                                                                       &h_alpha,
+                                                                       dx,
+                                                                       incx,
+                                                                       stridex,
+                                                                       dy,
+                                                                       incy,
+                                                                       stridey,
+                                                                       batch_count,
+                                                                       h_results_host));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // one fused pass: axpy flops plus dot flops, axpy memory traffic
+        ArgumentModel<e_N, e_alpha, e_incx, e_stride_x, e_incy, e_stride_y, e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         axpy_gflop_count<T>(N) + dot_gflop_count<false, T>(N),
+                         axpy_gbyte_count<T>(N),
+                         cpu_time_used,
+                         rocblas_error_host,
+                         rocblas_error_device);
+    }
+}
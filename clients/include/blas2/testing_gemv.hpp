@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "device_timer.hpp"
 #include "testing_common.hpp"
 
 template <typename T>
@@ -370,17 +371,27 @@ void testing_gemv(const Arguments& arg)
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
 
+        DeviceTimer& device_timer = getDeviceTimer();
+
         for(int iter = 0; iter < total_calls; iter++)
         {
             if(iter == number_cold_calls)
+            {
                 gpu_time_used = get_time_us_sync(stream);
+                device_timer.mark_start(stream);
+            }
 
             DAPI_DISPATCH(rocblas_gemv_fn,
                           (handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
         }
 
+        device_timer.mark_stop(stream);
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
+        // device-timestamp bracketing replaces the host wall time when enabled
+        if(device_timer.enabled())
+            gpu_time_used = device_timer.time_us(stream);
+
         ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy>{}.log_args<T>(
             rocblas_cout,
             arg,
@@ -24,6 +24,7 @@
 
 #include "blas3/rocblas_gemm.hpp"
 #include "frequency_monitor.hpp"
+#include "latency_monitor.hpp"
 #include "testing_common.hpp"
 
 template <typename T>
@@ -244,17 +245,39 @@ void testing_gemm(const Arguments& arg)
     DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1, 1, HMM));
     DEVICE_MEMCHECK(device_vector<T>, d_beta, (1, 1, HMM));
 
-    // Initialize data on host memory
-    rocblas_init_matrix(
-        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
-    rocblas_init_matrix(
-        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
-    rocblas_init_matrix(hC_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    // timing-only runs never read the data back, so fill directly on device and
+    // skip the host-side fill and transfer, which dominate large shape sweeps
+    bool device_init = arg.timing && !arg.unit_check && !arg.norm_check
+                       && !rocblas_isnan(arg.alpha) && !rocblas_isnan(arg.beta)
+                       && (arg.initialization == rocblas_initialization::rand_int
+                           || arg.initialization == rocblas_initialization::hpl);
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_1));
+    if(device_init)
+    {
+        auto rand_gen = arg.initialization == rocblas_initialization::hpl
+                            ? random_hpl_generator<T>
+                            : random_generator<T>;
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        CHECK_HIP_ERROR(rocblas_init_device_tiled(rand_gen, (T*)dA, size_t(lda) * A_col, stream));
+        CHECK_HIP_ERROR(rocblas_init_device_tiled(rand_gen, (T*)dB, size_t(ldb) * B_col, stream));
+        CHECK_HIP_ERROR(rocblas_init_device_tiled(rand_gen, (T*)dC, size_t(ldc) * N, stream));
+    }
+    else
+    {
+        // Initialize data on host memory
+        rocblas_init_matrix(
+            hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+        rocblas_init_matrix(
+            hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+        rocblas_init_matrix(hC_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_1));
+    }
 
     if(arg.unit_check || arg.norm_check)
     {
@@ -397,64 +420,164 @@ void testing_gemm(const Arguments& arg)
             }
         }
 
-        // For the xf32 xdl math op, cast type of A/B from float to xfloat32 .
-        if(std::is_same<T, float>{} && math_mode == rocblas_xf32_xdl_math_op)
+        // on-device verification computes the reference with a gemv column sweep,
+        // which runs the library's source kernels rather than the Tensile path under
+        // test, and reduces the error norm on-device; only scalars return to host
+        constexpr bool c_device_check_type
+            = std::is_same_v<
+                  T,
+                  float> || std::is_same_v<T, double> || std::is_same_v<T, rocblas_float_complex> || std::is_same_v<T, rocblas_double_complex>;
+
+        const int64_t c_rocblas_int_max = std::numeric_limits<rocblas_int>::max();
+
+        bool on_device_check
+            = c_device_check_type && arg.device_check && arg.norm_check && !arg.unit_check
+              && arg.api != INTERNAL && math_mode == rocblas_default_math
+              && transB != rocblas_operation_conjugate_transpose && M <= c_rocblas_int_max
+              && K <= c_rocblas_int_max && lda <= c_rocblas_int_max && ldb <= c_rocblas_int_max
+              && ldc * N <= c_rocblas_int_max;
+
+        if(on_device_check)
         {
-            type_to_xdl_math_op_type<rocblas_xfloat32, float>(hA.data(), hA.size());
-            type_to_xdl_math_op_type<rocblas_xfloat32, float>(hB.data(), hB.size());
-        }
+            if constexpr(c_device_check_type)
+            {
+                auto rocblas_gemv_fn
+                    = arg.api & c_API_FORTRAN ? rocblas_gemv<T, true> : rocblas_gemv<T, false>;
+                auto rocblas_axpy_fn
+                    = arg.api & c_API_FORTRAN ? rocblas_axpy<T, true> : rocblas_axpy<T, false>;
+                auto rocblas_nrm2_fn
+                    = arg.api & c_API_FORTRAN ? rocblas_nrm2<T, true> : rocblas_nrm2<T, false>;
 
-        // now we can recycle gold matrix for reference purposes
-        cpu_time_used = get_time_us_no_sync();
+                DEVICE_MEMCHECK(device_matrix<T>, dC_ref, (M, N, ldc, HMM));
+                DEVICE_MEMCHECK(device_vector<T>, dC_err, (size_t(ldc) * N, 1, HMM));
 
-        ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, (T*)hC_gold, ldc);
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
-        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+                // reference starts from the untouched C
+                CHECK_HIP_ERROR(dC_ref.transfer_from(hC_gold));
 
-        //releasing already used host memory
-        hA = host_matrix<T>();
-        hB = host_matrix<T>();
+                // column j of op(B) is contiguous when B is untransposed, ldb-strided otherwise
+                rocblas_int x_inc = transB == rocblas_operation_none ? 1 : rocblas_int(ldb);
+                for(int64_t j = 0; j < N; j++)
+                {
+                    const T* x = (const T*)dB + (transB == rocblas_operation_none ? j * ldb : j);
+                    CHECK_ROCBLAS_ERROR(rocblas_gemv_fn(handle,
+                                                        transA,
+                                                        rocblas_int(A_row),
+                                                        rocblas_int(A_col),
+                                                        &h_alpha,
+                                                        (const T*)dA,
+                                                        rocblas_int(lda),
+                                                        x,
+                                                        x_inc,
+                                                        &h_beta,
+                                                        (T*)dC_ref + j * ldc,
+                                                        1));
+                }
 
-        auto compare_to_gold = [&] {
-            if(arg.unit_check)
-            {
-                if(std::is_same_v<T,
-                                  rocblas_half> && (rocblas_handle(handle)->getArchMajor() == 11))
+                // relative Frobenius norm of (reference - result), reduced on-device;
+                // the ldc padding rows are identical in both buffers so they cancel
+                rocblas_int n_err    = rocblas_int(ldc * N);
+                T           neg_one  = T(-1);
+                real_t<T>   ref_norm = 0;
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_nrm2_fn(handle, n_err, (const T*)dC_ref, 1, &ref_norm));
+
+                auto device_norm_error = [&](const T* d_res) {
+                    CHECK_HIP_ERROR(hipMemcpy((T*)dC_err,
+                                              (const T*)dC_ref,
+                                              sizeof(T) * size_t(ldc) * N,
+                                              hipMemcpyDeviceToDevice));
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_axpy_fn(handle, n_err, &neg_one, d_res, 1, (T*)dC_err, 1));
+                    real_t<T> err_norm = 0;
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_nrm2_fn(handle, n_err, (const T*)dC_err, 1, &err_norm));
+                    return ref_norm > 0 ? double(err_norm) / double(ref_norm)
+                                        : double(err_norm);
+                };
+
+                // dC still holds the result of the last mode run above; the device
+                // mode runs last, so compare it first before reloading dC
+                if(arg.pointer_mode_device)
+                    error_dev_ptr = device_norm_error(dC);
+                if(arg.pointer_mode_host)
                 {
-                    const double tol = K * sum_error_tolerance_for_gfx11<T, T, T>;
-                    near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    if(arg.pointer_mode_device)
+                        CHECK_HIP_ERROR(dC.transfer_from(hC_1));
+                    error_hst_ptr = device_norm_error(dC);
                 }
-                else if(reduction_requires_near<T>(arg, K))
+
+                rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
+
+                //releasing already used host memory
+                hA = host_matrix<T>();
+                hB = host_matrix<T>();
+            }
+        }
+        else
+        {
+            // For the xf32 xdl math op, cast type of A/B from float to xfloat32 .
+            if(std::is_same<T, float>{} && math_mode == rocblas_xf32_xdl_math_op)
+            {
+                type_to_xdl_math_op_type<rocblas_xfloat32, float>(hA.data(), hA.size());
+                type_to_xdl_math_op_type<rocblas_xfloat32, float>(hB.data(), hB.size());
+            }
+
+            // now we can recycle gold matrix for reference purposes
+            cpu_time_used = get_time_us_no_sync();
+
+            ref_gemm<T>(
+                transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, (T*)hC_gold, ldc);
+
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+            //releasing already used host memory
+            hA = host_matrix<T>();
+            hB = host_matrix<T>();
+
+            auto compare_to_gold = [&] {
+                if(arg.unit_check)
                 {
-                    const double tol = K * sum_error_tolerance<T>;
-                    near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    if(std::is_same_v<
+                           T,
+                           rocblas_half> && (rocblas_handle(handle)->getArchMajor() == 11))
+                    {
+                        const double tol = K * sum_error_tolerance_for_gfx11<T, T, T>;
+                        near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    }
+                    else if(reduction_requires_near<T>(arg, K))
+                    {
+                        const double tol = K * sum_error_tolerance<T>;
+                        near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    }
+                    else
+                    {
+                        unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+                    }
                 }
-                else
+                double error = 0;
+                if(arg.norm_check)
                 {
-                    unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+                    error = std::abs(norm_check_general<T>('F', M, N, ldc, (T*)hC_gold, (T*)hC_1));
                 }
-            }
-            double error = 0;
-            if(arg.norm_check)
+                return error;
+            };
+
+            // check error and norm
+            if(arg.pointer_mode_host)
             {
-                error = std::abs(norm_check_general<T>('F', M, N, ldc, (T*)hC_gold, (T*)hC_1));
+                error_hst_ptr = compare_to_gold();
             }
-            return error;
-        };
-
-        // check error and norm
-        if(arg.pointer_mode_host)
-        {
-            error_hst_ptr = compare_to_gold();
-        }
-        if(arg.pointer_mode_device)
-        {
-            // fetch device mode GPU results
-            CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+            if(arg.pointer_mode_device)
+            {
+                // fetch device mode GPU results
+                CHECK_HIP_ERROR(hC_1.transfer_from(dC));
 
-            error_dev_ptr = compare_to_gold();
+                error_dev_ptr = compare_to_gold();
+            }
+            rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
         }
-        rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
     }
 
     if(arg.timing)
@@ -471,16 +594,104 @@ void testing_gemm(const Arguments& arg)
         FrequencyMonitor& freq_monitor = getFrequencyMonitor();
         freq_monitor.start();
 
-        for(int i = 0; i < total_calls; i++)
+#if HIP_VERSION >= 50500000
+        if(arg.graph_test)
         {
-            if(i == number_cold_calls)
-                gpu_time_used = get_time_us_sync(stream); // in microseconds
-
+            // capture the call once, then time replays of the instantiated graph
+            // so launch-bound kernels are measured the way graph clients run them
+            handle.pre_test(arg);
             DAPI_DISPATCH(
                 rocblas_gemm_fn,
                 (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+            hipGraphExec_t graph_instance = handle.rocblas_stream_end_capture_instantiate();
+            hipStream_t    graph_stream   = handle.graph_stream();
+
+            for(int i = 0; i < total_calls; i++)
+            {
+                if(i == number_cold_calls)
+                    gpu_time_used = get_time_us_sync(graph_stream); // in microseconds
+
+                CHECK_HIP_ERROR(hipGraphLaunch(graph_instance, graph_stream));
+            }
+            gpu_time_used = get_time_us_sync(graph_stream) - gpu_time_used;
+
+            handle.rocblas_graph_replay_cleanup(graph_instance);
+        }
+        else
+#endif
+        {
+            // cycle operands through flush_batch_count copies so the cache is
+            // cold on reuse, see the flush_memory_size notes in testing_gemm_ex.hpp
+            size_t a_b_c_cached_size
+                = (size_t(M) * K + size_t(K) * N + size_t(M) * N) * sizeof(T);
+            size_t flush_batch_count = calculate_flush_batch_count(
+                arg.flush_batch_count, arg.flush_memory_size, a_b_c_cached_size);
+
+            rocblas_stride aligned_stride_a = align_stride<T>(size_t(lda) * A_col);
+            rocblas_stride aligned_stride_b = align_stride<T>(size_t(ldb) * B_col);
+            rocblas_stride aligned_stride_c = align_stride<T>(size_t(ldc) * N);
+
+            DEVICE_MEMCHECK(device_strided_batch_matrix<T>,
+                            dA_flush,
+                            (A_row, A_col, lda, aligned_stride_a, flush_batch_count));
+            DEVICE_MEMCHECK(device_strided_batch_matrix<T>,
+                            dB_flush,
+                            (B_row, B_col, ldb, aligned_stride_b, flush_batch_count));
+            DEVICE_MEMCHECK(device_strided_batch_matrix<T>,
+                            dC_flush,
+                            (M, N, ldc, aligned_stride_c, flush_batch_count));
+
+            // replicate device-to-device since hA/hB may already be released
+            for(size_t j = 0; j < flush_batch_count; j++)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(dA_flush[j],
+                                          dA,
+                                          sizeof(T) * size_t(lda) * A_col,
+                                          hipMemcpyDeviceToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dB_flush[j],
+                                          dB,
+                                          sizeof(T) * size_t(ldb) * B_col,
+                                          hipMemcpyDeviceToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dC_flush[j], dC, sizeof(T) * size_t(ldc) * N, hipMemcpyDeviceToDevice));
+            }
+
+            LatencyMonitor& latency_monitor = getLatencyMonitor();
+            bool            per_iter_timing = latency_monitor.enabled();
+            latency_monitor.start();
+
+            for(int i = 0; i < total_calls; i++)
+            {
+                if(i == number_cold_calls)
+                    gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+                int flush_index = (i + 1) % flush_batch_count;
+
+                double iter_start = 0.0;
+                if(per_iter_timing && i >= number_cold_calls)
+                    iter_start = get_time_us_sync(stream);
+
+                DAPI_DISPATCH(rocblas_gemm_fn,
+                              (handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               &h_alpha,
+                               dA_flush[flush_index],
+                               lda,
+                               dB_flush[flush_index],
+                               ldb,
+                               &h_beta,
+                               dC_flush[flush_index],
+                               ldc));
+
+                if(per_iter_timing && i >= number_cold_calls)
+                    latency_monitor.record(get_time_us_sync(stream) - iter_start);
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         freq_monitor.stop();
 
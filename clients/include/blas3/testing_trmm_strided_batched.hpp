@@ -37,6 +37,8 @@
 #include "rocblas_vector.hpp"
 #include "unit.hpp"
 
+#include "blas3/rocblas_trmm.hpp"
+
 template <typename T>
 void testing_trmm_strided_batched_bad_arg(const Arguments& arg)
 {
@@ -562,6 +564,7 @@ void testing_trmm_strided_batched(const Arguments& arg)
     char char_transA = arg.transA;
     char char_diag   = arg.diag;
     T    alpha       = arg.get_alpha<T>();
+    T    beta        = arg.get_beta<T>(); // only used by the internal accumulate interface
 
     rocblas_side      side   = char2rocblas_side(char_side);
     rocblas_fill      uplo   = char2rocblas_fill(char_uplo);
@@ -707,25 +710,56 @@ void testing_trmm_strided_batched(const Arguments& arg)
             CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
             handle.pre_test(arg);
-            DAPI_CHECK(rocblas_trmm_strided_batched_fn,
-                       (handle,
-                        side,
-                        uplo,
-                        transA,
-                        diag,
-                        M,
-                        N,
-                        &h_alpha[0],
-                        dA,
-                        lda,
-                        stride_a,
-                        dB,
-                        ldb,
-                        stride_b,
-                        *dOut,
-                        ldOut,
-                        stride_c,
-                        batch_count));
+            if(arg.api != INTERNAL)
+            {
+                DAPI_CHECK(rocblas_trmm_strided_batched_fn,
+                           (handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            M,
+                            N,
+                            &h_alpha[0],
+                            dA,
+                            lda,
+                            stride_a,
+                            dB,
+                            ldb,
+                            stride_b,
+                            *dOut,
+                            ldOut,
+                            stride_c,
+                            batch_count));
+            }
+            else
+            {
+                // NOTE: not testing internal 64-bit API as of now
+                // fused accumulate interface computes C = alpha*op(A)*B + beta*C
+                // in one pass, so it is exercised out-of-place only
+                CHECK_ROCBLAS_ERROR(rocblas_internal_trmm_accumulate_template(handle,
+                                                                              side,
+                                                                              uplo,
+                                                                              transA,
+                                                                              diag,
+                                                                              M,
+                                                                              N,
+                                                                              &h_alpha[0],
+                                                                              &beta,
+                                                                              (const T*)dA,
+                                                                              0,
+                                                                              lda,
+                                                                              stride_a,
+                                                                              (const T*)dB,
+                                                                              0,
+                                                                              ldb,
+                                                                              stride_b,
+                                                                              (T*)dC,
+                                                                              0,
+                                                                              ldc,
+                                                                              stride_c,
+                                                                              batch_count));
+            }
             handle.post_test(arg);
             CHECK_HIP_ERROR(hC.transfer_from(*dOut));
         }
@@ -832,8 +866,21 @@ void testing_trmm_strided_batched(const Arguments& arg)
         }
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
-        // copy B matrix into C matrix
-        copy_matrix_with_different_leading_dimensions(hB, hC_gold);
+        if(arg.api != INTERNAL)
+        {
+            // copy B matrix into C matrix
+            copy_matrix_with_different_leading_dimensions(hB, hC_gold);
+        }
+        else
+        {
+            // hC_gold still holds the original C; ref_trmm left alpha*op(A)*B in hB,
+            // so fold in the accumulate semantics C = alpha*op(A)*B + beta*C
+            for(int64_t b = 0; b < batch_count; b++)
+                for(int64_t j = 0; j < N; j++)
+                    for(int64_t i = 0; i < M; i++)
+                        hC_gold[b][i + j * ldc]
+                            = hB[b][i + j * ldb] + beta * hC_gold[b][i + j * ldc];
+        }
 
         if(arg.pointer_mode_host)
         {
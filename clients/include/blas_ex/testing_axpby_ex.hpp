@@ -0,0 +1,375 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+void testing_axpby_ex_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_datatype alpha_type     = rocblas_type2datatype<Ta>();
+        rocblas_datatype x_type         = rocblas_type2datatype<Tx>();
+        rocblas_datatype y_type         = rocblas_type2datatype<Ty>();
+        rocblas_datatype execution_type = rocblas_type2datatype<Tex>();
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+
+        DEVICE_MEMCHECK(device_vector<Ta>, alpha_d, (1));
+        DEVICE_MEMCHECK(device_vector<Ta>, zero_d, (1));
+        DEVICE_MEMCHECK(device_vector<Ta>, one_d, (1));
+
+        const Ta alpha_h(1), zero_h(0), one_h(1);
+
+        const Ta* alpha = &alpha_h;
+        const Ta* zero  = &zero_h;
+        const Ta* one   = &one_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+        }
+
+        DEVICE_MEMCHECK(device_vector<Tx>, dx, (N));
+        DEVICE_MEMCHECK(device_vector<Ty>, dy, (N));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(nullptr,
+                                               N,
+                                               alpha,
+                                               one,
+                                               alpha_type,
+                                               dx,
+                                               x_type,
+                                               incx,
+                                               dy,
+                                               y_type,
+                                               incy,
+                                               execution_type),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                               N,
+                                               nullptr,
+                                               one,
+                                               alpha_type,
+                                               dx,
+                                               x_type,
+                                               incx,
+                                               dy,
+                                               y_type,
+                                               incy,
+                                               execution_type),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                               N,
+                                               alpha,
+                                               nullptr,
+                                               alpha_type,
+                                               dx,
+                                               x_type,
+                                               incx,
+                                               dy,
+                                               y_type,
+                                               incy,
+                                               execution_type),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                                   N,
+                                                   alpha,
+                                                   one,
+                                                   alpha_type,
+                                                   nullptr,
+                                                   x_type,
+                                                   incx,
+                                                   dy,
+                                                   y_type,
+                                                   incy,
+                                                   execution_type),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                                   N,
+                                                   alpha,
+                                                   one,
+                                                   alpha_type,
+                                                   dx,
+                                                   x_type,
+                                                   incx,
+                                                   nullptr,
+                                                   y_type,
+                                                   incy,
+                                                   execution_type),
+                                  rocblas_status_invalid_pointer);
+        }
+
+        // If N == 0, then alpha, beta, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                               0,
+                                               nullptr,
+                                               nullptr,
+                                               alpha_type,
+                                               nullptr,
+                                               x_type,
+                                               incx,
+                                               nullptr,
+                                               y_type,
+                                               incy,
+                                               execution_type),
+                              rocblas_status_success);
+
+        // If alpha == 0 && beta == 1, then X and Y can be nullptr without error
+        if(pointer_mode == rocblas_pointer_mode_host)
+            EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                                   N,
+                                                   zero,
+                                                   one,
+                                                   alpha_type,
+                                                   nullptr,
+                                                   x_type,
+                                                   incx,
+                                                   nullptr,
+                                                   y_type,
+                                                   incy,
+                                                   execution_type),
+                                  rocblas_status_success);
+    }
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+void testing_axpby_ex(const Arguments& arg)
+{
+    rocblas_datatype alpha_type     = arg.a_type;
+    rocblas_datatype x_type         = arg.b_type;
+    rocblas_datatype y_type         = arg.c_type;
+    rocblas_datatype execution_type = arg.compute_type;
+
+    rocblas_int          N       = arg.N;
+    rocblas_int          incx    = arg.incx;
+    rocblas_int          incy    = arg.incy;
+    Ta                   h_alpha = arg.get_alpha<Ta>();
+    Ta                   h_beta  = arg.get_beta<Ta>();
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(rocblas_axpby_ex(handle,
+                                               N,
+                                               nullptr,
+                                               nullptr,
+                                               alpha_type,
+                                               nullptr,
+                                               x_type,
+                                               incx,
+                                               nullptr,
+                                               y_type,
+                                               incy,
+                                               execution_type),
+                              rocblas_status_success);
+        return;
+    }
+
+    size_t abs_incx = incx >= 0 ? incx : -incx;
+    size_t abs_incy = incy >= 0 ? incy : -incy;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_vector<Tx>, hx, (N, incx));
+    HOST_MEMCHECK(host_vector<Tex>, hx_ex, (N, incx));
+    HOST_MEMCHECK(host_vector<Ty>, hy, (N, incy));
+    HOST_MEMCHECK(host_vector<Ty>, hy_gold, (N, incy));
+    HOST_MEMCHECK(host_vector<Tex>, hy_gold_ex, (N, incy));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<Tx>, dx, (N, incx));
+    DEVICE_MEMCHECK(device_vector<Ty>, dy, (N, incy));
+    DEVICE_MEMCHECK(device_vector<Ta>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<Ta>, d_beta, (1));
+
+    // Initialize data on host memory. The fused kernel always reads both x
+    // and y, so neither may be seeded with NaN.
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false, true);
+
+    // save a copy in hy_gold which will be output of CPU BLAS
+    hy_gold = hy;
+
+    for(size_t i = 0, idx = 0; i < N; i++, idx += abs_incy)
+        hy_gold_ex[idx] = (Tex)hy_gold[idx];
+
+    for(size_t i = 0, idx = 0; i < N; i++, idx += abs_incx)
+        hx_ex[idx] = (Tex)hx[idx];
+
+    Tex h_alpha_ex = (Tex)h_alpha;
+    Tex h_beta_ex  = (Tex)h_beta;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    double cpu_time_used;
+    double rocblas_error_host   = 0.0;
+    double rocblas_error_device = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_ex(handle,
+                                                 N,
+                                                 &h_alpha,
+                                                 &h_beta,
+                                                 alpha_type,
+                                                 dx,
+                                                 x_type,
+                                                 incx,
+                                                 dy,
+                                                 y_type,
+                                                 incy,
+                                                 execution_type));
+            handle.post_test(arg);
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(dy.transfer_from(hy_gold));
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Ta), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Ta), hipMemcpyHostToDevice));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_ex(handle,
+                                                 N,
+                                                 d_alpha,
+                                                 d_beta,
+                                                 alpha_type,
+                                                 dx,
+                                                 x_type,
+                                                 incx,
+                                                 dy,
+                                                 y_type,
+                                                 incy,
+                                                 execution_type));
+            handle.post_test(arg);
+        }
+
+        // CPU BLAS in the compute type: y := beta * y then y += alpha * x
+        cpu_time_used = get_time_us_no_sync();
+
+        ref_scal<Tex>(N, h_beta_ex, (Tex*)hy_gold_ex, abs_incy);
+        ref_axpy<Tex>(N, h_alpha_ex, hx_ex, incx, hy_gold_ex, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        for(size_t i = 0, idx = 0; i < N; i++, idx += abs_incy)
+            hy_gold[idx] = (Ty)hy_gold_ex[idx];
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+                unit_check_general<Ty>(1, N, incy, hy_gold, hy);
+
+            if(arg.norm_check)
+                rocblas_error_host = norm_check_general<Ty>('F', 1, N, incy, hy_gold, hy);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+
+            if(arg.unit_check)
+                unit_check_general<Ty>(1, N, incy, hy_gold, hy);
+
+            if(arg.norm_check)
+                rocblas_error_device = norm_check_general<Ty>('F', 1, N, incy, hy_gold, hy);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_ex(handle,
+                                                 N,
+                                                 &h_alpha,
+                                                 &h_beta,
+                                                 alpha_type,
+                                                 dx,
+                                                 x_type,
+                                                 incx,
+                                                 dy,
+                                                 y_type,
+                                                 incy,
+                                                 execution_type));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // axpby performs one extra multiply per element over axpy
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy>{}.log_args<Ta>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            1.5 * axpy_gflop_count<Ta>(N),
+            axpy_gbyte_count<Ta>(N),
+            cpu_time_used,
+            rocblas_error_host,
+            rocblas_error_device);
+    }
+}
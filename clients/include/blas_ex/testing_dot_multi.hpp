@@ -0,0 +1,246 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// dot_multi is a beta API without Fortran or ILP64 bindings; map the C entry
+// points directly
+template <typename T>
+static auto rocblas_dot_multi_fn = nullptr;
+template <>
+static auto rocblas_dot_multi_fn<float> = rocblas_sdot_multi;
+template <>
+static auto rocblas_dot_multi_fn<double> = rocblas_ddot_multi;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_dot_multi_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int    N       = 100;
+        rocblas_int    incx    = 1;
+        rocblas_int    incy    = 1;
+        rocblas_stride stridey = N;
+        rocblas_int    K       = 2;
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+        DEVICE_MEMCHECK(device_strided_batch_vector<T>, dy, (N, incy, stridey, K));
+        DEVICE_MEMCHECK(device_vector<T>, d_results, (K));
+
+        HOST_MEMCHECK(host_vector<T>, h_results, (K));
+
+        T* results = pointer_mode == rocblas_pointer_mode_device ? (T*)d_results : (T*)h_results;
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(nullptr, N, dx, incx, dy, incy, stridey, K, results),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, N, nullptr, incx, dy, incy, stridey, K, results),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, N, dx, incx, nullptr, incy, stridey, K, results),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, N, dx, incx, dy, incy, stridey, K, nullptr),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, N, dx, incx, dy, incy, stridey, -1, results),
+            rocblas_status_invalid_size);
+
+        // If N <= 0, X and Y can be nullptr, but results is still written
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, 0, nullptr, incx, nullptr, incy, stridey, K, results),
+            rocblas_status_success);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, 0, nullptr, incx, nullptr, incy, stridey, K, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // If K == 0, nothing is written but results must still be valid
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, N, nullptr, incx, nullptr, incy, stridey, 0, results),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_dot_multi(const Arguments& arg)
+{
+    rocblas_int    N       = arg.N;
+    rocblas_int    incx    = arg.incx;
+    rocblas_int    incy    = arg.incy;
+    rocblas_stride stridey = arg.stride_y;
+    rocblas_int    K       = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        // N <= 0 with a positive K still zeroes all K results
+        HOST_MEMCHECK(host_vector<T>, results, (std::max(K, 1)));
+        for(rocblas_int b = 0; b < std::max(K, 1); b++)
+            results[b] = T(-1);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_multi_fn<T>(handle, N, nullptr, incx, nullptr, incy, stridey, K, results),
+            K < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        if(N <= 0 && K > 0)
+        {
+            // the dot product of an empty vector is zero
+            HOST_MEMCHECK(host_vector<T>, results_gold, (K));
+            for(rocblas_int b = 0; b < K; b++)
+                results_gold[b] = T(0);
+            unit_check_general<T>(1, K, 1, results_gold, results);
+        }
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_vector<T>, hx, (N, incx));
+    HOST_MEMCHECK(host_strided_batch_vector<T>, hy, (N, incy, stridey, K));
+    HOST_MEMCHECK(host_vector<T>, h_results_host, (K));
+    HOST_MEMCHECK(host_vector<T>, h_results_device, (K));
+    HOST_MEMCHECK(host_vector<T>, h_results_gold, (K));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+    DEVICE_MEMCHECK(device_strided_batch_vector<T>, dy, (N, incy, stridey, K));
+    DEVICE_MEMCHECK(device_vector<T>, d_results, (K));
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double cpu_time_used;
+    double rocblas_error_host   = 0.0;
+    double rocblas_error_device = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot_multi_fn<T>(handle, N, dx, incx, dy, incy, stridey, K, h_results_host));
+            handle.post_test(arg);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot_multi_fn<T>(handle, N, dx, incx, dy, incy, stridey, K, d_results));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(h_results_device.transfer_from(d_results));
+        }
+
+        // CPU BLAS: results_i = (x, y_i)
+        cpu_time_used = get_time_us_no_sync();
+
+        for(size_t b = 0; b < K; b++)
+            ref_dot<T>(N, (T*)hx, incx, (T*)hy[b], incy, &h_results_gold[b]);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The single-launch reduction accumulates in a different order than
+        // the sequential reference, so the results are checked with a
+        // reduction-sized tolerance
+        const double tol = N * sum_error_tolerance<T>;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+                near_check_general<T>(1, K, 1, h_results_gold, h_results_host, tol);
+
+            if(arg.norm_check)
+                rocblas_error_host
+                    = norm_check_general<T>('F', 1, K, 1, h_results_gold, h_results_host);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            if(arg.unit_check)
+                near_check_general<T>(1, K, 1, h_results_gold, h_results_device, tol);
+
+            if(arg.norm_check)
+                rocblas_error_device
+                    = norm_check_general<T>('F', 1, K, 1, h_results_gold, h_results_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot_multi_fn<T>(handle, N, dx, incx, dy, incy, stridey, K, h_results_host));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // x is read once and swept against all K vectors
+        ArgumentModel<e_N, e_incx, e_incy, e_stride_y, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            K * dot_gflop_count<false, T>(N),
+            (double(K) + 1.0) * N * sizeof(T) / 1e9,
+            cpu_time_used,
+            rocblas_error_host,
+            rocblas_error_device);
+    }
+}
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// dot_weighted is a beta API without Fortran or ILP64 bindings; map the C
+// entry points directly
+template <typename T>
+static auto rocblas_dot_weighted_fn = nullptr;
+template <>
+static auto rocblas_dot_weighted_fn<float> = rocblas_sdot_weighted;
+template <>
+static auto rocblas_dot_weighted_fn<double> = rocblas_ddot_weighted;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_dot_weighted_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+        rocblas_int incw = 1;
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+        DEVICE_MEMCHECK(device_vector<T>, dy, (N, incy));
+        DEVICE_MEMCHECK(device_vector<T>, dw, (N, incw));
+        DEVICE_MEMCHECK(device_vector<T>, d_result, (1));
+
+        HOST_MEMCHECK(host_vector<T>, h_result, (1));
+
+        T* result = pointer_mode == rocblas_pointer_mode_device ? (T*)d_result : (T*)h_result;
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_weighted_fn<T>(nullptr, N, dx, incx, dy, incy, dw, incw, result),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_weighted_fn<T>(handle, N, nullptr, incx, dy, incy, dw, incw, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_weighted_fn<T>(handle, N, dx, incx, nullptr, incy, dw, incw, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_weighted_fn<T>(handle, N, dx, incx, dy, incy, dw, incw, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // a null weight vector is valid: the weight defaults to one
+
+        // If N <= 0, x, y and w can be nullptr, but the result is still zeroed
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_weighted_fn<T>(
+                handle, 0, nullptr, incx, nullptr, incy, nullptr, incw, result),
+            rocblas_status_success);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot_weighted_fn<T>(
+                handle, 0, nullptr, incx, nullptr, incy, nullptr, incw, nullptr),
+            rocblas_status_invalid_pointer);
+    }
+}
+
+template <typename T>
+void testing_dot_weighted(const Arguments& arg)
+{
+    rocblas_int N    = arg.N;
+    rocblas_int incx = arg.incx;
+    rocblas_int incy = arg.incy;
+    // Arguments has no dedicated field for incw
+    rocblas_int incw = arg.lda;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        T result = T(-1);
+        CHECK_ROCBLAS_ERROR(rocblas_dot_weighted_fn<T>(
+            handle, N, nullptr, incx, nullptr, incy, nullptr, incw, &result));
+        // the weighted dot of an empty vector is zero
+        T result_gold = T(0);
+        unit_check_general<T>(1, 1, 1, &result_gold, &result);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_vector<T>, hx, (N, incx));
+    HOST_MEMCHECK(host_vector<T>, hy, (N, incy));
+    HOST_MEMCHECK(host_vector<T>, hw, (N, incw));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+    DEVICE_MEMCHECK(device_vector<T>, dy, (N, incy));
+    DEVICE_MEMCHECK(device_vector<T>, dw, (N, incw));
+    DEVICE_MEMCHECK(device_vector<T>, d_result, (1));
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    // a mix of zero and nonzero weights exercises the masked-reduction use
+    rocblas_int abs_incw = incw >= 0 ? incw : -incw;
+    for(rocblas_int i = 0; i < N; i++)
+        hw[i * int64_t(abs_incw ? abs_incw : 1)] = T(i % 3) / T(2);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dw.transfer_from(hw));
+
+    double cpu_time_used;
+    double rocblas_error_host   = 0.0;
+    double rocblas_error_device = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        T h_result_host, h_result_device, h_result_host_null_w;
+
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_dot_weighted_fn<T>(
+                handle, N, dx, incx, dy, incy, dw, incw, &h_result_host));
+            handle.post_test(arg);
+
+            // a null w must degrade to a plain dot
+            CHECK_ROCBLAS_ERROR(rocblas_dot_weighted_fn<T>(
+                handle, N, dx, incx, dy, incy, nullptr, incw, &h_result_host_null_w));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot_weighted_fn<T>(handle, N, dx, incx, dy, incy, dw, incw, d_result));
+            handle.post_test(arg);
+        }
+
+        // CPU reference: result = sum_i w_i * x_i * y_i, walking the vectors
+        // with the same negative-increment convention as the kernel
+        cpu_time_used = get_time_us_no_sync();
+
+        T result_gold        = T(0);
+        T result_gold_null_w = T(0);
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            int64_t ix = incx >= 0 ? i * int64_t(incx) : (i - (N - 1)) * int64_t(incx);
+            int64_t iy = incy >= 0 ? i * int64_t(incy) : (i - (N - 1)) * int64_t(incy);
+            int64_t iw = incw >= 0 ? i * int64_t(incw) : (i - (N - 1)) * int64_t(incw);
+
+            T term = hx[ix] * hy[iy];
+            result_gold_null_w += term;
+            result_gold += hw[iw] * term;
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The single-launch reduction accumulates in a different order than
+        // the sequential reference, so the results are checked with a
+        // reduction-sized tolerance
+        const double tol = N * sum_error_tolerance<T>;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+            {
+                near_check_general<T>(1, 1, 1, &result_gold, &h_result_host, tol);
+                near_check_general<T>(1, 1, 1, &result_gold_null_w, &h_result_host_null_w, tol);
+            }
+
+            if(arg.norm_check)
+                rocblas_error_host = norm_check_general<T>('F', 1, 1, 1, &result_gold, &h_result_host);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(&h_result_device, d_result, sizeof(T), hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+                near_check_general<T>(1, 1, 1, &result_gold, &h_result_device, tol);
+
+            if(arg.norm_check)
+                rocblas_error_device
+                    = norm_check_general<T>('F', 1, 1, 1, &result_gold, &h_result_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        T h_result;
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot_weighted_fn<T>(handle, N, dx, incx, dy, incy, dw, incw, &h_result));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // one multiply-add per element for the dot plus one multiply for the weight
+        double gflop_count = (3.0 * N) / 1e9;
+        double gbyte_count = 3.0 * N * sizeof(T) / 1e9;
+
+        ArgumentModel<e_N, e_incx, e_incy, e_lda>{}.log_args<T>(rocblas_cout,
+                                                                arg,
+                                                                gpu_time_used,
+                                                                gflop_count,
+                                                                gbyte_count,
+                                                                cpu_time_used,
+                                                                rocblas_error_host,
+                                                                rocblas_error_device);
+    }
+}
@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+template <typename Ti>
+void testing_f8_convert_bad_arg(const Arguments& arg)
+{
+    // f8_convert is a beta API without Fortran or ILP64 bindings; call the
+    // C entry point directly
+    rocblas_local_handle handle{arg};
+
+    const int64_t        n           = 64;
+    const rocblas_stride stride_x    = n;
+    const rocblas_stride stride_y    = n;
+    const rocblas_int    batch_count = 2;
+    const uint32_t       flags       = 0;
+
+    const rocblas_datatype x_type = rocblas_type2datatype<Ti>();
+    const rocblas_datatype y_type = rocblas_datatype_f8_r;
+
+    const float scale = 1.0f;
+
+    DEVICE_MEMCHECK(device_strided_batch_vector<Ti>, dx, (n, 1, stride_x, batch_count));
+    DEVICE_MEMCHECK(device_strided_batch_vector<rocblas_f8>, dy, (n, 1, stride_y, batch_count));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_f8_convert(nullptr,
+                                             n,
+                                             &scale,
+                                             dx,
+                                             x_type,
+                                             stride_x,
+                                             dy,
+                                             y_type,
+                                             stride_y,
+                                             batch_count,
+                                             flags),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, -1, &scale, dx, x_type, stride_x, dy, y_type, stride_y, batch_count, flags),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, n, &scale, dx, x_type, stride_x, dy, y_type, stride_y, -1, flags),
+        rocblas_status_invalid_size);
+
+    // n == 0 and batch_count == 0 are quick returns, even with null pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, 0, nullptr, nullptr, x_type, stride_x, nullptr, y_type, stride_y, batch_count, flags),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, n, nullptr, nullptr, x_type, stride_x, nullptr, y_type, stride_y, 0, flags),
+        rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, n, nullptr, dx, x_type, stride_x, dy, y_type, stride_y, batch_count, flags),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, n, &scale, nullptr, x_type, stride_x, dy, y_type, stride_y, batch_count, flags),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_f8_convert(
+            handle, n, &scale, dx, x_type, stride_x, nullptr, y_type, stride_y, batch_count, flags),
+        rocblas_status_invalid_pointer);
+
+    // only f32/f16 sources and f8/bf8 destinations are served
+    EXPECT_ROCBLAS_STATUS(rocblas_f8_convert(handle,
+                                             n,
+                                             &scale,
+                                             dx,
+                                             rocblas_datatype_f64_r,
+                                             stride_x,
+                                             dy,
+                                             y_type,
+                                             stride_y,
+                                             batch_count,
+                                             flags),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocblas_f8_convert(handle,
+                                             n,
+                                             &scale,
+                                             dx,
+                                             x_type,
+                                             stride_x,
+                                             dy,
+                                             rocblas_datatype_f32_r,
+                                             stride_y,
+                                             batch_count,
+                                             flags),
+                          rocblas_status_not_implemented);
+}
+
+template <typename Ti, typename To>
+void f8_convert_run_test(const Arguments& arg)
+{
+    int64_t        n           = arg.N;
+    rocblas_stride stride_x    = arg.stride_x;
+    rocblas_stride stride_y    = arg.stride_y;
+    rocblas_int    batch_count = arg.batch_count;
+
+    const rocblas_datatype x_type = rocblas_type2datatype<Ti>();
+    const rocblas_datatype y_type = rocblas_type2datatype<To>();
+
+    rocblas_local_handle handle{arg};
+
+    if(n <= 0 || batch_count <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_f8_convert(handle,
+                               n,
+                               nullptr,
+                               nullptr,
+                               x_type,
+                               stride_x,
+                               nullptr,
+                               y_type,
+                               stride_y,
+                               batch_count,
+                               0),
+            n < 0 || batch_count < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Allocate host memory
+    HOST_MEMCHECK(host_strided_batch_vector<Ti>, hx, (n, 1, stride_x, batch_count));
+    HOST_MEMCHECK(host_strided_batch_vector<To>, hy, (n, 1, stride_y, batch_count));
+    HOST_MEMCHECK(host_strided_batch_vector<To>, hy_gold, (n, 1, stride_y, batch_count));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_strided_batch_vector<Ti>, dx, (n, 1, stride_x, batch_count));
+    DEVICE_MEMCHECK(device_strided_batch_vector<To>, dy, (n, 1, stride_y, batch_count));
+    DEVICE_MEMCHECK(device_vector<float>, d_scale, (1));
+
+    // Small integers scaled by a power of two land exactly on f8/bf8 grid
+    // points, so nearest and stochastic rounding agree and the comparison
+    // below is exact for both flag settings
+    const float scale = 0.25f;
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(int64_t i = 0; i < n; i++)
+            hx[b][i] = Ti(double(int((i + b) % 5) - 2));
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, &scale, sizeof(scale), hipMemcpyHostToDevice));
+
+    // reference through the same downcast helper the kernel commits
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(int64_t i = 0; i < n; i++)
+            hy_gold[b][i] = explicit_downcast<To, float, false>(scale * float(hx[b][i]), 0);
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(uint32_t flags : {uint32_t(0), uint32_t(rocblas_gemm_flags_stochastic_rounding)})
+        {
+            if(arg.pointer_mode_host)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(rocblas_f8_convert(handle,
+                                                       n,
+                                                       &scale,
+                                                       dx,
+                                                       x_type,
+                                                       stride_x,
+                                                       dy,
+                                                       y_type,
+                                                       stride_y,
+                                                       batch_count,
+                                                       flags));
+                CHECK_HIP_ERROR(hy.transfer_from(dy));
+                unit_check_general<To>(1, n, 1, stride_y, hy_gold, hy, batch_count);
+            }
+
+            if(arg.pointer_mode_device)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                CHECK_ROCBLAS_ERROR(rocblas_f8_convert(handle,
+                                                       n,
+                                                       d_scale,
+                                                       dx,
+                                                       x_type,
+                                                       stride_x,
+                                                       dy,
+                                                       y_type,
+                                                       stride_y,
+                                                       batch_count,
+                                                       flags));
+                CHECK_HIP_ERROR(hy.transfer_from(dy));
+                unit_check_general<To>(1, n, 1, stride_y, hy_gold, hy, batch_count);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_f8_convert(
+                handle, n, &scale, dx, x_type, stride_x, dy, y_type, stride_y, batch_count, 0));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gbyte_count = batch_count * n * (sizeof(Ti) + sizeof(To)) / 1e9;
+
+        ArgumentModel<e_N, e_stride_x, e_stride_y, e_batch_count>{}.log_args<Ti>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbyte_count,
+            cpu_time_used);
+    }
+}
+
+// the destination type is selected at runtime by arg.b_type
+template <typename Ti>
+void testing_f8_convert(const Arguments& arg)
+{
+    if(arg.b_type == rocblas_datatype_f8_r)
+        f8_convert_run_test<Ti, rocblas_f8>(arg);
+    else if(arg.b_type == rocblas_datatype_bf8_r)
+        f8_convert_run_test<Ti, rocblas_bf8>(arg);
+    else
+        FAIL() << "Internal error: f8_convert test called with unknown destination type";
+}
@@ -0,0 +1,930 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// geam_min_plus_argmin is a beta API without Fortran or ILP64 bindings; map the
+// C entry points directly
+template <typename T>
+static auto rocblas_geam_min_plus_argmin_fn = nullptr;
+template <>
+static auto rocblas_geam_min_plus_argmin_fn<float> = rocblas_sgeam_min_plus_argmin;
+template <>
+static auto rocblas_geam_min_plus_argmin_fn<double> = rocblas_dgeam_min_plus_argmin;
+
+// Host replica of the device decision rules: candidates use the same
+// alpha * av + alpha * bv expression, ties keep the lowest l, and the beta * C
+// incumbent wins ties, so both D and the argmin indices match the GPU exactly.
+template <typename T>
+static void ref_geam_min_plus_argmin(rocblas_operation transA,
+                                     rocblas_operation transB,
+                                     rocblas_int       M,
+                                     rocblas_int       N,
+                                     rocblas_int       K,
+                                     T                 alpha,
+                                     const T*          A,
+                                     rocblas_int       lda,
+                                     const T*          B,
+                                     rocblas_int       ldb,
+                                     T                 beta,
+                                     const T*          C,
+                                     rocblas_int       ldc,
+                                     T*                D,
+                                     rocblas_int       ldd,
+                                     rocblas_int*      argmin,
+                                     rocblas_int       ldi)
+{
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            T           best   = std::numeric_limits<T>::max();
+            rocblas_int best_l = -1;
+
+            if(K > 0 && !alpha)
+            {
+                best   = T(0);
+                best_l = 0;
+            }
+            else
+            {
+                for(rocblas_int l = 0; l < K; l++)
+                {
+                    T av = transA == rocblas_operation_none ? A[i + l * size_t(lda)]
+                                                            : A[l + i * size_t(lda)];
+                    T bv = transB == rocblas_operation_none ? B[l + j * size_t(ldb)]
+                                                            : B[j + l * size_t(ldb)];
+
+                    T cand = alpha * av + alpha * bv;
+                    if(cand < best)
+                    {
+                        best   = cand;
+                        best_l = l;
+                    }
+                }
+            }
+
+            T incumbent = beta ? beta * C[i + j * size_t(ldc)] : T(0);
+
+            if(K > 0 && best < incumbent)
+            {
+                D[i + j * size_t(ldd)]      = best;
+                argmin[i + j * size_t(ldi)] = best_l;
+            }
+            else
+            {
+                D[i + j * size_t(ldd)]      = incumbent;
+                argmin[i + j * size_t(ldi)] = -1;
+            }
+        }
+    }
+}
+
+template <typename T>
+void testing_geam_min_plus_argmin_bad_arg(const Arguments& arg)
+{
+    auto rocblas_fn = rocblas_geam_min_plus_argmin_fn<T>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_int M = 100;
+        const rocblas_int N = 99;
+        const rocblas_int K = 98;
+
+        const rocblas_int lda = 100;
+        const rocblas_int ldb = 100;
+        const rocblas_int ldc = 100;
+        const rocblas_int ldd = 100;
+        const rocblas_int ldi = 100;
+
+        DEVICE_MEMCHECK(device_vector<T>, alpha_d, (1));
+        DEVICE_MEMCHECK(device_vector<T>, beta_d, (1));
+        DEVICE_MEMCHECK(device_vector<T>, zero_d, (1));
+
+        const T alpha_h(1), beta_h(2), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_operation transB = rocblas_operation_none;
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+        DEVICE_MEMCHECK(device_matrix<T>, dB, (K, N, ldb));
+        DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+        DEVICE_MEMCHECK(device_matrix<T>, dD, (M, N, ldd));
+        DEVICE_MEMCHECK(device_matrix<rocblas_int>, dI, (M, N, ldi));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(nullptr,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_handle);
+
+        // only none and transpose are accepted
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         rocblas_operation_conjugate_transpose,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         rocblas_operation_conjugate_transpose,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         (rocblas_operation)rocblas_fill_full,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_value);
+
+        // invalid sizes
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         -1,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         -1,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         -1,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        // leading dimensions must cover the operand heights (lda vs M for
+        // non-transposed A, ldb vs K for non-transposed B, ldc/ldd/ldi vs M)
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         M - 1,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         K - 1,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         M - 1,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         M - 1,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         M - 1),
+                              rocblas_status_invalid_size);
+
+        // in-place C == D requires matching leading dimensions
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dD,
+                                         ldc + 1,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_size);
+
+        // quick return with m == 0 or n == 0, all pointers may be null
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         0,
+                                         N,
+                                         K,
+                                         nullptr,
+                                         nullptr,
+                                         lda,
+                                         nullptr,
+                                         ldb,
+                                         nullptr,
+                                         nullptr,
+                                         ldc,
+                                         nullptr,
+                                         ldd,
+                                         nullptr,
+                                         ldi),
+                              rocblas_status_success);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         0,
+                                         K,
+                                         nullptr,
+                                         nullptr,
+                                         lda,
+                                         nullptr,
+                                         ldb,
+                                         nullptr,
+                                         nullptr,
+                                         ldc,
+                                         nullptr,
+                                         ldd,
+                                         nullptr,
+                                         ldi),
+                              rocblas_status_success);
+
+        // beta, D and argmin are always dereferenced (k == 0 still writes them)
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         nullptr,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         nullptr,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         nullptr,
+                                         ldi),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         nullptr,
+                                         dA,
+                                         lda,
+                                         dB,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             alpha,
+                                             nullptr,
+                                             lda,
+                                             dB,
+                                             ldb,
+                                             beta,
+                                             dC,
+                                             ldc,
+                                             dD,
+                                             ldd,
+                                             dI,
+                                             ldi),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             alpha,
+                                             dA,
+                                             lda,
+                                             nullptr,
+                                             ldb,
+                                             beta,
+                                             dC,
+                                             ldc,
+                                             dD,
+                                             ldd,
+                                             dI,
+                                             ldi),
+                                  rocblas_status_invalid_pointer);
+
+            // alpha == 0 then A and B may be nullptr
+            EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             zero,
+                                             nullptr,
+                                             lda,
+                                             nullptr,
+                                             ldb,
+                                             beta,
+                                             dC,
+                                             ldc,
+                                             dD,
+                                             ldd,
+                                             dI,
+                                             ldi),
+                                  rocblas_status_success);
+        }
+
+        // k == 0 then alpha, A and B may be nullptr; D and argmin are written
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         0,
+                                         nullptr,
+                                         nullptr,
+                                         lda,
+                                         nullptr,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         ldc,
+                                         dD,
+                                         ldd,
+                                         dI,
+                                         ldi),
+                              rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_geam_min_plus_argmin(const Arguments& arg)
+{
+    auto rocblas_fn = rocblas_geam_min_plus_argmin_fn<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+    // the argmin matrix shares the D leading dimension; Arguments has no
+    // dedicated field for ldi
+    rocblas_int ldi = arg.ldd;
+
+    T alpha = arg.get_alpha<T>();
+    T beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = std::numeric_limits<double>::max();
+    double rocblas_error_2 = std::numeric_limits<double>::max();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         nullptr,
+                                         nullptr,
+                                         lda,
+                                         nullptr,
+                                         ldb,
+                                         nullptr,
+                                         nullptr,
+                                         ldc,
+                                         nullptr,
+                                         ldd,
+                                         nullptr,
+                                         ldi),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    HOST_MEMCHECK(host_matrix<T>, hA, (A_row, A_col, lda));
+    HOST_MEMCHECK(host_matrix<T>, hB, (B_row, B_col, ldb));
+    HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+    HOST_MEMCHECK(host_matrix<T>, hD_1, (M, N, ldd));
+    HOST_MEMCHECK(host_matrix<T>, hD_2, (M, N, ldd));
+    HOST_MEMCHECK(host_matrix<T>, hD_gold, (M, N, ldd));
+    HOST_MEMCHECK(host_matrix<rocblas_int>, hI_1, (M, N, ldi));
+    HOST_MEMCHECK(host_matrix<rocblas_int>, hI_2, (M, N, ldi));
+    HOST_MEMCHECK(host_matrix<rocblas_int>, hI_gold, (M, N, ldi));
+    HOST_MEMCHECK(host_vector<T>, h_alpha, (1));
+    HOST_MEMCHECK(host_vector<T>, h_beta, (1));
+
+    h_alpha[0] = alpha;
+    h_beta[0]  = beta;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (A_row, A_col, lda));
+    DEVICE_MEMCHECK(device_matrix<T>, dB, (B_row, B_col, ldb));
+    DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+    DEVICE_MEMCHECK(device_matrix<T>, dD, (M, N, ldd));
+    DEVICE_MEMCHECK(device_matrix<rocblas_int>, dI, (M, N, ldi));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<T>, d_beta, (1));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hD_1, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+
+    // a sentinel no kernel path writes, so stale entries are caught
+    for(size_t i = 0; i < hI_1.size(); i++)
+        hI_1[0][i] = -2;
+
+    hD_2    = hD_1;
+    hD_gold = hD_1;
+    hI_2    = hI_1;
+    hI_gold = hI_1;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dD.transfer_from(hD_1));
+    CHECK_HIP_ERROR(dI.transfer_from(hI_1));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_fn(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           &alpha,
+                                           dA,
+                                           lda,
+                                           dB,
+                                           ldb,
+                                           &beta,
+                                           dC,
+                                           ldc,
+                                           dD,
+                                           ldd,
+                                           dI,
+                                           ldi));
+            handle.post_test(arg);
+            CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+            CHECK_HIP_ERROR(hI_1.transfer_from(dI));
+            CHECK_HIP_ERROR(dD.transfer_from(hD_2));
+            CHECK_HIP_ERROR(dI.transfer_from(hI_2));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(rocblas_fn(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           d_alpha,
+                                           dA,
+                                           lda,
+                                           dB,
+                                           ldb,
+                                           d_beta,
+                                           dC,
+                                           ldc,
+                                           dD,
+                                           ldd,
+                                           dI,
+                                           ldi));
+
+            CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+            CHECK_HIP_ERROR(hI_2.transfer_from(dI));
+        }
+
+        // reference calculation for golden result
+        cpu_time_used = get_time_us_no_sync();
+
+        ref_geam_min_plus_argmin<T>(transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    h_alpha[0],
+                                    (T*)hA,
+                                    lda,
+                                    (T*)hB,
+                                    ldb,
+                                    h_beta[0],
+                                    (T*)hC,
+                                    ldc,
+                                    (T*)hD_gold,
+                                    ldd,
+                                    (rocblas_int*)hI_gold,
+                                    ldi);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // the reference applies the same comparison rules in the same order,
+        // so values and indices match exactly
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(M, N, ldd, hD_gold, hD_1);
+                unit_check_general<rocblas_int>(M, N, ldi, hI_gold, hI_1);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1 = norm_check_general<T>('F', M, N, ldd, (T*)hD_gold, (T*)hD_1);
+            }
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(M, N, ldd, hD_gold, hD_2);
+                unit_check_general<rocblas_int>(M, N, ldi, hI_gold, hI_2);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_2 = norm_check_general<T>('F', M, N, ldd, (T*)hD_gold, (T*)hD_2);
+            }
+        }
+    } // end of if unit/norm check
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            rocblas_fn(handle,
+                       transA,
+                       transB,
+                       M,
+                       N,
+                       K,
+                       &alpha,
+                       dA,
+                       lda,
+                       dB,
+                       ldb,
+                       &beta,
+                       dC,
+                       ldc,
+                       dD,
+                       ldd,
+                       dI,
+                       ldi);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_fn(handle,
+                       transA,
+                       transB,
+                       M,
+                       N,
+                       K,
+                       &alpha,
+                       dA,
+                       lda,
+                       dB,
+                       ldb,
+                       &beta,
+                       dC,
+                       ldc,
+                       dD,
+                       ldd,
+                       dI,
+                       ldi);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_ldb,
+                      e_beta,
+                      e_ldc,
+                      e_ldd>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         geam_min_plus_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,670 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// gemm_batched_ex_scaled is a beta API without Fortran or ILP64 bindings; the
+// C entry point is called directly. alpha and beta are device arrays of
+// batch_count scalars, so there is no host pointer mode variant.
+
+template <typename T>
+void testing_gemm_batched_ex_scaled_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 99;
+    const rocblas_int K = 98;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const rocblas_int batch_count = 2;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    const int32_t           solution_index = 0;
+    const uint32_t          flags          = 0;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dA, (M, K, lda, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dB, (K, N, ldb, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dC, (M, N, ldc, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dD, (M, N, ldd, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_beta, (batch_count));
+
+#define EX_SCALED_ARGS(handle_, trans_a_, trans_b_, m_, n_, k_, alpha_, a_, lda_, b_, ldb_, \
+                       beta_, c_, ldc_, d_, ldd_, batch_count_)                             \
+    handle_, trans_a_, trans_b_, m_, n_, k_, alpha_, a_, type, lda_, b_, type, ldb_, beta_, \
+        c_, type, ldc_, d_, type, ldd_, batch_count_, type, algo, solution_index, flags
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(nullptr,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                      (rocblas_operation)rocblas_fill_full,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      d_alpha,
+                                                      dA.ptr_on_device(),
+                                                      lda,
+                                                      dB.ptr_on_device(),
+                                                      ldb,
+                                                      d_beta,
+                                                      dC.ptr_on_device(),
+                                                      ldc,
+                                                      dD.ptr_on_device(),
+                                                      ldd,
+                                                      batch_count)),
+        rocblas_status_invalid_value);
+
+    // invalid sizes
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        -1,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        -1)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        M - 1,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        K - 1,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        M - 1,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        M - 1,
+                                                                        batch_count)),
+                          rocblas_status_invalid_size);
+
+    // quick return with m == 0, n == 0 or batch_count == 0, all pointers may be null
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        0,
+                                                                        N,
+                                                                        K,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        ldb,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        ldc,
+                                                                        nullptr,
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        ldb,
+                                                                        nullptr,
+                                                                        nullptr,
+                                                                        ldc,
+                                                                        nullptr,
+                                                                        ldd,
+                                                                        0)),
+                          rocblas_status_success);
+
+    // the scalar arrays live on the device, so they are always required
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        nullptr,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        nullptr,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        nullptr,
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        nullptr,
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dA.ptr_on_device(),
+                                                                        lda,
+                                                                        dB.ptr_on_device(),
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        nullptr,
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    // k == 0 then a and b may be nullptr
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(EX_SCALED_ARGS(handle,
+                                                                        transA,
+                                                                        transB,
+                                                                        M,
+                                                                        N,
+                                                                        0,
+                                                                        d_alpha,
+                                                                        nullptr,
+                                                                        lda,
+                                                                        nullptr,
+                                                                        ldb,
+                                                                        d_beta,
+                                                                        dC.ptr_on_device(),
+                                                                        ldc,
+                                                                        dD.ptr_on_device(),
+                                                                        ldd,
+                                                                        batch_count)),
+                          rocblas_status_success);
+
+#undef EX_SCALED_ARGS
+}
+
+template <typename T>
+void testing_gemm_batched_ex_scaled(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    rocblas_int batch_count = arg.batch_count;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index = arg.solution_index;
+    uint32_t          flags          = arg.flags;
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = std::numeric_limits<double>::max();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < A_row || ldb < B_row
+                        || ldc < M || ldd < M;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_scaled(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             lda,
+                                                             nullptr,
+                                                             type,
+                                                             ldb,
+                                                             nullptr,
+                                                             nullptr,
+                                                             type,
+                                                             ldc,
+                                                             nullptr,
+                                                             type,
+                                                             ldd,
+                                                             batch_count,
+                                                             type,
+                                                             algo,
+                                                             solution_index,
+                                                             flags),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    HOST_MEMCHECK(host_batch_matrix<T>, hA, (A_row, A_col, lda, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hB, (B_row, B_col, ldb, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hC, (M, N, ldc, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hD, (M, N, ldd, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hD_gold, (M, N, ldd, batch_count));
+    HOST_MEMCHECK(host_vector<T>, h_alpha, (batch_count));
+    HOST_MEMCHECK(host_vector<T>, h_beta, (batch_count));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dA, (A_row, A_col, lda, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dB, (B_row, B_col, ldb, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dC, (M, N, ldc, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dD, (M, N, ldd, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_beta, (batch_count));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // vary the scalars per batch so the test catches an epilogue reading a
+    // single value; every other beta is zero to cover the C bypass branch
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        h_alpha[b] = arg.get_alpha<T>() + T(b % 3);
+        h_beta[b]  = b % 2 ? arg.get_beta<T>() : T(0);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_batched_ex_scaled(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           d_alpha,
+                                                           dA.ptr_on_device(),
+                                                           type,
+                                                           lda,
+                                                           dB.ptr_on_device(),
+                                                           type,
+                                                           ldb,
+                                                           d_beta,
+                                                           dC.ptr_on_device(),
+                                                           type,
+                                                           ldc,
+                                                           dD.ptr_on_device(),
+                                                           type,
+                                                           ldd,
+                                                           batch_count,
+                                                           type,
+                                                           algo,
+                                                           solution_index,
+                                                           flags));
+        handle.post_test(arg);
+
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+        // reference: D_i = alpha[i] * op(A_i) * op(B_i) + beta[i] * C_i
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                    hD_gold[b][i + j * size_t(ldd)] = hC[b][i + j * size_t(ldc)];
+
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha[b],
+                        hA[b],
+                        lda,
+                        hB[b],
+                        ldb,
+                        h_beta[b],
+                        hD_gold[b],
+                        ldd);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            if(reduction_requires_near<T>(arg, K))
+            {
+                const double tol = K * sum_error_tolerance<T>;
+                near_check_general<T>(M, N, ldd, hD_gold, hD, batch_count, tol);
+            }
+            else
+            {
+                unit_check_general<T>(M, N, ldd, hD_gold, hD, batch_count);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', M, N, ldd, hD_gold, hD, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            rocblas_gemm_batched_ex_scaled(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           d_alpha,
+                                           dA.ptr_on_device(),
+                                           type,
+                                           lda,
+                                           dB.ptr_on_device(),
+                                           type,
+                                           ldb,
+                                           d_beta,
+                                           dC.ptr_on_device(),
+                                           type,
+                                           ldc,
+                                           dD.ptr_on_device(),
+                                           type,
+                                           ldd,
+                                           batch_count,
+                                           type,
+                                           algo,
+                                           solution_index,
+                                           flags);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_gemm_batched_ex_scaled(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           d_alpha,
+                                           dA.ptr_on_device(),
+                                           type,
+                                           lda,
+                                           dB.ptr_on_device(),
+                                           type,
+                                           ldb,
+                                           d_beta,
+                                           dC.ptr_on_device(),
+                                           type,
+                                           ldc,
+                                           dD.ptr_on_device(),
+                                           type,
+                                           ldd,
+                                           batch_count,
+                                           type,
+                                           algo,
+                                           solution_index,
+                                           flags);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_lda,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K) * batch_count,
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
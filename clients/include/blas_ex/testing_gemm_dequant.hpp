@@ -0,0 +1,420 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// T is the output type; the inputs are always int8 and the accumulator i32
+
+template <typename T>
+void testing_gemm_dequant_bad_arg(const Arguments& arg)
+{
+    // gemm_dequant is a beta API without Fortran or ILP64 bindings; call the
+    // C entry point directly
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        rocblas_set_pointer_mode(handle, pointer_mode);
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_operation transB = rocblas_operation_none;
+
+        const rocblas_int M = 16;
+        const rocblas_int N = 16;
+        const rocblas_int K = 16;
+
+        const rocblas_int lda = 16;
+        const rocblas_int ldb = 16;
+        const rocblas_int ldd = 16;
+
+        const rocblas_datatype d_type = rocblas_type2datatype<T>();
+
+        DEVICE_MEMCHECK(device_vector<float>, alpha_d, (1));
+        DEVICE_MEMCHECK(device_vector<float>, beta_d, (1));
+
+        const float alpha_h = 1.0f, beta_h = 0.0f;
+
+        const float* alpha = &alpha_h;
+        const float* beta  = &beta_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+        }
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_matrix<int8_t>, dA, (M, K, lda));
+        DEVICE_MEMCHECK(device_matrix<int8_t>, dB, (K, N, ldb));
+        DEVICE_MEMCHECK(device_matrix<T>, dD, (M, N, ldd));
+        DEVICE_MEMCHECK(device_vector<float>, dscale, (M));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dequant(nullptr,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   dscale,
+                                                   beta,
+                                                   dD,
+                                                   d_type,
+                                                   ldd),
+                              rocblas_status_invalid_handle);
+
+        // only f16/bf16/f32 outputs are served
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dequant(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   alpha,
+                                                   dA,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   dscale,
+                                                   beta,
+                                                   dD,
+                                                   rocblas_datatype_f64_r,
+                                                   ldd),
+                              rocblas_status_not_implemented);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, -1, N, K, alpha, dA, lda, dB, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, -1, K, alpha, dA, lda, dB, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, -1, alpha, dA, lda, dB, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, dA, M - 1, dB, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, dA, lda, dB, K - 1, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, dscale, beta, dD, d_type, M - 1),
+            rocblas_status_invalid_size);
+
+        // quick return: no work, so null pointers are permitted
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(handle,
+                                 transA,
+                                 transB,
+                                 0,
+                                 N,
+                                 K,
+                                 nullptr,
+                                 nullptr,
+                                 lda,
+                                 nullptr,
+                                 ldb,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 d_type,
+                                 ldd),
+            rocblas_status_success);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, nullptr, dA, lda, dB, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, dscale, nullptr, dD, d_type, ldd),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, nullptr, beta, dD, d_type, ldd),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, dscale, beta, nullptr, d_type, ldd),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, K, alpha, nullptr, lda, dB, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_invalid_pointer);
+
+        // k == 0 does not read a or b
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_dequant(
+                handle, transA, transB, M, N, 0, alpha, nullptr, lda, nullptr, ldb, dscale, beta, dD, d_type, ldd),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_gemm_dequant(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    auto transA = char2rocblas_operation(arg.transA);
+    auto transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldd = arg.ldd;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    const rocblas_datatype d_type = rocblas_type2datatype<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    if(M == 0 || N == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_dequant(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   nullptr,
+                                                   d_type,
+                                                   ldd),
+                              rocblas_status_success);
+        return;
+    }
+
+    // Allocate host memory
+    HOST_MEMCHECK(host_matrix<int8_t>, hA, (A_row, A_col, lda));
+    HOST_MEMCHECK(host_matrix<int8_t>, hB, (B_row, B_col, ldb));
+    HOST_MEMCHECK(host_matrix<T>, hD, (M, N, ldd));
+    HOST_MEMCHECK(host_matrix<T>, hD_gold, (M, N, ldd));
+    HOST_MEMCHECK(host_matrix<T>, hD_1, (M, N, ldd));
+    HOST_MEMCHECK(host_vector<float>, hscale, (M));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<int8_t>, dA, (A_row, A_col, lda));
+    DEVICE_MEMCHECK(device_matrix<int8_t>, dB, (B_row, B_col, ldb));
+    DEVICE_MEMCHECK(device_matrix<T>, dD, (M, N, ldd));
+    DEVICE_MEMCHECK(device_vector<float>, dscale, (M));
+    DEVICE_MEMCHECK(device_vector<float>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<float>, d_beta, (1));
+
+    // Initialize data on host memory. The yaml drives this suite with
+    // rand_int_zero_one data, and the scales are powers of two, so every
+    // output value is exactly representable even in half precision.
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hD, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    for(rocblas_int r = 0; r < M; r++)
+        hscale[r] = r % 3 == 0 ? 0.5f : r % 3 == 1 ? 1.0f : 2.0f;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dscale.transfer_from(hscale));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU reference: i32 accumulation followed by the per-row dequantize
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int c = 0; c < N; c++)
+            for(rocblas_int r = 0; r < M; r++)
+            {
+                int32_t acc = 0;
+                for(rocblas_int l = 0; l < K; l++)
+                {
+                    int8_t a_v = transA == rocblas_operation_none ? hA[0][size_t(l) * lda + r]
+                                                                  : hA[0][size_t(r) * lda + l];
+                    int8_t b_v = transB == rocblas_operation_none ? hB[0][size_t(c) * ldb + l]
+                                                                  : hB[0][size_t(l) * ldb + c];
+                    acc += int32_t(a_v) * int32_t(b_v);
+                }
+                float v = h_alpha * hscale[r] * float(acc);
+                if(h_beta != 0)
+                    v += h_beta * float(hD[0][size_t(c) * ldd + r]);
+                hD_gold[0][size_t(c) * ldd + r] = T(v);
+            }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // ROCBLAS rocblas_pointer_mode_host
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_dequant(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &h_alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 dscale,
+                                                 &h_beta,
+                                                 dD,
+                                                 d_type,
+                                                 ldd));
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+        // the reference rounds at the same single point as the kernel, so
+        // the comparison is exact
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldd, hD_gold, hD_1);
+
+        double rocblas_error = 0.0;
+        if(arg.norm_check)
+            rocblas_error = std::abs(norm_check_general<T>('F', M, N, ldd, hD_gold, hD_1));
+
+        // ROCBLAS rocblas_pointer_mode_device
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_dequant(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 d_alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 dscale,
+                                                 d_beta,
+                                                 dD,
+                                                 d_type,
+                                                 ldd));
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldd, hD_gold, hD_1);
+
+        if(arg.norm_check)
+            rocblas_error = std::abs(norm_check_general<T>('F', M, N, ldd, hD_gold, hD_1));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_dequant(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA,
+                                                     lda,
+                                                     dB,
+                                                     ldb,
+                                                     dscale,
+                                                     &h_beta,
+                                                     dD,
+                                                     d_type,
+                                                     ldd));
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_dequant(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA,
+                                                     lda,
+                                                     dB,
+                                                     ldb,
+                                                     dscale,
+                                                     &h_beta,
+                                                     dD,
+                                                     d_type,
+                                                     ldd));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldd>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used);
+    }
+}
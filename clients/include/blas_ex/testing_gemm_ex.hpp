@@ -23,6 +23,7 @@
 #pragma once
 
 #include "frequency_monitor.hpp"
+#include "latency_monitor.hpp"
 #include "testing_common.hpp"
 
 /* ============================================================================================ */
@@ -641,32 +642,75 @@ void testing_gemm_ex(const Arguments& arg)
 
         FrequencyMonitor& freq_monitor = getFrequencyMonitor();
         freq_monitor.start();
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int i = 0; i < number_hot_calls; i++)
+
+#if HIP_VERSION >= 50500000
+        if(arg.graph_test)
         {
-            int flush_index = (i + 1) % flush_batch_count;
+            // capture the call once, then time replays of the instantiated graph
+            // so launch-bound kernels are measured the way graph clients run
+            // them. flush_batch_count cycling does not apply since every replay
+            // reuses the captured buffers.
+            handle.pre_test(arg);
             // clang-format off
-            if(arg.outofplace)
-            {
-                DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
-                                   dA[flush_index], arg.a_type, lda,
-                                   dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
-                                   dC[flush_index], arg.c_type, ldc,
-                                   dD[          0],     d_type, ldd,
-                                   arg.compute_type, algo, solution_index, flags));
-            }
-            else
+            DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
+                                                   dA[0], arg.a_type, lda,
+                                                   dB[0], arg.b_type, ldb, &h_beta_Tc,
+                                                   dC[0], arg.c_type, ldc,
+                                                   dD[0],     d_type, ldd,
+                                                   arg.compute_type, algo, solution_index, flags));
+            // clang-format on
+            hipGraphExec_t graph_instance = handle.rocblas_stream_end_capture_instantiate();
+            hipStream_t    graph_stream   = handle.graph_stream();
+
+            gpu_time_used = get_time_us_sync(graph_stream); // in microseconds
+            for(int i = 0; i < number_hot_calls; i++)
+                CHECK_HIP_ERROR(hipGraphLaunch(graph_instance, graph_stream));
+            gpu_time_used = get_time_us_sync(graph_stream) - gpu_time_used;
+
+            handle.rocblas_graph_replay_cleanup(graph_instance);
+        }
+        else
+#endif
+        {
+            LatencyMonitor& latency_monitor = getLatencyMonitor();
+            bool            per_iter_timing = latency_monitor.enabled();
+            latency_monitor.start();
+
+            gpu_time_used = get_time_us_sync(stream); // in microseconds
+            for(int i = 0; i < number_hot_calls; i++)
             {
-                DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
-                                   dA[flush_index], arg.a_type, lda,
-                                   dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
-                                   dC[flush_index], arg.c_type, ldc,
-                                   dD[flush_index],     d_type, ldd,
-                                   arg.compute_type, algo, solution_index, flags));
+                int flush_index = (i + 1) % flush_batch_count;
+
+                double iter_start = 0.0;
+                if(per_iter_timing)
+                    iter_start = get_time_us_sync(stream);
+
+                // clang-format off
+                if(arg.outofplace)
+                {
+                    DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
+                                       dA[flush_index], arg.a_type, lda,
+                                       dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
+                                       dC[flush_index], arg.c_type, ldc,
+                                       dD[          0],     d_type, ldd,
+                                       arg.compute_type, algo, solution_index, flags));
+                }
+                else
+                {
+                    DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
+                                       dA[flush_index], arg.a_type, lda,
+                                       dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
+                                       dC[flush_index], arg.c_type, ldc,
+                                       dD[flush_index],     d_type, ldd,
+                                       arg.compute_type, algo, solution_index, flags));
+                }
+                // clang-format on
+
+                if(per_iter_timing)
+                    latency_monitor.record(get_time_us_sync(stream) - iter_start);
             }
-            // clang-format on
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         freq_monitor.stop();
 
         ArgumentModel<e_transA,
@@ -0,0 +1,882 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// gemm_ex_epilogue and gemm_batched_ex_epilogue are beta APIs without Fortran
+// or ILP64 bindings; the C entry points are called directly. Each testing
+// function sweeps all (epilogue, bias) combinations so one yaml row covers
+// the whole fusion matrix.
+
+// Host replica of the fused epilogue: v = act(v + bias), with the activation
+// evaluated in float (double for double compute) exactly as on the device
+template <typename T>
+static T gemm_ex_epilogue_ref(T v, const T* bias_v, rocblas_gemm_epilogue epilogue)
+{
+    using Tact = std::conditional_t<std::is_same_v<T, double>, double, float>;
+
+    Tact x = Tact(v);
+    if(bias_v)
+        x += Tact(*bias_v);
+
+    if(epilogue == rocblas_gemm_epilogue_relu)
+    {
+        x = x > Tact(0) ? x : Tact(0);
+    }
+    else if(epilogue == rocblas_gemm_epilogue_gelu)
+    {
+        // tanh approximation of gelu
+        x = Tact(0.5) * x
+            * (Tact(1)
+               + std::tanh(Tact(0.7978845608028654) * (x + Tact(0.044715) * x * x * x)));
+    }
+
+    return T(x);
+}
+
+template <typename T>
+void testing_gemm_ex_epilogue_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 99;
+    const rocblas_int K = 98;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    const int32_t           solution_index = 0;
+    const uint32_t          flags          = 0;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const T alpha_h(1), beta_h(2);
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+    DEVICE_MEMCHECK(device_matrix<T>, dB, (K, N, ldb));
+    DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+    DEVICE_MEMCHECK(device_matrix<T>, dD, (M, N, ldd));
+    DEVICE_MEMCHECK(device_vector<T>, dbias, (M));
+
+#define EPILOGUE_ARGS(handle_, m_, n_, k_, alpha_, a_, lda_, b_, ldb_, beta_, c_, ldc_, d_, \
+                      ldd_, bias_, epilogue_)                                               \
+    handle_, transA, transB, m_, n_, k_, alpha_, a_, type, lda_, b_, type, ldb_, beta_, c_, \
+        type, ldc_, d_, type, ldd_, type, algo, solution_index, flags, bias_, epilogue_
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(nullptr,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 dA,
+                                                                 lda,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 dD,
+                                                                 ldd,
+                                                                 dbias,
+                                                                 rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_handle);
+
+    // epilogue enum out of range
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 dA,
+                                                                 lda,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 dD,
+                                                                 ldd,
+                                                                 dbias,
+                                                                 (rocblas_gemm_epilogue)999)),
+                          rocblas_status_invalid_value);
+
+    // invalid sizes
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 -1,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 dA,
+                                                                 lda,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 dD,
+                                                                 ldd,
+                                                                 dbias,
+                                                                 rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 dA,
+                                                                 M - 1,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 dD,
+                                                                 ldd,
+                                                                 dbias,
+                                                                 rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_size);
+
+    // quick return with m == 0, matrix pointers may be null
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 0,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 nullptr,
+                                                                 lda,
+                                                                 nullptr,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 nullptr,
+                                                                 ldc,
+                                                                 nullptr,
+                                                                 ldd,
+                                                                 nullptr,
+                                                                 rocblas_gemm_epilogue_relu)),
+                          rocblas_status_success);
+
+    // the gemm_ex pointer rules apply unchanged
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 nullptr,
+                                                                 dA,
+                                                                 lda,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 dD,
+                                                                 ldd,
+                                                                 dbias,
+                                                                 rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 dA,
+                                                                 lda,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 nullptr,
+                                                                 ldd,
+                                                                 dbias,
+                                                                 rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_pointer);
+
+    // a null bias with no activation degenerates to a plain gemm
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(EPILOGUE_ARGS(handle,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha_h,
+                                                                 dA,
+                                                                 lda,
+                                                                 dB,
+                                                                 ldb,
+                                                                 &beta_h,
+                                                                 dC,
+                                                                 ldc,
+                                                                 dD,
+                                                                 ldd,
+                                                                 nullptr,
+                                                                 rocblas_gemm_epilogue_none)),
+                          rocblas_status_success);
+
+#undef EPILOGUE_ARGS
+}
+
+template <typename T>
+void testing_gemm_ex_epilogue(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index = arg.solution_index;
+    uint32_t          flags          = arg.flags;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = std::numeric_limits<double>::max();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_epilogue(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       nullptr,
+                                                       type,
+                                                       lda,
+                                                       nullptr,
+                                                       type,
+                                                       ldb,
+                                                       nullptr,
+                                                       nullptr,
+                                                       type,
+                                                       ldc,
+                                                       nullptr,
+                                                       type,
+                                                       ldd,
+                                                       type,
+                                                       algo,
+                                                       solution_index,
+                                                       flags,
+                                                       nullptr,
+                                                       rocblas_gemm_epilogue_none),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    HOST_MEMCHECK(host_matrix<T>, hA, (A_row, A_col, lda));
+    HOST_MEMCHECK(host_matrix<T>, hB, (B_row, B_col, ldb));
+    HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+    HOST_MEMCHECK(host_matrix<T>, hD, (M, N, ldd));
+    HOST_MEMCHECK(host_matrix<T>, hD_gold, (M, N, ldd));
+    HOST_MEMCHECK(host_vector<T>, hbias, (M));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (A_row, A_col, lda));
+    DEVICE_MEMCHECK(device_matrix<T>, dB, (B_row, B_col, ldb));
+    DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+    DEVICE_MEMCHECK(device_matrix<T>, dD, (M, N, ldd));
+    DEVICE_MEMCHECK(device_vector<T>, dbias, (M));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // small signed integers keep the bias and relu paths exact
+    for(rocblas_int i = 0; i < M; i++)
+        hbias[i] = T((i % 7) - 3);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto epilogue : {rocblas_gemm_epilogue_none,
+                             rocblas_gemm_epilogue_relu,
+                             rocblas_gemm_epilogue_gelu})
+        {
+            for(bool use_bias : {false, true})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_epilogue(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             &h_alpha,
+                                                             dA,
+                                                             type,
+                                                             lda,
+                                                             dB,
+                                                             type,
+                                                             ldb,
+                                                             &h_beta,
+                                                             dC,
+                                                             type,
+                                                             ldc,
+                                                             dD,
+                                                             type,
+                                                             ldd,
+                                                             type,
+                                                             algo,
+                                                             solution_index,
+                                                             flags,
+                                                             use_bias ? (const T*)dbias : nullptr,
+                                                             epilogue));
+
+                CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+                // reference: D = act(alpha * op(A) * op(B) + beta * C + bias)
+                cpu_time_used = get_time_us_no_sync();
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                        hD_gold[0][i + j * size_t(ldd)] = hC[0][i + j * size_t(ldc)];
+
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            (T*)hA,
+                            lda,
+                            (T*)hB,
+                            ldb,
+                            h_beta,
+                            (T*)hD_gold,
+                            ldd);
+
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                        hD_gold[0][i + j * size_t(ldd)]
+                            = gemm_ex_epilogue_ref<T>(hD_gold[0][i + j * size_t(ldd)],
+                                                      use_bias ? &hbias[i] : nullptr,
+                                                      epilogue);
+                cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+                if(arg.unit_check)
+                {
+                    if(epilogue == rocblas_gemm_epilogue_gelu || reduction_requires_near<T>(arg, K))
+                    {
+                        // the device tanh may differ from the host one by a few ulp
+                        const double tol = (K + 10) * sum_error_tolerance<T>;
+                        near_check_general<T>(M, N, ldd, hD_gold, hD, tol);
+                    }
+                    else
+                    {
+                        unit_check_general<T>(M, N, ldd, hD_gold, hD);
+                    }
+                }
+
+                if(arg.norm_check)
+                {
+                    double err = norm_check_general<T>('F', M, N, ldd, (T*)hD_gold, (T*)hD);
+                    rocblas_error
+                        = rocblas_error == std::numeric_limits<double>::max() || err > rocblas_error
+                              ? err
+                              : rocblas_error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            rocblas_gemm_ex_epilogue(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &h_alpha,
+                                     dA,
+                                     type,
+                                     lda,
+                                     dB,
+                                     type,
+                                     ldb,
+                                     &h_beta,
+                                     dC,
+                                     type,
+                                     ldc,
+                                     dD,
+                                     type,
+                                     ldd,
+                                     type,
+                                     algo,
+                                     solution_index,
+                                     flags,
+                                     dbias,
+                                     rocblas_gemm_epilogue_relu);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_gemm_ex_epilogue(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &h_alpha,
+                                     dA,
+                                     type,
+                                     lda,
+                                     dB,
+                                     type,
+                                     ldb,
+                                     &h_beta,
+                                     dC,
+                                     type,
+                                     ldc,
+                                     dD,
+                                     type,
+                                     ldd,
+                                     type,
+                                     algo,
+                                     solution_index,
+                                     flags,
+                                     dbias,
+                                     rocblas_gemm_epilogue_relu);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc, e_ldd>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
+
+template <typename T>
+void testing_gemm_batched_ex_epilogue_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 99;
+    const rocblas_int K = 98;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const rocblas_int    batch_count = 2;
+    const rocblas_stride bias_stride = M;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    const int32_t           solution_index = 0;
+    const uint32_t          flags          = 0;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const T alpha_h(1), beta_h(2);
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dA, (M, K, lda, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dB, (K, N, ldb, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dC, (M, N, ldc, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dD, (M, N, ldd, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, dbias, (size_t(M) * batch_count));
+
+#define EPILOGUE_B_ARGS(handle_, batch_count_, bias_, epilogue_)                              \
+    handle_, transA, transB, M, N, K, &alpha_h, dA.ptr_on_device(), type, lda,                \
+        dB.ptr_on_device(), type, ldb, &beta_h, dC.ptr_on_device(), type, ldc,                \
+        dD.ptr_on_device(), type, ldd, batch_count_, type, algo, solution_index, flags,       \
+        bias_, bias_stride, epilogue_
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_epilogue(
+                              EPILOGUE_B_ARGS(nullptr, batch_count, dbias, rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_epilogue(
+                              EPILOGUE_B_ARGS(handle, batch_count, dbias, (rocblas_gemm_epilogue)999)),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_epilogue(
+                              EPILOGUE_B_ARGS(handle, -1, dbias, rocblas_gemm_epilogue_relu)),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_epilogue(
+                              EPILOGUE_B_ARGS(handle, 0, dbias, rocblas_gemm_epilogue_relu)),
+                          rocblas_status_success);
+
+#undef EPILOGUE_B_ARGS
+}
+
+template <typename T>
+void testing_gemm_batched_ex_epilogue(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    rocblas_int batch_count = arg.batch_count;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index = arg.solution_index;
+    uint32_t          flags          = arg.flags;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error = std::numeric_limits<double>::max();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < A_row || ldb < B_row
+                        || ldc < M || ldd < M;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_batched_ex_epilogue(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               nullptr,
+                                                               nullptr,
+                                                               type,
+                                                               lda,
+                                                               nullptr,
+                                                               type,
+                                                               ldb,
+                                                               nullptr,
+                                                               nullptr,
+                                                               type,
+                                                               ldc,
+                                                               nullptr,
+                                                               type,
+                                                               ldd,
+                                                               batch_count,
+                                                               type,
+                                                               algo,
+                                                               solution_index,
+                                                               flags,
+                                                               nullptr,
+                                                               0,
+                                                               rocblas_gemm_epilogue_none),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    const rocblas_stride bias_stride = M;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    HOST_MEMCHECK(host_batch_matrix<T>, hA, (A_row, A_col, lda, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hB, (B_row, B_col, ldb, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hC, (M, N, ldc, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hD, (M, N, ldd, batch_count));
+    HOST_MEMCHECK(host_batch_matrix<T>, hD_gold, (M, N, ldd, batch_count));
+    HOST_MEMCHECK(host_vector<T>, hbias, (size_t(M) * batch_count));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dA, (A_row, A_col, lda, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dB, (B_row, B_col, ldb, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dC, (M, N, ldc, batch_count));
+    DEVICE_MEMCHECK(device_batch_matrix<T>, dD, (M, N, ldd, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, dbias, (size_t(M) * batch_count));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    // small signed integers keep the bias and relu paths exact; the values
+    // differ per batch so a wrong bias_stride is caught
+    for(size_t i = 0; i < size_t(M) * batch_count; i++)
+        hbias[i] = T((i % 7) - 3);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dbias.transfer_from(hbias));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto epilogue : {rocblas_gemm_epilogue_none,
+                             rocblas_gemm_epilogue_relu,
+                             rocblas_gemm_epilogue_gelu})
+        {
+            for(bool use_bias : {false, true})
+            {
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_gemm_batched_ex_epilogue(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA.ptr_on_device(),
+                                                     type,
+                                                     lda,
+                                                     dB.ptr_on_device(),
+                                                     type,
+                                                     ldb,
+                                                     &h_beta,
+                                                     dC.ptr_on_device(),
+                                                     type,
+                                                     ldc,
+                                                     dD.ptr_on_device(),
+                                                     type,
+                                                     ldd,
+                                                     batch_count,
+                                                     type,
+                                                     algo,
+                                                     solution_index,
+                                                     flags,
+                                                     use_bias ? (const T*)dbias : nullptr,
+                                                     bias_stride,
+                                                     epilogue));
+
+                CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+                cpu_time_used = get_time_us_no_sync();
+                for(rocblas_int b = 0; b < batch_count; b++)
+                {
+                    for(rocblas_int j = 0; j < N; j++)
+                        for(rocblas_int i = 0; i < M; i++)
+                            hD_gold[b][i + j * size_t(ldd)] = hC[b][i + j * size_t(ldc)];
+
+                    ref_gemm<T>(transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                h_alpha,
+                                hA[b],
+                                lda,
+                                hB[b],
+                                ldb,
+                                h_beta,
+                                hD_gold[b],
+                                ldd);
+
+                    for(rocblas_int j = 0; j < N; j++)
+                        for(rocblas_int i = 0; i < M; i++)
+                            hD_gold[b][i + j * size_t(ldd)] = gemm_ex_epilogue_ref<T>(
+                                hD_gold[b][i + j * size_t(ldd)],
+                                use_bias ? &hbias[b * bias_stride + i] : nullptr,
+                                epilogue);
+                }
+                cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+                if(arg.unit_check)
+                {
+                    if(epilogue == rocblas_gemm_epilogue_gelu || reduction_requires_near<T>(arg, K))
+                    {
+                        // the device tanh may differ from the host one by a few ulp
+                        const double tol = (K + 10) * sum_error_tolerance<T>;
+                        near_check_general<T>(M, N, ldd, hD_gold, hD, batch_count, tol);
+                    }
+                    else
+                    {
+                        unit_check_general<T>(M, N, ldd, hD_gold, hD, batch_count);
+                    }
+                }
+
+                if(arg.norm_check)
+                {
+                    double err
+                        = norm_check_general<T>('F', M, N, ldd, hD_gold, hD, batch_count);
+                    rocblas_error
+                        = rocblas_error == std::numeric_limits<double>::max() || err > rocblas_error
+                              ? err
+                              : rocblas_error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            rocblas_gemm_batched_ex_epilogue(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             &h_alpha,
+                                             dA.ptr_on_device(),
+                                             type,
+                                             lda,
+                                             dB.ptr_on_device(),
+                                             type,
+                                             ldb,
+                                             &h_beta,
+                                             dC.ptr_on_device(),
+                                             type,
+                                             ldc,
+                                             dD.ptr_on_device(),
+                                             type,
+                                             ldd,
+                                             batch_count,
+                                             type,
+                                             algo,
+                                             solution_index,
+                                             flags,
+                                             dbias,
+                                             bias_stride,
+                                             rocblas_gemm_epilogue_relu);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_gemm_batched_ex_epilogue(handle,
+                                             transA,
+                                             transB,
+                                             M,
+                                             N,
+                                             K,
+                                             &h_alpha,
+                                             dA.ptr_on_device(),
+                                             type,
+                                             lda,
+                                             dB.ptr_on_device(),
+                                             type,
+                                             ldb,
+                                             &h_beta,
+                                             dC.ptr_on_device(),
+                                             type,
+                                             ldc,
+                                             dD.ptr_on_device(),
+                                             type,
+                                             ldd,
+                                             batch_count,
+                                             type,
+                                             algo,
+                                             solution_index,
+                                             flags,
+                                             dbias,
+                                             bias_stride,
+                                             rocblas_gemm_epilogue_relu);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_ldb,
+                      e_beta,
+                      e_ldc,
+                      e_ldd,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K) * batch_count,
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
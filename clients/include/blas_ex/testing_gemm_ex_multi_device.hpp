@@ -0,0 +1,338 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// One handle per slice, spread round-robin over the visible devices so a
+// single-device machine still exercises the multi-handle path. Restores the
+// caller's device when destroyed.
+class rocblas_multi_device_handle_array
+{
+    std::vector<rocblas_handle> m_handles;
+    int                         m_saved_device = 0;
+
+public:
+    explicit rocblas_multi_device_handle_array(rocblas_int handle_count)
+    {
+        int device_count = 1;
+        CHECK_HIP_ERROR(hipGetDevice(&m_saved_device));
+        CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+
+        m_handles.resize(handle_count, nullptr);
+        for(rocblas_int i = 0; i < handle_count; i++)
+        {
+            CHECK_HIP_ERROR(hipSetDevice(i % device_count));
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&m_handles[i]));
+        }
+        CHECK_HIP_ERROR(hipSetDevice(m_saved_device));
+    }
+
+    ~rocblas_multi_device_handle_array()
+    {
+        for(rocblas_handle handle : m_handles)
+            if(handle)
+                rocblas_destroy_handle(handle);
+        hipSetDevice(m_saved_device);
+    }
+
+    rocblas_handle* data()
+    {
+        return m_handles.data();
+    }
+
+    rocblas_handle& operator[](rocblas_int i)
+    {
+        return m_handles[i];
+    }
+};
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_gemm_ex_multi_device_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_ex_multi_device_fn = rocblas_gemm_ex_multi_device;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    const int32_t           solution_index = 0;
+    const uint32_t          flags          = 0;
+
+    const rocblas_datatype ab_type      = rocblas_type2datatype<Ti>();
+    const rocblas_datatype cd_type      = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    constexpr rocblas_int handle_count = 2;
+
+    rocblas_multi_device_handle_array handles(handle_count);
+
+    const rocblas_int M   = 8;
+    const rocblas_int N   = 8;
+    const rocblas_int K   = 8;
+    const rocblas_int lda = 8;
+    const rocblas_int ldb = 8;
+    const rocblas_int ldc = 8;
+    const rocblas_int ldd = 8;
+
+    // alpha and beta are always read on the host
+    const Tc alpha = Tc(1);
+    const Tc beta  = Tc(0);
+
+    // all matrices live in host memory
+    HOST_MEMCHECK(host_vector<Ti>, hA, (size_t(lda) * K));
+    HOST_MEMCHECK(host_vector<Ti>, hB, (size_t(ldb) * N));
+    HOST_MEMCHECK(host_vector<To>, hC, (size_t(ldc) * N));
+    HOST_MEMCHECK(host_vector<To>, hD, (size_t(ldd) * N));
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(nullptr, handle_count, transA, transB,
+                          M, N, K, &alpha, hA, ab_type, lda, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), 0, transA, transB,
+                          M, N, K, &alpha, hA, ab_type, lda, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_handle);
+
+    // a null member of the handle array is caught up front
+    {
+        rocblas_handle null_member[handle_count] = {handles[0], nullptr};
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(null_member, handle_count, transA, transB,
+                              M, N, K, &alpha, hA, ab_type, lda, hB, ab_type, ldb, &beta,
+                              hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                              solution_index, flags),
+                              rocblas_status_invalid_handle);
+    }
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          -1, N, K, &alpha, hA, ab_type, lda, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          M, N, K, &alpha, hA, ab_type, M - 1, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_size);
+
+    // M == 0 or N == 0 returns success before the pointers are read
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          0, N, K, nullptr, nullptr, ab_type, lda, nullptr, ab_type, ldb, nullptr,
+                          nullptr, cd_type, ldc, nullptr, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          M, N, K, nullptr, hA, ab_type, lda, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          M, N, K, &alpha, nullptr, ab_type, lda, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          M, N, K, &alpha, hA, ab_type, lda, hB, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, nullptr, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_invalid_pointer);
+
+    // K == 0 skips the A and B pointer checks; D = beta * C is still computed
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count, transA, transB,
+                          M, N, 0, &alpha, nullptr, ab_type, lda, nullptr, ab_type, ldb, &beta,
+                          hC, cd_type, ldc, hD, cd_type, ldd, compute_type, algo,
+                          solution_index, flags),
+                          rocblas_status_success);
+    // clang-format on
+}
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_gemm_ex_multi_device(const Arguments& arg)
+{
+    auto rocblas_gemm_ex_multi_device_fn = rocblas_gemm_ex_multi_device;
+
+    rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index = arg.solution_index;
+    uint32_t          flags          = arg.flags;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+    rocblas_int ldd = arg.ldd;
+
+    // the handle count plays the role the batch count plays elsewhere
+    rocblas_int handle_count = arg.batch_count;
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    const rocblas_datatype ab_type      = arg.a_type;
+    const rocblas_datatype cd_type      = arg.c_type;
+    const rocblas_datatype compute_type = arg.compute_type;
+
+    if(handle_count < 1)
+    {
+        // clang-format off
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(nullptr, handle_count, transA, transB,
+                              M, N, K, nullptr, nullptr, ab_type, lda, nullptr, ab_type, ldb,
+                              nullptr, nullptr, cd_type, ldc, nullptr, cd_type, ldd,
+                              compute_type, algo, solution_index, flags),
+                              rocblas_status_invalid_handle);
+        // clang-format on
+        return;
+    }
+
+    rocblas_multi_device_handle_array handles(handle_count);
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(1, A_row)
+                        || ldb < std::max(1, B_row) || ldc < M || ldd < M;
+    if(invalid_size || !M || !N)
+    {
+        // clang-format off
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count,
+                              transA, transB, M, N, K, nullptr, nullptr, ab_type, lda,
+                              nullptr, ab_type, ldb, nullptr, nullptr, cd_type, ldc,
+                              nullptr, cd_type, ldd, compute_type, algo, solution_index, flags),
+                              invalid_size ? rocblas_status_invalid_size
+                                           : rocblas_status_success);
+        // clang-format on
+        return;
+    }
+
+    // CPU reference accumulates in float for 16-bit output types
+    using To_hpa = std::conditional_t<std::is_same_v<To, rocblas_bfloat16>, float, To>;
+
+    // Every matrix stays in host memory; the implementation stages its own
+    // device buffers and copies per handle
+    HOST_MEMCHECK(host_vector<Ti>, hA, (size_t(lda) * std::max(A_col, 1)));
+    HOST_MEMCHECK(host_vector<Ti>, hB, (size_t(ldb) * std::max(B_col, 1)));
+    HOST_MEMCHECK(host_vector<To>, hC, (size_t(ldc) * N));
+    HOST_MEMCHECK(host_vector<To>, hD, (size_t(ldd) * N));
+    HOST_MEMCHECK(host_vector<To_hpa>, hD_gold, (size_t(ldd) * N));
+
+    // Initialize data on host memory
+    rocblas_seedrand();
+    rocblas_init<Ti>(hA, std::max(A_row, 1), std::max(A_col, 1), lda);
+    rocblas_init<Ti>(hB, std::max(B_row, 1), std::max(B_col, 1), ldb);
+    rocblas_init<To>(hC, M, N, ldc);
+    rocblas_init_nan<To>(hD.data(), size_t(ldd) * N);
+
+    double cpu_time_used  = 0.0;
+    double rocblas_error  = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // clang-format off
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count,
+                            transA, transB, M, N, K, &h_alpha, hA, ab_type, lda,
+                            hB, ab_type, ldb, &h_beta, hC, cd_type, ldc,
+                            hD, cd_type, ldd, compute_type, algo, solution_index, flags));
+        // clang-format on
+
+        // CPU BLAS
+        for(size_t j = 0; j < N; j++)
+            for(size_t i = 0; i < M; i++)
+                hD_gold[j * ldd + i] = To_hpa(hC[j * ldc + i]);
+
+        cpu_time_used = get_time_us_no_sync();
+
+        ref_gemm<Ti, To_hpa, Tc>(
+            transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hD_gold, ldd);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            if((handles[0]->getArchMajor() == 11 || handles[0]->getArchMajor() == 12)
+               && (sizeof(Ti) == 2))
+            {
+                const double tol = K * sum_error_tolerance_for_gfx11<Tc, Ti, To>;
+                near_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD, tol);
+            }
+            else
+            {
+                unit_check_general<To, To_hpa>(M, N, ldd, hD_gold, hD);
+            }
+        }
+
+        if(arg.norm_check)
+            rocblas_error = std::abs(
+                norm_check_general<To>('F', M, N, ldd, (To_hpa*)hD_gold, (To*)hD));
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        // the call synchronizes every slice before returning
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_no_sync();
+
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_multi_device_fn(handles.data(), handle_count,
+                                transA, transB, M, N, K, &h_alpha, hA, ab_type, lda,
+                                hB, ab_type, ldb, &h_beta, hC, cd_type, ldc,
+                                hD, cd_type, ldd, compute_type, algo, solution_index, flags));
+            // clang-format on
+        }
+
+        gpu_time_used = get_time_us_no_sync() - gpu_time_used;
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_beta, e_batch_count>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<Tc>(M, N, K),
+                          ArgumentLogging::NA_value,
+                          cpu_time_used,
+                          rocblas_error,
+                          0.0);
+    }
+}
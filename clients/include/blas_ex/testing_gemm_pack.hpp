@@ -0,0 +1,307 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// Deterministic small-integer test values keep every computation in this
+// suite exact; complex types get a nonzero imaginary part so a dropped
+// conjugation in the pack kernel is actually observable
+template <typename T>
+inline T gemm_pack_test_value(size_t i)
+{
+    if constexpr(rocblas_is_complex<T>)
+        return T(double(int(i % 5) - 2), double(int(i / 5 % 5) - 2));
+    else
+        return T(double(int(i % 5) - 2));
+}
+
+template <typename T>
+void testing_gemm_pack_bad_arg(const Arguments& arg)
+{
+    // gemm_pack and gemm_pack_size are beta APIs without Fortran or ILP64
+    // bindings; call the C entry points directly
+    rocblas_local_handle handle{arg};
+
+    const rocblas_operation transA = rocblas_operation_none;
+
+    const rocblas_int M   = 16;
+    const rocblas_int N   = 16;
+    const rocblas_int K   = 16;
+    const rocblas_int lda = 16;
+
+    const rocblas_gemm_pack_operand operand = rocblas_gemm_pack_operand_a;
+    const rocblas_datatype          type    = rocblas_type2datatype<T>();
+
+    size_t size = 0;
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_size(nullptr, operand, transA, M, N, K, type, &size),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_size(handle, operand, transA, M, N, K, type, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_size(handle, operand, transA, -1, N, K, type, &size),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_size(handle, operand, transA, M, -1, K, type, &size),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_pack_size(handle, operand, transA, M, N, -1, type, &size),
+                          rocblas_status_invalid_size);
+
+    // f8 is not in the supported type list
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack_size(handle, operand, transA, M, N, K, rocblas_datatype_f8_r, &size),
+        rocblas_status_not_implemented);
+
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (M, K, lda));
+    DEVICE_MEMCHECK(device_vector<T>, dA_packed, (size_t(K) * M));
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(nullptr, operand, transA, M, N, K, type, dA, lda, dA_packed),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(handle, operand, transA, M, N, -1, type, dA, lda, dA_packed),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(
+            handle, operand, transA, M, N, K, rocblas_datatype_f8_r, dA, lda, dA_packed),
+        rocblas_status_not_implemented);
+
+    // lda must cover the operand as the caller stores it (M rows here)
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(handle, operand, transA, M, N, K, type, dA, M - 1, dA_packed),
+        rocblas_status_invalid_size);
+
+    // a zero-sized operand is a valid no-op even with null pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(handle, operand, transA, 0, N, K, type, nullptr, lda, nullptr),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(handle, operand, transA, M, N, 0, type, nullptr, lda, nullptr),
+        rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(handle, operand, transA, M, N, K, type, nullptr, lda, dA_packed),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_pack(handle, operand, transA, M, N, K, type, dA, lda, nullptr),
+        rocblas_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_gemm_pack(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    // lda/ldb describe the unpacked operands as the caller stores them
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = M > 0 ? M : 1;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_local_handle handle{arg};
+
+    bool invalid_size = M < 0 || N < 0 || K < 0;
+    if(invalid_size || !M || !N || !K)
+    {
+        size_t size = 0;
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_pack_size(
+                handle, rocblas_gemm_pack_operand_a, transA, M, N, K, type, &size),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        // a zero-dimension pack is a no-op and accepts null buffers
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_gemm_pack(
+                handle, rocblas_gemm_pack_operand_a, transA, M, N, K, type, nullptr, lda, nullptr),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // dimensions of A and B as stored, before any transpose
+    rocblas_int a_rows = transA == rocblas_operation_none ? M : K;
+    rocblas_int a_cols = transA == rocblas_operation_none ? K : M;
+    rocblas_int b_rows = transB == rocblas_operation_none ? K : N;
+    rocblas_int b_cols = transB == rocblas_operation_none ? N : K;
+
+    // Allocate host memory
+    HOST_MEMCHECK(host_matrix<T>, hA, (a_rows, a_cols, lda));
+    HOST_MEMCHECK(host_matrix<T>, hB, (b_rows, b_cols, ldb));
+    HOST_MEMCHECK(host_matrix<T>, hC, (M, N, ldc));
+    HOST_MEMCHECK(host_matrix<T>, hD, (M, N, ldc));
+    HOST_MEMCHECK(host_vector<T>, hA_packed, (size_t(K) * M));
+    HOST_MEMCHECK(host_vector<T>, hB_packed, (size_t(K) * N));
+    HOST_MEMCHECK(host_vector<T>, hA_packed_gold, (size_t(K) * M));
+    HOST_MEMCHECK(host_vector<T>, hB_packed_gold, (size_t(K) * N));
+
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[0][i] = gemm_pack_test_value<T>(i);
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[0][i] = gemm_pack_test_value<T>(i + 3);
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[0][i] = gemm_pack_test_value<T>(i + 7);
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (a_rows, a_cols, lda));
+    DEVICE_MEMCHECK(device_matrix<T>, dB, (b_rows, b_cols, ldb));
+    DEVICE_MEMCHECK(device_matrix<T>, dC, (M, N, ldc));
+    DEVICE_MEMCHECK(device_vector<T>, dA_packed, (size_t(K) * M));
+    DEVICE_MEMCHECK(device_vector<T>, dB_packed, (size_t(K) * N));
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    // pack_size reports the tight k x m / k x n footprint
+    size_t size_a = 0, size_b = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_pack_size(
+        handle, rocblas_gemm_pack_operand_a, transA, M, N, K, type, &size_a));
+    CHECK_ROCBLAS_ERROR(rocblas_gemm_pack_size(
+        handle, rocblas_gemm_pack_operand_b, transB, M, N, K, type, &size_b));
+    EXPECT_EQ(size_a, sizeof(T) * size_t(K) * M);
+    EXPECT_EQ(size_b, sizeof(T) * size_t(K) * N);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_pack(
+            handle, rocblas_gemm_pack_operand_a, transA, M, N, K, type, dA, lda, dA_packed));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_pack(
+            handle, rocblas_gemm_pack_operand_b, transB, M, N, K, type, dB, ldb, dB_packed));
+
+        CHECK_HIP_ERROR(hA_packed.transfer_from(dA_packed));
+        CHECK_HIP_ERROR(hB_packed.transfer_from(dB_packed));
+
+        // Host replica of the documented convention: packed A is k x m with
+        // leading dimension k and is consumed with a transpose-family
+        // operation, so its data is never conjugated; packed B is plain
+        // k x n column-major with any conjugation folded into the data
+        for(size_t mm = 0; mm < size_t(M); mm++)
+            for(size_t kk = 0; kk < size_t(K); kk++)
+                hA_packed_gold[kk + mm * K] = transA == rocblas_operation_none
+                                                  ? hA[0][mm + kk * size_t(lda)]
+                                                  : hA[0][kk + mm * size_t(lda)];
+
+        bool conj_b = transB == rocblas_operation_conjugate_transpose;
+        for(size_t nn = 0; nn < size_t(N); nn++)
+            for(size_t kk = 0; kk < size_t(K); kk++)
+            {
+                T v = transB == rocblas_operation_none ? hB[0][kk + nn * size_t(ldb)]
+                                                       : hB[0][nn + kk * size_t(ldb)];
+                hB_packed_gold[kk + nn * K] = conj_b ? conjugate(v) : v;
+            }
+
+        // the pack is a pure data movement, so the comparison is exact
+        unit_check_general<T>(K, M, K, (T*)hA_packed_gold, (T*)hA_packed);
+        unit_check_general<T>(K, N, K, (T*)hB_packed_gold, (T*)hB_packed);
+
+        // End-to-end: gemm_ex must accept the packed buffers with the
+        // original trans arguments and reproduce op(A) * op(B). The
+        // leading dimensions of packed operands are documented as ignored,
+        // so deliberately nonsensical values are passed.
+        T h_alpha = T(1);
+        T h_beta  = T(2);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                            transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            &h_alpha,
+                                            dA_packed,
+                                            type,
+                                            1,
+                                            dB_packed,
+                                            type,
+                                            1,
+                                            &h_beta,
+                                            dC,
+                                            type,
+                                            ldc,
+                                            dC,
+                                            type,
+                                            ldc,
+                                            type,
+                                            rocblas_gemm_algo_standard,
+                                            0,
+                                            rocblas_gemm_flags_packed_a
+                                                | rocblas_gemm_flags_packed_b));
+        CHECK_HIP_ERROR(hD.transfer_from(dC));
+
+        // reference on the unpacked operands; the small-integer data keeps
+        // the accumulation exact in every instantiated precision
+        ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC, ldc);
+
+        unit_check_general<T>(M, N, ldc, (T*)hC, (T*)hD);
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used, cpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_pack(
+                handle, rocblas_gemm_pack_operand_a, transA, M, N, K, type, dA, lda, dA_packed));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_pack(
+                handle, rocblas_gemm_pack_operand_b, transB, M, N, K, type, dB, ldb, dB_packed));
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream);
+
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_pack(
+                handle, rocblas_gemm_pack_operand_a, transA, M, N, K, type, dA, lda, dA_packed));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_pack(
+                handle, rocblas_gemm_pack_operand_b, transB, M, N, K, type, dB, ldb, dB_packed));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        cpu_time_used = 0;
+
+        // each operand is read once and written once
+        double gbyte_count = 2.0 * sizeof(T) * size_t(K) * (size_t(M) + N) / 1e9;
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_lda, e_ldb>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbyte_count,
+            cpu_time_used);
+    }
+}
@@ -0,0 +1,556 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename Ti, typename Tx = Ti, typename Ty = Tx, typename Tex = Ty>
+void testing_gemv_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype x_type       = rocblas_type2datatype<Tx>();
+    const rocblas_datatype y_type       = rocblas_type2datatype<Ty>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tex>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_int       M      = 100;
+        const rocblas_int       N      = 100;
+        const rocblas_int       lda    = 100;
+        const rocblas_int       incx   = 1;
+        const rocblas_int       incy   = 1;
+        const uint32_t          flags  = rocblas_gemm_flags_none;
+
+        DEVICE_MEMCHECK(device_vector<Tex>, alpha_d, (1));
+        DEVICE_MEMCHECK(device_vector<Tex>, beta_d, (1));
+        DEVICE_MEMCHECK(device_vector<Tex>, zero_d, (1));
+        DEVICE_MEMCHECK(device_vector<Tex>, one_d, (1));
+
+        const Tex alpha_h(1), beta_h(1), zero_h(0), one_h(1);
+
+        const Tex* alpha = &alpha_h;
+        const Tex* beta  = &beta_h;
+        const Tex* zero  = &zero_h;
+        const Tex* one   = &one_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+            CHECK_HIP_ERROR(hipMemcpy(one_d, one, sizeof(*one), hipMemcpyHostToDevice));
+            one = one_d;
+        }
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_matrix<Ti>, dA, (M, N, lda));
+        DEVICE_MEMCHECK(device_vector<Tx>, dx, (N, incx));
+        DEVICE_MEMCHECK(device_vector<Ty>, dy, (M, incy));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(nullptr,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              x_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type,
+                                              flags),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              (rocblas_operation)rocblas_fill_full,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              x_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type,
+                                              flags),
+                              rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              x_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type,
+                                              flags),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              x_type,
+                                              incx,
+                                              nullptr,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              compute_type,
+                                              flags),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  alpha,
+                                                  nullptr,
+                                                  a_type,
+                                                  lda,
+                                                  dx,
+                                                  x_type,
+                                                  incx,
+                                                  beta,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type,
+                                                  flags),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  alpha,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  nullptr,
+                                                  x_type,
+                                                  incx,
+                                                  beta,
+                                                  dy,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type,
+                                                  flags),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  alpha,
+                                                  dA,
+                                                  a_type,
+                                                  lda,
+                                                  dx,
+                                                  x_type,
+                                                  incx,
+                                                  beta,
+                                                  nullptr,
+                                                  y_type,
+                                                  incy,
+                                                  compute_type,
+                                                  flags),
+                                  rocblas_status_invalid_pointer);
+        }
+
+        // If M==0, then all pointers may be nullptr without error
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            0,
+                                            N,
+                                            nullptr,
+                                            nullptr,
+                                            a_type,
+                                            lda,
+                                            nullptr,
+                                            x_type,
+                                            incx,
+                                            nullptr,
+                                            nullptr,
+                                            y_type,
+                                            incy,
+                                            compute_type,
+                                            flags));
+
+        // If N==0, then all pointers may be nullptr without error
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            M,
+                                            0,
+                                            nullptr,
+                                            nullptr,
+                                            a_type,
+                                            lda,
+                                            nullptr,
+                                            x_type,
+                                            incx,
+                                            nullptr,
+                                            nullptr,
+                                            y_type,
+                                            incy,
+                                            compute_type,
+                                            flags));
+
+        // If alpha==0, then A and X may be nullptr without error
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            M,
+                                            N,
+                                            zero,
+                                            nullptr,
+                                            a_type,
+                                            lda,
+                                            nullptr,
+                                            x_type,
+                                            incx,
+                                            beta,
+                                            dy,
+                                            y_type,
+                                            incy,
+                                            compute_type,
+                                            flags));
+
+        // If alpha==0 && beta==1, then A, X and Y may be nullptr without error
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            M,
+                                            N,
+                                            zero,
+                                            nullptr,
+                                            a_type,
+                                            lda,
+                                            nullptr,
+                                            x_type,
+                                            incx,
+                                            one,
+                                            nullptr,
+                                            y_type,
+                                            incy,
+                                            compute_type,
+                                            flags));
+
+        // An unsupported type combination is reported, not silently accepted
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dx,
+                                              x_type,
+                                              incx,
+                                              beta,
+                                              dy,
+                                              y_type,
+                                              incy,
+                                              rocblas_datatype_f16_r,
+                                              flags),
+                              rocblas_status_not_implemented);
+    }
+}
+
+template <typename Ti, typename Tx = Ti, typename Ty = Tx, typename Tex = Ty>
+void testing_gemv_ex(const Arguments& arg)
+{
+    const rocblas_datatype a_type       = rocblas_type2datatype<Ti>();
+    const rocblas_datatype x_type       = rocblas_type2datatype<Tx>();
+    const rocblas_datatype y_type       = rocblas_type2datatype<Ty>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tex>();
+
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       lda     = arg.lda;
+    rocblas_int       incx    = arg.incx;
+    rocblas_int       incy    = arg.incy;
+    Tex               h_alpha = arg.get_alpha<Tex>();
+    Tex               h_beta  = arg.get_beta<Tex>();
+    rocblas_operation transA  = char2rocblas_operation(arg.transA);
+    const uint32_t    flags   = rocblas_gemm_flags_none;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              nullptr,
+                                              x_type,
+                                              incx,
+                                              nullptr,
+                                              nullptr,
+                                              y_type,
+                                              incy,
+                                              compute_type,
+                                              flags),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t dim_x;
+    size_t dim_y;
+
+    if(transA == rocblas_operation_none)
+    {
+        dim_x = N;
+        dim_y = M;
+    }
+    else
+    {
+        dim_x = M;
+        dim_y = N;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    HOST_MEMCHECK(host_matrix<Ti>, hA, (M, N, lda));
+    HOST_MEMCHECK(host_vector<Tx>, hx, (dim_x, incx));
+    HOST_MEMCHECK(host_vector<Ty>, hy, (dim_y, incy));
+    HOST_MEMCHECK(host_vector<Ty>, hy_gold, (dim_y, incy));
+    HOST_MEMCHECK(host_vector<Tex>, halpha, (1));
+    HOST_MEMCHECK(host_vector<Tex>, hbeta, (1));
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<Ti>, dA, (M, N, lda));
+    DEVICE_MEMCHECK(device_vector<Tx>, dx, (dim_x, incx));
+    DEVICE_MEMCHECK(device_vector<Ty>, dy, (dim_y, incy));
+    DEVICE_MEMCHECK(device_vector<Tex>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<Tex>, d_beta, (1));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+
+    // save a copy in hy_gold which will be output of CPU BLAS
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double cpu_time_used;
+    double error_host;
+    double error_device;
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                &h_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                &h_beta,
+                                                dy,
+                                                y_type,
+                                                incy,
+                                                compute_type,
+                                                flags));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+            CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+            CHECK_HIP_ERROR(dy.transfer_from(hy_gold));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                d_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                d_beta,
+                                                dy,
+                                                y_type,
+                                                incy,
+                                                compute_type,
+                                                flags));
+            handle.post_test(arg);
+        }
+
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        ref_gemv<Ti, Ty, Tex>(
+            transA, M, N, h_alpha, (Ti*)hA, lda, (Tx*)hx, incx, h_beta, (Ty*)hy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        auto compare_hy_to_gold = [&] {
+            if(arg.unit_check)
+            {
+                bool use_near = reduction_requires_near<Ty>(arg, dim_x);
+                if(use_near)
+                {
+                    const double tol = dim_x * sum_error_tolerance<Ty>;
+                    near_check_general<Ty>(1, dim_y, incy, hy_gold, hy, tol);
+                }
+                else
+                {
+                    unit_check_general<Ty>(1, dim_y, incy, hy_gold, hy);
+                }
+            }
+            double error = 0;
+            if(arg.norm_check)
+                error = norm_check_general<Ty>('F', 1, dim_y, incy, hy_gold, hy);
+            return error;
+        };
+
+        if(arg.pointer_mode_host)
+        {
+            error_host = compare_hy_to_gold();
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hy.transfer_from(dy));
+            error_device = compare_hy_to_gold();
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                                transA,
+                                                M,
+                                                N,
+                                                &h_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                dx,
+                                                x_type,
+                                                incx,
+                                                &h_beta,
+                                                dy,
+                                                y_type,
+                                                incy,
+                                                compute_type,
+                                                flags));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy>{}.log_args<Ti>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gemv_gflop_count<Ti>(transA, M, N),
+            gemv_gbyte_count<Ti>(transA, M, N),
+            cpu_time_used,
+            error_host,
+            error_device);
+    }
+}
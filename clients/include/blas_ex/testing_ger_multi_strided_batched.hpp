@@ -0,0 +1,455 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// ger_multi_strided_batched is a beta API without Fortran or ILP64 bindings;
+// map the C entry points directly
+template <typename T>
+static auto rocblas_ger_multi_strided_batched_fn = nullptr;
+template <>
+static auto rocblas_ger_multi_strided_batched_fn<float> = rocblas_sger_multi_strided_batched;
+template <>
+static auto rocblas_ger_multi_strided_batched_fn<double> = rocblas_dger_multi_strided_batched;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_ger_multi_strided_batched_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int    M           = 100;
+        rocblas_int    N           = 100;
+        rocblas_int    K           = 4;
+        rocblas_int    ldx         = 100;
+        rocblas_int    ldy         = 100;
+        rocblas_int    lda         = 100;
+        rocblas_stride stridex     = size_t(ldx) * K;
+        rocblas_stride stridey     = size_t(ldy) * K;
+        rocblas_stride strideA     = size_t(lda) * N;
+        rocblas_int    batch_count = 2;
+
+        DEVICE_MEMCHECK(device_vector<T>, alpha_d, (1));
+        DEVICE_MEMCHECK(device_vector<T>, zero_d, (1));
+
+        const T alpha_h(1), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dA, (M, N, lda, strideA, batch_count));
+        DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dx, (M, K, ldx, stridex, batch_count));
+        DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dy, (N, K, ldy, stridey, batch_count));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(nullptr,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      alpha,
+                                                                      dx,
+                                                                      ldx,
+                                                                      stridex,
+                                                                      dy,
+                                                                      ldy,
+                                                                      stridey,
+                                                                      dA,
+                                                                      lda,
+                                                                      strideA,
+                                                                      batch_count),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      nullptr,
+                                                                      dx,
+                                                                      ldx,
+                                                                      stridex,
+                                                                      dy,
+                                                                      ldy,
+                                                                      stridey,
+                                                                      dA,
+                                                                      lda,
+                                                                      strideA,
+                                                                      batch_count),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                          M,
+                                                                          N,
+                                                                          K,
+                                                                          alpha,
+                                                                          nullptr,
+                                                                          ldx,
+                                                                          stridex,
+                                                                          dy,
+                                                                          ldy,
+                                                                          stridey,
+                                                                          dA,
+                                                                          lda,
+                                                                          strideA,
+                                                                          batch_count),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                          M,
+                                                                          N,
+                                                                          K,
+                                                                          alpha,
+                                                                          dx,
+                                                                          ldx,
+                                                                          stridex,
+                                                                          nullptr,
+                                                                          ldy,
+                                                                          stridey,
+                                                                          dA,
+                                                                          lda,
+                                                                          strideA,
+                                                                          batch_count),
+                                  rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                          M,
+                                                                          N,
+                                                                          K,
+                                                                          alpha,
+                                                                          dx,
+                                                                          ldx,
+                                                                          stridex,
+                                                                          dy,
+                                                                          ldy,
+                                                                          stridey,
+                                                                          nullptr,
+                                                                          lda,
+                                                                          strideA,
+                                                                          batch_count),
+                                  rocblas_status_invalid_pointer);
+        }
+
+        EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      alpha,
+                                                                      dx,
+                                                                      ldx,
+                                                                      stridex,
+                                                                      dy,
+                                                                      ldy,
+                                                                      stridey,
+                                                                      dA,
+                                                                      lda,
+                                                                      strideA,
+                                                                      -1),
+                              rocblas_status_invalid_size);
+
+        // K==0 or batch_count==0, all pointers may be null
+        CHECK_ROCBLAS_ERROR(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                    M,
+                                                                    N,
+                                                                    0,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    ldx,
+                                                                    stridex,
+                                                                    nullptr,
+                                                                    ldy,
+                                                                    stridey,
+                                                                    nullptr,
+                                                                    lda,
+                                                                    strideA,
+                                                                    batch_count));
+
+        CHECK_ROCBLAS_ERROR(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    alpha,
+                                                                    nullptr,
+                                                                    ldx,
+                                                                    stridex,
+                                                                    nullptr,
+                                                                    ldy,
+                                                                    stridey,
+                                                                    nullptr,
+                                                                    lda,
+                                                                    strideA,
+                                                                    0));
+    }
+}
+
+template <typename T>
+void testing_ger_multi_strided_batched(const Arguments& arg)
+{
+    rocblas_int    M           = arg.M;
+    rocblas_int    N           = arg.N;
+    rocblas_int    K           = arg.K;
+    rocblas_int    ldx         = arg.ldb;
+    rocblas_int    ldy         = arg.ldc;
+    rocblas_int    lda         = arg.lda;
+    rocblas_stride stridex     = arg.stride_b;
+    rocblas_stride stridey     = arg.stride_c;
+    rocblas_stride strideA     = arg.stride_a;
+    rocblas_int    batch_count = arg.batch_count;
+    T              h_alpha     = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument check before allocating invalid memory
+    if(M < 0 || N < 0 || K < 0 || ldx < M || ldx < 1 || ldy < N || ldy < 1 || lda < M || lda < 1
+       || batch_count < 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                      M,
+                                                                      N,
+                                                                      K,
+                                                                      nullptr,
+                                                                      nullptr,
+                                                                      ldx,
+                                                                      stridex,
+                                                                      nullptr,
+                                                                      ldy,
+                                                                      stridey,
+                                                                      nullptr,
+                                                                      lda,
+                                                                      strideA,
+                                                                      batch_count),
+                              rocblas_status_invalid_size);
+        return;
+    }
+
+    if(!M || !N || !K || !batch_count)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    ldx,
+                                                                    stridex,
+                                                                    nullptr,
+                                                                    ldy,
+                                                                    stridey,
+                                                                    nullptr,
+                                                                    lda,
+                                                                    strideA,
+                                                                    batch_count));
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory; x and y hold the K update vectors column by column
+    HOST_MEMCHECK(host_strided_batch_matrix<T>, hA, (M, N, lda, strideA, batch_count));
+    HOST_MEMCHECK(host_strided_batch_matrix<T>, hA_gold, (M, N, lda, strideA, batch_count));
+    HOST_MEMCHECK(host_strided_batch_matrix<T>, hx, (M, K, ldx, stridex, batch_count));
+    HOST_MEMCHECK(host_strided_batch_matrix<T>, hy, (N, K, ldy, stridey, batch_count));
+    HOST_MEMCHECK(host_vector<T>, halpha, (1));
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dA, (M, N, lda, strideA, batch_count));
+    DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dx, (M, K, ldx, stridex, batch_count));
+    DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dy, (N, K, ldy, stridey, batch_count));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hx, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hy, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix);
+
+    hA_gold.copy_from(hA);
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double cpu_time_used;
+    double rocblas_error_host;
+    double rocblas_error_device;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        &h_alpha,
+                                                                        dx,
+                                                                        ldx,
+                                                                        stridex,
+                                                                        dy,
+                                                                        ldy,
+                                                                        stridey,
+                                                                        dA,
+                                                                        lda,
+                                                                        strideA,
+                                                                        batch_count));
+            handle.post_test(arg);
+
+            // Transfer output from device to CPU
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+            CHECK_HIP_ERROR(dA.transfer_from(hA_gold)); // gold still original hA
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        d_alpha,
+                                                                        dx,
+                                                                        ldx,
+                                                                        stridex,
+                                                                        dy,
+                                                                        ldy,
+                                                                        stridey,
+                                                                        dA,
+                                                                        lda,
+                                                                        strideA,
+                                                                        batch_count));
+            handle.post_test(arg);
+        }
+
+        // CPU BLAS: K consecutive rank-1 updates per batch instance
+        cpu_time_used = get_time_us_no_sync();
+
+        for(size_t b = 0; b < batch_count; b++)
+            for(rocblas_int j = 0; j < K; j++)
+                ref_ger<T, false>(M,
+                                  N,
+                                  h_alpha,
+                                  (T*)hx[b] + j * size_t(ldx),
+                                  1,
+                                  (T*)hy[b] + j * size_t(ldy),
+                                  1,
+                                  (T*)hA_gold[b],
+                                  lda);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The fused kernel accumulates the K updates in registers and applies
+        // alpha once, so the rounding differs from K scaled updates
+        const double tol = K * sum_error_tolerance<T>;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+                near_check_general<T>(M, N, lda, strideA, hA_gold, hA, batch_count, tol);
+
+            if(arg.norm_check)
+                rocblas_error_host
+                    = norm_check_general<T>('F', M, N, lda, strideA, hA_gold, hA, batch_count);
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+            if(arg.unit_check)
+                near_check_general<T>(M, N, lda, strideA, hA_gold, hA, batch_count, tol);
+
+            if(arg.norm_check)
+                rocblas_error_device
+                    = norm_check_general<T>('F', M, N, lda, strideA, hA_gold, hA, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_ger_multi_strided_batched_fn<T>(handle,
+                                                                        M,
+                                                                        N,
+                                                                        K,
+                                                                        &h_alpha,
+                                                                        dx,
+                                                                        ldx,
+                                                                        stridex,
+                                                                        dy,
+                                                                        ldy,
+                                                                        stridey,
+                                                                        dA,
+                                                                        lda,
+                                                                        strideA,
+                                                                        batch_count));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // A is read and written once regardless of K; the update vectors are
+        // streamed once each
+        double gbyte_count = (2.0 * M * N + K * double(M + N)) * sizeof(T) / 1e9;
+
+        ArgumentModel<e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_ldc, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            K * ger_gflop_count<T>(M, N),
+            gbyte_count,
+            cpu_time_used,
+            rocblas_error_host,
+            rocblas_error_device);
+    }
+}
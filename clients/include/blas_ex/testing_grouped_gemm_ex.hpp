@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_grouped_gemm_ex_bad_arg(const Arguments& arg)
+{
+    auto rocblas_grouped_gemm_ex_fn = rocblas_grouped_gemm_ex;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    const int32_t           solution_index = 0;
+    const uint32_t          flags          = 0;
+
+    const rocblas_datatype ab_type      = rocblas_type2datatype<Ti>();
+    const rocblas_datatype cd_type      = rocblas_type2datatype<To>();
+    const rocblas_datatype compute_type = rocblas_type2datatype<Tc>();
+
+    // two uneven members so both per-group entries are exercised
+    constexpr rocblas_int group_count   = 2;
+    rocblas_int           m[group_count] = {8, 16};
+    rocblas_int           n[group_count] = {8, 8};
+    rocblas_int           k[group_count] = {8, 4};
+    rocblas_int           lda[group_count] = {8, 16};
+    rocblas_int           ldb[group_count] = {8, 4};
+    rocblas_int           ldc[group_count] = {8, 16};
+    rocblas_int           ldd[group_count] = {8, 16};
+
+    const Tc alpha = Tc(1);
+    const Tc beta  = Tc(0);
+
+    // each buffer is large enough for the bigger group member
+    DEVICE_MEMCHECK(device_vector<Ti>, dA, (16 * 8));
+    DEVICE_MEMCHECK(device_vector<Ti>, dB, (8 * 8));
+    DEVICE_MEMCHECK(device_vector<To>, dC, (16 * 8));
+    DEVICE_MEMCHECK(device_vector<To>, dD, (16 * 8));
+
+    const void* a[group_count] = {dA, dA};
+    const void* b[group_count] = {dB, dB};
+    const void* c[group_count] = {dC, dC};
+    void*       d[group_count] = {dD, dD};
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(nullptr, transA, transB, group_count, m, n, k,
+                          &alpha, a, ab_type, lda, b, ab_type, ldb, &beta, c, cd_type, ldc,
+                          d, cd_type, ldd, compute_type, algo, solution_index, flags),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(handle, transA, transB, -1, m, n, k,
+                          &alpha, a, ab_type, lda, b, ab_type, ldb, &beta, c, cd_type, ldc,
+                          d, cd_type, ldd, compute_type, algo, solution_index, flags),
+                          rocblas_status_invalid_size);
+
+    // a zero group count returns before any of the arrays are read
+    CHECK_ROCBLAS_ERROR(rocblas_grouped_gemm_ex_fn(handle, transA, transB, 0, nullptr, nullptr,
+                        nullptr, &alpha, nullptr, ab_type, nullptr, nullptr, ab_type, nullptr,
+                        &beta, nullptr, cd_type, nullptr, nullptr, cd_type, nullptr,
+                        compute_type, algo, solution_index, flags));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count, nullptr, n, k,
+                          &alpha, a, ab_type, lda, b, ab_type, ldb, &beta, c, cd_type, ldc,
+                          d, cd_type, ldd, compute_type, algo, solution_index, flags),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count, m, n, k,
+                          &alpha, nullptr, ab_type, lda, b, ab_type, ldb, &beta, c, cd_type, ldc,
+                          d, cd_type, ldd, compute_type, algo, solution_index, flags),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count, m, n, k,
+                          nullptr, a, ab_type, lda, b, ab_type, ldb, &beta, c, cd_type, ldc,
+                          d, cd_type, ldd, compute_type, algo, solution_index, flags),
+                          rocblas_status_invalid_pointer);
+
+    // a null member pointer is caught by the per-member argument check
+    const void* a_null_member[group_count] = {dA, nullptr};
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count, m, n, k,
+                          &alpha, a_null_member, ab_type, lda, b, ab_type, ldb, &beta, c, cd_type, ldc,
+                          d, cd_type, ldd, compute_type, algo, solution_index, flags),
+                          rocblas_status_invalid_pointer);
+    // clang-format on
+}
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void testing_grouped_gemm_ex(const Arguments& arg)
+{
+    auto rocblas_grouped_gemm_ex_fn = rocblas_grouped_gemm_ex;
+
+    rocblas_gemm_algo algo           = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index = arg.solution_index;
+    uint32_t          flags          = arg.flags;
+
+    rocblas_local_handle handle{arg};
+    rocblas_operation    transA = char2rocblas_operation(arg.transA);
+    rocblas_operation    transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int group_count = arg.batch_count;
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    const rocblas_datatype ab_type      = arg.a_type;
+    const rocblas_datatype cd_type      = arg.c_type;
+    const rocblas_datatype compute_type = arg.compute_type;
+
+    // argument sanity check before allocating invalid memory
+    if(group_count <= 0)
+    {
+        // clang-format off
+        EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count,
+                              nullptr, nullptr, nullptr, nullptr, nullptr, ab_type, nullptr,
+                              nullptr, ab_type, nullptr, nullptr, nullptr, cd_type, nullptr,
+                              nullptr, cd_type, nullptr, compute_type, algo, solution_index, flags),
+                              group_count < 0 ? rocblas_status_invalid_size
+                                              : rocblas_status_success);
+        // clang-format on
+        return;
+    }
+
+    // Build a group of uneven problems from the base sizes: every member
+    // shrinks by one in each dimension so no two shapes are identical
+    std::vector<rocblas_int> m(group_count), n(group_count), k(group_count);
+    std::vector<rocblas_int> lda(group_count), ldb(group_count), ldc(group_count),
+        ldd(group_count);
+    std::vector<size_t> off_a(group_count), off_b(group_count), off_c(group_count);
+
+    size_t total_a = 0, total_b = 0, total_c = 0;
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        m[i] = std::max(rocblas_int(arg.M - i), rocblas_int(1));
+        n[i] = std::max(rocblas_int(arg.N - i), rocblas_int(1));
+        k[i] = std::max(rocblas_int(arg.K - i), rocblas_int(0));
+
+        rocblas_int A_row = transA == rocblas_operation_none ? m[i] : k[i];
+        rocblas_int A_col = transA == rocblas_operation_none ? k[i] : m[i];
+        rocblas_int B_row = transB == rocblas_operation_none ? k[i] : n[i];
+        rocblas_int B_col = transB == rocblas_operation_none ? n[i] : k[i];
+
+        lda[i] = std::max(A_row, rocblas_int(1));
+        ldb[i] = std::max(B_row, rocblas_int(1));
+        ldc[i] = m[i];
+        ldd[i] = m[i];
+
+        off_a[i] = total_a;
+        off_b[i] = total_b;
+        off_c[i] = total_c;
+
+        total_a += size_t(lda[i]) * std::max(A_col, rocblas_int(1));
+        total_b += size_t(ldb[i]) * std::max(B_col, rocblas_int(1));
+        total_c += size_t(ldc[i]) * n[i];
+    }
+
+    // CPU reference accumulates in float for 16-bit output types
+    using To_hpa = std::conditional_t<std::is_same_v<To, rocblas_bfloat16>, float, To>;
+
+    // Allocate host memory; every group member lives at its offset in one block
+    HOST_MEMCHECK(host_vector<Ti>, hA, (total_a));
+    HOST_MEMCHECK(host_vector<Ti>, hB, (total_b));
+    HOST_MEMCHECK(host_vector<To>, hC, (total_c));
+    HOST_MEMCHECK(host_vector<To>, hD_1, (total_c));
+    HOST_MEMCHECK(host_vector<To>, hD_2, (total_c));
+    HOST_MEMCHECK(host_vector<To_hpa>, hD_gold, (total_c));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<Ti>, dA, (total_a));
+    DEVICE_MEMCHECK(device_vector<Ti>, dB, (total_b));
+    DEVICE_MEMCHECK(device_vector<To>, dC, (total_c));
+    DEVICE_MEMCHECK(device_vector<To>, dD, (total_c));
+    DEVICE_MEMCHECK(device_vector<Tc>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<Tc>, d_beta, (1));
+
+    // Initialize data on host memory
+    rocblas_seedrand();
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        rocblas_int A_row = transA == rocblas_operation_none ? m[i] : k[i];
+        rocblas_int A_col = transA == rocblas_operation_none ? k[i] : m[i];
+        rocblas_int B_row = transB == rocblas_operation_none ? k[i] : n[i];
+        rocblas_int B_col = transB == rocblas_operation_none ? n[i] : k[i];
+
+        rocblas_init<Ti>(hA.data() + off_a[i], A_row, std::max(A_col, rocblas_int(1)), lda[i]);
+        rocblas_init<Ti>(hB.data() + off_b[i], B_row, std::max(B_col, rocblas_int(1)), ldb[i]);
+        rocblas_init<To>(hC.data() + off_c[i], m[i], n[i], ldc[i]);
+    }
+    rocblas_init_nan<To>(hD_1.data(), total_c);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    // Host arrays of per-group device pointers
+    std::vector<const void*> a(group_count), b(group_count), c(group_count);
+    std::vector<void*>       d(group_count);
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        a[i] = (const Ti*)dA + off_a[i];
+        b[i] = (const Ti*)dB + off_b[i];
+        c[i] = (const To*)dC + off_c[i];
+        d[i] = (To*)dD + off_c[i];
+    }
+
+    double cpu_time_used   = 0.0;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_HIP_ERROR(dD.transfer_from(hD_1)); // NaN-poison D
+
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count,
+                                m.data(), n.data(), k.data(), &h_alpha,
+                                a.data(), ab_type, lda.data(),
+                                b.data(), ab_type, ldb.data(), &h_beta,
+                                c.data(), cd_type, ldc.data(),
+                                d.data(), cd_type, ldd.data(),
+                                compute_type, algo, solution_index, flags));
+            // clang-format on
+
+            CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+            rocblas_init_nan<To>(hD_2.data(), total_c);
+            CHECK_HIP_ERROR(dD.transfer_from(hD_2));
+
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count,
+                                m.data(), n.data(), k.data(), d_alpha,
+                                a.data(), ab_type, lda.data(),
+                                b.data(), ab_type, ldb.data(), d_beta,
+                                c.data(), cd_type, ldc.data(),
+                                d.data(), cd_type, ldd.data(),
+                                compute_type, algo, solution_index, flags));
+            // clang-format on
+
+            CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+        }
+
+        // CPU BLAS, one reference gemm per group member
+        for(size_t j = 0; j < total_c; j++)
+            hD_gold[j] = To_hpa(hC[j]);
+
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int i = 0; i < group_count; i++)
+            ref_gemm<Ti, To_hpa, Tc>(transA,
+                                     transB,
+                                     m[i],
+                                     n[i],
+                                     k[i],
+                                     h_alpha,
+                                     hA.data() + off_a[i],
+                                     lda[i],
+                                     hB.data() + off_b[i],
+                                     ldb[i],
+                                     h_beta,
+                                     hD_gold.data() + off_c[i],
+                                     ldd[i]);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        for(int mode = 0; mode < 2; mode++)
+        {
+            if(mode == 0 && !arg.pointer_mode_host)
+                continue;
+            if(mode == 1 && !arg.pointer_mode_device)
+                continue;
+
+            host_vector<To>& hD     = mode == 0 ? hD_1 : hD_2;
+            double&          error  = mode == 0 ? rocblas_error_1 : rocblas_error_2;
+
+            for(rocblas_int i = 0; i < group_count; i++)
+            {
+                if(arg.unit_check)
+                {
+                    if((rocblas_handle(handle)->getArchMajor() == 11
+                        || rocblas_handle(handle)->getArchMajor() == 12)
+                       && (sizeof(Ti) == 2))
+                    {
+                        const double tol = k[i] * sum_error_tolerance_for_gfx11<Tc, Ti, To>;
+                        near_check_general<To, To_hpa>(m[i],
+                                                       n[i],
+                                                       ldd[i],
+                                                       hD_gold.data() + off_c[i],
+                                                       hD.data() + off_c[i],
+                                                       tol);
+                    }
+                    else
+                    {
+                        unit_check_general<To, To_hpa>(m[i],
+                                                       n[i],
+                                                       ldd[i],
+                                                       hD_gold.data() + off_c[i],
+                                                       hD.data() + off_c[i]);
+                    }
+                }
+
+                if(arg.norm_check)
+                {
+                    auto err = std::abs(norm_check_general<To>('F',
+                                                               m[i],
+                                                               n[i],
+                                                               ldd[i],
+                                                               (To_hpa*)(hD_gold.data() + off_c[i]),
+                                                               (To*)(hD.data() + off_c[i])));
+                    error    = err > error ? err : error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_gemm_ex_fn(handle, transA, transB, group_count,
+                                m.data(), n.data(), k.data(), &h_alpha,
+                                a.data(), ab_type, lda.data(),
+                                b.data(), ab_type, ldb.data(), &h_beta,
+                                c.data(), cd_type, ldc.data(),
+                                d.data(), cd_type, ldd.data(),
+                                compute_type, algo, solution_index, flags));
+            // clang-format on
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gflops = 0.0;
+        for(rocblas_int i = 0; i < group_count; i++)
+            gflops += gemm_gflop_count<Tc>(m[i], n[i], k[i]);
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_beta, e_batch_count>{}
+            .log_args<Tc>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gflops,
+                          ArgumentLogging::NA_value,
+                          cpu_time_used,
+                          rocblas_error_1,
+                          rocblas_error_2);
+    }
+}
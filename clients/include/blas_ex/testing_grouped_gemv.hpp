@@ -0,0 +1,350 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// grouped_gemv is a beta API without Fortran or ILP64 bindings; the single C
+// entry point is typed through the rocblas_datatype argument
+
+/* ============================================================================================ */
+template <typename T>
+void testing_grouped_gemv_bad_arg(const Arguments& arg)
+{
+    auto rocblas_grouped_gemv_fn = rocblas_grouped_gemv;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    const rocblas_operation trans = rocblas_operation_none;
+    const rocblas_datatype  type  = rocblas_type2datatype<T>();
+
+    const rocblas_int incx = 1;
+    const rocblas_int incy = 1;
+
+    // two uneven members so both per-group entries are exercised
+    constexpr rocblas_int group_count     = 2;
+    rocblas_int           m[group_count]   = {8, 16};
+    rocblas_int           n[group_count]   = {8, 4};
+    rocblas_int           lda[group_count] = {8, 16};
+
+    const T alpha = T(1);
+    const T beta  = T(0);
+
+    // each buffer is large enough for the bigger group member
+    DEVICE_MEMCHECK(device_vector<T>, dA, (16 * 8));
+    DEVICE_MEMCHECK(device_vector<T>, dx, (16));
+    DEVICE_MEMCHECK(device_vector<T>, dy, (16));
+
+    const void* a[group_count] = {dA, dA};
+    const void* x[group_count] = {dx, dx};
+    void*       y[group_count] = {dy, dy};
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(nullptr, trans, group_count, m, n,
+                          &alpha, a, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_handle);
+
+    // only the real float and double datatypes are implemented
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, m, n,
+                          &alpha, a, lda, x, incx, &beta, y, incy, rocblas_datatype_f16_r),
+                          rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, (rocblas_operation)rocblas_fill_full,
+                          group_count, m, n, &alpha, a, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, -1, m, n,
+                          &alpha, a, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_size);
+
+    // a zero group count returns before any of the arrays are read
+    CHECK_ROCBLAS_ERROR(rocblas_grouped_gemv_fn(handle, trans, 0, nullptr, nullptr,
+                        nullptr, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy, type));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, nullptr, n,
+                          &alpha, a, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, m, n,
+                          nullptr, a, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, m, n,
+                          &alpha, nullptr, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, m, n,
+                          &alpha, a, lda, x, 0, &beta, y, incy, type),
+                          rocblas_status_invalid_size);
+
+    // a null member pointer is caught by the per-member argument check
+    const void* a_null_member[group_count] = {dA, nullptr};
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, m, n,
+                          &alpha, a_null_member, lda, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_pointer);
+
+    // an undersized member leading dimension is caught the same way
+    rocblas_int lda_bad_member[group_count] = {8, 15};
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, m, n,
+                          &alpha, a, lda_bad_member, x, incx, &beta, y, incy, type),
+                          rocblas_status_invalid_size);
+    // clang-format on
+}
+
+template <typename T>
+void testing_grouped_gemv(const Arguments& arg)
+{
+    auto rocblas_grouped_gemv_fn = rocblas_grouped_gemv;
+
+    rocblas_local_handle handle{arg};
+    rocblas_operation    trans = char2rocblas_operation(arg.transA);
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_int group_count = arg.batch_count;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // argument sanity check before allocating invalid memory
+    if(group_count <= 0)
+    {
+        // clang-format off
+        EXPECT_ROCBLAS_STATUS(rocblas_grouped_gemv_fn(handle, trans, group_count, nullptr, nullptr,
+                              nullptr, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy, type),
+                              group_count < 0 ? rocblas_status_invalid_size
+                                              : rocblas_status_success);
+        // clang-format on
+        return;
+    }
+
+    const bool transpose = trans != rocblas_operation_none;
+
+    // Build a group of uneven problems from the base sizes: every member
+    // shrinks by one in each dimension so no two shapes are identical
+    std::vector<rocblas_int> m(group_count), n(group_count), lda(group_count);
+    std::vector<size_t>      off_a(group_count), off_x(group_count), off_y(group_count);
+
+    size_t total_a = 0, total_x = 0, total_y = 0;
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        m[i]   = std::max(rocblas_int(arg.M - i), rocblas_int(1));
+        n[i]   = std::max(rocblas_int(arg.N - i), rocblas_int(1));
+        lda[i] = m[i] + (i % 2);
+
+        size_t x_len = transpose ? m[i] : n[i];
+        size_t y_len = transpose ? n[i] : m[i];
+
+        off_a[i] = total_a;
+        off_x[i] = total_x;
+        off_y[i] = total_y;
+
+        total_a += size_t(lda[i]) * n[i];
+        total_x += x_len * std::abs(incx);
+        total_y += y_len * std::abs(incy);
+    }
+
+    // Allocate host memory; every group member lives at its offset in one block
+    HOST_MEMCHECK(host_vector<T>, hA, (total_a));
+    HOST_MEMCHECK(host_vector<T>, hx, (total_x));
+    HOST_MEMCHECK(host_vector<T>, hy, (total_y));
+    HOST_MEMCHECK(host_vector<T>, hy_gold, (total_y));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dA, (total_a));
+    DEVICE_MEMCHECK(device_vector<T>, dx, (total_x));
+    DEVICE_MEMCHECK(device_vector<T>, dy, (total_y));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+    DEVICE_MEMCHECK(device_vector<T>, d_beta, (1));
+
+    // Initialize data on host memory
+    rocblas_seedrand();
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        size_t x_len = transpose ? m[i] : n[i];
+        size_t y_len = transpose ? n[i] : m[i];
+
+        rocblas_init<T>(hA.data() + off_a[i], m[i], n[i], lda[i]);
+        rocblas_init<T>(hx.data() + off_x[i], 1, x_len, std::abs(incx));
+        rocblas_init<T>(hy.data() + off_y[i], 1, y_len, std::abs(incy));
+    }
+
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    // Host arrays of per-group device pointers
+    std::vector<const void*> a(group_count), x(group_count);
+    std::vector<void*>       y(group_count);
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        a[i] = (const T*)dA + off_a[i];
+        x[i] = (const T*)dx + off_x[i];
+        y[i] = (T*)dy + off_y[i];
+    }
+
+    double cpu_time_used   = 0.0;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        HOST_MEMCHECK(host_vector<T>, hy_1, (total_y));
+        HOST_MEMCHECK(host_vector<T>, hy_2, (total_y));
+
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_gemv_fn(handle, trans, group_count, m.data(),
+                                n.data(), &h_alpha, a.data(), lda.data(), x.data(), incx,
+                                &h_beta, y.data(), incy, type));
+            // clang-format on
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(dy.transfer_from(hy)); // restore the original y
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            handle.pre_test(arg);
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_gemv_fn(handle, trans, group_count, m.data(),
+                                n.data(), d_alpha, a.data(), lda.data(), x.data(), incx,
+                                d_beta, y.data(), incy, type));
+            // clang-format on
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+        }
+
+        // CPU BLAS, one reference gemv per group member
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int i = 0; i < group_count; i++)
+            ref_gemv<T, T, T>(trans,
+                              m[i],
+                              n[i],
+                              h_alpha,
+                              hA.data() + off_a[i],
+                              lda[i],
+                              hx.data() + off_x[i],
+                              incx,
+                              h_beta,
+                              hy_gold.data() + off_y[i],
+                              incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        for(int mode = 0; mode < 2; mode++)
+        {
+            if(mode == 0 && !arg.pointer_mode_host)
+                continue;
+            if(mode == 1 && !arg.pointer_mode_device)
+                continue;
+
+            host_vector<T>& hy_res = mode == 0 ? hy_1 : hy_2;
+            double&         error  = mode == 0 ? rocblas_error_1 : rocblas_error_2;
+
+            for(rocblas_int i = 0; i < group_count; i++)
+            {
+                size_t y_len = transpose ? n[i] : m[i];
+                size_t in_len = transpose ? m[i] : n[i];
+
+                // the device kernel reduces the dot products serially but in a
+                // different association than the reference
+                const double tol = in_len * sum_error_tolerance<T>;
+
+                if(arg.unit_check)
+                    near_check_general<T>(1,
+                                          y_len,
+                                          std::abs(incy),
+                                          hy_gold.data() + off_y[i],
+                                          hy_res.data() + off_y[i],
+                                          tol);
+
+                if(arg.norm_check)
+                {
+                    auto err = std::abs(norm_check_general<T>('F',
+                                                              1,
+                                                              y_len,
+                                                              std::abs(incy),
+                                                              hy_gold.data() + off_y[i],
+                                                              hy_res.data() + off_y[i]));
+                    error    = err > error ? err : error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            // clang-format off
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_gemv_fn(handle, trans, group_count, m.data(),
+                                n.data(), &h_alpha, a.data(), lda.data(), x.data(), incx,
+                                &h_beta, y.data(), incy, type));
+            // clang-format on
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gflops = 0.0;
+        for(rocblas_int i = 0; i < group_count; i++)
+            gflops += gemv_gflop_count<T>(trans, m[i], n[i]);
+
+        ArgumentModel<e_transA, e_M, e_N, e_alpha, e_incx, e_beta, e_incy, e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gflops,
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
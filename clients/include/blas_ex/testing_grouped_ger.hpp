@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// grouped_ger is a beta API without Fortran or ILP64 bindings; the single C
+// entry point is typed through the rocblas_datatype argument
+
+/* ============================================================================================ */
+template <typename T>
+void testing_grouped_ger_bad_arg(const Arguments& arg)
+{
+    auto rocblas_grouped_ger_fn = rocblas_grouped_ger;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    const rocblas_int incx = 1;
+    const rocblas_int incy = 1;
+
+    // two uneven members so both per-group entries are exercised
+    constexpr rocblas_int group_count     = 2;
+    rocblas_int           m[group_count]   = {8, 16};
+    rocblas_int           n[group_count]   = {8, 4};
+    rocblas_int           lda[group_count] = {8, 16};
+
+    const T alpha = T(1);
+
+    // each buffer is large enough for the bigger group member
+    DEVICE_MEMCHECK(device_vector<T>, dA, (16 * 8));
+    DEVICE_MEMCHECK(device_vector<T>, dx, (16));
+    DEVICE_MEMCHECK(device_vector<T>, dy, (16));
+
+    const void* x[group_count] = {dx, dx};
+    const void* y[group_count] = {dy, dy};
+    void*       a[group_count] = {dA, dA};
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(nullptr, group_count, m, n,
+                          &alpha, x, incx, y, incy, a, lda, type),
+                          rocblas_status_invalid_handle);
+
+    // only the real float and double datatypes are implemented
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, m, n,
+                          &alpha, x, incx, y, incy, a, lda, rocblas_datatype_f16_r),
+                          rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, -1, m, n,
+                          &alpha, x, incx, y, incy, a, lda, type),
+                          rocblas_status_invalid_size);
+
+    // a zero group count returns before any of the arrays are read
+    CHECK_ROCBLAS_ERROR(rocblas_grouped_ger_fn(handle, 0, nullptr, nullptr,
+                        nullptr, nullptr, incx, nullptr, incy, nullptr, nullptr, type));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, nullptr, n,
+                          &alpha, x, incx, y, incy, a, lda, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, m, n,
+                          nullptr, x, incx, y, incy, a, lda, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, m, n,
+                          &alpha, nullptr, incx, y, incy, a, lda, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, m, n,
+                          &alpha, x, 0, y, incy, a, lda, type),
+                          rocblas_status_invalid_size);
+
+    // a null member pointer is caught by the per-member argument check
+    void* a_null_member[group_count] = {dA, nullptr};
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, m, n,
+                          &alpha, x, incx, y, incy, a_null_member, lda, type),
+                          rocblas_status_invalid_pointer);
+
+    // an undersized member leading dimension is caught the same way
+    rocblas_int lda_bad_member[group_count] = {8, 15};
+    EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, m, n,
+                          &alpha, x, incx, y, incy, a, lda_bad_member, type),
+                          rocblas_status_invalid_size);
+    // clang-format on
+}
+
+template <typename T>
+void testing_grouped_ger(const Arguments& arg)
+{
+    auto rocblas_grouped_ger_fn = rocblas_grouped_ger;
+
+    rocblas_local_handle   handle{arg};
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_int group_count = arg.batch_count;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // argument sanity check before allocating invalid memory
+    if(group_count <= 0)
+    {
+        // clang-format off
+        EXPECT_ROCBLAS_STATUS(rocblas_grouped_ger_fn(handle, group_count, nullptr, nullptr,
+                              nullptr, nullptr, incx, nullptr, incy, nullptr, nullptr, type),
+                              group_count < 0 ? rocblas_status_invalid_size
+                                              : rocblas_status_success);
+        // clang-format on
+        return;
+    }
+
+    // Build a group of uneven problems from the base sizes: every member
+    // shrinks by one in each dimension so no two shapes are identical
+    std::vector<rocblas_int> m(group_count), n(group_count), lda(group_count);
+    std::vector<size_t>      off_a(group_count), off_x(group_count), off_y(group_count);
+
+    size_t total_a = 0, total_x = 0, total_y = 0;
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        m[i]   = std::max(rocblas_int(arg.M - i), rocblas_int(1));
+        n[i]   = std::max(rocblas_int(arg.N - i), rocblas_int(1));
+        lda[i] = m[i] + (i % 2);
+
+        off_a[i] = total_a;
+        off_x[i] = total_x;
+        off_y[i] = total_y;
+
+        total_a += size_t(lda[i]) * n[i];
+        total_x += size_t(m[i]) * std::abs(incx);
+        total_y += size_t(n[i]) * std::abs(incy);
+    }
+
+    // Allocate host memory; every group member lives at its offset in one block
+    HOST_MEMCHECK(host_vector<T>, hA, (total_a));
+    HOST_MEMCHECK(host_vector<T>, hA_gold, (total_a));
+    HOST_MEMCHECK(host_vector<T>, hx, (total_x));
+    HOST_MEMCHECK(host_vector<T>, hy, (total_y));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dA, (total_a));
+    DEVICE_MEMCHECK(device_vector<T>, dx, (total_x));
+    DEVICE_MEMCHECK(device_vector<T>, dy, (total_y));
+    DEVICE_MEMCHECK(device_vector<T>, d_alpha, (1));
+
+    // Initialize data on host memory
+    rocblas_seedrand();
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        rocblas_init<T>(hA.data() + off_a[i], m[i], n[i], lda[i]);
+        rocblas_init<T>(hx.data() + off_x[i], 1, m[i], std::abs(incx));
+        rocblas_init<T>(hy.data() + off_y[i], 1, n[i], std::abs(incy));
+    }
+
+    hA_gold = hA;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    // Host arrays of per-group device pointers
+    std::vector<const void*> x(group_count), y(group_count);
+    std::vector<void*>       a(group_count);
+    for(rocblas_int i = 0; i < group_count; i++)
+    {
+        x[i] = (const T*)dx + off_x[i];
+        y[i] = (const T*)dy + off_y[i];
+        a[i] = (T*)dA + off_a[i];
+    }
+
+    double cpu_time_used   = 0.0;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        HOST_MEMCHECK(host_vector<T>, hA_1, (total_a));
+        HOST_MEMCHECK(host_vector<T>, hA_2, (total_a));
+
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_ger_fn(
+                handle, group_count, m.data(), n.data(), &h_alpha, x.data(), incx, y.data(), incy, a.data(), lda.data(), type));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hA_1.transfer_from(dA));
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(dA.transfer_from(hA)); // restore the original A
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_ger_fn(
+                handle, group_count, m.data(), n.data(), d_alpha, x.data(), incx, y.data(), incy, a.data(), lda.data(), type));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hA_2.transfer_from(dA));
+        }
+
+        // CPU BLAS, one reference ger per group member
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int i = 0; i < group_count; i++)
+            ref_ger<T, false>(m[i],
+                              n[i],
+                              h_alpha,
+                              hx.data() + off_x[i],
+                              incx,
+                              hy.data() + off_y[i],
+                              incy,
+                              hA_gold.data() + off_a[i],
+                              lda[i]);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // the kernel fuses alpha * x * y in one expression, so the rounding
+        // can differ from the reference by an ulp or two
+        const double tol = 2 * sum_error_tolerance<T>;
+
+        for(int mode = 0; mode < 2; mode++)
+        {
+            if(mode == 0 && !arg.pointer_mode_host)
+                continue;
+            if(mode == 1 && !arg.pointer_mode_device)
+                continue;
+
+            host_vector<T>& hA_res = mode == 0 ? hA_1 : hA_2;
+            double&         error  = mode == 0 ? rocblas_error_1 : rocblas_error_2;
+
+            for(rocblas_int i = 0; i < group_count; i++)
+            {
+                if(arg.unit_check)
+                    near_check_general<T>(m[i],
+                                          n[i],
+                                          lda[i],
+                                          hA_gold.data() + off_a[i],
+                                          hA_res.data() + off_a[i],
+                                          tol);
+
+                if(arg.norm_check)
+                {
+                    auto err = std::abs(norm_check_general<T>('F',
+                                                              m[i],
+                                                              n[i],
+                                                              lda[i],
+                                                              hA_gold.data() + off_a[i],
+                                                              hA_res.data() + off_a[i]));
+                    error    = err > error ? err : error;
+                }
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_grouped_ger_fn(
+                handle, group_count, m.data(), n.data(), &h_alpha, x.data(), incx, y.data(), incy, a.data(), lda.data(), type));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        double gflops = 0.0;
+        for(rocblas_int i = 0; i < group_count; i++)
+            gflops += ger_gflop_count<T>(m[i], n[i]);
+
+        ArgumentModel<e_M, e_N, e_alpha, e_incx, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gflops,
+            ArgumentLogging::NA_value,
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
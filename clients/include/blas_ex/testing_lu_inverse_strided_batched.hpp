@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "lapack_utilities.hpp"
+#include "testing_common.hpp"
+
+template <typename T>
+void testing_lu_inverse_strided_batched_bad_arg(const Arguments& arg)
+{
+    // lu_inverse_strided_batched is a beta API without Fortran or ILP64
+    // bindings; call the C entry point directly
+    rocblas_local_handle handle{arg};
+
+    const rocblas_int    N           = 32;
+    const rocblas_int    lda         = 32;
+    const rocblas_int    ldinvA      = 32;
+    const rocblas_stride stride_a    = rocblas_stride(lda) * N;
+    const rocblas_stride stride_inva = rocblas_stride(ldinvA) * N;
+    const rocblas_int    batch_count = 2;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dA, (N, N, lda, stride_a, batch_count));
+    DEVICE_MEMCHECK(
+        device_strided_batch_matrix<T>, dinvA, (N, N, ldinvA, stride_inva, batch_count));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              nullptr, N, dA, lda, stride_a, dinvA, ldinvA, stride_inva, batch_count, type),
+                          rocblas_status_invalid_handle);
+
+    // only f32/f64 real and complex are served; the datatype is validated
+    // before anything else
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_lu_inverse_strided_batched(handle,
+                                           N,
+                                           dA,
+                                           lda,
+                                           stride_a,
+                                           dinvA,
+                                           ldinvA,
+                                           stride_inva,
+                                           batch_count,
+                                           rocblas_datatype_f16_r),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, -1, dA, lda, stride_a, dinvA, ldinvA, stride_inva, batch_count, type),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, N, dA, N - 1, stride_a, dinvA, ldinvA, stride_inva, batch_count, type),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, N, dA, lda, stride_a, dinvA, N - 1, stride_inva, batch_count, type),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, N, dA, lda, stride_a, dinvA, ldinvA, stride_inva, -1, type),
+                          rocblas_status_invalid_size);
+
+    // quick return: no work, so null pointers are permitted
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_lu_inverse_strided_batched(
+            handle, 0, nullptr, lda, stride_a, nullptr, ldinvA, stride_inva, batch_count, type),
+        rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, N, nullptr, lda, stride_a, nullptr, ldinvA, stride_inva, 0, type),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, N, nullptr, lda, stride_a, dinvA, ldinvA, stride_inva, batch_count, type),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_lu_inverse_strided_batched(
+                              handle, N, dA, lda, stride_a, nullptr, ldinvA, stride_inva, batch_count, type),
+                          rocblas_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_lu_inverse_strided_batched(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int N           = arg.N;
+    rocblas_int lda         = arg.lda;
+    rocblas_int ldinvA      = arg.ldb; // Arguments has no dedicated field for ldinvA
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_stride stride_a    = rocblas_stride(lda) * N;
+    rocblas_stride stride_inva = rocblas_stride(ldinvA) * N;
+
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+
+    if(N == 0 || batch_count <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_lu_inverse_strided_batched(handle,
+                                               N,
+                                               nullptr,
+                                               lda,
+                                               stride_a,
+                                               nullptr,
+                                               ldinvA,
+                                               stride_inva,
+                                               batch_count,
+                                               type),
+            batch_count < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Allocate host memory
+    HOST_MEMCHECK(host_strided_batch_matrix<T>, hLU, (N, N, lda, stride_a, batch_count));
+    HOST_MEMCHECK(
+        host_strided_batch_matrix<T>, hInv_gold, (N, N, ldinvA, stride_inva, batch_count));
+    HOST_MEMCHECK(host_strided_batch_matrix<T>, hInv_1, (N, N, ldinvA, stride_inva, batch_count));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_strided_batch_matrix<T>, dA, (N, N, lda, stride_a, batch_count));
+    DEVICE_MEMCHECK(
+        device_strided_batch_matrix<T>, dinvA, (N, N, ldinvA, stride_inva, batch_count));
+
+    // Build packed LU factors directly: a unit lower triangle with entries of
+    // magnitude O(1/N) and an upper triangle with a dominant diagonal, so the
+    // implied matrix is well conditioned and its inverse has O(1) entries.
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                T v;
+                if(i == j)
+                    v = T(1.0 + 0.25 * ((i + b) % 4));
+                else
+                    v = T((((i * 7 + j * 13 + b * 3) % 9) - 4) / (8.0 * N));
+                hLU[b][size_t(j) * lda + i] = v;
+            }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hLU));
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU reference: invert the two triangles with LAPACK and multiply
+        cpu_time_used = get_time_us_no_sync();
+
+        HOST_MEMCHECK(host_matrix<T>, hUinv, (N, N, N));
+        HOST_MEMCHECK(host_matrix<T>, hLinv, (N, N, N));
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            // unpack the triangles into full matrices
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < N; i++)
+                {
+                    T v                      = hLU[b][size_t(j) * lda + i];
+                    hUinv[0][size_t(j) * N + i] = i <= j ? v : T(0);
+                    hLinv[0][size_t(j) * N + i] = i > j ? v : i == j ? T(1) : T(0);
+                }
+
+            lapack_xtrtri<T>('U', 'N', N, hUinv, N);
+            lapack_xtrtri<T>('L', 'U', N, hLinv, N);
+
+            // inv(LU) = inv(U) * inv(L)
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < N; i++)
+                    hInv_gold[b][size_t(j) * ldinvA + i] = T(0);
+            ref_gemm<T>(rocblas_operation_none,
+                        rocblas_operation_none,
+                        N,
+                        N,
+                        N,
+                        T(1),
+                        hUinv,
+                        N,
+                        hLinv,
+                        N,
+                        T(0),
+                        hInv_gold[b],
+                        ldinvA);
+        }
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        CHECK_ROCBLAS_ERROR(rocblas_lu_inverse_strided_batched(
+            handle, N, dA, lda, stride_a, dinvA, ldinvA, stride_inva, batch_count, type));
+
+        CHECK_HIP_ERROR(hInv_1.transfer_from(dinvA));
+
+        // two triangular inversions plus a triangular multiply accumulate a
+        // little more error than a single trtri
+        const double tol = 3.0 * trtri_tolerance<T>(N);
+        if(arg.unit_check)
+            near_check_general<T>(N, N, ldinvA, stride_inva, hInv_gold, hInv_1, batch_count, tol);
+
+        double rocblas_error = 0.0;
+        if(arg.norm_check)
+            rocblas_error = std::abs(norm_check_general<T>(
+                'F', N, N, ldinvA, stride_inva, hInv_gold, hInv_1, batch_count));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_lu_inverse_strided_batched(
+                handle, N, dA, lda, stride_a, dinvA, ldinvA, stride_inva, batch_count, type));
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_lu_inverse_strided_batched(
+                handle, N, dA, lda, stride_a, dinvA, ldinvA, stride_inva, batch_count, type));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            // two trtri passes and one trmm, all n x n
+            (2.0 * trtri_gflop_count<T>(N) + trmm_gflop_count<T>(N, N, rocblas_side_right))
+                * batch_count,
+            ArgumentLogging::NA_value,
+            cpu_time_used);
+    }
+}
@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// normalize is a beta API without Fortran or ILP64 bindings; map the C entry
+// points directly
+template <typename T>
+static auto rocblas_normalize_fn = nullptr;
+template <>
+static auto rocblas_normalize_fn<float> = rocblas_snormalize;
+template <>
+static auto rocblas_normalize_fn<double> = rocblas_dnormalize;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_normalize_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int N    = 100;
+    rocblas_int incx = 1;
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_normalize_fn<T>(nullptr, N, dx, incx),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_normalize_fn<T>(handle, N, nullptr, incx),
+                          rocblas_status_invalid_pointer);
+
+    // If N <= 0 or incx <= 0, the call is a no-op and X can be nullptr
+    EXPECT_ROCBLAS_STATUS(rocblas_normalize_fn<T>(handle, 0, nullptr, incx),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_normalize_fn<T>(handle, N, nullptr, 0), rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_normalize_fn<T>(handle, N, nullptr, -1), rocblas_status_success);
+}
+
+template <typename T>
+void testing_normalize(const Arguments& arg)
+{
+    rocblas_int N    = arg.N;
+    rocblas_int incx = arg.incx;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || incx <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_normalize_fn<T>(handle, N, nullptr, incx),
+                              rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    HOST_MEMCHECK(host_vector<T>, hx, (N, incx));
+    HOST_MEMCHECK(host_vector<T>, hx_gold, (N, incx));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dx, (N, incx));
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+
+    hx_gold = hx;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    double cpu_time_used;
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_normalize_fn<T>(handle, N, dx, incx));
+        handle.post_test(arg);
+
+        CHECK_HIP_ERROR(hx.transfer_from(dx));
+
+        // CPU BLAS: x = x / ||x||_2
+        cpu_time_used = get_time_us_no_sync();
+
+        T norm;
+        ref_nrm2<T>(N, (T*)hx_gold, incx, &norm);
+        if(norm > T(0))
+            ref_scal<T>(N, T(1) / norm, (T*)hx_gold, incx);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The device reduction accumulates the squared norm in a different
+        // order than the reference, so the scaled vector is checked with a
+        // reduction-sized tolerance
+        const double tol = N * sum_error_tolerance<T>;
+
+        if(arg.unit_check)
+            near_check_general<T>(1, N, incx, hx_gold, hx, tol);
+
+        if(arg.norm_check)
+            rocblas_error = norm_check_general<T>('F', 1, N, incx, hx_gold, hx);
+
+        // a zero vector has no direction and must be left unchanged
+        HOST_MEMCHECK(host_vector<T>, hzero, (N, incx));
+        for(size_t i = 0; i < hzero.size(); i++)
+            hzero[i] = T(0);
+        CHECK_HIP_ERROR(dx.transfer_from(hzero));
+        CHECK_ROCBLAS_ERROR(rocblas_normalize_fn<T>(handle, N, dx, incx));
+        CHECK_HIP_ERROR(hx.transfer_from(dx));
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, incx, hzero, hx);
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_normalize_fn<T>(handle, N, dx, incx));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // one fused pass: nrm2 flops plus scal flops, scal memory traffic
+        ArgumentModel<e_N, e_incx>{}.log_args<T>(rocblas_cout,
+                                                 arg,
+                                                 gpu_time_used,
+                                                 nrm2_gflop_count<T>(N) + scal_gflop_count<T, T>(N),
+                                                 scal_gbyte_count<T>(N),
+                                                 cpu_time_used,
+                                                 rocblas_error,
+                                                 0.0);
+    }
+}
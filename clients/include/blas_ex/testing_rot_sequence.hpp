@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// rot_sequence is a beta API without Fortran or ILP64 bindings; map the C
+// entry points directly
+template <typename T>
+static auto rocblas_rot_sequence_fn = nullptr;
+template <>
+static auto rocblas_rot_sequence_fn<float> = rocblas_srot_sequence;
+template <>
+static auto rocblas_rot_sequence_fn<double> = rocblas_drot_sequence;
+
+/* ============================================================================================ */
+template <typename T>
+void testing_rot_sequence_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int K    = 8;
+    rocblas_int incx = 1;
+
+    // Allocate device memory; the vector spans K + 1 elements
+    DEVICE_MEMCHECK(device_vector<T>, dx, (K + 1, incx));
+    DEVICE_MEMCHECK(device_vector<T>, dc, (K, 1));
+    DEVICE_MEMCHECK(device_vector<T>, ds, (K, 1));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(nullptr, K, dx, incx, dc, ds),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(handle, -1, dx, incx, dc, ds),
+                          rocblas_status_invalid_size);
+
+    // If K == 0, the call is a no-op and all pointers may be null
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(handle, 0, nullptr, incx, nullptr, nullptr),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(handle, K, nullptr, incx, dc, ds),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(handle, K, dx, incx, nullptr, ds),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(handle, K, dx, incx, dc, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_rot_sequence(const Arguments& arg)
+{
+    rocblas_int K    = arg.K;
+    rocblas_int incx = arg.incx;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(K <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_fn<T>(handle, K, nullptr, incx, nullptr, nullptr),
+                              K < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_int abs_incx = incx >= 0 ? incx : -incx;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory; the vector spans K + 1 elements
+    HOST_MEMCHECK(host_vector<T>, hx, (K + 1, incx));
+    HOST_MEMCHECK(host_vector<T>, hx_gold, (K + 1, incx));
+    HOST_MEMCHECK(host_vector<T>, hc, (K, 1));
+    HOST_MEMCHECK(host_vector<T>, hs, (K, 1));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_vector<T>, dx, (K + 1, incx));
+    DEVICE_MEMCHECK(device_vector<T>, dc, (K, 1));
+    DEVICE_MEMCHECK(device_vector<T>, ds, (K, 1));
+
+    // Initialize data on host memory; each (c, s) pair is a proper rotation
+    // built from a random angle
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hc, arg, rocblas_client_never_set_nan, false);
+    for(rocblas_int i = 0; i < K; i++)
+    {
+        T theta = hc[i];
+        hc[i]   = std::cos(theta);
+        hs[i]   = std::sin(theta);
+    }
+
+    hx_gold = hx;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+
+    double cpu_time_used;
+    double rocblas_error = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_rot_sequence_fn<T>(handle, K, dx, incx, dc, ds));
+        handle.post_test(arg);
+
+        CHECK_HIP_ERROR(hx.transfer_from(dx));
+
+        // CPU reference: apply the rotations in ascending order; with a
+        // negative increment the chain starts at the far end of the buffer
+        cpu_time_used = get_time_us_no_sync();
+
+        T* x_ref = (T*)hx_gold + (incx < 0 ? size_t(-incx) * K : 0);
+        for(rocblas_int i = 0; i < K; i++)
+        {
+            T xi                     = x_ref[i * int64_t(incx)];
+            T xi1                    = x_ref[(i + 1) * int64_t(incx)];
+            x_ref[i * int64_t(incx)] = hc[i] * xi + hs[i] * xi1;
+            x_ref[(i + 1) * int64_t(incx)] = hc[i] * xi1 - hs[i] * xi;
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // the reference applies the same operations in the same order, so the
+        // results match exactly
+        if(arg.unit_check)
+            unit_check_general<T>(1, K + 1, abs_incx, hx_gold, hx);
+
+        if(arg.norm_check)
+            rocblas_error = norm_check_general<T>('F', 1, K + 1, abs_incx, hx_gold, hx);
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_rot_sequence_fn<T>(handle, K, dx, incx, dc, ds));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // 4 multiplies and 2 adds per rotation; x is read and written once,
+        // c and s are read once
+        double gflops      = 6.0 * K / 1e9;
+        double gbyte_count = (2.0 * (K + 1) + 2.0 * K) * sizeof(T) / 1e9;
+
+        ArgumentModel<e_K, e_incx>{}.log_args<T>(rocblas_cout,
+                                                 arg,
+                                                 gpu_time_used,
+                                                 gflops,
+                                                 gbyte_count,
+                                                 cpu_time_used,
+                                                 rocblas_error,
+                                                 0.0);
+    }
+}
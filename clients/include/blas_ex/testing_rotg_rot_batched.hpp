@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// rotg_rot_batched is a beta API without Fortran or ILP64 bindings, so the C
+// entry points are called directly
+template <typename T>
+static auto rocblas_rotg_rot_batched_fn = nullptr;
+template <>
+ROCBLAS_CLANG_STATIC auto rocblas_rotg_rot_batched_fn<float> = rocblas_srotg_rot_batched;
+template <>
+ROCBLAS_CLANG_STATIC auto rocblas_rotg_rot_batched_fn<double> = rocblas_drotg_rot_batched;
+
+template <typename T>
+void testing_rotg_rot_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_fn = rocblas_rotg_rot_batched_fn<T>;
+
+    rocblas_int N           = 10;
+    rocblas_int incx        = 1;
+    rocblas_int incy        = 1;
+    rocblas_int batch_count = 5;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory; every argument lives in device memory
+    device_batch_vector<T> da(1, 1, batch_count);
+    device_batch_vector<T> db(1, 1, batch_count);
+    device_batch_vector<T> dc(1, 1, batch_count);
+    device_batch_vector<T> ds(1, 1, batch_count);
+    device_batch_vector<T> dx(N, incx, batch_count);
+    device_batch_vector<T> dy(N, incy, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(da.memcheck());
+    CHECK_DEVICE_ALLOCATION(db.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(nullptr, N, da.ptr_on_device(), db.ptr_on_device(),
+                          dc.ptr_on_device(), ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, -1, da.ptr_on_device(), db.ptr_on_device(),
+                          dc.ptr_on_device(), ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, da.ptr_on_device(), db.ptr_on_device(),
+                          dc.ptr_on_device(), ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, -1),
+                          rocblas_status_invalid_size);
+
+    // a zero batch count returns before any of the arrays are read
+    CHECK_ROCBLAS_ERROR(rocblas_fn(handle, N, nullptr, nullptr, nullptr, nullptr,
+                        nullptr, incx, nullptr, incy, 0));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, nullptr, db.ptr_on_device(),
+                          dc.ptr_on_device(), ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, da.ptr_on_device(), nullptr,
+                          dc.ptr_on_device(), ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, da.ptr_on_device(), db.ptr_on_device(),
+                          nullptr, ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, da.ptr_on_device(), db.ptr_on_device(),
+                          dc.ptr_on_device(), nullptr, dx.ptr_on_device(), incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, da.ptr_on_device(), db.ptr_on_device(),
+                          dc.ptr_on_device(), ds.ptr_on_device(), nullptr, incx,
+                          dy.ptr_on_device(), incy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, da.ptr_on_device(), db.ptr_on_device(),
+                          dc.ptr_on_device(), ds.ptr_on_device(), dx.ptr_on_device(), incx,
+                          nullptr, incy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    // N == 0 still generates a, b, c, s, so only the vectors may be absent
+    CHECK_ROCBLAS_ERROR(rocblas_fn(handle, 0, da.ptr_on_device(), db.ptr_on_device(),
+                        dc.ptr_on_device(), ds.ptr_on_device(), nullptr, incx,
+                        nullptr, incy, batch_count));
+    // clang-format on
+}
+
+template <typename T>
+void testing_rotg_rot_batched(const Arguments& arg)
+{
+    auto rocblas_fn = rocblas_rotg_rot_batched_fn<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int incy        = arg.incy;
+    rocblas_int batch_count = arg.batch_count;
+
+    rocblas_local_handle handle{arg};
+
+    double gpu_time_used, cpu_time_used;
+    double norm_error = 0.0;
+
+    // the generated c and s differ from the reference by rounding, and that
+    // difference is amplified by the magnitude of the rotated elements
+    const double rel_error        = std::numeric_limits<T>::epsilon() * 100;
+    const double rel_error_vector = rel_error * 40;
+
+    // check to prevent undefined memory allocation error
+    if(N < 0 || batch_count <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_fn(handle, N, nullptr, nullptr, nullptr, nullptr,
+                                         nullptr, incx, nullptr, incy, batch_count),
+                              (N < 0 || batch_count < 0) ? rocblas_status_invalid_size
+                                                         : rocblas_status_success);
+        return;
+    }
+
+    rocblas_int abs_incx = incx < 0 ? -incx : incx;
+    rocblas_int abs_incy = incy < 0 ? -incy : incy;
+
+    // Naming: `h` is in CPU (host) memory(eg ha), `d` is in GPU (device) memory (eg da).
+    // Allocate host memory
+    host_batch_vector<T> ha(1, 1, batch_count);
+    host_batch_vector<T> hb(1, 1, batch_count);
+    host_batch_vector<T> hc(1, 1, batch_count);
+    host_batch_vector<T> hs(1, 1, batch_count);
+    host_batch_vector<T> hx(N, incx ? incx : 1, batch_count);
+    host_batch_vector<T> hy(N, incy ? incy : 1, batch_count);
+
+    host_batch_vector<T> ha_gold(1, 1, batch_count);
+    host_batch_vector<T> hb_gold(1, 1, batch_count);
+    host_batch_vector<T> hc_gold(1, 1, batch_count);
+    host_batch_vector<T> hs_gold(1, 1, batch_count);
+    host_batch_vector<T> hx_gold(N, incx ? incx : 1, batch_count);
+    host_batch_vector<T> hy_gold(N, incy ? incy : 1, batch_count);
+
+    // Initialize data on host memory
+    rocblas_init_vector(ha, arg, rocblas_client_never_set_nan, true);
+    rocblas_init_vector(hb, arg, rocblas_client_never_set_nan, false);
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, false);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false);
+
+    // reuse alpha and beta in place of a and b to keep number of arguments small
+    ha[0][0] = arg.get_alpha<T>();
+    hb[0][0] = arg.get_beta<T>();
+    for(size_t b = 0; b < batch_count; b++)
+    {
+        hc[b][0] = T(0);
+        hs[b][0] = T(0);
+    }
+
+    ha_gold.copy_from(ha);
+    hb_gold.copy_from(hb);
+    hc_gold.copy_from(hc);
+    hs_gold.copy_from(hs);
+    hx_gold.copy_from(hx);
+    hy_gold.copy_from(hy);
+
+    // CPU reference: generate each rotation, then apply it
+    cpu_time_used = get_time_us_no_sync();
+    for(size_t b = 0; b < batch_count; b++)
+    {
+        ref_rotg<T, T>(ha_gold[b], hb_gold[b], hc_gold[b], hs_gold[b]);
+        if(N > 0)
+            ref_rot(N, hx_gold[b], incx, hy_gold[b], incy, hc_gold[b], hs_gold[b]);
+    }
+    cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+    // Allocate device memory; every argument lives in device memory
+    device_batch_vector<T> da(1, 1, batch_count);
+    device_batch_vector<T> db(1, 1, batch_count);
+    device_batch_vector<T> dc(1, 1, batch_count);
+    device_batch_vector<T> ds(1, 1, batch_count);
+    device_batch_vector<T> dx(N, incx ? incx : 1, batch_count);
+    device_batch_vector<T> dy(N, incy ? incy : 1, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(da.memcheck());
+    CHECK_DEVICE_ALLOCATION(db.memcheck());
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // Transfer from CPU to GPU
+        CHECK_HIP_ERROR(da.transfer_from(ha));
+        CHECK_HIP_ERROR(db.transfer_from(hb));
+        CHECK_HIP_ERROR(dc.transfer_from(hc));
+        CHECK_HIP_ERROR(ds.transfer_from(hs));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_fn(handle,
+                                       N,
+                                       da.ptr_on_device(),
+                                       db.ptr_on_device(),
+                                       dc.ptr_on_device(),
+                                       ds.ptr_on_device(),
+                                       dx.ptr_on_device(),
+                                       incx,
+                                       dy.ptr_on_device(),
+                                       incy,
+                                       batch_count));
+        handle.post_test(arg);
+
+        host_batch_vector<T> ra(1, 1, batch_count);
+        host_batch_vector<T> rb(1, 1, batch_count);
+        host_batch_vector<T> rc(1, 1, batch_count);
+        host_batch_vector<T> rs(1, 1, batch_count);
+        host_batch_vector<T> rx(N, incx ? incx : 1, batch_count);
+        host_batch_vector<T> ry(N, incy ? incy : 1, batch_count);
+
+        // Transfer from GPU to CPU
+        CHECK_HIP_ERROR(ra.transfer_from(da));
+        CHECK_HIP_ERROR(rb.transfer_from(db));
+        CHECK_HIP_ERROR(rc.transfer_from(dc));
+        CHECK_HIP_ERROR(rs.transfer_from(ds));
+        CHECK_HIP_ERROR(rx.transfer_from(dx));
+        CHECK_HIP_ERROR(ry.transfer_from(dy));
+
+        if(arg.unit_check)
+        {
+            near_check_general<T>(1, 1, 1, ha_gold, ra, batch_count, rel_error);
+            near_check_general<T>(1, 1, 1, hb_gold, rb, batch_count, rel_error);
+            near_check_general<T>(1, 1, 1, hc_gold, rc, batch_count, rel_error);
+            near_check_general<T>(1, 1, 1, hs_gold, rs, batch_count, rel_error);
+            if(N > 0)
+            {
+                // negative increments touch the same elements from the other end
+                near_check_general<T>(
+                    1, N, abs_incx, hx_gold, rx, batch_count, rel_error_vector);
+                near_check_general<T>(
+                    1, N, abs_incy, hy_gold, ry, batch_count, rel_error_vector);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            norm_error = norm_check_general<T>('F', 1, 1, 1, ha_gold, ra, batch_count);
+            norm_error += norm_check_general<T>('F', 1, 1, 1, hb_gold, rb, batch_count);
+            norm_error += norm_check_general<T>('F', 1, 1, 1, hc_gold, rc, batch_count);
+            norm_error += norm_check_general<T>('F', 1, 1, 1, hs_gold, rs, batch_count);
+            if(N > 0)
+            {
+                norm_error
+                    += norm_check_general<T>('F', 1, N, abs_incx, hx_gold, rx, batch_count);
+                norm_error
+                    += norm_check_general<T>('F', 1, N, abs_incy, hy_gold, ry, batch_count);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_HIP_ERROR(da.transfer_from(ha));
+        CHECK_HIP_ERROR(db.transfer_from(hb));
+        CHECK_HIP_ERROR(dc.transfer_from(hc));
+        CHECK_HIP_ERROR(ds.transfer_from(hs));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_fn(handle,
+                                           N,
+                                           da.ptr_on_device(),
+                                           db.ptr_on_device(),
+                                           dc.ptr_on_device(),
+                                           ds.ptr_on_device(),
+                                           dx.ptr_on_device(),
+                                           incx,
+                                           dy.ptr_on_device(),
+                                           incy,
+                                           batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            ArgumentLogging::NA_value,
+            cpu_time_used,
+            norm_error,
+            0.0);
+    }
+}
@@ -0,0 +1,261 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "testing_common.hpp"
+
+// must match the ROCBLAS_TRSM_NB block size trsm_ex consumes invA with
+#define TRSM_INVERT_BLOCK 128
+
+template <typename T>
+void testing_trsm_ex_invert_bad_arg(const Arguments& arg)
+{
+    // trsm_ex_invert is a beta API without Fortran or ILP64 bindings; call
+    // the C entry point directly
+    rocblas_local_handle handle{arg};
+
+    const rocblas_fill     uplo = rocblas_fill_lower;
+    const rocblas_diagonal diag = rocblas_diagonal_non_unit;
+
+    const rocblas_int K   = 128;
+    const rocblas_int lda = 128;
+
+    const rocblas_datatype compute_type = rocblas_type2datatype<T>();
+
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (K, K, lda));
+    DEVICE_MEMCHECK(device_matrix<T>, dinvA, (TRSM_INVERT_BLOCK, TRSM_INVERT_BLOCK, 1));
+
+    const rocblas_int invA_size = TRSM_INVERT_BLOCK * K;
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(nullptr, uplo, diag, K, dA, lda, dinvA, invA_size, compute_type),
+        rocblas_status_invalid_handle);
+
+    // the compute type is dispatched before anything else
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(
+            handle, uplo, diag, K, dA, lda, dinvA, invA_size, rocblas_datatype_f16_r),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(
+            handle, rocblas_fill_full, diag, K, dA, lda, dinvA, invA_size, compute_type),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(handle, uplo, diag, -1, dA, lda, dinvA, invA_size, compute_type),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(handle, uplo, diag, K, dA, K - 1, dinvA, invA_size, compute_type),
+        rocblas_status_invalid_size);
+
+    // K == 0 is a quick return, even with null pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(
+            handle, uplo, diag, 0, nullptr, lda, nullptr, invA_size, compute_type),
+        rocblas_status_success);
+
+    // invA must hold at least TRSM_INVERT_BLOCK * K elements
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(
+            handle, uplo, diag, K, dA, lda, dinvA, invA_size - 1, compute_type),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(
+            handle, uplo, diag, K, nullptr, lda, dinvA, invA_size, compute_type),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_trsm_ex_invert(
+            handle, uplo, diag, K, dA, lda, nullptr, invA_size, compute_type),
+        rocblas_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_trsm_ex_invert(const Arguments& arg)
+{
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+
+    char char_side   = arg.side;
+    char char_uplo   = arg.uplo;
+    char char_transA = arg.transA;
+    char char_diag   = arg.diag;
+    T    alpha_h     = arg.alpha;
+
+    rocblas_side      side   = char2rocblas_side(char_side);
+    rocblas_fill      uplo   = char2rocblas_fill(char_uplo);
+    rocblas_operation transA = char2rocblas_operation(char_transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(char_diag);
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    const rocblas_datatype compute_type = rocblas_type2datatype<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_trsm_ex_invert(handle,
+                                   uplo,
+                                   diag,
+                                   K,
+                                   nullptr,
+                                   lda,
+                                   nullptr,
+                                   TRSM_INVERT_BLOCK * K,
+                                   compute_type),
+            K < 0 || lda < K || lda < 1 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    HOST_MEMCHECK(host_matrix<T>, hA, (K, K, lda));
+    HOST_MEMCHECK(host_matrix<T>, hB, (M, N, ldb));
+    HOST_MEMCHECK(host_matrix<T>, hX, (M, N, ldb));
+    HOST_MEMCHECK(host_matrix<T>, hXorB, (M, N, ldb));
+
+    // Allocate device memory
+    DEVICE_MEMCHECK(device_matrix<T>, dA, (K, K, lda));
+    DEVICE_MEMCHECK(device_matrix<T>, dXorB, (M, N, ldb));
+    DEVICE_MEMCHECK(device_matrix<T>, dinvA, (TRSM_INVERT_BLOCK, TRSM_INVERT_BLOCK, K));
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+    hB = hX;
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(diag == rocblas_diagonal_unit)
+    {
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+    }
+
+    // Calculate hB = hA*hX;
+    ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hB, ldb);
+
+    hXorB = hB;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dXorB.transfer_from(hXorB));
+
+    double max_err = 0.0;
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used  = 0.0;
+    double error_eps_multiplier    = 40;
+    double residual_eps_multiplier = 40;
+    double eps                     = std::numeric_limits<real_t<T>>::epsilon();
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        // one call replaces the per-block trtri_strided_batched recipe
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_ex_invert(
+            handle, uplo, diag, K, dA, lda, dinvA, TRSM_INVERT_BLOCK * K, compute_type));
+        handle.post_test(arg);
+
+        // trsm_ex must accept the packed inverse: calculate dXorB <- A^(-1) B
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_ex(handle,
+                                            side,
+                                            uplo,
+                                            transA,
+                                            diag,
+                                            M,
+                                            N,
+                                            &alpha_h,
+                                            dA,
+                                            lda,
+                                            dXorB,
+                                            ldb,
+                                            dinvA,
+                                            TRSM_INVERT_BLOCK * K,
+                                            compute_type));
+
+        CHECK_HIP_ERROR(hXorB.transfer_from(dXorB));
+
+        //computed result is in hXorB, so forward error is E = hX - hXorB
+        // calculate vector-induced-norm 1 of matrix E
+        max_err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB));
+        trsm_err_res_check<T>(max_err, M, error_eps_multiplier, eps);
+
+        // hXorB contains A * (calculated X), so res = A * (calculated X) - B
+        ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB, ldb);
+        max_err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB, hB));
+        trsm_err_res_check<T>(max_err, M, residual_eps_multiplier, eps);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_ex_invert(
+                handle, uplo, diag, K, dA, lda, dinvA, TRSM_INVERT_BLOCK * K, compute_type));
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // the inversion runs one trtri per full or partial diagonal block
+        rocblas_int blocks    = K / TRSM_INVERT_BLOCK;
+        rocblas_int remainder = K - blocks * TRSM_INVERT_BLOCK;
+        double      gflops    = blocks * trtri_gflop_count<T>(TRSM_INVERT_BLOCK);
+        if(remainder)
+            gflops += trtri_gflop_count<T>(remainder);
+
+        ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_lda, e_ldb>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            gflops,
+            ArgumentLogging::NA_value,
+            cpu_time_used);
+    }
+}
@@ -148,6 +148,19 @@ public:
         arg.graph_test ? rocblas_stream_end_capture() : NOOP;
 #endif
     }
+
+    // benchmark graph mode: end the capture started by pre_test and return an
+    // instantiated graph for timed replays instead of replaying it once
+    hipGraphExec_t rocblas_stream_end_capture_instantiate();
+
+    // stream the capture (and any replays) runs on, valid between
+    // pre_test and rocblas_graph_replay_cleanup
+    hipStream_t graph_stream() const
+    {
+        return m_graph_stream;
+    }
+
+    void rocblas_graph_replay_cleanup(hipGraphExec_t instance);
 };
 
 /* ============================================================================================ */
@@ -0,0 +1,56 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************/
+#pragma once
+
+#include <hip/hip_runtime.h>
+
+// Brackets the hot timing loop with tiny kernels that read the device's
+// constant-rate wall clock (s_memrealtime), so the reported duration is a
+// device-side timestamp delta at the clock's native granularity. Host-event
+// bracketing resolves to a few microseconds and pays a synchronization round
+// trip, both of which swamp small blas1/blas2 kernels. Enabled with
+// ROCBLAS_BENCH_DEVICE_TIMER=1; stays disabled on devices that do not report
+// a wall clock rate.
+class DeviceTimer
+{
+public:
+    bool enabled();
+
+    // Enqueue the start / stop timestamp reads on the stream bracketing the
+    // timed work; both are no-ops when the timer is disabled
+    void mark_start(hipStream_t stream);
+    void mark_stop(hipStream_t stream);
+
+    // Synchronize the stream and return stop - start in microseconds
+    double time_us(hipStream_t stream);
+
+    ~DeviceTimer();
+
+private:
+    void init();
+
+    int64_t* device_stamps = nullptr; // device memory: [0] start, [1] stop
+    double   us_per_tick   = 0.0;
+};
+
+DeviceTimer& getDeviceTimer();
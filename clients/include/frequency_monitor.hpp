@@ -41,6 +41,23 @@ public:
     virtual std::vector<double> getAllMedianSYSCLK()     = 0;
     virtual double              getAverageMEMCLK()       = 0;
     virtual double              getMedianMEMCLK()        = 0;
+
+    // board power sampled alongside the clocks; energy is power integrated
+    // over the sample intervals of the monitored region
+    virtual double getAveragePowerWatts() = 0;
+    virtual double getEnergyJoules()      = 0;
+
+    // deterministic-clock support: pin the device to a stable performance
+    // level for the measurement window; unlockClocks restores the level that
+    // was active before the lock. lockClocks returns false when the level
+    // cannot be changed (typically insufficient privileges)
+    virtual bool lockClocks()   = 0;
+    virtual void unlockClocks() = 0;
+
+    // true when the samples of the last monitored window show the clock
+    // dipping noticeably below its median, i.e. thermal or power throttling
+    // that makes the measured numbers unrepresentative
+    virtual bool throttlingDetected() = 0;
 };
 
 FrequencyMonitor& getFrequencyMonitor();
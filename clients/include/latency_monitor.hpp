@@ -0,0 +1,54 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************/
+#pragma once
+
+#include <vector>
+
+// Collects per-iteration latencies of the hot timing loop so rocblas-bench can
+// report distribution statistics (p50/p90/p99/max, standard deviation) instead
+// of only the mean, which hides clock-ramp and cache effects. Enabled with
+// ROCBLAS_BENCH_LATENCY=1; note that per-iteration timing synchronizes the
+// stream between calls, so the mean then includes that overhead.
+class LatencyMonitor
+{
+public:
+    bool enabled();
+
+    // Discard samples from a previous measurement
+    void start();
+
+    // Record one hot-loop iteration, in microseconds
+    void record(double us);
+
+    bool empty() const;
+
+    double percentile(double p); // p in [0, 100]; sorts samples on first use
+    double max();
+    double stddev() const;
+
+private:
+    std::vector<double> samples;
+    bool                sorted = false;
+};
+
+LatencyMonitor& getLatencyMonitor();
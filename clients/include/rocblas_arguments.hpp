@@ -181,6 +181,7 @@ struct Arguments
     bool HMM; // xnack+
     bool graph_test;
     bool repeatability_check;
+    bool device_check;
 
     int use_hipblaslt;
 
@@ -269,6 +270,7 @@ struct Arguments
     OPER(HMM) SEP                    \
     OPER(graph_test) SEP             \
     OPER(repeatability_check) SEP    \
+    OPER(device_check) SEP           \
     OPER(use_hipblaslt)
     // clang-format on
 
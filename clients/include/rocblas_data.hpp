@@ -32,8 +32,17 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -56,49 +65,152 @@ class RocBLAS_TestData
         return filename;
     }
 
-    // filter iterator
-    class iterator : public std::istream_iterator<Arguments>
+    // The binary Arguments file mapped read-only into memory. Large sweeps
+    // iterate the records in place out of the page cache instead of paying a
+    // buffered read per record per gtest category, so the data stage starts
+    // instantly. On Windows the file is slurped into a buffer instead.
+    class mapped_file
     {
-        bool (*const filter)(const Arguments&) = nullptr;
+        const char* m_data = nullptr;
+        size_t      m_size = 0;
+#ifndef WIN32
+        bool m_mapped = false;
+#else
+        std::vector<char> m_buffer;
+#endif
+
+    public:
+        explicit mapped_file(const std::string& path)
+        {
+#ifndef WIN32
+            int fd = open(path.c_str(), O_RDONLY);
+            if(fd < 0)
+                return;
+
+            struct stat sb;
+            if(!fstat(fd, &sb) && sb.st_size > 0)
+            {
+                void* addr = mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(addr != MAP_FAILED)
+                {
+                    m_data   = static_cast<const char*>(addr);
+                    m_size   = sb.st_size;
+                    m_mapped = true;
+                    madvise(addr, sb.st_size, MADV_SEQUENTIAL);
+                }
+            }
+            close(fd);
+#else
+            std::ifstream ifs(path, std::ifstream::in | std::ifstream::binary);
+            if(ifs)
+            {
+                m_buffer.assign(std::istreambuf_iterator<char>(ifs),
+                                std::istreambuf_iterator<char>());
+                m_data = m_buffer.data();
+                m_size = m_buffer.size();
+            }
+#endif
+        }
+
+        ~mapped_file()
+        {
+#ifndef WIN32
+            if(m_mapped)
+                munmap(const_cast<char*>(m_data), m_size);
+#endif
+        }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        const char* data() const
+        {
+            return m_data;
+        }
 
-        // Skip entries for which validate or filter returns false
-        void skip_filter()
+        size_t size() const
         {
-            static auto endIter = std::istream_iterator<Arguments>{};
+            return m_size;
+        }
+    };
 
-            // warning we may update the Arguments in validate, thus the const_cast
-            while(*this != endIter && !(const_cast<Arguments&>(**this).validate()))
-                ++*static_cast<std::istream_iterator<Arguments>*>(this);
+    // filter iterator over the mapped records; each record is copied out of
+    // the mapping since validate() may rewrite scan placeholders
+    class iterator
+    {
+        const char* m_pos                        = nullptr; // nullptr is the end iterator
+        const char* m_end                        = nullptr;
+        bool (*const m_filter)(const Arguments&) = nullptr;
+        Arguments m_args;
 
-            if(filter)
-                while(*this != endIter && !filter(**this))
-                    ++*static_cast<std::istream_iterator<Arguments>*>(this);
+        // Load the record under the cursor, skipping entries for which
+        // validate or filter returns false
+        void load_filter()
+        {
+            while(m_pos)
+            {
+                if(m_end - m_pos < ptrdiff_t(sizeof(Arguments)))
+                {
+                    m_pos = nullptr;
+                    break;
+                }
+                memcpy(&m_args, m_pos, sizeof(Arguments));
+                if(m_args.validate() && (!m_filter || m_filter(m_args)))
+                    break;
+                m_pos += sizeof(Arguments);
+            }
         }
 
     public:
-        // Constructor takes a filter and iterator
-        iterator(bool filter(const Arguments&), std::istream_iterator<Arguments> iter)
-            : std::istream_iterator<Arguments>(iter)
-            , filter(filter)
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Arguments;
+        using difference_type   = ptrdiff_t;
+        using pointer           = const Arguments*;
+        using reference         = const Arguments&;
+
+        // Constructor takes a filter and the record range
+        iterator(bool filter(const Arguments&), const char* begin, const char* end)
+            : m_pos(begin)
+            , m_end(end)
+            , m_filter(filter)
         {
-            skip_filter();
+            load_filter();
         }
 
         // Default end iterator and nullptr filter
         iterator() = default;
 
+        reference operator*() const
+        {
+            return m_args;
+        }
+
+        pointer operator->() const
+        {
+            return &m_args;
+        }
+
         // Preincrement iterator operator with filtering
         iterator& operator++()
         {
-            ++*static_cast<std::istream_iterator<Arguments>*>(this);
-            skip_filter();
+            m_pos += sizeof(Arguments);
+            load_filter();
             return *this;
         }
 
         // We do not need a postincrement iterator operator
-        // We delete it here so that the base class's isn't silently called
         // To implement it, use "auto old = *this; ++*this; return old;"
         iterator operator++(int) = delete;
+
+        bool operator==(const iterator& rhs) const
+        {
+            return m_pos == rhs.m_pos;
+        }
+
+        bool operator!=(const iterator& rhs) const
+        {
+            return !(*this == rhs);
+        }
     };
 
 public:
@@ -117,32 +229,32 @@ public:
     // begin() iterator which accepts an optional filter.
     static iterator begin(bool filter(const Arguments&) = nullptr)
     {
-        static std::ifstream* ifs = nullptr;
+        static mapped_file* map = nullptr;
+
+        // The leading signature block: header magic, one Arguments record
+        // holding the field byte pattern, trailer magic
+        static constexpr size_t front = 8 + sizeof(Arguments) + 8;
 
         // If this is the first time, or after test_cleanup::cleanup() has been called
-        if(!ifs)
+        if(!map)
         {
             std::string fileToOpen = filename();
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(
-                &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
-            if(!ifs || ifs->fail())
+            // Map the file and register the mapping to be torn down during cleanup
+            map = test_cleanup::allocate(&map, fileToOpen);
+            if(!map || !map->data() || map->size() < front)
             {
                 rocblas_cerr << "Cannot open: " << fileToOpen << std::endl;
                 exit(EXIT_FAILURE);
             }
-        }
 
-        // We re-seek the file back to position 0
-        ifs->clear();
-        ifs->seekg(0);
-
-        // Validate the data file format
-        Arguments::validate(*ifs);
+            // Validate the data file format once per mapping
+            std::istringstream ifs(std::string(map->data(), front));
+            Arguments::validate(ifs);
+        }
 
         // We create a filter iterator which will choose only the test cases we want right now.
         // This is to preserve Gtest structure while not creating no-op tests which "always pass".
-        return iterator(filter, std::istream_iterator<Arguments>(*ifs));
+        return iterator(filter, map->data() + front, map->data() + map->size());
     }
 
     // end() iterator
@@ -28,6 +28,7 @@
 #include "rocblas.h"
 #include "rocblas_math.hpp"
 #include "rocblas_random.hpp"
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
 #ifdef _OPENMP
@@ -1161,3 +1162,37 @@ void rocblas_copy_matrix(
         }
     }
 }
+
+/* ============================================================================================ */
+/*! \brief  device-side initialization: replicate a host-seeded random tile across a device
+    buffer with doubling device-to-device copies. Used by timing-only benchmark runs so large
+    problems are not dominated by a full host-side fill and transfer. */
+template <typename T>
+hipError_t rocblas_init_device_tiled(T rand_gen(), T* d, size_t n_elems, hipStream_t stream)
+{
+    if(!n_elems)
+        return hipSuccess;
+
+    // one tile of generator values, seeded by t_rocblas_rng as on the host path
+    constexpr size_t c_tile_elems = 1024;
+
+    size_t         tile = std::min(n_elems, c_tile_elems);
+    host_vector<T> h_tile(tile);
+    for(size_t i = 0; i < tile; i++)
+        h_tile[i] = rand_gen();
+
+    hipError_t status
+        = hipMemcpyAsync(d, (T*)h_tile, sizeof(T) * tile, hipMemcpyHostToDevice, stream);
+
+    // double the initialized prefix until the buffer is full
+    for(size_t filled = tile; filled < n_elems && status == hipSuccess; filled <<= 1)
+    {
+        size_t n = std::min(filled, n_elems - filled);
+        status = hipMemcpyAsync(d + filled, d, sizeof(T) * n, hipMemcpyDeviceToDevice, stream);
+    }
+
+    // h_tile is scoped to this call
+    if(status == hipSuccess)
+        status = hipStreamSynchronize(stream);
+    return status;
+}
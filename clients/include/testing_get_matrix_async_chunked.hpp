@@ -0,0 +1,220 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+#include <atomic>
+#include <cstring>
+
+// bookkeeping filled in by the chunk completion callback; the callback runs on
+// an internal runtime thread, so everything it touches is atomic
+struct rocblas_chunk_callback_ctx
+{
+    std::atomic<int64_t> calls{0};
+    std::atomic<int64_t> cols_seen{0};
+    std::atomic<int64_t> next_col{0};
+    std::atomic<bool>    in_order{true};
+    std::atomic<int64_t> max_chunk{0};
+};
+
+inline void rocblas_chunk_callback(int64_t first_col, int64_t cols, void* user_data)
+{
+    auto* ctx = static_cast<rocblas_chunk_callback_ctx*>(user_data);
+    ctx->calls++;
+    ctx->cols_seen += cols;
+    if(first_col != ctx->next_col.exchange(first_col + cols))
+        ctx->in_order = false;
+    int64_t prev_max = ctx->max_chunk;
+    while(cols > prev_max && !ctx->max_chunk.compare_exchange_weak(prev_max, cols))
+        ;
+}
+
+template <typename T>
+void testing_get_matrix_async_chunked(const Arguments& arg)
+{
+    auto rocblas_get_matrix_async_chunked_fn = rocblas_get_matrix_async_chunked;
+
+    int64_t rows = arg.M;
+    int64_t cols = arg.N;
+    int64_t lda  = arg.lda;
+    int64_t ldb  = arg.ldb;
+    int64_t ldd  = arg.ldd;
+    // the chunk width rides in K; 0 selects the internal default
+    int64_t chunk_cols = arg.K;
+
+    rocblas_local_handle handle{arg};
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalidGet
+        = rows < 0 || cols < 0 || ldd <= 0 || ldd < rows || ldb <= 0 || ldb < rows || chunk_cols < 0;
+
+    if(rows == 0 || cols == 0 || invalidGet)
+    {
+        // an empty transfer quick-returns before any of the size checks
+        EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_async_chunked_fn(rows,
+                                                                  cols,
+                                                                  sizeof(T),
+                                                                  nullptr,
+                                                                  ldd,
+                                                                  nullptr,
+                                                                  ldb,
+                                                                  chunk_cols,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  stream),
+                              (rows == 0 || cols == 0) ? rocblas_status_success
+                                                       : rocblas_status_invalid_size);
+        return;
+    }
+
+    // null source and destination are rejected after the size checks pass
+    EXPECT_ROCBLAS_STATUS(rocblas_get_matrix_async_chunked_fn(rows,
+                                                              cols,
+                                                              sizeof(T),
+                                                              nullptr,
+                                                              ldd,
+                                                              nullptr,
+                                                              ldb,
+                                                              chunk_cols,
+                                                              nullptr,
+                                                              nullptr,
+                                                              stream),
+                          rocblas_status_invalid_pointer);
+
+    // Naming: dD is in GPU (device) memory. hK is in CPU (host) memory
+    host_pinned_vector<T> hA(cols * size_t(lda)); // using vector layout to reuse pinned_vector
+    host_pinned_vector<T> hB(cols * size_t(ldb));
+    host_vector<T>        hB_gold(cols * size_t(ldb));
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hB_gold.memcheck());
+
+    double cpu_time_used;
+    double rocblas_error = 0.0;
+
+    // allocate memory on device
+    device_vector<T> dD(cols * size_t(ldd)); // vector layout
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+    rocblas_init<T>(hA, rows, cols, lda);
+    rocblas_init<T>(hB, rows, cols, ldb);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(T) * cols * ldd)); // vector layout
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_matrix_async(rows, cols, sizeof(T), hA, lda, dD, ldd, stream));
+
+        rocblas_chunk_callback_ctx ctx;
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_async_chunked_fn(rows,
+                                                                cols,
+                                                                sizeof(T),
+                                                                dD,
+                                                                ldd,
+                                                                hB,
+                                                                ldb,
+                                                                chunk_cols,
+                                                                rocblas_chunk_callback,
+                                                                &ctx,
+                                                                stream));
+
+        // reference calculation
+        cpu_time_used = get_time_us_no_sync();
+
+        for(size_t i2 = 0; i2 < cols; i2++)
+            for(size_t i1 = 0; i1 < rows; i1++)
+                hB_gold[i1 + i2 * ldb] = hA[i1 + i2 * lda];
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        hipStreamSynchronize(stream);
+
+        // every column must be reported exactly once, in ascending chunks no
+        // wider than the requested width
+        EXPECT_EQ(ctx.cols_seen.load(), cols);
+        EXPECT_TRUE(ctx.in_order.load());
+        if(chunk_cols)
+        {
+            EXPECT_LE(ctx.max_chunk.load(), chunk_cols);
+            EXPECT_EQ(ctx.calls.load(), (cols + chunk_cols - 1) / chunk_cols);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, ldb, hB, hB_gold);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', rows, cols, ldb, hB, hB_gold);
+        }
+
+        // a null callback is valid; the transfer alone must still land
+        memset(hB, 0, sizeof(T) * cols * ldb);
+        CHECK_ROCBLAS_ERROR(rocblas_get_matrix_async_chunked_fn(
+            rows, cols, sizeof(T), dD, ldd, hB, ldb, chunk_cols, nullptr, nullptr, stream));
+        hipStreamSynchronize(stream);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(rows, cols, ldb, hB, hB_gold);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_ROCBLAS_ERROR(rocblas_get_matrix_async_chunked_fn(
+                rows, cols, sizeof(T), dD, ldd, hB, ldb, chunk_cols, nullptr, nullptr, stream));
+        }
+
+        hipStreamSynchronize(stream);
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_K, e_ldb, e_ldd>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(rows, cols),
+            cpu_time_used,
+            rocblas_error);
+    }
+}
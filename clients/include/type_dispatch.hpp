@@ -152,6 +152,21 @@ auto rocblas_blas1_dispatch(const Arguments& arg)
             if(Ti == rocblas_datatype_f32_r || Ti == rocblas_datatype_f64_r)
                 return rocblas_simple_dispatch<TEST>(arg);
     }
+    else if(strstr(arg.function, "axpby"))
+    {
+        // s, d, c, z precisions
+        if(Ti == To && Ti == Tb && Ti == Tc)
+            if(Ti == rocblas_datatype_f32_r || Ti == rocblas_datatype_f64_r
+               || Ti == rocblas_datatype_f32_c || Ti == rocblas_datatype_f64_c)
+                return rocblas_simple_dispatch<TEST>(arg);
+    }
+    else if(strstr(arg.function, "axpy_dot"))
+    {
+        // s, d precisions
+        if(Ti == To && Ti == Tb && Ti == Tc)
+            if(Ti == rocblas_datatype_f32_r || Ti == rocblas_datatype_f64_r)
+                return rocblas_simple_dispatch<TEST>(arg);
+    }
     else if(strstr(arg.function, "axpy") || strstr(arg.function, "copy"))
     {
         // h, s, d, c, z precisions
@@ -270,7 +285,7 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
     const auto        Ta = arg.a_type, Tx = arg.b_type, Ty = arg.c_type, Tex = arg.compute_type;
     const std::string function = arg.function;
     const bool        is_axpy  = function == "axpy_ex" || function == "axpy_batched_ex"
-                         || function == "axpy_strided_batched_ex";
+                         || function == "axpy_strided_batched_ex" || function == "axpby_ex";
     const bool is_dot = function == "dot_ex" || function == "dot_batched_ex"
                         || function == "dot_strided_batched_ex" || function == "dotc_ex"
                         || function == "dotc_batched_ex" || function == "dotc_strided_batched_ex";
@@ -280,6 +295,7 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
                         || function == "rot_strided_batched_ex";
     const bool is_scal = function == "scal_ex" || function == "scal_batched_ex"
                          || function == "scal_strided_batched_ex";
+    const bool is_gemv = function == "gemv_ex";
 
     if(Ta == Tx && Tx == Ty && Ty == Tex)
     {
@@ -290,8 +306,8 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
         // hscal with f16_r compute (scal doesn't care about Ty)
         return rocblas_simple_dispatch<TEST>(arg);
     }
-    else if((is_rot || is_dot || is_axpy) && Ta == Tx && Tx == Ty && Ta == rocblas_datatype_f16_r
-            && Tex == rocblas_datatype_f32_r)
+    else if((is_rot || is_dot || is_axpy || is_gemv) && Ta == Tx && Tx == Ty
+            && Ta == rocblas_datatype_f16_r && Tex == rocblas_datatype_f32_r)
     {
         return TEST<rocblas_half, rocblas_half, rocblas_half, float>{}(arg);
     }
@@ -300,17 +316,29 @@ auto rocblas_blas1_ex_dispatch(const Arguments& arg)
     {
         return TEST<float, rocblas_half, rocblas_half, float>{}(arg);
     }
+    else if(is_gemv && Ta == Tx && Ta == rocblas_datatype_f16_r && Ty == rocblas_datatype_f32_r
+            && Tex == rocblas_datatype_f32_r)
+    {
+        // gemv_ex half in, single out
+        return TEST<rocblas_half, rocblas_half, float, float>{}(arg);
+    }
     else if((is_scal || is_nrm2) && Ta == Tx && Ta == rocblas_datatype_f16_r
             && Tex == rocblas_datatype_f32_r)
     {
         // half scal, nrm2
         return TEST<rocblas_half, rocblas_half, float>{}(arg);
     }
-    else if((is_rot || is_dot || is_axpy) && Ta == Tx && Tx == Ty && Ta == rocblas_datatype_bf16_r
-            && Tex == rocblas_datatype_f32_r)
+    else if((is_rot || is_dot || is_axpy || is_gemv) && Ta == Tx && Tx == Ty
+            && Ta == rocblas_datatype_bf16_r && Tex == rocblas_datatype_f32_r)
     {
         return TEST<rocblas_bfloat16, rocblas_bfloat16, rocblas_bfloat16, float>{}(arg);
     }
+    else if(is_gemv && Ta == Tx && Ta == rocblas_datatype_bf16_r && Ty == rocblas_datatype_f32_r
+            && Tex == rocblas_datatype_f32_r)
+    {
+        // gemv_ex bfloat16 in, single out
+        return TEST<rocblas_bfloat16, rocblas_bfloat16, float, float>{}(arg);
+    }
     else if((is_scal || is_nrm2) && Ta == Tx && Ta == rocblas_datatype_bf16_r
             && Tex == rocblas_datatype_f32_r)
     {
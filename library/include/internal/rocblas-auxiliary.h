@@ -82,6 +82,36 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        handle,
                                                        rocblas_atomics_mode* atomics_mode);
 
+/*! \brief Poll the accumulated numeric-check status of a handle
+ *  \details
+ *  When numeric checking runs in async mode (ROCBLAS_CHECK_NUMERICS includes
+ *  rocblas_check_numerics_mode_async), the checks accumulate their results in a
+ *  device-side flag block instead of synchronizing after every call. This
+ *  function synchronizes the handle's stream, reports the accumulated result
+ *  according to the handle's check_numerics mode, and clears the flags so the
+ *  next poll covers the following interval. Applications typically call it at
+ *  iteration boundaries.
+ *
+ *  Returns rocblas_status_check_numerics_fail if an abnormal value was seen and
+ *  the mode includes rocblas_check_numerics_mode_fail; rocblas_status_success
+ *  otherwise, including when no checks have run yet.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_numerics_status(rocblas_handle handle);
+
+/*! \brief Set the numeric-check mode of a handle, limited to function families
+ *  \details
+ *  Overrides the process-wide ROCBLAS_CHECK_NUMERICS environment configuration
+ *  for this handle. scope is a bitwise OR of rocblas_check_numerics_scope
+ *  values naming the function families the checks apply to (0 means all); call
+ *  sites outside the scope skip the checks entirely, so a deployment can guard
+ *  just the calls that ingest external data while everything else runs clean.
+ *  The ROCBLAS_CHECK_NUMERICS_STRIDE and ROCBLAS_CHECK_NUMERICS_RATE sampling
+ *  controls still apply within the scope.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_check_numerics_mode(rocblas_handle              handle,
+                                                              rocblas_check_numerics_mode mode,
+                                                              uint32_t                    scope);
+
 /*! \brief Set rocblas_math_mode
  */
 ROCBLAS_EXPORT rocblas_status rocblas_set_math_mode(rocblas_handle    handle,
@@ -392,6 +422,62 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_async_64(int64_t     rows,
                                                           int64_t     ldb,
                                                           hipStream_t stream);
 
+/*! \brief completion callback for rocblas_get_matrix_async_chunked; invoked on
+    an internal runtime thread once the chunk starting at column first_col and
+    spanning cols columns has fully landed in host memory */
+typedef void (*rocblas_matrix_chunk_fn)(int64_t first_col, int64_t cols, void* user_data);
+
+/*! \brief asynchronously copy matrix from device to host in column chunks
+     \details
+    rocblas_get_matrix_async_chunked behaves like rocblas_get_matrix_async but
+    enqueues the transfer as a pipeline of column chunks on the stream and, if
+    callback is non-null, invokes it as each chunk's data becomes visible on the
+    host. Downstream host processing of early columns can therefore begin after
+    the first chunk instead of after the full transfer. Callbacks run on an
+    internal runtime thread and must not call back into the HIP runtime.
+    Memory on the host must be allocated with hipHostMalloc or the transfer
+    will be synchronous.
+    @param[in]
+    rows        [int64_t]
+                number of rows in matrices
+    @param[in]
+    cols        [int64_t]
+                number of columns in matrices
+    @param[in]
+    elem_size   [int64_t]
+                number of bytes per element in the matrices
+    @param[in]
+    a           pointer to matrix on device
+    @param[in]
+    lda         [int64_t]
+                specifies the leading dimension of A, lda >= rows
+    @param[out]
+    b           pointer to matrix on host
+    @param[in]
+    ldb         [int64_t]
+                specifies the leading dimension of B, ldb >= rows
+    @param[in]
+    chunk_cols  [int64_t]
+                number of columns per chunk; 0 selects an internal default
+    @param[in]
+    callback    invoked per completed chunk; may be null
+    @param[in]
+    user_data   opaque pointer forwarded to every callback invocation
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_async_chunked(int64_t     rows,
+                                                               int64_t     cols,
+                                                               int64_t     elem_size,
+                                                               const void* a,
+                                                               int64_t     lda,
+                                                               void*       b,
+                                                               int64_t     ldb,
+                                                               int64_t     chunk_cols,
+                                                               rocblas_matrix_chunk_fn callback,
+                                                               void*                   user_data,
+                                                               hipStream_t             stream);
+
 /*******************************************************************************
  * Function to set start/stop event handlers (for internal use only)
  ******************************************************************************/
@@ -416,6 +502,8 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_solution_fitness_query(rocblas_handle
     Determines which performance metric will be used by Tensile when selecting the optimal solution
     for gemm problems. If a valid solution benchmarked for this performance metric does not exist
     for a problem, Tensile will default to a solution benchmarked for overall performance instead.
+    With rocblas_measured_performance_metric, achieved kernel times are recorded during live runs
+    and selection prefers the empirically fastest recent solution for each problem shape.
     @param[in]
     handle      [rocblas_handle]
                 the handle of device
@@ -46,6 +46,3346 @@
 extern "C" {
 #endif
 
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_gemm_autotune enables runtime autotuning of GEMM solution
+    selection on the handle. When top_n > 0, the first occurrence of each GEMM
+    shape times up to top_n candidate solutions (always including the
+    heuristic pick) on the handle's stream and keeps the fastest for all
+    subsequent calls with that shape. The winner is recorded in the solution
+    cache, and is persisted across processes when
+    ROCBLAS_TENSILE_SOLUTION_CACHE_PATH is set. Problems whose C and D
+    matrices alias (in-place GEMM) are not autotuned, since candidates cannot
+    be replayed safely. Passing top_n == 0 disables autotuning.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    top_n     [rocblas_int]
+              number of candidate solutions to time per shape; 0 disables.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_autotune(rocblas_handle handle, rocblas_int top_n);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_gemm_autotune queries the autotune setting on the handle.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    top_n     [rocblas_int *]
+              current number of candidate solutions timed per shape.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_gemm_autotune(rocblas_handle handle, rocblas_int* top_n);
+/*! @} */
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_grouped_gemm_ex performs a group of independent general matrix-matrix
+    operations:
+
+        D[i] = alpha * op(A[i]) * op(B[i]) + beta * C[i],  i = 0 .. group_count-1
+
+    where the problems may have different sizes and leading dimensions. The
+    size, leading dimension and matrix pointer arrays are host arrays with
+    group_count entries. All problems share the transpose operations, data
+    types and alpha/beta scalars. The group is dispatched in a single library
+    call, paying argument validation, logging and scalar staging once; solution
+    selection is cached per shape.
+
+    Supported types are the same as rocblas_gemm_ex.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    trans_a      [rocblas_operation]
+                 specifies the form of op( A[i] ).
+    @param[in]
+    trans_b      [rocblas_operation]
+                 specifies the form of op( B[i] ).
+    @param[in]
+    group_count  [rocblas_int]
+                 number of problems in the group.
+    @param[in]
+    m            host array of group_count matrix dimensions m.
+    @param[in]
+    n            host array of group_count matrix dimensions n.
+    @param[in]
+    k            host array of group_count matrix dimensions k.
+    @param[in]
+    alpha        [const void *]
+                 device pointer or host pointer specifying the scalar alpha.
+                 Same datatype as compute_type.
+    @param[in]
+    a            host array of group_count device pointers storing each matrix A[i].
+    @param[in]
+    a_type       [rocblas_datatype]
+                 specifies the datatype of the matrices A[i].
+    @param[in]
+    lda          host array of group_count leading dimensions of A[i].
+    @param[in]
+    b            host array of group_count device pointers storing each matrix B[i].
+    @param[in]
+    b_type       [rocblas_datatype]
+                 specifies the datatype of the matrices B[i].
+    @param[in]
+    ldb          host array of group_count leading dimensions of B[i].
+    @param[in]
+    beta         [const void *]
+                 device pointer or host pointer specifying the scalar beta.
+                 Same datatype as compute_type.
+    @param[in]
+    c            host array of group_count device pointers storing each matrix C[i].
+    @param[in]
+    c_type       [rocblas_datatype]
+                 specifies the datatype of the matrices C[i].
+    @param[in]
+    ldc          host array of group_count leading dimensions of C[i].
+    @param[out]
+    d            host array of group_count device pointers storing each matrix D[i].
+    @param[in]
+    d_type       [rocblas_datatype]
+                 specifies the datatype of the matrices D[i].
+    @param[in]
+    ldd          host array of group_count leading dimensions of D[i].
+    @param[in]
+    compute_type [rocblas_datatype]
+                 specifies the datatype of the computation.
+    @param[in]
+    algo         [rocblas_gemm_algo]
+                 enumerant specifying the algorithm type.
+    @param[in]
+    solution_index [int32_t]
+                 if algo is rocblas_gemm_algo_solution_index, this controls
+                 which solution is used for every group member; otherwise
+                 ignored.
+    @param[in]
+    flags        [uint32_t]
+                 optional gemm flags.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_grouped_gemm_ex(rocblas_handle     handle,
+                                                      rocblas_operation  trans_a,
+                                                      rocblas_operation  trans_b,
+                                                      rocblas_int        group_count,
+                                                      const rocblas_int* m,
+                                                      const rocblas_int* n,
+                                                      const rocblas_int* k,
+                                                      const void*        alpha,
+                                                      const void* const* a,
+                                                      rocblas_datatype   a_type,
+                                                      const rocblas_int* lda,
+                                                      const void* const* b,
+                                                      rocblas_datatype   b_type,
+                                                      const rocblas_int* ldb,
+                                                      const void*        beta,
+                                                      const void* const* c,
+                                                      rocblas_datatype   c_type,
+                                                      const rocblas_int* ldc,
+                                                      void* const*       d,
+                                                      rocblas_datatype   d_type,
+                                                      const rocblas_int* ldd,
+                                                      rocblas_datatype   compute_type,
+                                                      rocblas_gemm_algo  algo,
+                                                      int32_t            solution_index,
+                                                      uint32_t           flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_grouped_gemv performs a group of independent matrix-vector
+    operations:
+
+        y[i] = alpha * op(A[i]) * x[i] + beta * y[i],  i = 0 .. group_count-1
+
+    where the problems may have different dimensions and leading dimensions.
+    The size, leading dimension and pointer arrays are host arrays with
+    group_count entries. All problems share the transpose operation, the
+    increments and the alpha/beta scalars. The whole group executes in a
+    single kernel launch, so many small problems of uneven sizes run without
+    the padding a strided-batched call would need.
+
+    Currently implemented for type == rocblas_datatype_f32_r and
+    rocblas_datatype_f64_r.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    trans        [rocblas_operation]
+                 specifies the form of op( A[i] ).
+    @param[in]
+    group_count  [rocblas_int]
+                 number of problems in the group.
+    @param[in]
+    m            host array of group_count numbers of rows of each A[i].
+    @param[in]
+    n            host array of group_count numbers of columns of each A[i].
+    @param[in]
+    alpha        [const void *]
+                 device pointer or host pointer specifying the scalar alpha,
+                 of the same datatype as type.
+    @param[in]
+    a            host array of group_count device pointers storing each matrix A[i].
+    @param[in]
+    lda          host array of group_count leading dimensions of A[i].
+    @param[in]
+    x            host array of group_count device pointers storing each vector x[i].
+    @param[in]
+    incx         [rocblas_int]
+                 increment shared by the vectors x[i].
+    @param[in]
+    beta         [const void *]
+                 device pointer or host pointer specifying the scalar beta,
+                 of the same datatype as type.
+    @param[inout]
+    y            host array of group_count device pointers storing each vector y[i].
+    @param[in]
+    incy         [rocblas_int]
+                 increment shared by the vectors y[i].
+    @param[in]
+    type         [rocblas_datatype]
+                 specifies the datatype of the computation.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_grouped_gemv(rocblas_handle     handle,
+                                                   rocblas_operation  trans,
+                                                   rocblas_int        group_count,
+                                                   const rocblas_int* m,
+                                                   const rocblas_int* n,
+                                                   const void*        alpha,
+                                                   const void* const* a,
+                                                   const rocblas_int* lda,
+                                                   const void* const* x,
+                                                   rocblas_int        incx,
+                                                   const void*        beta,
+                                                   void* const*       y,
+                                                   rocblas_int        incy,
+                                                   rocblas_datatype   type);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_grouped_ger performs a group of independent rank-1 updates:
+
+        A[i] = A[i] + alpha * x[i] * y[i]**T,  i = 0 .. group_count-1
+
+    where the problems may have different dimensions and leading dimensions.
+    The size, leading dimension and pointer arrays are host arrays with
+    group_count entries. All problems share the increments and the alpha
+    scalar. The whole group executes in a single kernel launch.
+
+    Currently implemented for type == rocblas_datatype_f32_r and
+    rocblas_datatype_f64_r.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    group_count  [rocblas_int]
+                 number of problems in the group.
+    @param[in]
+    m            host array of group_count numbers of rows of each A[i].
+    @param[in]
+    n            host array of group_count numbers of columns of each A[i].
+    @param[in]
+    alpha        [const void *]
+                 device pointer or host pointer specifying the scalar alpha,
+                 of the same datatype as type.
+    @param[in]
+    x            host array of group_count device pointers storing each vector x[i].
+    @param[in]
+    incx         [rocblas_int]
+                 increment shared by the vectors x[i].
+    @param[in]
+    y            host array of group_count device pointers storing each vector y[i].
+    @param[in]
+    incy         [rocblas_int]
+                 increment shared by the vectors y[i].
+    @param[inout]
+    a            host array of group_count device pointers storing each matrix A[i].
+    @param[in]
+    lda          host array of group_count leading dimensions of A[i].
+    @param[in]
+    type         [rocblas_datatype]
+                 specifies the datatype of the computation.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_grouped_ger(rocblas_handle     handle,
+                                                  rocblas_int        group_count,
+                                                  const rocblas_int* m,
+                                                  const rocblas_int* n,
+                                                  const void*        alpha,
+                                                  const void* const* x,
+                                                  rocblas_int        incx,
+                                                  const void* const* y,
+                                                  rocblas_int        incy,
+                                                  void* const*       a,
+                                                  const rocblas_int* lda,
+                                                  rocblas_datatype   type);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_lu_inverse_strided_batched computes the inverse of each matrix in a
+    strided batch from its packed LU factors:
+
+        invA[i] = inv(U[i]) * inv(L[i]),  i = 0 .. batch_count-1
+
+    where A[i] holds both factors in the usual packed layout: U[i] in the upper
+    triangle including the diagonal, and the unit lower triangular L[i] below
+    the diagonal with its implicit unit diagonal not stored. The factors must
+    be unpivoted; for a pivoted factorization P*A = L*U the result is
+    inv(A)*inv(P) and the caller must apply the column permutation itself.
+
+    The triangular inversions and the triangular multiply are staged
+    internally, batched across all matrices, with every intermediate kept in
+    pooled device workspace; no intermediate results round-trip through host
+    memory.
+
+    Currently implemented for type == rocblas_datatype_f32_r,
+    rocblas_datatype_f64_r, rocblas_datatype_f32_c and rocblas_datatype_f64_c.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    n            [rocblas_int]
+                 number of rows and columns of each A[i].
+    @param[in]
+    A            [const void *]
+                 device pointer to the first LU factor matrix, of the same
+                 datatype as type.
+    @param[in]
+    lda          [rocblas_int]
+                 leading dimension of each A[i].
+    @param[in]
+    stride_a     [rocblas_stride]
+                 stride from A[i] to A[i+1].
+    @param[out]
+    invA         [void *]
+                 device pointer to the first output matrix. May not overlap A.
+    @param[in]
+    ldinvA       [rocblas_int]
+                 leading dimension of each invA[i].
+    @param[in]
+    stride_inva  [rocblas_stride]
+                 stride from invA[i] to invA[i+1].
+    @param[in]
+    batch_count  [rocblas_int]
+                 number of matrices in the batch.
+    @param[in]
+    type         [rocblas_datatype]
+                 specifies the datatype of the computation.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_lu_inverse_strided_batched(rocblas_handle   handle,
+                                                                 rocblas_int      n,
+                                                                 const void*      A,
+                                                                 rocblas_int      lda,
+                                                                 rocblas_stride   stride_a,
+                                                                 void*            invA,
+                                                                 rocblas_int      ldinvA,
+                                                                 rocblas_stride   stride_inva,
+                                                                 rocblas_int      batch_count,
+                                                                 rocblas_datatype type);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    Callback type used by rocBLAS to allocate device memory for its internal
+    workspace once installed with rocblas_set_device_memory_callbacks. Must
+    return a device pointer to at least size bytes on the handle's device, or
+    NULL on failure; user_data is the pointer registered alongside the
+    callbacks.
+ ******************************************************************************/
+typedef void* (*rocblas_device_memory_alloc_fn)(size_t size, void* user_data);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    Callback type used by rocBLAS to free device memory obtained from the
+    matching rocblas_device_memory_alloc_fn. size is the size that was passed
+    to the allocation callback for ptr.
+ ******************************************************************************/
+typedef void (*rocblas_device_memory_free_fn)(void* ptr, size_t size, void* user_data);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_device_memory_callbacks installs user-provided allocation and
+    free callbacks through which the handle obtains its device memory
+    workspace, in place of hipMalloc and hipFree. Applications which already
+    run their own caching device allocator can hand it rocBLAS's workspace
+    traffic instead of having two allocators compete for the same memory;
+    while callbacks are installed the handle's internal block pool is
+    disabled, so no memory is cached on the rocBLAS side.
+
+    Both callbacks must be provided together; installing both as NULL
+    restores the default allocator. Installing, replacing or removing
+    callbacks frees any workspace held from the outgoing allocator first, and
+    fails with rocblas_status_internal_error if workspace is currently in use
+    by a rocBLAS call.
+
+    The callbacks cover the rocBLAS-managed workspace and memory reserved
+    with rocblas_set_device_memory_size. They are not used for a workspace
+    the user supplies with rocblas_set_workspace, nor when stream-ordered
+    allocation is enabled with rocblas_set_stream_order_memory_allocation or
+    forced by hipGraph capture, where hipMallocAsync/hipFreeAsync are
+    required. Callbacks are invoked on the thread making the rocBLAS call and
+    must remain valid until they are replaced or the handle is destroyed.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    alloc_fn  [rocblas_device_memory_alloc_fn]
+              device memory allocation callback, or NULL.
+    @param[in]
+    free_fn   [rocblas_device_memory_free_fn]
+              device memory free callback, or NULL.
+    @param[in]
+    user_data [void *]
+              opaque pointer passed through to both callbacks.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_set_device_memory_callbacks(rocblas_handle                 handle,
+                                        rocblas_device_memory_alloc_fn alloc_fn,
+                                        rocblas_device_memory_free_fn  free_fn,
+                                        void*                          user_data);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_reserve_for_manifest sizes the device memory workspace once from a
+    manifest file of rocblas-bench records, one per line in the format that
+    rocblas_layer_mode_log_bench emits (trailing '#' comments are ignored),
+    e.g.
+
+        ./rocblas-bench -f trsm -r f64_r --side L --uplo U --transposeA N --diag N -m 1024 -n 512 --lda 1024 --ldb 1024
+
+    Each record is replayed through the device memory size query machinery and
+    the high-water size is reserved with rocblas_set_device_memory_size, so a
+    deployment whose calls are covered by the manifest performs no workspace
+    allocation at serve time; a call needing more than the reservation fails
+    with rocblas_status_memory_error instead of growing the workspace.
+
+    Supported functions are dot, nrm2, asum, gemv, symv, trsv and trsm in
+    precisions f32_r and f64_r; a manifest record outside this set returns
+    rocblas_status_not_implemented since the reservation could not honor its
+    guarantee.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    manifest_file [const char *]
+              path of the manifest file to read.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reserve_for_manifest(rocblas_handle handle,
+                                                           const char*    manifest_file);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_warmup_from_manifest executes each record of a manifest file (the
+    rocblas-bench record format of rocblas_reserve_for_manifest) once against
+    zero-filled scratch operands owned by the library, so every lazy
+    initialization a deployment would otherwise pay on its first real call —
+    workspace allocation, code-object load and solution selection — happens in
+    a dedicated warmup phase that never touches user data. Operand scratch is
+    allocated outside the handle's memory pool so the workspace high-water
+    mark reflects only what serve-time calls will need.
+
+    For every record a timing line is written to standard output naming the
+    record and the microseconds spent in each step: the workspace size query,
+    growing the workspace reservation (zero when the running high-water mark
+    already covers the record), and the synchronized first execution.
+
+    All records are attempted even after a failure; the return value is the
+    first per-record failure, or rocblas_status_success when every record
+    warmed up. The supported function and precision set is that of
+    rocblas_reserve_for_manifest.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    manifest_file [const char *]
+              path of the manifest file to read.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_warmup_from_manifest(rocblas_handle handle,
+                                                           const char*    manifest_file);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_device_scalar_peek_mode opts the handle in to caching the
+    values of device-resident alpha and beta scalars. In device pointer mode
+    the dispatch layer normally cannot see scalar values, so host-side
+    special-value optimizations (such as skipping work when beta is zero) are
+    forfeited. With peeking enabled, the first readback of each device scalar
+    pays a one-time stream synchronize and the value is cached keyed by its
+    device address; subsequent calls passing the same address branch on the
+    cached value with no synchronization.
+
+    By enabling this mode the application promises that the device memory
+    holding the scalars is not rewritten while cached; after rewriting it,
+    call rocblas_invalidate_device_scalar_cache before the next rocblas call
+    using those scalars. Enabling or re-enabling the mode also discards all
+    cached values.
+
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    enable      [rocblas_int]
+                nonzero enables the cache, zero disables it
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_device_scalar_peek_mode(rocblas_handle handle,
+                                                                  rocblas_int    enable);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_invalidate_device_scalar_cache discards every device scalar value
+    cached under rocblas_set_device_scalar_peek_mode, forcing the next call
+    that reads each scalar to fetch it from device memory again. Call this
+    after rewriting device memory that holds alpha or beta values previously
+    passed to the library.
+
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_invalidate_device_scalar_cache(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_destroy_handle_deferred releases a rocblas handle like
+    rocblas_destroy_handle, but without blocking the calling thread: the
+    teardown, including the implicit synchronization and the freeing of the
+    workspace, is queued to a library-internal background thread and runs once
+    work already submitted on the handle's stream has completed. Intended for
+    applications that create and destroy handles per session and cannot afford
+    the synchronous destruction stall on their request threads.
+
+    The handle must not be used again after this call. Work submitted through
+    the handle before the call completes normally; the handle's stream and
+    device must remain valid until that work has drained. Any pending
+    destructions are completed before the process exits.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_handle_deferred(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_gemm_auto_batch opts this handle into auto-batching of
+    rocblas_gemm_ex calls. An enabled call queues for up to window_us
+    microseconds waiting for concurrent calls (typically from other handles on
+    other threads) with the same shapes, types, leading dimensions, algorithm
+    selection, flags and scalar values; the group is then dispatched as a
+    single rocblas_grouped_gemm_ex launch, trading the bounded wait for
+    several-fold throughput when many small identical GEMMs arrive together.
+    Stream ordering is preserved: the grouped launch waits for each member's
+    prior work, and each member's stream waits for the grouped launch.
+
+    A window_us of 0 disables auto-batching (the default); max_group bounds
+    how many calls one group may absorb, and a group dispatches early when it
+    fills. Calls that find no partner within the window run exactly as
+    without this mode. Calls in a device memory size query are never queued.
+    Participating handles are expected to be configured uniformly, since the
+    grouped launch runs with the first arrival's handle settings.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    window_us [rocblas_int]
+              maximum time in microseconds a call may wait for partners;
+              0 disables auto-batching. Must not be negative.
+    @param[in]
+    max_group [rocblas_int]
+              maximum number of calls coalesced into one group. Must be at
+              least 1.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_auto_batch(rocblas_handle handle,
+                                                          rocblas_int    window_us,
+                                                          rocblas_int    max_group);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_hybrid_host_compute opts this handle into hybrid CPU+GPU
+    dispatch of tiny blas1 calls. A host-pointer-mode dot or axpy call with
+    unit increments and n at or below threshold_n stages its operands to the
+    host, computes there, and for axpy writes the result back through the
+    handle's stream, cutting the latency floor of such calls from the
+    kernel-launch and readback cost to the cost of a small transfer. The call
+    synchronizes the handle's stream, so it observes producers queued ahead
+    of it and stays ordered with work queued behind it; calls during stream
+    capture, with check_numerics enabled, or with non-unit increments always
+    take the device path.
+
+    A threshold_n of 0 (the default) disables the mode.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    threshold_n [rocblas_int]
+                largest n routed to the host; 0 disables hybrid dispatch.
+                Must not be negative.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_hybrid_host_compute(rocblas_handle handle,
+                                                              rocblas_int    threshold_n);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_begin_sequence starts recording a deferred blas1 sequence on this
+    handle. Until the matching rocblas_end_sequence, eligible blas1 calls --
+    host-pointer-mode sscal/dscal, saxpy/daxpy and scopy/dcopy -- queue a
+    descriptor and return immediately instead of launching; the whole
+    sequence then executes as one multi-op kernel, collapsing a burst of
+    independent small launches into a single one. Recorded operations must be
+    mutually independent: the kernel runs them concurrently, so no recorded
+    call may read or write memory another recorded call writes. Calls that
+    are not eligible (other functions, other datatypes, device pointer mode,
+    or check_numerics enabled) execute immediately in stream order as usual,
+    ahead of the recorded sequence.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_begin_sequence(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_end_sequence stops recording the sequence started by
+    rocblas_begin_sequence and executes the recorded operations as one kernel
+    launch on the handle's stream, asynchronously with respect to the host.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_end_sequence(rocblas_handle handle);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_copy_matrix_device_to_device copies the rows * cols matrix a_d on
+    device device_a to the matrix b_d on device device_b, asynchronously with
+    respect to the host on the given stream. Elements are elem_size bytes. On
+    the first copy between a pair of devices a direct peer mapping is
+    established when the hardware supports one, so the transfer runs over the
+    inter-GPU link rather than staging through host memory.
+
+    @param[in]
+    rows      [int64_t]
+              number of rows of each matrix.
+    @param[in]
+    cols      [int64_t]
+              number of columns of each matrix.
+    @param[in]
+    elem_size [int64_t]
+              size in bytes of each matrix element.
+    @param[in]
+    a_d       [const void *]
+              source matrix on device device_a.
+    @param[in]
+    device_a  [int]
+              device ID owning a_d.
+    @param[in]
+    lda       [int64_t]
+              leading dimension of a_d, lda >= rows.
+    @param[out]
+    b_d       [void *]
+              destination matrix on device device_b.
+    @param[in]
+    device_b  [int]
+              device ID owning b_d.
+    @param[in]
+    ldb       [int64_t]
+              leading dimension of b_d, ldb >= rows.
+    @param[in]
+    stream    [hipStream_t]
+              stream the transfer is enqueued on.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_copy_matrix_device_to_device(int64_t     rows,
+                                                                   int64_t     cols,
+                                                                   int64_t     elem_size,
+                                                                   const void* a_d,
+                                                                   int         device_a,
+                                                                   int64_t     lda,
+                                                                   void*       b_d,
+                                                                   int         device_b,
+                                                                   int64_t     ldb,
+                                                                   hipStream_t stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_copy_matrix_device_to_device_strided_batched copies a strided
+    batch of rows * cols matrices from device device_a to device device_b,
+    asynchronously with respect to the host on the given stream. Instead of
+    issuing one small peer copy per matrix, the batch is coalesced into as
+    few transfers as the layouts allow: one linear copy when both batches are
+    fully contiguous, one pitched copy when the matrices are packed at padded
+    batch strides, and one 3D copy when pitched matrices are laid out back to
+    back; only irregular strides fall back to a transfer per matrix. On the
+    first copy between a pair of devices a direct peer mapping is established
+    when the hardware supports one, so transfers run over the inter-GPU link
+    rather than staging through host memory.
+
+    @param[in]
+    rows        [int64_t]
+                number of rows of each matrix.
+    @param[in]
+    cols        [int64_t]
+                number of columns of each matrix.
+    @param[in]
+    elem_size   [int64_t]
+                size in bytes of each matrix element.
+    @param[in]
+    a_d         [const void *]
+                first source matrix on device device_a.
+    @param[in]
+    device_a    [int]
+                device ID owning a_d.
+    @param[in]
+    lda         [int64_t]
+                leading dimension of each source matrix, lda >= rows.
+    @param[in]
+    stride_a    [rocblas_stride]
+                stride in elements from one source matrix to the next.
+    @param[out]
+    b_d         [void *]
+                first destination matrix on device device_b.
+    @param[in]
+    device_b    [int]
+                device ID owning b_d.
+    @param[in]
+    ldb         [int64_t]
+                leading dimension of each destination matrix, ldb >= rows.
+    @param[in]
+    stride_b    [rocblas_stride]
+                stride in elements from one destination matrix to the next.
+    @param[in]
+    batch_count [int64_t]
+                number of matrices in the batch.
+    @param[in]
+    stream      [hipStream_t]
+                stream the transfers are enqueued on.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_copy_matrix_device_to_device_strided_batched(int64_t        rows,
+                                                         int64_t        cols,
+                                                         int64_t        elem_size,
+                                                         const void*    a_d,
+                                                         int            device_a,
+                                                         int64_t        lda,
+                                                         rocblas_stride stride_a,
+                                                         void*          b_d,
+                                                         int            device_b,
+                                                         int64_t        ldb,
+                                                         rocblas_stride stride_b,
+                                                         int64_t        batch_count,
+                                                         hipStream_t    stream);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex_multi_device performs one general matrix-matrix operation:
+
+        D = alpha * op(A) * op(B) + beta * C
+
+    decomposed across multiple devices. The problem is split into column panels
+    of D, one panel per handle; each handle must be bound to the device that
+    should compute its panel. Every device receives the used portion of A and
+    its panel of B and C, computed in pipelined column chunks so that transfers
+    to and from a device overlap its compute, and the devices run concurrently.
+
+    Unlike rocblas_gemm_ex, all matrix pointers are host pointers, since the
+    intended problems do not fit in a single device's memory; alpha and beta
+    are always read on the host. The per-panel gemms are subject to the same
+    type support as rocblas_gemm_ex.
+
+    @param[in]
+    handles      host array of handle_count rocblas handles, each bound to the
+                 device that computes the corresponding column panel.
+    @param[in]
+    handle_count [rocblas_int]
+                 number of handles/devices to decompose across. handle_count >= 1.
+    @param[in]
+    trans_a      [rocblas_operation]
+                 specifies the form of op( A ).
+    @param[in]
+    trans_b      [rocblas_operation]
+                 specifies the form of op( B ).
+    @param[in]
+    m            [rocblas_int]
+                 matrix dimension m.
+    @param[in]
+    n            [rocblas_int]
+                 matrix dimension n.
+    @param[in]
+    k            [rocblas_int]
+                 matrix dimension k.
+    @param[in]
+    alpha        [const void *]
+                 host pointer specifying the scalar alpha. Same datatype as
+                 compute_type.
+    @param[in]
+    a            [const void *]
+                 host pointer storing matrix A.
+    @param[in]
+    a_type       [rocblas_datatype]
+                 specifies the datatype of matrix A.
+    @param[in]
+    lda          [rocblas_int]
+                 specifies the leading dimension of A.
+    @param[in]
+    b            [const void *]
+                 host pointer storing matrix B.
+    @param[in]
+    b_type       [rocblas_datatype]
+                 specifies the datatype of matrix B.
+    @param[in]
+    ldb          [rocblas_int]
+                 specifies the leading dimension of B.
+    @param[in]
+    beta         [const void *]
+                 host pointer specifying the scalar beta. Same datatype as
+                 compute_type.
+    @param[in]
+    c            [const void *]
+                 host pointer storing matrix C.
+    @param[in]
+    c_type       [rocblas_datatype]
+                 specifies the datatype of matrix C.
+    @param[in]
+    ldc          [rocblas_int]
+                 specifies the leading dimension of C.
+    @param[out]
+    d            [void *]
+                 host pointer storing matrix D.
+    @param[in]
+    d_type       [rocblas_datatype]
+                 specifies the datatype of matrix D.
+    @param[in]
+    ldd          [rocblas_int]
+                 specifies the leading dimension of D.
+    @param[in]
+    compute_type [rocblas_datatype]
+                 specifies the datatype of the computation.
+    @param[in]
+    algo         [rocblas_gemm_algo]
+                 enumerant specifying the algorithm type.
+    @param[in]
+    solution_index [int32_t]
+                 if algo is rocblas_gemm_algo_solution_index, this controls
+                 which solution is used for every panel; otherwise ignored.
+    @param[in]
+    flags        [uint32_t]
+                 optional gemm flags.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_multi_device(rocblas_handle*   handles,
+                                                           rocblas_int       handle_count,
+                                                           rocblas_operation trans_a,
+                                                           rocblas_operation trans_b,
+                                                           rocblas_int       m,
+                                                           rocblas_int       n,
+                                                           rocblas_int       k,
+                                                           const void*       alpha,
+                                                           const void*       a,
+                                                           rocblas_datatype  a_type,
+                                                           rocblas_int       lda,
+                                                           const void*       b,
+                                                           rocblas_datatype  b_type,
+                                                           rocblas_int       ldb,
+                                                           const void*       beta,
+                                                           const void*       c,
+                                                           rocblas_datatype  c_type,
+                                                           rocblas_int       ldc,
+                                                           void*             d,
+                                                           rocblas_datatype  d_type,
+                                                           rocblas_int       ldd,
+                                                           rocblas_datatype  compute_type,
+                                                           rocblas_gemm_algo algo,
+                                                           int32_t           solution_index,
+                                                           uint32_t          flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_preload_gemm loads and finalizes the kernel code objects needed by
+    one gemm problem shape, without executing anything. With lazily loaded
+    Tensile libraries this removes the code-object load latency from the first
+    real call on that shape, while avoiding the full warm-up cost of
+    rocblas_initialize(), which loads every library for the device. Solution
+    selection for the shape is also performed and cached.
+
+    Call once per serving shape at startup, after creating the handle. The
+    supported type combinations are those of rocblas_gemm_ex. When rocBLAS is
+    built without Tensile there is nothing to preload and the call succeeds.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    trans_a      [rocblas_operation]
+                 specifies the form of op( A ).
+    @param[in]
+    trans_b      [rocblas_operation]
+                 specifies the form of op( B ).
+    @param[in]
+    m            [rocblas_int]
+                 matrix dimension m.
+    @param[in]
+    n            [rocblas_int]
+                 matrix dimension n.
+    @param[in]
+    k            [rocblas_int]
+                 matrix dimension k.
+    @param[in]
+    a_type       [rocblas_datatype]
+                 specifies the datatype of matrix A.
+    @param[in]
+    b_type       [rocblas_datatype]
+                 specifies the datatype of matrix B.
+    @param[in]
+    c_type       [rocblas_datatype]
+                 specifies the datatype of matrix C.
+    @param[in]
+    d_type       [rocblas_datatype]
+                 specifies the datatype of matrix D.
+    @param[in]
+    compute_type [rocblas_datatype]
+                 specifies the datatype of the computation.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_preload_gemm(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   rocblas_datatype  a_type,
+                                                   rocblas_datatype  b_type,
+                                                   rocblas_datatype  c_type,
+                                                   rocblas_datatype  d_type,
+                                                   rocblas_datatype  compute_type);
+
+/*! \brief Fused epilogue selector for the rocblas_gemm_ex_epilogue functions. */
+typedef enum rocblas_gemm_epilogue_
+{
+    rocblas_gemm_epilogue_none = 0, /**< no activation. */
+    rocblas_gemm_epilogue_relu = 1, /**< D = max(D, 0). */
+    rocblas_gemm_epilogue_gelu = 2 /**< D = gelu(D), tanh approximation. */
+} rocblas_gemm_epilogue;
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex_epilogue performs the matrix-matrix operation
+
+        D = act(alpha * op(A) * op(B) + beta * C + bias)
+
+    where act is selected by epilogue and bias is an optional device vector of
+    m values of compute_type added to every column of the result. The bias add
+    and activation are applied in a single fused pass over D instead of one
+    separate kernel launch each. With bias == NULL and
+    rocblas_gemm_epilogue_none this is exactly rocblas_gemm_ex, whose
+    documentation describes the shared arguments.
+
+    Activations are supported for the real floating point compute types;
+    integer and complex compute types support the bias add only.
+
+    rocblas_gemm_batched_ex_epilogue and rocblas_gemm_strided_batched_ex_epilogue
+    extend rocblas_gemm_batched_ex and rocblas_gemm_strided_batched_ex the same
+    way; bias_stride gives the stride between per-batch bias vectors and may be
+    0 to share one bias across the batch.
+
+    @param[in]
+    bias      device vector of m values of compute_type, or NULL for no bias.
+    @param[in]
+    epilogue  [rocblas_gemm_epilogue]
+              activation applied to the result.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_epilogue(rocblas_handle        handle,
+                                                       rocblas_operation     trans_a,
+                                                       rocblas_operation     trans_b,
+                                                       rocblas_int           m,
+                                                       rocblas_int           n,
+                                                       rocblas_int           k,
+                                                       const void*           alpha,
+                                                       const void*           a,
+                                                       rocblas_datatype      a_type,
+                                                       rocblas_int           lda,
+                                                       const void*           b,
+                                                       rocblas_datatype      b_type,
+                                                       rocblas_int           ldb,
+                                                       const void*           beta,
+                                                       const void*           c,
+                                                       rocblas_datatype      c_type,
+                                                       rocblas_int           ldc,
+                                                       void*                 d,
+                                                       rocblas_datatype      d_type,
+                                                       rocblas_int           ldd,
+                                                       rocblas_datatype      compute_type,
+                                                       rocblas_gemm_algo     algo,
+                                                       int32_t               solution_index,
+                                                       uint32_t              flags,
+                                                       const void*           bias,
+                                                       rocblas_gemm_epilogue epilogue);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex_epilogue(rocblas_handle        handle,
+                                                               rocblas_operation     trans_a,
+                                                               rocblas_operation     trans_b,
+                                                               rocblas_int           m,
+                                                               rocblas_int           n,
+                                                               rocblas_int           k,
+                                                               const void*           alpha,
+                                                               const void*           a,
+                                                               rocblas_datatype      a_type,
+                                                               rocblas_int           lda,
+                                                               const void*           b,
+                                                               rocblas_datatype      b_type,
+                                                               rocblas_int           ldb,
+                                                               const void*           beta,
+                                                               const void*           c,
+                                                               rocblas_datatype      c_type,
+                                                               rocblas_int           ldc,
+                                                               void*                 d,
+                                                               rocblas_datatype      d_type,
+                                                               rocblas_int           ldd,
+                                                               rocblas_int           batch_count,
+                                                               rocblas_datatype      compute_type,
+                                                               rocblas_gemm_algo     algo,
+                                                               int32_t               solution_index,
+                                                               uint32_t              flags,
+                                                               const void*           bias,
+                                                               rocblas_stride        bias_stride,
+                                                               rocblas_gemm_epilogue epilogue);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_gemm_strided_batched_ex_epilogue(rocblas_handle        handle,
+                                             rocblas_operation     trans_a,
+                                             rocblas_operation     trans_b,
+                                             rocblas_int           m,
+                                             rocblas_int           n,
+                                             rocblas_int           k,
+                                             const void*           alpha,
+                                             const void*           a,
+                                             rocblas_datatype      a_type,
+                                             rocblas_int           lda,
+                                             rocblas_stride        stride_a,
+                                             const void*           b,
+                                             rocblas_datatype      b_type,
+                                             rocblas_int           ldb,
+                                             rocblas_stride        stride_b,
+                                             const void*           beta,
+                                             const void*           c,
+                                             rocblas_datatype      c_type,
+                                             rocblas_int           ldc,
+                                             rocblas_stride        stride_c,
+                                             void*                 d,
+                                             rocblas_datatype      d_type,
+                                             rocblas_int           ldd,
+                                             rocblas_stride        stride_d,
+                                             rocblas_int           batch_count,
+                                             rocblas_datatype      compute_type,
+                                             rocblas_gemm_algo     algo,
+                                             int32_t               solution_index,
+                                             uint32_t              flags,
+                                             const void*           bias,
+                                             rocblas_stride        bias_stride,
+                                             rocblas_gemm_epilogue epilogue);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_dequant performs the int8 matrix-matrix operation
+
+        D = alpha * diag(scale) * (op(A) * op(B)) + beta * D
+
+    where A and B are int8 matrices, scale is a device vector of m float
+    per-channel dequantization factors, and D is a half, bfloat16 or float
+    matrix selected by d_type. The i8 x i8 -> i32 product accumulates into
+    library-managed workspace and the dequantization is a single fused pass
+    into D, so no 4-byte-per-element intermediate passes through user memory
+    and D is never revisited by a separate dequant kernel.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op(A).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op(B).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const float *]
+              device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    a         [void *]
+              device pointer storing int8 matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b         [void *]
+              device pointer storing int8 matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    scale     device vector of m float per-channel (per output row)
+              dequantization factors.
+    @param[in]
+    beta      [const float *]
+              device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    d         [void *]
+              device pointer storing matrix D; read when beta is nonzero.
+    @param[in]
+    d_type    [rocblas_datatype]
+              datatype of matrix D; one of rocblas_datatype_f16_r,
+              rocblas_datatype_bf16_r or rocblas_datatype_f32_r.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_dequant(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   const float*      alpha,
+                                                   const void*       a,
+                                                   rocblas_int       lda,
+                                                   const void*       b,
+                                                   rocblas_int       ldb,
+                                                   const float*      scale,
+                                                   const float*      beta,
+                                                   void*             d,
+                                                   rocblas_datatype  d_type,
+                                                   rocblas_int       ldd);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_pack_size returns the size in bytes of the buffer
+    rocblas_gemm_pack writes for the selected operand of an m x n x k gemm.
+    The packed layout is opaque and may change between library versions; use
+    this query rather than assuming a layout.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    operand   [rocblas_gemm_pack_operand]
+              which gemm operand the buffer will hold.
+    @param[in]
+    trans     [rocblas_operation]
+              the operation that will be passed for this operand at gemm time.
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m of the gemm the pack is for.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n of the gemm the pack is for.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k of the gemm the pack is for.
+    @param[in]
+    type      [rocblas_datatype]
+              datatype of the operand.
+    @param[out]
+    size      [size_t *]
+              host pointer receiving the required buffer size in bytes.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_pack_size(rocblas_handle            handle,
+                                                     rocblas_gemm_pack_operand operand,
+                                                     rocblas_operation         trans,
+                                                     rocblas_int               m,
+                                                     rocblas_int               n,
+                                                     rocblas_int               k,
+                                                     rocblas_datatype          type,
+                                                     size_t*                   size);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_pack copies one gemm operand into the layout the library
+    prefers to consume, so that the conversion cost is paid once when the
+    same operand is reused across many rocblas_gemm_ex calls. The packed
+    buffer must be device memory of at least the size reported by
+    rocblas_gemm_pack_size, and is then passed to rocblas_gemm_ex in place of
+    the ordinary operand pointer together with rocblas_gemm_flags_packed_a or
+    rocblas_gemm_flags_packed_b, keeping the same trans argument used here;
+    the leading dimension argument of a packed operand is ignored. Only
+    rocblas_gemm_ex accepts packed operands. The copy runs asynchronously on
+    the handle's stream.
+
+    Supported datatypes are f16_r, bf16_r, f32_r, f64_r, i8_r, i32_r, f32_c
+    and f64_c.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    operand   [rocblas_gemm_pack_operand]
+              which gemm operand a holds.
+    @param[in]
+    trans     [rocblas_operation]
+              the operation that will be passed for this operand at gemm time.
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m of the gemm the pack is for.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n of the gemm the pack is for.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k of the gemm the pack is for.
+    @param[in]
+    type      [rocblas_datatype]
+              datatype of the operand.
+    @param[in]
+    a         device pointer storing the operand in ordinary column-major
+              layout under trans.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of a.
+    @param[out]
+    packed    device pointer receiving the packed operand.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_pack(rocblas_handle            handle,
+                                                rocblas_gemm_pack_operand operand,
+                                                rocblas_operation         trans,
+                                                rocblas_int               m,
+                                                rocblas_int               n,
+                                                rocblas_int               k,
+                                                rocblas_datatype          type,
+                                                const void*               a,
+                                                rocblas_int               lda,
+                                                void*                     packed);
+/*! @} */
+
+/*! \brief Opaque descriptor holding a pre-validated rocblas_gemm_ex problem
+     for rocblas_gemm_ex_lite. */
+typedef struct _rocblas_gemm_ex_lite_desc* rocblas_gemm_ex_lite_desc;
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex_lite_create validates a gemm_ex problem shape once and
+    captures it in a descriptor, so that repeated rocblas_gemm_ex_lite calls
+    on the same shape skip per-call argument checking, logging and tuning
+    lookup entirely. Transpose operations, dimensions and leading dimensions
+    are checked here; a ROCBLAS_TUNING_FILE match is resolved here as well
+    when solution_index is zero. An unsupported datatype combination still
+    surfaces as rocblas_status_not_implemented from the first call.
+
+    rocblas_gemm_ex_lite computes D = alpha*op(A)*op(B) + beta*C for a
+    descriptor created by rocblas_gemm_ex_lite_create, passing only the
+    pointers that change between calls. The caller declares the remaining
+    preconditions up front instead of having them re-checked per call: alpha
+    and beta must be host pointers (regardless of the handle's pointer mode),
+    and a, b, c, d must be valid device pointers for the captured shape (c
+    may equal d for the in-place update).
+
+    The descriptor does not hold a reference to the handle; it may be used
+    with any handle on the same device and must be freed with
+    rocblas_gemm_ex_lite_destroy.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    a_type    [rocblas_datatype]
+              datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of matrix A.
+    @param[in]
+    b_type    [rocblas_datatype]
+              datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              leading dimension of matrix B.
+    @param[in]
+    c_type    [rocblas_datatype]
+              datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              leading dimension of matrix C.
+    @param[in]
+    d_type    [rocblas_datatype]
+              datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              leading dimension of matrix D.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              datatype of computation.
+    @param[in]
+    solution_index
+              [int32_t]
+              index of a specific kernel solution, or 0 for the default
+              (subject to ROCBLAS_TUNING_FILE resolution).
+    @param[in]
+    flags     [uint32_t]
+              gemm_ex flags.
+    @param[out]
+    desc      pointer to the descriptor to create.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_lite_create(rocblas_handle             handle,
+                                                          rocblas_operation          trans_a,
+                                                          rocblas_operation          trans_b,
+                                                          rocblas_int                m,
+                                                          rocblas_int                n,
+                                                          rocblas_int                k,
+                                                          rocblas_datatype           a_type,
+                                                          rocblas_int                lda,
+                                                          rocblas_datatype           b_type,
+                                                          rocblas_int                ldb,
+                                                          rocblas_datatype           c_type,
+                                                          rocblas_int                ldc,
+                                                          rocblas_datatype           d_type,
+                                                          rocblas_int                ldd,
+                                                          rocblas_datatype           compute_type,
+                                                          int32_t                    solution_index,
+                                                          uint32_t                   flags,
+                                                          rocblas_gemm_ex_lite_desc* desc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_lite(rocblas_handle            handle,
+                                                   rocblas_gemm_ex_lite_desc desc,
+                                                   const void*               alpha,
+                                                   const void*               a,
+                                                   const void*               b,
+                                                   const void*               beta,
+                                                   const void*               c,
+                                                   void*                     d);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_lite_destroy(rocblas_gemm_ex_lite_desc desc);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_batched_ex_scaled performs the batched matrix-matrix operations
+
+        D_i = alpha[i] * op(A_i) * op(B_i) + beta[i] * C_i,  i = 0, ..., batch_count - 1
+
+    with one scalar pair per batch index. alpha and beta are device arrays of
+    batch_count values of compute_type, so per-sample output scaling is applied
+    in a single fused pass over D instead of a separate scal call per batch
+    element. All other arguments follow rocblas_gemm_batched_ex.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     device array of batch_count scalars of compute_type.
+    @param[in]
+    a         device array of device pointers storing each matrix A_i.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    b         device array of device pointers storing each matrix B_i.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      device array of batch_count scalars of compute_type.
+    @param[in]
+    c         device array of device pointers storing each matrix C_i.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of each C_i.
+    @param[out]
+    d         device array of device pointers storing each matrix D_i.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of each D_i.
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of gemm operations in the batch.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of the computation and of the scalar arrays.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              if algo is rocblas_gemm_algo_solution_index, this controls the
+              solution to use; ignored otherwise.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex_scaled(rocblas_handle    handle,
+                                                             rocblas_operation trans_a,
+                                                             rocblas_operation trans_b,
+                                                             rocblas_int       m,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             const void*       alpha,
+                                                             const void*       a,
+                                                             rocblas_datatype  a_type,
+                                                             rocblas_int       lda,
+                                                             const void*       b,
+                                                             rocblas_datatype  b_type,
+                                                             rocblas_int       ldb,
+                                                             const void*       beta,
+                                                             const void*       c,
+                                                             rocblas_datatype  c_type,
+                                                             rocblas_int       ldc,
+                                                             void*             d,
+                                                             rocblas_datatype  d_type,
+                                                             rocblas_int       ldd,
+                                                             rocblas_int       batch_count,
+                                                             rocblas_datatype  compute_type,
+                                                             rocblas_gemm_algo algo,
+                                                             int32_t           solution_index,
+                                                             uint32_t          flags);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_make_batch_pointers materializes the array of batch pointers
+
+        pointers[i] = (char*)base + i * stride_bytes,  i = 0, ..., batch_count - 1
+
+    on the device, on the handle's stream. The batched entry points take an
+    array of device pointers; when the underlying storage is strided, this
+    builds that array without staging it on the host and without
+    synchronizing the stream.
+
+    @param[in]
+    handle       [rocblas_handle]
+                 handle to the rocblas library context queue.
+    @param[in]
+    base         device pointer to the first batch instance.
+    @param[in]
+    stride_bytes [rocblas_stride]
+                 byte stride from one batch instance to the next.
+    @param[in]
+    batch_count  [rocblas_int]
+                 number of pointers to write.
+    @param[out]
+    pointers     device array of batch_count pointers to fill.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_make_batch_pointers(rocblas_handle handle,
+                                                          void*          base,
+                                                          rocblas_stride stride_bytes,
+                                                          rocblas_int    batch_count,
+                                                          void**         pointers);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_interleave_batched_matrix converts a strided-batched matrix
+    into the interleaved layout used by rocblas_gemm_interleaved_batched_ex,
+    in which the batch index is innermost: element (r, c) of batch instance i
+    is stored at
+
+        dst[(c * ld_i + r) * batch_count + i].
+
+    Consecutive batch instances of the same element occupy consecutive memory
+    locations, so kernels which assign adjacent batch instances to adjacent
+    threads access memory fully coalesced.
+
+    rocblas_gemm_deinterleave_batched_matrix performs the inverse conversion,
+    from the interleaved layout back to a strided-batched matrix.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    type        [rocblas_datatype]
+                element type of the matrix.
+    @param[in]
+    rows        [rocblas_int]
+                number of rows of each batch instance.
+    @param[in]
+    cols        [rocblas_int]
+                number of columns of each batch instance.
+    @param[in]
+    src         device pointer to the source matrix.
+    @param[in]
+    ld          [rocblas_int]
+                leading dimension of the strided-batched matrix.
+    @param[in]
+    stride      [rocblas_stride]
+                element stride between strided-batched instances.
+    @param[out]
+    dst         device pointer to the destination matrix.
+    @param[in]
+    ld_i        [rocblas_int]
+                leading dimension of the interleaved matrix.
+    @param[in]
+    batch_count [rocblas_int]
+                number of batch instances.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_interleave_batched_matrix(rocblas_handle   handle,
+                                                                     rocblas_datatype type,
+                                                                     rocblas_int      rows,
+                                                                     rocblas_int      cols,
+                                                                     const void*      src,
+                                                                     rocblas_int      ld,
+                                                                     rocblas_stride   stride,
+                                                                     void*            dst,
+                                                                     rocblas_int      ld_i,
+                                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_deinterleave_batched_matrix(rocblas_handle   handle,
+                                                                       rocblas_datatype type,
+                                                                       rocblas_int      rows,
+                                                                       rocblas_int      cols,
+                                                                       const void*      src,
+                                                                       rocblas_int      ld_i,
+                                                                       void*            dst,
+                                                                       rocblas_int      ld,
+                                                                       rocblas_stride   stride,
+                                                                       rocblas_int batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_interleaved_batched_ex performs the batched matrix-matrix
+    operations
+
+        D_i = alpha * op(A_i) * op(B_i) + beta * C_i,  i = 0, ..., batch_count - 1
+
+    on matrices stored in the interleaved layout produced by
+    rocblas_gemm_interleave_batched_matrix, with the batch index innermost.
+    It is intended for very large batches (thousands and up) of very small
+    matrices, where the strided-batched path is launch- and cache-unfriendly;
+    the interleaved layout makes these problems fully bandwidth-bound. All of
+    m, n, and k must be at most 16, or rocblas_status_not_implemented is
+    returned.
+
+    Supported type combinations (a_type must equal b_type, and c_type must
+    equal d_type):
+
+    a_type | c_type | compute_type
+    -------|--------|-------------
+    f16_r  | f16_r  | f16_r
+    f16_r  | f16_r  | f32_r
+    bf16_r | bf16_r | f32_r
+    f32_r  | f32_r  | f32_r
+    f64_r  | f64_r  | f64_r
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    trans_a     [rocblas_operation]
+                specifies the form of op( A ).
+    @param[in]
+    trans_b     [rocblas_operation]
+                specifies the form of op( B ).
+    @param[in]
+    m           [rocblas_int]
+                matrix dimension m. Must be at most 16.
+    @param[in]
+    n           [rocblas_int]
+                matrix dimension n. Must be at most 16.
+    @param[in]
+    k           [rocblas_int]
+                matrix dimension k. Must be at most 16.
+    @param[in]
+    alpha       device pointer or host pointer to the scalar alpha, of
+                compute_type.
+    @param[in]
+    a           device pointer to the interleaved matrix A.
+    @param[in]
+    a_type      [rocblas_datatype]
+                datatype of the matrices A and B.
+    @param[in]
+    lda         [rocblas_int]
+                leading dimension of each batch instance of A.
+    @param[in]
+    b           device pointer to the interleaved matrix B.
+    @param[in]
+    b_type      [rocblas_datatype]
+                datatype of the matrices A and B. Must equal a_type.
+    @param[in]
+    ldb         [rocblas_int]
+                leading dimension of each batch instance of B.
+    @param[in]
+    beta        device pointer or host pointer to the scalar beta, of
+                compute_type.
+    @param[in]
+    c           device pointer to the interleaved matrix C.
+    @param[in]
+    c_type      [rocblas_datatype]
+                datatype of the matrices C and D.
+    @param[in]
+    ldc         [rocblas_int]
+                leading dimension of each batch instance of C.
+    @param[out]
+    d           device pointer to the interleaved matrix D.
+    @param[in]
+    d_type      [rocblas_datatype]
+                datatype of the matrices C and D. Must equal c_type.
+    @param[in]
+    ldd         [rocblas_int]
+                leading dimension of each batch instance of D.
+    @param[in]
+    compute_type [rocblas_datatype]
+                datatype of the computation.
+    @param[in]
+    batch_count [rocblas_int]
+                number of gemm operations in the batch.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_interleaved_batched_ex(rocblas_handle    handle,
+                                                                  rocblas_operation trans_a,
+                                                                  rocblas_operation trans_b,
+                                                                  rocblas_int       m,
+                                                                  rocblas_int       n,
+                                                                  rocblas_int       k,
+                                                                  const void*       alpha,
+                                                                  const void*       a,
+                                                                  rocblas_datatype  a_type,
+                                                                  rocblas_int       lda,
+                                                                  const void*       b,
+                                                                  rocblas_datatype  b_type,
+                                                                  rocblas_int       ldb,
+                                                                  const void*       beta,
+                                                                  const void*       c,
+                                                                  rocblas_datatype  c_type,
+                                                                  rocblas_int       ldc,
+                                                                  void*             d,
+                                                                  rocblas_datatype  d_type,
+                                                                  rocblas_int       ldd,
+                                                                  rocblas_datatype  compute_type,
+                                                                  rocblas_int batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpy_dot performs the fused operation
+
+        y := alpha * x + y
+        result := (y, y)
+
+    in a single pass over the vectors, halving memory traffic compared to
+    separate axpy and dot calls. The returned scalar is the dot product of the
+    updated y with itself, as used by residual updates in iterative solvers.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y; overwritten by alpha * x + y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result    device pointer or host pointer to store the dot product of the
+              updated y with itself.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   alpha,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                float*         y,
+                                                rocblas_int    incy,
+                                                float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  alpha,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                double*        y,
+                                                rocblas_int    incy,
+                                                double*        result);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpy_dot_strided_batched performs the fused axpy_dot operation over a
+    strided batch of vectors, writing one dot product per batch to results.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    n           [rocblas_int]
+                the number of elements in each x_i and y_i.
+    @param[in]
+    alpha       device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x           device pointer to the first vector x_1.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex     [rocblas_stride]
+                stride from the start of one vector (x_i) to the next (x_i+1).
+    @param[inout]
+    y           device pointer to the first vector y_1; each y_i is
+                overwritten by alpha * x_i + y_i.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey     [rocblas_stride]
+                stride from the start of one vector (y_i) to the next (y_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+    @param[inout]
+    results     device array or host array of batch_count size to store the
+                dot products of each updated y_i with itself.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const float*   alpha,
+                                                                const float*   x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                float*         y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                rocblas_int    batch_count,
+                                                                float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot_strided_batched(rocblas_handle handle,
+                                                                rocblas_int    n,
+                                                                const double*  alpha,
+                                                                const double*  x,
+                                                                rocblas_int    incx,
+                                                                rocblas_stride stridex,
+                                                                double*        y,
+                                                                rocblas_int    incy,
+                                                                rocblas_stride stridey,
+                                                                rocblas_int    batch_count,
+                                                                double*        results);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpby performs the general two-term vector update
+
+        y := alpha * x + beta * y
+
+    in a single pass over the vectors. The equivalent scal followed by axpy
+    streams y through memory twice; the fused form halves memory traffic on
+    this common solver update step.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y; overwritten by alpha * x + beta * y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const float*   alpha,
+                                             const float*   beta,
+                                             const float*   x,
+                                             rocblas_int    incx,
+                                             float*         y,
+                                             rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const double*  alpha,
+                                             const double*  beta,
+                                             const double*  x,
+                                             rocblas_int    incx,
+                                             double*        y,
+                                             rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpby(rocblas_handle               handle,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* beta,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  incx,
+                                             rocblas_float_complex*       y,
+                                             rocblas_int                  incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpby(rocblas_handle                handle,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* beta,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   incx,
+                                             rocblas_double_complex*       y,
+                                             rocblas_int                   incy);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpby_batched performs the axpby update y_i := alpha * x_i + beta * y_i
+    over a batch of vectors addressed through arrays of pointers.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    n           [rocblas_int]
+                the number of elements in each x_i and y_i.
+    @param[in]
+    alpha       device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    beta        device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    x           device array of device pointers storing each vector x_i.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of each x_i.
+    @param[inout]
+    y           device array of device pointers storing each vector y_i.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of each y_i.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby_batched(rocblas_handle     handle,
+                                                     rocblas_int        n,
+                                                     const float*       alpha,
+                                                     const float*       beta,
+                                                     const float* const x[],
+                                                     rocblas_int        incx,
+                                                     float* const       y[],
+                                                     rocblas_int        incy,
+                                                     rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby_batched(rocblas_handle      handle,
+                                                     rocblas_int         n,
+                                                     const double*       alpha,
+                                                     const double*       beta,
+                                                     const double* const x[],
+                                                     rocblas_int         incx,
+                                                     double* const       y[],
+                                                     rocblas_int         incy,
+                                                     rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpby_batched(rocblas_handle                     handle,
+                                                     rocblas_int                        n,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex*       beta,
+                                                     const rocblas_float_complex* const x[],
+                                                     rocblas_int                        incx,
+                                                     rocblas_float_complex* const       y[],
+                                                     rocblas_int                        incy,
+                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpby_batched(rocblas_handle                      handle,
+                                                     rocblas_int                         n,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex*       beta,
+                                                     const rocblas_double_complex* const x[],
+                                                     rocblas_int                         incx,
+                                                     rocblas_double_complex* const       y[],
+                                                     rocblas_int                         incy,
+                                                     rocblas_int batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpby_strided_batched performs the axpby update
+    y_i := alpha * x_i + beta * y_i over a strided batch of vectors.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    n           [rocblas_int]
+                the number of elements in each x_i and y_i.
+    @param[in]
+    alpha       device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    beta        device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    x           device pointer to the first vector x_1.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex     [rocblas_stride]
+                stride from the start of one vector (x_i) to the next (x_i+1).
+    @param[inout]
+    y           device pointer to the first vector y_1.
+    @param[in]
+    incy        [rocblas_int]
+                specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey     [rocblas_stride]
+                stride from the start of one vector (y_i) to the next (y_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const float*   alpha,
+                                                             const float*   beta,
+                                                             const float*   x,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stridex,
+                                                             float*         y,
+                                                             rocblas_int    incy,
+                                                             rocblas_stride stridey,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const double*  alpha,
+                                                             const double*  beta,
+                                                             const double*  x,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stridex,
+                                                             double*        y,
+                                                             rocblas_int    incy,
+                                                             rocblas_stride stridey,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpby_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* beta,
+                                                             const rocblas_float_complex* x,
+                                                             rocblas_int                  incx,
+                                                             rocblas_stride               stridex,
+                                                             rocblas_float_complex*       y,
+                                                             rocblas_int                  incy,
+                                                             rocblas_stride               stridey,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpby_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* beta,
+                                                             const rocblas_double_complex* x,
+                                                             rocblas_int                   incx,
+                                                             rocblas_stride                stridex,
+                                                             rocblas_double_complex*       y,
+                                                             rocblas_int                   incy,
+                                                             rocblas_stride                stridey,
+                                                             rocblas_int batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpby_ex, axpby_batched_ex and axpby_strided_batched_ex perform the axpby
+    update y := alpha * x + beta * y, where the data types of the scalars and
+    of the vectors x and y may differ from the compute type. The supported
+    type combinations are the same as for axpy_ex; alpha_type applies to both
+    alpha and beta.
+
+    @param[in]
+    handle         [rocblas_handle]
+                   handle to the rocblas library context queue.
+    @param[in]
+    n              [rocblas_int]
+                   the number of elements in x and y.
+    @param[in]
+    alpha          device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    beta           device pointer or host pointer to specify the scalar beta.
+    @param[in]
+    alpha_type     [rocblas_datatype]
+                   specifies the datatype of alpha and beta.
+    @param[in]
+    x              device pointer storing vector x.
+    @param[in]
+    x_type         [rocblas_datatype]
+                   specifies the datatype of vector x.
+    @param[in]
+    incx           [rocblas_int]
+                   specifies the increment for the elements of x.
+    @param[inout]
+    y              device pointer storing vector y.
+    @param[in]
+    y_type         [rocblas_datatype]
+                   specifies the datatype of vector y.
+    @param[in]
+    incy           [rocblas_int]
+                   specifies the increment for the elements of y.
+    @param[in]
+    execution_type [rocblas_datatype]
+                   specifies the datatype of computation.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_axpby_ex(rocblas_handle   handle,
+                                               rocblas_int      n,
+                                               const void*      alpha,
+                                               const void*      beta,
+                                               rocblas_datatype alpha_type,
+                                               const void*      x,
+                                               rocblas_datatype x_type,
+                                               rocblas_int      incx,
+                                               void*            y,
+                                               rocblas_datatype y_type,
+                                               rocblas_int      incy,
+                                               rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_axpby_batched_ex(rocblas_handle   handle,
+                                                       rocblas_int      n,
+                                                       const void*      alpha,
+                                                       const void*      beta,
+                                                       rocblas_datatype alpha_type,
+                                                       const void*      x,
+                                                       rocblas_datatype x_type,
+                                                       rocblas_int      incx,
+                                                       void*            y,
+                                                       rocblas_datatype y_type,
+                                                       rocblas_int      incy,
+                                                       rocblas_int      batch_count,
+                                                       rocblas_datatype execution_type);
+
+ROCBLAS_EXPORT rocblas_status rocblas_axpby_strided_batched_ex(rocblas_handle   handle,
+                                                               rocblas_int      n,
+                                                               const void*      alpha,
+                                                               const void*      beta,
+                                                               rocblas_datatype alpha_type,
+                                                               const void*      x,
+                                                               rocblas_datatype x_type,
+                                                               rocblas_int      incx,
+                                                               rocblas_stride   stridex,
+                                                               void*            y,
+                                                               rocblas_datatype y_type,
+                                                               rocblas_int      incy,
+                                                               rocblas_stride   stridey,
+                                                               rocblas_int      batch_count,
+                                                               rocblas_datatype execution_type);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    ger_multi performs the fused multi-rank update
+
+        A := A + alpha * x * y**T
+
+    where x is an m by k matrix, y is an n by k matrix and A is an m by n
+    matrix, i.e. k rank-1 (ger) updates applied in a single traversal of A.
+    Applying k separate ger calls streams A from memory k times; ger_multi
+    reads and writes A exactly once regardless of k.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of A and of x.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of A and the number of rows of y.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, i.e. the number of columns of x
+              and of y.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing the m by k matrix x whose columns are the
+              left-hand update vectors.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of x.
+    @param[in]
+    y         device pointer storing the n by k matrix y whose columns are the
+              right-hand update vectors.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of y.
+    @param[inout]
+    A         device pointer storing the matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sger_multi(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const float*   alpha,
+                                                 const float*   x,
+                                                 rocblas_int    ldx,
+                                                 const float*   y,
+                                                 rocblas_int    ldy,
+                                                 float*         A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_multi(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const double*  alpha,
+                                                 const double*  x,
+                                                 rocblas_int    ldx,
+                                                 const double*  y,
+                                                 rocblas_int    ldy,
+                                                 double*        A,
+                                                 rocblas_int    lda);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    ger_multi_strided_batched performs the fused multi-rank ger_multi update
+    over a strided batch of matrices,
+
+        A_i := A_i + alpha * x_i * y_i**T,
+
+    with each A_i read and written exactly once regardless of k.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    m           [rocblas_int]
+                the number of rows of each A_i and of each x_i.
+    @param[in]
+    n           [rocblas_int]
+                the number of columns of each A_i and the number of rows of
+                each y_i.
+    @param[in]
+    k           [rocblas_int]
+                the number of rank-1 updates per batch instance.
+    @param[in]
+    alpha       device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x           device pointer to the first matrix x_1.
+    @param[in]
+    ldx         [rocblas_int]
+                specifies the leading dimension of each x_i.
+    @param[in]
+    stridex     [rocblas_stride]
+                stride from the start of one x_i matrix to the next x_(i+1).
+    @param[in]
+    y           device pointer to the first matrix y_1.
+    @param[in]
+    ldy         [rocblas_int]
+                specifies the leading dimension of each y_i.
+    @param[in]
+    stridey     [rocblas_stride]
+                stride from the start of one y_i matrix to the next y_(i+1).
+    @param[inout]
+    A           device pointer to the first matrix A_1.
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of each A_i.
+    @param[in]
+    strideA     [rocblas_stride]
+                stride from the start of one A_i matrix to the next A_(i+1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sger_multi_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    m,
+                                                                 rocblas_int    n,
+                                                                 rocblas_int    k,
+                                                                 const float*   alpha,
+                                                                 const float*   x,
+                                                                 rocblas_int    ldx,
+                                                                 rocblas_stride stridex,
+                                                                 const float*   y,
+                                                                 rocblas_int    ldy,
+                                                                 rocblas_stride stridey,
+                                                                 float*         A,
+                                                                 rocblas_int    lda,
+                                                                 rocblas_stride strideA,
+                                                                 rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_multi_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    m,
+                                                                 rocblas_int    n,
+                                                                 rocblas_int    k,
+                                                                 const double*  alpha,
+                                                                 const double*  x,
+                                                                 rocblas_int    ldx,
+                                                                 rocblas_stride stridex,
+                                                                 const double*  y,
+                                                                 rocblas_int    ldy,
+                                                                 rocblas_stride stridey,
+                                                                 double*        A,
+                                                                 rocblas_int    lda,
+                                                                 rocblas_stride strideA,
+                                                                 rocblas_int    batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    normalize scales the vector x in place to unit Euclidean length,
+
+        x := x / || x ||_2,
+
+    in two kernel stages entirely on the device: one pass computing the norm
+    and one fused scaling pass reading it from device memory, with no
+    host synchronization between them. A vector with zero norm is left
+    unchanged.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x.
+    @param[inout]
+    x         device pointer to the vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_snormalize(rocblas_handle handle, rocblas_int n, float* x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_dnormalize(rocblas_handle handle, rocblas_int n, double* x, rocblas_int incx);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    normalize_strided_batched scales each vector x_i in a strided batch to
+    unit Euclidean length in place, computing the norms in one pass and
+    scaling in a fused second stage entirely on device, with no host
+    synchronization. A vector with zero norm is left unchanged.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    n           [rocblas_int]
+                the number of elements in each x_i.
+    @param[inout]
+    x           device pointer to the first vector x_1.
+    @param[in]
+    incx        [rocblas_int]
+                specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex     [rocblas_stride]
+                stride from the start of one vector (x_i) to the next (x_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+                number of vectors in the batch.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_snormalize_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    n,
+                                                                 float*         x,
+                                                                 rocblas_int    incx,
+                                                                 rocblas_stride stridex,
+                                                                 rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dnormalize_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    n,
+                                                                 double*        x,
+                                                                 rocblas_int    incx,
+                                                                 rocblas_stride stridex,
+                                                                 rocblas_int    batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    reduction_signal enqueues a completion marker on the handle's stream. The
+    flag is cleared on the host immediately, and a device write of 1 to it is
+    placed on the stream, so in stream order the flag becomes visible to the
+    host only after all previously enqueued work - e.g. a dot or nrm2 call
+    with rocblas_pointer_mode_device - has completed. Together with
+    reduction_poll this lets a host convergence check cost a single pinned
+    memory read instead of a hipStreamSynchronize.
+
+    The flag must reside in pinned, device-mapped host memory (for example
+    allocated with hipHostMalloc) and must not have a signal pending on any
+    stream when this is called.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    host_flag pointer to a pinned host flag; set to 0 on entry and to 1 by
+              the device once the preceding work on the stream is complete.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reduction_signal(rocblas_handle handle,
+                                                       rocblas_int*   host_flag);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    reduction_poll performs a non-blocking completion check of a flag
+    previously passed to reduction_signal.
+
+    @param[in]
+    host_flag pointer to the pinned host flag passed to reduction_signal.
+    @param[out]
+    complete  set to true if the signal has fired, false if the stream has
+              not yet reached it.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_reduction_poll(const rocblas_int* host_flag, bool* complete);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    set_device_predicate binds a device-side execution predicate to the
+    handle. While a predicate is bound, subsequent axpy, dot and nrm2/asum
+    calls on the handle launch predicated kernels which exit immediately if
+    the word the predicate points to reads zero at execution time, leaving
+    their outputs untouched. An iterative solver can therefore be captured
+    into a hipGraph with a fixed iteration count: once a device-side
+    convergence check clears the predicate, the remaining captured
+    iterations become no-ops with no host round trip.
+
+    The predicate is read by every launched block, so it must remain valid
+    in device memory until it is unbound. Passing NULL unbinds the
+    predicate and restores the regular kernels. The predicate does not
+    apply to functions outside the set above, and is intended for
+    rocblas_pointer_mode_device: in host pointer mode the result transfer
+    to the host still runs and must not be relied upon when the predicate
+    reads zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    device_predicate
+              pointer to a word in device memory, or NULL to unbind.
+              Nonzero means execute; zero means skip.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_device_predicate(rocblas_handle     handle,
+                                                           const rocblas_int* device_predicate);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_stochastic_seed sets the base seed for the stochastic-rounding
+    conversions used by the gemm_ex3 functions when
+    rocblas_gemm_flags_stochastic_rounding is set, including the rounding of
+    the output into 8-bit float types. Each call on the handle combines the
+    base seed with a per-call counter, so successive calls round with distinct
+    streams while a seeded handle reproduces the whole sequence. Handles start
+    with a random base seed; the SR_SEED_A/B/C/D environment variables pin the
+    individual conversion streams and take precedence.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    seed      [uint32_t]
+              base seed for subsequent stochastic-rounding conversions.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_stochastic_seed(rocblas_handle handle, uint32_t seed);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_call_tag attaches a caller tag to subsequent calls on the
+    handle. A set tag becomes part of the aggregation key of the profile log
+    (ROCBLAS_LAYER log_profile), so identical argument tuples issued by
+    different parts of an application — for example different pipeline
+    stages of a model — are reported as separate entries, and is appended to
+    bench log lines as a trailing shell comment so they still replay through
+    rocblas-bench unchanged.
+
+    The tag string is copied; passing NULL or an empty string clears the
+    tag. Tags are interned for the life of the process, so a modest number
+    of distinct tags is expected.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+    @param[in]
+    tag     [const char *]
+            tag recorded with subsequent calls, or NULL to clear.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_call_tag(rocblas_handle handle, const char* tag);
+/*! @} */
+
+/*! \brief One recorded internal kernel launch, as returned by
+    rocblas_get_kernel_timeline. kernel_name points to a static string inside
+    the library and stays valid for the lifetime of the process. */
+typedef struct rocblas_kernel_timeline_entry_
+{
+    const char* kernel_name; /**< internal kernel symbol the launch ran */
+    uint64_t    serial; /**< launch number since the timeline was enabled */
+    float       start_ms; /**< start time relative to enabling the timeline */
+    float       duration_ms; /**< device execution time of the launch */
+} rocblas_kernel_timeline_entry;
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_kernel_timeline enables or disables per-kernel launch
+    instrumentation on the handle. While enabled, every internal kernel the
+    library launches on the handle's stream is timestamped with a
+    preallocated pair of hipEvents into a ring of the given depth, so a slow
+    production call can be broken down into its internal stages in-process,
+    without attaching an external profiler. When the ring wraps, the oldest
+    entries are overwritten. The recorded timeline is sampled with
+    rocblas_get_kernel_timeline.
+
+    Only launches on the handle's stream at enable time are attributed to the
+    handle; changing the stream with rocblas_set_stream ends recording until
+    the timeline is re-enabled. The per-launch cost while disabled is a
+    single atomic load.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    depth     [uint32_t]
+              number of ring entries to preallocate, or 0 to disable
+              instrumentation and release the ring.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_kernel_timeline(rocblas_handle handle, uint32_t depth);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_kernel_timeline copies the completed entries of the handle's
+    kernel timeline, oldest first, into a caller-provided buffer. Only
+    launches whose stop event has already completed are reported; sampling
+    does not synchronize the stream. If timeline is NULL, only the number of
+    completed entries is returned. If the timeline is not enabled on the
+    handle, count is set to zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in,out]
+    count     [uint32_t*]
+              on input, the capacity of timeline (ignored when timeline is
+              NULL); on output, the number of entries written, or available
+              when timeline is NULL.
+    @param[out]
+    timeline  pointer to an array of rocblas_kernel_timeline_entry, or NULL
+              to query the number of completed entries.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_kernel_timeline(rocblas_handle                 handle,
+                                                          uint32_t*                      count,
+                                                          rocblas_kernel_timeline_entry* timeline);
+/*! @} */
+
+/*! \brief Launch metrics of the most recent collected call, as returned by
+    rocblas_get_call_metrics. */
+typedef struct rocblas_call_metrics_
+{
+    int32_t  solution_index; /**< backend solution index of the launched kernel */
+    uint32_t workgroup_size; /**< threads per workgroup of the largest kernel of the call */
+    uint64_t workgroups; /**< workgroups launched across all kernels of the call */
+    double   cu_occupancy; /**< launched workgroups over compute units, capped at 1.0 */
+    uint64_t bytes_estimate; /**< minimum operand bytes read and written for the shape */
+} rocblas_call_metrics;
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_call_metrics enables or disables per-call launch metrics
+    collection on the handle. While enabled, each GEMM dispatched through the
+    Tensile backend records the chosen solution's launch shape (total
+    workgroups, threads per workgroup), the fraction of the device's compute
+    units those workgroups cover, and the minimum operand traffic implied by
+    the problem shape, so telemetry can flag calls running below roofline
+    without attaching an external profiler. The snapshot is overwritten on
+    every collected call and sampled with rocblas_get_call_metrics.
+
+    Only calls served by the Tensile backend populate the snapshot; enabling
+    or disabling collection clears it. Collection is host-side bookkeeping and
+    does not synchronize the stream.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    enable    [uint32_t]
+              nonzero to collect launch metrics, 0 to disable collection.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_call_metrics(rocblas_handle handle, uint32_t enable);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_call_metrics copies the launch metrics recorded by the most
+    recent collected call on the handle. If no call has been collected since
+    rocblas_set_call_metrics was last called, the metrics are all zero.
+
+    cu_occupancy is the launch-shape coverage of the device — total
+    workgroups over compute units, capped at 1.0 — not register- or
+    LDS-limited occupancy, which would require device introspection.
+    bytes_estimate counts each operand touched once (A, B and C read, D
+    written, per batch instance); dividing it by the measured call time gives
+    a lower bound on achieved bandwidth for comparison against the device
+    roofline.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[out]
+    metrics   [rocblas_call_metrics*]
+              the recorded metrics of the most recent collected call.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_call_metrics(rocblas_handle        handle,
+                                                       rocblas_call_metrics* metrics);
+/*! @} */
+
+/*! \brief Function families of the host-side overhead counters sampled with
+    rocblas_get_cpu_overhead_stats. */
+typedef enum rocblas_cpu_overhead_family_
+{
+    rocblas_cpu_overhead_blas1   = 0, /**< vector-vector functions (dot, axpy) */
+    rocblas_cpu_overhead_blas2   = 1, /**< matrix-vector functions (gemv) */
+    rocblas_cpu_overhead_blas3   = 2, /**< matrix-matrix functions (gemm) */
+    rocblas_cpu_overhead_blas_ex = 3, /**< mixed-precision extensions (gemm_ex) */
+} rocblas_cpu_overhead_family;
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_get_cpu_overhead_stats samples the handle's host-side overhead
+    counters for one function family. Instrumented entry points time
+    themselves with the processor's cycle counter from entry to return of
+    the host call — argument validation, logging, dispatch and kernel
+    enqueue, but not device execution — and accumulate the result on the
+    handle. A CI harness can divide total_us by call_count after a run to
+    track the per-call host cost of the library against a latency budget.
+
+    The counters cover representative instrumented entry points of each
+    family (dot and axpy for blas1, gemv for blas2, gemm for blas3, gemm_ex
+    for the extensions), not every function, and are plain accumulators: a
+    handle shared across threads may lose increments under contention, which
+    is acceptable for trend tracking. The counters start at zero at handle
+    creation and are never reset. The per-call cost of the instrumentation
+    itself is two cycle-counter reads.
+
+    @param[in]
+    handle      [rocblas_handle]
+                handle to the rocblas library context queue.
+    @param[in]
+    family      [rocblas_cpu_overhead_family]
+                the function family to sample.
+    @param[out]
+    call_count  [uint64_t*]
+                the number of instrumented calls of the family on this handle.
+    @param[out]
+    total_us    [double*]
+                the accumulated host-side time of those calls in microseconds.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_cpu_overhead_stats(rocblas_handle              handle,
+                                                             rocblas_cpu_overhead_family family,
+                                                             uint64_t* call_count,
+                                                             double*   total_us);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_flush_denorms sets the handle's flush-to-zero policy. While
+    the policy is enabled, functions that carry flush-to-zero kernel variants
+    (currently the axpy family, including axpy_ex) dispatch kernels which
+    flush denormal operands and results to a zero of the same sign. Pipelines
+    that tolerate losing the denormal range get deterministic throughput
+    instead of data-dependent slowdowns on denormal inputs. The policy is
+    selected at kernel dispatch, so it costs nothing while disabled, and does
+    not affect functions without flush-to-zero variants.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    flush     [uint32_t]
+              nonzero to flush denormals to zero, zero to restore the
+              default IEEE behavior.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_flush_denorms(rocblas_handle handle, uint32_t flush);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_set_mapped_host_results sets the handle's zero-copy result
+    policy. While the policy is enabled, reduction functions producing tiny
+    results (the dot and iamax/iamin families) in host pointer mode write
+    their final scalars directly into mapped pinned host memory instead of
+    staging them in device memory and copying back, removing the
+    device-to-host transfer from the result path. Synchronization semantics
+    are unchanged: the call still blocks until the result is available in the
+    caller's buffer.
+
+    The policy needs device-visible host memory (hipHostMallocMapped); when
+    the mapped buffer cannot be obtained, affected functions silently fall
+    back to the default staged copy. Device pointer mode and functions
+    without tiny results are unaffected.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    enable    [uint32_t]
+              nonzero to write results through mapped host memory, zero to
+              restore the default staged copy.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_mapped_host_results(rocblas_handle handle,
+                                                              uint32_t       enable);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    Direct workspace-size queries. Each function computes the device workspace
+    the corresponding rocblas call would request for the given problem shape,
+    without a handle and without invoking the call, rounded as the handle's
+    workspace allocator rounds allocations. A pipeline can combine the results
+    of these queries over the calls it will make (maximum for workspaces that
+    are live one at a time, sum for concurrently live ones) and pass the total
+    to rocblas_set_device_memory_size once, so no call reallocates at runtime.
+    The sizes cover the standard 32-bit integer APIs.
+
+    rocblas_trsm_workspace_size and rocblas_trsm_batched_workspace_size report
+    the workspace of rocblas_Xtrsm(_strided_batched) and rocblas_Xtrsm_batched
+    respectively, assuming no user-supplied inverse (the rocblas_Xtrsm_ex
+    invA argument). Supported types: f32_r, f64_r, f32_c, f64_c.
+
+    rocblas_trsv_workspace_size reports the workspace of the trsv and
+    trsv_strided_batched/batched functions; it is independent of datatype.
+
+    rocblas_dot_workspace_size reports the workspace of the dot(c/u) family
+    for the given input datatype. Supported types: f16_r, bf16_r, f32_r,
+    f64_r, f32_c, f64_c.
+
+    rocblas_asum_workspace_size and rocblas_nrm2_workspace_size report the
+    workspace of the asum and nrm2 families. Supported types: f32_r, f64_r,
+    f32_c, f64_c.
+
+    rocblas_iamax_workspace_size reports the workspace of the iamax and iamin
+    families. Supported types: f32_r, f64_r, f32_c, f64_c.
+
+    @param[in]
+    side        [rocblas_side]
+                rocblas_side_left or rocblas_side_right (trsm only).
+    @param[in]
+    transA      [rocblas_operation]
+                form of op(A) (trsm only).
+    @param[in]
+    m           [rocblas_int]
+                number of rows (trsm only).
+    @param[in]
+    n           [rocblas_int]
+                number of columns, or vector length for the blas1 queries.
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch; pass 1 for non-batched calls.
+    @param[in]
+    type        [rocblas_datatype]
+                datatype of the call being queried.
+    @param[out]
+    size        [size_t *]
+                workspace requirement in bytes.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_workspace_size(rocblas_side      side,
+                                                          rocblas_operation transA,
+                                                          rocblas_int       m,
+                                                          rocblas_int       n,
+                                                          rocblas_int       batch_count,
+                                                          rocblas_datatype  type,
+                                                          size_t*           size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_batched_workspace_size(rocblas_side      side,
+                                                                  rocblas_operation transA,
+                                                                  rocblas_int       m,
+                                                                  rocblas_int       n,
+                                                                  rocblas_int       batch_count,
+                                                                  rocblas_datatype  type,
+                                                                  size_t*           size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_trsv_workspace_size(rocblas_int n,
+                                                          rocblas_int batch_count,
+                                                          size_t*     size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dot_workspace_size(rocblas_int      n,
+                                                         rocblas_int      batch_count,
+                                                         rocblas_datatype type,
+                                                         size_t*          size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_asum_workspace_size(rocblas_int      n,
+                                                          rocblas_int      batch_count,
+                                                          rocblas_datatype type,
+                                                          size_t*          size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_nrm2_workspace_size(rocblas_int      n,
+                                                          rocblas_int      batch_count,
+                                                          rocblas_datatype type,
+                                                          size_t*          size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_iamax_workspace_size(rocblas_int      n,
+                                                           rocblas_int      batch_count,
+                                                           rocblas_datatype type,
+                                                           size_t*          size);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    dot_multi computes the dot products of one vector x against a strided
+    family of k vectors in a single launch,
+
+        results[i] = dot(x, y_i),  i = 0, ..., k - 1,
+
+    reading x only once: each block caches its tile of x in registers and
+    sweeps all k vectors with it. Compared to k separate dot calls this cuts
+    both the launch count and the x bandwidth by a factor of k, as in the
+    orthogonalization steps of Krylov methods.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and in each y_i.
+    @param[in]
+    x         device pointer to the vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer to the first vector y_0.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   [rocblas_stride]
+              stride from the start of one vector (y_i) to the next (y_i+1).
+    @param[in]
+    k         [rocblas_int]
+              number of y vectors.
+    @param[inout]
+    results   device array or host array of size k to store the dot
+              products.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_multi(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const float*   x,
+                                                 rocblas_int    incx,
+                                                 const float*   y,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stridey,
+                                                 rocblas_int    k,
+                                                 float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_multi(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const double*  x,
+                                                 rocblas_int    incx,
+                                                 const double*  y,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stridey,
+                                                 rocblas_int    k,
+                                                 double*        results);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    dot_weighted computes a weighted dot product,
+
+        result = sum(w[i] * x[i] * y[i]),
+
+    applying the weight inside the reduction instead of requiring the caller
+    to materialize w .* x in a temporary vector first. A weight vector of
+    zeros and ones makes this a masked reduction, and passing y == x yields
+    a weighted (or masked) squared norm. A null w defaults every weight to
+    one, reducing to the ordinary dot product.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x, y and w.
+    @param[in]
+    x         device pointer to the vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer to the vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    w         device pointer to the weight vector, or null for unit weights.
+    @param[in]
+    incw      [rocblas_int]
+              specifies the increment for the elements of w.
+    @param[inout]
+    result    device pointer or host pointer to store the weighted dot
+              product.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot_weighted(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    const float*   x,
+                                                    rocblas_int    incx,
+                                                    const float*   y,
+                                                    rocblas_int    incy,
+                                                    const float*   w,
+                                                    rocblas_int    incw,
+                                                    float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot_weighted(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    const double*  x,
+                                                    rocblas_int    incx,
+                                                    const double*  y,
+                                                    rocblas_int    incy,
+                                                    const double*  w,
+                                                    rocblas_int    incw,
+                                                    double*        result);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rot_sequence applies a chain of k Givens rotations to one vector: for
+    i = 0, ..., k-1 in ascending order,
+
+        x_i   :=  c_i * x_i + s_i * x_i+1
+        x_i+1 := -s_i * x_i + c_i * x_i+1
+
+    where the right hand sides use the values before rotation i. The vector
+    spans k + 1 elements. GMRES-style solvers update the new Hessenberg
+    column this way with k separate rot calls on single-element slices; this
+    runs the whole chain in one kernel launch with each element read and
+    written once.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    k         [rocblas_int]
+              number of rotations; x holds k + 1 elements.
+    @param[inout]
+    x         device pointer storing the vector to rotate.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment between the elements of x.
+    @param[in]
+    c         device vector of the k rotation cosines.
+    @param[in]
+    s         device vector of the k rotation sines.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_srot_sequence(rocblas_handle handle,
+                                                    rocblas_int    k,
+                                                    float*         x,
+                                                    rocblas_int    incx,
+                                                    const float*   c,
+                                                    const float*   s);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_sequence(rocblas_handle handle,
+                                                    rocblas_int    k,
+                                                    double*        x,
+                                                    rocblas_int    incx,
+                                                    const double*  c,
+                                                    const double*  s);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rotg_rot_batched fuses rotg_batched with rot_batched: for each batch i
+    the Givens rotation is constructed from (a_i, b_i), written back to
+    a_i, b_i, c_i, s_i exactly as rotg_batched would, and immediately applied
+    to the vector pair (x_i, y_i):
+
+        x := c * x + s * y
+        y := c * y - s * x
+
+    Calling rotg_batched followed by rot_batched costs two kernel launches
+    and a global-memory round-trip of c and s between them; here the
+    parameters are generated and consumed in one launch. All arrays must be
+    device memory regardless of the handle pointer mode.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              number of elements in each x_i and y_i.
+    @param[inout]
+    a         device array of device pointers, each storing one input value
+              overwritten by r.
+    @param[inout]
+    b         device array of device pointers, each storing one input value
+              overwritten by z.
+    @param[out]
+    c         device array of device pointers receiving the rotation cosines.
+    @param[out]
+    s         device array of device pointers receiving the rotation sines.
+    @param[inout]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment between elements of each x_i.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment between elements of each y_i.
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_srotg_rot_batched(rocblas_handle handle,
+                                                        rocblas_int    n,
+                                                        float* const   a[],
+                                                        float* const   b[],
+                                                        float* const   c[],
+                                                        float* const   s[],
+                                                        float* const   x[],
+                                                        rocblas_int    incx,
+                                                        float* const   y[],
+                                                        rocblas_int    incy,
+                                                        rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drotg_rot_batched(rocblas_handle handle,
+                                                        rocblas_int    n,
+                                                        double* const  a[],
+                                                        double* const  b[],
+                                                        double* const  c[],
+                                                        double* const  s[],
+                                                        double* const  x[],
+                                                        rocblas_int    incx,
+                                                        double* const  y[],
+                                                        rocblas_int    incy,
+                                                        rocblas_int    batch_count);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS EX BETA API </b>
+
+    \details
+    geam_min_plus_argmin performs the min-plus relaxation of
+    rocblas_geam_ex_operation_min_plus with fused argmin tracking:
+
+        D(i,j) = min(beta * C(i,j), min over l of (alpha * op(A)(i,l) + alpha * op(B)(l,j)))
+
+    and records in the integer matrix argmin which l produced each winner, or
+    -1 where the incumbent beta * C(i,j) survives (including ties, so a
+    non-negative index always marks a strict improvement). op(X) is X or X**T
+    according to transA and transB; conjugate transpose is not supported. One
+    call performs a shortest-path relaxation step and the predecessor
+    bookkeeping that would otherwise re-read C and D in a second kernel.
+
+    When k is 0 the operation still writes D = beta * C elementwise and fills
+    argmin with -1. A and B are not read when alpha is 0, and C is not read
+    when beta is 0 (an absent incumbent behaves as a zero distance).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              op(A), rocblas_operation_none or rocblas_operation_transpose.
+    @param[in]
+    transB    [rocblas_operation]
+              op(B), rocblas_operation_none or rocblas_operation_transpose.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of op(A), C, D and argmin.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of op(B), C, D and argmin.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op(A) and rows of op(B).
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar applied to
+              the elements of A and B.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              leading dimension of A.
+    @param[in]
+    B         device pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar applied to
+              the elements of C.
+    @param[in]
+    C         device pointer storing the incumbent matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              leading dimension of C.
+    @param[out]
+    D         device pointer storing the relaxed matrix D. D may equal C for
+              an in-place update if ldd == ldc.
+    @param[in]
+    ldd       [rocblas_int]
+              leading dimension of D.
+    @param[out]
+    argmin    device pointer storing the m by n rocblas_int argmin matrix.
+    @param[in]
+    ldi       [rocblas_int]
+              leading dimension of argmin.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgeam_min_plus_argmin(rocblas_handle    handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_operation transB,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const float*      alpha,
+                                                            const float*      A,
+                                                            rocblas_int       lda,
+                                                            const float*      B,
+                                                            rocblas_int       ldb,
+                                                            const float*      beta,
+                                                            const float*      C,
+                                                            rocblas_int       ldc,
+                                                            float*            D,
+                                                            rocblas_int       ldd,
+                                                            rocblas_int*      argmin,
+                                                            rocblas_int       ldi);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgeam_min_plus_argmin(rocblas_handle    handle,
+                                                            rocblas_operation transA,
+                                                            rocblas_operation transB,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const double*     alpha,
+                                                            const double*     A,
+                                                            rocblas_int       lda,
+                                                            const double*     B,
+                                                            rocblas_int       ldb,
+                                                            const double*     beta,
+                                                            const double*     C,
+                                                            rocblas_int       ldc,
+                                                            double*           D,
+                                                            rocblas_int       ldd,
+                                                            rocblas_int*      argmin,
+                                                            rocblas_int       ldi);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS EX BETA API </b>
+
+    \details
+    gemv_ex performs one of the matrix-vector operations
+
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
+
+    with mixed precision: the matrix and x may be stored at a narrower
+    precision than the accumulation. alpha and beta are scalars of
+    compute_type. Unlike calling rocblas_gemm_ex with n == 1, the work runs
+    through the gemv kernels, which are shaped for matrix-vector problems.
+
+    Supported type combinations (a_type, x_type, y_type, compute_type):
+
+        f16_r,  f16_r,  f16_r,  f32_r
+        f16_r,  f16_r,  f32_r,  f32_r
+        bf16_r, bf16_r, bf16_r, f32_r
+        bf16_r, bf16_r, f32_r,  f32_r
+        f32_r,  f32_r,  f32_r,  f32_r
+        f64_r,  f64_r,  f64_r,  f64_r
+        f32_c,  f32_c,  f32_c,  f32_c
+        f64_c,  f64_c,  f64_c,  f64_c
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans     [rocblas_operation]
+              indicates whether matrix A is tranposed (conjugated) or not.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha of compute_type.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    x_type    [rocblas_datatype]
+              specifies the datatype of vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta of compute_type.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    y_type    [rocblas_datatype]
+              specifies the datatype of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags; rocblas_gemm_flags_deterministic requests
+              bit-identical results for this call only, independent of the
+              atomics mode set on the handle.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemv_ex(rocblas_handle    handle,
+                                              rocblas_operation trans,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              const void*       alpha,
+                                              const void*       A,
+                                              rocblas_datatype  a_type,
+                                              rocblas_int       lda,
+                                              const void*       x,
+                                              rocblas_datatype  x_type,
+                                              rocblas_int       incx,
+                                              const void*       beta,
+                                              void*             y,
+                                              rocblas_datatype  y_type,
+                                              rocblas_int       incy,
+                                              rocblas_datatype  compute_type,
+                                              uint32_t          flags);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS EX BETA API </b>
+
+    \details
+    trsm_ex_invert computes the packed inverted diagonal blocks of a triangular
+    matrix A in the layout consumed by the invA parameter of rocblas_trsm_ex.
+    When the same triangular factor is reused across many rocblas_trsm_ex calls,
+    computing invA once with this function and passing it to each solve removes
+    the inversion phase from every call.
+
+    This replaces the multi-step rocblas_trtri_batched recipe described in the
+    rocblas_trsm_ex documentation: a single call inverts all full 128x128
+    diagonal blocks of A as well as any smaller remaining diagonal block.
+
+    Device memory of at least 128 x k elements must be allocated for invA ahead
+    of time, and the element count passed as invA_size. The same invA_size value
+    should then be passed on to rocblas_trsm_ex along with invA.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+
+    @param[in]
+    uplo    [rocblas_fill]
+            - rocblas_fill_upper:  A is an upper triangular matrix.
+            - rocblas_fill_lower:  A is a lower triangular matrix.
+
+    @param[in]
+    diag    [rocblas_diagonal]
+            - rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            - rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    k       [rocblas_int]
+            k specifies the order of A; this is m when the subsequent solves use
+            rocblas_side_left and n when they use rocblas_side_right. k >= 0.
+
+    @param[in]
+    A       [void *]
+            device pointer storing matrix A of dimension ( lda, k ).
+            Only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     [rocblas_int]
+            lda specifies the first dimension of A. lda >= max( 1, k ).
+
+    @param[out]
+    invA    [void *]
+            device pointer storing the packed inverted diagonal blocks of A.
+            invA must hold at least 128 x k elements.
+
+    @param[in]
+    invA_size [rocblas_int]
+            invA_size specifies the number of elements of device memory in invA.
+
+    @param[in]
+    compute_type [rocblas_datatype]
+            specifies the datatype of computation.
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_ex_invert(rocblas_handle   handle,
+                                                     rocblas_fill     uplo,
+                                                     rocblas_diagonal diag,
+                                                     rocblas_int      k,
+                                                     const void*      A,
+                                                     rocblas_int      lda,
+                                                     void*            invA,
+                                                     rocblas_int      invA_size,
+                                                     rocblas_datatype compute_type);
+/*! @} */
+
 ROCBLAS_DEPRECATED_MSG(
     "rocblas_gemm_ex_get_solutions is a beta feature and is subject to change in future releases")
 /*! @{
@@ -675,7 +4015,10 @@ ROCBLAS_DEPRECATED_MSG(
     @param[in]
     solution_index
               [int32_t]
-              reserved for future use.
+              if algo is rocblas_gemm_algo_solution_index, this controls which
+              solution is used. When algo is not rocblas_gemm_algo_solution_index,
+              or if solution_index <= 0, the default gemm solution is used.
+              Solution indices can be queried with rocblas_gemm_ex3_get_solutions.
     @param[in]
     flags     [uint32_t]
               optional gemm flags.
@@ -708,6 +4051,243 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex3(rocblas_handle      handle,
                                                uint32_t            flags);
 //! @}
 
+ROCBLAS_DEPRECATED_MSG("rocblas_gemm_ex3_get_solutions is a beta feature and is subject to change "
+                       "in future releases")
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex3_get_solutions gets the indices for all the solutions that can solve a
+    corresponding call to rocblas_gemm_ex3. Which solution is used by rocblas_gemm_ex3 is
+    controlled by the solution_index parameter.
+
+    If list_array is NULL, list_size is an output and will be filled with the number of
+    solutions that can solve the GEMM. If list_array is not NULL, then it must be pointing to
+    an array with at least list_size elements and will be filled with the solution indices
+    that can solve the GEMM: the number of elements filled in will also be returned in
+    list_size.
+
+    Only the FP8/BF8 type combinations that run a native Tensile contraction are enumerated;
+    combinations that are internally converted before the contraction return
+    rocblas_status_not_implemented.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    a         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta.
+    @param[in]
+    c         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[out]
+    d         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type
+              [rocblas_computetype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    @param[out]
+    list_array [rocblas_int *]
+               output array for solution indices or NULL if getting number of solutions
+    @param[in,out]
+    list_size  [rocblas_int *]
+               size of list_array if getting solution indices or output with number of solutions
+               if list_array is NULL
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex3_get_solutions(rocblas_handle      handle,
+                                                             rocblas_operation   transA,
+                                                             rocblas_operation   transB,
+                                                             rocblas_int         m,
+                                                             rocblas_int         n,
+                                                             rocblas_int         k,
+                                                             const void*         alpha,
+                                                             const void*         a,
+                                                             rocblas_datatype    a_type,
+                                                             rocblas_int         lda,
+                                                             const void*         b,
+                                                             rocblas_datatype    b_type,
+                                                             rocblas_int         ldb,
+                                                             const void*         beta,
+                                                             const void*         c,
+                                                             rocblas_datatype    c_type,
+                                                             rocblas_int         ldc,
+                                                             void*               d,
+                                                             rocblas_datatype    d_type,
+                                                             rocblas_int         ldd,
+                                                             rocblas_computetype compute_type,
+                                                             rocblas_gemm_algo   algo,
+                                                             uint32_t            flags,
+                                                             rocblas_int*        list_array,
+                                                             rocblas_int*        list_size);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_gemm_ex3_amax performs the same operation as rocblas_gemm_ex3 and
+    additionally writes the absolute maximum of the output,
+
+        amax = max_ij |D(i,j)|,
+
+    to a device scalar on the handle's stream, as needed to derive the next
+    quantization scale in float8 training flows without a separate full
+    reduction pass over D by the caller. All other arguments follow
+    rocblas_gemm_ex3.
+
+    @param[out]
+    amax      device pointer to a single float receiving the absolute maximum
+              of D.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex3_amax(rocblas_handle      handle,
+                                                    rocblas_operation   transA,
+                                                    rocblas_operation   transB,
+                                                    rocblas_int         m,
+                                                    rocblas_int         n,
+                                                    rocblas_int         k,
+                                                    const void*         alpha,
+                                                    const void*         a,
+                                                    rocblas_datatype    a_type,
+                                                    rocblas_int         lda,
+                                                    const void*         b,
+                                                    rocblas_datatype    b_type,
+                                                    rocblas_int         ldb,
+                                                    const void*         beta,
+                                                    const void*         c,
+                                                    rocblas_datatype    c_type,
+                                                    rocblas_int         ldc,
+                                                    void*               d,
+                                                    rocblas_datatype    d_type,
+                                                    rocblas_int         ldd,
+                                                    rocblas_computetype compute_type,
+                                                    rocblas_gemm_algo   algo,
+                                                    int32_t             solution_index,
+                                                    uint32_t            flags,
+                                                    float*              amax);
+/*! @} */
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rocblas_f8_convert quantizes a strided-batched tensor to an 8-bit float
+    format using the same conversion machinery as the rocblas_gemm_ex3 input
+    path,
+
+        y_b[i] = downcast(scale * x_b[i]),    i = 0, ..., n - 1,
+
+    so pipelines that pre-quantize operands for the ex3 gemms share its
+    optimized rounding and packed-store implementation. Elements within a
+    batch instance are contiguous; batch instances are stride_x and stride_y
+    elements apart. Passing rocblas_gemm_flags_stochastic_rounding in flags
+    selects stochastic rounding seeded from the handle, as in
+    rocblas_gemm_ex3; otherwise round-to-nearest-even is used.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [int64_t]
+              number of elements per batch instance.
+    @param[in]
+    scale     pointer to the scale applied before the downcast, respecting
+              the handle's pointer mode.
+    @param[in]
+    x         pointer to the source tensor. x_type must be
+              rocblas_datatype_f32_r or rocblas_datatype_f16_r.
+    @param[in]
+    x_type    [rocblas_datatype]
+              element type of x.
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride in elements between batch instances of x.
+    @param[out]
+    y         pointer to the quantized tensor. y_type must be
+              rocblas_datatype_f8_r or rocblas_datatype_bf8_r.
+    @param[in]
+    y_type    [rocblas_datatype]
+              element type of y.
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride in elements between batch instances of y.
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of batch instances.
+    @param[in]
+    flags     [uint32_t]
+              rocblas_gemm_flags_none or
+              rocblas_gemm_flags_stochastic_rounding.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_f8_convert(rocblas_handle   handle,
+                                                 int64_t          n,
+                                                 const float*     scale,
+                                                 const void*      x,
+                                                 rocblas_datatype x_type,
+                                                 rocblas_stride   stride_x,
+                                                 void*            y,
+                                                 rocblas_datatype y_type,
+                                                 rocblas_stride   stride_y,
+                                                 rocblas_int      batch_count,
+                                                 uint32_t         flags);
+/*! @} */
+
 ROCBLAS_DEPRECATED_MSG(
     "gemm_strided_batched_ex3 is deprecated and it will be removed in the next major release of "
     "rocBLAS."
@@ -2393,6 +2393,13 @@ ROCBLAS_EXPORT rocblas_status rocblas_dznrm2_strided_batched_64(rocblas_handle h
     \details
     amax finds the first index of the element of maximum magnitude of a vector x.
 
+    amax may be recorded during hip stream capture in device pointer mode: the
+    1-based index is written to the result device pointer entirely on-stream,
+    so a later kernel in the same graph can consume it, and each replay of the
+    graph recomputes it against one internal workspace allocation. Host
+    pointer mode requires synchronization and returns
+    rocblas_status_not_implemented while the stream is capturing.
+
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
@@ -25068,6 +25075,49 @@ ROCBLAS_EXPORT void           rocblas_device_malloc_set_default_memory_size(size
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size);
 
+/*! \brief
+    \details
+    Gets the largest amount of device memory the handle has had in use at any
+    one time since its creation. Sizing rocblas_set_device_memory_size or
+    rocblas_set_workspace to this value guarantees no reallocation for the
+    workload observed so far.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if size is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    size            high-water mark of device memory in use, in bytes
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_high_watermark(rocblas_handle handle,
+                                                                       size_t*        size);
+
+/*! \brief
+    \details
+    Gets the number of times a function call has forced the handle to grow its
+    rocBLAS-managed device memory. A nonzero count on a hot path indicates the
+    workspace should be pre-reserved with rocblas_set_device_memory_size.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if count is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    count           number of allocation-triggered reallocations
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_realloc_count(rocblas_handle handle,
+                                                                      size_t*        count);
+
+/*! \brief
+    \details
+    Gets the number of device memory allocation attempts which have failed on
+    the handle, either because the device is out of memory or because a
+    user-provided workspace was too small.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if count is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    count           number of failed device memory allocation attempts
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_failed_alloc_count(rocblas_handle handle,
+                                                                           size_t*        count);
+
 /*! \brief
     \details
     Changes the size of allocated device memory at runtime.
@@ -25092,6 +25142,15 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_size(rocblas_handle hand
 
     Any previously allocated device memory managed by the handle is freed.
 
+    Functions which use temporary device memory are safe to record into a
+    hipGraph provided their workspace does not have to be allocated during
+    capture. This is guaranteed either by pre-reserving workspace before the
+    capture (query the size with rocblas_start/stop_device_memory_size_query
+    and reserve it with rocblas_set_workspace or
+    rocblas_set_device_memory_size), or by leaving memory rocBLAS-managed, in
+    which case any allocation performed while the stream is capturing is done
+    with stream-ordered allocation, which is capture-legal.
+
     Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_success otherwise
     @param[in]
     handle          rocblas handle
@@ -25103,6 +25162,32 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_size(rocblas_handle hand
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size);
 
+/*! \brief
+    \details
+    Enables or disables stream-ordered device memory allocation for the handle.
+
+    When enabled, rocBLAS workspace memory is obtained with hipMallocAsync/hipFreeAsync
+    and the device's default memory pool is configured for reuse: the pool's release
+    threshold is raised so freed blocks stay pooled instead of being returned to the OS
+    after each synchronize, and cross-stream reuse is allowed, so repeated alloc/free
+    cycles are served from the pool rather than the driver allocator. The release
+    threshold defaults to holding all freed memory and can be overridden in bytes with
+    the environment variable ROCBLAS_STREAM_ORDER_RELEASE_THRESHOLD. Pooled memory is
+    released back to the OS when the handle is destroyed.
+
+    Stream-ordered allocation can also be enabled at handle creation with the
+    environment variable ROCBLAS_STREAM_ORDER_ALLOC.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_not_implemented
+    on ROCm versions without stream-ordered allocation support; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[in]
+    enable          true to enable stream-ordered allocation, false to disable
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_stream_order_memory_allocation(rocblas_handle handle,
+                                                                         bool           enable);
+
 /*! \brief
     \details
     Returns true when device memory in handle is managed by rocBLAS
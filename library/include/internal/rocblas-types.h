@@ -254,7 +254,12 @@ typedef enum rocblas_performance_metric_
     rocblas_device_efficiency_performance_metric = 1,
     /*! \brief Select the solution with the highest GFlops per compute unit it uses. This
      * may be useful when running multiple small gemm problems simultaneously  */
-    rocblas_cu_efficiency_performance_metric = 2
+    rocblas_cu_efficiency_performance_metric = 2,
+    /*! \brief Select the solution with the fastest measured time on this device.
+     * Achieved times are recorded during live runs and selection prefers the
+     * empirically fastest recent solution for each problem shape, adapting when
+     * the heuristic prediction is wrong  */
+    rocblas_measured_performance_metric = 3
 } rocblas_performance_metric;
 
 /*! \brief Indicates if layer is active with bitmask*/
@@ -303,9 +308,35 @@ typedef enum rocblas_gemm_flags_
     rocblas_gemm_flags_fp16_alt_impl        = 0x4,
     rocblas_gemm_flags_check_solution_index = 0x8,
     rocblas_gemm_flags_fp16_alt_impl_rnz    = 0x10,
-    rocblas_gemm_flags_stochastic_rounding  = 0x20
+    rocblas_gemm_flags_stochastic_rounding  = 0x20,
+    /*! \brief Request bit-identical results across runs for this call only,
+    * restricting solution selection to deterministic kernels as if
+    * rocblas_atomics_not_allowed were set on the handle. Calls without this
+    * flag keep the atomics mode of the handle, so only the calls that need
+    * replayable results pay the deterministic penalty. */
+    rocblas_gemm_flags_deterministic = 0x40,
+    /*! \brief The A operand pointer holds a buffer produced by rocblas_gemm_pack
+    * rather than an ordinary column-major matrix; trans_a keeps the meaning it
+    * had at pack time and the lda argument is ignored. Only honored by
+    * rocblas_gemm_ex. */
+    rocblas_gemm_flags_packed_a = 0x80,
+    /*! \brief As rocblas_gemm_flags_packed_a, for the B operand. */
+    rocblas_gemm_flags_packed_b = 0x100,
+    /*! \brief Compute an f32 gemm by splitting each operand into an f16
+    * high/low pair and accumulating the three significant cross products
+    * (hi*hi + hi*lo + lo*hi) in f32, trading a bounded accuracy loss for
+    * f16 matrix-instruction throughput. Only honored by rocblas_gemm_ex
+    * when all matrix types and the compute type are f32_r. */
+    rocblas_gemm_flags_split_f16 = 0x200
 } rocblas_gemm_flags;
 
+/*! \brief Selects which gemm operand a rocblas_gemm_pack call targets */
+typedef enum rocblas_gemm_pack_operand_
+{
+    rocblas_gemm_pack_operand_a = 0, /**< pack the A operand. */
+    rocblas_gemm_pack_operand_b = 1 /**< pack the B operand. */
+} rocblas_gemm_pack_operand;
+
 /*! \brief Union for representing scalar values */
 typedef union rocblas_union_u
 {
@@ -335,8 +366,37 @@ typedef enum rocblas_check_numerics_mode_
     //Limits checks to NaN and infinities
     rocblas_check_numerics_mode_only_nan_inf = 0x8,
 
+    //Skips the per-call copy-back and synchronization; results accumulate in
+    //device-side flags polled with rocblas_get_numerics_status
+    rocblas_check_numerics_mode_async = 0x10,
+
 } rocblas_check_numerics_mode;
 
+/*! \brief Function families that numerical checking can be limited to (see
+    rocblas_set_check_numerics_mode); combine with bitwise OR. Functions
+    outside the selected scope skip the checks entirely*/
+typedef enum rocblas_check_numerics_scope_
+{
+    //Level 1 BLAS functions and their _ex forms
+    rocblas_check_numerics_scope_blas1 = 0x1,
+
+    //Level 2 BLAS functions
+    rocblas_check_numerics_scope_blas2 = 0x2,
+
+    //Level 3 BLAS functions other than the gemm family
+    rocblas_check_numerics_scope_blas3 = 0x4,
+
+    //gemm and its extensions (gemm_ex, gemm_ex3, gemmt)
+    rocblas_check_numerics_scope_gemm = 0x8,
+
+    //Remaining extension functions (geam_ex, trsv_ex, ...)
+    rocblas_check_numerics_scope_ex = 0x10,
+
+    //All functions; the default
+    rocblas_check_numerics_scope_all = 0x7fffffff,
+
+} rocblas_check_numerics_scope;
+
 typedef enum rocblas_math_mode_
 {
     //Default precision
@@ -68,7 +68,7 @@ namespace
         }
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
 
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_asum_batched_name<Ti>, n, x, incx, batch_count);
@@ -102,7 +102,7 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
         {
             return rocblas_status_memory_error;
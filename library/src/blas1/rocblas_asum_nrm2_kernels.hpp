@@ -78,13 +78,46 @@
 // blocks
 template <typename API_INT, int NB, typename FETCH, typename TPtrX, typename To>
 ROCBLAS_KERNEL(NB)
-rocblas_reduction_kernel_part1(rocblas_int    n,
+rocblas_reduction_kernel_part1(const rocblas_int* __restrict__ predicate,
+                               rocblas_int    n,
                                rocblas_int    nblocks,
                                TPtrX          xvec,
                                rocblas_stride shiftx,
                                API_INT        incx,
                                rocblas_stride stridex,
                                To*            workspace)
+{
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
+    To sum = rocblas_default_value<To>{}();
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    // The grid fanout follows the part's CU count rather than n/NB, so each
+    // block strides over every NB-wide chunk the split assigns it
+    for(int64_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += int64_t(nblocks) * blockDim.x)
+        sum += FETCH{}(x[tid * incx]);
+
+    sum = rocblas_dot_block_reduce<NB, To>(sum); // sum reduction only
+
+    if(threadIdx.x == 0)
+        workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
+}
+
+// Single-kernel variant of part1: block partial sums are accumulated directly
+// into the result with device-scope atomics, so no part2 launch is needed.
+// Only valid when FINALIZE is the identity; the caller must zero result first.
+template <typename API_INT, int NB, typename FETCH, typename TPtrX, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_kernel_atomic(rocblas_int    n,
+                                TPtrX          xvec,
+                                rocblas_stride shiftx,
+                                API_INT        incx,
+                                rocblas_stride stridex,
+                                To*            result)
 {
     int64_t tid = blockIdx.x * blockDim.x + threadIdx.x;
     To      sum;
@@ -100,7 +133,42 @@ rocblas_reduction_kernel_part1(rocblas_int    n,
     sum = rocblas_dot_block_reduce<NB, To>(sum); // sum reduction only
 
     if(threadIdx.x == 0)
-        workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
+        rocblas_atomic_add(&result[blockIdx.y], sum);
+}
+
+// One-launch variant for small n: a single workgroup reduces one batch member
+// end-to-end and applies FINALIZE when storing, so neither the part2 launch
+// nor the block-partials workspace is needed.
+template <typename API_INT,
+          int NB,
+          typename FETCH,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_kernel_one_block(const rocblas_int* __restrict__ predicate,
+                                   rocblas_int    n,
+                                   TPtrX          xvec,
+                                   rocblas_stride shiftx,
+                                   API_INT        incx,
+                                   rocblas_stride stridex,
+                                   Tr*            result)
+{
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    To sum = rocblas_default_value<To>{}();
+    for(int64_t tid = threadIdx.x; tid < n; tid += NB)
+        sum += FETCH{}(x[tid * incx]);
+
+    sum = rocblas_dot_block_reduce<NB, To>(sum);
+
+    if(threadIdx.x == 0)
+        result[blockIdx.y] = Tr(FINALIZE{}(sum));
 }
 
 // kernel 2 is used from non-strided reduction_batched see include file
@@ -108,8 +176,15 @@ rocblas_reduction_kernel_part1(rocblas_int    n,
 // number of threads (NB) loop blocks
 template <int NB, typename FINALIZE, typename To, typename Tr>
 ROCBLAS_KERNEL(NB)
-rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+rocblas_reduction_kernel_part2(const rocblas_int* __restrict__ predicate,
+                               rocblas_int nblocks,
+                               To*         workspace,
+                               Tr*         result)
 {
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
     rocblas_int tx = threadIdx.x;
     To          sum;
 
@@ -193,11 +268,84 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
 
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
+    // A bound device predicate is checked by the part1/part2/one-block
+    // kernels; the atomic single-kernel path below does not carry it
+    const rocblas_int* predicate = handle->device_predicate;
+
+    // Opt-in single-kernel reduction for identity-finalized reductions (asum):
+    // partial sums go straight to the result with device-scope atomics,
+    // skipping the part2 launch. nrm2 keeps the two-kernel scheme since its
+    // finalize (sqrt) must run after the full sum is formed.
+    if constexpr(std::is_same_v<FINALIZE, rocblas_finalize_identity>
+                 && rocblas_reduction_can_use_atomics<To, Tr>())
+    {
+        if(rocblas_reduction_atomics_enabled()
+           && handle->atomics_mode == rocblas_atomics_allowed
+           && handle->pointer_mode == rocblas_pointer_mode_device
+           && n < c_atomic_reduction_n_limit && !predicate)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(result, 0, sizeof(Tr) * batch_count, handle->get_stream()));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_atomic<API_INT, NB, FETCH>),
+                                  dim3(blocks, batch_count),
+                                  NB,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  x,
+                                  shiftx,
+                                  incx,
+                                  stridex,
+                                  result);
+
+            return rocblas_status_success;
+        }
+    }
+
+    // Small-n one-launch path: one workgroup reduces each batch member
+    // end-to-end, FINALIZE included, eliminating the part2 launch. In device
+    // pointer mode the result is written directly with no workspace traffic.
+    if(blocks <= 4)
+    {
+        Tr* output = result; // device mode output directly to result
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            output = (Tr*)workspace;
+
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_reduction_kernel_one_block<API_INT, NB, FETCH, FINALIZE, TPtrX, To>),
+            dim3(1, batch_count),
+            NB,
+            0,
+            handle->get_stream(),
+            predicate,
+            n,
+            x,
+            shiftx,
+            incx,
+            stridex,
+            output);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, output, result, batch_count));
+        }
+
+        return rocblas_status_success;
+    }
+
+    // part1 grid-strides, so its fanout is tuned to the part's CU count
+    // rather than the full n/NB split; fewer, fuller blocks write fewer
+    // partials for part2 to gather
+    blocks = rocblas_reduction_kernel_tuned_block_count(handle, n, NB);
+
     ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part1<API_INT, NB, FETCH>),
                           dim3(blocks, batch_count),
                           NB,
                           0,
                           handle->get_stream(),
+                          predicate,
                           n,
                           blocks,
                           x,
@@ -213,6 +361,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
                               NB,
                               0,
                               handle->get_stream(),
+                              predicate,
                               blocks,
                               workspace,
                               result);
@@ -232,6 +381,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
                                   NB,
                                   0,
                                   handle->get_stream(),
+                                  predicate,
                                   blocks,
                                   workspace,
                                   (Tr*)(workspace + size_t(batch_count) * blocks));
@@ -242,24 +392,16 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
             // If FINALIZE is trivial or kernel part2 was called, result is in the
             // beginning of workspace[0]+offset, and can be copied directly.
             size_t offset = reduceKernel ? size_t(batch_count) * blocks : 0;
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
-                                               workspace + offset,
-                                               batch_count * sizeof(Tr),
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, workspace + offset, result, batch_count));
         }
         else
         {
             // If FINALIZE is not trivial and kernel part2 was not called, then
             // workspace[0] needs to be finalized on host.
             auto res = std::make_unique<To[]>(batch_count);
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&res[0],
-                                               workspace,
-                                               batch_count * sizeof(To),
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, workspace, &res[0], batch_count));
             for(rocblas_int i = 0; i < batch_count; i++)
                 result[i] = Tr(FINALIZE{}(res[i]));
         }
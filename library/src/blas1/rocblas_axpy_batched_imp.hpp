@@ -64,7 +64,7 @@ namespace
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
 
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -21,12 +21,15 @@
  * ************************************************************************ */
 #pragma once
 
+#include "cpu_overhead.hpp"
 #include "handle.hpp"
 #include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_axpy.hpp"
+#include "rocblas_blas1_sequence.hpp"
 #include "rocblas_block_sizes.h"
+#include "rocblas_hybrid_host.hpp"
 #include "utility.hpp"
 
 namespace
@@ -57,10 +60,13 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_internal_cpu_overhead_timer overhead_timer(handle,
+                                                           rocblas_internal_cpu_family_blas1);
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_axpy_name<T>,
@@ -127,6 +133,30 @@ namespace
                 return axpy_check_numerics_status;
         }
 
+        // Deferred sequence recording: between rocblas_begin_sequence and
+        // rocblas_end_sequence, eligible calls queue a descriptor instead of
+        // launching
+        if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            if(!check_numerics && rocblas_blas1_sequence_eligible(handle, n, incx, incy))
+                return rocblas_blas1_sequence_record(handle,
+                                                     rocblas_blas1_seq_op::axpy,
+                                                     rocblas_int(n),
+                                                     double(*alpha),
+                                                     x,
+                                                     rocblas_int(incx),
+                                                     y,
+                                                     rocblas_int(incy));
+        }
+
+        // Opt-in hybrid dispatch: tiny unit-stride host-pointer-mode calls
+        // compute on the host, skipping the kernel-launch latency floor
+        if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            if(!check_numerics && rocblas_hybrid_host_eligible(handle, n, incx, incy))
+                return rocblas_hybrid_host_axpy(handle, n, *alpha, x, y);
+        }
+
         rocblas_status status = ROCBLAS_API(rocblas_internal_axpy_template)(handle,
                                                                             n,
                                                                             alpha,
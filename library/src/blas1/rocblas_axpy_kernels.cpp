@@ -74,6 +74,33 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride  stride_y,
                                            rocblas_int     batch_count)
 {
+    // large pointer batches that are really strided take the cheaper strided
+    // addressing path, saving the per-workgroup pointer-array dereferences
+    if(batch_count >= c_batch_stride_detect_min_batch && !handle->is_stream_in_capture_mode())
+    {
+        const T*       x_base;
+        T*             y_base;
+        rocblas_stride x_stride, y_stride;
+        if(rocblas_internal_uniform_batch_stride(
+               handle->get_stream(), x, batch_count, x_base, x_stride)
+           && rocblas_internal_uniform_batch_stride(
+               handle->get_stream(), y, batch_count, y_base, y_stride))
+            return ROCBLAS_API(rocblas_internal_axpy_launcher)<rocblas_int, ROCBLAS_AXPY_NB, T>(
+                handle,
+                n,
+                alpha,
+                stride_alpha,
+                x_base,
+                offset_x,
+                incx,
+                x_stride,
+                y_base,
+                offset_y,
+                incy,
+                y_stride,
+                batch_count);
+    }
+
     return ROCBLAS_API(rocblas_internal_axpy_launcher)<rocblas_int, ROCBLAS_AXPY_NB, T>(
         handle,
         n,
@@ -26,13 +26,21 @@
 #include "int64_helpers.hpp"
 #include "rocblas.h"
 #include "rocblas_axpy.hpp"
+#include "rocblas_blas1_unroll.hpp"
 
 //!
 //! @brief General kernel (batched, strided batched) of axpy.
 //!
-template <typename API_INT, rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+template <typename API_INT,
+          rocblas_int NB,
+          typename Tex,
+          bool FTZ = false,
+          typename Ta,
+          typename Tx,
+          typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_axpy_kernel(rocblas_int    n,
+rocblas_axpy_kernel(const rocblas_int* __restrict__ predicate,
+                    rocblas_int    n,
                     Ta             alpha_device_host,
                     rocblas_stride stride_alpha,
                     Tx __restrict__ x,
@@ -44,6 +52,10 @@ rocblas_axpy_kernel(rocblas_int    n,
                     API_INT        incy,
                     rocblas_stride stride_y)
 {
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
     {
@@ -56,7 +68,110 @@ rocblas_axpy_kernel(rocblas_int    n,
         auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
         auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
 
-        *ty = (*ty) + Tex(alpha) * (*tx);
+        // explicit round back to the storage type; Tex may be wider than *ty
+        using Tyv = std::remove_pointer_t<decltype(ty)>;
+
+        *ty = Tyv(rocblas_ftz<FTZ>(
+            rocblas_cmadd(Tex(alpha), Tex(rocblas_ftz<FTZ>(*tx)), Tex(rocblas_ftz<FTZ>(*ty)))));
+    }
+}
+
+//!
+//! @brief General kernel with a compile-time per-thread unroll: each block
+//! covers NB * WIN elements with an NB-strided inner loop (the dot kernel
+//! layout). WIN == 1 is the historical one-element-per-thread kernel; the
+//! launcher picks the depth from the per-arch table in
+//! rocblas_blas1_unroll.hpp.
+//!
+template <typename API_INT,
+          rocblas_int NB,
+          int         WIN,
+          typename Tex,
+          bool FTZ = false,
+          typename Ta,
+          typename Tx,
+          typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpy_kernel_win(const rocblas_int* __restrict__ predicate,
+                        rocblas_int    n,
+                        Ta             alpha_device_host,
+                        rocblas_stride stride_alpha,
+                        Tx __restrict__ x,
+                        rocblas_stride offset_x,
+                        API_INT        incx,
+                        rocblas_stride stride_x,
+                        Ty __restrict__ y,
+                        rocblas_stride offset_y,
+                        API_INT        incy,
+                        rocblas_stride stride_y)
+{
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    if(!alpha)
+    {
+        return;
+    }
+
+    int64_t base = int64_t(blockIdx.x) * NB * WIN + threadIdx.x;
+
+    for(int j = 0; j < WIN; j++)
+    {
+        int64_t tid = base + j * NB;
+        if(tid < n)
+        {
+            auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
+            auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
+
+            // explicit round back to the storage type; Tex may be wider than *ty
+            using Tyv = std::remove_pointer_t<decltype(ty)>;
+
+            *ty = Tyv(rocblas_ftz<FTZ>(
+                rocblas_cmadd(Tex(alpha), Tex(rocblas_ftz<FTZ>(*tx)), Tex(rocblas_ftz<FTZ>(*ty)))));
+        }
+    }
+}
+
+//!
+//! @brief Grid-stride kernel covering a full 64-bit length in a single launch,
+//! used by the ILP64 launcher instead of chunking into 32-bit-sized pieces.
+//!
+template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpy_kernel_64(const rocblas_int* __restrict__ predicate,
+                       int64_t        n,
+                       Ta             alpha_device_host,
+                       rocblas_stride stride_alpha,
+                       Tx __restrict__ x,
+                       rocblas_stride offset_x,
+                       int64_t        incx,
+                       rocblas_stride stride_x,
+                       Ty __restrict__ y,
+                       rocblas_stride offset_y,
+                       int64_t        incy,
+                       rocblas_stride stride_y)
+{
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    if(!alpha)
+    {
+        return;
+    }
+
+    int64_t inc = int64_t(gridDim.x) * blockDim.x;
+    for(int64_t tid = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; tid < n; tid += inc)
+    {
+        auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
+        auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
+
+        using Tyv = std::remove_pointer_t<decltype(ty)>;
+
+        *ty = Tyv(rocblas_cmadd(Tex(alpha), Tex(*tx), Tex(*ty)));
     }
 }
 
@@ -64,7 +179,7 @@ rocblas_axpy_kernel(rocblas_int    n,
 //! @brief Optimized kernel for the AXPY floating points.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
-template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+template <rocblas_int NB, typename Tex, bool FTZ, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
 rocblas_saxpy_2_kernel(rocblas_int    n,
                        Ta             alpha_device_host,
@@ -85,21 +200,26 @@ rocblas_saxpy_2_kernel(rocblas_int    n,
     auto* ty = load_ptr_batch(y, blockIdx.y, offset_y, stride_y);
 
     int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    if(tid >= n)
+        return;
 
-    if(tid < n - 1)
-    {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vectors `x` and `y`
-        for(int j = 0; j < 2; ++j)
-        {
-            ty[tid + j] = ty[tid + j] + Tex(alpha) * tx[tid + j];
-        }
-    }
+    // Each thread access contiguous elements for example Thread '0' access indices '0' and '1'
+    // of the vectors `x` and `y`; the trailing element of an odd `n` is covered by masking.
+    int count = n - tid < 2 ? int(n - tid) : 2;
+
+    using Tyv = std::remove_pointer_t<decltype(ty)>;
 
-    // If `n` is odd then the computation of last element in the vectors is covered below.
-    if(n % 2 != 0 && tid == n - 1)
+    Tyv xvals[2], yvals[2];
+    rocblas_masked_load(tx + tid, count, xvals);
+    rocblas_masked_load(ty + tid, count, yvals);
+
+    for(int j = 0; j < 2; ++j)
     {
-        ty[tid] = ty[tid] + Tex(alpha) * tx[tid];
+        yvals[j] = rocblas_ftz<FTZ>(rocblas_ftz<FTZ>(yvals[j])
+                                    + Tex(alpha) * rocblas_ftz<FTZ>(xvals[j]));
     }
+
+    rocblas_masked_store(yvals, count, ty + tid);
 }
 
 //!
@@ -109,6 +229,7 @@ template <typename API_INT,
           int DIM_X,
           int DIM_Y,
           typename Tex,
+          bool FTZ,
           typename Ta,
           typename Tx,
           typename Ty>
@@ -148,47 +269,23 @@ rocblas_axpy_kernel_batched(rocblas_int    n,
                 auto tx = load_ptr_batch(x, bid + i, offset_x, stride_x);
                 auto ty = load_ptr_batch(y, bid + i, offset_y, stride_y);
 
-                *ty = (*ty) + ex_alph * (*tx);
+                using Tyv = std::remove_pointer_t<decltype(ty)>;
+
+                *ty = Tyv(rocblas_ftz<FTZ>(
+                    rocblas_cmadd(ex_alph, Tex(rocblas_ftz<FTZ>(*tx)), Tex(rocblas_ftz<FTZ>(*ty)))));
             }
         }
     }
 }
 
 //!
-//! @brief Optimized kernel for the remaining part of 8 half floating points.
-//! @remark Increment are required to be equal to one, that's why they are unspecified.
-//!
-template <rocblas_int NB, typename Ta, typename Tx, typename Ty>
-ROCBLAS_KERNEL(NB)
-rocblas_haxpy_mod_8_kernel(rocblas_int    n_mod_8,
-                           Ta             alpha_device_host,
-                           rocblas_stride stride_alpha,
-                           Tx             x,
-                           int64_t        offset_x,
-                           rocblas_stride stride_x,
-                           Ty             y,
-                           int64_t        offset_y,
-                           rocblas_stride stride_y)
-{
-    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
-    if(!alpha)
-        return;
-
-    int64_t tid = blockIdx.x * blockDim.x + threadIdx.x;
-    if(tid < n_mod_8)
-    {
-        auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid, stride_x);
-        auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid, stride_y);
-        *ty += alpha * (*tx);
-    }
-}
-
-//!
-//! @brief Optimized kernel for the groups of 8 half floating points.
+//! @brief Optimized kernel for the groups of 8 half floating points; a
+//! partial last group is handled with predicated accesses in the same launch
+//! instead of a separate cleanup kernel.
 //!
-template <rocblas_int NB, typename Ta, typename Tx, typename Ty>
+template <rocblas_int NB, bool FTZ, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_haxpy_mlt_8_kernel(rocblas_int    n_mlt_8,
+rocblas_haxpy_mlt_8_kernel(rocblas_int    n,
                            Ta             alpha_device_host,
                            rocblas_stride stride_alpha,
                            Tx             x,
@@ -218,7 +315,10 @@ rocblas_haxpy_mlt_8_kernel(rocblas_int    n_mlt_8,
     rocblas_half2 z0, z1, z2, z3;
 
     auto tid = t8id * 8;
-    if(tid < n_mlt_8)
+    if(tid >= n)
+        return;
+
+    if(tid + 8 <= n)
     {
         //
         // Cast to rocblas_half8.
@@ -249,11 +349,31 @@ rocblas_haxpy_mlt_8_kernel(rocblas_int    n_mlt_8,
         x3[0] = (*ax)[6];
         x3[1] = (*ax)[7];
 
+        if(FTZ)
+        {
+            x0 = rocblas_flush_denorm(x0);
+            x1 = rocblas_flush_denorm(x1);
+            x2 = rocblas_flush_denorm(x2);
+            x3 = rocblas_flush_denorm(x3);
+            y0 = rocblas_flush_denorm(y0);
+            y1 = rocblas_flush_denorm(y1);
+            y2 = rocblas_flush_denorm(y2);
+            y3 = rocblas_flush_denorm(y3);
+        }
+
         z0 = rocblas_fmadd_half2(alpha_h2.value, x0, y0);
         z1 = rocblas_fmadd_half2(alpha_h2.value, x1, y1);
         z2 = rocblas_fmadd_half2(alpha_h2.value, x2, y2);
         z3 = rocblas_fmadd_half2(alpha_h2.value, x3, y3);
 
+        if(FTZ)
+        {
+            z0 = rocblas_flush_denorm(z0);
+            z1 = rocblas_flush_denorm(z1);
+            z2 = rocblas_flush_denorm(z2);
+            z3 = rocblas_flush_denorm(z3);
+        }
+
         (*ay)[0] = z0[0];
         (*ay)[1] = z0[1];
         (*ay)[2] = z1[0];
@@ -263,32 +383,162 @@ rocblas_haxpy_mlt_8_kernel(rocblas_int    n_mlt_8,
         (*ay)[6] = z3[0];
         (*ay)[7] = z3[1];
     }
+    else
+    {
+        // partial last group: predicated accesses instead of a data-dependent
+        // cleanup loop
+        auto* ax = load_ptr_batch(x, blockIdx.y, offset_x + tid, stride_x);
+        auto* ay = load_ptr_batch(y, blockIdx.y, offset_y + tid, stride_y);
+
+        int count = int(n - tid);
+
+        rocblas_half xv[8], yv[8];
+        rocblas_masked_load(ax, count, xv);
+        rocblas_masked_load(ay, count, yv);
+
+        for(int j = 0; j < 8; ++j)
+            yv[j] = rocblas_ftz<FTZ>(rocblas_ftz<FTZ>(yv[j])
+                                     + alpha_value * rocblas_ftz<FTZ>(xv[j]));
+
+        rocblas_masked_store(yv, count, ay);
+    }
 }
 
 //!
-//! @brief General template to compute y = a * x + y.
+//! @brief Optimized kernel for the groups of 8 bfloat16 floating points; a
+//! partial last group is handled with predicated accesses in the same launch
+//! instead of a separate cleanup kernel.
 //!
-template <typename API_INT, int NB, typename Tex, typename Ta, typename Tx, typename Ty>
-ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
-    rocblas_internal_axpy_launcher(rocblas_handle handle,
-                                   API_INT        n,
-                                   Ta             alpha,
-                                   rocblas_stride stride_alpha,
-                                   Tx             x,
-                                   rocblas_stride offset_x,
-                                   API_INT        incx,
-                                   rocblas_stride stride_x,
-                                   Ty             y,
-                                   rocblas_stride offset_y,
-                                   API_INT        incy,
-                                   rocblas_stride stride_y,
-                                   API_INT        batch_count)
+template <rocblas_int NB, bool FTZ, typename Ta, typename Tx, typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_baxpy_mlt_8_kernel(rocblas_int    n,
+                           Ta             alpha_device_host,
+                           rocblas_stride stride_alpha,
+                           Tx             x,
+                           rocblas_stride offset_x,
+                           rocblas_stride stride_x,
+                           Ty             y,
+                           rocblas_stride offset_y,
+                           rocblas_stride stride_y)
 {
-    if(n <= 0 || batch_count <= 0) // Quick return if possible. Not Argument error
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    if(!alpha)
+        return;
+
+    // Tex is float for every bfloat16 configuration, so the arithmetic is
+    // carried out in float registers and only the loads and stores are bfloat16.
+    float alpha_f = float(alpha);
+
+    int64_t tid = (threadIdx.x + int64_t(blockIdx.x) * blockDim.x) * 8;
+    if(tid >= n)
+        return;
+
+    const rocblas_bfloat16* ax
+        = (const rocblas_bfloat16*)load_ptr_batch(x, blockIdx.y, offset_x + tid, stride_x);
+    rocblas_bfloat16* ay
+        = (rocblas_bfloat16*)load_ptr_batch(y, blockIdx.y, offset_y + tid, stride_y);
+
+    if(tid + 8 <= n && rocblas_is_16B_aligned(ax) && rocblas_is_16B_aligned(ay))
     {
-        return rocblas_status_success;
+        // 8 bfloat16 are 16 bytes, so each group is one vector load and
+        // store per operand. tid advances in 16-byte steps, making the
+        // alignment test uniform within a block.
+        rocblas_chunk16<rocblas_bfloat16> vx = *(const rocblas_chunk16<rocblas_bfloat16>*)ax;
+        rocblas_chunk16<rocblas_bfloat16> vy = *(const rocblas_chunk16<rocblas_bfloat16>*)ay;
+
+        for(int j = 0; j < 8; ++j)
+            vy.data[j]
+                = rocblas_bfloat16(rocblas_ftz<FTZ>(alpha_f * float(rocblas_ftz<FTZ>(vx.data[j]))
+                                                    + float(rocblas_ftz<FTZ>(vy.data[j]))));
+
+        *(rocblas_chunk16<rocblas_bfloat16>*)ay = vy;
+    }
+    else
+    {
+        // unaligned or partial last group: predicated accesses instead of a
+        // data-dependent cleanup loop
+        int count = n - tid < 8 ? int(n - tid) : 8;
+
+        rocblas_bfloat16 xv[8], yv[8];
+        rocblas_masked_load(ax, count, xv);
+        rocblas_masked_load(ay, count, yv);
+
+        for(int j = 0; j < 8; ++j)
+            yv[j] = rocblas_bfloat16(rocblas_ftz<FTZ>(alpha_f * float(rocblas_ftz<FTZ>(xv[j]))
+                                                      + float(rocblas_ftz<FTZ>(yv[j]))));
+
+        rocblas_masked_store(yv, count, ay);
+    }
+}
+
+//!
+//! @brief Launch of the general axpy kernel at a fixed unroll depth; called
+//! from the dispatch body's fallback path after the per-arch depth is chosen.
+//!
+template <typename API_INT,
+          int NB,
+          int WIN,
+          bool FTZ,
+          typename Tex,
+          typename Ta,
+          typename Tx,
+          typename Ty>
+rocblas_status rocblas_internal_axpy_launch_win(rocblas_handle handle,
+                                                const rocblas_int* __restrict__ predicate,
+                                                API_INT        n,
+                                                Ta             alpha,
+                                                rocblas_stride stride_alpha,
+                                                Tx             x,
+                                                int64_t        shift_x,
+                                                API_INT        incx,
+                                                rocblas_stride stride_x,
+                                                Ty             y,
+                                                int64_t        shift_y,
+                                                API_INT        incy,
+                                                rocblas_stride stride_y,
+                                                API_INT        batch_count)
+{
+    static constexpr rocblas_stride stride_0 = 0;
+
+    dim3 blocks((n - 1) / (NB * WIN) + 1, batch_count);
+    dim3 threads(NB);
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        // clang-format off
+        ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_win<API_INT, NB, WIN, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), predicate, n, alpha,
+                           stride_alpha, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y);
+        // clang-format on
     }
+    else
+    {
+        // Note: We do not support batched alpha on host.
+        // clang-format off
+        ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_win<API_INT, NB, WIN, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), predicate, n, *alpha,
+                           stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y);
+        // clang-format on
+    }
+    return rocblas_status_success;
+}
 
+//!
+//! @brief Kernel dispatch body of axpy; FTZ selects the flush-to-zero kernel
+//! variants (rocblas_set_flush_denorms).
+//!
+template <typename API_INT, int NB, bool FTZ, typename Tex, typename Ta, typename Tx, typename Ty>
+rocblas_status rocblas_internal_axpy_launcher_kernels(rocblas_handle handle,
+                                                      API_INT        n,
+                                                      Ta             alpha,
+                                                      rocblas_stride stride_alpha,
+                                                      Tx             x,
+                                                      rocblas_stride offset_x,
+                                                      API_INT        incx,
+                                                      rocblas_stride stride_x,
+                                                      Ty             y,
+                                                      rocblas_stride offset_y,
+                                                      API_INT        incy,
+                                                      rocblas_stride stride_y,
+                                                      API_INT        batch_count)
+{
     // Using rocblas_half ?
     static constexpr bool using_rocblas_half
         //cppcheck-suppress duplicateExpression
@@ -298,12 +548,22 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     static constexpr bool using_rocblas_float
         = std::is_same_v<Ty, rocblas_float*> || std::is_same_v<Ty, rocblas_float* const*>;
 
+    // Using rocblas_bfloat16 with float computation (the only supported
+    // bfloat16 configurations) ?
+    static constexpr bool using_rocblas_bfloat16
+        = (std::is_same_v<Ty, rocblas_bfloat16*> || std::is_same_v<Ty, rocblas_bfloat16* const*>)
+          && std::is_same_v<Tex, float>;
+
     static constexpr rocblas_stride stride_0 = 0;
 
     //  unit_inc is True only if incx == 1  && incy == 1.
     bool unit_inc = (incx == 1 && incy == 1);
 
-    if(using_rocblas_half && unit_inc)
+    // A bound device predicate routes to the general kernel, which checks it;
+    // the specialized kernels below do not carry the predicate
+    const rocblas_int* predicate = handle->device_predicate;
+
+    if(using_rocblas_half && unit_inc && !predicate)
     {
         //
         // Optimized version of rocblas_half, where incx == 1 and incy == 1.
@@ -313,47 +573,56 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         // Note: Do not use pointer arithmetic with x and y when passing parameters.
         // The kernel will do the cast if needed.
         //
-        rocblas_int n_mod_8 = n & 7; // n mod 8
-        rocblas_int n_mlt_8 = n & ~(rocblas_int)7; // multiple of 8
-        int         blocks  = (n / 8 - 1) / NB + 1;
-        dim3        grid(blocks, batch_count);
-        dim3        threads(NB);
+        // The grid covers every group of 8 including a partial last group,
+        // which the kernel handles with predicated accesses.
+        int  blocks = ((n - 1) / 8) / NB + 1;
+        dim3 grid(blocks, batch_count);
+        dim3 threads(NB);
         if(handle->pointer_mode == rocblas_pointer_mode_device)
         {
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_haxpy_mlt_8_kernel<NB>), grid, threads, 0, handle->get_stream(), n_mlt_8,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_haxpy_mlt_8_kernel<NB, FTZ>), grid, threads, 0, handle->get_stream(), n,
                                (const rocblas_half*)alpha, stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
             // clang-format on
-            if(n_mod_8)
-            {
-                //
-                // cleanup non-multiple of 8
-                //
-                // clang-format off
-                ROCBLAS_LAUNCH_KERNEL((rocblas_haxpy_mod_8_kernel<NB>), dim3(1, batch_count), n_mod_8, 0, handle->get_stream(), n_mod_8,
-                                    alpha, stride_alpha, x, n_mlt_8 + offset_x, stride_x, y, n_mlt_8 + offset_y, stride_y);
-                // clang-format on
-            }
         }
         else
         {
             // Note: We do not support batched alpha on host.
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_haxpy_mlt_8_kernel<NB>), grid, threads, 0, handle->get_stream(),
-                                n_mlt_8,load_scalar((const rocblas_half*)alpha), stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
+            ROCBLAS_LAUNCH_KERNEL((rocblas_haxpy_mlt_8_kernel<NB, FTZ>), grid, threads, 0, handle->get_stream(),
+                                n, load_scalar((const rocblas_half*)alpha), stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
             // clang-format on
+        }
+    }
 
-            if(n_mod_8)
-            {
-                // clang-format off
-                ROCBLAS_LAUNCH_KERNEL((rocblas_haxpy_mod_8_kernel<NB>), dim3(1, batch_count), n_mod_8, 0, handle->get_stream(), n_mod_8,
-                                   *alpha, stride_0, x, n_mlt_8 + offset_x, stride_x, y, n_mlt_8 + offset_y, stride_y);
-                // clang-format on
-            }
+    else if(using_rocblas_bfloat16 && unit_inc && !predicate)
+    {
+        //
+        // Optimized version of rocblas_bfloat16, where incx == 1 and incy == 1.
+        // Mirrors the rocblas_half path above: groups of 8 elements per thread
+        // with the partial last group handled by predicated accesses.
+        //
+        int  blocks = ((n - 1) / 8) / NB + 1;
+        dim3 grid(blocks, batch_count);
+        dim3 threads(NB);
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            // clang-format off
+            ROCBLAS_LAUNCH_KERNEL((rocblas_baxpy_mlt_8_kernel<NB, FTZ>), grid, threads, 0, handle->get_stream(), n,
+                               alpha, stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
+            // clang-format on
+        }
+        else
+        {
+            // Note: We do not support batched alpha on host.
+            // clang-format off
+            ROCBLAS_LAUNCH_KERNEL((rocblas_baxpy_mlt_8_kernel<NB, FTZ>), grid, threads, 0, handle->get_stream(),
+                                n, *alpha, stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
+            // clang-format on
         }
     }
 
-    else if(using_rocblas_float && unit_inc && batch_count <= 8192)
+    else if(using_rocblas_float && unit_inc && batch_count <= 8192 && !predicate)
     {
         // Optimized kernel for float Datatype when incx==1 && incy==1 && batch_count <= 8192
         dim3 blocks(1 + ((n - 1) / (NB * 2)), batch_count);
@@ -362,7 +631,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_saxpy_2_kernel<NB, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), n, alpha,
                                stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
             // clang-format on
         }
@@ -371,13 +640,13 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         {
             // Note: We do not support batched alpha on host.
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_saxpy_2_kernel<NB, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), n, *alpha,
                                stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
             // clang-format on
         }
     }
 
-    else if(batch_count > 8192 && using_rocblas_float)
+    else if(batch_count > 8192 && using_rocblas_float && !predicate)
     {
         // Optimized kernel for float Datatype when batch_count > 8192
         int64_t shift_x = offset_x + ((incx < 0) ? int64_t(incx) * (1 - n) : 0);
@@ -392,7 +661,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         if(handle->pointer_mode == rocblas_pointer_mode_device)
         {
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_batched<API_INT, DIM_X, DIM_Y, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_batched<API_INT, DIM_X, DIM_Y, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), n, alpha,
                                stride_alpha, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, batch_count);
             // clang-format on
         }
@@ -400,7 +669,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         {
             // Note: We do not support batched alpha on host.
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_batched<API_INT, DIM_X, DIM_Y, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_batched<API_INT, DIM_X, DIM_Y, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), n, *alpha,
                                stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, batch_count);
             // clang-format on
         }
@@ -412,12 +681,29 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         int64_t shift_x = offset_x + ((incx < 0) ? int64_t(incx) * (1 - n) : 0);
         int64_t shift_y = offset_y + ((incy < 0) ? int64_t(incy) * (1 - n) : 0);
 
+        // per-arch unroll depth for the general kernel; depth 1 keeps the
+        // historical one-element-per-thread kernel
+        using Tyv = std::remove_pointer_t<std::remove_pointer_t<Ty>>;
+        switch(rocblas_blas1_unroll_win(handle, sizeof(Tyv)))
+        {
+        case 4:
+            return rocblas_internal_axpy_launch_win<API_INT, NB, 4, FTZ, Tex>(
+                handle, predicate, n, alpha, stride_alpha, x, shift_x, incx, stride_x,
+                y, shift_y, incy, stride_y, batch_count);
+        case 2:
+            return rocblas_internal_axpy_launch_win<API_INT, NB, 2, FTZ, Tex>(
+                handle, predicate, n, alpha, stride_alpha, x, shift_x, incx, stride_x,
+                y, shift_y, incy, stride_y, batch_count);
+        default:
+            break;
+        }
+
         dim3 blocks((n - 1) / (NB) + 1, batch_count);
         dim3 threads(NB);
         if(handle->pointer_mode == rocblas_pointer_mode_device)
         {
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<API_INT, NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<API_INT, NB, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), predicate, n, alpha,
                                stride_alpha, x, shift_x, incx, stride_x, y,shift_y, incy, stride_y);
             // clang-format on
         }
@@ -425,10 +711,66 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         {
             // Note: We do not support batched alpha on host.
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<API_INT, NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<API_INT, NB, Tex, FTZ>), blocks, threads, 0, handle->get_stream(), predicate, n, *alpha,
                                stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y);
             // clang-format on
         }
     }
     return rocblas_status_success;
 }
+
+//!
+//! @brief General template to compute y = a * x + y.
+//!
+template <typename API_INT, int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_axpy_launcher(rocblas_handle handle,
+                                   API_INT        n,
+                                   Ta             alpha,
+                                   rocblas_stride stride_alpha,
+                                   Tx             x,
+                                   rocblas_stride offset_x,
+                                   API_INT        incx,
+                                   rocblas_stride stride_x,
+                                   Ty             y,
+                                   rocblas_stride offset_y,
+                                   API_INT        incy,
+                                   rocblas_stride stride_y,
+                                   API_INT        batch_count)
+{
+    if(n <= 0 || batch_count <= 0) // Quick return if possible. Not Argument error
+    {
+        return rocblas_status_success;
+    }
+
+    // pick the compile-time flush-to-zero kernel variant once per call
+    // (rocblas_set_flush_denorms)
+    if(handle->flush_denorms)
+        return rocblas_internal_axpy_launcher_kernels<API_INT, NB, true, Tex>(handle,
+                                                                              n,
+                                                                              alpha,
+                                                                              stride_alpha,
+                                                                              x,
+                                                                              offset_x,
+                                                                              incx,
+                                                                              stride_x,
+                                                                              y,
+                                                                              offset_y,
+                                                                              incy,
+                                                                              stride_y,
+                                                                              batch_count);
+    else
+        return rocblas_internal_axpy_launcher_kernels<API_INT, NB, false, Tex>(handle,
+                                                                               n,
+                                                                               alpha,
+                                                                               stride_alpha,
+                                                                               x,
+                                                                               offset_x,
+                                                                               incx,
+                                                                               stride_x,
+                                                                               y,
+                                                                               offset_y,
+                                                                               incy,
+                                                                               stride_y,
+                                                                               batch_count);
+}
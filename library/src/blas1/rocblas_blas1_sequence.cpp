@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Replay side of the deferred blas1 sequence API: rocblas_end_sequence
+// uploads the recorded descriptors and runs them all from one kernel, one
+// y-block-row per operation, collapsing a burst of independent small
+// scal/axpy/copy launches into a single one.
+
+#include "rocblas_blas1_sequence.hpp"
+
+#include "logging.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename T>
+    __forceinline__ __device__ void rocblas_blas1_seq_apply(const rocblas_blas1_seq_op& op,
+                                                            int64_t                     tid)
+    {
+        const T* x = (const T*)op.x;
+        T*       y = (T*)op.y;
+
+        switch(op.kind)
+        {
+        case rocblas_blas1_seq_op::scal:
+            y[tid * op.incx] *= T(op.alpha);
+            break;
+        case rocblas_blas1_seq_op::axpy:
+            y[tid * op.incy] += T(op.alpha) * x[tid * op.incx];
+            break;
+        case rocblas_blas1_seq_op::copy:
+            y[tid * op.incy] = x[tid * op.incx];
+            break;
+        }
+    }
+
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_blas1_sequence_kernel(const rocblas_blas1_seq_op* ops)
+    {
+        const rocblas_blas1_seq_op op = ops[blockIdx.y];
+
+        int64_t inc = int64_t(gridDim.x) * NB;
+        for(int64_t tid = int64_t(blockIdx.x) * NB + threadIdx.x; tid < op.n; tid += inc)
+        {
+            if(op.is_double)
+                rocblas_blas1_seq_apply<double>(op, tid);
+            else
+                rocblas_blas1_seq_apply<float>(op, tid);
+        }
+    }
+}
+// namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_begin_sequence(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_begin_sequence");
+
+    if(handle->blas1_sequence_recording)
+        return rocblas_status_internal_error;
+
+    handle->blas1_sequence.clear();
+    handle->blas1_sequence_recording = true;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_end_sequence(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_end_sequence", handle->blas1_sequence.size());
+
+    if(!handle->blas1_sequence_recording)
+        return rocblas_status_internal_error;
+
+    handle->blas1_sequence_recording = false;
+
+    const auto& ops = handle->blas1_sequence;
+    if(ops.empty())
+        return rocblas_status_success;
+
+    size_t bytes = ops.size() * sizeof(rocblas_blas1_seq_op);
+    auto   w_mem = handle->device_malloc(bytes);
+    if(!w_mem)
+        return rocblas_status_memory_error;
+
+    auto* dev_ops = (rocblas_blas1_seq_op*)w_mem;
+
+    // ops stays alive in the handle until the next rocblas_begin_sequence,
+    // so the upload may complete asynchronously
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        (void*)dev_ops, ops.data(), bytes, hipMemcpyHostToDevice, handle->get_stream()));
+
+    static constexpr int NB = 256;
+
+    rocblas_int max_n = 0;
+    for(const auto& op : ops)
+        max_n = std::max(max_n, op.n);
+
+    // enough x-blocks for the largest member; the smaller ones simply run
+    // fewer loop iterations. Capped so a single large member cannot blow up
+    // the grid for everyone
+    int gx = int(std::min(int64_t(4096), (int64_t(max_n) - 1) / NB + 1));
+
+    // grid.y is limited to 65535 blocks, so replay very long sequences in slabs
+    for(size_t base = 0; base < ops.size(); base += 65535)
+    {
+        size_t count = std::min(ops.size() - base, size_t(65535));
+        ROCBLAS_LAUNCH_KERNEL((rocblas_blas1_sequence_kernel<NB>),
+                              dim3(gx, count),
+                              NB,
+                              0,
+                              handle->get_stream(),
+                              dev_ops + base);
+    }
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+#include <limits>
+
+// Recording side of the deferred blas1 sequence API (rocblas_begin_sequence /
+// rocblas_end_sequence). The blas1 dispatch files call these after their own
+// argument checks and quick returns, so only operations that would really
+// launch are recorded.
+
+inline bool rocblas_blas1_sequence_eligible(rocblas_handle handle,
+                                            int64_t        n,
+                                            int64_t        incx,
+                                            int64_t        incy)
+{
+    constexpr int64_t i32_max = std::numeric_limits<rocblas_int>::max();
+    constexpr int64_t i32_min = std::numeric_limits<rocblas_int>::min();
+
+    return handle->blas1_sequence_recording
+           && handle->pointer_mode == rocblas_pointer_mode_host && n <= i32_max && incx <= i32_max
+           && incx >= i32_min && incy <= i32_max && incy >= i32_min;
+}
+
+template <typename T>
+inline rocblas_status rocblas_blas1_sequence_record(rocblas_handle handle,
+                                                    rocblas_blas1_seq_op::rocblas_blas1_seq_kind kind,
+                                                    rocblas_int n,
+                                                    double      alpha,
+                                                    const T*    x,
+                                                    rocblas_int incx,
+                                                    T*          y,
+                                                    rocblas_int incy)
+{
+    // fold negative increments into the pointers, as the launchers do, so
+    // the replay kernel can use plain tid * inc indexing
+    if(incx < 0)
+        x -= int64_t(incx) * (n - 1);
+    if(incy < 0)
+        y -= int64_t(incy) * (n - 1);
+
+    rocblas_blas1_seq_op op{};
+    op.kind      = kind;
+    op.is_double = std::is_same_v<T, double>;
+    op.n         = n;
+    op.incx      = incx;
+    op.incy      = incy;
+    op.alpha     = alpha;
+    op.x         = x;
+    op.y         = y;
+
+    handle->blas1_sequence.push_back(op);
+    return rocblas_status_success;
+}
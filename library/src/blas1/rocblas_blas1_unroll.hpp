@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+// Per-thread unroll depth for the general blas1 element-wise kernels (the
+// scal and axpy fallback paths). The historical kernels process one element
+// per thread; the _win kernel variants take a compile-time WIN and cover
+// NB * WIN elements per block with an NB-strided inner loop, the same layout
+// the dot kernels use. The best depth varies with the element size and the
+// memory pipeline of the architecture — narrow types on gfx94x measure up to
+// ~20% apart between unroll choices — so the launchers pick from this small
+// per-arch table at dispatch and switch over the instantiated variants.
+// Depth 1 reproduces the original kernels exactly and is the default for
+// architectures without table entries.
+inline int rocblas_blas1_unroll_win(rocblas_handle handle, size_t elem_size)
+{
+    int major = handle->getArchMajor();
+
+    // gfx94x: the wider HBM3 pipeline wants more outstanding loads per
+    // thread for sub-8-byte elements; 8/16-byte elements saturate at one
+    if(major == 9 && handle->getArchMajorMinor() >= 94)
+        return elem_size <= 2 ? 4 : elem_size <= 4 ? 2 : 1;
+
+    // remaining gfx9 (MI100/MI200): narrow types still gain from pairing
+    if(major == 9)
+        return elem_size <= 2 ? 2 : 1;
+
+    return 1;
+}
@@ -25,6 +25,7 @@
 #include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
+#include "rocblas_blas1_sequence.hpp"
 #include "rocblas_block_sizes.h"
 #include "rocblas_copy.hpp"
 #include "utility.hpp"
@@ -54,7 +55,7 @@ namespace
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_copy_name<T>, n, x, incx, y, incy);
 
@@ -77,6 +78,22 @@ namespace
         if(!x || !y)
             return rocblas_status_invalid_pointer;
 
+        // Deferred sequence recording: between rocblas_begin_sequence and
+        // rocblas_end_sequence, eligible calls queue a descriptor instead of
+        // launching
+        if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            if(!check_numerics && rocblas_blas1_sequence_eligible(handle, n, incx, incy))
+                return rocblas_blas1_sequence_record(handle,
+                                                     rocblas_blas1_seq_op::copy,
+                                                     rocblas_int(n),
+                                                     0.0,
+                                                     x,
+                                                     rocblas_int(incx),
+                                                     y,
+                                                     rocblas_int(incy));
+        }
+
         if(check_numerics)
         {
             bool           is_input = true;
@@ -48,30 +48,69 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_copy_kernel(rocblas_int    n,
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Grid-stride kernel covering a full 64-bit length in a single launch,
+//! used by the ILP64 launcher instead of chunking into 32-bit-sized pieces.
 //!
-template <rocblas_int NB, typename T, typename U>
+template <typename T, typename U>
+ROCBLAS_KERNEL_NO_BOUNDS rocblas_copy_kernel_64(int64_t        n,
+                                                const T        xa,
+                                                rocblas_stride shiftx,
+                                                int64_t        incx,
+                                                rocblas_stride stridex,
+                                                U              ya,
+                                                rocblas_stride shifty,
+                                                int64_t        incy,
+                                                rocblas_stride stridey)
+{
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    int64_t inc = int64_t(gridDim.x) * blockDim.x;
+    for(int64_t tid = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; tid < n; tid += inc)
+    {
+        y[tid * incy] = x[tid * incx];
+    }
+}
+
+//! @brief Optimized kernel for unit increments, moving 16-byte chunks. Each
+//! thread owns a chunk of consecutive elements; the tail chunk and batches
+//! whose pointers are not 16-byte aligned go through predicated per-element
+//! accesses over the same range, so no wavefront pays a data-dependent loop.
+//!
+template <rocblas_int NB, bool STREAM, typename T, typename U>
 ROCBLAS_KERNEL(NB)
-rocblas_scopy_2_kernel(rocblas_int n,
-                       const T __restrict xa,
-                       rocblas_stride shiftx,
-                       rocblas_stride stridex,
-                       U __restrict ya,
-                       rocblas_stride shifty,
-                       rocblas_stride stridey)
+rocblas_copy_16B_kernel(rocblas_int n,
+                        const T __restrict xa,
+                        rocblas_stride shiftx,
+                        rocblas_stride stridex,
+                        U __restrict ya,
+                        rocblas_stride shifty,
+                        rocblas_stride stridey)
 {
-    int64_t     tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-    const auto* x   = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
-    auto*       y   = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
-    if(tid < n - 1)
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    using Tval                         = std::remove_cv_t<std::remove_pointer_t<decltype(y)>>;
+    static constexpr rocblas_int CHUNK = rocblas_int(16 / sizeof(Tval));
+
+    int64_t tid  = blockIdx.x * blockDim.x + threadIdx.x;
+    int64_t base = tid * CHUNK;
+    if(base >= n)
+        return;
+
+    if(base + CHUNK <= n && rocblas_is_16B_aligned(x) && rocblas_is_16B_aligned(y))
     {
-        for(int j = 0; j < 2; ++j)
-        {
-            y[tid + j] = x[tid + j];
-        }
+        rocblas_store<STREAM>(*((const rocblas_chunk16<Tval>*)x + tid),
+                              (rocblas_chunk16<Tval>*)y + tid);
+    }
+    else
+    {
+        int count = n - base < CHUNK ? int(n - base) : int(CHUNK);
+
+        Tval vals[CHUNK];
+        rocblas_masked_load(x + base, count, vals);
+        rocblas_masked_store(vals, count, y + base);
     }
-    if(n % 2 != 0 && tid == n - 1)
-        y[tid] = x[tid];
 }
 
 template <typename API_INT, rocblas_int NB, typename T, typename U>
@@ -94,10 +133,54 @@ rocblas_status rocblas_internal_copy_launcher(rocblas_handle handle,
     if(!x || !y)
         return rocblas_status_invalid_pointer;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same_v<U, rocblas_float*> || std::is_same_v<U, rocblas_float* const*>;
+    // Contiguous copies are routed through hipMemcpyAsync so they run on the
+    // SDMA engines and overlap with concurrent compute kernels instead of
+    // occupying CUs. Batched pointer-array copies stay on the kernel path, as
+    // the per-batch pointers only exist on the device.
+    static constexpr bool plain_ptrs
+        = !std::is_pointer_v<std::remove_cv_t<std::remove_pointer_t<T>>>
+          && !std::is_pointer_v<std::remove_cv_t<std::remove_pointer_t<U>>>
+          && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>,
+                            std::remove_cv_t<std::remove_pointer_t<U>>>;
+
+    if constexpr(plain_ptrs)
+    {
+        using Tval = std::remove_cv_t<std::remove_pointer_t<T>>;
+        if(incx == 1 && incy == 1)
+        {
+            if(batch_count == 1 || (stridex == n && stridey == n))
+            {
+                return rocblas_internal_convert_hip_to_rocblas_status(
+                    hipMemcpyAsync(y + offsety,
+                                   x + offsetx,
+                                   sizeof(Tval) * size_t(n) * batch_count,
+                                   hipMemcpyDeviceToDevice,
+                                   handle->get_stream()));
+            }
+            else if(stridex >= n && stridey >= n)
+            {
+                // strided batch as a pitched 2D copy: one row per batch instance
+                return rocblas_internal_convert_hip_to_rocblas_status(
+                    hipMemcpy2DAsync(y + offsety,
+                                     sizeof(Tval) * size_t(stridey),
+                                     x + offsetx,
+                                     sizeof(Tval) * size_t(stridex),
+                                     sizeof(Tval) * size_t(n),
+                                     batch_count,
+                                     hipMemcpyDeviceToDevice,
+                                     handle->get_stream()));
+            }
+        }
+    }
+
+    using Txval = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<T>>>>;
+    using Tyval = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<U>>>>;
 
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    // The 16-byte chunked path needs matching element types narrower than a
+    // chunk, and unit increments
+    static constexpr bool chunked_ok = std::is_same_v<Txval, Tyval> && sizeof(Tyval) < 16;
+
+    if(!chunked_ok || incx != 1 || incy != 1)
     {
         // In case of negative inc shift pointer to end of data for negative indexing tid*inc
         int64_t shiftx = offsetx - ((incx < 0) ? int64_t(incx) * (n - 1) : 0);
@@ -122,30 +205,29 @@ rocblas_status rocblas_internal_copy_launcher(rocblas_handle handle,
                               incy,
                               stridey);
     }
-    else if constexpr(using_rocblas_float)
+    else if constexpr(chunked_ok)
     {
-        // Kernel function for improving the performance of SCOPY when incx==1 and incy==1
+        // 16-byte chunked kernel when incx==1 and incy==1; for elements
+        // narrower than 16 bytes this widens the memory transactions
+        static constexpr rocblas_int CHUNK = rocblas_int(16 / sizeof(Tyval));
 
-        // In case of negative inc shift pointer to end of data for negative indexing tid*inc
         int64_t shiftx = offsetx - 0;
         int64_t shifty = offsety - 0;
 
-        int  blocks = 1 + ((n - 1) / (NB * 2));
+        int  blocks = 1 + ((n - 1) / (NB * CHUNK));
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
 
-        ROCBLAS_LAUNCH_KERNEL(rocblas_scopy_2_kernel<NB>,
-                              grid,
-                              threads,
-                              0,
-                              handle->get_stream(),
-                              n,
-                              x,
-                              shiftx,
-                              stridex,
-                              y,
-                              shifty,
-                              stridey);
+#define copy_16B_KARGS \
+    grid, threads, 0, handle->get_stream(), n, x, shiftx, stridex, y, shifty, stridey
+
+        // write-once destination: stream the stores past L2 once it could not
+        // retain the output anyway
+        if(sizeof(Tyval) * size_t(n) >= c_rocblas_stream_store_min_bytes)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_copy_16B_kernel<NB, true>), copy_16B_KARGS);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_copy_16B_kernel<NB, false>), copy_16B_KARGS);
+#undef copy_16B_KARGS
     }
     return rocblas_status_success;
 }
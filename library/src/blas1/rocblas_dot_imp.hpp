@@ -21,12 +21,14 @@
  * ************************************************************************ */
 #pragma once
 
+#include "cpu_overhead.hpp"
 #include "handle.hpp"
 #include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
 #include "rocblas_dot.hpp"
+#include "rocblas_hybrid_host.hpp"
 #include "utility.hpp"
 
 namespace
@@ -69,6 +71,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_internal_cpu_overhead_timer overhead_timer(handle,
+                                                           rocblas_internal_cpu_family_blas1);
+
         size_t dev_bytes
             = rocblas_reduction_kernel_workspace_size<API_INT, ROCBLAS_DOT_NB * WIN, T2>(n);
         if(handle->is_device_memory_size_query())
@@ -80,7 +85,7 @@ namespace
         }
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_dot_name<CONJ, T>, n, x, incx, y, incy);
 
@@ -114,7 +119,15 @@ namespace
         if(!x || !y || !result)
             return rocblas_status_invalid_pointer;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        // Opt-in hybrid dispatch: tiny unit-stride calls compute on the host,
+        // skipping the launch and result-readback latency floor entirely
+        if constexpr(std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            if(!check_numerics && rocblas_hybrid_host_eligible(handle, n, incx, incy))
+                return rocblas_hybrid_host_dot(handle, n, x, y, result);
+        }
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
             return rocblas_status_memory_error;
 
@@ -76,7 +76,7 @@ rocblas_dot_kernel_inc1(rocblas_int n,
     int inc = !ONE_BLOCK ? blockDim.x * gridDim.x : blockDim.x;
     for(int j = 0; j < WIN && i < n; j++, i += inc)
     {
-        sum += V(y[i]) * V(CONJ ? conj(x[i]) : x[i]);
+        sum = rocblas_cmadd(V(y[i]), V(CONJ ? conj(x[i]) : x[i]), sum);
     }
 
     sum = rocblas_dot_block_reduce<NB>(sum);
@@ -117,20 +117,20 @@ rocblas_dot_kernel_inc1by2(rocblas_int n,
 #pragma unroll
             for(int k = 0; k < 2; ++k)
             {
-                sum += V(y[i + k]) * V(CONJ ? conj(x[i + k]) : x[i + k]);
+                sum = rocblas_cmadd(V(y[i + k]), V(CONJ ? conj(x[i + k]) : x[i + k]), sum);
             }
         }
         // If `n` is odd then the computation of last element is covered below.
         if(n % 2 && i == n - 1)
         {
-            sum += V(y[i]) * V(CONJ ? conj(x[i]) : x[i]);
+            sum = rocblas_cmadd(V(y[i]), V(CONJ ? conj(x[i]) : x[i]), sum);
         }
     }
     else
     {
         for(int j = 0; j < WIN && i < n; j++, i += inc)
         {
-            sum += V(y[i]) * V(CONJ ? conj(x[i]) : x[i]);
+            sum = rocblas_cmadd(V(y[i]), V(CONJ ? conj(x[i]) : x[i]), sum);
         }
     }
 
@@ -148,7 +148,8 @@ template <typename API_INT,
           typename U,
           typename V = T>
 ROCBLAS_KERNEL(NB)
-rocblas_dot_kernel(rocblas_int n,
+rocblas_dot_kernel(const rocblas_int* __restrict__ predicate,
+                   rocblas_int n,
                    const U __restrict__ xa,
                    rocblas_stride shiftx,
                    API_INT        incx,
@@ -160,6 +161,10 @@ rocblas_dot_kernel(rocblas_int n,
                    V* __restrict__ workspace,
                    T* __restrict__ out)
 {
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
     const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
     const auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
@@ -171,8 +176,9 @@ rocblas_dot_kernel(rocblas_int n,
     int inc = blockDim.x * gridDim.x;
     for(int j = 0; j < WIN && i < n; j++, i += inc)
     {
-        sum += V(y[i * int64_t(incy)])
-               * V(CONJ ? conj(x[i * int64_t(incx)]) : x[i * int64_t(incx)]);
+        sum = rocblas_cmadd(V(y[i * int64_t(incy)]),
+                            V(CONJ ? conj(x[i * int64_t(incx)]) : x[i * int64_t(incx)]),
+                            sum);
     }
     sum = rocblas_dot_block_reduce<NB>(sum);
 
@@ -188,7 +194,8 @@ template <typename API_INT,
           typename U,
           typename V = T>
 ROCBLAS_KERNEL(NB)
-rocblas_dot_kernel_magsq(rocblas_int n,
+rocblas_dot_kernel_magsq(const rocblas_int* __restrict__ predicate,
+                         rocblas_int n,
                          const U __restrict__ xa,
                          rocblas_stride shiftx,
                          API_INT        incx,
@@ -196,6 +203,10 @@ rocblas_dot_kernel_magsq(rocblas_int n,
                          V* __restrict__ workspace,
                          T* __restrict__ out)
 {
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
     const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
 
     int i = !ONE_BLOCK ? blockIdx.x * blockDim.x + threadIdx.x : threadIdx.x;
@@ -207,17 +218,61 @@ rocblas_dot_kernel_magsq(rocblas_int n,
     for(int j = 0; j < WIN && i < n; j++, i += inc)
     {
         int64_t idx = i * int64_t(incx);
-        sum += V(x[idx]) * V(CONJ ? conj(x[idx]) : x[idx]);
+        sum = rocblas_cmadd(V(x[idx]), V(CONJ ? conj(x[idx]) : x[idx]), sum);
     }
     sum = rocblas_dot_block_reduce<NB>(sum);
 
     rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
 }
 
+// Single-kernel variant: block partial sums are accumulated directly into
+// out with device-scope atomics (see rocblas_reduction_atomics_enabled).
+// The caller must zero out beforehand.
+template <typename API_INT, int NB, int WIN, bool CONJ, typename T, typename U, typename V = T>
+ROCBLAS_KERNEL(NB)
+rocblas_dot_kernel_atomic(rocblas_int n,
+                          const U __restrict__ xa,
+                          rocblas_stride shiftx,
+                          API_INT        incx,
+                          rocblas_stride stridex,
+                          const U __restrict__ ya,
+                          rocblas_stride shifty,
+                          API_INT        incy,
+                          rocblas_stride stridey,
+                          T* __restrict__ out)
+{
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    const auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    V sum = 0;
+
+    // sum WIN elements per thread
+    int inc = blockDim.x * gridDim.x;
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    {
+        sum = rocblas_cmadd(V(y[i * int64_t(incy)]),
+                            V(CONJ ? conj(x[i * int64_t(incx)]) : x[i * int64_t(incx)]),
+                            sum);
+    }
+    sum = rocblas_dot_block_reduce<NB>(sum);
+
+    if(threadIdx.x == 0)
+        rocblas_atomic_add(&out[blockIdx.y], T(sum));
+}
+
 template <int NB, int WIN, typename V, typename T = V>
 ROCBLAS_KERNEL(NB)
-rocblas_dot_kernel_reduce(int n_sums, V* __restrict__ in, T* __restrict__ out)
+rocblas_dot_kernel_reduce(const rocblas_int* __restrict__ predicate,
+                          int n_sums,
+                          V* __restrict__ in,
+                          T* __restrict__ out)
 {
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
     V sum = 0;
 
     size_t offset = size_t(blockIdx.y) * n_sums;
@@ -333,9 +388,50 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
     int64_t shiftx = incx < 0 ? offsetx - int64_t(incx) * (n - 1) : offsetx;
     int64_t shifty = incy < 0 ? offsety - int64_t(incy) * (n - 1) : offsety;
 
+    // A bound device predicate routes to the general two-kernel scheme below,
+    // whose kernels check it; the specialized paths do not carry the predicate
+    const rocblas_int* predicate = handle->device_predicate;
+
     static constexpr int single_block_threshold = rocblas_dot_one_block_threshold<T>();
 
-    if(n <= 1024 && batch_count >= 256)
+    // Opt-in single-kernel reduction: partial sums go straight to the result
+    // with device-scope atomics, skipping the finishing kernel. Only taken in
+    // device pointer mode, where no host synchronization is needed either.
+    if constexpr(rocblas_reduction_can_use_atomics<T, V>())
+    {
+        if(rocblas_reduction_atomics_enabled()
+           && handle->atomics_mode == rocblas_atomics_allowed
+           && handle->pointer_mode == rocblas_pointer_mode_device
+           && n < c_atomic_reduction_n_limit && !predicate)
+        {
+            rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+            dim3        grid(blocks, batch_count);
+            dim3        threads(NB);
+
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                results, 0, sizeof(T) * batch_count, handle->get_stream()));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_atomic<API_INT, NB, WIN, CONJ, T, U, V>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  x,
+                                  shiftx,
+                                  incx,
+                                  stridex,
+                                  y,
+                                  shifty,
+                                  incy,
+                                  stridey,
+                                  results);
+
+            return rocblas_status_success;
+        }
+    }
+
+    if(n <= 1024 && batch_count >= 256 && !predicate)
     {
         // Optimized kernel for small n and bigger batch_count
         static constexpr int NB_Y = 4;
@@ -345,8 +441,12 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
         T* output = results; // device mode output directly to results
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            size_t offset = size_t(batch_count);
-            output        = (T*)(workspace + offset);
+            output = rocblas_reduction_mapped_output<T>(handle, batch_count);
+            if(!output)
+            {
+                size_t offset = size_t(batch_count);
+                output        = (T*)(workspace + offset);
+            }
         }
 
         if(is_arch_10_or_11_or_12)
@@ -401,15 +501,11 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
         }
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
-                                               output,
-                                               sizeof(T) * batch_count,
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, output, &results[0], batch_count));
         }
     }
-    else if(n <= single_block_threshold)
+    else if(n <= single_block_threshold && !predicate)
     {
         // we only reduce the block count to 1 so safe to ignore extra workspace allocated in caller
 
@@ -426,8 +522,12 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
         T* output = results; // device mode output directly to results
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            size_t offset = size_t(batch_count) * blocks;
-            output        = (T*)(workspace + offset);
+            output = rocblas_reduction_mapped_output<T>(handle, batch_count);
+            if(!output)
+            {
+                size_t offset = size_t(batch_count) * blocks;
+                output        = (T*)(workspace + offset);
+            }
         }
 
         if(x != y || incx != incy || offsetx != offsety || stridex != stridey)
@@ -458,6 +558,7 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                     threads,
                     0,
                     handle->get_stream(),
+                    predicate,
                     n,
                     x,
                     shiftx,
@@ -479,6 +580,7 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                 threads,
                 0,
                 handle->get_stream(),
+                predicate,
                 n,
                 x,
                 shiftx,
@@ -490,12 +592,8 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
 
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
-                                               output,
-                                               sizeof(T) * batch_count,
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, output, &results[0], batch_count));
         }
     }
     else
@@ -509,13 +607,17 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
         T* output = results;
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            size_t offset = size_t(batch_count) * blocks;
-            output        = (T*)(workspace + offset);
+            output = rocblas_reduction_mapped_output<T>(handle, batch_count);
+            if(!output)
+            {
+                size_t offset = size_t(batch_count) * blocks;
+                output        = (T*)(workspace + offset);
+            }
         }
 
         if(x != y || incx != incy || offsetx != offsety || stridex != stridey)
         {
-            if(incx == 1 && incy == 1)
+            if(incx == 1 && incy == 1 && !predicate)
             {
                 ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_inc1<ONE_BLOCK, NB, WIN, CONJ, T>),
                                       grid,
@@ -539,6 +641,7 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                       threads,
                                       0,
                                       handle->get_stream(),
+                                      predicate,
                                       n,
                                       x,
                                       shiftx,
@@ -559,6 +662,7 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                   threads,
                                   0,
                                   handle->get_stream(),
+                                  predicate,
                                   n,
                                   x,
                                   shiftx,
@@ -574,18 +678,15 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                   threads,
                                   0,
                                   handle->get_stream(),
+                                  predicate,
                                   blocks,
                                   workspace,
                                   output);
 
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
-                                               output,
-                                               sizeof(T) * batch_count,
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, output, &results[0], batch_count));
         }
     }
     return rocblas_status_success;
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+#include <vector>
+
+// Opt-in hybrid dispatch (rocblas_set_hybrid_host_compute): tiny unit-stride
+// host-pointer-mode blas1 calls stage their operands to the host and compute
+// there, trading a few KB of PCIe traffic for the kernel-launch and
+// result-readback latency a device reduction pays. The stream is
+// synchronized before the host reads, so producers queued ahead of the call
+// are observed, and any device write goes back through the same stream, so
+// consumers queued behind it are ordered too.
+
+inline bool rocblas_hybrid_host_eligible(rocblas_handle handle, int64_t n, int64_t incx, int64_t incy)
+{
+    return handle->hybrid_host_threshold > 0 && n <= handle->hybrid_host_threshold && incx == 1
+           && incy == 1 && handle->pointer_mode == rocblas_pointer_mode_host
+           && !handle->is_stream_in_capture_mode();
+}
+
+template <typename T>
+inline rocblas_status
+    rocblas_hybrid_host_dot(rocblas_handle handle, int64_t n, const T* x, const T* y, T* result)
+{
+    hipStream_t stream = handle->get_stream();
+
+    std::vector<T> hx(n), hy(n);
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hx.data(), x, sizeof(T) * n, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hy.data(), y, sizeof(T) * n, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // a plain accumulation loop; at -O3 this vectorizes, and the double
+    // accumulator keeps the host result at least as accurate as the device
+    // tree reduction
+    double sum = 0;
+    for(int64_t i = 0; i < n; i++)
+        sum += double(hx[i]) * double(hy[i]);
+
+    *result = T(sum);
+    return rocblas_status_success;
+}
+
+template <typename T>
+inline rocblas_status
+    rocblas_hybrid_host_axpy(rocblas_handle handle, int64_t n, T alpha, const T* x, T* y)
+{
+    hipStream_t stream = handle->get_stream();
+
+    std::vector<T> hx(n), hy(n);
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hx.data(), x, sizeof(T) * n, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hy.data(), y, sizeof(T) * n, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int64_t i = 0; i < n; i++)
+        hy[i] += alpha * hx[i];
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(y, hy.data(), sizeof(T) * n, hipMemcpyHostToDevice, stream));
+    // hy goes out of scope here, so the upload may not outlive this call
+    return rocblas_internal_convert_hip_to_rocblas_status(hipStreamSynchronize(stream));
+}
@@ -77,8 +77,111 @@ rocblas_status rocblas_internal_iamax_iamin_launcher(rocblas_handle handle,
                                                      To*            workspace,
                                                      Tr*            result)
 {
+    // Stream capture: in device pointer mode every path below records only
+    // stream-legal work (kernels and at most one memset) and the workspace is
+    // served from the handle's permanent reduction scratch, so a captured
+    // iamax/iamin replays against one allocation and the index lands in the
+    // caller's device pointer for the next node in the graph to consume.
+    // Host pointer mode must synchronize to return the index and would also
+    // allocate its mapped/pinned staging lazily, so it cannot be captured.
+    if(handle->pointer_mode != rocblas_pointer_mode_device
+       && handle->is_stream_in_capture_mode())
+        return rocblas_status_not_implemented;
+
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
+    // One workgroup per batch member once the batch alone fills the device:
+    // mid-size vectors are reduced end-to-end by one block with a 4-wide
+    // unrolled loop and the final index written directly, skipping the
+    // workspace round trip and the gather kernel. Very long vectors stay on
+    // the multi-block schemes below for cross-block parallelism.
+    if(batch_count >= 128 && blocks <= 512)
+    {
+        bool host_mode = handle->pointer_mode != rocblas_pointer_mode_device;
+        Tr*  out       = result;
+        if(host_mode)
+        {
+            out = rocblas_reduction_mapped_output<Tr>(handle, batch_count);
+            if(!out)
+                out = (Tr*)workspace;
+        }
+
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_iamax_iamin_kernel_batched<NB, 4, FETCH, REDUCE, TPtrX, To>),
+            dim3(1, batch_count),
+            NB,
+            0,
+            handle->get_stream(),
+            n,
+            x,
+            shiftx,
+            incx,
+            stridex,
+            out);
+
+        if(host_mode)
+        {
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, out, result, batch_count));
+        }
+        return rocblas_status_success;
+    }
+
+    // For types reducing over float magnitudes the (value, index) pair packs
+    // into 64 bits, so the whole reduction runs as one kernel folding block
+    // results into a packed per-batch slot with an atomic; the two-kernel
+    // scheme below only pays off where the pair does not fit in one atomic.
+    // blocks > 1 both leaves workspace room for the host mode result area
+    // and is where dropping the second launch matters.
+    if constexpr(std::is_same_v<To, rocblas_index_value_t<float>>
+                 && std::is_same_v<API_INT, rocblas_int> && std::is_same_v<Tr, rocblas_int>)
+    {
+        // the 8 byte atomic slots also need a workspace aligned beyond the
+        // 4 byte alignment of the index/value pairs
+        if(blocks > 1 && !(uintptr_t(workspace) & 7))
+        {
+            constexpr bool MAX = std::is_same_v<REDUCE, rocblas_reduce_amax>;
+
+            // per batch: one packed slot and one arrival counter, then the
+            // host pointer mode result area
+            auto* work64 = (unsigned long long*)workspace;
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                work64, 0, 2 * sizeof(*work64) * batch_count, handle->get_stream()));
+
+            bool         host_mode = handle->pointer_mode != rocblas_pointer_mode_device;
+            rocblas_int* out       = result;
+            if(host_mode)
+            {
+                // the kernel's atomics stay in work64; the final index is a
+                // plain store, so the mapped output is safe here
+                out = rocblas_reduction_mapped_output<rocblas_int>(handle, batch_count);
+                if(!out)
+                    out = (rocblas_int*)(work64 + 2 * size_t(batch_count));
+            }
+
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_iamax_iamin_kernel_onepass<NB, MAX, FETCH, REDUCE, TPtrX, To>),
+                dim3(blocks, batch_count),
+                NB,
+                0,
+                handle->get_stream(),
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                work64,
+                out);
+
+            if(host_mode)
+            {
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_reduction_fetch_result(handle, out, result, batch_count));
+            }
+            return rocblas_status_success;
+        }
+    }
+
     ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part1<NB, FETCH, REDUCE>),
                           dim3(blocks, batch_count),
                           NB,
@@ -116,6 +219,10 @@ rocblas_status rocblas_internal_iamax_iamin_launcher(rocblas_handle handle,
 
         if(reduceKernel)
         {
+            Tr* out = rocblas_reduction_mapped_output<Tr>(handle, batch_count);
+            if(!out)
+                out = (Tr*)(workspace + offset);
+
             ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part2<NB, REDUCE>),
                                   dim3(1, batch_count),
                                   NB,
@@ -123,15 +230,18 @@ rocblas_status rocblas_internal_iamax_iamin_launcher(rocblas_handle handle,
                                   handle->get_stream(),
                                   blocks,
                                   workspace,
-                                  (Tr*)(workspace + offset));
-        }
+                                  out);
 
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
-                                           workspace + offset,
-                                           batch_count * sizeof(Tr),
-                                           hipMemcpyDeviceToHost,
-                                           handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, out, result, batch_count));
+        }
+        else
+        {
+            // blocks == 1 and batch_count == 1: part1 already left the final
+            // pair at workspace[0]
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_reduction_fetch_result(handle, workspace + offset, result, batch_count));
+        }
     }
     return rocblas_status_success;
 }
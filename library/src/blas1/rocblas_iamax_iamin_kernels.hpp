@@ -101,6 +101,106 @@ rocblas_iamax_iamin_kernel_part1(rocblas_int    n,
         workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
 }
 
+// Packs an (abs value, 1-based index) pair into a 64 bit key whose unsigned
+// order matches the amax/amin selection order, so the device-wide reduction
+// can finish with a single atomicMax instead of a second kernel. The fetched
+// values are non-negative, so the IEEE bit patterns of the float compare in
+// the same order as the values; the value bits are complemented for amin so
+// that both directions reduce with atomicMax over a zero-initialized slot.
+// The index is stored complemented in the low half so that equal values
+// tie-break to the lowest index, as the rocblas_reduce_amax/amin functors do.
+template <bool MAX>
+__forceinline__ __device__ uint64_t rocblas_iamax_iamin_pack(float value, rocblas_int index)
+{
+    uint32_t vbits = __float_as_uint(value);
+    return (uint64_t(MAX ? vbits : ~vbits) << 32) | ~uint32_t(index);
+}
+
+// Single-pass variant for types reducing over float magnitudes: each block
+// folds its partial result into one packed slot per batch with an atomic,
+// and the last block to finish unpacks the winning index into result. The
+// workspace holds the slot and an arrival counter per batch, both
+// zero-initialized by the launcher, followed by the host pointer mode
+// result area.
+template <int NB, bool MAX, typename FETCH, typename REDUCE, typename TPtrX, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_iamax_iamin_kernel_onepass(rocblas_int    n,
+                                   TPtrX          xvec,
+                                   rocblas_stride shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   unsigned long long* workspace,
+                                   rocblas_int*        result)
+{
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    To sum = rocblas_default_value<To>{}();
+    for(int64_t tid = blockIdx.x * blockDim.x + threadIdx.x; tid < n;
+        tid += int64_t(blockDim.x) * gridDim.x)
+    {
+        To cur = FETCH{}(x[tid * incx], rocblas_int(tid) + 1); // 1-based indexing
+        REDUCE{}(sum, cur);
+    }
+
+    sum = rocblas_shuffle_block_reduce_method<NB, REDUCE>(sum);
+
+    if(threadIdx.x == 0)
+    {
+        unsigned long long* slot    = workspace + blockIdx.y;
+        unsigned long long* counter = workspace + gridDim.y + blockIdx.y;
+
+        if(sum.index != 0)
+            atomicMax(slot, rocblas_iamax_iamin_pack<MAX>(sum.value, sum.index));
+
+        __threadfence();
+        if(atomicAdd(counter, 1ull) == gridDim.x - 1)
+            result[blockIdx.y] = rocblas_int(~uint32_t(*(volatile unsigned long long*)slot));
+    }
+}
+
+// Batched variant with one workgroup per batch member: the block walks the
+// whole vector with a WIN-wide unrolled strided loop (WIN independent
+// compare chains per iteration), finishes with the LDS/wavefront index
+// reduction and writes the final index directly, skipping the workspace
+// round trip and the gather kernel. Selected when the batch count alone
+// fills the device.
+template <int NB, int WIN, typename FETCH, typename REDUCE, typename TPtrX, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_iamax_iamin_kernel_batched(rocblas_int    n,
+                                   TPtrX          xvec,
+                                   rocblas_stride shiftx,
+                                   rocblas_int    incx,
+                                   rocblas_stride stridex,
+                                   Tr*            result)
+{
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    To sum = rocblas_default_value<To>{}();
+
+    constexpr rocblas_int quad  = NB * WIN;
+    rocblas_int           nfull = (n / quad) * quad;
+
+    for(rocblas_int i = threadIdx.x; i < nfull; i += quad)
+    {
+        for(rocblas_int j = 0; j < WIN; j++)
+        {
+            rocblas_int idx = i + j * NB;
+            To          cur = FETCH{}(x[idx * int64_t(incx)], idx + 1); // 1-based indexing
+            REDUCE{}(sum, cur);
+        }
+    }
+    for(rocblas_int i = nfull + rocblas_int(threadIdx.x); i < n; i += NB)
+    {
+        To cur = FETCH{}(x[i * int64_t(incx)], i + 1);
+        REDUCE{}(sum, cur);
+    }
+
+    sum = rocblas_shuffle_block_reduce_method<NB, REDUCE>(sum);
+
+    if(threadIdx.x == 0)
+        result[blockIdx.y] = sum.index;
+}
+
 // kernel 2 gathers all the partial results in workspace and finishes the final reduction;
 // number of threads (NB) loop blocks
 template <int NB, typename REDUCE, typename To, typename Tr>
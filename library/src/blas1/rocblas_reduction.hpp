@@ -22,8 +22,11 @@
 
 #pragma once
 
+#include "handle.hpp"
 #include "int64_helpers.hpp"
 #include "utility.hpp"
+#include <cstdlib>
+#include <cstring>
 #include <hip/hip_runtime.h>
 
 static constexpr int rocblas_log2ui(int x)
@@ -37,9 +40,73 @@ static constexpr int rocblas_log2ui(int x)
     return v;
 }
 
+// On gfx9 the DPP cross-lane modifiers can feed the intra-wavefront reduction
+// tree directly from VALU instructions, while __shfl_down lowers to
+// ds_swizzle/ds_bpermute and round-trips through LDS. Full-wavefront sum
+// reductions take the DPP path on these targets; partial wavefront widths and
+// other architectures keep the shuffle tree.
+#if defined(__gfx900__) || defined(__gfx906__) || defined(__gfx908__) || defined(__gfx90a__) \
+    || defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__)
+#define ROCBLAS_WAVEFRONT_REDUCE_DPP 1
+#endif
+
+#ifdef ROCBLAS_WAVEFRONT_REDUCE_DPP
+
+// Lane-wise DPP move applied per 32-bit word so any value type can be routed
+// through v_mov_b32_dpp; the control fields must be immediates, hence the
+// template parameters. bound_ctrl=1 makes out-of-range lanes read 0, the
+// identity for the sum reductions below.
+template <int DPP_CTRL, int ROW_MASK = 0xf, int BANK_MASK = 0xf, bool BOUND_CTRL = true, typename T>
+__inline__ __device__ T rocblas_dpp_mov(T val)
+{
+    constexpr int words = (sizeof(T) + sizeof(int) - 1) / sizeof(int);
+    union
+    {
+        T   v;
+        int i[words];
+    } tmp;
+    tmp.v = val;
+    for(int w = 0; w < words; w++)
+        tmp.i[w]
+            = __builtin_amdgcn_update_dpp(0, tmp.i[w], DPP_CTRL, ROW_MASK, BANK_MASK, BOUND_CTRL);
+    return tmp.v;
+}
+
+// Full-wavefront sum via row_shr then row_bcast: each 16-lane row reduces into
+// its last lane, row_bcast:15/31 combine the row totals so the wavefront sum
+// lands in the last lane, and a final shuffle hands it back to lane 0 (all
+// lanes), matching the shuffle-tree variants
+template <int N, typename T>
+__inline__ __device__ T rocblas_wavefront_reduce_sum_dpp(T val)
+{
+    val += rocblas_dpp_mov<0x111>(val); // row_shr:1
+    val += rocblas_dpp_mov<0x112>(val); // row_shr:2
+    val += rocblas_dpp_mov<0x114>(val); // row_shr:4
+    val += rocblas_dpp_mov<0x118>(val); // row_shr:8
+    val += rocblas_dpp_mov<0x142, 0xa>(val); // row_bcast:15 into odd rows
+    val += rocblas_dpp_mov<0x143, 0xc>(val); // row_bcast:31 into upper half
+
+    constexpr int words = (sizeof(T) + sizeof(int) - 1) / sizeof(int);
+    union
+    {
+        T   v;
+        int i[words];
+    } tmp;
+    tmp.v = val;
+    for(int w = 0; w < words; w++)
+        tmp.i[w] = __shfl(tmp.i[w], N - 1);
+    return tmp.v;
+}
+
+#endif // ROCBLAS_WAVEFRONT_REDUCE_DPP
+
 template <int N, typename T>
 __inline__ __device__ T rocblas_wavefront_reduce(T val)
 {
+#ifdef ROCBLAS_WAVEFRONT_REDUCE_DPP
+    if(N == warpSize)
+        return rocblas_wavefront_reduce_sum_dpp<N>(val);
+#endif
     constexpr int WFBITS = rocblas_log2ui(N);
     int           offset = 1 << (WFBITS - 1);
     for(int i = 0; i < WFBITS; i++)
@@ -53,6 +120,10 @@ __inline__ __device__ T rocblas_wavefront_reduce(T val)
 template <int N>
 __inline__ __device__ rocblas_float_complex rocblas_wavefront_reduce(rocblas_float_complex val)
 {
+#ifdef ROCBLAS_WAVEFRONT_REDUCE_DPP
+    if(N == warpSize)
+        return rocblas_wavefront_reduce_sum_dpp<N>(val);
+#endif
     constexpr int WFBITS = rocblas_log2ui(N);
     int           offset = 1 << (WFBITS - 1);
     for(int i = 0; i < WFBITS; i++)
@@ -67,6 +138,10 @@ __inline__ __device__ rocblas_float_complex rocblas_wavefront_reduce(rocblas_flo
 template <int N>
 __inline__ __device__ rocblas_double_complex rocblas_wavefront_reduce(rocblas_double_complex val)
 {
+#ifdef ROCBLAS_WAVEFRONT_REDUCE_DPP
+    if(N == warpSize)
+        return rocblas_wavefront_reduce_sum_dpp<N>(val);
+#endif
     constexpr int WFBITS = rocblas_log2ui(N);
     int           offset = 1 << (WFBITS - 1);
     for(int i = 0; i < WFBITS; i++)
@@ -81,6 +156,10 @@ __inline__ __device__ rocblas_double_complex rocblas_wavefront_reduce(rocblas_do
 template <int N>
 __inline__ __device__ rocblas_bfloat16 rocblas_wavefront_reduce(rocblas_bfloat16 val)
 {
+#ifdef ROCBLAS_WAVEFRONT_REDUCE_DPP
+    if(N == warpSize)
+        return rocblas_wavefront_reduce_sum_dpp<N>(val);
+#endif
     union
     {
         int              i;
@@ -101,6 +180,10 @@ __inline__ __device__ rocblas_bfloat16 rocblas_wavefront_reduce(rocblas_bfloat16
 template <int N>
 __inline__ __device__ rocblas_half rocblas_wavefront_reduce(rocblas_half val)
 {
+#ifdef ROCBLAS_WAVEFRONT_REDUCE_DPP
+    if(N == warpSize)
+        return rocblas_wavefront_reduce_sum_dpp<N>(val);
+#endif
     union
     {
         int          i;
@@ -145,6 +228,57 @@ __inline__ __device__ T rocblas_dot_block_reduce(T val)
     return val;
 }
 
+// Opt-in single-kernel reduction mode: block partial sums are accumulated
+// directly into the result with device-scope atomics, eliminating the
+// finishing kernel launch. The summation order is non-deterministic, so the
+// path is additionally gated on the handle's rocblas_atomics_mode; setting
+// rocblas_atomics_not_allowed restores the deterministic two-kernel scheme.
+inline bool rocblas_reduction_atomics_enabled()
+{
+    static const char* env     = std::getenv("ROCBLAS_ATOMIC_REDUCTION");
+    static const bool  enabled = env && strtol(env, nullptr, 0) != 0;
+    return enabled;
+}
+
+// Latency-critical small/medium sizes benefit most; large reductions keep the
+// deterministic scheme where the extra launch is amortized
+constexpr int c_atomic_reduction_n_limit = 1 << 20;
+
+// The atomic path is restricted to result types with native atomicAdd support
+// (complex values are accumulated component-wise)
+template <typename To, typename Tr = To>
+constexpr bool rocblas_reduction_can_use_atomics()
+{
+    return std::is_same_v<To, Tr>
+           && (std::is_same_v<To, float> || std::is_same_v<To, double>
+               || std::is_same_v<To, rocblas_float_complex>
+               || std::is_same_v<To, rocblas_double_complex>);
+}
+
+__device__ __forceinline__ void rocblas_atomic_add(float* dst, float val)
+{
+    atomicAdd(dst, val);
+}
+
+__device__ __forceinline__ void rocblas_atomic_add(double* dst, double val)
+{
+    atomicAdd(dst, val);
+}
+
+__device__ __forceinline__ void rocblas_atomic_add(rocblas_float_complex* dst,
+                                                   rocblas_float_complex  val)
+{
+    atomicAdd(&reinterpret_cast<float*>(dst)[0], val.real());
+    atomicAdd(&reinterpret_cast<float*>(dst)[1], val.imag());
+}
+
+__device__ __forceinline__ void rocblas_atomic_add(rocblas_double_complex* dst,
+                                                   rocblas_double_complex  val)
+{
+    atomicAdd(&reinterpret_cast<double*>(dst)[0], val.real());
+    atomicAdd(&reinterpret_cast<double*>(dst)[1], val.imag());
+}
+
 template <typename API_INT>
 inline size_t rocblas_reduction_kernel_block_count(API_INT n, int NB)
 {
@@ -153,6 +287,25 @@ inline size_t rocblas_reduction_kernel_block_count(API_INT n, int NB)
     return size_t(n - 1) / NB + 1;
 }
 
+// Pass-one fanout for grid-striding reduction kernels follows the part's CU
+// count (queried once at handle creation) instead of a fixed n/NB split: a
+// few full workgroups per CU saturate a 24-CU APU and a 304-CU part alike,
+// while the fixed split floods small parts with blocks whose partials the
+// finishing kernel then has to gather serially. The tuned count is never
+// above n/NB, so workspace sized by the formulas below stays an upper bound.
+constexpr int c_reduction_workgroups_per_cu = 4;
+
+template <typename API_INT>
+inline rocblas_int
+    rocblas_reduction_kernel_tuned_block_count(rocblas_handle handle, API_INT n, int NB)
+{
+    size_t blocks = rocblas_reduction_kernel_block_count(n, NB);
+    size_t target = size_t(handle->getCUCount()) * c_reduction_workgroups_per_cu;
+    if(target && blocks > target)
+        blocks = target;
+    return rocblas_int(blocks);
+}
+
 inline size_t rocblas_reduction_kernel_pass_count(int64_t n)
 {
     if(n <= 0)
@@ -161,6 +314,126 @@ inline size_t rocblas_reduction_kernel_pass_count(int64_t n)
     return size_t(passes);
 }
 
+// Zero-copy output for the finishing kernels of host-pointer-mode
+// reductions: when the handle opted in with rocblas_set_mapped_host_results,
+// returns a device-visible address inside mapped pinned host memory for the
+// kernel to write its batch_count final scalars, so the result never takes
+// the device-memory round trip and rocblas_reduction_fetch_result reduces to
+// a fence plus a host-side memcpy. Returns nullptr when the mode is off or
+// the mapped buffer cannot be obtained; the caller then stages through
+// workspace as before. Only for plain stores from the finishing kernel —
+// kernels accumulating the result with device-scope atomics must not write
+// mapped host memory.
+template <typename Tr>
+inline Tr* rocblas_reduction_mapped_output(rocblas_handle handle, int64_t batch_count)
+{
+    if(!handle->mapped_results)
+        return nullptr;
+
+    size_t bytes = sizeof(Tr) * size_t(batch_count);
+    if(handle->mapped_result_size < bytes)
+    {
+        if(handle->mapped_result_buffer)
+        {
+            if(hipHostFree(handle->mapped_result_buffer) != hipSuccess)
+                return nullptr;
+            handle->mapped_result_buffer = nullptr;
+            handle->mapped_result_device = nullptr;
+            handle->mapped_result_size   = 0;
+        }
+        if(hipHostMalloc(&handle->mapped_result_buffer, bytes, hipHostMallocMapped) != hipSuccess)
+        {
+            handle->mapped_result_buffer = nullptr;
+            return nullptr;
+        }
+        if(hipHostGetDevicePointer(&handle->mapped_result_device, handle->mapped_result_buffer, 0)
+           != hipSuccess)
+        {
+            (void)hipHostFree(handle->mapped_result_buffer);
+            handle->mapped_result_buffer = nullptr;
+            handle->mapped_result_device = nullptr;
+            return nullptr;
+        }
+        handle->mapped_result_size = bytes;
+    }
+
+    if(!handle->pinned_result_event
+       && hipEventCreateWithFlags(&handle->pinned_result_event, hipEventDisableTiming)
+              != hipSuccess)
+    {
+        handle->pinned_result_event = nullptr;
+        return nullptr;
+    }
+
+    return (Tr*)handle->mapped_result_device;
+}
+
+// Host-pointer-mode finish for the reduction launchers: copies batch_count
+// results from device memory into the caller's (pageable) buffer. The copy is
+// staged through a pinned per-handle buffer and fenced with an event recorded
+// right behind it, so the wait covers only the copy instead of the whole
+// stream; an async copy straight into pageable memory would degrade to a full
+// device synchronization. Falls back to that direct copy when pinned memory
+// or the event cannot be obtained. When src_device is the handle's mapped
+// output (rocblas_reduction_mapped_output above), the finishing kernel
+// already wrote host-visible memory and only the fence and host copy remain.
+template <typename Tr>
+inline rocblas_status rocblas_reduction_fetch_result(rocblas_handle handle,
+                                                     const void*    src_device,
+                                                     Tr*            result,
+                                                     int64_t        batch_count)
+{
+    size_t bytes = sizeof(Tr) * size_t(batch_count);
+
+    if(src_device && src_device == handle->mapped_result_device)
+    {
+        RETURN_IF_HIP_ERROR(hipEventRecord(handle->pinned_result_event, handle->get_stream()));
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(handle->pinned_result_event));
+        memcpy(result, handle->mapped_result_buffer, bytes);
+        return rocblas_status_success;
+    }
+
+    if(handle->pinned_result_size < bytes)
+    {
+        if(handle->pinned_result_buffer)
+        {
+            RETURN_IF_HIP_ERROR(hipHostFree(handle->pinned_result_buffer));
+            handle->pinned_result_buffer = nullptr;
+            handle->pinned_result_size   = 0;
+        }
+        if(hipHostMalloc(&handle->pinned_result_buffer, bytes) == hipSuccess)
+            handle->pinned_result_size = bytes;
+        else
+            handle->pinned_result_buffer = nullptr;
+    }
+
+    if(!handle->pinned_result_event)
+    {
+        if(hipEventCreateWithFlags(&handle->pinned_result_event, hipEventDisableTiming)
+           != hipSuccess)
+            handle->pinned_result_event = nullptr;
+    }
+
+    if(!handle->pinned_result_buffer || !handle->pinned_result_event)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            result, src_device, bytes, hipMemcpyDeviceToHost, handle->get_stream()));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+        return rocblas_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(handle->pinned_result_buffer,
+                                       src_device,
+                                       bytes,
+                                       hipMemcpyDeviceToHost,
+                                       handle->get_stream()));
+    RETURN_IF_HIP_ERROR(hipEventRecord(handle->pinned_result_event, handle->get_stream()));
+    RETURN_IF_HIP_ERROR(hipEventSynchronize(handle->pinned_result_event));
+    memcpy(result, handle->pinned_result_buffer, bytes);
+
+    return rocblas_status_success;
+}
+
 /*! \brief rocblas_reduction_batched_kernel_workspace_size
     Work area for reduction must be at lease sizeof(To) * (blocks + 1) * batch_count.
     Additional passes add to workspace requirement for ILP64 subdivisions
@@ -207,58 +207,6 @@ INSTANTIATE_ROTG_CHECK_NUMERICS(rocblas_double_complex* const*, double* const*)
 //
 // kernels and launcher
 
-template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
-__forceinline__ __device__ __host__ void rocblas_rotg_calc(T& a, T& b, U& c, T& s)
-{
-    T scale = rocblas_abs(a) + rocblas_abs(b);
-    if(scale == 0.0)
-    {
-        c = 1.0;
-        s = 0.0;
-        a = 0.0;
-        b = 0.0;
-    }
-    else
-    {
-        T sa  = a / scale;
-        T sb  = b / scale;
-        T r   = scale * sqrt(sa * sa + sb * sb);
-        T roe = rocblas_abs(a) > rocblas_abs(b) ? a : b;
-        r     = copysign(r, roe);
-        c     = a / r;
-        s     = b / r;
-        T z   = 1.0;
-        if(rocblas_abs(a) > rocblas_abs(b))
-            z = s;
-        if(rocblas_abs(b) >= rocblas_abs(a) && c != 0.0)
-            z = 1.0 / c;
-        a = r;
-        b = z;
-    }
-}
-
-template <typename T, typename U, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
-__forceinline__ __device__ __host__ void rocblas_rotg_calc(T& a, T& b, U& c, T& s)
-{
-    if(rocblas_abs(a) != 0.)
-    {
-        auto scale = rocblas_abs(a) + rocblas_abs(b);
-        auto sa    = rocblas_abs(a / scale);
-        auto sb    = rocblas_abs(b / scale);
-        auto norm  = scale * sqrt(sa * sa + sb * sb);
-        auto alpha = a / rocblas_abs(a);
-        c          = rocblas_abs(a) / norm;
-        s          = alpha * conj(b) / norm;
-        a          = alpha * norm;
-    }
-    else
-    {
-        c = 0;
-        s = {1, 0};
-        a = b;
-    }
-}
-
 template <rocblas_int NB, typename T, typename U>
 ROCBLAS_KERNEL(NB)
 rocblas_rotg_kernel(T              a_in,
@@ -26,6 +26,7 @@
 #include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
+#include "rocblas_blas1_sequence.hpp"
 #include "rocblas_block_sizes.h"
 #include "utility.hpp"
 
@@ -58,7 +59,7 @@ namespace
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
 
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(
@@ -96,6 +97,22 @@ namespace
                 return rocblas_status_success;
         }
 
+        // Deferred sequence recording: between rocblas_begin_sequence and
+        // rocblas_end_sequence, eligible calls queue a descriptor instead of
+        // launching (the vector lives in the y slot of the descriptor)
+        if constexpr((std::is_same_v<T, float> || std::is_same_v<T, double>)&&std::is_same_v<T, U>)
+        {
+            if(!check_numerics && rocblas_blas1_sequence_eligible(handle, n, incx, 0))
+                return rocblas_blas1_sequence_record<T>(handle,
+                                                        rocblas_blas1_seq_op::scal,
+                                                        rocblas_int(n),
+                                                        double(*alpha),
+                                                        nullptr,
+                                                        rocblas_int(incx),
+                                                        x,
+                                                        0);
+        }
+
         if(check_numerics)
         {
             bool           is_input              = true;
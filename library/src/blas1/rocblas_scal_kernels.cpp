@@ -55,6 +55,18 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride stride_x,
                                            rocblas_int    batch_count)
 {
+    // large pointer batches that are really strided take the cheaper strided
+    // addressing path, saving the per-workgroup pointer-array dereference
+    if(batch_count >= c_batch_stride_detect_min_batch && !handle->is_stream_in_capture_mode())
+    {
+        T*             base;
+        rocblas_stride stride;
+        if(rocblas_internal_uniform_batch_stride(
+               handle->get_stream(), x, batch_count, base, stride))
+            return rocblas_internal_scal_launcher<rocblas_int, ROCBLAS_SCAL_NB, T, T>(
+                handle, n, alpha, stride_alpha, base, offset_x, incx, stride, batch_count);
+    }
+
     return rocblas_internal_scal_launcher<rocblas_int, ROCBLAS_SCAL_NB, T, T>(
         handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
 }
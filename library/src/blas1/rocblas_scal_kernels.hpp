@@ -21,6 +21,8 @@
  * ************************************************************************ */
 #pragma once
 
+#include "rocblas_blas1_unroll.hpp"
+
 template <typename API_INT, int NB, typename T, typename Tex, typename Ta, typename Tx>
 ROCBLAS_KERNEL(NB)
 rocblas_scal_kernel(rocblas_int    n,
@@ -47,6 +49,70 @@ rocblas_scal_kernel(rocblas_int    n,
     }
 }
 
+//!
+//! @brief General kernel with a compile-time per-thread unroll: each block
+//! covers NB * WIN elements with an NB-strided inner loop (the dot kernel
+//! layout). WIN == 1 is the historical one-element-per-thread kernel; the
+//! launcher picks the depth from the per-arch table in
+//! rocblas_blas1_unroll.hpp.
+//!
+template <typename API_INT, int NB, int WIN, typename T, typename Tex, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_scal_kernel_win(rocblas_int    n,
+                        Ta             alpha_device_host,
+                        rocblas_stride stride_alpha,
+                        Tx             xa,
+                        rocblas_stride offset_x,
+                        API_INT        incx,
+                        rocblas_stride stride_x)
+{
+    auto* x     = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
+    auto  alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+
+    if(alpha == 1)
+        return;
+
+    int64_t base = int64_t(blockIdx.x) * NB * WIN + threadIdx.x;
+
+    for(int j = 0; j < WIN; j++)
+    {
+        int64_t tid = base + j * NB;
+        if(tid < n)
+        {
+            Tex res                = (Tex)x[tid * int64_t(incx)] * alpha;
+            x[tid * int64_t(incx)] = (T)res;
+        }
+    }
+}
+
+//!
+//! @brief Grid-stride kernel covering a full 64-bit length in a single launch,
+//! used by the ILP64 launcher instead of chunking into 32-bit-sized pieces.
+//!
+template <int NB, typename T, typename Tex, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_scal_kernel_64(int64_t        n,
+                       Ta             alpha_device_host,
+                       rocblas_stride stride_alpha,
+                       Tx             xa,
+                       rocblas_stride offset_x,
+                       int64_t        incx,
+                       rocblas_stride stride_x)
+{
+    auto* x     = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
+    auto  alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+
+    if(alpha == 1)
+        return;
+
+    int64_t inc = int64_t(gridDim.x) * blockDim.x;
+    for(int64_t tid = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; tid < n; tid += inc)
+    {
+        Tex res       = (Tex)x[tid * incx] * alpha;
+        x[tid * incx] = (T)res;
+    }
+}
+
 //!
 //! @brief Optimized kernel for the SCAL floating points.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
@@ -67,23 +133,23 @@ rocblas_sscal_2_kernel(rocblas_int    n,
         return;
 
     uint32_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    if(tid >= n)
+        return;
 
-    if(tid + 1 < n)
-    {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vector `x`
-        for(int32_t j = 0; j < 2; ++j)
-        {
-            Tex res    = (Tex)x[tid + j] * alpha;
-            x[tid + j] = (T)res;
-        }
-    }
+    // Each thread access contiguous elements for example Thread '0' access indices '0' and '1'
+    // of the vector `x`; the trailing element of an odd `n` is covered by masking.
+    int count = n - tid < 2 ? int(n - tid) : 2;
 
-    // If `n` is odd then the computation of last element in the vector `x` is covered below.
-    if(n % 2 != 0 && tid == n - 1)
+    T vals[2];
+    rocblas_masked_load(x + tid, count, vals);
+
+    for(int32_t j = 0; j < 2; ++j)
     {
-        Tex res = (Tex)x[tid] * alpha;
-        x[tid]  = (T)res;
+        Tex res = (Tex)vals[j] * alpha;
+        vals[j] = (T)res;
     }
+
+    rocblas_masked_store(vals, count, x + tid);
 }
 
 //!
@@ -93,8 +159,6 @@ rocblas_sscal_2_kernel(rocblas_int    n,
 template <int NB, typename Ta, typename Tx>
 ROCBLAS_KERNEL(NB)
 rocblas_hscal_mlt_4_kernel(rocblas_int    n,
-                           rocblas_int    n_mod_4,
-                           rocblas_int    n_mlt_4,
                            Ta             alpha_device_host,
                            rocblas_stride stride_alpha,
                            Tx __restrict__ xa,
@@ -110,6 +174,8 @@ rocblas_hscal_mlt_4_kernel(rocblas_int    n,
     rocblas_half2 z0, z1;
 
     uint32_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 4;
+    if(tid >= n)
+        return;
 
     if(tid + 3 < n)
     {
@@ -130,22 +196,125 @@ rocblas_hscal_mlt_4_kernel(rocblas_int    n,
         (*x)[2] = z1[0];
         (*x)[3] = z1[1];
     }
+    else
+    {
+        // partial last group: predicated accesses instead of a data-dependent
+        // cleanup loop
+        auto* x     = load_ptr_batch(xa, blockIdx.y, offset_x + tid, stride_x);
+        int   count = n - tid;
+
+        rocblas_half vals[4];
+        rocblas_masked_load(x, count, vals);
+
+        for(int32_t j = 0; j < 4; ++j)
+            vals[j] = vals[j] * alpha;
+
+        rocblas_masked_store(vals, count, x);
+    }
+}
+
+//!
+//! @brief Optimized kernel for the SCAL when the input is bfloat16 and the compute type is float.
+//! @remark Increments are required to be equal to one, that's why they are unspecified.
+//!
+template <int NB, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_bscal_mlt_8_kernel(rocblas_int    n,
+                           Ta             alpha_device_host,
+                           rocblas_stride stride_alpha,
+                           Tx __restrict__ xa,
+                           rocblas_stride offset_x,
+                           rocblas_stride stride_x)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
 
-    // If `n_mod_4` is true then the computation of last few element in the vector `x` is covered below.
-    if(n_mod_4)
+    if(alpha == 1)
+        return;
+
+    // Tex is float for every bfloat16 configuration, so the arithmetic is
+    // carried out in float registers and only the loads and stores are bfloat16.
+    float alpha_f = float(alpha);
+
+    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 8;
+    if(tid >= n)
+        return;
+
+    rocblas_bfloat16* x = (rocblas_bfloat16*)load_ptr_batch(xa, blockIdx.y, offset_x + tid, stride_x);
+
+    if(tid + 8 <= n && rocblas_is_16B_aligned(x))
     {
-        //The last ThreadID which is a multiple of 4 should complete the computation of last few elements of vector `x`
-        if(tid == n_mlt_4)
-        {
-            auto* x = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
-            for(int32_t j = 0; j < n_mod_4; ++j)
-            {
-                x[tid + j] = x[tid + j] * alpha;
-            }
-        }
+        // 8 bfloat16 are 16 bytes, so each group is one vector load and
+        // store. tid advances in 16-byte steps, making the alignment test
+        // uniform within a block.
+        rocblas_chunk16<rocblas_bfloat16> v = *(const rocblas_chunk16<rocblas_bfloat16>*)x;
+
+        for(int32_t j = 0; j < 8; ++j)
+            v.data[j] = rocblas_bfloat16(alpha_f * float(v.data[j]));
+
+        *(rocblas_chunk16<rocblas_bfloat16>*)x = v;
+    }
+    else
+    {
+        // unaligned or partial last group: predicated accesses instead of a
+        // data-dependent cleanup loop
+        int count = n - tid < 8 ? int(n - tid) : 8;
+
+        rocblas_bfloat16 vals[8];
+        rocblas_masked_load(x, count, vals);
+
+        for(int32_t j = 0; j < 8; ++j)
+            vals[j] = rocblas_bfloat16(alpha_f * float(vals[j]));
+
+        rocblas_masked_store(vals, count, x);
     }
 }
 
+// Launch of the general scal kernel at a fixed unroll depth; called from the
+// launcher's fallback path after the per-arch depth is chosen
+template <typename API_INT, int NB, int WIN, typename T, typename Tex, typename Ta, typename Tx>
+rocblas_status rocblas_internal_scal_launch_win(rocblas_handle handle,
+                                                API_INT        n,
+                                                const Ta*      alpha,
+                                                rocblas_stride stride_alpha,
+                                                Tx             x,
+                                                rocblas_stride offset_x,
+                                                API_INT        incx,
+                                                rocblas_stride stride_x,
+                                                API_INT        batch_count)
+{
+    int  blocks = (n - 1) / (NB * WIN) + 1;
+    dim3 grid(blocks, batch_count);
+    dim3 threads(NB);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel_win<API_INT, NB, WIN, T, Tex>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              alpha,
+                              stride_alpha,
+                              x,
+                              offset_x,
+                              incx,
+                              stride_x);
+    else // single alpha is on host
+        ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel_win<API_INT, NB, WIN, T, Tex>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              *alpha,
+                              stride_alpha,
+                              x,
+                              offset_x,
+                              incx,
+                              stride_x);
+    return rocblas_status_success;
+}
+
 template <typename API_INT, int NB, typename T, typename Tex, typename Ta, typename Tx>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_scal_launcher(rocblas_handle handle,
@@ -171,6 +340,12 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     static constexpr bool using_rocblas_half
         = std::is_same_v<Ta, rocblas_half> && std::is_same_v<Tex, rocblas_half>;
 
+    // Using rocblas_bfloat16 with float computation (the only supported
+    // bfloat16 configurations) ?
+    static constexpr bool using_rocblas_bfloat16
+        = (std::is_same_v<Tx, rocblas_bfloat16*> || std::is_same_v<Tx, rocblas_bfloat16* const*>)
+          && std::is_same_v<Tex, float>;
+
     if(using_rocblas_float && incx == 1)
     {
         // Kernel function for improving the performance of SSCAL when incx==1
@@ -206,9 +381,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     else if(using_rocblas_half && incx == 1)
     {
         // Kernel function for improving the performance of HSCAL when incx==1
-        int32_t n_mod_4 = n & 3; // n mod 4
-        int32_t n_mlt_4 = n & ~(rocblas_int)3; // multiple of 4
-        int32_t blocks  = 1 + ((n - 1) / (NB * 4));
+        int32_t blocks = 1 + ((n - 1) / (NB * 4));
         dim3    grid(blocks, batch_count);
         dim3    threads(NB);
 
@@ -221,8 +394,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                       0,
                                       handle->get_stream(),
                                       n,
-                                      n_mod_4,
-                                      n_mlt_4,
                                       (const rocblas_half*)alpha,
                                       stride_alpha,
                                       x,
@@ -235,8 +406,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                       0,
                                       handle->get_stream(),
                                       n,
-                                      n_mod_4,
-                                      n_mlt_4,
                                       load_scalar((const rocblas_half*)alpha),
                                       stride_alpha,
                                       x,
@@ -244,8 +413,56 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                       stride_x);
         }
     }
+    else if(using_rocblas_bfloat16 && incx == 1)
+    {
+        // Kernel function for improving the performance of bfloat16 SCAL when incx==1:
+        // groups of 8 elements (16 bytes) per thread with the arithmetic done in float
+        int32_t blocks = 1 + ((n - 1) / (NB * 8));
+        dim3    grid(blocks, batch_count);
+        dim3    threads(NB);
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_bscal_mlt_8_kernel<NB>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  alpha,
+                                  stride_alpha,
+                                  x,
+                                  offset_x,
+                                  stride_x);
+        else // single alpha is on host
+            ROCBLAS_LAUNCH_KERNEL((rocblas_bscal_mlt_8_kernel<NB>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  *alpha,
+                                  stride_alpha,
+                                  x,
+                                  offset_x,
+                                  stride_x);
+    }
     else
     {
+        // per-arch unroll depth for the general kernel; depth 1 keeps the
+        // historical one-element-per-thread kernel
+        int win = rocblas_blas1_unroll_win(handle, sizeof(T));
+        switch(win)
+        {
+        case 4:
+            return rocblas_internal_scal_launch_win<API_INT, NB, 4, T, Tex>(
+                handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+        case 2:
+            return rocblas_internal_scal_launch_win<API_INT, NB, 2, T, Tex>(
+                handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+        default:
+            break;
+        }
+
         int  blocks = (n - 1) / NB + 1;
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
@@ -57,31 +57,46 @@ rocblas_swap_kernel(rocblas_int    n,
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Optimized kernel for unit increments, moving 16-byte chunks. Each
+//! thread owns a chunk of consecutive elements; the tail chunk and batches
+//! whose pointers are not 16-byte aligned fall back to scalar accesses over
+//! the same range, so the branch is uniform within a block.
 //!
 template <rocblas_int NB, typename UPtr>
 ROCBLAS_KERNEL(NB)
-rocblas_sswap_2_kernel(rocblas_int n,
-                       UPtr __restrict__ xa,
-                       rocblas_stride offsetx,
-                       rocblas_stride stridex,
-                       UPtr __restrict__ ya,
-                       rocblas_stride offsety,
-                       rocblas_stride stridey)
+rocblas_swap_16B_kernel(rocblas_int n,
+                        UPtr __restrict__ xa,
+                        rocblas_stride offsetx,
+                        rocblas_stride stridex,
+                        UPtr __restrict__ ya,
+                        rocblas_stride offsety,
+                        rocblas_stride stridey)
 {
-    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-    auto*   x   = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
-    auto*   y   = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
-    if(tid < n - 1)
+    auto* x = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
+    auto* y = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
+
+    using T                           = std::remove_pointer_t<decltype(x)>;
+    static constexpr rocblas_int CHUNK = rocblas_int(16 / sizeof(T));
+
+    int64_t tid  = blockIdx.x * blockDim.x + threadIdx.x;
+    int64_t base = tid * CHUNK;
+    if(base >= n)
+        return;
+
+    if(base + CHUNK <= n && rocblas_is_16B_aligned(x) && rocblas_is_16B_aligned(y))
     {
-        for(int j = 0; j < 2; ++j)
-        {
-            rocblas_swap_vals(x + tid + j, y + tid + j);
-        }
+        auto* vx = (rocblas_chunk16<T>*)x + tid;
+        auto* vy = (rocblas_chunk16<T>*)y + tid;
+
+        rocblas_chunk16<T> tmp = *vy;
+
+        *vy = *vx;
+        *vx = tmp;
     }
-    if(n % 2 != 0 && tid == n - 1)
+    else
     {
-        rocblas_swap_vals(x + tid, y + tid);
+        for(rocblas_int j = 0; j < CHUNK && base + j < n; ++j)
+            rocblas_swap_vals(x + base + j, y + base + j);
     }
 }
 
@@ -102,10 +117,10 @@ rocblas_status rocblas_internal_swap_launcher(rocblas_handle handle,
     if(n <= 0 || batch_count <= 0)
         return rocblas_status_success;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same_v<T, rocblas_float*> || std::is_same_v<T, rocblas_float* const*>;
+    using Tval = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<T>>>>;
+    static constexpr rocblas_int CHUNK = rocblas_int(16 / sizeof(Tval));
 
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(CHUNK <= 1 || incx != 1 || incy != 1)
     {
         // in case of negative inc shift pointer to end of data for negative indexing tid*inc
         int64_t shiftx = incx < 0 ? offsetx - int64_t(incx) * (n - 1) : offsetx;
@@ -131,15 +146,16 @@ rocblas_status rocblas_internal_swap_launcher(rocblas_handle handle,
     }
     else
     {
-        // Kernel function for improving the performance of SSWAP when incx==1 and incy==1
+        // 16-byte chunked kernel when incx==1 and incy==1; for elements
+        // narrower than 16 bytes this widens the memory transactions
         int64_t shiftx = offsetx - 0;
         int64_t shifty = offsety - 0;
 
-        int  blocks = 1 + ((n - 1) / (NB * 2));
+        int  blocks = 1 + ((n - 1) / (NB * CHUNK));
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
 
-        ROCBLAS_LAUNCH_KERNEL((rocblas_sswap_2_kernel<NB>),
+        ROCBLAS_LAUNCH_KERNEL((rocblas_swap_16B_kernel<NB>),
                               grid,
                               threads,
                               0,
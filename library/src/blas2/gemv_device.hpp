@@ -292,9 +292,13 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_double_buffered_kernel_calc(rocblas_int ro
     }
 }
 
+// When ATOMIC is set the caller pre-applies beta with a separate scale pass
+// and each block accumulates alpha * partial into y with atomicAdd, so the
+// column range may be sliced across blocks (see rocblas_gemvn_n_split_kernel)
 template <int DIM_X,
           int DIM_Y,
           typename T_Index,
+          bool ATOMIC = false,
           typename Ti,
           typename Tex,
           typename To,
@@ -314,6 +318,11 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
     if(!alpha)
     {
+        // atomic slices contribute nothing for alpha == 0; beta was already
+        // applied by the scale pass
+        if constexpr(ATOMIC)
+            return;
+
         if(thread_id < DIM_X * 4)
         {
             int64_t ind = blockIdx.x * DIM_X * 4 + thread_id;
@@ -350,31 +359,31 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
         if(ind < m)
         {
-            res_A[0] += A[ind + (col + 0) * T_Index(lda)] * res_x[0];
-            res_A[0] += A[ind + (col + 1) * T_Index(lda)] * res_x[1];
-            res_A[0] += A[ind + (col + 2) * T_Index(lda)] * res_x[2];
-            res_A[0] += A[ind + (col + 3) * T_Index(lda)] * res_x[3];
+            res_A[0] = rocblas_cmadd(A[ind + (col + 0) * T_Index(lda)], res_x[0], res_A[0]);
+            res_A[0] = rocblas_cmadd(A[ind + (col + 1) * T_Index(lda)], res_x[1], res_A[0]);
+            res_A[0] = rocblas_cmadd(A[ind + (col + 2) * T_Index(lda)], res_x[2], res_A[0]);
+            res_A[0] = rocblas_cmadd(A[ind + (col + 3) * T_Index(lda)], res_x[3], res_A[0]);
 
             if(ind + DIM_X < m)
             {
-                res_A[1] += A[ind + DIM_X + (col + 0) * T_Index(lda)] * res_x[0];
-                res_A[1] += A[ind + DIM_X + (col + 1) * T_Index(lda)] * res_x[1];
-                res_A[1] += A[ind + DIM_X + (col + 2) * T_Index(lda)] * res_x[2];
-                res_A[1] += A[ind + DIM_X + (col + 3) * T_Index(lda)] * res_x[3];
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 0) * T_Index(lda)], res_x[0], res_A[1]);
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 1) * T_Index(lda)], res_x[1], res_A[1]);
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 2) * T_Index(lda)], res_x[2], res_A[1]);
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 3) * T_Index(lda)], res_x[3], res_A[1]);
 
                 if(ind + 2 * DIM_X < m)
                 {
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 0) * T_Index(lda)] * res_x[0];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 1) * T_Index(lda)] * res_x[1];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 2) * T_Index(lda)] * res_x[2];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 3) * T_Index(lda)] * res_x[3];
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 0) * T_Index(lda)], res_x[0], res_A[2]);
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 1) * T_Index(lda)], res_x[1], res_A[2]);
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 2) * T_Index(lda)], res_x[2], res_A[2]);
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 3) * T_Index(lda)], res_x[3], res_A[2]);
 
                     if(ind + 3 * DIM_X < m)
                     {
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 0) * T_Index(lda)] * res_x[0];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 1) * T_Index(lda)] * res_x[1];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 2) * T_Index(lda)] * res_x[2];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 3) * T_Index(lda)] * res_x[3];
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 0) * T_Index(lda)], res_x[0], res_A[3]);
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 1) * T_Index(lda)], res_x[1], res_A[3]);
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 2) * T_Index(lda)], res_x[2], res_A[3]);
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 3) * T_Index(lda)], res_x[3], res_A[3]);
                     }
                 }
             }
@@ -406,39 +415,31 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
         if(ind < m)
         {
-            res_A[0] += A[ind + (col + 0) * T_Index(lda) * (col + 0 < n)] * res_x[0];
-            res_A[0] += A[ind + (col + 1) * T_Index(lda) * (col + 1 < n)] * res_x[1];
-            res_A[0] += A[ind + (col + 2) * T_Index(lda) * (col + 2 < n)] * res_x[2];
-            res_A[0] += A[ind + (col + 3) * T_Index(lda) * (col + 3 < n)] * res_x[3];
+            res_A[0] = rocblas_cmadd(A[ind + (col + 0) * T_Index(lda) * (col + 0 < n)], res_x[0], res_A[0]);
+            res_A[0] = rocblas_cmadd(A[ind + (col + 1) * T_Index(lda) * (col + 1 < n)], res_x[1], res_A[0]);
+            res_A[0] = rocblas_cmadd(A[ind + (col + 2) * T_Index(lda) * (col + 2 < n)], res_x[2], res_A[0]);
+            res_A[0] = rocblas_cmadd(A[ind + (col + 3) * T_Index(lda) * (col + 3 < n)], res_x[3], res_A[0]);
 
             if(ind + DIM_X < m)
             {
-                res_A[1] += A[ind + DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)] * res_x[0];
-                res_A[1] += A[ind + DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)] * res_x[1];
-                res_A[1] += A[ind + DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)] * res_x[2];
-                res_A[1] += A[ind + DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)] * res_x[3];
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)], res_x[0], res_A[1]);
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)], res_x[1], res_A[1]);
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)], res_x[2], res_A[1]);
+                res_A[1] = rocblas_cmadd(A[ind + DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)], res_x[3], res_A[1]);
 
                 if(ind + 2 * DIM_X < m)
                 {
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)] * res_x[0];
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)] * res_x[1];
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)] * res_x[2];
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)] * res_x[3];
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)], res_x[0], res_A[2]);
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)], res_x[1], res_A[2]);
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)], res_x[2], res_A[2]);
+                    res_A[2] = rocblas_cmadd(A[ind + 2 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)], res_x[3], res_A[2]);
 
                     if(ind + 3 * DIM_X < m)
                     {
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)]
-                                    * res_x[0];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)]
-                                    * res_x[1];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)]
-                                    * res_x[2];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)]
-                                    * res_x[3];
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)], res_x[0], res_A[3]);
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)], res_x[1], res_A[3]);
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)], res_x[2], res_A[3]);
+                        res_A[3] = rocblas_cmadd(A[ind + 3 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)], res_x[3], res_A[3]);
                     }
                 }
             }
@@ -460,9 +461,14 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
         ind = blockIdx.x * DIM_X * 4 + thread_id;
 
         if(ind < m)
-            y[ind * T_Index(incy)]
-                = beta ? (To)(alpha * sdata[thread_id] + beta * y[ind * T_Index(incy)])
-                       : (To)(alpha * sdata[thread_id]);
+        {
+            if constexpr(ATOMIC)
+                atomicAdd(&y[ind * T_Index(incy)], To(alpha * sdata[thread_id]));
+            else
+                y[ind * T_Index(incy)]
+                    = beta ? (To)(alpha * sdata[thread_id] + beta * y[ind * T_Index(incy)])
+                           : (To)(alpha * sdata[thread_id]);
+        }
     }
 }
 
@@ -514,7 +520,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            res_A += A[ind + col * T_Index(lda)] * x[col * T_Index(incx)];
+            res_A = rocblas_cmadd(A[ind + col * T_Index(lda)], x[col * T_Index(incx)], res_A);
         }
     }
 
@@ -528,7 +534,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            res_A += A[ind + col * T_Index(lda) * (col < n)] * res_x;
+            res_A = rocblas_cmadd(A[ind + col * T_Index(lda) * (col < n)], res_x, res_A);
         }
     }
 
@@ -587,10 +593,10 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_kernel_calc(rocblas_int m,
     rocblas_int m_full = (m / NB_X) * NB_X;
 
     for(rocblas_int i = 0; i < m_full; i += NB_X)
-        res += (CONJ ? conj(A[i]) : A[i]) * x[(tx + i) * int64_t(incx)];
+        res = rocblas_cmadd((CONJ ? conj(A[i]) : A[i]), x[(tx + i) * int64_t(incx)], res);
 
     if(tx + m_full < m)
-        res += (CONJ ? conj(A[m_full]) : A[m_full]) * x[(tx + m_full) * int64_t(incx)];
+        res = rocblas_cmadd((CONJ ? conj(A[m_full]) : A[m_full]), x[(tx + m_full) * int64_t(incx)], res);
 
     sdata[tx] = res;
 
@@ -957,6 +963,82 @@ rocblas_gemvt_double_buffered_kernel(rocblas_int    m,
         m, n, alpha, A, lda, x, incx, y, incy);
 }
 
+// Skinny non-transpose kernel: the column count N_COLS is a compile-time
+// constant so the per-row dot product is fully unrolled with x held in
+// registers. Each thread owns one row, keeping every lane busy for the tall
+// matrices where the general tiles leave most of the wavefront idle.
+template <int NB, int N_COLS, typename T_Index, typename Ti, typename Tex, typename To>
+ROCBLAS_KERNEL_ILF void rocblas_gemvn_skinny_kernel_calc(rocblas_int m,
+                                                         Tex         alpha,
+                                                         const Ti*   A,
+                                                         T_Index     lda,
+                                                         const Ti*   x,
+                                                         T_Index     incx,
+                                                         Tex         beta,
+                                                         To*         y,
+                                                         T_Index     incy)
+{
+    int64_t ind = blockIdx.x * NB + threadIdx.x;
+    if(ind >= m)
+        return;
+
+    if(!alpha)
+    {
+        y[ind * T_Index(incy)] = beta ? (To)(beta * y[ind * T_Index(incy)]) : (To)0;
+        return;
+    }
+
+    Tex res_x[N_COLS];
+#pragma unroll
+    for(int col = 0; col < N_COLS; col++)
+        res_x[col] = x[col * T_Index(incx)];
+
+    Tex res = Tex{0};
+#pragma unroll
+    for(int col = 0; col < N_COLS; col++)
+        res += A[ind + col * T_Index(lda)] * res_x[col];
+
+    if(beta != 0)
+        y[ind * T_Index(incy)] = (To)(alpha * res + beta * y[ind * T_Index(incy)]);
+    else
+        y[ind * T_Index(incy)] = (To)(alpha * res);
+}
+
+template <int NB, int N_COLS, typename T_Index, typename Ti, typename Tex, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_gemvn_skinny_kernel(rocblas_int    m,
+                            Tex            alpha_device_host,
+                            rocblas_stride stride_alpha,
+                            const Ti*      Aa,
+                            rocblas_stride shifta,
+                            T_Index        lda,
+                            rocblas_stride strideA,
+                            const Ti*      xa,
+                            rocblas_stride shiftx,
+                            T_Index        incx,
+                            rocblas_stride stridex,
+                            Tex            beta_device_host,
+                            rocblas_stride stride_beta,
+                            To*            ya,
+                            rocblas_stride shifty,
+                            T_Index        incy,
+                            rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_gemvn_skinny_kernel_calc<NB, N_COLS, T_Index>(
+        m, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 template <int DIM_X, int DIM_Y, typename T_Index, typename Ti, typename Tex, typename To>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_gemvn_kernel(rocblas_int    m,
@@ -996,6 +1078,64 @@ rocblas_gemvn_kernel(rocblas_int    m,
     rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, T_Index>(m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+// Scheduling variant for small-m, wide-n batches that underfill the device:
+// gridDim.y slices the column reduction of each problem and every slice
+// accumulates alpha * partial into y with atomicAdd. beta is applied by a
+// separate scale pass beforehand, and the batch index rides gridDim.z.
+// Column slices stay aligned to the 4 * DIM_Y unroll of the calc body.
+template <int DIM_X, int DIM_Y, typename T_Index, typename Ti, typename Tex, typename To>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemvn_n_split_kernel(rocblas_int    m,
+                             rocblas_int    n,
+                             Tex            alpha_device_host,
+                             rocblas_stride stride_alpha,
+                             const Ti*      Aa,
+                             rocblas_stride shifta,
+                             T_Index        lda,
+                             rocblas_stride strideA,
+                             const Ti*      xa,
+                             rocblas_stride shiftx,
+                             T_Index        incx,
+                             rocblas_stride stridex,
+                             To*            ya,
+                             rocblas_stride shifty,
+                             T_Index        incy,
+                             rocblas_stride stridey)
+{
+    rocblas_int num_threads = blockDim.x * blockDim.y * blockDim.z;
+    if(DIM_X * DIM_Y != num_threads)
+        return; // need to launch exactly the same number of threads as template parameters indicate
+
+    auto alpha = load_scalar(alpha_device_host, blockIdx.z, stride_alpha);
+    if(!alpha)
+        return;
+
+    // even, unroll-aligned column slice for this y-block
+    constexpr rocblas_int col_align = 4 * DIM_Y;
+    rocblas_int           slices    = gridDim.y;
+    rocblas_int cols_per = ((n + slices - 1) / slices + col_align - 1) / col_align * col_align;
+    rocblas_int col_base = rocblas_int(blockIdx.y) * cols_per;
+    if(col_base >= n)
+        return;
+    rocblas_int cols = n - col_base < cols_per ? n - col_base : cols_per;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.z, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.z, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
+
+    rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, T_Index, true>(m,
+                                                           cols,
+                                                           alpha,
+                                                           A + col_base * T_Index(lda),
+                                                           lda,
+                                                           x + col_base * T_Index(incx),
+                                                           incx,
+                                                           Tex{0},
+                                                           y,
+                                                           incy);
+}
+
 // lda always cast to size_t so single kernel
 template <bool CONJ, int NB_X, typename Ti, typename Tex, typename To>
 ROCBLAS_KERNEL(NB_X)
@@ -1110,6 +1250,160 @@ rocblas_gemvt_sn_reduce(rocblas_int    n_sums,
     rocblas_gemvt_sn_reduce_calc<NB, WIN>(n_sums, beta, y, incy, workspace);
 }
 
+// Variant of the split-m transpose kernel for atomics-allowed mode: each
+// block adds its partial column sums straight into y with device atomics,
+// so neither the workspace nor the reduction pass is needed. y must
+// already hold beta * y (see rocblas_gemv_scal_kernel).
+template <bool        CONJ,
+          rocblas_int NB_X,
+          rocblas_int WIN,
+          typename T_Index,
+          typename Ti,
+          typename Tex,
+          typename To>
+ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_atomic_kernel_calc(rocblas_int m,
+                                                            rocblas_int n,
+                                                            Tex         alpha,
+                                                            const Ti*   A,
+                                                            T_Index     lda,
+                                                            const Ti*   x,
+                                                            T_Index     incx,
+                                                            To*         y,
+                                                            T_Index     incy)
+{
+    rocblas_int tx = threadIdx.x;
+
+    // beta scaling was done beforehand, so there is nothing to accumulate
+    if(!alpha)
+        return;
+
+    int row = tx * WIN + blockIdx.x * NB_X * WIN;
+    A += row;
+
+    constexpr int NC = 4;
+
+    rocblas_int n_tail = n % NC;
+
+    rocblas_int m_tail = m % WIN;
+
+    Tex sum[NC];
+    Tex xvec[WIN];
+
+    int i = 0; // col
+    for(i = 0; i < n - n_tail; i += NC)
+    {
+        sum[0] = sum[1] = sum[2] = sum[3] = Tex{0};
+
+        if(row + WIN <= m)
+        {
+            for(int j = 0; j < WIN; j++)
+            {
+                xvec[j] = x[(row + j) * T_Index(incx)];
+            }
+            for(int j = 0; j < WIN; j++)
+            {
+                for(int k = 0; k < NC; k++)
+                    sum[k] += (CONJ ? conj(A[(i + k) * T_Index(lda) + j])
+                                    : A[(i + k) * T_Index(lda) + j])
+                              * xvec[j];
+            }
+        }
+        else if(row + m_tail <= m)
+        {
+            for(int j = 0; j < m_tail; j++)
+            {
+                xvec[j] = x[(row + j) * T_Index(incx)];
+            }
+            for(int j = 0; j < m_tail; j++)
+            {
+                for(int k = 0; k < NC; k++)
+                    sum[k] += (CONJ ? conj(A[(i + k) * T_Index(lda) + j])
+                                    : A[(i + k) * T_Index(lda) + j])
+                              * xvec[j];
+            }
+        }
+
+        for(int k = 0; k < NC; k++)
+            sum[k] = rocblas_dot_block_reduce<NB_X>(sum[k]);
+
+        if(tx == 0)
+        {
+            for(int k = 0; k < NC; k++)
+                atomicAdd(&y[T_Index(k + i) * incy], To(alpha * sum[k]));
+        }
+    }
+    for(; i < n; i++)
+    {
+        sum[0] = Tex{0};
+
+        if(row + WIN <= m)
+        {
+            for(int j = 0; j < WIN; j++)
+            {
+                xvec[j] = x[(row + j) * T_Index(incx)];
+            }
+            for(int j = 0; j < WIN; j++)
+            {
+                sum[0]
+                    += (CONJ ? conj(A[(i + 0) * T_Index(lda) + j]) : A[(i + 0) * T_Index(lda) + j])
+                       * xvec[j];
+            }
+        }
+        else if(row + m_tail <= m)
+        {
+            for(int j = 0; j < m_tail; j++)
+            {
+                xvec[j] = x[(row + j) * T_Index(incx)];
+            }
+            for(int j = 0; j < m_tail; j++)
+            {
+                sum[0]
+                    += (CONJ ? conj(A[(i + 0) * T_Index(lda) + j]) : A[(i + 0) * T_Index(lda) + j])
+                       * xvec[j];
+            }
+        }
+        sum[0] = rocblas_dot_block_reduce<NB_X>(sum[0]);
+        if(tx == 0)
+            atomicAdd(&y[T_Index(i) * incy], To(alpha * sum[0]));
+    }
+}
+
+template <bool CONJ,
+          int NB_X,
+          int WIN,
+          typename T_Index,
+          typename Ti,
+          typename U,
+          typename To>
+ROCBLAS_KERNEL(NB_X)
+rocblas_gemvt_sn_atomic_kernel(rocblas_int    m,
+                               rocblas_int    n,
+                               U              alpha_device_host,
+                               rocblas_stride stride_alpha,
+                               const Ti*      Aa,
+                               rocblas_stride shifta,
+                               rocblas_int    lda,
+                               rocblas_stride strideA,
+                               const Ti*      xa,
+                               rocblas_stride shiftx,
+                               rocblas_int    incx,
+                               rocblas_stride stridex,
+                               To*            ya,
+                               rocblas_stride shifty,
+                               rocblas_int    incy,
+                               rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_gemvt_sn_atomic_kernel_calc<CONJ, NB_X, WIN, T_Index>(
+        m, n, alpha, A, lda, x, incx, y, incy);
+}
+
 template <bool CONJ, int NB_X, typename Ti, typename Tex, typename To>
 ROCBLAS_KERNEL(NB_X)
 rocblas_gemvtsm_kernel(rocblas_int    m,
@@ -1250,3 +1544,89 @@ rocblas_gemvn_sm_mn_batched_kernel(rocblas_int    m,
 
 #endif
 }
+
+template <int NB, typename Ti, typename Tex, typename To>
+ROCBLAS_KERNEL_ILF void rocblas_gemvn_tiny_batched_kernel_calc(rocblas_int m,
+                                                               rocblas_int n,
+                                                               Tex         alpha,
+                                                               const Ti*   A,
+                                                               rocblas_int lda,
+                                                               const Ti*   x,
+                                                               rocblas_int incx,
+                                                               Tex         beta,
+                                                               To*         y,
+                                                               rocblas_int incy)
+{
+    // small m && n <= NB kernel, one workgroup per problem
+
+    const int tx = threadIdx.x; // row
+
+    if(!alpha)
+    {
+        if(tx < m)
+            y[tx * int64_t(incy)] = beta ? (To)((Tex)y[tx * int64_t(incy)] * beta) : (To)0;
+        return;
+    }
+
+    __shared__ Tex shared_x[NB];
+
+    if(tx < n)
+        shared_x[tx] = alpha * x[tx * int64_t(incx)];
+
+    __syncthreads();
+
+    if(tx < m)
+    {
+        Tex res = beta ? (Tex)(beta * y[tx * int64_t(incy)]) : (Tex)0;
+        for(rocblas_int j = 0; j < n; j++)
+            res += shared_x[j] * A[j * size_t(lda) + tx];
+        y[tx * int64_t(incy)] = (To)res;
+    }
+}
+
+// Tiny batched non-transpose kernel: one workgroup of NB threads owns one
+// whole (m, n <= NB) problem and the grid strides over batch elements, so
+// large batches of tiny problems fill the GPU with independent workgroups
+// instead of a single under-sized gemv launch.
+template <int NB, typename Ti, typename Tex, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_gemvn_tiny_batched_kernel(rocblas_int    m,
+                                  rocblas_int    n,
+                                  Tex            alpha_device_host,
+                                  rocblas_stride stride_alpha,
+                                  const Ti*      Aa,
+                                  rocblas_stride shifta,
+                                  rocblas_int    lda,
+                                  rocblas_stride strideA,
+                                  const Ti*      xa,
+                                  rocblas_stride shiftx,
+                                  rocblas_int    incx,
+                                  rocblas_stride stridex,
+                                  Tex            beta_device_host,
+                                  rocblas_stride stride_beta,
+                                  To*            ya,
+                                  rocblas_stride shifty,
+                                  rocblas_int    incy,
+                                  rocblas_stride stridey,
+                                  rocblas_int    batch_count)
+{
+    for(uint32_t b = blockIdx.x; b < uint32_t(batch_count); b += gridDim.x)
+    {
+        auto alpha = load_scalar(alpha_device_host, b, stride_alpha);
+        auto beta  = load_scalar(beta_device_host, b, stride_beta);
+
+        // scalars are uniform across the workgroup so neither this branch
+        // nor the barrier below diverges
+        if(alpha || beta != 1)
+        {
+            const auto* A = cond_load_ptr_batch(alpha, Aa, b, shifta, strideA);
+            const auto* x = cond_load_ptr_batch(alpha, xa, b, shiftx, stridex);
+
+            auto* y = load_ptr_batch(ya, b, shifty, stridey);
+
+            rocblas_gemvn_tiny_batched_kernel_calc<NB>(
+                m, n, alpha, A, lda, x, incx, beta, y, incy);
+        }
+        __syncthreads(); // shared x is reused by the next batch element
+    }
+}
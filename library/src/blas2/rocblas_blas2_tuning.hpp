@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+// Central per-architecture launch tuning for the level-2 dispatches. The
+// launchers in rocblas_gemv_kernels.cpp and rocblas_ger_kernels.hpp used to
+// hard-code block shapes and arch checks inline, tuned on gfx906/gfx908, and
+// newer targets inherited those numbers by default. Problem-size thresholds
+// stay in rocblas_level2_threshold.hpp; this header owns the launch shapes.
+//
+// Block shapes that appear as kernel template parameters cannot follow the
+// runtime-detected device, so they live in rocblas_blas2_block_sizes as
+// compile-time constants shared by all targets. Everything that may legally
+// differ at runtime -- kernel eligibility and grid shaping -- is selected
+// from rocblas_blas2_arch_params, keyed by the Processor enum, so tuning a
+// new target is a table entry instead of another inline arch branch.
+
+template <typename T>
+struct rocblas_blas2_block_sizes
+{
+    static constexpr bool is_float = std::is_same_v<T, float>;
+
+    // general gemv (non-transpose): default shape, the 512 threads/block
+    // variant used when it fits the whole problem, and the tall-skinny shape
+    static constexpr int gemvn_dim_x        = 64;
+    static constexpr int gemvn_dim_y        = 16;
+    static constexpr int gemvn_dim_x_512    = 32;
+    static constexpr int gemvn_dim_y_512    = 16;
+    static constexpr int gemvn_dim_y_skinny = 4;
+
+    // wave32 parts (gfx10/11/12): the x block follows the native wavefront so
+    // a row group is one wavefront, mirroring the warp-size selection already
+    // done in the dot and gbmv dispatches for these architectures
+    static constexpr int gemvn_dim_x_wave32 = 32;
+    static constexpr int gemvn_dim_y_wave32 = 16;
+
+    // double-buffered gemv: threads along y; the x block is rocblas_gemv_bx()
+    static constexpr int gemv_db_thread_y = is_float ? 8 : 4;
+
+    // double-buffered rank-1 update; only valid when the row count is a
+    // multiple of ger_db_dim_x
+    static constexpr int ger_db_dim_x = is_float ? 128 : 64;
+    static constexpr int ger_db_dim_y = is_float ? 8 : 16;
+};
+
+struct rocblas_blas2_arch_param
+{
+    bool        ger_double_buffered; // double-buffered rank-1 kernel is profitable
+    rocblas_int ger_db_min_m; // minimum square size where it wins
+    rocblas_int gemvn_db_block_y; // grid blocks along y, double-buffered gemv (non-transpose)
+    rocblas_int gemvt_db_block_y; // grid blocks along y, double-buffered gemv (transpose)
+};
+
+template <typename T>
+constexpr rocblas_blas2_arch_param rocblas_blas2_arch_params(Processor arch)
+{
+    constexpr bool is_float = std::is_same_v<T, float>;
+
+    // defaults hold for the gfx906/gfx908-era parts the kernels were tuned on
+    rocblas_blas2_arch_param p{};
+    p.ger_double_buffered = false;
+    p.ger_db_min_m        = 2000;
+    p.gemvn_db_block_y    = 8;
+    p.gemvt_db_block_y    = is_float ? 8 : 16;
+
+    switch(arch)
+    {
+    case Processor::gfx90a:
+        p.ger_double_buffered = true;
+        p.gemvn_db_block_y    = 16; // 104 CUs: split columns wider to fill the device
+        break;
+    case Processor::gfx940:
+    case Processor::gfx941:
+    case Processor::gfx942:
+        p.ger_double_buffered = true; // profits as on gfx90a
+        p.gemvn_db_block_y    = 16; // MI300-class CU counts
+        p.gemvt_db_block_y    = 16;
+        break;
+    default:
+        break;
+    }
+    return p;
+}
+
+// Batch-level column-split gemvn (see rocblas_gemvn_n_split_count in
+// rocblas_gemv_kernels.cpp): shape limits and grid target for the atomic
+// n-split scheduling variant. Slices must keep enough columns each that the
+// atomic finalize stays a small fraction of the reduction.
+constexpr rocblas_int c_gemvn_n_split_max_m    = 512;
+constexpr rocblas_int c_gemvn_n_split_min_n    = 1024;
+constexpr rocblas_int c_gemvn_n_split_min_cols = 256;
+constexpr rocblas_int c_gemvn_n_split_waves    = 4;
@@ -23,6 +23,7 @@
 #include "check_numerics_matrix.hpp"
 #include "check_numerics_vector.hpp"
 #include "rocblas_gbmv.hpp"
+#include "rocblas_level2_threshold.hpp"
 
 // uses shuffle reductions
 #include "../blas1/rocblas_reduction.hpp"
@@ -165,6 +166,133 @@ __forceinline__ __device__ void rocblas_gbmvt_kernel_calc(rocblas_operation tran
     }
 }
 
+/**
+  *  Narrow-band non-transpose variant: one thread per output row. For bands of
+  *  at most NBANDS elements a full warp per row leaves most lanes idle, so each
+  *  thread instead walks its own band window; NBANDS bounds the trip count at
+  *  compile time so the loop is fully unrolled and the x window stays in
+  *  registers.
+  */
+// One output row of the narrow-band non-transpose product, with the band loop
+// unrolled via NBANDS so the x window stays in registers
+template <int NBANDS, typename T>
+ROCBLAS_KERNEL_ILF T rocblas_gbmvn_band_row(
+    rocblas_int row, rocblas_int n, rocblas_int kl, rocblas_int ku, const T* A, int64_t lda, const T* x, int64_t incx)
+{
+    T res_A = T(0);
+
+    int brow = row + ku;
+    if(brow > kl + ku)
+        brow = kl + ku;
+
+    int bcol = row - kl;
+    if(bcol < 0)
+        bcol = 0;
+
+#pragma unroll
+    for(int b = 0; b < NBANDS; b++)
+    {
+        if(b <= brow && bcol + b < n)
+            res_A += A[(brow - b) + (bcol + b) * lda] * x[(bcol + b) * incx];
+    }
+    return res_A;
+}
+
+template <int NB, int NBANDS, typename T>
+__forceinline__ __device__ void rocblas_gbmvn_band_kernel_calc(rocblas_int m,
+                                                               rocblas_int n,
+                                                               rocblas_int kl,
+                                                               rocblas_int ku,
+                                                               T           alpha,
+                                                               const T*    A,
+                                                               int64_t     lda,
+                                                               const T*    x,
+                                                               int64_t     incx,
+                                                               T           beta,
+                                                               T*          y,
+                                                               int64_t     incy)
+{
+    rocblas_int row = blockIdx.x * NB + threadIdx.x;
+    if(row >= m)
+        return;
+
+    T res_A = T(0);
+
+    if(alpha)
+        res_A = alpha * rocblas_gbmvn_band_row<NBANDS>(row, n, kl, ku, A, lda, x, incx);
+
+    if(beta != 0)
+        y[row * incy] = res_A + beta * y[row * incy];
+    else
+        y[row * incy] = res_A;
+}
+
+/**
+  *  Narrow-band (conjugate-)transpose variant: one thread per output column,
+  *  reading the band column contiguously with the loop unrolled via NBANDS.
+  */
+// One output column of the narrow-band (conjugate-)transpose product, reading
+// the band column contiguously with the loop unrolled via NBANDS
+template <int NBANDS, typename T>
+ROCBLAS_KERNEL_ILF T rocblas_gbmvt_band_col(bool        is_conj,
+                                            rocblas_int col,
+                                            rocblas_int m,
+                                            rocblas_int kl,
+                                            rocblas_int ku,
+                                            const T*    A,
+                                            int64_t     lda,
+                                            const T*    x,
+                                            int64_t     incx)
+{
+    T res_A(0);
+
+    A += col * lda;
+
+#pragma unroll
+    for(int row = 0; row < NBANDS; row++)
+    {
+        int ku_minus_row = ku - row;
+        if(row <= kl + ku && col < (m + ku_minus_row) && (row > ku || col >= ku_minus_row))
+        {
+            res_A += ((is_conj ? conj(A[row]) : A[row]) * x[(col - ku_minus_row) * incx]);
+        }
+    }
+    return res_A;
+}
+
+template <int NB, int NBANDS, typename T>
+__forceinline__ __device__ void rocblas_gbmvt_band_kernel_calc(rocblas_operation transA,
+                                                               rocblas_int       m,
+                                                               rocblas_int       n,
+                                                               rocblas_int       kl,
+                                                               rocblas_int       ku,
+                                                               T                 alpha,
+                                                               const T*          A,
+                                                               int64_t           lda,
+                                                               const T*          x,
+                                                               int64_t           incx,
+                                                               T                 beta,
+                                                               T*                y,
+                                                               int64_t           incy)
+{
+    rocblas_int col = blockIdx.x * NB + threadIdx.x;
+    if(col >= n)
+        return;
+
+    T res_A(0);
+
+    if(alpha)
+    {
+        bool is_conj = transA == rocblas_operation_conjugate_transpose;
+        res_A = alpha * rocblas_gbmvt_band_col<NBANDS>(is_conj, col, m, kl, ku, A, lda, x, incx);
+    }
+
+    if(beta != 0)
+        y[col * incy] = res_A + beta * y[col * incy];
+    else
+        y[col * incy] = res_A;
+}
+
 /**
   *  Loads pointers (in case of future batched versions) and launches
   *  the actual calculation kernel.
@@ -267,6 +395,206 @@ rocblas_gbmvt_kernel(bool              host_ptr_mode,
         transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <int NB, int NBANDS, typename TStruct, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_gbmvn_band_kernel(bool           host_ptr_mode,
+                          rocblas_int    m,
+                          rocblas_int    n,
+                          rocblas_int    kl,
+                          rocblas_int    ku,
+                          TStruct        alpha_device_host,
+                          V              Aa,
+                          rocblas_stride shifta,
+                          int64_t        lda,
+                          rocblas_stride strideA,
+                          V              xa,
+                          rocblas_stride shiftx,
+                          int64_t        incx,
+                          rocblas_stride stridex,
+                          TStruct        beta_device_host,
+                          W              ya,
+                          rocblas_stride shifty,
+                          int64_t        incy,
+                          rocblas_stride stridey)
+{
+    const auto alpha = host_ptr_mode ? alpha_device_host.value
+                                     : load_scalar(alpha_device_host.ptr, blockIdx.y, 0);
+    const auto beta
+        = host_ptr_mode ? beta_device_host.value : load_scalar(beta_device_host.ptr, blockIdx.y, 0);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_gbmvn_band_kernel_calc<NB, NBANDS>(m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <int NB, int NBANDS, typename TStruct, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_gbmvt_band_kernel(bool              host_ptr_mode,
+                          rocblas_operation transA,
+                          rocblas_int       m,
+                          rocblas_int       n,
+                          rocblas_int       kl,
+                          rocblas_int       ku,
+                          TStruct           alpha_device_host,
+                          V                 Aa,
+                          rocblas_stride    shifta,
+                          int64_t           lda,
+                          rocblas_stride    strideA,
+                          V                 xa,
+                          rocblas_stride    shiftx,
+                          int64_t           incx,
+                          rocblas_stride    stridex,
+                          TStruct           beta_device_host,
+                          W                 ya,
+                          rocblas_stride    shifty,
+                          int64_t           incy,
+                          rocblas_stride    stridey)
+{
+    const auto alpha = host_ptr_mode ? alpha_device_host.value
+                                     : load_scalar(alpha_device_host.ptr, blockIdx.y, 0);
+    const auto beta
+        = host_ptr_mode ? beta_device_host.value : load_scalar(beta_device_host.ptr, blockIdx.y, 0);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_gbmvt_band_kernel_calc<NB, NBANDS>(
+        transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+/**
+  *  Large-batch narrow-band variant: each wavefront processes one whole batch
+  *  instance, its lanes striding over that instance's output rows with the
+  *  band held in registers. Thousands of small independent systems then fill
+  *  the device from a single launch instead of one mostly-idle block per
+  *  batch instance in grid.y.
+  */
+template <int NB, int WF, int NBANDS, typename TStruct, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_gbmvn_band_wf_kernel(bool           host_ptr_mode,
+                             rocblas_int    m,
+                             rocblas_int    n,
+                             rocblas_int    kl,
+                             rocblas_int    ku,
+                             TStruct        alpha_device_host,
+                             V              Aa,
+                             rocblas_stride shifta,
+                             int64_t        lda,
+                             rocblas_stride strideA,
+                             V              xa,
+                             rocblas_stride shiftx,
+                             int64_t        incx,
+                             rocblas_stride stridex,
+                             TStruct        beta_device_host,
+                             W              ya,
+                             rocblas_stride shifty,
+                             int64_t        incy,
+                             rocblas_stride stridey,
+                             rocblas_int    batch_count)
+{
+    uint32_t batch = blockIdx.x * (NB / WF) + threadIdx.x / WF;
+    if(batch >= uint32_t(batch_count))
+        return;
+
+    const auto alpha
+        = host_ptr_mode ? alpha_device_host.value : load_scalar(alpha_device_host.ptr, batch, 0);
+    const auto beta
+        = host_ptr_mode ? beta_device_host.value : load_scalar(beta_device_host.ptr, batch, 0);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, batch, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, batch, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, batch, shifty, stridey);
+
+    using T = std::decay_t<decltype(alpha)>;
+
+    for(rocblas_int row = threadIdx.x % WF; row < m; row += WF)
+    {
+        T res_A = T(0);
+
+        if(alpha)
+            res_A = alpha * rocblas_gbmvn_band_row<NBANDS>(row, n, kl, ku, A, lda, x, incx);
+
+        if(beta != 0)
+            y[row * incy] = res_A + beta * y[row * incy];
+        else
+            y[row * incy] = res_A;
+    }
+}
+
+template <int NB, int WF, int NBANDS, typename TStruct, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_gbmvt_band_wf_kernel(bool              host_ptr_mode,
+                             rocblas_operation transA,
+                             rocblas_int       m,
+                             rocblas_int       n,
+                             rocblas_int       kl,
+                             rocblas_int       ku,
+                             TStruct           alpha_device_host,
+                             V                 Aa,
+                             rocblas_stride    shifta,
+                             int64_t           lda,
+                             rocblas_stride    strideA,
+                             V                 xa,
+                             rocblas_stride    shiftx,
+                             int64_t           incx,
+                             rocblas_stride    stridex,
+                             TStruct           beta_device_host,
+                             W                 ya,
+                             rocblas_stride    shifty,
+                             int64_t           incy,
+                             rocblas_stride    stridey,
+                             rocblas_int       batch_count)
+{
+    uint32_t batch = blockIdx.x * (NB / WF) + threadIdx.x / WF;
+    if(batch >= uint32_t(batch_count))
+        return;
+
+    const auto alpha
+        = host_ptr_mode ? alpha_device_host.value : load_scalar(alpha_device_host.ptr, batch, 0);
+    const auto beta
+        = host_ptr_mode ? beta_device_host.value : load_scalar(beta_device_host.ptr, batch, 0);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, batch, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, batch, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, batch, shifty, stridey);
+
+    using T = std::decay_t<decltype(alpha)>;
+
+    bool is_conj = transA == rocblas_operation_conjugate_transpose;
+
+    for(rocblas_int col = threadIdx.x % WF; col < n; col += WF)
+    {
+        T res_A = T(0);
+
+        if(alpha)
+            res_A = alpha * rocblas_gbmvt_band_col<NBANDS>(is_conj, col, m, kl, ku, A, lda, x, incx);
+
+        if(beta != 0)
+            y[col * incy] = res_A + beta * y[col * incy];
+        else
+            y[col * incy] = res_A;
+    }
+}
+
 /**
   *  Here, U is either a `const T* const*` or a `const T*`
   *  V is either a `T*` or a `T* const*`
@@ -329,7 +657,62 @@ rocblas_status rocblas_internal_gbmv_launcher(rocblas_handle    handle,
 
     if(transA == rocblas_operation_none)
     {
-        if(is_arch_10_or_11_or_12)
+        if(kl + ku < banded_narrow_band_window
+           && m <= banded_wavefront_batched_dim_threshold
+           && batch_count >= banded_wavefront_batched_count_threshold)
+        {
+            // many small systems: one wavefront per batch instance
+            static constexpr int NB = 256;
+            dim3                 gbmvn_threads(NB);
+
+            if(is_arch_10_or_11_or_12)
+            {
+                static constexpr int WF = 32;
+                dim3 gbmvn_grid((batch_count - 1) / (NB / WF) + 1);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_gbmvn_band_wf_kernel<NB, WF, banded_narrow_band_window>),
+                    gbmvn_grid,
+                    gbmvn_threads,
+                    0,
+                    handle->get_stream(),
+                    host_ptr_mode,
+                    GBMV_COMMON_ARGS,
+                    batch_count);
+            }
+            else
+            {
+                static constexpr int WF = 64;
+                dim3 gbmvn_grid((batch_count - 1) / (NB / WF) + 1);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_gbmvn_band_wf_kernel<NB, WF, banded_narrow_band_window>),
+                    gbmvn_grid,
+                    gbmvn_threads,
+                    0,
+                    handle->get_stream(),
+                    host_ptr_mode,
+                    GBMV_COMMON_ARGS,
+                    batch_count);
+            }
+        }
+        else if(kl + ku < banded_narrow_band_window)
+        {
+            // narrow band: one thread per row with the band loop fully unrolled
+            static constexpr int NB     = 256;
+            rocblas_int          blocks = (m - 1) / NB + 1;
+            dim3                 gbmvn_grid(blocks, batch_count);
+            dim3                 gbmvn_threads(NB);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gbmvn_band_kernel<NB, banded_narrow_band_window>),
+                                  gbmvn_grid,
+                                  gbmvn_threads,
+                                  0,
+                                  handle->get_stream(),
+                                  host_ptr_mode,
+                                  GBMV_COMMON_ARGS);
+        }
+        else if(is_arch_10_or_11_or_12)
         {
             static constexpr int WARP        = 32; // warp size as using warp reduce for bands
             static constexpr int GBMVN_DIM_Y = 32; // problem sub block
@@ -364,7 +747,65 @@ rocblas_status rocblas_internal_gbmv_launcher(rocblas_handle    handle,
     }
     else // trans/conj
     {
-        if(is_arch_10_or_11_or_12)
+        if(kl + ku < banded_narrow_band_window
+           && n <= banded_wavefront_batched_dim_threshold
+           && batch_count >= banded_wavefront_batched_count_threshold)
+        {
+            // many small systems: one wavefront per batch instance
+            static constexpr int NB = 256;
+            dim3                 gbmvt_threads(NB);
+
+            if(is_arch_10_or_11_or_12)
+            {
+                static constexpr int WF = 32;
+                dim3 gbmvt_grid((batch_count - 1) / (NB / WF) + 1);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_gbmvt_band_wf_kernel<NB, WF, banded_narrow_band_window>),
+                    gbmvt_grid,
+                    gbmvt_threads,
+                    0,
+                    handle->get_stream(),
+                    host_ptr_mode,
+                    transA,
+                    GBMV_COMMON_ARGS,
+                    batch_count);
+            }
+            else
+            {
+                static constexpr int WF = 64;
+                dim3 gbmvt_grid((batch_count - 1) / (NB / WF) + 1);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_gbmvt_band_wf_kernel<NB, WF, banded_narrow_band_window>),
+                    gbmvt_grid,
+                    gbmvt_threads,
+                    0,
+                    handle->get_stream(),
+                    host_ptr_mode,
+                    transA,
+                    GBMV_COMMON_ARGS,
+                    batch_count);
+            }
+        }
+        else if(kl + ku < banded_narrow_band_window)
+        {
+            // narrow band: one thread per column with the band loop fully unrolled
+            static constexpr int NB     = 256;
+            rocblas_int          blocks = (n - 1) / NB + 1;
+            dim3                 gbmvt_grid(blocks, batch_count);
+            dim3                 gbmvt_threads(NB);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gbmvt_band_kernel<NB, banded_narrow_band_window>),
+                                  gbmvt_grid,
+                                  gbmvt_threads,
+                                  0,
+                                  handle->get_stream(),
+                                  host_ptr_mode,
+                                  transA,
+                                  GBMV_COMMON_ARGS);
+        }
+        else if(is_arch_10_or_11_or_12)
         {
             static constexpr int WARP        = 32; // warp size as using warp reduce for bands
             static constexpr int GBMVT_DIM_Y = 32; // problem sub block
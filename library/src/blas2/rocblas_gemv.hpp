@@ -101,7 +101,8 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                               int64_t           incy,
                                               rocblas_stride    stridey,
                                               rocblas_int       batch_count,
-                                              Tex*              workspace = nullptr);
+                                              Tex*              workspace           = nullptr,
+                                              bool              force_deterministic = false);
 
 template <typename T>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
@@ -21,6 +21,7 @@
  * ************************************************************************ */
 #pragma once
 
+#include "cpu_overhead.hpp"
 #include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas_gemv.hpp"
@@ -55,13 +56,16 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_internal_cpu_overhead_timer overhead_timer(handle,
+                                                           rocblas_internal_cpu_family_blas2);
+
         size_t dev_bytes
             = ROCBLAS_API(rocblas_internal_gemv_kernel_workspace_size)<T>(transA, m, n, 1);
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
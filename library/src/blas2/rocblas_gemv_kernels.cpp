@@ -25,6 +25,7 @@
 #include "gemv_device.hpp"
 #include "handle.hpp"
 #include "int64_helpers.hpp"
+#include "rocblas_blas2_tuning.hpp"
 #include "rocblas_gemv.hpp"
 #include "rocblas_level2_threshold.hpp"
 
@@ -84,6 +85,39 @@ inline bool rocblas_gemvt_skinny_n(rocblas_operation transA, rocblas_int m, rocb
         return false;
 }
 
+// With atomics allowed the split-m partial sums can be accumulated directly
+// into y, so the split pays off at much lower m/n ratios and much wider n
+// than the workspace algorithm, and needs neither the workspace nor the
+// reduction launch
+inline bool rocblas_gemvt_atomic_m_split(rocblas_operation transA, rocblas_int m, rocblas_int n)
+{
+    const size_t split_ratio = 32;
+    return transA != rocblas_operation_none && size_t(m) >= split_ratio * size_t(n)
+           && rocblas_gemvt_sn_kernel_block_count(m) > 1;
+}
+
+// Number of column slices for the batch-level n-split gemvn path: small-m
+// wide-n batches whose row blocks underfill the device split their column
+// reduction across extra workgroups that accumulate into y with atomics,
+// keeping at least c_gemvn_n_split_min_cols columns per slice. Returns 1
+// when the plain kernel already fills the device.
+inline rocblas_int rocblas_gemvn_n_split_count(
+    rocblas_handle handle, rocblas_int dim_x, rocblas_int m, rocblas_int n, rocblas_int batch_count)
+{
+    if(m > c_gemvn_n_split_max_m || n < c_gemvn_n_split_min_n || batch_count < 2)
+        return 1;
+
+    int64_t blocks = int64_t((m - 1) / (dim_x * 4) + 1) * batch_count;
+    int64_t target = int64_t(handle->getCUCount()) * c_gemvn_n_split_waves;
+    if(blocks <= 0 || blocks >= target)
+        return 1;
+
+    int64_t splits = (target + blocks - 1) / blocks;
+    splits         = std::min<int64_t>(splits, n / c_gemvn_n_split_min_cols);
+    splits         = std::min<int64_t>(splits, 65535); // gridDim.y limit
+    return splits > 1 ? rocblas_int(splits) : 1;
+}
+
 /*! \brief rocblas_internal_gemv_kernel_workspace_size
     Currently only transpose/conj skinny n matrices use workspace memory, so usually returns 0
     Work buffer for column reductions: number of blocks * cols * batch_count
@@ -137,7 +171,8 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                               int64_t           incy,
                                               rocblas_stride    stridey,
                                               rocblas_int       batch_count,
-                                              Tex*              workspace)
+                                              Tex*              workspace,
+                                              bool              force_deterministic)
 {
     //quick return
     if(!m || !n || !batch_count)
@@ -172,7 +207,8 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
         = std::is_same_v<
               Ti,
               rocblas_double_complex> || std::is_same_v<Ti, rocblas_double_complex const*>;
-    const bool is_atomics_allowed = handle->atomics_mode == rocblas_atomics_allowed ? true : false;
+    const bool is_atomics_allowed
+        = !force_deterministic && handle->atomics_mode == rocblas_atomics_allowed;
 
     //Identifying the architecture to have an appropriate optimization
     int  arch_major = handle->getArchMajor();
@@ -224,13 +260,103 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                     gemvn_sm_mn_batched_KARGS(*alpha, *beta));
             }
 #undef gemvn_sm_mn_batched_KARGS
+        }
+        else if(!i64_incs && m <= gemvn_tiny_batched_mn_threshold
+                && n <= gemvn_tiny_batched_mn_threshold
+                && batch_count >= gemvn_tiny_batched_count_threshold)
+        {
+            // tiny problems in large batches: one workgroup per batch element,
+            // iterating batches grid-stride
+            static constexpr int GEMVN_TINY_BATCHED_NB = 64;
+            dim3 gemvn_tiny_batched_grid(std::min(batch_count, gemvn_tiny_batched_max_blocks));
+            dim3 gemvn_tiny_batched_threads(GEMVN_TINY_BATCHED_NB);
+
+#define gemvn_tiny_batched_KARGS(alpha_, beta_)                                                  \
+    gemvn_tiny_batched_grid, gemvn_tiny_batched_threads, 0, rocblas_stream, m, n, alpha_,        \
+        stride_alpha, A, offseta, lda, strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, \
+        shifty, incy, stridey, batch_count
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_tiny_batched_kernel<GEMVN_TINY_BATCHED_NB>),
+                                      gemvn_tiny_batched_KARGS(alpha, beta));
+            }
+            else
+            {
+                if(!*alpha && *beta == 1)
+                    return rocblas_status_success;
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_tiny_batched_kernel<GEMVN_TINY_BATCHED_NB>),
+                                      gemvn_tiny_batched_KARGS(*alpha, *beta));
+            }
+#undef gemvn_tiny_batched_KARGS
+        }
+        else if(n <= gemvn_skinny_n_threshold && m >= gemvn_skinny_m_threshold)
+        {
+            // tall skinny shapes: one thread per row, columns unrolled at compile time
+            static constexpr int GEMVN_SKINNY_NB = 256;
+            dim3 gemvn_skinny_grid((m - 1) / GEMVN_SKINNY_NB + 1, batch_count);
+            dim3 gemvn_skinny_threads(GEMVN_SKINNY_NB);
+
+#define gemvn_skinny_KARGS(alpha_, beta_)                                                         \
+    gemvn_skinny_grid, gemvn_skinny_threads, 0, rocblas_stream, m, alpha_, stride_alpha, A,       \
+        offseta, lda, strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy,     \
+        stridey
+
+#define gemvn_skinny_CASE(N_, T_Index_, alpha_, beta_)                                      \
+    case N_:                                                                                \
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_skinny_kernel<GEMVN_SKINNY_NB, N_, T_Index_>), \
+                              gemvn_skinny_KARGS(alpha_, beta_));                           \
+        break;
+
+#define gemvn_skinny_SWITCH(T_Index_, alpha_, beta_)     \
+    switch(n)                                            \
+    {                                                    \
+        gemvn_skinny_CASE(1, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(2, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(3, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(4, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(5, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(6, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(7, T_Index_, alpha_, beta_)    \
+        gemvn_skinny_CASE(8, T_Index_, alpha_, beta_)    \
+    }
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                if(!i64_indices)
+                {
+                    gemvn_skinny_SWITCH(rocblas_int, alpha, beta)
+                }
+                else
+                {
+                    gemvn_skinny_SWITCH(int64_t, alpha, beta)
+                }
+            }
+            else
+            {
+                if(!*alpha && *beta == 1)
+                    return rocblas_status_success;
+
+                if(!i64_indices)
+                {
+                    gemvn_skinny_SWITCH(rocblas_int, *alpha, *beta)
+                }
+                else
+                {
+                    gemvn_skinny_SWITCH(int64_t, *alpha, *beta)
+                }
+            }
+#undef gemvn_skinny_SWITCH
+#undef gemvn_skinny_CASE
+#undef gemvn_skinny_KARGS
         }
         else if(n <= 128 && m >= 2048 * n)
         {
             // skinny tuned block size
 
-            static constexpr int GEMVN_DIM_X = 64;
-            static constexpr int GEMVN_DIM_Y = 4;
+            static constexpr int GEMVN_DIM_X = rocblas_blas2_block_sizes<Tex>::gemvn_dim_x;
+            static constexpr int GEMVN_DIM_Y = rocblas_blas2_block_sizes<Tex>::gemvn_dim_y_skinny;
             rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
             if(std::is_same_v<Tex, rocblas_double_complex>)
                 blocks = (m - 1) / (GEMVN_DIM_X) + 1;
@@ -261,13 +387,17 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                           gemvn_KARGS(*alpha, *beta));
             }
         }
-        //optimized gemvn kernel with double buffered loads for gfx90a.
+        //optimized gemvn kernel with double buffered loads for gfx908, gfx90a and gfx942.
         else if(!i64_incs && is_atomics_allowed && (is_float || is_double) && (m == n)
                 && (m % rocblas_gemv_bx() == 0)
                 && (is_gfx90a
                     || (is_gfx942
                         && ((is_float && m < sgemvn_gfx942_double_buffered_higher_threshold)
-                            || (is_double && n < dgemvn_gfx942_double_buffered_higher_threshold)))))
+                            || (is_double && n < dgemvn_gfx942_double_buffered_higher_threshold)))
+                    || (is_gfx908
+                        && ((is_float && m >= sgemvn_gfx908_double_buffered_lower_threshold)
+                            || (is_double
+                                && m >= dgemvn_gfx908_double_buffered_lower_threshold)))))
         {
             if constexpr(is_float || is_double)
             {
@@ -313,11 +443,12 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
         strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey
 
                 // The following kernel does the `y += A * x` computation
-                static constexpr int thread_x            = rocblas_gemv_bx();
-                static constexpr int block_y             = 8;
-                static constexpr int thread_y            = is_float ? 8 : 4;
+                static constexpr int thread_x = rocblas_gemv_bx();
+                static constexpr int thread_y = rocblas_blas2_block_sizes<Tex>::gemv_db_thread_y;
                 static constexpr int elements_per_thread = thread_x / (2 * thread_y);
 
+                const int block_y = rocblas_blas2_arch_params<Tex>(Processor(handle->getArch()))
+                                        .gemvn_db_block_y;
                 const int block_x = m / thread_x;
                 dim3      gemvn_threads(thread_x, thread_y);
                 dim3      gemvn_grid(block_x, block_y, batch_count);
@@ -344,6 +475,91 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
             }
 #undef gemvn_double_buffered_KARGS
         }
+        // batch-level column split: small-m wide-n strided batches map to a
+        // handful of row blocks and leave most CUs idle, so slice each
+        // problem's column reduction across extra workgroups that accumulate
+        // into y with atomics after a beta-scale pass
+        else if(!i64_incs && is_atomics_allowed && (is_float || is_double)
+                && rocblas_gemvn_n_split_count(
+                       handle, rocblas_blas2_block_sizes<Tex>::gemvn_dim_x, m, n, batch_count)
+                       > 1)
+        {
+            if constexpr(is_float || is_double)
+            {
+                static constexpr int GEMVN_DIM_X = rocblas_blas2_block_sizes<Tex>::gemvn_dim_x;
+                static constexpr int GEMVN_DIM_Y = rocblas_blas2_block_sizes<Tex>::gemvn_dim_y;
+
+                const rocblas_int splits
+                    = rocblas_gemvn_n_split_count(handle, GEMVN_DIM_X, m, n, batch_count);
+                rocblas_int blocks = (m - 1) / (GEMVN_DIM_X * 4) + 1;
+                dim3        gemvn_grid(blocks, splits, batch_count);
+                dim3        gemvn_threads(GEMVN_DIM_X, GEMVN_DIM_Y);
+
+                // The rocblas_gemv_scal_kernel does the `y = y*beta` computation
+                static constexpr int NB_scal          = 256;
+                const int            gemv_scal_blocks = (m - 1) / NB_scal + 1;
+                dim3                 scal_grid(gemv_scal_blocks, batch_count);
+                dim3                 scal_threads(NB_scal);
+
+#define gemvn_n_split_KARGS(alpha_)                                                            \
+    gemvn_grid, gemvn_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
+        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey
+
+                if(handle->pointer_mode == rocblas_pointer_mode_device)
+                {
+                    ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_scal_kernel<NB_scal>),
+                                          scal_grid,
+                                          scal_threads,
+                                          0,
+                                          rocblas_stream,
+                                          m,
+                                          beta,
+                                          stride_beta,
+                                          y,
+                                          shifty,
+                                          incy,
+                                          stridey);
+
+                    if(!i64_indices)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvn_n_split_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, rocblas_int>),
+                            gemvn_n_split_KARGS(alpha));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvn_n_split_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, int64_t>),
+                            gemvn_n_split_KARGS(alpha));
+                }
+                else
+                {
+                    if(!*alpha && *beta == 1)
+                        return rocblas_status_success;
+
+                    if(*beta != 1)
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_scal_kernel<NB_scal>),
+                                              scal_grid,
+                                              scal_threads,
+                                              0,
+                                              rocblas_stream,
+                                              m,
+                                              *beta,
+                                              stride_beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey);
+
+                    if(!i64_indices)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvn_n_split_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, rocblas_int>),
+                            gemvn_n_split_KARGS(*alpha));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvn_n_split_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, int64_t>),
+                            gemvn_n_split_KARGS(*alpha));
+                }
+#undef gemvn_n_split_KARGS
+            }
+        }
         //optimized gemvn kernel with 512 threads/block for gfx906, gfx908, gfx90a, gfx942 and gfx11xx.
         // When(m < 2*n) should use 512 threads/block for gfx90a, gfx942 and gfx11xx.
         else if(((is_gfx11xx || is_gfx90a || is_gfx942) && (m < 2 * n))
@@ -363,8 +579,44 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                 || (m <= dgemvn_gfx906_upper_threshold
                                     && n <= dgemvn_gfx906_upper_threshold))))))
         {
-            static constexpr int GEMVN_DIM_X = 32;
-            static constexpr int GEMVN_DIM_Y = 16;
+            static constexpr int GEMVN_DIM_X = rocblas_blas2_block_sizes<Tex>::gemvn_dim_x_512;
+            static constexpr int GEMVN_DIM_Y = rocblas_blas2_block_sizes<Tex>::gemvn_dim_y_512;
+            rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
+            if(std::is_same_v<Tex, rocblas_double_complex>)
+                blocks = (m - 1) / (GEMVN_DIM_X) + 1;
+            dim3 gemvn_grid(blocks, batch_count);
+            dim3 gemvn_threads(GEMVN_DIM_X, GEMVN_DIM_Y);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+            {
+                if(!i64_indices)
+                    ROCBLAS_LAUNCH_KERNEL(
+                        (rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, rocblas_int>),
+                        gemvn_KARGS(alpha, beta));
+                else
+                    ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, int64_t>),
+                                          gemvn_KARGS(alpha, beta));
+            }
+            else
+            {
+                if(!*alpha && *beta == 1)
+                    return rocblas_status_success;
+
+                if(!i64_indices)
+                    ROCBLAS_LAUNCH_KERNEL(
+                        (rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, rocblas_int>),
+                        gemvn_KARGS(*alpha, *beta));
+                else
+                    ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, int64_t>),
+                                          gemvn_KARGS(*alpha, *beta));
+            }
+        }
+        //wave32 parts run the general kernel with the x block at the native wavefront;
+        //the wave64-era 64 x 16 shape below leaves half of each row group idle there.
+        else if(is_arch_10_or_11_or_12)
+        {
+            static constexpr int GEMVN_DIM_X = rocblas_blas2_block_sizes<Tex>::gemvn_dim_x_wave32;
+            static constexpr int GEMVN_DIM_Y = rocblas_blas2_block_sizes<Tex>::gemvn_dim_y_wave32;
             rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
             if(std::is_same_v<Tex, rocblas_double_complex>)
                 blocks = (m - 1) / (GEMVN_DIM_X) + 1;
@@ -398,8 +650,8 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
         else
         {
             // GEMVN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
-            static constexpr int GEMVN_DIM_X = 64;
-            static constexpr int GEMVN_DIM_Y = 16;
+            static constexpr int GEMVN_DIM_X = rocblas_blas2_block_sizes<Tex>::gemvn_dim_x;
+            static constexpr int GEMVN_DIM_Y = rocblas_blas2_block_sizes<Tex>::gemvn_dim_y;
             rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
             if(std::is_same_v<Tex, rocblas_double_complex>)
                 blocks = (m - 1) / (GEMVN_DIM_X) + 1;
@@ -499,6 +751,85 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                       stridey);
             }
         }
+        // With atomics allowed the split-m kernel accumulates directly into
+        // y, so neither the workspace nor the reduction launch is needed
+        else if(!i64_incs && is_atomics_allowed && (is_float || is_double)
+                && rocblas_gemvt_atomic_m_split(transA, m, n))
+        {
+            if constexpr(is_float || is_double)
+            {
+                static constexpr int NB     = rocblas_gemvt_sn_NB();
+                static constexpr int WIN    = rocblas_gemvt_sn_WIN();
+                int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
+                dim3                 gemvt_grid(blocks, batch_count);
+                dim3                 gemvt_threads(NB);
+
+                // The rocblas_gemv_scal_kernel does the `y = y*beta` computation
+                static constexpr int NB_scal          = 256;
+                const int            gemv_scal_blocks = (n - 1) / NB_scal + 1;
+                dim3                 scal_grid(gemv_scal_blocks, batch_count);
+                dim3                 scal_threads(NB_scal);
+
+#define gemvt_sn_atomic_KARGS(alpha_)                                                          \
+    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
+        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey
+
+                if(handle->pointer_mode == rocblas_pointer_mode_device)
+                {
+                    ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_scal_kernel<NB_scal>),
+                                          scal_grid,
+                                          scal_threads,
+                                          0,
+                                          rocblas_stream,
+                                          n,
+                                          beta,
+                                          stride_beta,
+                                          y,
+                                          shifty,
+                                          incy,
+                                          stridey);
+
+                    if(!i64_indices)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, rocblas_int>),
+                            gemvt_sn_atomic_KARGS(alpha));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, int64_t>),
+                            gemvt_sn_atomic_KARGS(alpha));
+                }
+                else
+                {
+                    if(!*alpha && *beta == 1)
+                        return rocblas_status_success;
+
+                    if(*beta != 1)
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_scal_kernel<NB_scal>),
+                                              scal_grid,
+                                              scal_threads,
+                                              0,
+                                              rocblas_stream,
+                                              n,
+                                              *beta,
+                                              stride_beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey);
+
+                    if(!i64_indices)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, rocblas_int>),
+                            gemvt_sn_atomic_KARGS(*alpha));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, int64_t>),
+                            gemvt_sn_atomic_KARGS(*alpha));
+                }
+
+#undef gemvt_sn_atomic_KARGS
+            }
+        }
         else if(workspace && rocblas_gemvt_skinny_n<Ti>(transA, m, n))
         {
             static constexpr int NB     = rocblas_gemvt_sn_NB();
@@ -611,11 +942,12 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                               stridey);
                 }
                 // The following kernel does the `y += A * x` computation
-                static constexpr int thread_x            = rocblas_gemv_bx();
-                static constexpr int block_y             = is_float ? 8 : 16;
-                static constexpr int thread_y            = is_float ? 8 : 4;
+                static constexpr int thread_x = rocblas_gemv_bx();
+                static constexpr int thread_y = rocblas_blas2_block_sizes<Tex>::gemv_db_thread_y;
                 static constexpr int elements_per_thread = thread_x / (2 * thread_y);
 
+                const int block_y = rocblas_blas2_arch_params<Tex>(Processor(handle->getArch()))
+                                        .gemvt_db_block_y;
                 const int block_x = n / thread_x;
                 dim3      gemvt_threads(thread_x, thread_y);
                 dim3      gemvt_grid(block_x, block_y, batch_count);
@@ -811,6 +1143,85 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                       stridey);
             }
         }
+        // With atomics allowed the split-m kernel accumulates directly into
+        // y, so neither the workspace nor the reduction launch is needed
+        else if(!i64_incs && is_atomics_allowed && (is_float || is_double)
+                && rocblas_gemvt_atomic_m_split(transA, m, n))
+        {
+            if constexpr(is_float || is_double)
+            {
+                static constexpr int NB     = rocblas_gemvt_sn_NB();
+                static constexpr int WIN    = rocblas_gemvt_sn_WIN();
+                int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
+                dim3                 gemvt_grid(blocks, batch_count);
+                dim3                 gemvt_threads(NB);
+
+                // The rocblas_gemv_scal_kernel does the `y = y*beta` computation
+                static constexpr int NB_scal          = 256;
+                const int            gemv_scal_blocks = (n - 1) / NB_scal + 1;
+                dim3                 scal_grid(gemv_scal_blocks, batch_count);
+                dim3                 scal_threads(NB_scal);
+
+#define gemvt_sn_atomic_KARGS(alpha_)                                                          \
+    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
+        strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey
+
+                if(handle->pointer_mode == rocblas_pointer_mode_device)
+                {
+                    ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_scal_kernel<NB_scal>),
+                                          scal_grid,
+                                          scal_threads,
+                                          0,
+                                          rocblas_stream,
+                                          n,
+                                          beta,
+                                          stride_beta,
+                                          y,
+                                          shifty,
+                                          incy,
+                                          stridey);
+
+                    if(!i64_indices)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, rocblas_int>),
+                            gemvt_sn_atomic_KARGS(alpha));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, int64_t>),
+                            gemvt_sn_atomic_KARGS(alpha));
+                }
+                else
+                {
+                    if(!*alpha && *beta == 1)
+                        return rocblas_status_success;
+
+                    if(*beta != 1)
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_scal_kernel<NB_scal>),
+                                              scal_grid,
+                                              scal_threads,
+                                              0,
+                                              rocblas_stream,
+                                              n,
+                                              *beta,
+                                              stride_beta,
+                                              y,
+                                              shifty,
+                                              incy,
+                                              stridey);
+
+                    if(!i64_indices)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, rocblas_int>),
+                            gemvt_sn_atomic_KARGS(*alpha));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_gemvt_sn_atomic_kernel<CONJ, NB, WIN, int64_t>),
+                            gemvt_sn_atomic_KARGS(*alpha));
+                }
+
+#undef gemvt_sn_atomic_KARGS
+            }
+        }
         else if(workspace && rocblas_gemvt_skinny_n<Ti>(transA, m, n))
         {
             static constexpr int NB     = rocblas_gemvt_sn_NB();
@@ -920,11 +1331,12 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                               stridey);
                 }
                 // The following kernel does the `y += A * x` computation
-                static constexpr int thread_x            = rocblas_gemv_bx();
-                static constexpr int block_y             = is_float ? 8 : 16;
-                static constexpr int thread_y            = is_float ? 8 : 4;
+                static constexpr int thread_x = rocblas_gemv_bx();
+                static constexpr int thread_y = rocblas_blas2_block_sizes<Tex>::gemv_db_thread_y;
                 static constexpr int elements_per_thread = thread_x / (2 * thread_y);
 
+                const int block_y = rocblas_blas2_arch_params<Tex>(Processor(handle->getArch()))
+                                        .gemvt_db_block_y;
                 const int block_x = n / thread_x;
                 dim3      gemvt_threads(thread_x, thread_y);
                 dim3      gemvt_grid(block_x, block_y, batch_count);
@@ -1087,6 +1499,44 @@ rocblas_status rocblas_internal_gemv_batched_template(rocblas_handle    handle,
                                                       rocblas_int       batch_count,
                                                       T*                workspace)
 {
+    // large pointer batches that are really strided take the cheaper strided
+    // addressing path, saving the per-workgroup pointer-array dereferences
+    if(batch_count >= c_batch_stride_detect_min_batch && !handle->is_stream_in_capture_mode())
+    {
+        const T*       A_base;
+        const T*       x_base;
+        T*             y_base;
+        rocblas_stride A_stride, x_stride, y_stride;
+        if(rocblas_internal_uniform_batch_stride(
+               handle->get_stream(), A, batch_count, A_base, A_stride)
+           && rocblas_internal_uniform_batch_stride(
+               handle->get_stream(), x, batch_count, x_base, x_stride)
+           && rocblas_internal_uniform_batch_stride(
+               handle->get_stream(), y, batch_count, y_base, y_stride))
+            return rocblas_internal_gemv_launcher(handle,
+                                                  transA,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  stride_alpha,
+                                                  A_base,
+                                                  offseta,
+                                                  (int64_t)lda,
+                                                  A_stride,
+                                                  x_base,
+                                                  offsetx,
+                                                  (int64_t)incx,
+                                                  x_stride,
+                                                  beta,
+                                                  stride_beta,
+                                                  y_base,
+                                                  offsety,
+                                                  (int64_t)incy,
+                                                  y_stride,
+                                                  batch_count,
+                                                  workspace);
+    }
+
     return rocblas_internal_gemv_launcher(handle,
                                           transA,
                                           m,
@@ -1307,7 +1757,8 @@ INSTANTIATE_GEMV_BATCHED_TEMPLATE(rocblas_double_complex)
                                                        int64_t           incy,         \
                                                        rocblas_stride    stridey,      \
                                                        rocblas_int       batch_count,  \
-                                                       Tex_*             workspace);
+                                                       Tex_*             workspace,    \
+                                                       bool              force_deterministic);
 
 INST_GEMV_MIXED_LAUNCHER(rocblas_half, float, rocblas_half)
 INST_GEMV_MIXED_LAUNCHER(rocblas_half const*, float, rocblas_half* const)
@@ -23,6 +23,7 @@
 #include "check_numerics_matrix.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_blas2_tuning.hpp"
 #include "rocblas_ger.hpp"
 
 template <rocblas_int DIM_X,
@@ -283,19 +284,21 @@ rocblas_status rocblas_internal_ger_launcher(rocblas_handle handle,
     static constexpr bool is_double        = std::is_same_v<T, double>;
     static constexpr bool is_complex_float = std::is_same_v<T, rocblas_float_complex>;
 
-    bool is_gfx90a = handle->getArch() == 910 ? true : false;
+    const auto arch_param = rocblas_blas2_arch_params<T>(Processor(handle->getArch()));
 
 #define ger_KARGS(alpha_)                                                                  \
     ger_grid, ger_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, x, shiftx, incx, \
         stridex, y, shifty, incy, stridey, A, offsetA, lda, strideA
 
-    //optimized double buffered loads kernel for float, double and float_complex precisions in gfx90a
-    if(is_gfx90a && (m > 2000) && (m == n)
-       && ((m % 64 == 0 && (is_double || is_complex_float)) || ((m % 128 == 0) && is_float)))
+    //optimized double buffered loads kernel for float, double and float_complex precisions
+    //on the architectures enabled in rocblas_blas2_tuning.hpp
+    if(arch_param.ger_double_buffered && (m > arch_param.ger_db_min_m) && (m == n)
+       && (m % rocblas_blas2_block_sizes<T>::ger_db_dim_x == 0)
+       && (is_float || is_double || is_complex_float))
     {
         //The following rocblas_ger_double_buffered_kernel is only valid for the multiples of DIM_X
-        static constexpr int DIM_X               = is_float ? 128 : 64;
-        static constexpr int DIM_Y               = is_float ? 8 : 16;
+        static constexpr int DIM_X               = rocblas_blas2_block_sizes<T>::ger_db_dim_x;
+        static constexpr int DIM_Y               = rocblas_blas2_block_sizes<T>::ger_db_dim_y;
         static constexpr int elements_per_thread = DIM_X / (2 * DIM_Y);
 
         const int block_x = m / DIM_X;
@@ -23,6 +23,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_hbmv.hpp"
+#include "rocblas_level2_threshold.hpp"
 
 /**
   *  Helper for the non-transpose case. Iterates through each diagonal
@@ -147,6 +148,69 @@ __device__ void rocblas_hbmvn_kernel_calc(bool        is_upper,
     }
 }
 
+/**
+  *  Narrow-band variant: one thread per output element. The general kernel
+  *  strides its partial-sum columns over all of n, which for a small band
+  *  visits mostly empty columns; here each thread only walks the 2k+1 columns
+  *  that intersect its row, with the loop fully unrolled via the NBANDS bound.
+  *  The imaginary part of the main diagonal is assumed to always be == 0.
+  */
+template <rocblas_int NB, rocblas_int NBANDS, typename T>
+__device__ void rocblas_hbmvn_band_kernel_calc(bool        is_upper,
+                                               rocblas_int n,
+                                               rocblas_int k,
+                                               T           alpha,
+                                               const T*    A,
+                                               int64_t     lda,
+                                               const T*    x,
+                                               int64_t     incx,
+                                               T           beta,
+                                               T*          y,
+                                               int64_t     incy)
+{
+    rocblas_int ind = blockIdx.x * NB + threadIdx.x;
+    if(ind >= n)
+        return;
+
+    if(!alpha)
+    {
+        y[ind * incy] = beta ? y[ind * incy] * beta : 0;
+        return;
+    }
+
+    T res_A = 0.0;
+
+#pragma unroll
+    for(rocblas_int b = 0; b < NBANDS; b++)
+    {
+        rocblas_int col = ind - k + b;
+        if(b <= 2 * k && col >= 0 && col < n)
+        {
+            // only |ind - col| <= k is visited, so the banded row indices below
+            // always land inside the stored band
+            if(col == ind)
+            {
+                // main diagonal, assume 0 imaginary part
+                rocblas_int row = is_upper ? k : 0;
+                res_A += std::real(A[row + col * size_t(lda)]) * x[col * incx];
+            }
+            else if((ind < col && is_upper) || (ind > col && !is_upper))
+            {
+                rocblas_int row = is_upper ? ind + (k - col) : ind - col;
+                res_A += A[row + col * size_t(lda)] * x[col * incx];
+            }
+            else
+            {
+                // in the opposite triangle, get conjugate of value at transposed position
+                rocblas_int trans_row = is_upper ? col + (k - ind) : col - ind;
+                res_A += conj(A[trans_row + ind * size_t(lda)]) * x[col * incx];
+            }
+        }
+    }
+
+    y[ind * incy] = beta ? alpha * res_A + beta * y[ind * incy] : alpha * res_A;
+}
+
 /**
   *  U is either: const T* OR T
   *  V is either: const T* OR const T* const*
@@ -190,6 +254,40 @@ rocblas_hbmvn_kernel(bool           is_upper,
     rocblas_hbmvn_kernel_calc<DIM_X, DIM_Y>(is_upper, n, k, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <rocblas_int NB, rocblas_int NBANDS, typename U, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_hbmvn_band_kernel(bool           is_upper,
+                          rocblas_int    n,
+                          rocblas_int    k,
+                          U              alpha_device_host,
+                          V              Aa,
+                          rocblas_stride shifta,
+                          int64_t        lda,
+                          rocblas_stride strideA,
+                          V              xa,
+                          rocblas_stride shiftx,
+                          int64_t        incx,
+                          rocblas_stride stridex,
+                          U              beta_device_host,
+                          W              ya,
+                          rocblas_stride shifty,
+                          int64_t        incy,
+                          rocblas_stride stridey)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    rocblas_hbmvn_band_kernel_calc<NB, NBANDS>(is_upper, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 /**
   *  TScal is always: const T* (either host or device)
   *  TConstPtr is either: const T* OR const T* const*
@@ -226,6 +324,37 @@ rocblas_status rocblas_internal_hbmv_launcher(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - incx * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - incy * (n - 1) : offsety;
 
+    if(2 * k < banded_narrow_band_window)
+    {
+        // narrow band: one thread per element with the band loop fully unrolled
+        static constexpr int NB          = 256;
+        rocblas_int          band_blocks = (n - 1) / NB + 1;
+        dim3                 band_grid(band_blocks, batch_count);
+        dim3                 band_threads(NB);
+
+#define HBMV_BAND_ARGS(alpha_, beta_)                                                            \
+    band_grid, band_threads, 0, rocblas_stream, uplo == rocblas_fill_upper, n, k, alpha_, A,     \
+        offseta, lda, strideA, x, shiftx, incx, stridex, beta_, y, shifty, incy, stridey
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_hbmvn_band_kernel<NB, banded_narrow_band_window>),
+                                  HBMV_BAND_ARGS(alpha, beta));
+        }
+        else
+        {
+            if(!*alpha && *beta == 1)
+                return rocblas_status_success;
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_hbmvn_band_kernel<NB, banded_narrow_band_window>),
+                                  HBMV_BAND_ARGS(*alpha, *beta));
+        }
+
+#undef HBMV_BAND_ARGS
+
+        return rocblas_status_success;
+    }
+
     // hbmvN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     static constexpr int hbmvN_DIM_X = 64;
     static constexpr int hbmvN_DIM_Y = 16;
@@ -58,7 +58,7 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
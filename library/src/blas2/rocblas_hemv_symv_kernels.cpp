@@ -1180,6 +1180,18 @@ rocblas_hemvn_kernel_lower_block_sum(rocblas_int    n,
 }
 // end hemvn_kernel_lower_block_sum_calc
 
+// Padded leading dimension for the shared tiles of the double-buffered symv
+// kernels below, chosen at compile time from the element size: each column is
+// skewed by one 4-byte LDS bank (expressed in elements of T) so the transposed
+// accesses of the mirror and reduction phases do not stack in a single bank.
+// Float columns become conflict-free; double is reduced to the 2-way minimum
+// its two-phase 8-byte accesses allow.
+template <typename T>
+constexpr rocblas_int rocblas_symv_lds_pad()
+{
+    return (4 / sizeof(T)) > 0 ? rocblas_int(4 / sizeof(T)) : 1;
+}
+
 template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_upper_double_buffered_diagonal_calc(rocblas_int n,
@@ -1200,7 +1212,9 @@ ROCBLAS_KERNEL_ILF void
     T res  = T(0);
     T yold = T(0);
 
-    __shared__ T la[DIM_X * DIM_X];
+    static constexpr rocblas_int ld_la = DIM_X + rocblas_symv_lds_pad<T>();
+
+    __shared__ T la[ld_la * DIM_X];
     __shared__ T buff[DIM_X];
     __shared__ T accum[DIM_X * (2 * DIM_Y)];
 
@@ -1238,7 +1252,7 @@ ROCBLAS_KERNEL_ILF void
     {
 #pragma unroll
         for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
-            la[td + j * DIM_X] = A[j * lda];
+            la[(ty + j) * ld_la + tx] = A[j * lda];
     }
 
     // Advance to second chunk
@@ -1247,7 +1261,7 @@ ROCBLAS_KERNEL_ILF void
 // load second chunk first
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
-        la[DIM_X * ((DIM_X / 2) + j + ty) + tx] = A[j * lda];
+        la[ld_la * ((DIM_X / 2) + j + ty) + tx] = A[j * lda];
 
     __syncthreads();
 
@@ -1255,28 +1269,28 @@ ROCBLAS_KERNEL_ILF void
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > (j + (DIM_X / 2)))
-            la[DIM_X * ((DIM_X / 2) + j + ty) + tx] = la[DIM_X * tx + (DIM_X / 2) + j + ty];
+            la[ld_la * ((DIM_X / 2) + j + ty) + tx] = la[ld_la * tx + (DIM_X / 2) + j + ty];
 
     // mirror first chunk
     if(ty <= tx)
-        la[td] = la[tx * DIM_X + ty];
+        la[ty * ld_la + tx] = la[tx * ld_la + ty];
 
 #pragma unroll
     for(int j = DIM_Y; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > j)
-            la[tx + (ty + j) * DIM_X] = la[ty + j + tx * DIM_X];
+            la[tx + (ty + j) * ld_la] = la[ty + j + tx * ld_la];
 
     __syncthreads();
 
 // compute first chunk
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
-        res += la[(ty + j) * DIM_X + tx] * buff[j + ty];
+        res += la[(ty + j) * ld_la + tx] * buff[j + ty];
 
 // compute second chunk
 #pragma unroll
     for(int j = (DIM_X / 2); j < 2 * (DIM_X / 2); j += DIM_Y)
-        res += la[(ty + j) * DIM_X + tx] * buff[j + ty];
+        res += la[(ty + j) * ld_la + tx] * buff[j + ty];
 
     accum[td] = res;
     __syncthreads();
@@ -1326,7 +1340,9 @@ ROCBLAS_KERNEL_ILF void
     const T* xcopy;
     T*       ycopy;
 
-    __shared__ T la[DIM_X * (DIM_X / 2)];
+    static constexpr rocblas_int ld_la = (DIM_X / 2) + rocblas_symv_lds_pad<T>();
+
+    __shared__ T la[ld_la * DIM_X];
     __shared__ T accum[DIM_X * (2 * DIM_Y)];
     __shared__ T xbuff[DIM_X];
 
@@ -1433,7 +1449,7 @@ ROCBLAS_KERNEL_ILF void
 
 #pragma unroll
     for(int k = 0; k < elements_per_thread; k++)
-        la[(ty_ * elements_per_thread + k) * (DIM_X / 2) + tx_] = treg[k];
+        la[(ty_ * elements_per_thread + k) * ld_la + tx_] = treg[k];
 
     __syncthreads(); // important
 
@@ -1442,7 +1458,7 @@ ROCBLAS_KERNEL_ILF void
         treg[0] = T(0);
 #pragma unroll
         for(int k = tx; k < tx + (DIM_X / 2); k++)
-            treg[0] += la[tx * (DIM_X / 2) + (k % (DIM_X / 2))];
+            treg[0] += la[tx * ld_la + (k % (DIM_X / 2))];
 
         // use atomics
         atomicAdd(&y[tx * incy], treg[0] * alpha);
@@ -1470,7 +1486,9 @@ ROCBLAS_KERNEL_ILF void
     T res  = T(0);
     T yold = T(0);
 
-    __shared__ T la_shared[DIM_X * DIM_X];
+    static constexpr rocblas_int ld_la = DIM_X + rocblas_symv_lds_pad<T>();
+
+    __shared__ T la_shared[ld_la * DIM_X];
     __shared__ T x_buff_shared[DIM_X];
     __shared__ T accum_shared[DIM_X * (2 * DIM_Y)];
 
@@ -1508,7 +1526,7 @@ ROCBLAS_KERNEL_ILF void
     {
 #pragma unroll
         for(int j = 0; j < DIM_X; j += DIM_Y)
-            la_shared[j * DIM_X + td] = T(0);
+            la_shared[(j + ty) * ld_la + tx] = T(0);
 
         if(ty == 0 && tx >= n_mod_DIM_X)
             x_buff_shared[tx] = T(0);
@@ -1522,17 +1540,17 @@ ROCBLAS_KERNEL_ILF void
             int j;
 #pragma unroll
             for(j = 0; j < n_mod_DIM_X / DIM_Y; j++)
-                la_shared[(j * DIM_Y) * DIM_X + td] = A[(j * DIM_Y) * lda];
+                la_shared[(j * DIM_Y + ty) * ld_la + tx] = A[(j * DIM_Y) * lda];
 
             if(ty < (n_mod_DIM_X % DIM_Y))
-                la_shared[(j * DIM_Y) * DIM_X + td] = A[(j * DIM_Y) * lda];
+                la_shared[(j * DIM_Y + ty) * ld_la + tx] = A[(j * DIM_Y) * lda];
         }
     }
     else
     {
 #pragma unroll
         for(int j = 0; j < DIM_X; j += DIM_Y)
-            la_shared[j * DIM_X + td] = A[j * lda];
+            la_shared[(j + ty) * ld_la + tx] = A[j * lda];
     }
     // end of reading a diagonal block of data
 
@@ -1542,29 +1560,29 @@ ROCBLAS_KERNEL_ILF void
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > (j + (DIM_X / 2)))
-            la_shared[DIM_X * ((DIM_X / 2) + j + ty) + tx]
-                = la_shared[DIM_X * tx + (DIM_X / 2) + j + ty];
+            la_shared[ld_la * ((DIM_X / 2) + j + ty) + tx]
+                = la_shared[ld_la * tx + (DIM_X / 2) + j + ty];
 
     // mirror elements in first chunk
     if(ty <= tx)
-        la_shared[td] = la_shared[tx * DIM_X + ty];
+        la_shared[ty * ld_la + tx] = la_shared[tx * ld_la + ty];
 
 #pragma unroll
     for(int j = DIM_Y; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > j)
-            la_shared[tx + (ty + j) * DIM_X] = la_shared[ty + j + tx * DIM_X];
+            la_shared[tx + (ty + j) * ld_la] = la_shared[ty + j + tx * ld_la];
 
     __syncthreads();
 
 // compute first chunk
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
-        res += la_shared[(ty + j) * DIM_X + tx] * x_buff_shared[j + ty];
+        res += la_shared[(ty + j) * ld_la + tx] * x_buff_shared[j + ty];
 
 // compute second chunk
 #pragma unroll
     for(int j = (DIM_X / 2); j < 2 * (DIM_X / 2); j += DIM_Y)
-        res += la_shared[(ty + j) * DIM_X + tx] * x_buff_shared[j + ty];
+        res += la_shared[(ty + j) * ld_la + tx] * x_buff_shared[j + ty];
 
     accum_shared[td] = res;
     __syncthreads();
@@ -1620,7 +1638,9 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
     const T* xcopy;
     T*       ycopy;
 
-    __shared__ T la_shared[DIM_X * (DIM_X / 2)];
+    static constexpr rocblas_int ld_la = (DIM_X / 2) + rocblas_symv_lds_pad<T>();
+
+    __shared__ T la_shared[ld_la * DIM_X];
     __shared__ T accum_shared[DIM_X * (2 * DIM_Y)];
     __shared__ T x_buff_shared[DIM_X];
 
@@ -1667,7 +1687,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
         accum_shared[ty_ * DIM_X + tx_]               = T(0);
         accum_shared[ty_ * DIM_X + tx_ + (DIM_X / 2)] = T(0);
         for(int k = 0; k < elements_per_thread; k++)
-            la_shared[(ty_ * elements_per_thread + k) * (DIM_X / 2) + tx_] = T(0);
+            la_shared[(ty_ * elements_per_thread + k) * ld_la + tx_] = T(0);
     }
     else // not the last TB
     {
@@ -1801,7 +1821,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
 
 #pragma unroll
     for(int k = 0; k < elements_per_thread; k++)
-        la_shared[(ty_ * elements_per_thread + k) * (DIM_X / 2) + tx_] = treg[k];
+        la_shared[(ty_ * elements_per_thread + k) * ld_la + tx_] = treg[k];
 
     __syncthreads();
 
@@ -1810,7 +1830,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
         treg[0] = T(0);
 #pragma unroll
         for(int j = tx; j < tx + (DIM_X / 2); j++)
-            treg[0] += la_shared[tx * (DIM_X / 2) + (j % (DIM_X / 2))];
+            treg[0] += la_shared[tx * ld_la + (j % (DIM_X / 2))];
 
         // use atomics
         if(tx < n_mod_DIM_X || bx < gridDim.x - 1)
@@ -2889,6 +2909,23 @@ rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic(bool           ho
         n, alpha, A, lda, x, incx, y, incy, mod);
 }
 
+// Column-split factor for the atomic double-buffered symv kernels. The
+// historical value of 8 matches the gfx908/gfx90a tuning; when the CU count
+// is known the split is widened so the non-diagonal grid covers the device a
+// few times over even when block_x is small, and stays at 8 for large n
+// where additional splits only add atomic traffic.
+inline rocblas_int rocblas_symv_block_y(rocblas_handle handle, rocblas_int block_x)
+{
+    rocblas_int block_y  = 8;
+    int         cu_count = handle->getCUCount();
+    if(cu_count > 0 && block_x > 0)
+    {
+        rocblas_int occupancy_y = (4 * cu_count - 1) / block_x + 1;
+        block_y                 = std::min(rocblas_int(64), std::max(block_y, occupancy_y));
+    }
+    return block_y;
+}
+
 /**
   *  V is either: const T* OR const T* const*
   *  W is either:       T* OR       T* const*
@@ -2916,7 +2953,8 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
                                                    int64_t        incy,
                                                    rocblas_stride stridey,
                                                    int            batch_count,
-                                                   T*             workspace)
+                                                   T*             workspace,
+                                                   bool           force_deterministic)
 {
     //quick return
     if(!n || !batch_count)
@@ -2938,11 +2976,13 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
     bool i64_indices = size_t(n) * lda > c_i32_max || size_t(n) * std::abs(incx) > c_i32_max
                        || size_t(n) * std::abs(incy) > c_i32_max;
 
-    const bool is_atomics_allowed = handle->atomics_mode == rocblas_atomics_allowed ? true : false;
+    const bool is_atomics_allowed
+        = !force_deterministic && handle->atomics_mode == rocblas_atomics_allowed;
 
     //Identifying the specific architecture to have an appropriate optimization
     bool is_gfx90a = handle->getArch() == 910 ? true : false;
     bool is_gfx908 = handle->getArch() == 908 ? true : false;
+    bool is_gfx94x = handle->getArchMajor() == 9 && handle->getArchMajorMinor() >= 94;
 
     static constexpr int HEMV_DIM_X         = rocblas_hemv_DIM_X();
     static constexpr int HEMV_DIM_Y         = 4;
@@ -2966,9 +3006,10 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
     if(uplo == rocblas_fill_upper)
     {
         if(is_atomics_allowed
-           && ((is_gfx90a
-                && ((is_float && n < ssymv_U_gfx908_gfx90a_higher_threshold)
-                    || (is_double && n < dsymv_U_gfx90a_higher_threshold)))
+           && ((is_gfx94x && (is_float || is_double))
+               || (is_gfx90a
+                   && ((is_float && n < ssymv_U_gfx908_gfx90a_higher_threshold)
+                       || (is_double && n < dsymv_U_gfx90a_higher_threshold)))
                || (is_gfx908
                    && ((is_float && n < ssymv_U_gfx908_gfx90a_higher_threshold)
                        || (is_double
@@ -2981,9 +3022,9 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
             rocblas_internal_val_ptr<T> alpha_device_host(host_ptr_mode, alpha);
             rocblas_internal_val_ptr<T> beta_device_host(host_ptr_mode, beta);
 
-            static constexpr rocblas_int DIM_X   = 32;
-            static constexpr rocblas_int block_y = 8;
-            const rocblas_int            mod     = n % DIM_X;
+            static constexpr rocblas_int DIM_X = 32;
+            const rocblas_int            mod   = n % DIM_X;
+            const rocblas_int block_y = rocblas_symv_block_y(handle, n / DIM_X + (mod != 0));
 
             if constexpr(is_float || is_double)
             {
@@ -3187,7 +3228,7 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
     else
     {
         if(is_atomics_allowed
-           && ((is_gfx908 && (is_float || is_double))
+           && (((is_gfx908 || is_gfx94x) && (is_float || is_double))
                || (is_gfx90a
                    && (((is_float && n < ssymv_L_gfx90a_higher_threshold)
                         || ((n % 32 == 0 && is_double && n < dsymv_L_gfx90a_higher_threshold)
@@ -3198,9 +3239,9 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
             static constexpr rocblas_int DIM_X               = 32;
             static constexpr rocblas_int DIM_Y               = 4;
             static constexpr rocblas_int elements_per_thread = (DIM_X / (2 * DIM_Y));
-            static constexpr rocblas_int block_y             = 8;
             const rocblas_int            mod                 = n % DIM_X;
             const rocblas_int            block_x             = n / DIM_X + (mod != 0);
+            const rocblas_int            block_y             = rocblas_symv_block_y(handle, block_x);
 
             dim3 threads(DIM_X, DIM_Y);
             dim3 grid(block_x, batch_count);
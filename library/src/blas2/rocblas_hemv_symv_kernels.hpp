@@ -45,4 +45,5 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
                                                    int64_t        incy,
                                                    rocblas_stride stridey,
                                                    int            batch_count,
-                                                   T*             workspace);
+                                                   T*             workspace,
+                                                   bool           force_deterministic = false);
@@ -101,6 +101,77 @@ rocblas_her2_kernel(bool           is_upper,
     rocblas_her2_kernel_calc(is_upper, n, area, alpha, x, incx, y, incy, A, lda);
 }
 
+//! Staged batched variant: with many small problems each workgroup loads
+//! both vectors into LDS once and then walks a slab of the linearized
+//! triangle, so the matrix is the only global traffic in the update instead
+//! of x and y being re-read per element.
+template <typename API_INT, int NB, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_her2_staged_kernel(bool           is_upper,
+                           rocblas_int    n,
+                           size_t         area,
+                           TScal          alphaa,
+                           TConstPtr      xa,
+                           rocblas_stride shift_x,
+                           API_INT        incx,
+                           rocblas_stride stride_x,
+                           TConstPtr      ya,
+                           rocblas_stride shift_y,
+                           API_INT        incy,
+                           rocblas_stride stride_y,
+                           TPtr           Aa,
+                           rocblas_stride shift_A,
+                           API_INT        lda,
+                           rocblas_stride stride_A)
+{
+    auto alpha = load_scalar(alphaa);
+    if(!alpha)
+        return;
+
+    auto*       A = load_ptr_batch(Aa, blockIdx.z, shift_A, stride_A);
+    const auto* x = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
+    const auto* y = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
+
+    using T = std::remove_cv_t<std::remove_pointer_t<decltype(A)>>;
+
+    // passing as extern shared memory to avoid templating the vector length
+    extern __shared__ rocblas_double_complex smem[];
+    T*                                       sx = reinterpret_cast<T*>(smem);
+    T*                                       sy = sx + n;
+
+    for(rocblas_int j = threadIdx.x; j < n; j += NB)
+    {
+        sx[j] = x[j * int64_t(incx)];
+        sy[j] = y[j * int64_t(incy)];
+    }
+    __syncthreads();
+
+    for(size_t i = size_t(blockIdx.x) * NB + threadIdx.x; i < area; i += size_t(gridDim.x) * NB)
+    {
+        size_t ri = !is_upper ? area - 1 - i : i;
+
+        // linearized triangle with diagonal to col, row
+        int k  = int(sqrt(8 * ri + 1) - 1) / 2;
+        int ty = k;
+        int tx = int(ri - k * size_t(k + 1) / 2);
+
+        if(!is_upper)
+        {
+            int maxIdx = n - 1;
+            tx         = maxIdx - tx;
+            ty         = maxIdx - ty;
+        }
+
+        if(tx == ty)
+            A[tx + int64_t(lda) * ty] = std::real(A[tx + int64_t(lda) * ty])
+                                        + alpha * sx[tx] * conj(sy[ty])
+                                        + conj(alpha) * sy[tx] * conj(sx[ty]);
+        else
+            A[tx + int64_t(lda) * ty]
+                += alpha * sx[tx] * conj(sy[ty]) + conj(alpha) * sy[tx] * conj(sx[ty]);
+    }
+}
+
 /**
  * TScal     is always: const T* (either2 host or device)
  * TConstPtr is either2: const T* OR const T* const*
@@ -138,6 +209,39 @@ rocblas_status rocblas_her2_launcher(rocblas_handle handle,
 
     size_t nitems = (size_t)n * (n + 1) / 2;
 
+    // Batched staged path: when the vectors fit in LDS and the batch alone
+    // supplies the parallelism, one workgroup slab per batch member stages x
+    // and y once and updates the triangle A-bandwidth-bound
+    using T = std::remove_cv_t<std::remove_pointer_t<TScal>>;
+
+    static constexpr rocblas_int her2_staged_max_n     = 1024;
+    static constexpr rocblas_int her2_staged_min_batch = 64;
+    if(batch_count >= her2_staged_min_batch && n <= her2_staged_max_n)
+    {
+        static constexpr int NB = 256;
+
+        size_t      lds     = 2 * size_t(n) * sizeof(T);
+        rocblas_int blocksX = rocblas_int(std::min<size_t>((nitems - 1) / NB + 1, 1024));
+
+        dim3 staged_grid(blocksX, 1, batch_count);
+        dim3 staged_threads(NB);
+
+#define her2_staged_KARGS(alpha_)                                                                \
+    staged_grid, staged_threads, lds, handle->get_stream(), uplo == rocblas_fill_upper, n,       \
+        nitems, alpha_, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, A, offset_A,     \
+        lda, stride_A
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_her2_staged_kernel<API_INT, NB>),
+                                  her2_staged_KARGS(alpha));
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_her2_staged_kernel<API_INT, NB>),
+                                  her2_staged_KARGS(*alpha));
+#undef her2_staged_KARGS
+
+        return rocblas_status_success;
+    }
+
     rocblas_int blocksX = (nitems - 1) / (HER2_DIM_X) + 1;
 
     dim3 her2_grid(blocksX, 1, batch_count);
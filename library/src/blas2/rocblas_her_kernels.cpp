@@ -24,6 +24,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_her.hpp"
+#include "rocblas_level2_threshold.hpp"
 
 template <int DIM_X, typename T, typename U>
 ROCBLAS_KERNEL_ILF void rocblas_her_kernel_calc(bool        is_upper,
@@ -101,6 +102,85 @@ rocblas_her_kernel(bool           is_upper,
     rocblas_her_kernel_calc<DIM_X>(is_upper, n, alpha, x, incx, A, lda);
 }
 
+// Supertile rank-1 update for large n: one workgroup owns a STILE x STILE
+// tile of the triangle, stages the two x segments the tile touches in LDS
+// once, and streams the tile of A, so x comes from HBM once per supertile
+// instead of once per column block. The tile grid is linearized over the
+// upper triangle; lower fills reuse the mapping by reflecting both indices
+// through n - 1, which preserves the Hermitian update since only the
+// conjugated side follows the column index.
+template <int DIM_X, int DIM_Y, int STILE, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_her_kernel_supertile(bool           is_upper,
+                             rocblas_int    n,
+                             TScal          alpha_device_host,
+                             TConstPtr      xa,
+                             rocblas_stride shift_x,
+                             int64_t        incx,
+                             rocblas_stride stride_x,
+                             TPtr           Aa,
+                             int64_t        lda,
+                             rocblas_stride shift_A,
+                             rocblas_stride stride_A)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    if(!alpha)
+        return;
+
+    auto*       A = load_ptr_batch(Aa, blockIdx.y, shift_A, stride_A);
+    const auto* x = load_ptr_batch(xa, blockIdx.y, shift_x, stride_x);
+
+    using T = std::decay_t<decltype(*A)>;
+
+    // linearized triangle of supertiles to (tile row, tile col), row <= col
+    int         k        = (int)((sqrt(8.0 * blockIdx.x + 1) - 1) / 2);
+    rocblas_int tile_col = k;
+    rocblas_int tile_row = blockIdx.x - k * (k + 1) / 2;
+
+    __shared__ T xrow[STILE];
+    __shared__ T xcol[STILE];
+
+    // stage the two vector segments this supertile touches; lower-triangle
+    // updates run on reflected indices, so stage the reflected values
+    for(rocblas_int i = threadIdx.y * DIM_X + threadIdx.x; i < STILE; i += DIM_X * DIM_Y)
+    {
+        rocblas_int r = tile_row * STILE + i;
+        rocblas_int c = tile_col * STILE + i;
+        if(r < n)
+            xrow[i] = x[(is_upper ? r : n - 1 - r) * incx];
+        if(c < n)
+            xcol[i] = x[(is_upper ? c : n - 1 - c) * incx];
+    }
+    __syncthreads();
+
+    const bool diag = tile_row == tile_col;
+
+    for(rocblas_int j = threadIdx.y; j < STILE; j += DIM_Y)
+    {
+        rocblas_int col = tile_col * STILE + j;
+        if(col >= n)
+            break;
+        for(rocblas_int i = threadIdx.x; i < STILE; i += DIM_X)
+        {
+            rocblas_int row = tile_row * STILE + i;
+            if(row >= n)
+                break;
+            if(diag && row > col)
+                continue; // only the diagonal tile straddles the triangle edge
+
+            rocblas_int arow = is_upper ? row : n - 1 - row;
+            rocblas_int acol = is_upper ? col : n - 1 - col;
+
+            if(row == col)
+                // diagonal elements must be real
+                A[arow + lda * acol] = std::real(A[arow + lda * acol])
+                                       + std::real(xrow[i] * conj(xcol[j]) * alpha);
+            else
+                A[arow + lda * acol] += xrow[i] * conj(xcol[j]) * alpha;
+        }
+    }
+}
+
 /**
  * TScal     is always: const U* (either host or device)
  * TConstPtr is either: const T* OR const T* const*
@@ -138,6 +218,42 @@ rocblas_status rocblas_her_launcher(rocblas_handle handle,
 
     static constexpr int HER_DIM_X = 1024;
 
+    // L2-conscious scheduling for large n: supertile kernels stage the x
+    // segments each tile touches in LDS once, instead of re-fetching them
+    // from HBM for every column block
+    static constexpr rocblas_int HER_STILE = 256;
+
+    int64_t tiles_1d = (int64_t(n) - 1) / HER_STILE + 1;
+    size_t  ntiles   = size_t(tiles_1d) * (tiles_1d + 1) / 2;
+
+    // the tile count must fit in grid.x; beyond that the flat walk remains
+    if(n >= syr_her_supertile_n_threshold && ntiles < (size_t(1) << 31))
+    {
+        static constexpr rocblas_int HER_TDX = 64;
+        static constexpr rocblas_int HER_TDY = 16;
+
+        dim3 tile_grid(ntiles, batch_count);
+        dim3 tile_threads(HER_TDX, HER_TDY);
+
+#define her_supertile_KARGS(alpha_)                                                          \
+    tile_grid, tile_threads, 0, rocblas_stream, uplo == rocblas_fill_upper, n, alpha_, x,    \
+        shift_x, incx, stride_x, A, lda, offset_A, stride_A
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_her_kernel_supertile<HER_TDX, HER_TDY, HER_STILE>),
+                                  her_supertile_KARGS(alpha));
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_her_kernel_supertile<HER_TDX, HER_TDY, HER_STILE>),
+                                  her_supertile_KARGS(*alpha));
+        }
+#undef her_supertile_KARGS
+#undef her_KARGS
+        return rocblas_status_success;
+    }
+
     dim3 her_grid(n, batch_count);
     dim3 her_threads(HER_DIM_X);
 
@@ -57,13 +57,55 @@ __forceinline__ __device__ void rocblas_hpmv_kernel_calc(bool        is_upper,
         return;
     }
 
-    __shared__ T sdata[DIM_X * DIM_Y];
-    T            res_A = 0.0;
-    rocblas_int  col;
+    const rocblas_int rb = blockIdx.x * DIM_X;
 
-    for(col = ty; col < n; col += DIM_Y)
+    // serves as the staged tile during the column sweep and as the
+    // partial-sum reduction area afterwards; the tile rows are padded to
+    // DIM_Y + 1 so the strided reads in the multiply phase are conflict-free
+    __shared__ T smem[DIM_X * (DIM_Y + 1)];
+
+    // loader mapping for tiles in the opposite triangle: DIM_Y consecutive
+    // lanes step along the direction that is contiguous in packed storage
+    const rocblas_int lj = thread_id % DIM_Y;
+    const rocblas_int li = thread_id / DIM_Y;
+
+    T res_A = 0.0;
+
+    for(rocblas_int cb = 0; cb < n; cb += DIM_Y)
     {
-        if(ind < n)
+        rocblas_int col = cb + ty;
+
+        // Whether the whole DIM_X x DIM_Y tile lies in the opposite
+        // triangle (uniform across the block). Reading such a tile
+        // element-wise makes each lane stride by its own row index; instead
+        // it is staged through LDS with loads along the packed-contiguous
+        // direction, DIM_Y lanes wide.
+        const bool transposed_tile = is_upper ? (cb + DIM_Y - 1 < rb) : (rb + DIM_X - 1 < cb);
+
+        if(transposed_tile)
+        {
+            rocblas_int row  = rb + li;
+            rocblas_int jcol = cb + lj;
+            if(row < n && jcol < n)
+            {
+                // transposed position (jcol, row) in the stored triangle
+                int64_t index = is_upper
+                                    ? ((int64_t(row) * (row + 1)) / 2) + jcol
+                                    : ((int64_t(row) * (2 * n - row + 1)) / 2) + (jcol - row);
+
+                smem[li * (DIM_Y + 1) + lj] = AP[index];
+            }
+
+            __syncthreads();
+
+            // every element of a transposed tile is strictly off-diagonal,
+            // so the conjugate is taken unconditionally
+            if(ind < n && col < n)
+                res_A += conj(smem[tx * (DIM_Y + 1) + ty]) * x[col * int64_t(incx)];
+
+            __syncthreads();
+        }
+        else if(ind < n && col < n)
         {
             int  ind_x = ind;
             int  ind_y = col;
@@ -99,20 +141,20 @@ __forceinline__ __device__ void rocblas_hpmv_kernel_calc(bool        is_upper,
     }
 
     // Store partial sums for the diagonal
-    sdata[tx + ty * DIM_X] = res_A;
+    smem[tx + ty * DIM_X] = res_A;
     __syncthreads();
 
     if(thread_id < DIM_X && ind < n)
     {
         // Add the partial sums of each diagonal and store
         for(rocblas_int i = 1; i < DIM_Y; i++)
-            sdata[thread_id] += sdata[thread_id + DIM_X * i];
+            smem[thread_id] += smem[thread_id + DIM_X * i];
 
         int64_t idx = blockIdx.x * DIM_X + thread_id;
         // Update y.
         if(idx < n)
-            y[idx * int64_t(incy)] = beta ? alpha * sdata[thread_id] + beta * y[idx * int64_t(incy)]
-                                          : alpha * sdata[thread_id];
+            y[idx * int64_t(incy)] = beta ? alpha * smem[thread_id] + beta * y[idx * int64_t(incy)]
+                                          : alpha * smem[thread_id];
     }
 }
 
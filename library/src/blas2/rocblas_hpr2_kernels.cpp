@@ -24,39 +24,11 @@
 #include "handle.hpp"
 #include "rocblas_hpr2.hpp"
 
-template <int DIM_X, int DIM_Y, int N_TX, typename T>
-__forceinline__ __device__ void rocblas_hpr2_kernel_calc(bool        is_upper,
-                                                         rocblas_int n,
-                                                         T           alpha,
-                                                         const T*    x,
-                                                         int64_t     incx,
-                                                         const T*    y,
-                                                         int64_t     incy,
-                                                         T*          AP)
-{
-    rocblas_int tx = (blockIdx.x * DIM_X * N_TX) + threadIdx.x;
-    rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
-
-    int index = is_upper ? ((ty * (ty + 1)) / 2) + tx : ((ty * (2 * n - ty + 1)) / 2) + (tx - ty);
-
-#pragma unroll
-    for(int i = 0; i < N_TX; i++, tx += DIM_X, index += DIM_X)
-    {
-        if(is_upper ? ty < n && tx < ty : tx < n && ty < tx)
-        {
-            AP[index] += alpha * x[tx * incx] * conj(y[ty * incy])
-                         + conj(alpha) * y[tx * incy] * conj(x[ty * incx]);
-        }
-        else if(tx == ty && tx < n)
-        {
-            AP[index] = std::real(AP[index]) + alpha * x[tx * incx] * conj(y[ty * incy])
-                        + conj(alpha) * y[tx * incy] * conj(x[ty * incx]);
-        }
-    }
-}
-
-template <int DIM_X, int DIM_Y, int N_TX, typename TScal, typename TConstPtr, typename TPtr>
-ROCBLAS_KERNEL(DIM_X* DIM_Y)
+// one thread per stored element of the packed triangle: the linear thread id
+// is the packed index itself, so no threads land in the unused half of an
+// n x n grid and the update is a single strided read-modify-write
+template <int NB, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(NB)
 rocblas_hpr2_kernel(bool           is_upper,
                     rocblas_int    n,
                     TScal          alphaa,
@@ -76,11 +48,23 @@ rocblas_hpr2_kernel(bool           is_upper,
     if(!alpha)
         return;
 
+    int64_t pid = int64_t(blockIdx.x) * NB + threadIdx.x;
+    if(pid >= int64_t(n) * (n + 1) / 2)
+        return;
+
     const auto* x  = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
     const auto* y  = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
     auto*       AP = load_ptr_batch(APa, blockIdx.z, shift_A, stride_A);
 
-    rocblas_hpr2_kernel_calc<DIM_X, DIM_Y, N_TX>(is_upper, n, alpha, x, incx, y, incy, AP);
+    rocblas_int row, col;
+    rocblas_packed_triangle_coords(is_upper, n, pid, row, col);
+
+    auto v = alpha * x[row * incx] * conj(y[col * incy])
+             + conj(alpha) * y[row * incy] * conj(x[col * incx]);
+    if(row == col)
+        AP[pid] = std::real(AP[pid]) + v;
+    else
+        AP[pid] += v;
 }
 
 /**
@@ -115,19 +99,17 @@ rocblas_status rocblas_internal_hpr2_launcher(rocblas_handle handle,
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
     ptrdiff_t shift_y = incy < 0 ? offset_y - ptrdiff_t(incy) * (n - 1) : offset_y;
 
-    static constexpr int HPR2_DIM_X = 64;
-    static constexpr int HPR2_DIM_Y = 16;
-    static constexpr int N_TX       = 2; // x items per x thread
+    static constexpr int HPR2_NB = 256;
 
-    rocblas_int blocksX = (n - 1) / (HPR2_DIM_X * N_TX) + 1;
-    rocblas_int blocksY = (n - 1) / HPR2_DIM_Y + 1;
+    // one thread per stored element of the packed triangle
+    int64_t blocks = (int64_t(n) * (n + 1) / 2 - 1) / HPR2_NB + 1;
 
-    dim3 hpr2_grid(blocksX, blocksY, batch_count);
-    dim3 hpr2_threads(HPR2_DIM_X, HPR2_DIM_Y);
+    dim3 hpr2_grid(blocks, 1, batch_count);
+    dim3 hpr2_threads(HPR2_NB);
 
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
-        ROCBLAS_LAUNCH_KERNEL((rocblas_hpr2_kernel<HPR2_DIM_X, HPR2_DIM_Y, N_TX>),
+        ROCBLAS_LAUNCH_KERNEL((rocblas_hpr2_kernel<HPR2_NB>),
                               hpr2_grid,
                               hpr2_threads,
                               0,
@@ -148,7 +130,7 @@ rocblas_status rocblas_internal_hpr2_launcher(rocblas_handle handle,
                               stride_A);
     }
     else
-        ROCBLAS_LAUNCH_KERNEL((rocblas_hpr2_kernel<HPR2_DIM_X, HPR2_DIM_Y, N_TX>),
+        ROCBLAS_LAUNCH_KERNEL((rocblas_hpr2_kernel<HPR2_NB>),
                               hpr2_grid,
                               hpr2_threads,
                               0,
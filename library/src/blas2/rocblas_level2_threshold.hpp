@@ -43,6 +43,23 @@ constexpr int dgemvt_gfx908_lower_threshold = 3000;
 constexpr int sgemvn_gfx942_double_buffered_higher_threshold = 30000;
 constexpr int dgemvn_gfx942_double_buffered_higher_threshold = 40000;
 
+// Double buffered load optimized for single and double precision for gemv (non-transpose)
+// on gfx908; below these sizes the 512 threads/block kernel is faster
+constexpr int sgemvn_gfx908_double_buffered_lower_threshold = 8000;
+constexpr int dgemvn_gfx908_double_buffered_lower_threshold = 8000;
+
+// Skinny non-transpose gemv: tall matrices with n at or below this column
+// count dispatch to compile-time unrolled one-thread-per-row kernels
+constexpr int gemvn_skinny_n_threshold = 8;
+constexpr int gemvn_skinny_m_threshold = 1024;
+
+// Tiny batched non-transpose gemv: problems with m and n at or below this
+// bound and at least this many batch instances dispatch one workgroup per
+// batch element, grid-striding over batches with a bounded grid
+constexpr int gemvn_tiny_batched_mn_threshold    = 64;
+constexpr int gemvn_tiny_batched_count_threshold = 256;
+constexpr int gemvn_tiny_batched_max_blocks      = 65536;
+
 /*********************************************************************symv**********************************************************************/
 
 // Double buffered load optimized for single and double precision for symv (upper)
@@ -60,3 +77,23 @@ constexpr int dsymv_L_gfx90a_generic_higher_threshold = 26000;
 // Double buffered load optimized for double precision for symv (upper) generic cases
 constexpr int dsymv_U_gfx908_generic_higher_threshold = 14000;
 constexpr int dsymv_U_gfx908_generic_lower_threshold  = 19000;
+
+/****************************************************************banded (gbmv/sbmv/hbmv/tbmv)****************************************************/
+
+// Banded mv kernels: band windows with at most this many elements dispatch to
+// the one-thread-per-element kernels with the band loop fully unrolled
+constexpr int banded_narrow_band_window = 33;
+
+// Batched narrow-band gbmv: below this system size and above this batch count,
+// each wavefront processes one whole batch instance instead of one
+// mostly-idle block per instance
+constexpr int banded_wavefront_batched_dim_threshold   = 128;
+constexpr int banded_wavefront_batched_count_threshold = 4096;
+
+/*********************************************************************syr/her*******************************************************************/
+
+// Rank-1 updates (syr/her) at or above this n dispatch to supertile kernels:
+// one workgroup owns a square tile of the triangle and stages the two vector
+// segments the tile touches in LDS once, instead of re-fetching them from
+// HBM for every row of the flat 2-D walk
+constexpr int syr_her_supertile_n_threshold = 4096;
@@ -22,6 +22,7 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_level2_threshold.hpp"
 #include "rocblas_sbmv.hpp"
 
 /**
@@ -129,6 +130,61 @@ inline __device__ void rocblas_sbmv_kernel_calc(rocblas_int n,
     }
 }
 
+/**
+  *  Narrow-band variant: one thread per output element. The general kernel
+  *  strides its partial-sum columns over all of n, which for a small band
+  *  visits mostly empty columns; here each thread only walks the 2k+1 columns
+  *  that intersect its row, with the loop fully unrolled via the NBANDS bound.
+  */
+template <bool UPPER, rocblas_int NB, rocblas_int NBANDS, typename T>
+inline __device__ void rocblas_sbmv_band_kernel_calc(rocblas_int n,
+                                                     rocblas_int k,
+                                                     T           alpha,
+                                                     const T* __restrict__ A,
+                                                     int64_t lda,
+                                                     const T* __restrict__ x,
+                                                     int64_t incx,
+                                                     T       beta,
+                                                     T* __restrict__ y,
+                                                     int64_t incy)
+{
+    rocblas_int ind = blockIdx.x * NB + threadIdx.x;
+    if(ind >= n)
+        return;
+
+    if(!alpha)
+    {
+        y[ind * incy] = beta ? (beta * y[ind * incy]) : 0;
+        return;
+    }
+
+    T res_A = 0.0;
+
+#pragma unroll
+    for(rocblas_int b = 0; b < NBANDS; b++)
+    {
+        rocblas_int col = ind - k + b;
+        if(b <= 2 * k && col >= 0 && col < n)
+        {
+            // only |ind - col| <= k is visited, so the banded row index below
+            // always lands inside the stored band
+            if((ind <= col && UPPER) || (ind >= col && !UPPER))
+            {
+                rocblas_int row = UPPER ? ind + (k - col) : ind - col;
+                res_A += A[row + col * size_t(lda)] * x[col * incx];
+            }
+            else
+            {
+                // in the opposite triangle, get value at transposed position
+                rocblas_int trans_row = UPPER ? col + (k - ind) : col - ind;
+                res_A += A[trans_row + ind * size_t(lda)] * x[col * incx];
+            }
+        }
+    }
+
+    y[ind * incy] = beta ? (alpha * res_A) + (beta * y[ind * incy]) : alpha * res_A;
+}
+
 /**
   *  U is either: const T* OR T
   *  V is either: const T* OR const T* const*
@@ -172,6 +228,40 @@ rocblas_sbmv_kernel(rocblas_int    n,
     rocblas_sbmv_kernel_calc<UPPER, DIM_X, DIM_Y>(n, k, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <bool UPPER, rocblas_int NB, rocblas_int NBANDS, typename U, typename V, typename W>
+ROCBLAS_KERNEL(NB)
+rocblas_sbmv_band_kernel(rocblas_int    n,
+                         rocblas_int    k,
+                         U              alpha_device_host,
+                         rocblas_stride stride_alpha,
+                         V              Aa,
+                         rocblas_stride shifta,
+                         int64_t        lda,
+                         rocblas_stride stride_A,
+                         V              xa,
+                         rocblas_stride shiftx,
+                         int64_t        incx,
+                         rocblas_stride stride_x,
+                         U              beta_device_host,
+                         rocblas_stride stride_beta,
+                         W              ya,
+                         rocblas_stride shifty,
+                         int64_t        incy,
+                         rocblas_stride stride_y)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, stride_A);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stride_x);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stride_y);
+
+    rocblas_sbmv_band_kernel_calc<UPPER, NB, NBANDS>(n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 template <typename T, typename TScal, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_internal_sbmv_launcher(rocblas_handle handle,
                                               rocblas_fill   uplo,
@@ -205,6 +295,50 @@ rocblas_status rocblas_internal_sbmv_launcher(rocblas_handle handle,
     auto shiftx = incx < 0 ? offset_x - incx * (n - 1) : offset_x;
     auto shifty = incy < 0 ? offset_y - incy * (n - 1) : offset_y;
 
+    if(2 * k < banded_narrow_band_window)
+    {
+        // narrow band: one thread per element with the band loop fully unrolled
+        static constexpr int NB          = 256;
+        rocblas_int          band_blocks = (n - 1) / NB + 1;
+        dim3                 band_grid(band_blocks, batch_count);
+        dim3                 band_threads(NB);
+
+#define SBMV_BAND_ARGS(alpha_, beta_)                                                          \
+    band_grid, band_threads, 0, rocblas_stream, n, k, alpha_, stride_alpha, A, offset_A, lda,  \
+        stride_A, x, shiftx, incx, stride_x, beta_, stride_beta, y, shifty, incy, stride_y
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(uplo == rocblas_fill_upper)
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_sbmv_band_kernel<true, NB, banded_narrow_band_window>),
+                    SBMV_BAND_ARGS(alpha, beta));
+            else
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_sbmv_band_kernel<false, NB, banded_narrow_band_window>),
+                    SBMV_BAND_ARGS(alpha, beta));
+        }
+        else
+        {
+            // quick return only for non-batched
+            if(batch_count == 1 && !*alpha && *beta == 1)
+                return rocblas_status_success;
+
+            if(uplo == rocblas_fill_upper)
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_sbmv_band_kernel<true, NB, banded_narrow_band_window>),
+                    SBMV_BAND_ARGS(*alpha, *beta));
+            else
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_sbmv_band_kernel<false, NB, banded_narrow_band_window>),
+                    SBMV_BAND_ARGS(*alpha, *beta));
+        }
+
+#undef SBMV_BAND_ARGS
+
+        return rocblas_status_success;
+    }
+
     static constexpr int sbmv_DIM_X = 64;
     static constexpr int sbmv_DIM_Y = 16;
     rocblas_int          blocks     = (n - 1) / (sbmv_DIM_X) + 1;
@@ -59,13 +59,53 @@ __device__ void rocblas_spmv_kernel_calc(bool        is_upper,
 
     rocblas_int ind = blockIdx.x * DIM_X + tx;
 
-    __shared__ T sdata[DIM_X * DIM_Y];
-    T            res_A = 0.0;
-    rocblas_int  col;
+    const rocblas_int rb = blockIdx.x * DIM_X;
 
-    for(col = ty; col < n; col += DIM_Y)
+    // serves as the staged tile during the column sweep and as the
+    // partial-sum reduction area afterwards; the tile rows are padded to
+    // DIM_Y + 1 so the strided reads in the multiply phase are conflict-free
+    __shared__ T smem[DIM_X * (DIM_Y + 1)];
+
+    // loader mapping for tiles in the opposite triangle: DIM_Y consecutive
+    // lanes step along the direction that is contiguous in packed storage
+    const rocblas_int lj = thread_id % DIM_Y;
+    const rocblas_int li = thread_id / DIM_Y;
+
+    T res_A = 0.0;
+
+    for(rocblas_int cb = 0; cb < n; cb += DIM_Y)
     {
-        if(ind < n)
+        rocblas_int col = cb + ty;
+
+        // Whether the whole DIM_X x DIM_Y tile lies in the opposite
+        // triangle (uniform across the block). Reading such a tile
+        // element-wise makes each lane stride by its own row index; instead
+        // it is staged through LDS with loads along the packed-contiguous
+        // direction, DIM_Y lanes wide.
+        const bool transposed_tile = is_upper ? (cb + DIM_Y - 1 < rb) : (rb + DIM_X - 1 < cb);
+
+        if(transposed_tile)
+        {
+            rocblas_int row  = rb + li;
+            rocblas_int jcol = cb + lj;
+            if(row < n && jcol < n)
+            {
+                // transposed position (jcol, row) in the stored triangle
+                size_t index = is_upper
+                                   ? ((row * (size_t(row) + 1)) / 2) + jcol
+                                   : ((row * (2 * size_t(n) - row + 1)) / 2) + (jcol - row);
+
+                smem[li * (DIM_Y + 1) + lj] = AP[index];
+            }
+
+            __syncthreads();
+
+            if(ind < n && col < n)
+                res_A += smem[tx * (DIM_Y + 1) + ty] * x[col * incx];
+
+            __syncthreads();
+        }
+        else if(ind < n && col < n)
         {
             int ind_x = ind;
             int ind_y = col;
@@ -86,7 +126,7 @@ __device__ void rocblas_spmv_kernel_calc(bool        is_upper,
     }
 
     // Store partial sums
-    sdata[tx + ty * DIM_X] = res_A;
+    smem[tx + ty * DIM_X] = res_A;
 
     __syncthreads();
 
@@ -96,11 +136,11 @@ __device__ void rocblas_spmv_kernel_calc(bool        is_upper,
         // Add the partial sums and store
         for(rocblas_int i = 1; i < DIM_Y; i++)
         {
-            sdata[thread_id] += sdata[thread_id + DIM_X * i];
+            smem[thread_id] += smem[thread_id + DIM_X * i];
         }
 
         y[ind * incy]
-            = beta ? (alpha * sdata[thread_id]) + (beta * y[ind * incy]) : alpha * sdata[thread_id];
+            = beta ? (alpha * smem[thread_id]) + (beta * y[ind * incy]) : alpha * smem[thread_id];
     }
 }
 
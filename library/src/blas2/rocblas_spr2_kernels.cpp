@@ -24,36 +24,11 @@
 #include "handle.hpp"
 #include "rocblas_spr2.hpp"
 
-template <int DIM_X, int DIM_Y, int N_TX, typename T>
-__device__ void rocblas_spr2_kernel_calc(bool        is_upper,
-                                         rocblas_int n,
-                                         T           alpha,
-                                         const T*    x,
-                                         int64_t     incx,
-                                         const T*    y,
-                                         int64_t     incy,
-                                         T*          AP)
-{
-    rocblas_int tx = (blockIdx.x * DIM_X * N_TX) + threadIdx.x;
-    rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
-
-    int index = is_upper ? ((ty * (ty + 1)) / 2) + tx : ((ty * (2 * n - ty + 1)) / 2) + (tx - ty);
-
-#pragma unroll
-    for(int i = 0; i < N_TX; i++, tx += DIM_X, index += DIM_X)
-    {
-        if(is_upper ? ty < n && tx <= ty : tx < n && ty <= tx)
-            AP[index] += alpha * x[tx * incx] * y[ty * incy] + alpha * y[tx * incy] * x[ty * incx];
-    }
-}
-
-template <rocblas_int DIM_X,
-          rocblas_int DIM_Y,
-          int         N_TX,
-          typename TStruct,
-          typename TConstPtr,
-          typename TPtr>
-ROCBLAS_KERNEL(DIM_X* DIM_Y)
+// one thread per stored element of the packed triangle: the linear thread id
+// is the packed index itself, so no threads land in the unused half of an
+// n x n grid and the update is a single strided read-modify-write
+template <int NB, typename TStruct, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(NB)
 rocblas_spr2_kernel(bool           host_ptr_mode,
                     bool           is_upper,
                     rocblas_int    n,
@@ -74,11 +49,18 @@ rocblas_spr2_kernel(bool           host_ptr_mode,
     if(!alpha)
         return;
 
+    int64_t pid = int64_t(blockIdx.x) * NB + threadIdx.x;
+    if(pid >= int64_t(n) * (n + 1) / 2)
+        return;
+
     auto*       AP = load_ptr_batch(APa, blockIdx.z, shift_AP, stride_AP);
     const auto* x  = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
     const auto* y  = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
 
-    rocblas_spr2_kernel_calc<DIM_X, DIM_Y, N_TX>(is_upper, n, alpha, x, incx, y, incy, AP);
+    rocblas_int row, col;
+    rocblas_packed_triangle_coords(is_upper, n, pid, row, col);
+
+    AP[pid] += alpha * x[row * incx] * y[col * incy] + alpha * y[row * incy] * x[col * incx];
 }
 
 /**
@@ -113,23 +95,18 @@ rocblas_status rocblas_internal_spr2_launcher(rocblas_handle handle,
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
     ptrdiff_t shift_y = incy < 0 ? offset_y - ptrdiff_t(incy) * (n - 1) : offset_y;
 
-    //Identifying the precision to have an appropriate optimization
-    static constexpr bool is_float = std::is_same_v<TScal, float>;
-
-    static constexpr int SPR2_DIM_X = 128;
-    static constexpr int SPR2_DIM_Y = 8;
-    static constexpr int N_TX       = is_float ? 2 : 1; // x items per x thread
+    static constexpr int SPR2_NB = 256;
 
-    rocblas_int blocksX = (n - 1) / (SPR2_DIM_X * N_TX) + 1;
-    rocblas_int blocksY = (n - 1) / SPR2_DIM_Y + 1;
+    // one thread per stored element of the packed triangle
+    int64_t blocks = (int64_t(n) * (n + 1) / 2 - 1) / SPR2_NB + 1;
 
-    dim3 spr2_grid(blocksX, blocksY, batch_count);
-    dim3 spr2_threads(SPR2_DIM_X, SPR2_DIM_Y);
+    dim3 spr2_grid(blocks, 1, batch_count);
+    dim3 spr2_threads(SPR2_NB);
 
     bool                            host_mode = handle->pointer_mode == rocblas_pointer_mode_host;
     rocblas_internal_val_ptr<TScal> alpha_device_host(host_mode, alpha);
 
-    ROCBLAS_LAUNCH_KERNEL((rocblas_spr2_kernel<SPR2_DIM_X, SPR2_DIM_Y, N_TX>),
+    ROCBLAS_LAUNCH_KERNEL((rocblas_spr2_kernel<SPR2_NB>),
                           spr2_grid,
                           spr2_threads,
                           0,
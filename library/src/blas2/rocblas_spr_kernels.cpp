@@ -53,25 +53,11 @@ rocblas_status rocblas_spr_check_numerics(const char*    function_name,
     return check_numerics_status;
 }
 
-template <int DIM_X, int DIM_Y, int N_TX, typename T>
-__forceinline__ __device__ void
-    rocblas_spr_kernel_calc(bool is_upper, rocblas_int n, T alpha, const T* x, int64_t incx, T* AP)
-{
-    int tx = (blockIdx.x * DIM_X * N_TX) + threadIdx.x;
-    int ty = blockIdx.y * DIM_Y + threadIdx.y;
-
-    int index = is_upper ? ((ty * (ty + 1)) / 2) + tx : ((ty * (2 * n - ty + 1)) / 2) + (tx - ty);
-
-#pragma unroll
-    for(int i = 0; i < N_TX; i++, tx += DIM_X, index += DIM_X)
-    {
-        if(is_upper ? ty < n && tx <= ty : tx < n && ty <= tx)
-            AP[index] += alpha * x[tx * incx] * x[ty * incx];
-    }
-}
-
-template <int DIM_X, int DIM_Y, int N_TX, typename TStruct, typename TConstPtr, typename TPtr>
-ROCBLAS_KERNEL(DIM_X* DIM_Y)
+// one thread per stored element of the packed triangle: the linear thread id
+// is the packed index itself, so no threads land in the unused half of an
+// n x n grid and the update is a single strided read-modify-write
+template <int NB, typename TStruct, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(NB)
 rocblas_spr_kernel(bool           host_ptr_mode,
                    bool           is_upper,
                    rocblas_int    n,
@@ -88,10 +74,17 @@ rocblas_spr_kernel(bool           host_ptr_mode,
     if(!alpha)
         return;
 
+    int64_t pid = int64_t(blockIdx.x) * NB + threadIdx.x;
+    if(pid >= int64_t(n) * (n + 1) / 2)
+        return;
+
     auto*       AP = load_ptr_batch(APa, blockIdx.z, shift_A, stride_A);
     const auto* x  = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
 
-    rocblas_spr_kernel_calc<DIM_X, DIM_Y, N_TX>(is_upper, n, alpha, x, incx, AP);
+    rocblas_int row, col;
+    rocblas_packed_triangle_coords(is_upper, n, pid, row, col);
+
+    AP[pid] += alpha * x[row * incx] * x[col * incx];
 }
 
 /**
@@ -121,62 +114,33 @@ rocblas_status rocblas_internal_spr_launcher(rocblas_handle handle,
     // in case of negative inc, shift pointer to end of data for negative indexing tid*inc
     ptrdiff_t shift_x = incx < 0 ? offset_x - ptrdiff_t(incx) * (n - 1) : offset_x;
 
-    static constexpr int SPR_DIM_X = 64;
-    static constexpr int SPR_DIM_Y = 16;
+    static constexpr int SPR_NB = 256;
 
     bool                            host_mode = handle->pointer_mode == rocblas_pointer_mode_host;
     rocblas_internal_val_ptr<TScal> alpha_device_host(host_mode, alpha);
 
-    if constexpr(std::is_same_v<TScal, rocblas_double_complex>)
-    {
-        static constexpr int N_TX    = 1;
-        rocblas_int          blocksX = (n - 1) / (SPR_DIM_X * N_TX) + 1;
-        rocblas_int          blocksY = (n - 1) / SPR_DIM_Y + 1;
-
-        dim3 spr_grid(blocksX, blocksY, batch_count);
-        dim3 spr_threads(SPR_DIM_X, SPR_DIM_Y);
-        ROCBLAS_LAUNCH_KERNEL((rocblas_spr_kernel<SPR_DIM_X, SPR_DIM_Y, N_TX>),
-                              spr_grid,
-                              spr_threads,
-                              0,
-                              handle->get_stream(),
-                              host_mode,
-                              uplo == rocblas_fill_upper,
-                              n,
-                              alpha_device_host,
-                              x,
-                              shift_x,
-                              incx,
-                              stride_x,
-                              AP,
-                              offset_A,
-                              stride_A);
-    }
-    else
-    {
-        static constexpr int N_TX    = 2;
-        rocblas_int          blocksX = (n - 1) / (SPR_DIM_X * N_TX) + 1;
-        rocblas_int          blocksY = (n - 1) / SPR_DIM_Y + 1;
-
-        dim3 spr_grid(blocksX, blocksY, batch_count);
-        dim3 spr_threads(SPR_DIM_X, SPR_DIM_Y);
-        ROCBLAS_LAUNCH_KERNEL((rocblas_spr_kernel<SPR_DIM_X, SPR_DIM_Y, N_TX>),
-                              spr_grid,
-                              spr_threads,
-                              0,
-                              handle->get_stream(),
-                              host_mode,
-                              uplo == rocblas_fill_upper,
-                              n,
-                              alpha_device_host,
-                              x,
-                              shift_x,
-                              incx,
-                              stride_x,
-                              AP,
-                              offset_A,
-                              stride_A);
-    }
+    // one thread per stored element of the packed triangle
+    int64_t blocks = (int64_t(n) * (n + 1) / 2 - 1) / SPR_NB + 1;
+
+    dim3 spr_grid(blocks, 1, batch_count);
+    dim3 spr_threads(SPR_NB);
+
+    ROCBLAS_LAUNCH_KERNEL((rocblas_spr_kernel<SPR_NB>),
+                          spr_grid,
+                          spr_threads,
+                          0,
+                          handle->get_stream(),
+                          host_mode,
+                          uplo == rocblas_fill_upper,
+                          n,
+                          alpha_device_host,
+                          x,
+                          shift_x,
+                          incx,
+                          stride_x,
+                          AP,
+                          offset_A,
+                          stride_A);
 
     return rocblas_status_success;
 }
@@ -77,6 +77,70 @@ rocblas_syr2_kernel(bool           is_upper,
     rocblas_syr2_kernel_calc<DIM_X, DIM_Y, N_TX>(is_upper, n, alpha, x, incx, y, incy, A, lda);
 }
 
+//! Staged batched variant: with many small problems each workgroup loads
+//! both vectors into LDS once and then walks a slab of the packed triangle,
+//! so the matrix is the only global traffic in the update instead of x and y
+//! being re-read per tile row.
+template <int NB, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_syr2_staged_kernel(bool           is_upper,
+                           rocblas_int    n,
+                           size_t         area,
+                           TScal          alphaa,
+                           TConstPtr      xa,
+                           rocblas_stride shift_x,
+                           int64_t        incx,
+                           rocblas_stride stride_x,
+                           TConstPtr      ya,
+                           rocblas_stride shift_y,
+                           int64_t        incy,
+                           rocblas_stride stride_y,
+                           TPtr           Aa,
+                           int64_t        lda,
+                           rocblas_stride shift_A,
+                           rocblas_stride stride_A)
+{
+    auto alpha = load_scalar(alphaa);
+    if(!alpha)
+        return;
+
+    auto*       A = load_ptr_batch(Aa, blockIdx.z, shift_A, stride_A);
+    const auto* x = load_ptr_batch(xa, blockIdx.z, shift_x, stride_x);
+    const auto* y = load_ptr_batch(ya, blockIdx.z, shift_y, stride_y);
+
+    using T = std::remove_cv_t<std::remove_pointer_t<decltype(A)>>;
+
+    // passing as extern shared memory to avoid templating the vector length
+    extern __shared__ rocblas_double_complex smem[];
+    T*                                       sx = reinterpret_cast<T*>(smem);
+    T*                                       sy = sx + n;
+
+    for(rocblas_int j = threadIdx.x; j < n; j += NB)
+    {
+        sx[j] = x[j * incx];
+        sy[j] = y[j * incy];
+    }
+    __syncthreads();
+
+    for(size_t i = size_t(blockIdx.x) * NB + threadIdx.x; i < area; i += size_t(gridDim.x) * NB)
+    {
+        size_t ri = !is_upper ? area - 1 - i : i;
+
+        // linearized triangle with diagonal to col, row
+        int k  = int(sqrt(8 * ri + 1) - 1) / 2;
+        int ty = k;
+        int tx = int(ri - k * size_t(k + 1) / 2);
+
+        if(!is_upper)
+        {
+            tx = n - 1 - tx;
+            ty = n - 1 - ty;
+        }
+
+        A[tx + ty * lda] += alpha * (sx[tx] * sy[ty] + sy[tx] * sx[ty]);
+    }
+}
+
 /**
  * TScal     is always: const T* (either host or device)
  * TConstPtr is either: const T* OR const T* const*
@@ -113,6 +177,38 @@ rocblas_status rocblas_internal_syr2_launcher(rocblas_handle handle,
     //Identifying the precision to have an appropriate optimization
     static constexpr bool is_float = std::is_same_v<TScal, const float*>;
 
+    using T = std::remove_cv_t<std::remove_pointer_t<TScal>>;
+
+    // Batched staged path: when the vectors fit in LDS and the batch alone
+    // supplies the parallelism, one workgroup slab per batch member stages x
+    // and y once and updates the packed triangle A-bandwidth-bound
+    static constexpr rocblas_int syr2_staged_max_n          = 1024;
+    static constexpr rocblas_int syr2_staged_min_batch      = 64;
+    if(batch_count >= syr2_staged_min_batch && n <= syr2_staged_max_n)
+    {
+        static constexpr int NB = 256;
+
+        size_t      area    = size_t(n) * (n + 1) / 2;
+        size_t      lds     = 2 * size_t(n) * sizeof(T);
+        rocblas_int blocksX = rocblas_int(std::min<size_t>((area - 1) / NB + 1, 1024));
+
+        dim3 staged_grid(blocksX, 1, batch_count);
+        dim3 staged_threads(NB);
+
+#define syr2_staged_KARGS(alpha_)                                                              \
+    staged_grid, staged_threads, lds, handle->get_stream(), uplo == rocblas_fill_upper, n,     \
+        area, alpha_, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, A, lda,          \
+        offset_A, stride_A
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_syr2_staged_kernel<NB>), syr2_staged_KARGS(alpha));
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_syr2_staged_kernel<NB>), syr2_staged_KARGS(*alpha));
+#undef syr2_staged_KARGS
+
+        return rocblas_status_success;
+    }
+
     static constexpr int SYR2_DIM_X = 128;
     static constexpr int SYR2_DIM_Y = 8;
     static constexpr int N_TX       = is_float ? 2 : 1; // x items per x thread
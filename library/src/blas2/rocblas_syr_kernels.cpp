@@ -19,6 +19,7 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "rocblas_level2_threshold.hpp"
 #include "rocblas_syr.hpp"
 
 template <bool UPPER, rocblas_int DIM_X, typename T, typename U, typename V, typename W>
@@ -110,6 +111,84 @@ rocblas_syr_kernel(rocblas_int    n,
     A[tx + lda * ty] += alpha * x[tx * incx] * x[ty * incx];
 }
 
+// Supertile rank-1 update for large n: one workgroup owns a STILE x STILE
+// tile of the triangle, stages the two x segments the tile touches in LDS
+// once, and streams the tile of A, so x comes from HBM once per supertile
+// instead of once per tile row of the flat walk. The tile grid is linearized
+// like the flat kernels map elements, always over the upper triangle; lower
+// fills reuse the mapping by reflecting both indices through n - 1.
+template <bool        UPPER,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int STILE,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_syr_kernel_supertile(rocblas_int    n,
+                             U              alpha_device_host,
+                             rocblas_stride stride_alpha,
+                             V              xa,
+                             rocblas_stride shiftx,
+                             int64_t        incx,
+                             rocblas_stride stridex,
+                             W              Aa,
+                             rocblas_stride shiftA,
+                             int64_t        lda,
+                             rocblas_stride stride_A)
+{
+    auto alpha = load_scalar(alpha_device_host, blockIdx.z, stride_alpha);
+    if(!alpha)
+        return;
+
+    const auto* __restrict__ x = load_ptr_batch(xa, blockIdx.z, shiftx, stridex);
+    T* __restrict__ A          = load_ptr_batch(Aa, blockIdx.z, shiftA, stride_A);
+
+    // linearized triangle of supertiles to (tile row, tile col), row <= col
+    int         k        = (int)((sqrt(8.0 * blockIdx.x + 1) - 1) / 2);
+    rocblas_int tile_col = k;
+    rocblas_int tile_row = blockIdx.x - k * (k + 1) / 2;
+
+    __shared__ T xrow[STILE];
+    __shared__ T xcol[STILE];
+
+    // stage the two vector segments this supertile touches; lower-triangle
+    // updates run on reflected indices, so stage the reflected values
+    for(rocblas_int i = threadIdx.y * DIM_X + threadIdx.x; i < STILE; i += DIM_X * DIM_Y)
+    {
+        rocblas_int r = tile_row * STILE + i;
+        rocblas_int c = tile_col * STILE + i;
+        if(r < n)
+            xrow[i] = x[(UPPER ? r : n - 1 - r) * incx];
+        if(c < n)
+            xcol[i] = x[(UPPER ? c : n - 1 - c) * incx];
+    }
+    __syncthreads();
+
+    const bool diag = tile_row == tile_col;
+
+    for(rocblas_int j = threadIdx.y; j < STILE; j += DIM_Y)
+    {
+        rocblas_int col = tile_col * STILE + j;
+        if(col >= n)
+            break;
+        for(rocblas_int i = threadIdx.x; i < STILE; i += DIM_X)
+        {
+            rocblas_int row = tile_row * STILE + i;
+            if(row >= n)
+                break;
+            if(diag && row > col)
+                continue; // only the diagonal tile straddles the triangle edge
+
+            rocblas_int arow = UPPER ? row : n - 1 - row;
+            rocblas_int acol = UPPER ? col : n - 1 - col;
+
+            A[arow + lda * acol] += alpha * xrow[i] * xcol[j];
+        }
+    }
+}
+
 template <typename T, typename U, typename V, typename W>
 rocblas_status rocblas_internal_syr_launcher(rocblas_handle handle,
                                              rocblas_fill   uplo,
@@ -144,6 +223,53 @@ rocblas_status rocblas_internal_syr_launcher(rocblas_handle handle,
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
     auto shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
 
+    // L2-conscious scheduling for large n: supertile kernels stage the x
+    // segments each tile touches in LDS once, instead of re-fetching them
+    // from HBM across the flat linearized walk
+    static constexpr rocblas_int SYR_STILE = 256;
+
+    rocblas_int tiles_1d = (n - 1) / SYR_STILE + 1;
+    size_t      ntiles   = size_t(tiles_1d) * (tiles_1d + 1) / 2;
+
+    // the tile count must fit in grid.x; beyond that the flat walk remains
+    if(n >= syr_her_supertile_n_threshold && ntiles < (size_t(1) << 31))
+    {
+        static constexpr rocblas_int SYR_TDX = 64;
+        static constexpr rocblas_int SYR_TDY = 16;
+
+        dim3 tile_grid(ntiles, 1, batch_count);
+        dim3 tile_threads(SYR_TDX, SYR_TDY);
+
+#define syr_supertile_KARGS(alpha_)                                                       \
+    tile_grid, tile_threads, 0, rocblas_stream, n, alpha_, stride_alpha, x, shiftx, incx, \
+        stridex, A, offset_A, lda, stride_A
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+        {
+            if(uplo == rocblas_fill_upper)
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_syr_kernel_supertile<true, SYR_TDX, SYR_TDY, SYR_STILE, T>),
+                    syr_supertile_KARGS(alpha));
+            else
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_syr_kernel_supertile<false, SYR_TDX, SYR_TDY, SYR_STILE, T>),
+                    syr_supertile_KARGS(alpha));
+        }
+        else
+        {
+            if(uplo == rocblas_fill_upper)
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_syr_kernel_supertile<true, SYR_TDX, SYR_TDY, SYR_STILE, T>),
+                    syr_supertile_KARGS(*alpha));
+            else
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_syr_kernel_supertile<false, SYR_TDX, SYR_TDY, SYR_STILE, T>),
+                    syr_supertile_KARGS(*alpha));
+        }
+#undef syr_supertile_KARGS
+        return rocblas_status_success;
+    }
+
     if(rocblas_pointer_mode_device == handle->pointer_mode)
     {
         if(uplo == rocblas_fill_upper)
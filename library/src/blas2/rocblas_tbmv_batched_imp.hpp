@@ -144,7 +144,7 @@ namespace
         RETURN_IF_ROCBLAS_ERROR(setup_batched_array<256>(
             handle->get_stream(), (T*)w_mem_x_copy, n, (T**)w_mem_x_copy_arr, batch_count));
 
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
         if(check_numerics)
         {
             bool           is_input = true;
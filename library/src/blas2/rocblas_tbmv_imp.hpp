@@ -121,7 +121,7 @@ namespace
         if(!w_mem)
             return rocblas_status_memory_error;
 
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
         if(check_numerics)
         {
             bool           is_input = true;
@@ -24,6 +24,7 @@
 #include "../blas1/rocblas_copy_kernels.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_level2_threshold.hpp"
 #include "rocblas_tbmv.hpp"
 
 /**
@@ -152,6 +153,51 @@ __device__ T rocblas_tbmvt_kernel_helper(bool        CONJ,
     return res_A;
 }
 
+/**
+  *  Narrow-band non-transpose variant: one thread per output element. The
+  *  general helper strides its partial-sum columns over all of n, which for a
+  *  small band visits mostly empty columns; here each thread only walks the
+  *  k + 1 columns on its own side of the diagonal, with the loop fully
+  *  unrolled via the NBANDS bound. The transpose helper already iterates only
+  *  over the band, so it keeps the general kernel.
+  */
+template <rocblas_int NB, rocblas_int NBANDS, typename T>
+ROCBLAS_KERNEL_ILF void rocblas_tbmvn_band_kernel_calc(bool        is_upper,
+                                                       bool        is_unit_diag,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       const T*    A,
+                                                       int64_t     lda,
+                                                       const T*    w_x_copy,
+                                                       T*          x,
+                                                       int64_t     incx)
+{
+    rocblas_int ind = blockIdx.x * NB + threadIdx.x;
+    if(ind >= n)
+        return;
+
+    T res_A = 0.0;
+
+#pragma unroll
+    for(rocblas_int b = 0; b < NBANDS; b++)
+    {
+        rocblas_int col = is_upper ? ind + b : ind - b;
+        if(b <= k && col >= 0 && col < n)
+        {
+            // If main diagonal && diag, don't reference matrix, assume 1.
+            if(is_unit_diag && col == ind)
+                res_A += w_x_copy[col];
+            else
+            {
+                rocblas_int row = is_upper ? ind + (k - col) : ind - col;
+                res_A += A[row + col * size_t(lda)] * w_x_copy[col];
+            }
+        }
+    }
+
+    x[ind * int64_t(incx)] = res_A;
+}
+
 /**
   *  A combined kernel to handle all tbmv cases (transpose, conjugate, normal).
   */
@@ -278,6 +324,30 @@ rocblas_tbmvx_kernel(rocblas_operation transA,
         transA, is_upper, is_unit_diag, n, k, A, lda, w_x_copy, x, incx);
 }
 
+template <rocblas_int NB, rocblas_int NBANDS, typename U, typename V>
+ROCBLAS_KERNEL(NB)
+rocblas_tbmvn_band_kernel(bool           is_upper,
+                          bool           is_unit_diag,
+                          rocblas_int    n,
+                          rocblas_int    k,
+                          U              Aa,
+                          rocblas_stride shifta,
+                          int64_t        lda,
+                          rocblas_stride strideA,
+                          U              w_xa_copy,
+                          V              xa,
+                          rocblas_stride shiftx,
+                          int64_t        incx,
+                          rocblas_stride stridex)
+{
+    const auto* A        = load_ptr_batch(Aa, blockIdx.y, shifta, strideA);
+    const auto* w_x_copy = load_ptr_batch(w_xa_copy, blockIdx.y, 0, n);
+    auto*       x        = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+
+    rocblas_tbmvn_band_kernel_calc<NB, NBANDS>(
+        is_upper, is_unit_diag, n, k, A, lda, w_x_copy, x, incx);
+}
+
 /**
   *  First, makes a copy of 'x', then uses a modified gemv algorithm
   *  to perform x := transA(A) * w_x_copy
@@ -333,6 +403,36 @@ rocblas_status rocblas_internal_tbmv_launcher(rocblas_handle    handle,
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
     ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
 
+    if(transA == rocblas_operation_none && k < banded_narrow_band_window)
+    {
+        // narrow band: one thread per element with the band loop fully unrolled
+        static constexpr int NB          = 256;
+        rocblas_int          band_blocks = (n - 1) / NB + 1;
+        dim3                 band_grid(band_blocks, batch_count);
+        dim3                 band_threads(NB);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_tbmvn_band_kernel<NB, banded_narrow_band_window>),
+                              band_grid,
+                              band_threads,
+                              0,
+                              handle->get_stream(),
+                              uplo == rocblas_fill_upper,
+                              diag == rocblas_diagonal_unit,
+                              n,
+                              k,
+                              A,
+                              offseta,
+                              lda,
+                              strideA,
+                              (TConstPtr)w_x_copy,
+                              x,
+                              shiftx,
+                              incx,
+                              stridex);
+
+        return rocblas_status_success;
+    }
+
     // (gemv) TBMVX_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
     static constexpr int TBMVX_DIM_X = 64;
     static constexpr int TBMVX_DIM_Y = 16;
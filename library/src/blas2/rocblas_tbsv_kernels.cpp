@@ -85,8 +85,12 @@ ROCBLAS_KERNEL_ILF void rocblas_tbsv_forward_substitution_calc(
         __syncthreads();
 
         // apply solved diagonal block to the rest of the array
-        // 1. Iterate down rows
-        for(rocblas_int j = BLK_SIZE + i; j < n; j += BLK_SIZE)
+        // 1. Iterate down rows. Only rows within the bandwidth of the solved
+        //    block (rowA <= colA + k for some colA in [i, i + BLK_SIZE - 1])
+        //    can be touched, so the walk stops at the edge of the band instead
+        //    of scanning all remaining rows - this is what keeps the solve
+        //    linear in n for k << n
+        for(rocblas_int j = BLK_SIZE + i; j < n && j <= i + BLK_SIZE - 1 + k; j += BLK_SIZE)
         {
             if(tx + j >= n)
                 break;
@@ -169,8 +173,14 @@ ROCBLAS_KERNEL_ILF void rocblas_tbsv_backward_substitution_calc(
         __syncthreads();
 
         // apply solved diagonal block to the rest of the array
-        // 1. Iterate up rows, starting at the block above the current block
-        for(rocblas_int j = i - BLK_SIZE; j > -BLK_SIZE; j -= BLK_SIZE)
+        // 1. Iterate up rows, starting at the block above the current block.
+        //    Only rows within the bandwidth of the solved block
+        //    (rowA >= colA - k for some colA in [i, i + BLK_SIZE - 1]) can be
+        //    touched, so the walk stops at the edge of the band instead of
+        //    scanning all remaining rows - this is what keeps the solve
+        //    linear in n for k << n
+        for(rocblas_int j = i - BLK_SIZE; j > -BLK_SIZE && j + BLK_SIZE - 1 >= i - k;
+            j -= BLK_SIZE)
         {
             if(tx + j < 0)
                 break;
@@ -130,7 +130,7 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
         if(check_numerics)
         {
             bool           is_input = true;
@@ -28,6 +28,16 @@
 #include "logging.hpp"
 #include "rocblas.h"
 
+// Above this size the launcher uses the tiled in-place algorithm, which
+// keeps the live block of x in LDS and needs neither the n-element
+// workspace nor the copy-back pass (see rocblas_trmv_kernels.cpp)
+constexpr rocblas_int rocblas_trmv_in_place_threshold = 8192;
+
+inline bool rocblas_trmv_use_in_place(int64_t n)
+{
+    return n >= rocblas_trmv_in_place_threshold;
+}
+
 template <typename API_INT, typename T, typename TConstPtr, typename TPtr>
 inline rocblas_status rocblas_trmv_arg_check(rocblas_handle    handle,
                                              rocblas_fill      uplo,
@@ -61,9 +71,14 @@ inline rocblas_status rocblas_trmv_arg_check(rocblas_handle    handle,
         return rocblas_status_success;
     }
 
-    dev_bytes = sizeof(T) * n * batch_count;
+    // large problems use the tiled in-place kernels and need no workspace
+    dev_bytes = rocblas_trmv_use_in_place(n) ? 0 : sizeof(T) * n * batch_count;
     if(handle->is_device_memory_size_query())
+    {
+        if(!dev_bytes)
+            return rocblas_status_size_unchanged;
         return handle->set_optimal_device_memory_size(dev_bytes);
+    }
 
     // pointers are validated if they need to be dereferenced
     if(!A || !x)
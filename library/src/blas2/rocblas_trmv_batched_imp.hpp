@@ -136,7 +136,7 @@ namespace
 
         rocblas_stride stride_w = n;
 
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
 
         if(check_numerics)
         {
@@ -171,6 +171,199 @@ rocblas_trmvt_kernel(rocblas_int    n,
         load_ptr_batch(workspace, blockIdx.y, shiftw, stride_w));
 }
 
+// The in-place kernels below update x one tile at a time and need neither the
+// n-element workspace nor the copy-back pass. A tile's result splits into a
+// triangular part (columns inside the tile) and a rectangular part (columns
+// outside it). The diagonal kernel snapshots the tile of x into LDS before
+// overwriting it, so the triangular part reads consistent values; the
+// off-diagonal kernel then accumulates the rectangular part from elements of x
+// which the tile ordering guarantees are still untouched: tiles are processed
+// in dependency order (ascending when op(A) is upper triangular, descending
+// when it is lower triangular), so a row only ever reads across tiles that
+// have not been processed yet.
+
+template <rocblas_int NB, rocblas_int TILE, bool LOWER, bool CONJ, bool TRANS, bool UNIT, typename T>
+ROCBLAS_KERNEL_ILF void rocblas_trmv_tile_diag_kernel_calc(
+    rocblas_int n, rocblas_int t0, const T* A, int64_t lda, T* x, int64_t incx)
+{
+    // true when op(A) is upper triangular, i.e. row i only depends on x[j], j >= i
+    constexpr bool FORWARD = (LOWER == TRANS);
+
+    __shared__ T xs[TILE];
+
+    rocblas_int tb = n - t0 < TILE ? n - t0 : TILE;
+
+    // snapshot the live tile of x before it is overwritten
+    for(rocblas_int k = threadIdx.x; k < tb; k += NB)
+        xs[k] = x[(t0 + k) * incx];
+
+    __syncthreads();
+
+    for(rocblas_int k = threadIdx.x; k < tb; k += NB)
+    {
+        rocblas_int r = t0 + k;
+
+        T res = UNIT ? xs[k] : (CONJ ? conj(A[r + r * lda]) : A[r + r * lda]) * xs[k];
+
+        for(rocblas_int j = FORWARD ? k + 1 : 0; j < (FORWARD ? tb : k); j++)
+        {
+            rocblas_int c = t0 + j;
+            res += (TRANS ? (CONJ ? conj(A[c + r * lda]) : A[c + r * lda]) : A[r + c * lda])
+                   * xs[j];
+        }
+
+        x[r * incx] = res;
+    }
+}
+
+template <rocblas_int NB, bool LOWER, bool CONJ, bool TRANS, typename T>
+ROCBLAS_KERNEL_ILF void rocblas_trmv_tile_offdiag_kernel_calc(
+    rocblas_int n, rocblas_int t0, rocblas_int tb, const T* A, int64_t lda, T* x, int64_t incx)
+{
+    constexpr bool FORWARD = (LOWER == TRANS);
+
+    // one block per row of the tile; accumulate the rectangular part of the
+    // row against elements of x in tiles not yet processed
+    rocblas_int r = t0 + blockIdx.x;
+
+    rocblas_int col_begin = FORWARD ? t0 + tb : 0;
+    rocblas_int col_end   = FORWARD ? n : t0;
+
+    T res = 0;
+    for(rocblas_int j = col_begin + threadIdx.x; j < col_end; j += NB)
+        res += (TRANS ? (CONJ ? conj(A[j + r * lda]) : A[j + r * lda]) : A[r + j * lda])
+               * x[j * incx];
+
+    res = rocblas_dot_block_reduce<NB>(res);
+
+    // single writer per row, so no atomics are needed
+    if(threadIdx.x == 0)
+        x[r * incx] += res;
+}
+
+template <rocblas_int NB,
+          rocblas_int TILE,
+          bool        LOWER,
+          bool        CONJ,
+          bool        TRANS,
+          bool        UNIT,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_trmv_tile_diag_kernel(rocblas_int    n,
+                              rocblas_int    t0,
+                              TConstPtr      A,
+                              rocblas_stride shifta,
+                              int64_t        lda,
+                              rocblas_stride stride_A,
+                              TPtr           x,
+                              rocblas_stride shift_x,
+                              int64_t        incx,
+                              rocblas_stride stride_x)
+{
+    rocblas_trmv_tile_diag_kernel_calc<NB, TILE, LOWER, CONJ, TRANS, UNIT>(
+        n,
+        t0,
+        load_ptr_batch(A, blockIdx.y, shifta, stride_A),
+        lda,
+        load_ptr_batch(x, blockIdx.y, shift_x, stride_x),
+        incx);
+}
+
+template <rocblas_int NB,
+          bool        LOWER,
+          bool        CONJ,
+          bool        TRANS,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_trmv_tile_offdiag_kernel(rocblas_int    n,
+                                 rocblas_int    t0,
+                                 rocblas_int    tb,
+                                 TConstPtr      A,
+                                 rocblas_stride shifta,
+                                 int64_t        lda,
+                                 rocblas_stride stride_A,
+                                 TPtr           x,
+                                 rocblas_stride shift_x,
+                                 int64_t        incx,
+                                 rocblas_stride stride_x)
+{
+    rocblas_trmv_tile_offdiag_kernel_calc<NB, LOWER, CONJ, TRANS>(
+        n,
+        t0,
+        tb,
+        load_ptr_batch(A, blockIdx.y, shifta, stride_A),
+        lda,
+        load_ptr_batch(x, blockIdx.y, shift_x, stride_x),
+        incx);
+}
+
+template <bool LOWER, bool CONJ, bool TRANS, bool UNIT, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_trmv_in_place_launch(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            TConstPtr      A,
+                                            rocblas_stride offset_A,
+                                            int64_t        lda,
+                                            rocblas_stride stride_A,
+                                            TPtr           x,
+                                            rocblas_stride shift_x,
+                                            int64_t        incx,
+                                            rocblas_stride stride_x,
+                                            rocblas_int    batch_count)
+{
+    constexpr bool FORWARD = (LOWER == TRANS);
+
+    static constexpr rocblas_int NB   = ROCBLAS_TRMV_NB;
+    static constexpr rocblas_int TILE = 1024;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    rocblas_int tiles = (n - 1) / TILE + 1;
+    for(rocblas_int t = 0; t < tiles; t++)
+    {
+        rocblas_int t0 = (FORWARD ? t : tiles - 1 - t) * TILE;
+        rocblas_int tb = n - t0 < TILE ? n - t0 : TILE;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_trmv_tile_diag_kernel<NB, TILE, LOWER, CONJ, TRANS, UNIT>),
+                              dim3(1, batch_count),
+                              dim3(NB),
+                              0,
+                              rocblas_stream,
+                              n,
+                              t0,
+                              A,
+                              offset_A,
+                              lda,
+                              stride_A,
+                              x,
+                              shift_x,
+                              incx,
+                              stride_x);
+
+        // skip rows with an empty rectangular part (first/last tile)
+        if(FORWARD ? t0 + tb < n : t0 > 0)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trmv_tile_offdiag_kernel<NB, LOWER, CONJ, TRANS>),
+                                  dim3(tb, batch_count),
+                                  dim3(NB),
+                                  0,
+                                  rocblas_stream,
+                                  n,
+                                  t0,
+                                  tb,
+                                  A,
+                                  offset_A,
+                                  lda,
+                                  stride_A,
+                                  x,
+                                  shift_x,
+                                  incx,
+                                  stride_x);
+    }
+
+    return rocblas_status_success;
+}
+
 template <typename TConstPtr, typename TPtr, typename TWork>
 rocblas_status rocblas_internal_trmv_launcher(rocblas_handle    handle,
                                               rocblas_fill      uplo,
@@ -201,6 +394,36 @@ rocblas_status rocblas_internal_trmv_launcher(rocblas_handle    handle,
 
     int64_t shift_x = incx < 0 ? offset_x + incx * (1 - n) : offset_x;
 
+    // Large problems use the tiled in-place algorithm; rocblas_trmv_arg_check
+    // uses the same predicate so no workspace was allocated for them.
+    if(rocblas_trmv_use_in_place(n))
+    {
+#define TRMV_IN_PLACE(LOWER_, CONJ_, TRANS_, UNIT_)                                   \
+    rocblas_trmv_in_place_launch<LOWER_, CONJ_, TRANS_, UNIT_>(                       \
+        handle, n, A, offset_A, lda, stride_A, x, shift_x, incx, stride_x, batch_count)
+
+        const bool lower = uplo == rocblas_fill_lower;
+        const bool unit  = diag == rocblas_diagonal_unit;
+
+        if(transA == rocblas_operation_none)
+            return lower ? (unit ? TRMV_IN_PLACE(true, false, false, true)
+                                 : TRMV_IN_PLACE(true, false, false, false))
+                         : (unit ? TRMV_IN_PLACE(false, false, false, true)
+                                 : TRMV_IN_PLACE(false, false, false, false));
+        else if(transA == rocblas_operation_transpose)
+            return lower ? (unit ? TRMV_IN_PLACE(true, false, true, true)
+                                 : TRMV_IN_PLACE(true, false, true, false))
+                         : (unit ? TRMV_IN_PLACE(false, false, true, true)
+                                 : TRMV_IN_PLACE(false, false, true, false));
+        else
+            return lower ? (unit ? TRMV_IN_PLACE(true, true, true, true)
+                                 : TRMV_IN_PLACE(true, true, true, false))
+                         : (unit ? TRMV_IN_PLACE(false, true, true, true)
+                                 : TRMV_IN_PLACE(false, true, true, false));
+
+#undef TRMV_IN_PLACE
+    }
+
     static constexpr rocblas_int NB          = ROCBLAS_TRMV_NB;
     constexpr int                TRMVN_DIM_X = 64;
     constexpr int                TRMVN_DIM_Y = 16;
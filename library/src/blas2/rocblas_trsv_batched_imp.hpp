@@ -134,7 +134,7 @@ namespace
 
         auto w_completed_sec = w_mem[0];
 
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas2);
 
         if(check_numerics)
         {
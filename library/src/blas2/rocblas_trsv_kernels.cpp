@@ -464,6 +464,105 @@ ROCBLAS_KERNEL(1) rocblas_trsv_init(rocblas_int* w_completed_sec)
     w_completed_sec[blockIdx.x] = -1;
 }
 
+// Small-n batched path: one workgroup solves one whole system with the
+// triangle of op(A) staged packed into LDS, so there is no hand-off between
+// workgroups through global memory (and no init kernel or spin counters).
+// Large batches of small solves run fully in parallel across the device.
+template <rocblas_int NB,
+          bool        LOWER,
+          bool        TRANS,
+          bool        CONJ,
+          bool        UNIT,
+          typename T,
+          typename ALPHATYPE,
+          typename ATYPE,
+          typename XTYPE>
+ROCBLAS_KERNEL(NB)
+rocblas_trsv_small_kernel(rocblas_int    n,
+                          ATYPE          dA,
+                          rocblas_stride offset_A,
+                          int64_t        lda,
+                          rocblas_stride stride_A,
+                          ALPHATYPE      alpha_device_host,
+                          XTYPE          dx,
+                          rocblas_stride offset_x,
+                          int64_t        incx,
+                          rocblas_stride stride_x)
+{
+    // op(A) is lower triangular for these combinations (forward substitution)
+    constexpr bool forward = (LOWER && !TRANS) || (!LOWER && TRANS);
+
+    const rocblas_int batchid = blockIdx.x;
+    auto* __restrict__ A      = load_ptr_batch(dA, batchid, offset_A, stride_A);
+    auto* __restrict__ x      = load_ptr_batch(dx, batchid, offset_x, stride_x);
+    T alpha                   = load_scalar(alpha_device_host);
+
+    // Packed column-major triangle of op(A): column j of a lower triangle
+    // starts at j * (2n - j + 1) / 2, of an upper one at j * (j + 1) / 2.
+    T __shared__ sA[NB * (NB + 1) / 2];
+
+    // Solved x values, for broadcasting to the updating threads
+    T __shared__ sx[NB];
+
+    const rocblas_int tx = threadIdx.x;
+
+    // Stage the triangle, iterating over columns of A as stored so the
+    // global reads coalesce; the transpose (and conjugate) is applied on the
+    // way into LDS.
+    for(rocblas_int c = 0; c < n; c++)
+    {
+        if(LOWER ? (tx >= c && tx < n) : tx <= c)
+        {
+            const rocblas_int i = TRANS ? c : tx;
+            const rocblas_int j = TRANS ? tx : c;
+            const size_t      idx
+                = forward ? size_t(j) * (2 * n - j + 1) / 2 + (i - j) : size_t(j) * (j + 1) / 2 + i;
+
+            if(i == j)
+            {
+                // Dividing here so we can just multiply later. A unit
+                // diagonal is not referenced.
+                sA[idx] = UNIT ? T(1) : T(1.0 / (CONJ ? conj(A[c * lda + tx]) : A[c * lda + tx]));
+            }
+            else
+            {
+                sA[idx] = CONJ ? conj(A[c * lda + tx]) : A[c * lda + tx];
+            }
+        }
+    }
+
+    T val = 0;
+    if(tx < n)
+        val = alpha * x[tx * incx];
+
+    __syncthreads();
+
+    // Thread-per-row substitution: the owning thread publishes its solved
+    // element, then every remaining row eliminates it from its local sum.
+    for(rocblas_int k = 0; k < n; k++)
+    {
+        const rocblas_int j = forward ? k : n - 1 - k;
+
+        if(tx == j)
+        {
+            val *= sA[forward ? size_t(j) * (2 * n - j + 1) / 2 : size_t(j) * (j + 1) / 2 + j];
+            sx[j] = val;
+        }
+
+        __syncthreads();
+
+        if(forward ? (tx > j && tx < n) : tx < j)
+        {
+            const size_t idx = forward ? size_t(j) * (2 * n - j + 1) / 2 + (tx - j)
+                                       : size_t(j) * (j + 1) / 2 + tx;
+            val -= sA[idx] * sx[j];
+        }
+    }
+
+    if(tx < n)
+        x[tx * incx] = val;
+}
+
 // If defined, INV_AFTER allows for a block-inversion technique while waiting for data
 // from the previous block.
 // INV_AFTER defines how many block iterations to do using substitution before
@@ -805,10 +904,6 @@ rocblas_status rocblas_internal_trsv_substitution_template(rocblas_handle    han
     dim3                  threads(DIM_X, DIM_Y, 1);
     dim3                  grid(blocks, batch_count);
 
-    // Initialize global variables
-    ROCBLAS_LAUNCH_KERNEL(
-        rocblas_trsv_init, dim3(batch_count), dim3(1), 0, handle->get_stream(), w_completed_sec);
-
     // trsv doesn't need alpha, but trsm using this kernel and does.
     // if alpha is passed as a nullptr, set to 1.0, else use as expected.
     bool alpha_exists = false;
@@ -820,6 +915,97 @@ rocblas_status rocblas_internal_trsv_substitution_template(rocblas_handle    han
             alpha_local = *alpha;
     }
 
+    // Systems small enough to hold the whole packed triangle in LDS take the
+    // one-workgroup-per-system kernel, skipping the init kernel and the
+    // cross-workgroup synchronization entirely
+    constexpr rocblas_int NB_SMALL = sizeof(T) == 4 ? 128 : 64;
+    if(n <= NB_SMALL)
+    {
+        const bool lower = uplo == rocblas_fill_lower;
+        const bool trans = transA != rocblas_operation_none;
+        const bool conj  = transA == rocblas_operation_conjugate_transpose;
+        const bool unit  = diag == rocblas_diagonal_unit;
+
+#define TRSV_SMALL_LAUNCH(LOWER_, TRANS_, CONJ_, UNIT_, alpha_)                           \
+    ROCBLAS_LAUNCH_KERNEL(                                                                \
+        (rocblas_trsv_small_kernel<NB_SMALL, LOWER_, TRANS_, CONJ_, UNIT_, T>),           \
+        dim3(batch_count),                                                                \
+        dim3(NB_SMALL),                                                                   \
+        0,                                                                                \
+        handle->get_stream(),                                                             \
+        n,                                                                                \
+        dA,                                                                               \
+        offset_A,                                                                         \
+        lda,                                                                              \
+        stride_A,                                                                         \
+        alpha_,                                                                           \
+        dx,                                                                               \
+        offset_x,                                                                         \
+        incx,                                                                             \
+        stride_x)
+
+#define TRSV_SMALL_DISPATCH(alpha_)                                    \
+    do                                                                 \
+    {                                                                  \
+        if(lower)                                                      \
+        {                                                              \
+            if(unit)                                                   \
+            {                                                          \
+                if(!trans)                                             \
+                    TRSV_SMALL_LAUNCH(true, false, false, true, alpha_);  \
+                else if(!conj)                                         \
+                    TRSV_SMALL_LAUNCH(true, true, false, true, alpha_);   \
+                else                                                   \
+                    TRSV_SMALL_LAUNCH(true, true, true, true, alpha_);    \
+            }                                                          \
+            else                                                       \
+            {                                                          \
+                if(!trans)                                             \
+                    TRSV_SMALL_LAUNCH(true, false, false, false, alpha_); \
+                else if(!conj)                                         \
+                    TRSV_SMALL_LAUNCH(true, true, false, false, alpha_);  \
+                else                                                   \
+                    TRSV_SMALL_LAUNCH(true, true, true, false, alpha_);   \
+            }                                                          \
+        }                                                              \
+        else                                                           \
+        {                                                              \
+            if(unit)                                                   \
+            {                                                          \
+                if(!trans)                                             \
+                    TRSV_SMALL_LAUNCH(false, false, false, true, alpha_); \
+                else if(!conj)                                         \
+                    TRSV_SMALL_LAUNCH(false, true, false, true, alpha_);  \
+                else                                                   \
+                    TRSV_SMALL_LAUNCH(false, true, true, true, alpha_);   \
+            }                                                          \
+            else                                                       \
+            {                                                          \
+                if(!trans)                                             \
+                    TRSV_SMALL_LAUNCH(false, false, false, false, alpha_); \
+                else if(!conj)                                         \
+                    TRSV_SMALL_LAUNCH(false, true, false, false, alpha_);  \
+                else                                                   \
+                    TRSV_SMALL_LAUNCH(false, true, true, false, alpha_);   \
+            }                                                          \
+        }                                                              \
+    } while(0)
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device && alpha_exists)
+            TRSV_SMALL_DISPATCH(alpha);
+        else
+            TRSV_SMALL_DISPATCH(alpha_local);
+
+#undef TRSV_SMALL_DISPATCH
+#undef TRSV_SMALL_LAUNCH
+
+        return rocblas_status_success;
+    }
+
+    // Initialize global variables
+    ROCBLAS_LAUNCH_KERNEL(
+        rocblas_trsv_init, dim3(batch_count), dim3(1), 0, handle->get_stream(), w_completed_sec);
+
 #define TRSV_TEMPLATE_PARAMS(alpha_)                                                              \
     grid, threads, 0, handle->get_stream(), n, dA, offset_A, lda, stride_A, alpha_, dx, offset_x, \
         incx, stride_x, w_completed_sec
@@ -24,10 +24,11 @@
 
 #ifdef BUILD_WITH_TENSILE
 #include "gemm_tensile.hpp"
-#else
-#include "blas3/rocblas_gemm_source.hpp"
 #endif
 
+// Source tiles also back the small-shape cutover in Tensile builds
+#include "blas3/rocblas_gemm_source.hpp"
+
 #include "blas3/rocblas_gemm.hpp"
 
 #include "check_numerics_matrix.hpp"
@@ -73,6 +74,45 @@ rocblas_status rocblas_internal_gemm(rocblas_handle    handle,
 
 #ifdef BUILD_WITH_TENSILE
 
+    // Small-shape cutover: with m, n and k at or below the source tile edge
+    // and a deep enough batch, Tensile's host-side solution selection and
+    // argument staging cost more than the whole call, so run the
+    // template-dispatched source tiles instead. Restricted to float and
+    // double, whose accumulation type matches on both paths.
+    if constexpr(std::is_same_v<TScal, float> || std::is_same_v<TScal, double>)
+    {
+        if(!handle->is_device_memory_size_query()
+           && rocblas_gemm_source_preferred(m, n, k, batch_count))
+        {
+            return rocblas_gemm_source_solution_64<BATCHED>(handle,
+                                                            trans_a,
+                                                            trans_b,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            *alpha,
+                                                            A,
+                                                            lda,
+                                                            stride_a,
+                                                            offset_a,
+                                                            B,
+                                                            ldb,
+                                                            stride_b,
+                                                            offset_b,
+                                                            *beta,
+                                                            C,
+                                                            ldc,
+                                                            stride_c,
+                                                            offset_c,
+                                                            C,
+                                                            ldc,
+                                                            stride_c,
+                                                            offset_c,
+                                                            batch_count,
+                                                            handle->get_stream());
+        }
+    }
+
     if(BATCHED)
     {
         return rocblas_call_tensile(handle,
@@ -138,7 +178,8 @@ rocblas_status rocblas_internal_gemm(rocblas_handle    handle,
             m, n, *beta, C, offset_c, ldc, stride_c, batch_count, rocblas_stream);
     }
 
-    return rocblas_gemm_source_solution_64<BATCHED>(trans_a,
+    return rocblas_gemm_source_solution_64<BATCHED>(handle,
+                                                    trans_a,
                                                     trans_b,
                                                     m,
                                                     n,
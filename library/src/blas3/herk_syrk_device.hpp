@@ -71,6 +71,55 @@ rocblas_syr2k_scale_kernel(bool           is_upper,
     rocblas_syr2k_scale_device<API_INT, HERK>(is_upper, n, beta, C, ldc);
 }
 
+/**
+  *  Scales only the nb x nb diagonal blocks of C. Used by the syrkx/herkx path
+  *  where beta for the off-diagonal blocks is applied by the gemm calls, so a
+  *  full traversal of C is not needed. tx indexes a row within the diagonal
+  *  block owning column ty.
+  */
+template <typename API_INT, int DIM_X, int DIM_Y, bool HERK, typename U, typename V, typename W>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_syr2k_scale_diag_kernel(bool           is_upper,
+                                rocblas_int    n,
+                                rocblas_int    nb,
+                                API_INT        k,
+                                U              alpha_host_device,
+                                V              beta_host_device,
+                                W              CP_array,
+                                API_INT        ldc,
+                                rocblas_stride c_st_or_of)
+{
+    auto beta = load_scalar(beta_host_device);
+
+    if((!HERK && beta == 1))
+        return;
+    else if(HERK)
+    {
+        // for herk, if alpha != 0 we need imaginary clear on diagonal
+        auto alpha = load_scalar(alpha_host_device);
+        if(beta == 1 && (k == 0 || alpha == 0))
+            return;
+    }
+
+    auto ty = blockIdx.y * blockDim.y + threadIdx.y;
+    auto tl = blockIdx.x * blockDim.x + threadIdx.x; // row within the diagonal block
+    if(ty >= n || tl >= nb)
+        return;
+    auto tx = (ty / nb) * nb + tl;
+
+    int from = is_upper ? tx : ty;
+    int to   = is_upper ? ty : tx;
+
+    if(tx < n && from <= to)
+    {
+        auto  C = load_ptr_batch(CP_array, hipBlockIdx_z, c_st_or_of);
+        auto& e = C[ty * size_t(ldc) + tx];
+        e       = beta ? beta * e : 0;
+        if(HERK && from == to)
+            e = std::real(e);
+    }
+}
+
 template <typename API_INT,
           typename T,
           int  DIM,
@@ -1040,6 +1089,8 @@ template <typename API_INT,
           typename T,
           typename U>
 ROCBLAS_KERNEL_ILF void rocblas_syr2k_her2k_mult_add_device(bool        is_upper,
+                                                            rocblas_int row_pos,
+                                                            rocblas_int col_pos,
                                                             rocblas_int n,
                                                             API_INT     k,
                                                             U           alpha,
@@ -1051,21 +1102,11 @@ ROCBLAS_KERNEL_ILF void rocblas_syr2k_her2k_mult_add_device(bool        is_upper
                                                             API_INT ldc)
 {
     // if !alpha this function isn't called
+    // caller enumerates only the tiles which overlap the stored triangle
 
     __shared__ T atile[TILE_NK][TILE_NK];
     __shared__ T btile[TILE_NK][TILE_NK];
 
-    int col_pos = blockIdx.y * TILE_NK;
-    int row_pos = blockIdx.x * TILE_NK;
-
-    int tilefrom = is_upper ? row_pos : col_pos;
-    int tileto   = is_upper ? col_pos : row_pos;
-    if(tilefrom > tileto)
-    {
-        // any overlap of tile and output
-        return;
-    }
-
     API_INT ab_rows = !TRANS ? n : k;
     API_INT ab_cols = !TRANS ? k : n;
 
@@ -1075,6 +1116,12 @@ ROCBLAS_KERNEL_ILF void rocblas_syr2k_her2k_mult_add_device(bool        is_upper
     int from = is_upper ? row : col;
     int to   = is_upper ? col : row;
 
+    // both products are accumulated in registers across the whole k loop and
+    // C is read and written exactly once at the end, instead of one
+    // read-modify-write of C per product per k tile
+    T sum_ab = T(0); // op(A) * op(B)^T (^H when HERM) contribution
+    T sum_ba = T(0); // op(B) * op(A)^T contribution, TWOK only
+
     for(API_INT k_pos = 0; k_pos < k; k_pos += TILE_NK)
     {
         // tiling over dimension K
@@ -1112,12 +1159,10 @@ ROCBLAS_KERNEL_ILF void rocblas_syr2k_her2k_mult_add_device(bool        is_upper
         // n x n symmetric/Hermitian output, tile zero where invalid
         if(row < n && col < n && from <= to)
         {
-            T sum = T(0);
             for(int ki = 0; ki < TILE_NK; ++ki)
             {
-                sum += atile[threadIdx.x][ki] * btile[ki][threadIdx.y];
+                sum_ab += atile[threadIdx.x][ki] * btile[ki][threadIdx.y];
             }
-            C[col * size_t(ldc) + row] += alpha * sum;
         }
 
         __syncthreads();
@@ -1152,12 +1197,10 @@ ROCBLAS_KERNEL_ILF void rocblas_syr2k_her2k_mult_add_device(bool        is_upper
             // n x n symmetric/Hermitian output, tile zero where invalid
             if(row < n && col < n && from <= to)
             {
-                T sum = T(0);
                 for(int ki = 0; ki < TILE_NK; ++ki)
                 {
-                    sum += atile[threadIdx.x][ki] * btile[ki][threadIdx.y];
+                    sum_ba += atile[threadIdx.x][ki] * btile[ki][threadIdx.y];
                 }
-                C[col * size_t(ldc) + row] += (HERM ? conj(alpha) : alpha) * sum;
             }
 
             __syncthreads();
@@ -1165,6 +1208,15 @@ ROCBLAS_KERNEL_ILF void rocblas_syr2k_her2k_mult_add_device(bool        is_upper
 
     } // k_pos
 
+    // single fused update of C with both scaled products
+    if(row < n && col < n && from <= to)
+    {
+        T acc = alpha * sum_ab;
+        if(TWOK)
+            acc += (HERM ? conj(alpha) : alpha) * sum_ba;
+        C[col * size_t(ldc) + row] += acc;
+    }
+
     if(!TWOK && HERM && row == col && row < n)
     {
         // zero imaginary for cases when A*B aren't true Hermitian
@@ -1206,10 +1258,24 @@ rocblas_syr2k_her2k_kernel(bool           is_upper,
     auto B = load_ptr_batch(BP_array, hipBlockIdx_z, b_st_or_of);
     auto C = load_ptr_batch(CP_array, hipBlockIdx_z, c_st_or_of);
 
+    // blockIdx.x is a linear index over the triangular tile set; recover the
+    // block coordinates (ti, tj), tj <= ti, by inverting tid = ti*(ti+1)/2 + tj.
+    // The float sqrt is only a first guess; the fixup loops make it exact.
+    rocblas_int tid = blockIdx.x;
+    rocblas_int ti  = rocblas_int((sqrtf(8.0f * tid + 1.0f) - 1.0f) * 0.5f);
+    while(ti * (ti + 1) / 2 > tid)
+        ti--;
+    while((ti + 1) * (ti + 2) / 2 <= tid)
+        ti++;
+    rocblas_int tj = tid - ti * (ti + 1) / 2;
+
+    rocblas_int row_pos = (is_upper ? tj : ti) * DIM_XYT;
+    rocblas_int col_pos = (is_upper ? ti : tj) * DIM_XYT;
+
     // compute matrix multiplies and accumulate on the fly into C
     // when HERM does ^H in place of ^T
     rocblas_syr2k_her2k_mult_add_device<API_INT, TWOK, HERM, TRANS, DIM_XYT>(
-        is_upper, n, k, alpha, A, lda, B, ldb, C, ldc);
+        is_upper, row_pos, col_pos, n, k, alpha, A, lda, B, ldb, C, ldc);
 }
 
 template <typename API_INT,
@@ -1236,9 +1302,11 @@ rocblas_status rocblas_syr2k_her2k_dispatch(rocblas_fill      uplo,
                                             rocblas_int       batch_count,
                                             hipStream_t       stream)
 {
+    // launch one block per tile of the stored triangle rather than the full
+    // square tile grid; the kernel maps blockIdx.x back to tile coordinates
     rocblas_int bx = (n - 1) / (DIM_XYT) + 1;
-    rocblas_int by = (n - 1) / (DIM_XYT) + 1;
-    dim3        syr2k_grid(bx, by, batch_count);
+    rocblas_int nt = bx * (bx + 1) / 2;
+    dim3        syr2k_grid(nt, 1, batch_count);
     dim3        syr2k_threads(DIM_XYT, DIM_XYT);
 
     if(trans == rocblas_operation_none)
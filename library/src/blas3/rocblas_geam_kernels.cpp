@@ -164,10 +164,69 @@ rocblas_geam_2matrix_device(rocblas_operation transA,
     }
 }
 
+//  special case:
+//  beta == 0 and transA != none, so C <- alpha * A^T (or A^H). The element-wise
+//  kernel above makes each lane stride by lda on one side of the copy; here a
+//  TILE_DIM x TILE_DIM tile goes through padded LDS so the reads of A and the
+//  writes of C both coalesce
+template <int TILE_DIM, int BLOCK_ROWS, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(TILE_DIM* BLOCK_ROWS)
+rocblas_geam_transpose_device(bool           is_conj,
+                              rocblas_int    m,
+                              rocblas_int    n,
+                              TScal          alpha_device_host,
+                              TConstPtr      Aa,
+                              rocblas_stride offset_a,
+                              int64_t        lda,
+                              rocblas_stride stride_a,
+                              TPtr           Ca,
+                              rocblas_stride offset_c,
+                              int64_t        ldc,
+                              rocblas_stride stride_c)
+{
+    auto alpha = load_scalar(alpha_device_host);
+    using T    = std::decay_t<decltype(alpha)>;
+
+    auto* A = load_ptr_batch(Aa, blockIdx.z, offset_a, stride_a);
+    auto* C = load_ptr_batch(Ca, blockIdx.z, offset_c, stride_c);
+
+    // +1 padding keeps the transposed reads below free of bank conflicts
+    __shared__ T tile[TILE_DIM][TILE_DIM + 1];
+
+    const rocblas_int row0 = blockIdx.x * TILE_DIM; // rows of C
+    const rocblas_int col0 = blockIdx.y * TILE_DIM; // cols of C
+
+    // read the corresponding tile of A (rows of A are cols of C and vice
+    // versa), coalesced along A's rows
+    for(int j = 0; j < TILE_DIM; j += BLOCK_ROWS)
+    {
+        rocblas_int a_row = col0 + threadIdx.x;
+        rocblas_int a_col = row0 + threadIdx.y + j;
+        if(a_row < n && a_col < m)
+            tile[threadIdx.y + j][threadIdx.x] = A[a_row + a_col * lda];
+    }
+
+    __syncthreads();
+
+    // write the tile transposed, coalesced along C's rows
+    for(int j = 0; j < TILE_DIM; j += BLOCK_ROWS)
+    {
+        rocblas_int c_row = row0 + threadIdx.x;
+        rocblas_int c_col = col0 + threadIdx.y + j;
+        if(c_row < m && c_col < n)
+        {
+            auto a_val = tile[threadIdx.x][threadIdx.y + j];
+            if(is_conj)
+                a_val = conj(a_val);
+            C[c_row + c_col * ldc] = alpha * a_val;
+        }
+    }
+}
+
 // special cases where: lda=ldb=ldc=m && transA==transB=none so matrices
 // are contiguous, there are no transposes, and therefore matrices
 // can be treated as contiguous vectors
-template <int DIM_X, typename TScal, typename TConstPtr, typename TPtr>
+template <int DIM_X, bool STREAM, typename TScal, typename TConstPtr, typename TPtr>
 ROCBLAS_KERNEL(DIM_X)
 rocblas_geam_1D_device(size_t         size,
                        TScal          alpha_device_host,
@@ -191,16 +250,19 @@ rocblas_geam_1D_device(size_t         size,
 
         auto* C = load_ptr_batch(Ca, blockIdx.y, offset_c, stride_c);
 
+        using Tval = std::remove_cv_t<std::remove_pointer_t<decltype(C)>>;
+
         if(alpha == 0 && beta == 0)
         {
-            C[tx] = 0;
+            rocblas_store<STREAM>(Tval(0), C + tx);
         }
         else
         {
             auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, offset_a, stride_a);
             auto* B = cond_load_ptr_batch(beta, Ba, blockIdx.y, offset_b, stride_b);
 
-            C[tx] = (beta ? beta * B[tx] : 0) + (alpha ? alpha * A[tx] : 0);
+            rocblas_store<STREAM>(Tval((beta ? beta * B[tx] : 0) + (alpha ? alpha * A[tx] : 0)),
+                                  C + tx);
         }
     }
 }
@@ -209,7 +271,7 @@ rocblas_geam_1D_device(size_t         size,
 // are contiguous, there are no transposes, and therefore matrices
 // can be treated as contiguous vectors.
 // Also, alpha == 0  ||  beta == 0  so only one matrix contributes
-template <int DIM_X, typename TScal, typename TConstPtr, typename TPtr>
+template <int DIM_X, bool STREAM, typename TScal, typename TConstPtr, typename TPtr>
 ROCBLAS_KERNEL(DIM_X)
 rocblas_geam_1D_2matrix_device(size_t         size,
                                TScal          alpha_device_host,
@@ -228,14 +290,95 @@ rocblas_geam_1D_2matrix_device(size_t         size,
 
         auto* C = load_ptr_batch(Ca, blockIdx.y, offset_c, stride_c);
 
+        using Tval = std::remove_cv_t<std::remove_pointer_t<decltype(C)>>;
+
         if(alpha == 0)
         {
-            C[tx] = 0;
+            rocblas_store<STREAM>(Tval(0), C + tx);
         }
         else
         {
             auto* A = load_ptr_batch(Aa, blockIdx.y, offset_a, stride_a);
-            C[tx]   = alpha * A[tx];
+            rocblas_store<STREAM>(Tval(alpha * A[tx]), C + tx);
+        }
+    }
+}
+
+// Vectorized variant of the 1D special case: each thread moves one 128-bit
+// quantity (float4/double2) per matrix. Selected by the launcher when the
+// total size, offsets and strides are all multiples of the vector width.
+// geam is pure bandwidth, so the wider accesses recover the throughput lost
+// to scalar loads.
+template <int DIM_X, typename TV, bool STREAM, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(DIM_X)
+rocblas_geam_1D_vector_device(size_t         size_vec,
+                              TScal          alpha_device_host,
+                              TConstPtr      Aa,
+                              rocblas_stride offset_a,
+                              rocblas_stride stride_a,
+                              TScal          beta_device_host,
+                              TConstPtr      Ba,
+                              rocblas_stride offset_b,
+                              rocblas_stride stride_b,
+                              TPtr           Ca,
+                              rocblas_stride offset_c,
+                              rocblas_stride stride_c)
+{
+    size_t tx = size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+
+    if(tx < size_vec)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+
+        auto* C  = load_ptr_batch(Ca, blockIdx.y, offset_c, stride_c);
+        TV*   cv = (TV*)C;
+
+        if(alpha == 0 && beta == 0)
+        {
+            rocblas_store<STREAM>(TV{}, cv + tx);
+        }
+        else
+        {
+            auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, offset_a, stride_a);
+            auto* B = cond_load_ptr_batch(beta, Ba, blockIdx.y, offset_b, stride_b);
+
+            rocblas_store<STREAM>(TV((beta ? ((const TV*)B)[tx] * beta : TV{})
+                                     + (alpha ? ((const TV*)A)[tx] * alpha : TV{})),
+                                  cv + tx);
+        }
+    }
+}
+
+// Vectorized variant of the 1D 2-matrix special case (alpha == 0 || beta == 0)
+template <int DIM_X, typename TV, bool STREAM, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(DIM_X)
+rocblas_geam_1D_2matrix_vector_device(size_t         size_vec,
+                                      TScal          alpha_device_host,
+                                      TConstPtr      Aa,
+                                      rocblas_stride offset_a,
+                                      rocblas_stride stride_a,
+                                      TPtr           Ca,
+                                      rocblas_stride offset_c,
+                                      rocblas_stride stride_c)
+{
+    size_t tx = size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+
+    if(tx < size_vec)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+
+        auto* C  = load_ptr_batch(Ca, blockIdx.y, offset_c, stride_c);
+        TV*   cv = (TV*)C;
+
+        if(alpha == 0)
+        {
+            rocblas_store<STREAM>(TV{}, cv + tx);
+        }
+        else
+        {
+            auto* A = load_ptr_batch(Aa, blockIdx.y, offset_a, stride_a);
+            rocblas_store<STREAM>(TV(((const TV*)A)[tx] * alpha), cv + tx);
         }
     }
 }
@@ -345,6 +488,16 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
     hipStream_t rocblas_stream = handle->get_stream();
 
     auto pointer_mode = handle->pointer_mode;
+
+    // 128-bit vector width for the contiguous 1D special cases below
+    using T = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<std::remove_pointer_t<TPtr>>>>;
+    static constexpr int VEC = std::is_same_v<T, float> ? 4 : std::is_same_v<T, double> ? 2 : 1;
+    using TV = std::conditional_t<std::is_same_v<T, float>, rocblas_float4, rocblas_double2>;
+
+    // C is write-once in the contiguous 1D special cases below; once it is too
+    // large for L2 to retain, stream the stores past the cache so the operands
+    // of following calls stay resident
+    const bool stream_store = sizeof(T) * size_t(m) * n >= c_rocblas_stream_store_min_bytes;
     if(pointer_mode == rocblas_pointer_mode_host && !*alpha && !*beta)
     {
         static constexpr int GEAM_DIM_X = 16;
@@ -492,18 +645,73 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
             dim3 geam_grid(blocks, batch_count);
             dim3 geam_threads(GEAM_DIM);
 
-            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_2matrix_device<GEAM_DIM>),
+            if constexpr(VEC > 1)
+            {
+                if(!(size % VEC) && !(offset_a % VEC) && !(offset_c % VEC) && !(stride_a % VEC)
+                   && !(stride_c % VEC))
+                {
+                    size_t size_vec = size / VEC;
+                    dim3   vec_grid((size_vec - 1) / GEAM_DIM + 1, batch_count);
+
+#define geam_1D_2m_vec_KARGS                                                            \
+    vec_grid, geam_threads, 0, rocblas_stream, size_vec, *alpha, A, offset_a, stride_a, \
+        C, offset_c, stride_c
+
+                    if(stream_store)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_geam_1D_2matrix_vector_device<GEAM_DIM, TV, true>),
+                            geam_1D_2m_vec_KARGS);
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_geam_1D_2matrix_vector_device<GEAM_DIM, TV, false>),
+                            geam_1D_2m_vec_KARGS);
+#undef geam_1D_2m_vec_KARGS
+
+                    return rocblas_status_success;
+                }
+            }
+
+#define geam_1D_2m_KARGS                                                            \
+    geam_grid, geam_threads, 0, rocblas_stream, size, *alpha, A, offset_a, stride_a, \
+        C, offset_c, stride_c
+
+            if(stream_store)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_2matrix_device<GEAM_DIM, true>),
+                                      geam_1D_2m_KARGS);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_2matrix_device<GEAM_DIM, false>),
+                                      geam_1D_2m_KARGS);
+#undef geam_1D_2m_KARGS
+        }
+        else if(transA != rocblas_operation_none && *alpha != 0)
+        {
+            // beta == 0 and A is transposed: C <- alpha * op(A) is a pure
+            // (scaled) transpose, done tiled through LDS so both sides coalesce
+            static constexpr int TRANSPOSE_DIM  = 32;
+            static constexpr int TRANSPOSE_ROWS = 8;
+
+            rocblas_int blocksX = (m - 1) / TRANSPOSE_DIM + 1;
+            rocblas_int blocksY = (n - 1) / TRANSPOSE_DIM + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(TRANSPOSE_DIM, TRANSPOSE_ROWS);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_transpose_device<TRANSPOSE_DIM, TRANSPOSE_ROWS>),
                                   geam_grid,
                                   geam_threads,
                                   0,
                                   rocblas_stream,
-                                  size,
+                                  transA == rocblas_operation_conjugate_transpose,
+                                  m,
+                                  n,
                                   *alpha,
                                   A,
                                   offset_a,
+                                  lda,
                                   stride_a,
                                   C,
                                   offset_c,
+                                  ldc,
                                   stride_c);
         }
         else
@@ -551,18 +759,73 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
             dim3 geam_grid(blocks, batch_count);
             dim3 geam_threads(GEAM_DIM);
 
-            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_2matrix_device<GEAM_DIM>),
+            if constexpr(VEC > 1)
+            {
+                if(!(size % VEC) && !(offset_b % VEC) && !(offset_c % VEC) && !(stride_b % VEC)
+                   && !(stride_c % VEC))
+                {
+                    size_t size_vec = size / VEC;
+                    dim3   vec_grid((size_vec - 1) / GEAM_DIM + 1, batch_count);
+
+#define geam_1D_2m_vec_KARGS                                                           \
+    vec_grid, geam_threads, 0, rocblas_stream, size_vec, *beta, B, offset_b, stride_b, \
+        C, offset_c, stride_c
+
+                    if(stream_store)
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_geam_1D_2matrix_vector_device<GEAM_DIM, TV, true>),
+                            geam_1D_2m_vec_KARGS);
+                    else
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_geam_1D_2matrix_vector_device<GEAM_DIM, TV, false>),
+                            geam_1D_2m_vec_KARGS);
+#undef geam_1D_2m_vec_KARGS
+
+                    return rocblas_status_success;
+                }
+            }
+
+#define geam_1D_2m_KARGS                                                           \
+    geam_grid, geam_threads, 0, rocblas_stream, size, *beta, B, offset_b, stride_b, \
+        C, offset_c, stride_c
+
+            if(stream_store)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_2matrix_device<GEAM_DIM, true>),
+                                      geam_1D_2m_KARGS);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_2matrix_device<GEAM_DIM, false>),
+                                      geam_1D_2m_KARGS);
+#undef geam_1D_2m_KARGS
+        }
+        else if(transB != rocblas_operation_none && *beta != 0)
+        {
+            // alpha == 0 and B is transposed: same tiled transpose as the
+            // beta == 0 case above, with B contributing
+            static constexpr int TRANSPOSE_DIM  = 32;
+            static constexpr int TRANSPOSE_ROWS = 8;
+
+            rocblas_int blocksX = (m - 1) / TRANSPOSE_DIM + 1;
+            rocblas_int blocksY = (n - 1) / TRANSPOSE_DIM + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(TRANSPOSE_DIM, TRANSPOSE_ROWS);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_transpose_device<TRANSPOSE_DIM, TRANSPOSE_ROWS>),
                                   geam_grid,
                                   geam_threads,
                                   0,
                                   rocblas_stream,
-                                  size,
+                                  transB == rocblas_operation_conjugate_transpose,
+                                  m,
+                                  n,
                                   *beta,
                                   B,
                                   offset_b,
+                                  ldb,
                                   stride_b,
                                   C,
                                   offset_c,
+                                  ldc,
                                   stride_c);
         }
         else
@@ -604,52 +867,73 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
         // A, B, C are contiguous, and A and B are normal (not transpose)
         static constexpr int GEAM_DIM = 256;
         size_t               size     = size_t(m) * n;
-        int                  blocks   = (size - 1) / GEAM_DIM + 1;
+
+        if constexpr(VEC > 1)
+        {
+            if(!(size % VEC) && !(offset_a % VEC) && !(offset_b % VEC) && !(offset_c % VEC)
+               && !(stride_a % VEC) && !(stride_b % VEC) && !(stride_c % VEC))
+            {
+                size_t size_vec = size / VEC;
+                dim3   vec_grid((size_vec - 1) / GEAM_DIM + 1, batch_count);
+                dim3   vec_threads(GEAM_DIM);
+
+#define geam_1D_vec_KARGS(alpha_, beta_)                                                 \
+    vec_grid, vec_threads, 0, rocblas_stream, size_vec, alpha_, A, offset_a, stride_a,   \
+        beta_, B, offset_b, stride_b, C, offset_c, stride_c
+
+                if(rocblas_pointer_mode_host == pointer_mode)
+                {
+                    if(stream_store)
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_vector_device<GEAM_DIM, TV, true>),
+                                              geam_1D_vec_KARGS(*alpha, *beta));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_vector_device<GEAM_DIM, TV, false>),
+                                              geam_1D_vec_KARGS(*alpha, *beta));
+                }
+                else
+                {
+                    if(stream_store)
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_vector_device<GEAM_DIM, TV, true>),
+                                              geam_1D_vec_KARGS(alpha, beta));
+                    else
+                        ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_vector_device<GEAM_DIM, TV, false>),
+                                              geam_1D_vec_KARGS(alpha, beta));
+                }
+#undef geam_1D_vec_KARGS
+
+                return rocblas_status_success;
+            }
+        }
+
+        int blocks = (size - 1) / GEAM_DIM + 1;
         // GEAM_DIM needs to be large to prevent blocks overflowing int datatype.
 
         dim3 geam_grid(blocks, batch_count);
         dim3 geam_threads(GEAM_DIM);
 
+#define geam_1D_KARGS(alpha_, beta_)                                                   \
+    geam_grid, geam_threads, 0, rocblas_stream, size, alpha_, A, offset_a, stride_a,   \
+        beta_, B, offset_b, stride_b, C, offset_c, stride_c
+
         if(rocblas_pointer_mode_host == pointer_mode)
         {
-            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_device<GEAM_DIM>),
-                                  geam_grid,
-                                  geam_threads,
-                                  0,
-                                  rocblas_stream,
-                                  size,
-                                  *alpha,
-                                  A,
-                                  offset_a,
-                                  stride_a,
-                                  *beta,
-                                  B,
-                                  offset_b,
-                                  stride_b,
-                                  C,
-                                  offset_c,
-                                  stride_c);
+            if(stream_store)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_device<GEAM_DIM, true>),
+                                      geam_1D_KARGS(*alpha, *beta));
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_device<GEAM_DIM, false>),
+                                      geam_1D_KARGS(*alpha, *beta));
         }
         else
         {
-            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_device<GEAM_DIM>),
-                                  geam_grid,
-                                  geam_threads,
-                                  0,
-                                  rocblas_stream,
-                                  size,
-                                  alpha,
-                                  A,
-                                  offset_a,
-                                  stride_a,
-                                  beta,
-                                  B,
-                                  offset_b,
-                                  stride_b,
-                                  C,
-                                  offset_c,
-                                  stride_c);
+            if(stream_store)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_device<GEAM_DIM, true>),
+                                      geam_1D_KARGS(alpha, beta));
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_geam_1D_device<GEAM_DIM, false>),
+                                      geam_1D_KARGS(alpha, beta));
         }
+#undef geam_1D_KARGS
     }
     else
     {
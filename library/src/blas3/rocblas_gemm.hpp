@@ -43,19 +43,24 @@ rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(
         {
             if(k == 0)
                 alpha_h = 0;
-            else
+            else if(!handle->try_peek_device_scalar((const Tac*)alpha, alpha_h))
             {
                 RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                     &alpha_h, alpha, sizeof(Tac), hipMemcpyDeviceToHost, handle->get_stream()));
                 RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+                handle->note_device_scalar((const Tac*)alpha, alpha_h);
             }
             alpha = &alpha_h;
         }
         if(beta)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-                &beta_h, beta, sizeof(Tbc), hipMemcpyDeviceToHost, handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            if(!handle->try_peek_device_scalar((const Tbc*)beta, beta_h))
+            {
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                    &beta_h, beta, sizeof(Tbc), hipMemcpyDeviceToHost, handle->get_stream()));
+                RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+                handle->note_device_scalar((const Tbc*)beta, beta_h);
+            }
             beta = &beta_h;
         }
     }
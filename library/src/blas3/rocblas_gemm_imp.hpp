@@ -21,6 +21,7 @@
  ************************************************************************** */
 #pragma once
 
+#include "cpu_overhead.hpp"
 #include "int64_helpers.hpp"
 #include "logging.hpp"
 #include "rocblas_gemm.hpp"
@@ -62,6 +63,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_internal_cpu_overhead_timer overhead_timer(handle,
+                                                           rocblas_internal_cpu_family_blas3);
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         // Copy alpha and beta to host if on device
@@ -72,7 +76,7 @@ namespace
 
         // Perform logging
         auto layer_mode     = handle->layer_mode;
-        auto check_numerics = handle->check_numerics;
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_gemm);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
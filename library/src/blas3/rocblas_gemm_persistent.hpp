@@ -0,0 +1,283 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <atomic>
+#include <thread>
+
+/**
+  * Opt-in persistent kernel mode for repeated small GEMMs
+  * (ROCBLAS_GEMM_PERSISTENT). A resident kernel launched once on an internal
+  * stream polls a ring of job descriptors; rocblas_gemm_ex enqueues a
+  * descriptor and bumps a device-side doorbell with hipStreamWriteValue64 on
+  * the user stream, then makes the user stream wait on the device-side
+  * completion counter with hipStreamWaitValue64. This keeps full stream
+  * ordering with surrounding work while removing the per-call kernel launch
+  * from the critical path. Currently limited to non-batched float GEMM, the
+  * shape served by the source kernel fast path.
+  */
+
+// ring capacity; the enqueue path throttles when all slots are in flight
+inline constexpr uint32_t c_gemm_persistent_slots = 64;
+
+struct rocblas_gemm_persistent_job
+{
+    const float* A;
+    const float* B;
+    const float* C;
+    float*       D;
+    int64_t      lda, ldb, ldc, ldd;
+    int32_t      m, n, k;
+    char         trans_a, trans_b; // 'N' or 'T'
+    float        alpha, beta;
+};
+
+struct rocblas_gemm_persistent_queue
+{
+    rocblas_gemm_persistent_job* jobs = nullptr; // pinned; host written, device read
+
+    uint64_t* doorbell     = nullptr; // device; bumped via hipStreamWriteValue64
+    uint64_t* complete_dev = nullptr; // device; waited on via hipStreamWaitValue64
+    uint64_t* blocks_done  = nullptr; // device; cumulative per-block job completions
+
+    uint64_t* complete_host = nullptr; // pinned; device written, read to throttle
+    uint32_t* quit          = nullptr; // pinned; set by the host on shutdown
+
+    hipStream_t stream   = nullptr; // the resident kernel runs here
+    uint64_t    enqueued = 0; // jobs issued so far (host side)
+    bool        running  = false;
+};
+
+/**
+  * Resident kernel. Every block independently polls the doorbell for the next
+  * job, grid-strides over the BLK x BLK tiles of D, and then joins a
+  * device-wide barrier (safe because the grid is one block per CU, so all
+  * blocks are co-resident) before moving to the next job, since one job's
+  * output may be the next job's input.
+  */
+template <int BLK>
+ROCBLAS_KERNEL(BLK* BLK)
+rocblas_gemm_persistent_kernel(const rocblas_gemm_persistent_job* jobs,
+                               const uint64_t*                    doorbell,
+                               uint64_t*                          complete_dev,
+                               uint64_t*                          complete_host,
+                               uint64_t*                          blocks_done,
+                               const uint32_t*                    quit)
+{
+    int thx = threadIdx.x;
+    int thy = threadIdx.y;
+
+    __shared__ float sA[BLK][BLK + 1];
+    __shared__ float sB[BLK][BLK + 1];
+    __shared__ bool  s_quit;
+
+    for(uint64_t job_id = 0;; ++job_id)
+    {
+        // wait for the doorbell to pass this job, or for shutdown once drained
+        if(thx == 0 && thy == 0)
+        {
+            s_quit = false;
+            while(*(volatile const uint64_t*)doorbell <= job_id)
+            {
+                if(*(volatile const uint32_t*)quit)
+                {
+                    s_quit = true;
+                    break;
+                }
+            }
+        }
+        __syncthreads();
+        if(s_quit)
+            return;
+        __threadfence_system(); // acquire the descriptor written before the doorbell
+
+        rocblas_gemm_persistent_job job = jobs[job_id % c_gemm_persistent_slots];
+
+        int32_t m_tiles = (job.m - 1) / BLK + 1;
+        int32_t n_tiles = (job.n - 1) / BLK + 1;
+
+        for(int64_t t = blockIdx.x; t < int64_t(m_tiles) * n_tiles; t += gridDim.x)
+        {
+            int64_t row = int64_t(t % m_tiles) * BLK + thx;
+            int64_t col = int64_t(t / m_tiles) * BLK + thy;
+
+            float acc = 0;
+            for(int32_t kk = 0; kk < job.k; kk += BLK)
+            {
+                int64_t ka = kk + thy;
+                sA[thy][thx]
+                    = (row < job.m && ka < job.k)
+                          ? (job.trans_a == 'N' ? job.A[row + ka * size_t(job.lda)]
+                                                : job.A[ka + row * size_t(job.lda)])
+                          : 0.0f;
+
+                int64_t kb = kk + thx;
+                sB[thy][thx]
+                    = (kb < job.k && col < job.n)
+                          ? (job.trans_b == 'N' ? job.B[kb + col * size_t(job.ldb)]
+                                                : job.B[col + kb * size_t(job.ldb)])
+                          : 0.0f;
+
+                __syncthreads();
+
+                for(int k0 = 0; k0 < BLK; ++k0)
+                    acc += sA[k0][thx] * sB[thy][k0];
+
+                __syncthreads();
+            }
+
+            if(row < job.m && col < job.n)
+            {
+                if(job.beta != 0)
+                    job.D[row + col * size_t(job.ldd)]
+                        = job.alpha * acc + job.beta * job.C[row + col * size_t(job.ldc)];
+                else
+                    job.D[row + col * size_t(job.ldd)] = job.alpha * acc;
+            }
+        }
+
+        // make D visible, then the last block to finish publishes completion
+        __threadfence_system();
+        __syncthreads();
+        if(thx == 0 && thy == 0)
+        {
+            if(atomicAdd((unsigned long long*)blocks_done, 1ull) + 1
+               == (job_id + 1) * gridDim.x)
+            {
+                *(volatile uint64_t*)complete_host = job_id + 1;
+                *(volatile uint64_t*)complete_dev  = job_id + 1;
+                __threadfence_system();
+            }
+            // device-wide barrier before any block starts the next job
+            while(*(volatile const uint64_t*)complete_dev <= job_id) {}
+        }
+        __syncthreads();
+    }
+}
+
+/**
+  *  Allocates the ring and launches the resident kernel. Returns
+  *  rocblas_status_not_implemented when the device cannot service
+  *  hipStreamWaitValue, leaving the queue inactive.
+  */
+inline rocblas_status rocblas_gemm_persistent_start(rocblas_gemm_persistent_queue* q)
+{
+    int device = 0;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+
+    int can_wait_value = 0;
+    RETURN_IF_HIP_ERROR(
+        hipDeviceGetAttribute(&can_wait_value, hipDeviceAttributeCanUseStreamWaitValue, device));
+    if(!can_wait_value)
+        return rocblas_status_not_implemented;
+
+    hipDeviceProp_t props;
+    RETURN_IF_HIP_ERROR(hipGetDeviceProperties(&props, device));
+
+    RETURN_IF_HIP_ERROR(hipHostMalloc(
+        (void**)&q->jobs, c_gemm_persistent_slots * sizeof(rocblas_gemm_persistent_job)));
+    RETURN_IF_HIP_ERROR(hipHostMalloc((void**)&q->complete_host, sizeof(uint64_t)));
+    RETURN_IF_HIP_ERROR(hipHostMalloc((void**)&q->quit, sizeof(uint32_t)));
+    *q->complete_host = 0;
+    *q->quit          = 0;
+
+    RETURN_IF_HIP_ERROR(hipMalloc(&q->doorbell, sizeof(uint64_t)));
+    RETURN_IF_HIP_ERROR(hipMalloc(&q->complete_dev, sizeof(uint64_t)));
+    RETURN_IF_HIP_ERROR(hipMalloc(&q->blocks_done, sizeof(uint64_t)));
+    RETURN_IF_HIP_ERROR(hipMemset(q->doorbell, 0, sizeof(uint64_t)));
+    RETURN_IF_HIP_ERROR(hipMemset(q->complete_dev, 0, sizeof(uint64_t)));
+    RETURN_IF_HIP_ERROR(hipMemset(q->blocks_done, 0, sizeof(uint64_t)));
+
+    RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&q->stream, hipStreamNonBlocking));
+
+    // one block per CU so the whole grid is guaranteed resident
+    static constexpr int BLK = 16;
+    hipLaunchKernelGGL((rocblas_gemm_persistent_kernel<BLK>),
+                       dim3(props.multiProcessorCount),
+                       dim3(BLK, BLK),
+                       0,
+                       q->stream,
+                       q->jobs,
+                       q->doorbell,
+                       q->complete_dev,
+                       q->complete_host,
+                       q->blocks_done,
+                       q->quit);
+    RETURN_IF_HIP_ERROR(hipGetLastError());
+
+    q->running = true;
+    return rocblas_status_success;
+}
+
+/**
+  *  Writes the descriptor into its ring slot, bumps the doorbell on the user
+  *  stream (so the kernel reads inputs only after prior stream work) and
+  *  makes the user stream wait for the job's completion.
+  */
+inline rocblas_status rocblas_gemm_persistent_enqueue(rocblas_gemm_persistent_queue*     q,
+                                                      const rocblas_gemm_persistent_job& job,
+                                                      hipStream_t                        user_stream)
+{
+    // throttle if every slot is in flight; the kernel drains on its own
+    while(q->enqueued - *(volatile uint64_t*)q->complete_host >= c_gemm_persistent_slots)
+        std::this_thread::yield();
+
+    q->jobs[q->enqueued % c_gemm_persistent_slots] = job;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    ++q->enqueued;
+    RETURN_IF_HIP_ERROR(hipStreamWriteValue64(user_stream, q->doorbell, q->enqueued, 0));
+    RETURN_IF_HIP_ERROR(hipStreamWaitValue64(
+        user_stream, q->complete_dev, q->enqueued, hipStreamWaitValueGte, uint64_t(-1)));
+    return rocblas_status_success;
+}
+
+/**
+  *  Signals the resident kernel to exit once the ring is drained and releases
+  *  all resources. Called from the handle destructor.
+  */
+inline void rocblas_gemm_persistent_stop(rocblas_gemm_persistent_queue* q)
+{
+    if(q->running)
+    {
+        *(volatile uint32_t*)q->quit = 1;
+        std::atomic_thread_fence(std::memory_order_release);
+        (void)hipStreamSynchronize(q->stream);
+    }
+    if(q->stream)
+        (void)hipStreamDestroy(q->stream);
+    if(q->jobs)
+        (void)hipHostFree(q->jobs);
+    if(q->complete_host)
+        (void)hipHostFree(q->complete_host);
+    if(q->quit)
+        (void)hipHostFree(q->quit);
+    if(q->doorbell)
+        (void)hipFree(q->doorbell);
+    if(q->complete_dev)
+        (void)hipFree(q->complete_dev);
+    if(q->blocks_done)
+        (void)hipFree(q->blocks_done);
+    *q = rocblas_gemm_persistent_queue{};
+}
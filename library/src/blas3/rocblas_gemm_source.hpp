@@ -24,6 +24,7 @@
 
 #include "handle.hpp"
 #include "int64_helpers.hpp"
+#include <cstdlib>
 
 namespace
 {
@@ -543,8 +544,316 @@ namespace
         }
     }
 
+    // Component-wise atomic accumulate, letting the stream-k kernel handle
+    // the complex types through the same code path as the real ones
+    template <typename T>
+    __forceinline__ __device__ void rocblas_gemm_streamk_atomic_add(T* dest, T val)
+    {
+        atomicAdd(dest, val);
+    }
+
+    __forceinline__ __device__ void rocblas_gemm_streamk_atomic_add(rocblas_float_complex* dest,
+                                                                    rocblas_float_complex  val)
+    {
+        auto* f = reinterpret_cast<float*>(dest);
+        atomicAdd(f, val.real());
+        atomicAdd(f + 1, val.imag());
+    }
+
+    __forceinline__ __device__ void rocblas_gemm_streamk_atomic_add(rocblas_double_complex* dest,
+                                                                    rocblas_double_complex val)
+    {
+        auto* d = reinterpret_cast<double*>(dest);
+        atomicAdd(d, val.real());
+        atomicAdd(d + 1, val.imag());
+    }
+
+    // Stream-k scheduling: a fixed grid of workgroups claims (tile, K-slice)
+    // work units from a global counter until the work runs out, so awkward
+    // tile counts spread evenly over the CUs instead of quantizing to grid
+    // waves. Each unit accumulates alpha * A * B over its K-slice into D with
+    // atomics; D must already hold beta * C (the scale pre-pass runs first)
+    // and the caller must have checked that atomic updates are allowed, since
+    // the K-reduction order is not deterministic.
+    template <typename Tc,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              int  DIM_M_A,
+              int  DIM_N_A,
+              int  DIM_M_B,
+              int  DIM_N_B,
+              char TRANS_A,
+              char TRANS_B,
+              typename TiConstPtr,
+              typename ToPtr>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_streamk_kernel(int64_t        M,
+                                int64_t        N,
+                                int64_t        K,
+                                const Tc       alpha,
+                                TiConstPtr*    dA_input,
+                                int64_t        lda,
+                                rocblas_stride a_st_or_of,
+                                TiConstPtr*    dB_input,
+                                int64_t        ldb,
+                                rocblas_stride b_st_or_of,
+                                ToPtr*         dD_input,
+                                int64_t        ldd,
+                                rocblas_stride d_st_or_of,
+                                uint32_t       tiles_m,
+                                uint32_t       tiles_n,
+                                uint32_t       k_splits,
+                                int64_t        k_per_split,
+                                uint32_t       total_units,
+                                uint32_t*      unit_counter)
+    {
+        int     thx = threadIdx.x; // thread's m position in C
+        int     thy = threadIdx.y; // thread's n position in C
+        int64_t idt = int64_t(DIM_M) * thy + thx; // thread's number
+
+        int     thxA = idt % DIM_M_A; // thread's m position for loading A
+        int64_t thyA = idt / DIM_M_A; // thread's n position for loading A
+        int     thxB = idt % DIM_M_B; // thread's m position for loading B
+        int64_t thyB = idt / DIM_M_B; // thread's n position for loading B
+
+        using To = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<ToPtr>>>;
+
+        __shared__ Tc       sA[BLK_K][BLK_M]; // shared memory for A
+        __shared__ Tc       sB[BLK_N][BLK_K]; // shared memory for B
+        __shared__ uint32_t s_unit; // claimed work unit, broadcast from lane 0
+
+        for(;;)
+        {
+            if(idt == 0)
+                s_unit = atomicAdd(unit_counter, 1u);
+            __syncthreads();
+            uint32_t u = s_unit;
+            __syncthreads();
+
+            if(u >= total_units)
+                return;
+
+            uint32_t split = u % k_splits;
+            uint32_t tile  = u / k_splits;
+            uint32_t blx   = tile % tiles_m; // unit's m position
+            uint32_t rest  = tile / tiles_m;
+            uint32_t bly   = rest % tiles_n; // unit's n position
+            uint32_t blz   = rest / tiles_n; // unit's matrix in the batch
+
+            auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
+            auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
+            auto* dD = load_ptr_batch(dD_input, blz, d_st_or_of);
+
+            Tc rD[BLK_N / DIM_N][BLK_M / DIM_M]; // registers for D
+
+            for(int n = 0; n < BLK_N / DIM_N; ++n)
+                for(int m = 0; m < BLK_M / DIM_M; ++m)
+                    rD[n][m] = 0.0;
+
+            // slices start at multiples of k_per_split (itself a multiple of
+            // BLK_K), so bounding the loads by k_end keeps slices disjoint
+            int64_t k_begin = int64_t(split) * k_per_split;
+            int64_t k_end   = k_begin + k_per_split < K ? k_begin + k_per_split : K;
+
+            int64_t a_i_offset = thxA + int64_t(BLK_M) * blx;
+            int64_t a_j_offset = thyA;
+            int64_t b_i_offset = thxB;
+            int64_t b_j_offset = thyB + int64_t(BLK_N) * bly;
+
+            for(int64_t kk = k_begin; kk < k_end; kk += BLK_K)
+            {
+                for(int n = 0; n < BLK_K; n += DIM_N_A)
+                {
+                    for(int m = 0; m < BLK_M; m += DIM_M_A)
+                    {
+                        int64_t i = m + a_i_offset;
+                        int64_t j = n + kk + a_j_offset;
+                        if(i < M && j < k_end)
+                        {
+                            if(TRANS_A == 'N')
+                            {
+                                sA[n + thyA][m + thxA] = dA[i + j * size_t(lda)];
+                            }
+                            else if(TRANS_A == 'T')
+                            {
+                                sA[n + thyA][m + thxA] = dA[i * size_t(lda) + j];
+                            }
+                            else if(TRANS_A == 'C')
+                            {
+                                sA[n + thyA][m + thxA] = conj(dA[i * size_t(lda) + j]);
+                            }
+                        }
+                        else
+                        {
+                            sA[n + thyA][m + thxA] = 0.0;
+                        }
+                    }
+                }
+
+                for(int n = 0; n < BLK_N; n += DIM_N_B)
+                {
+                    for(int m = 0; m < BLK_K; m += DIM_M_B)
+                    {
+                        int64_t i = m + kk + b_i_offset;
+                        int64_t j = n + b_j_offset;
+                        if(i < k_end && j < N)
+                        {
+                            if(TRANS_B == 'N')
+                            {
+                                sB[n + thyB][m + thxB] = dB[i + j * size_t(ldb)];
+                            }
+                            else if(TRANS_B == 'T')
+                            {
+                                sB[n + thyB][m + thxB] = dB[i * size_t(ldb) + j];
+                            }
+                            else if(TRANS_B == 'C')
+                            {
+                                sB[n + thyB][m + thxB] = conj(dB[i * size_t(ldb) + j]);
+                            }
+                        }
+                        else
+                        {
+                            sB[n + thyB][m + thxB] = 0;
+                        }
+                    }
+                }
+
+                __syncthreads();
+
+                for(int k = 0; k < BLK_K; ++k)
+                    for(int n = 0; n < BLK_N / DIM_N; ++n)
+                        for(int m = 0; m < BLK_M / DIM_M; ++m)
+                            rD[n][m] += sA[k][m * DIM_M + thx] * sB[n * DIM_N + thy][k];
+
+                __syncthreads();
+            }
+
+            int64_t coord_dCn = int64_t(bly) * BLK_N + thy;
+            for(int n = 0; n < BLK_N / DIM_N && coord_dCn < N; ++n, coord_dCn += DIM_N)
+            {
+                int64_t nDIdx     = coord_dCn * size_t(ldd);
+                int64_t coord_dCm = int64_t(blx) * BLK_M + thx;
+
+#pragma unroll
+                for(int m = 0; m < BLK_M / DIM_M; ++m, coord_dCm += DIM_M)
+                {
+                    if(coord_dCm < M)
+                        rocblas_gemm_streamk_atomic_add(&dD[nDIdx + coord_dCm],
+                                                        To(alpha * rD[n][m]));
+                }
+            }
+        }
+    }
+
+    // Opt-in switch for the stream-k source GEMM scheduling path
+    inline bool rocblas_gemm_source_streamk_enabled()
+    {
+        static const bool enabled = [] {
+            const char* env = getenv("ROCBLAS_GEMM_SOURCE_STREAMK");
+            return env && strtol(env, nullptr, 0) > 0;
+        }();
+        return enabled;
+    }
+
+#define GEMM_SOURCE_SMALL_PARAM                                                         \
+    dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of, dB_krn, ldb, \
+        b_st_or_of, beta, dC_krn, ldc, c_st_or_of, dD_krn, ldd, d_st_or_of, batch_count
+
+    /**
+     *  Dispatches the bounds-checked general kernel with a compile-time tile
+     *  shape. The loader shapes follow the convention of the fixed-tile
+     *  dispatch in rocblas_gemm_source_solution_64 (A tiles load BLK_M wide,
+     *  B tiles BLK_K wide), so DIM_M * DIM_N must equal both BLK_M * BLK_K
+     *  and BLK_K * BLK_N.
+     */
+    template <typename Tc,
+              int DIM_M,
+              int DIM_N,
+              int BLK_M,
+              int BLK_N,
+              int BLK_K,
+              typename TiConstPtr,
+              typename ToConstPtr,
+              typename ToPtr>
+    void rocblas_gemm_source_general_launcher(rocblas_operation trans_a,
+                                              rocblas_operation trans_b,
+                                              int64_t           m,
+                                              int64_t           n,
+                                              int64_t           k,
+                                              const Tc          alpha,
+                                              TiConstPtr*       dA_krn,
+                                              int64_t           lda,
+                                              rocblas_stride    a_st_or_of,
+                                              TiConstPtr*       dB_krn,
+                                              int64_t           ldb,
+                                              rocblas_stride    b_st_or_of,
+                                              const Tc          beta,
+                                              ToConstPtr*       dC_krn,
+                                              int64_t           ldc,
+                                              rocblas_stride    c_st_or_of,
+                                              ToPtr*            dD_krn,
+                                              int64_t           ldd,
+                                              rocblas_stride    d_st_or_of,
+                                              rocblas_int       batch_count,
+                                              hipStream_t       stream)
+    {
+        static_assert(DIM_M * DIM_N == BLK_M * BLK_K && DIM_M * DIM_N == BLK_K * BLK_N,
+                      "tile shape does not match the loader convention");
+
+        dim3 dimBlock(DIM_M, DIM_N, 1);
+        dim3 dimGrid(((m - 1) / BLK_M) + 1, ((n - 1) / BLK_N) + 1, batch_count);
+
+        // clang-format off
+        if(rocblas_operation_none == trans_a && rocblas_operation_none == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'N', 'N'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'T', 'N'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'N', 'T'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'T', 'T'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'C', 'C'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'C', 'N'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'C', 'T'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'N', 'C'>), GEMM_SOURCE_SMALL_PARAM);
+        if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
+            <Tc, DIM_M, DIM_N, BLK_M, BLK_N, BLK_K, BLK_M, BLK_K, BLK_K, BLK_N, 'T', 'C'>), GEMM_SOURCE_SMALL_PARAM);
+        // clang-format on
+    }
+
+#undef GEMM_SOURCE_SMALL_PARAM
+
+    // Shapes below these limits skip the Tensile round trip and run the
+    // source tiles directly: host-side solution selection and kernel
+    // argument staging dominate calls this small (see rocblas_internal_gemm)
+    constexpr bool
+        rocblas_gemm_source_preferred(int64_t m, int64_t n, int64_t k, int64_t batch_count)
+    {
+        constexpr int64_t max_mn    = 64;
+        constexpr int64_t max_k     = 64;
+        constexpr int64_t min_batch = 8;
+        return m <= max_mn && n <= max_mn && k <= max_k && batch_count >= min_batch;
+    }
+
     template <bool BATCHED, typename T, typename TiConstPtr, typename ToConstPtr, typename ToPtr>
-    rocblas_status rocblas_gemm_source_solution_64(rocblas_operation trans_a,
+    rocblas_status rocblas_gemm_source_solution_64(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
                                                    rocblas_operation trans_b,
                                                    int64_t           m,
                                                    int64_t           n,
@@ -625,6 +934,123 @@ namespace
             d_st_or_of = stride_d;
         }
 
+        // Stream-k scheduling option (ROCBLAS_GEMM_SOURCE_STREAMK=1): when the
+        // output tile grid underfills the device and K is long enough to
+        // split, workgroups claim (tile, K-slice) units from a global counter
+        // instead of owning a fixed tile, giving near-perfect load balance on
+        // shapes that sit between the fixed-split heuristic buckets. Limited
+        // to output types with a native or component-wise atomicAdd.
+        using To = std::remove_cv_t<std::remove_pointer_t<std::remove_cv_t<ToPtr>>>;
+        if constexpr(std::is_same_v<To, float> || std::is_same_v<To, double>
+                     || std::is_same_v<To, rocblas_float_complex>
+                     || std::is_same_v<To, rocblas_double_complex>)
+        {
+            if(handle && handle->atomics_mode != rocblas_atomics_not_allowed
+               && rocblas_gemm_source_streamk_enabled())
+            {
+                const int dim_m = 16;
+                const int dim_n = 16;
+                const int blk_m = 32;
+                const int blk_n = 32;
+                const int blk_k = 8;
+
+                int device   = 0;
+                int cu_count = 0;
+                if(hipGetDevice(&device) == hipSuccess
+                   && hipDeviceGetAttribute(
+                          &cu_count, hipDeviceAttributeMultiprocessorCount, device)
+                          == hipSuccess
+                   && cu_count > 0)
+                {
+                    int64_t tiles_m = (m - 1) / blk_m + 1;
+                    int64_t tiles_n = (n - 1) / blk_n + 1;
+                    int64_t tiles   = tiles_m * tiles_n * batch_count;
+                    int64_t k_iters = (k - 1) / blk_k + 1;
+
+                    // a few workgroups per CU keep every SIMD busy while the
+                    // counter absorbs the uneven tail
+                    int64_t wgs_target = int64_t(cu_count) * 4;
+                    int64_t k_splits   = (wgs_target + tiles - 1) / tiles;
+                    if(k_splits > k_iters)
+                        k_splits = k_iters;
+
+                    if(k_splits >= 2 && tiles <= UINT32_MAX / k_splits
+                       && tiles_m <= UINT32_MAX && tiles_n <= UINT32_MAX)
+                    {
+                        // round the slice up to whole BLK_K blocks and drop
+                        // any trailing slices the rounding emptied
+                        int64_t k_per_split = ((k_iters + k_splits - 1) / k_splits) * blk_k;
+                        k_splits            = (k + k_per_split - 1) / k_per_split;
+
+                        uint32_t  total_units = uint32_t(tiles * k_splits);
+                        uint32_t* counter     = handle->get_streamk_counter();
+                        if(counter)
+                        {
+                            RETURN_IF_HIP_ERROR(
+                                hipMemsetAsync(counter, 0, sizeof(uint32_t), stream));
+
+                            // D <- beta * C, so the units only accumulate
+                            RETURN_IF_ROCBLAS_ERROR(
+                                rocblas_gemm_ex_scale_launcher_64(m,
+                                                                  n,
+                                                                  beta,
+                                                                  dC,
+                                                                  offset_c,
+                                                                  ldc,
+                                                                  stride_c,
+                                                                  dD,
+                                                                  offset_d,
+                                                                  ldd,
+                                                                  stride_d,
+                                                                  batch_count,
+                                                                  stream));
+
+                            dim3 dimBlock(dim_m, dim_n, 1);
+                            dim3 dimGrid(uint32_t(std::min<int64_t>(total_units, wgs_target)));
+
+#define GEMM_SOURCE_STREAMK_PARAM                                                         \
+    dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of, dB_krn, ldb,   \
+        b_st_or_of, dD_krn, ldd, d_st_or_of, uint32_t(tiles_m), uint32_t(tiles_n),        \
+        uint32_t(k_splits), k_per_split, total_units, counter
+
+                            // clang-format off
+                            if(rocblas_operation_none == trans_a && rocblas_operation_none == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'N'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'N'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'T'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'T'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'C'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'N'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'T'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'C'>), GEMM_SOURCE_STREAMK_PARAM);
+                            if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+                                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_streamk_kernel
+                                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'C'>), GEMM_SOURCE_STREAMK_PARAM);
+                            // clang-format on
+
+#undef GEMM_SOURCE_STREAMK_PARAM
+                            return rocblas_status_success;
+                        }
+                    }
+                }
+            }
+        }
+
 #define GEMM_SOURCE_PARAM                                                                    \
     dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of, dB_krn, ldb, b_st_or_of, \
         dC_krn, ldc, c_st_or_of, dD_krn, ldd, d_st_or_of, batch_count
@@ -717,6 +1143,58 @@ namespace
                 <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
             // clang-format on
         }
+        else if(m <= 8 && n <= 8)
+        {
+            // Small-shape buckets: at or below the tile edge the one-size
+            // 32x32 tile computes mostly out-of-bounds lanes, so pick the
+            // smallest covering tile instead. A single wavefront covers the
+            // whole matrix here, keeping large-batch small GEMM dense.
+            rocblas_gemm_source_general_launcher<T, 8, 8, 8, 8, 8>(trans_a,
+                                                                   trans_b,
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   alpha,
+                                                                   dA_krn,
+                                                                   lda,
+                                                                   a_st_or_of,
+                                                                   dB_krn,
+                                                                   ldb,
+                                                                   b_st_or_of,
+                                                                   beta,
+                                                                   dC_krn,
+                                                                   ldc,
+                                                                   c_st_or_of,
+                                                                   dD_krn,
+                                                                   ldd,
+                                                                   d_st_or_of,
+                                                                   batch_count,
+                                                                   stream);
+        }
+        else if(m <= 16 && n <= 16)
+        {
+            rocblas_gemm_source_general_launcher<T, 16, 16, 16, 16, 16>(trans_a,
+                                                                        trans_b,
+                                                                        m,
+                                                                        n,
+                                                                        k,
+                                                                        alpha,
+                                                                        dA_krn,
+                                                                        lda,
+                                                                        a_st_or_of,
+                                                                        dB_krn,
+                                                                        ldb,
+                                                                        b_st_or_of,
+                                                                        beta,
+                                                                        dC_krn,
+                                                                        ldc,
+                                                                        c_st_or_of,
+                                                                        dD_krn,
+                                                                        ldd,
+                                                                        d_st_or_of,
+                                                                        batch_count,
+                                                                        stream);
+        }
         else
         {
             const int dim_m = 16;
@@ -20,26 +20,35 @@
  *
  * ************************************************************************ */
 
-#define SSYMM_MIN_NB 32
-#define DSYMM_MIN_NB 32
-#define CSYMM_MIN_NB 32
-#define ZSYMM_MIN_NB 32
-
-#define SSYMM_BATCHED_MIN_NB 32
-#define DSYMM_BATCHED_MIN_NB 32
-#define CSYMM_BATCHED_MIN_NB 32
-#define ZSYMM_BATCHED_MIN_NB 32
+// Starting block size for the GEMM-based decomposition below. The diagonal
+// blocks of this size run on the source kernels; everything else runs as
+// doubling off-diagonal GEMMs, so larger values move more of the work into
+// Tensile at the cost of a bigger source-kernel diagonal. Per-precision values
+// balance the slower source-kernel rates of the wider types.
+#define SSYMM_MIN_NB 512
+#define DSYMM_MIN_NB 128
+#define CSYMM_MIN_NB 64
+#define ZSYMM_MIN_NB 64
+
+#define SSYMM_BATCHED_MIN_NB 512
+#define DSYMM_BATCHED_MIN_NB 128
+#define CSYMM_BATCHED_MIN_NB 64
+#define ZSYMM_BATCHED_MIN_NB 64
 
 #include "definitions.hpp"
 #include "handle.hpp"
 #include "rocblas_gemm.hpp"
 #include "rocblas_symm_hemm.hpp"
 #include "src64/blas3/rocblas_gemm_64.hpp"
+#include "stage_scheduler.hpp"
 #include <type_traits>
 
 template <typename T>
 static const T beta_1 = T(1);
 
+template <typename T>
+static const T beta_0 = T(0);
+
 template <typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symm_scale_device(rocblas_int m, rocblas_int n, T beta, T* C, int64_t ldc)
@@ -74,6 +83,33 @@ rocblas_symm_scale_kernel(rocblas_int    m,
     rocblas_symm_scale_device(m, n, beta, C, ldc);
 }
 
+/**
+  *  Element-wise fold of a contiguous workspace into C. Used by the
+  *  concurrent batched scheme to add the diagonal-block contribution after
+  *  the off-diagonal gemms have finished accumulating into C.
+  */
+template <int DIM_X, int DIM_Y, typename TW, typename U>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_symm_add_kernel(rocblas_int    m,
+                        rocblas_int    n,
+                        const TW*      W,
+                        int64_t        ldw,
+                        rocblas_stride stride_w,
+                        U              CP_array,
+                        rocblas_stride shift_c,
+                        int64_t        ldc,
+                        rocblas_stride stride_c)
+{
+    auto        C  = load_ptr_batch(CP_array, blockIdx.z, shift_c, stride_c);
+    const auto* Wb = W + blockIdx.z * stride_w;
+
+    auto tx = blockIdx.x * blockDim.x + threadIdx.x;
+    auto ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+        C[ty * ldc + tx] += Wb[ty * ldw + tx];
+}
+
 /**
   * kernel
   */
@@ -778,8 +814,15 @@ rocblas_status rocblas_hemm_symm_check_numerics(const char*    function_name,
     return check_numerics_status;
 }
 
-template <bool BATCHED, bool HERM, typename T, typename TScal, typename TConstPtr, typename TPtr>
-rocblas_status rocblas_symm_hemm_template_batched(rocblas_handle handle,
+/**
+  *  Diagonal-block portion of the batched scheme: one source-kernel dispatch
+  *  per nb_diag-sized diagonal block of the triangle matrix a, each scaling
+  *  its c panel by beta and accumulating the block's contribution. Shared by
+  *  the sequential scheme and the concurrent scheme, which points c at a
+  *  c-shaped workspace and passes beta == 0.
+  */
+template <bool HERM, typename TScal, typename TConstPtr, typename TPtr>
+static rocblas_status rocblas_symm_hemm_batched_diag_blocks(rocblas_handle handle,
                                              rocblas_side   side,
                                              rocblas_fill   uplo,
                                              rocblas_int    m,
@@ -798,33 +841,10 @@ rocblas_status rocblas_symm_hemm_template_batched(rocblas_handle handle,
                                              rocblas_stride offsetC,
                                              int64_t    ldc,
                                              rocblas_stride strideC,
-                                             rocblas_int    batch_count)
+                                             rocblas_int    batch_count,
+                                             rocblas_int    nb_diag,
+                                             rocblas_int    ka)
 {
-    // nb_diag is a tuning parameter. It is the size of the diagonal blocks in the matrix
-    // a. It is also the starting size for subdiagonal blocks in calls to gemm.
-    rocblas_int nb_diag = 32; // size of diag blocks of triangle matrix a
-
-    if     (std::is_same_v<T, float>)                  { nb_diag = SSYMM_BATCHED_MIN_NB; }
-    else if(std::is_same_v<T, double>)                 { nb_diag = DSYMM_BATCHED_MIN_NB; }
-    else if(std::is_same_v<T, rocblas_float_complex>)  { nb_diag = CSYMM_BATCHED_MIN_NB; }
-    else if(std::is_same_v<T, rocblas_double_complex>) { nb_diag = ZSYMM_BATCHED_MIN_NB; }
-
-    rocblas_operation trans_a = HERM ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
-
-    // rocblas_internal_gemm requires alpha and beta to be pointers to host memory.
-    // If they are pointers to device memory, then copy *alpha and *beta to alpha_h and beta_h
-    // and make alpha and beta point to alpha_h and beta_h, and set pointer mode to host.
-    // Restore pointer mode in destructor when save_pointer_mode goes out of scope.
-    T alpha_h, beta_h;
-    RETURN_IF_ROCBLAS_ERROR(
-        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, 1));
-    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
-
-    if (*alpha == T(0) && *beta == T(1.0))
-        return rocblas_status_success;
-
-    rocblas_int ka = rocblas_side_left == side ? m : n; // dimension of triangle matrix a
-
     rocblas_int n_nb   = ka / nb_diag; // number of diag blocks of matrix a of size nb_diag
     rocblas_int nb_rem = ka % nb_diag; // remainder diag block size when ka not multiple of nb_diag
 
@@ -861,7 +881,39 @@ rocblas_status rocblas_symm_hemm_template_batched(rocblas_handle handle,
                  b, i_diag * diag_b_stride + offsetB, ldb, strideB, beta,
                  c, i_diag * diag_c_stride + offsetC, ldc, strideC, batch_count)));
     }
+    return rocblas_status_success;
+}
 
+/**
+  *  Off-diagonal gemm sweep of the batched scheme, accumulating into c with
+  *  beta == 1. Shared by the sequential and concurrent schemes.
+  */
+template <bool BATCHED, bool HERM, typename T, typename TScal, typename TConstPtr, typename TPtr>
+static rocblas_status rocblas_symm_hemm_batched_offdiag_gemms(rocblas_handle handle,
+                                             rocblas_side   side,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             TScal          alpha,
+                                             TConstPtr      a,
+                                             rocblas_stride offsetA,
+                                             int64_t    lda,
+                                             rocblas_stride strideA,
+                                             TConstPtr      b,
+                                             rocblas_stride offsetB,
+                                             int64_t    ldb,
+                                             rocblas_stride strideB,
+                                             TPtr           c,
+                                             rocblas_stride offsetC,
+                                             int64_t    ldc,
+                                             rocblas_stride strideC,
+                                             rocblas_int    batch_count,
+                                             rocblas_int    nb_diag,
+                                             rocblas_int    ka)
+{
+    rocblas_operation trans_a = HERM ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+    rocblas_int n_nb; // number of calls to gemm per sub-diagonal sweep
     int64_t stride, stride_rem, i_start;
     int64_t nb; // size of sub-diagonal blocks of matrix a
     // calls to gemm for sub-diagonal square blocks in matrix a with size m = n = nb.
@@ -1040,6 +1092,180 @@ rocblas_status rocblas_symm_hemm_template_batched(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/**
+  *  Concurrent batched scheme. The diagonal-block source kernels and the
+  *  off-diagonal gemms both read-modify-write overlapping panels of c, so
+  *  they cannot share c across streams; instead the diagonal contribution is
+  *  written to a c-shaped workspace (beta == 0) on one internal stream while
+  *  the other scales c by beta and runs the accumulating gemms, and a final
+  *  element-wise kernel folds the workspace into c once both stages join.
+  *  Returns rocblas_status_continue when this path cannot run (no internal
+  *  streams, no workspace, or nothing off-diagonal to overlap with) and the
+  *  caller should fall back to the sequential scheme. Expects host pointer
+  *  mode for alpha and beta.
+  */
+template <bool BATCHED, bool HERM, typename T, typename TScal, typename TConstPtr, typename TPtr>
+static rocblas_status rocblas_symm_hemm_batched_concurrent(rocblas_handle handle,
+                                             rocblas_side   side,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             TScal          alpha,
+                                             TConstPtr      a,
+                                             rocblas_stride offsetA,
+                                             int64_t    lda,
+                                             rocblas_stride strideA,
+                                             TConstPtr      b,
+                                             rocblas_stride offsetB,
+                                             int64_t    ldb,
+                                             rocblas_stride strideB,
+                                             TScal          beta,
+                                             TPtr           c,
+                                             rocblas_stride offsetC,
+                                             int64_t    ldc,
+                                             rocblas_stride strideC,
+                                             rocblas_int    batch_count,
+                                             rocblas_int    nb_diag,
+                                             rocblas_int    ka)
+{
+    if(!m || !n || !batch_count || ka <= nb_diag || handle->is_stream_in_capture_mode())
+        return rocblas_status_continue;
+
+    // c-shaped workspace holding the diagonal contribution; taken
+    // opportunistically so the reported device memory size stays zero
+    size_t dev_bytes = sizeof(T) * size_t(m) * n * batch_count;
+    auto   w_mem     = handle->device_malloc(dev_bytes);
+    if(!w_mem)
+        return rocblas_status_continue;
+    T* w = (T*)w_mem[0];
+
+    int64_t        ldw      = m;
+    rocblas_stride stride_w = int64_t(m) * n;
+
+    // the workspace is released behind the bound stream, which the scheduler
+    // destructor makes wait on both stages, so w cannot be reused early
+    rocblas_internal_stage_scheduler scheduler(handle);
+
+    if(!scheduler.begin_stage(0, {}))
+        return rocblas_status_continue; // sequential scheme avoids the workspace traffic
+
+    // stage 0: diagonal blocks into the workspace; beta == 0 zero-fills the panels
+    RETURN_IF_ROCBLAS_ERROR( (rocblas_symm_hemm_batched_diag_blocks<HERM>(handle,
+             side, uplo, m, n, alpha,
+             a, offsetA, lda, strideA,
+             b, offsetB, ldb, strideB, &beta_0<T>,
+             w, 0, ldw, stride_w, batch_count, nb_diag, ka)));
+    scheduler.end_stage(0);
+
+    // stage 1: beta scaling of all of c, then the accumulating gemms
+    scheduler.begin_stage(1, {});
+    {
+        static constexpr int symm_SCALE_DIM_X = 128;
+        static constexpr int symm_SCALE_DIM_Y = 8;
+        rocblas_int          gx               = (m - 1) / (symm_SCALE_DIM_X) + 1;
+        rocblas_int          gy               = (n - 1) / (symm_SCALE_DIM_Y) + 1;
+        dim3                 symm_scale_grid(gx, gy, batch_count);
+        dim3                 symm_scale_threads(symm_SCALE_DIM_X, symm_SCALE_DIM_Y);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_symm_scale_kernel<symm_SCALE_DIM_X, symm_SCALE_DIM_Y>),
+                              symm_scale_grid, symm_scale_threads, 0, handle->get_stream(),
+                              m, n, *beta, c, offsetC, ldc, strideC);
+    }
+    RETURN_IF_ROCBLAS_ERROR( (rocblas_symm_hemm_batched_offdiag_gemms<BATCHED, HERM, T>(handle,
+             side, uplo, m, n, alpha,
+             a, offsetA, lda, strideA,
+             b, offsetB, ldb, strideB,
+             c, offsetC, ldc, strideC, batch_count, nb_diag, ka)));
+    scheduler.end_stage(1);
+
+    // stage 2: fold the diagonal contribution into c
+    scheduler.begin_stage(2, {0, 1});
+    {
+        static constexpr int symm_ADD_DIM_X = 128;
+        static constexpr int symm_ADD_DIM_Y = 8;
+        rocblas_int          gx             = (m - 1) / (symm_ADD_DIM_X) + 1;
+        rocblas_int          gy             = (n - 1) / (symm_ADD_DIM_Y) + 1;
+        dim3                 symm_add_grid(gx, gy, batch_count);
+        dim3                 symm_add_threads(symm_ADD_DIM_X, symm_ADD_DIM_Y);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_symm_add_kernel<symm_ADD_DIM_X, symm_ADD_DIM_Y>),
+                              symm_add_grid, symm_add_threads, 0, handle->get_stream(),
+                              m, n, w, ldw, stride_w, c, offsetC, ldc, strideC);
+    }
+    scheduler.end_stage(2);
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool HERM, typename T, typename TScal, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_symm_hemm_template_batched(rocblas_handle handle,
+                                             rocblas_side   side,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             TScal          alpha,
+                                             TConstPtr      a,
+                                             rocblas_stride offsetA,
+                                             int64_t    lda,
+                                             rocblas_stride strideA,
+                                             TConstPtr      b,
+                                             rocblas_stride offsetB,
+                                             int64_t    ldb,
+                                             rocblas_stride strideB,
+                                             TScal          beta,
+                                             TPtr           c,
+                                             rocblas_stride offsetC,
+                                             int64_t    ldc,
+                                             rocblas_stride strideC,
+                                             rocblas_int    batch_count)
+{
+    // nb_diag is a tuning parameter. It is the size of the diagonal blocks in the matrix
+    // a. It is also the starting size for subdiagonal blocks in calls to gemm.
+    rocblas_int nb_diag = 32; // size of diag blocks of triangle matrix a
+
+    if     (std::is_same_v<T, float>)                  { nb_diag = SSYMM_BATCHED_MIN_NB; }
+    else if(std::is_same_v<T, double>)                 { nb_diag = DSYMM_BATCHED_MIN_NB; }
+    else if(std::is_same_v<T, rocblas_float_complex>)  { nb_diag = CSYMM_BATCHED_MIN_NB; }
+    else if(std::is_same_v<T, rocblas_double_complex>) { nb_diag = ZSYMM_BATCHED_MIN_NB; }
+
+    // rocblas_internal_gemm requires alpha and beta to be pointers to host memory.
+    // If they are pointers to device memory, then copy *alpha and *beta to alpha_h and beta_h
+    // and make alpha and beta point to alpha_h and beta_h, and set pointer mode to host.
+    // Restore pointer mode in destructor when save_pointer_mode goes out of scope.
+    T alpha_h, beta_h;
+    RETURN_IF_ROCBLAS_ERROR(
+        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, 1));
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    if (*alpha == T(0) && *beta == T(1.0))
+        return rocblas_status_success;
+
+    rocblas_int ka = rocblas_side_left == side ? m : n; // dimension of triangle matrix a
+
+    // diagonal-block kernels and off-diagonal gemms overlap on the internal
+    // stream pool when the concurrent scheme can run
+    rocblas_status status = rocblas_symm_hemm_batched_concurrent<BATCHED, HERM, T>(handle,
+             side, uplo, m, n, alpha,
+             a, offsetA, lda, strideA,
+             b, offsetB, ldb, strideB, beta,
+             c, offsetC, ldc, strideC, batch_count, nb_diag, ka);
+    if(status != rocblas_status_continue)
+        return status;
+
+    // sequential scheme: diagonal blocks apply beta, gemms accumulate with beta == 1
+    RETURN_IF_ROCBLAS_ERROR( (rocblas_symm_hemm_batched_diag_blocks<HERM>(handle,
+             side, uplo, m, n, alpha,
+             a, offsetA, lda, strideA,
+             b, offsetB, ldb, strideB, beta,
+             c, offsetC, ldc, strideC, batch_count, nb_diag, ka)));
+
+    return rocblas_symm_hemm_batched_offdiag_gemms<BATCHED, HERM, T>(handle,
+             side, uplo, m, n, alpha,
+             a, offsetA, lda, strideA,
+             b, offsetB, ldb, strideB,
+             c, offsetC, ldc, strideC, batch_count, nb_diag, ka);
+}
+
 template <typename T>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_symm_template(rocblas_handle handle,
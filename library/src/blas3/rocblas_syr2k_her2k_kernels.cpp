@@ -353,10 +353,12 @@ rocblas_status rocblas_internal_syr2k_her2k_non_recursive_template(rocblas_handl
     if(!n || !batch_count)
         return rocblas_status_success;
 
+    // launch one block per tile of the stored triangle rather than the full
+    // square tile grid; the kernel maps blockIdx.x back to tile coordinates
     static constexpr int syr2k_DIM_XY = 32;
     rocblas_int          bx           = (n - 1) / (syr2k_DIM_XY) + 1;
-    rocblas_int          by           = (n - 1) / (syr2k_DIM_XY) + 1;
-    dim3                 syr2k_grid(bx, by, batch_count);
+    rocblas_int          nt           = bx * (bx + 1) / 2;
+    dim3                 syr2k_grid(nt, 1, batch_count);
     dim3                 syr2k_threads(syr2k_DIM_XY, syr2k_DIM_XY);
 
     TPtr           CP_krn;
@@ -590,28 +592,56 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
     TConstPtr dB = dB_in;
     TConstPtr dA = dA_in;
 
+    // for syrkx/herkx each off-diagonal block of C is written by exactly one of the
+    // gemm calls below, so beta can be folded into those calls and only the diagonal
+    // blocks need a separate scale pass, saving a full read-modify-write of C
+    const bool fold_beta = !TWOK && k != 0 && *alpha != 0;
+
     static constexpr int syr2k_SCALE_DIM_X = 128;
     static constexpr int syr2k_SCALE_DIM_Y = 8;
-    rocblas_int          gx                = (n - 1) / (syr2k_SCALE_DIM_X) + 1;
-    rocblas_int          gy                = (n - 1) / (syr2k_SCALE_DIM_Y) + 1;
+    rocblas_int          gx = ((fold_beta ? nb : n) - 1) / (syr2k_SCALE_DIM_X) + 1;
+    rocblas_int          gy = (n - 1) / (syr2k_SCALE_DIM_Y) + 1;
     dim3                 syr2k_scale_grid(gx, gy, batch_count);
     dim3                 syr2k_scale_threads(syr2k_SCALE_DIM_X, syr2k_SCALE_DIM_Y);
 
-    // first scale C so we can use directly for output without work buffer
-    ROCBLAS_LAUNCH_KERNEL(
-        (rocblas_syr2k_scale_kernel<API_INT, syr2k_SCALE_DIM_X, syr2k_SCALE_DIM_Y, HERK>),
-        syr2k_scale_grid,
-        syr2k_scale_threads,
-        0,
-        handle->get_stream(),
-        uplo == rocblas_fill_upper,
-        n,
-        k,
-        *alpha,
-        *beta,
-        dC,
-        ldc,
-        BATCHED ? offset_c : stride_c);
+    if(fold_beta)
+    {
+        // scale only the nb x nb diagonal blocks; the rank-k accumulation kernels
+        // for the diagonal need C pre-scaled, the gemm calls apply beta themselves
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_syr2k_scale_diag_kernel<API_INT, syr2k_SCALE_DIM_X, syr2k_SCALE_DIM_Y, HERK>),
+            syr2k_scale_grid,
+            syr2k_scale_threads,
+            0,
+            handle->get_stream(),
+            uplo == rocblas_fill_upper,
+            n,
+            nb,
+            k,
+            *alpha,
+            *beta,
+            dC,
+            ldc,
+            BATCHED ? offset_c : stride_c);
+    }
+    else
+    {
+        // first scale C so we can use directly for output without work buffer
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_syr2k_scale_kernel<API_INT, syr2k_SCALE_DIM_X, syr2k_SCALE_DIM_Y, HERK>),
+            syr2k_scale_grid,
+            syr2k_scale_threads,
+            0,
+            handle->get_stream(),
+            uplo == rocblas_fill_upper,
+            n,
+            k,
+            *alpha,
+            *beta,
+            dC,
+            ldc,
+            BATCHED ? offset_c : stride_c);
+    }
 
     if(k == 0)
         return rocblas_status_success;
@@ -680,7 +710,7 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
                 RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_64<BATCHED>(
                      handle, trans_orig, trans_opp, nb, nb, k, alpha,
                      dA, OFFSET_A(i1),     lda, stride_a,
-                     dB, OFFSET_B(i2),     ldb, stride_b, &beta_1<T>,
+                     dB, OFFSET_B(i2),     ldb, stride_b, fold_beta ? beta : &beta_1<T>,
                      dC, OFFSET_C(i1, i2), ldc, stride_c, batch_count)));
                 // clang-format on
 
@@ -701,7 +731,7 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
                 RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_64<BATCHED>(
                      handle, trans_orig, trans_opp, nb, nb, k, alpha,
                      dA, OFFSET_A(i2),     lda, stride_a,
-                     dB, OFFSET_B(i1),     ldb, stride_b, &beta_1<T>,
+                     dB, OFFSET_B(i1),     ldb, stride_b, fold_beta ? beta : &beta_1<T>,
                      dC, OFFSET_C(i2, i1), ldc, stride_c, batch_count)));
                 // clang-format on
 
@@ -731,7 +761,7 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
                 RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_64<BATCHED>(
                      handle, trans_orig, trans_opp, n1, nb, k, alpha,
                      dA, OFFSET_A(i1),     lda, stride_a,
-                     dB, OFFSET_B(i2),     ldb, stride_b, &beta_1<T>,
+                     dB, OFFSET_B(i2),     ldb, stride_b, fold_beta ? beta : &beta_1<T>,
                      dC, OFFSET_C(i1, i2), ldc, stride_c, batch_count)));
                 // clang-format on
 
@@ -752,7 +782,7 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
                 RETURN_IF_ROCBLAS_ERROR( (rocblas_internal_gemm_64<BATCHED>(
                      handle, trans_orig, trans_opp, nb, n1, k, alpha,
                      dA, OFFSET_A(i2),     lda, stride_a,
-                     dB, OFFSET_B(i1),     ldb, stride_b, &beta_1<T>,
+                     dB, OFFSET_B(i1),     ldb, stride_b, fold_beta ? beta : &beta_1<T>,
                      dC, OFFSET_C(i2, i1), ldc, stride_c, batch_count)));
                 // clang-format on
 
@@ -170,6 +170,37 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride    stride_c,
                                            rocblas_int       batch_count);
 
+/**
+ * Fused accumulate form of out-of-place trmm over strided batches:
+ * C = alpha*op(A)*B + beta*C, computed in a single pass over C so no
+ * separate geam/scale traversal is needed. Supports all side/uplo/trans
+ * combinations; alpha and beta follow the handle's pointer mode.
+ */
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trmm_accumulate_template(rocblas_handle    handle,
+                                                         rocblas_side      side,
+                                                         rocblas_fill      uplo,
+                                                         rocblas_operation trans_a,
+                                                         rocblas_diagonal  diag,
+                                                         rocblas_int       m,
+                                                         rocblas_int       n,
+                                                         const T*          alpha,
+                                                         const T*          beta,
+                                                         const T*          dA,
+                                                         rocblas_stride    offset_a,
+                                                         rocblas_int       lda,
+                                                         rocblas_stride    stride_a,
+                                                         const T*          dB,
+                                                         rocblas_stride    offset_b,
+                                                         rocblas_int       ldb,
+                                                         rocblas_stride    stride_b,
+                                                         T*                dC,
+                                                         rocblas_stride    offset_c,
+                                                         rocblas_int       ldc,
+                                                         rocblas_stride    stride_c,
+                                                         rocblas_int       batch_count);
+
 template <typename TConstPtr, typename TPtr>
 rocblas_status rocblas_trmm_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
@@ -29,9 +29,6 @@
 template <typename T>
 static const T beta_1 = T(1);
 
-template <typename T>
-static const T alpha_0 = T(0);
-
 //-- Innovative Computing Laboratory
 //  -- Electrical Engineering and Computer Science Department
 //  -- University of Tennessee
@@ -121,6 +118,38 @@ rocblas_status rocblas_set_matrix_zero_if_alpha_zero_template(rocblas_handle han
     dim3 threads(GEMV_DIM_X, GEMV_DIM_Y);
 
     if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        // when the device alpha is peekable (rocblas_set_device_scalar_peek_mode)
+        // and known nonzero, the kernel would write nothing — skip the launch
+        if constexpr(std::is_pointer_v<TScal>
+                     && !std::is_pointer_v<std::remove_cv_t<std::remove_pointer_t<TScal>>>)
+        {
+            if(!stride_alpha)
+            {
+                std::remove_cv_t<std::remove_pointer_t<TScal>> alpha_h;
+                if(handle->try_peek_device_scalar(alpha, alpha_h))
+                {
+                    if(alpha_h != 0)
+                        return rocblas_status_success;
+
+                    ROCBLAS_LAUNCH_KERNEL(
+                        (rocblas_set_matrix_zero_if_alpha_zero_kernel<GEMV_DIM_X, GEMV_DIM_Y>),
+                        grid,
+                        threads,
+                        0,
+                        rocblas_stream,
+                        m,
+                        n,
+                        alpha_h,
+                        stride_alpha,
+                        A,
+                        lda,
+                        a_st_or_of);
+                    return rocblas_status_success;
+                }
+            }
+        }
+
         ROCBLAS_LAUNCH_KERNEL(
             (rocblas_set_matrix_zero_if_alpha_zero_kernel<GEMV_DIM_X, GEMV_DIM_Y>),
             grid,
@@ -134,6 +163,7 @@ rocblas_status rocblas_set_matrix_zero_if_alpha_zero_template(rocblas_handle han
             A,
             lda,
             a_st_or_of);
+    }
     else
         ROCBLAS_LAUNCH_KERNEL(
             (rocblas_set_matrix_zero_if_alpha_zero_kernel<GEMV_DIM_X, GEMV_DIM_Y>),
@@ -159,6 +189,7 @@ template <typename T,
           bool      UPPER,
           bool      TRANSPOSE,
           bool      CONJ,
+          bool      ACCUM,
           typename TScal,
           typename TConstPtr,
           typename TPtr>
@@ -167,6 +198,7 @@ rocblas_trmm_outofplace_kernel(rocblas_diagonal diag,
                                int              m,
                                int              n,
                                TScal            alpha_device_host,
+                               TScal            beta_device_host,
                                rocblas_stride   stride_alpha,
                                TConstPtr*       A_arg,
                                rocblas_stride   offset_a,
@@ -186,11 +218,12 @@ rocblas_trmm_outofplace_kernel(rocblas_diagonal diag,
     constexpr rocblas_int DIM        = NB / THR_DIM;
 
     auto alpha = load_scalar(alpha_device_host, blockIdx.z, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, blockIdx.z, stride_alpha);
     auto A     = load_ptr_batch(A_arg, blockIdx.z, offset_a, stride_a);
     auto B     = load_ptr_batch(B_arg, blockIdx.z, offset_b, stride_b);
     auto C     = load_ptr_batch(C_arg, blockIdx.z, offset_c, stride_c);
 
-    if(alpha == 0)
+    if(!ACCUM && alpha == 0)
         return;
 
     const rocblas_int k = LEFT ? m : n;
@@ -200,6 +233,28 @@ rocblas_trmm_outofplace_kernel(rocblas_diagonal diag,
     const rocblas_int bx = blockIdx.x;
     const rocblas_int by = blockIdx.y;
 
+    // accumulate form with alpha == 0: only the beta*C scaling remains
+    if(ACCUM && alpha == 0)
+    {
+        if(beta != 1)
+        {
+            for(rocblas_int jn = 0; jn < THR_DIM; jn++)
+            {
+                rocblas_int c_idxn = by * NB + jn * DIM + ty;
+                for(rocblas_int jm = 0; jm < THR_DIM; jm++)
+                {
+                    rocblas_int c_idxm = bx * NB + jm * DIM + tx;
+                    if(c_idxm < m && c_idxn < n)
+                    {
+                        size_t c_idx = c_idxn * size_t(ldc) + c_idxm;
+                        C[c_idx]     = beta == 0 ? T(0) : beta * C[c_idx];
+                    }
+                }
+            }
+        }
+        return;
+    }
+
     __shared__ T sA[NB][NB];
     __shared__ T sB[NB][NB];
 
@@ -315,7 +370,10 @@ rocblas_trmm_outofplace_kernel(rocblas_diagonal diag,
         __syncthreads();
     }
 
-    // store the C matrix
+    // store the C matrix; in the plain form this kernel is the first writer
+    // of each C element (the off-diagonal gemm calls accumulate afterwards
+    // with beta == 1), so a plain store avoids both a pre-zero pass over C
+    // and a dead C read; the accumulate form folds beta*C into the same pass
     for(rocblas_int jn = 0; jn < THR_DIM; jn++)
     {
         rocblas_int c_idxn = by * NB + jn * DIM + ty;
@@ -324,7 +382,11 @@ rocblas_trmm_outofplace_kernel(rocblas_diagonal diag,
             rocblas_int c_idxm = bx * NB + jm * DIM + tx;
             if(c_idxm < m && c_idxn < n)
             {
-                C[c_idxn * size_t(ldc) + c_idxm] += alpha * rC[jn][jm];
+                size_t c_idx = c_idxn * size_t(ldc) + c_idxm;
+                if(ACCUM && beta != 0)
+                    C[c_idx] = alpha * rC[jn][jm] + beta * C[c_idx];
+                else
+                    C[c_idx] = alpha * rC[jn][jm];
             }
         }
     }
@@ -336,6 +398,7 @@ template <typename T,
           bool        UPPER,
           bool        TRANSPOSE,
           bool        CONJ,
+          bool        ACCUM,
           typename TScal,
           typename TConstPtr,
           typename TPtr>
@@ -344,6 +407,7 @@ rocblas_status rocblas_trmm_outofplace_dispatch(rocblas_handle   handle,
                                                 rocblas_int      m,
                                                 rocblas_int      n,
                                                 TScal*           alpha,
+                                                TScal*           beta,
                                                 rocblas_stride   stride_alpha,
                                                 TConstPtr*       dA,
                                                 rocblas_stride   offset_a,
@@ -374,7 +438,7 @@ rocblas_status rocblas_trmm_outofplace_dispatch(rocblas_handle   handle,
     {
         ROCBLAS_LAUNCH_KERNEL_GRID(
             grid,
-            (rocblas_trmm_outofplace_kernel<T, NB, THR_DIM, LEFT, UPPER, TRANSPOSE, CONJ>),
+            (rocblas_trmm_outofplace_kernel<T, NB, THR_DIM, LEFT, UPPER, TRANSPOSE, CONJ, ACCUM>),
             grid,
             threads,
             0,
@@ -383,6 +447,7 @@ rocblas_status rocblas_trmm_outofplace_dispatch(rocblas_handle   handle,
             m,
             n,
             alpha,
+            beta,
             stride_alpha,
             dA,
             offset_a,
@@ -402,7 +467,7 @@ rocblas_status rocblas_trmm_outofplace_dispatch(rocblas_handle   handle,
     {
         ROCBLAS_LAUNCH_KERNEL_GRID(
             grid,
-            (rocblas_trmm_outofplace_kernel<T, NB, THR_DIM, LEFT, UPPER, TRANSPOSE, CONJ>),
+            (rocblas_trmm_outofplace_kernel<T, NB, THR_DIM, LEFT, UPPER, TRANSPOSE, CONJ, ACCUM>),
             grid,
             threads,
             0,
@@ -411,6 +476,7 @@ rocblas_status rocblas_trmm_outofplace_dispatch(rocblas_handle   handle,
             m,
             n,
             *alpha,
+            *beta,
             stride_alpha,
             dA,
             offset_a,
@@ -1195,26 +1261,30 @@ rocblas_status rocblas_trmm_outofplace_template(rocblas_handle   handle,
     // trmm full blocks on the diagonal
     rocblas_int trmm_batch_count = k / NB;
 
+    // beta is unused in the plain (ACCUM == false) instantiations; alpha is
+    // passed in its place so the host pointer mode dereference stays valid
     RETURN_IF_ROCBLAS_ERROR(
-        (rocblas_trmm_outofplace_dispatch<T, 32, LEFT, UPPER, TRANS, CONJ>)(handle,
-                                                                            diag,
-                                                                            m_sub,
-                                                                            n_sub,
-                                                                            alpha,
-                                                                            0,
-                                                                            dA,
-                                                                            offset_a,
-                                                                            lda,
-                                                                            NB * a_block_stride,
-                                                                            dB,
-                                                                            offset_b,
-                                                                            ldb,
-                                                                            NB * b_block_stride,
-                                                                            dC,
-                                                                            offset_c,
-                                                                            ldc,
-                                                                            NB * c_block_stride,
-                                                                            trmm_batch_count));
+        (rocblas_trmm_outofplace_dispatch<T, 32, LEFT, UPPER, TRANS, CONJ, false>)(
+            handle,
+            diag,
+            m_sub,
+            n_sub,
+            alpha,
+            alpha,
+            0,
+            dA,
+            offset_a,
+            lda,
+            NB * a_block_stride,
+            dB,
+            offset_b,
+            ldb,
+            NB * b_block_stride,
+            dC,
+            offset_c,
+            ldc,
+            NB * c_block_stride,
+            trmm_batch_count));
 
     rocblas_stride offsetAin, offsetBin, offsetCin;
 
@@ -1229,25 +1299,27 @@ rocblas_status rocblas_trmm_outofplace_template(rocblas_handle   handle,
         offsetCin       = offset_c + k_norem * c_block_stride;
 
         RETURN_IF_ROCBLAS_ERROR(
-            (rocblas_trmm_outofplace_dispatch<T, 32, LEFT, UPPER, TRANS, CONJ>)(handle,
-                                                                                diag,
-                                                                                LEFT ? rem : m,
-                                                                                LEFT ? n : rem,
-                                                                                alpha,
-                                                                                0,
-                                                                                dA,
-                                                                                offsetAin,
-                                                                                lda,
-                                                                                0,
-                                                                                dB,
-                                                                                offsetBin,
-                                                                                ldb,
-                                                                                0,
-                                                                                dC,
-                                                                                offsetCin,
-                                                                                ldc,
-                                                                                0,
-                                                                                1));
+            (rocblas_trmm_outofplace_dispatch<T, 32, LEFT, UPPER, TRANS, CONJ, false>)(
+                handle,
+                diag,
+                LEFT ? rem : m,
+                LEFT ? n : rem,
+                alpha,
+                alpha,
+                0,
+                dA,
+                offsetAin,
+                lda,
+                0,
+                dB,
+                offsetBin,
+                ldb,
+                0,
+                dC,
+                offsetCin,
+                ldc,
+                0,
+                1));
     }
 
     for(int64_t k_sub = NB; k_sub < k; k_sub *= 2)
@@ -1273,7 +1345,9 @@ rocblas_status rocblas_trmm_outofplace_template(rocblas_handle   handle,
         rocblas_stride strideBgemm = k_stride * b_block_stride;
         rocblas_stride strideCgemm = k_stride * c_block_stride;
 
-        // already zeroed out C, so set beta to 1
+        // the triangular-block pass above is the first writer of C (it stores
+        // alpha*rC rather than accumulating), so these gemms add onto valid
+        // data and must run with beta 1
         RETURN_IF_ROCBLAS_ERROR(
             rocblas_internal_gemm_64<false>(handle,
                                             LEFT ? transA : rocblas_operation_none,
@@ -1454,6 +1528,139 @@ rocblas_status rocblas_internal_trmm_outofplace_template(rocblas_handle    handl
 #undef trmm_out_KARGS
 }
 
+// Fused accumulate form C = alpha*op(A)*B + beta*C over strided batches: one
+// pass of the out-of-place tile kernel both multiplies and folds in beta*C,
+// so no separate geam/scale traversal of C is needed per panel update. The
+// gemm panel splitting used by rocblas_trmm_outofplace_template is not
+// applicable here since it spends the kernel batch axis on panels of a
+// single matrix.
+template <typename T>
+rocblas_status rocblas_internal_trmm_accumulate_template(rocblas_handle    handle,
+                                                         rocblas_side      side,
+                                                         rocblas_fill      uplo,
+                                                         rocblas_operation trans_a,
+                                                         rocblas_diagonal  diag,
+                                                         rocblas_int       m,
+                                                         rocblas_int       n,
+                                                         const T*          alpha,
+                                                         const T*          beta,
+                                                         const T*          dA,
+                                                         rocblas_stride    offset_a,
+                                                         rocblas_int       lda,
+                                                         rocblas_stride    stride_a,
+                                                         const T*          dB,
+                                                         rocblas_stride    offset_b,
+                                                         rocblas_int       ldb,
+                                                         rocblas_stride    stride_b,
+                                                         T*                dC,
+                                                         rocblas_stride    offset_c,
+                                                         rocblas_int       ldc,
+                                                         rocblas_stride    stride_c,
+                                                         rocblas_int       batch_count)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0 && *beta == 1)
+        return rocblas_status_success;
+
+#define trmm_acc_KARGS                                                                           \
+    handle, diag, m, n, alpha, beta, 0 /* stride_alpha */, dA, offset_a, lda, stride_a, dB,      \
+        offset_b, ldb, stride_b, dC, offset_c, ldc, stride_c, batch_count
+
+    rocblas_int shape = rocblas_trmm_get_shape(side, uplo, trans_a);
+
+    if(shape == 0)
+    {
+        // left, lower, non-transpose
+        // template args:                                LEFT, UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, true, false, false, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 1)
+    {
+        // left, upper, non-transpose
+        // template args:                                LEFT, UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, true, true, false, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 2)
+    {
+        // left, lower, transpose
+        // template args:                                LEFT, UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, true, false, true, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 3)
+    {
+        // left, upper, transpose
+        // template args:                                LEFT, UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, true, true, true, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 4)
+    {
+        // left, lower, conjugate-transpose
+        // template args:                                LEFT, UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, true, false, true, true, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 5)
+    {
+        // left, upper, conjugate-transpose
+        // template args:                                LEFT, UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, true, true, true, true, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 6)
+    {
+        // right, lower, non-transpose
+        // template args:                                LEFT,  UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, false, false, false, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 7)
+    {
+        // right, upper, non-transpose
+        // template args:                                LEFT,  UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, false, true, false, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 8)
+    {
+        // right, lower, transpose
+        // template args:                                LEFT,  UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, false, false, true, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 9)
+    {
+        // right, upper, transpose
+        // template args:                                LEFT,  UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, false, true, true, false, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 10)
+    {
+        // right, lower, conjugate-transpose
+        // template args:                                LEFT,  UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, false, false, true, true, true>(
+            trmm_acc_KARGS);
+    }
+    else if(shape == 11)
+    {
+        // right, upper, conjugate-transpose
+        // template args:                                LEFT,  UPPER, TRANS, CONJ, ACCUM
+        return rocblas_trmm_outofplace_dispatch<T, 32, false, true, true, true, true>(
+            trmm_acc_KARGS);
+    }
+    else
+    {
+        return rocblas_status_not_implemented;
+    }
+#undef trmm_acc_KARGS
+}
+
 template <int  STOPPING_NB,
           bool BATCHED,
           typename T,
@@ -2165,9 +2372,9 @@ rocblas_status rocblas_internal_trmm_launcher(rocblas_handle    handle,
         // always !BATCHED here so avoiding reference to uninstantiated code
         if constexpr(!BATCHED)
         {
-            // single bathc so applying offset here
-            rocblas_set_matrix_zero_if_alpha_zero_template(
-                handle, m, n, &alpha_0<T>, 0, dC + offset_c, ldc, 0, 1);
+            // no pre-zero of C needed: the diagonal-block kernel writes every
+            // C element before the gemm calls accumulate, and the alpha == 0
+            // device pointer mode case is zeroed at the API level
             return rocblas_internal_trmm_outofplace_template<T>(handle,
                                                                 side,
                                                                 uplo,
@@ -2486,6 +2693,42 @@ INSTANTIATE_TRMM_BATCHED_TEMPLATE(rocblas_double_complex)
 
 #undef INSTANTIATE_TRMM_BATCHED_TEMPLATE
 
+#ifdef INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE
+#error INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE(T_)                                            \
+template rocblas_status rocblas_internal_trmm_accumulate_template<T_>                       \
+                                  (rocblas_handle    handle,                                \
+                                   rocblas_side      side,                                  \
+                                   rocblas_fill      uplo,                                  \
+                                   rocblas_operation trans_a,                               \
+                                   rocblas_diagonal  diag,                                  \
+                                   rocblas_int       m,                                     \
+                                   rocblas_int       n,                                     \
+                                   const T_*         alpha,                                 \
+                                   const T_*         beta,                                  \
+                                   const T_*         dA,                                    \
+                                   rocblas_stride    offset_a,                              \
+                                   rocblas_int       lda,                                   \
+                                   rocblas_stride    stride_a,                              \
+                                   const T_*         dB,                                    \
+                                   rocblas_stride    offset_b,                              \
+                                   rocblas_int       ldb,                                   \
+                                   rocblas_stride    stride_b,                              \
+                                   T_*               dC,                                    \
+                                   rocblas_stride    offset_c,                              \
+                                   rocblas_int       ldc,                                   \
+                                   rocblas_stride    stride_c,                              \
+                                   rocblas_int       batch_count);
+
+INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE(float)
+INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE(double)
+INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE(rocblas_float_complex)
+INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE(rocblas_double_complex)
+
+#undef INSTANTIATE_TRMM_ACCUMULATE_TEMPLATE
+
 #ifdef INSTANTIATE_SET_MATRIX_ZERO_TEMPLATE
 #error INSTANTIATE_SET_MATRIX_ZERO_TEMPLATE already defined
 #endif
@@ -71,3 +71,118 @@ catch(...)
 {
     return exception_to_rocblas_status();
 }
+
+namespace
+{
+    constexpr char rocblas_trsm_ex_invert_name[] = "rocblas_trsm_ex_invert";
+
+    template <typename T>
+    rocblas_status rocblas_trsm_ex_invert_impl(rocblas_handle   handle,
+                                               rocblas_fill     uplo,
+                                               rocblas_diagonal diag,
+                                               rocblas_int      k,
+                                               const T*         A,
+                                               rocblas_int      lda,
+                                               T*               invA,
+                                               rocblas_int      invA_size)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        constexpr rocblas_int BLOCK = ROCBLAS_TRSM_NB;
+
+        // temporary space used to recombine the half-block inverses, sized to match
+        // the c_temp allocation trsm makes when it has to invert A internally
+        size_t c_temp_els = size_t(k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2));
+        if(k % BLOCK)
+            c_temp_els = std::max(c_temp_els, size_t(ROCBLAS_TRTRI_NB) * BLOCK * 2);
+        size_t c_temp_bytes = c_temp_els * sizeof(T);
+
+        if(handle->is_device_memory_size_query())
+        {
+            if(!k)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(c_temp_bytes);
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, rocblas_trsm_ex_invert_name, uplo, diag, k, A, lda, invA, invA_size);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_trsm_ex_invert_name,
+                        "uplo",
+                        rocblas_fill_letter(uplo),
+                        "diag",
+                        rocblas_diag_letter(diag),
+                        "k",
+                        k,
+                        "lda",
+                        lda,
+                        "invA_size",
+                        invA_size);
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(k < 0 || lda < k || lda < 1)
+            return rocblas_status_invalid_size;
+
+        if(!k)
+            return rocblas_status_success;
+
+        if(size_t(invA_size) < size_t(BLOCK) * k)
+            return rocblas_status_invalid_size;
+
+        if(!A || !invA)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(c_temp_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_trtri_trsm_template<BLOCK, false, T>(
+            handle, (T*)w_mem, uplo, diag, k, A, 0, lda, 0, invA, 0, BLOCK * size_t(k), 1);
+    }
+}
+
+rocblas_status rocblas_trsm_ex_invert(rocblas_handle   handle,
+                                      rocblas_fill     uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int      k,
+                                      const void*      A,
+                                      rocblas_int      lda,
+                                      void*            invA,
+                                      rocblas_int      invA_size,
+                                      rocblas_datatype compute_type)
+try
+{
+#define TRSM_EX_INVERT_ARGS(T_) \
+    handle, uplo, diag, k, static_cast<const T_*>(A), lda, static_cast<T_*>(invA), invA_size
+
+    switch(compute_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_trsm_ex_invert_impl(TRSM_EX_INVERT_ARGS(float));
+
+    case rocblas_datatype_f64_r:
+        return rocblas_trsm_ex_invert_impl(TRSM_EX_INVERT_ARGS(double));
+
+    case rocblas_datatype_f32_c:
+        return rocblas_trsm_ex_invert_impl(TRSM_EX_INVERT_ARGS(rocblas_float_complex));
+
+    case rocblas_datatype_f64_c:
+        return rocblas_trsm_ex_invert_impl(TRSM_EX_INVERT_ARGS(rocblas_double_complex));
+
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+#undef TRSM_EX_INVERT_ARGS
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
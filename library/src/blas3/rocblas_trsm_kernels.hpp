@@ -179,6 +179,30 @@ rocblas_status copy_block_unit(rocblas_handle handle,
                                rocblas_stride offset_src = 0,
                                rocblas_stride offset_dst = 0)
 {
+    // Column-pitched copies go through hipMemcpy2DAsync so the staging
+    // traffic runs on the SDMA engines and overlaps with the gemm/trsm
+    // kernels instead of competing for CUs. Batched pointer arrays only
+    // exist on the device, so those copies stay on the kernel path.
+    static constexpr bool plain_ptrs
+        = !std::is_pointer_v<std::remove_cv_t<std::remove_pointer_t<U>>>
+          && !std::is_pointer_v<std::remove_cv_t<std::remove_pointer_t<V>>>;
+
+    if constexpr(plain_ptrs)
+    {
+        if(batch_count == 1 && m > 0 && n > 0 && src_ld >= m && dst_ld >= m)
+        {
+            return rocblas_internal_convert_hip_to_rocblas_status(
+                hipMemcpy2DAsync((T*)dst + offset_dst,
+                                 sizeof(T) * size_t(dst_ld),
+                                 (const T*)src + offset_src,
+                                 sizeof(T) * size_t(src_ld),
+                                 sizeof(T) * size_t(m),
+                                 n,
+                                 hipMemcpyDeviceToDevice,
+                                 handle->get_stream()));
+        }
+    }
+
     rocblas_int blocksX = (m - 1) / 128 + 1; // parameters for device kernel
     rocblas_int blocksY = (n - 1) / 8 + 1;
     dim3        grid(blocksX, blocksY, batch_count);
@@ -1481,12 +1505,16 @@ inline bool trsm_use_special_kernel(rocblas_side      side,
     return false;
 #endif
 
-    // small sizes have their own kernel
-    if(m <= 64 || n <= 64)
-        return false;
-
     rocblas_int k = side == rocblas_side_left ? m : n;
 
+    // small sizes have their own kernel. Only the triangular dimension matters
+    // here: a tall solve with few right-hand sides (k large, the orthogonal
+    // dimension small) still wants the special kernel, which writes solved
+    // panels back into B in place instead of staging the full m * n solution
+    // in workspace like the regular kernels do
+    if(k <= 64)
+        return false;
+
     // to use the special kernel, k must be divisible by block.
     // also, for skinny matrices, the regular kernels perform better
     const bool exact_blocks = (k % BLOCK) == 0;
@@ -1536,7 +1564,11 @@ inline bool rocblas_internal_trsm_use_substitution(rocblas_side side,
     //       Ideally, we can use rocblas_trsm_blksize to determine whether or not to use
     //       the rocblas_trsm_small_substitution function or not.
     return side == rocblas_side_left
-           && ((n <= 32 && batch_count >= 16 && m < 512) || (n > 32 && n <= 128 && m <= 340));
+           && ((n <= 32 && batch_count >= 16 && m < 512) || (n > 32 && n <= 128 && m <= 340)
+               // with few right-hand sides the inversion method is dominated by its
+               // setup stages (trtri + workspace round trips), so take the
+               // workspace-free substitution method up to m == 1024 even unbatched
+               || (n <= 64 && m <= 1024));
 }
 
 inline rocblas_int get_index(const rocblas_int* intervals, rocblas_int max, rocblas_int dim)
@@ -1599,6 +1631,12 @@ rocblas_int rocblas_trsm_blksize(rocblas_int m, rocblas_int n)
     if(blk == 1)
         blk = std::min(m, 512);
 
+    // The tables above stop where the inversion method used to take over; for
+    // the small right-hand-side shapes that rocblas_internal_trsm_use_substitution
+    // now sends here, fall back to a capped block size instead of bailing out
+    if(blk == 0 && n <= 64 && m <= 1024)
+        blk = std::min(m, 512);
+
     // Note: If blk remains zero, we won't be using the substitution method.
     return blk;
 }
@@ -27,6 +27,19 @@
 #include "rocblas_block_sizes.h"
 #include "rocblas_gemm.hpp"
 
+// Diagonal-block size selection. The default 16-wide blocks stage 32x32 tiles
+// in LDS and underfill the larger gfx94x devices; doubling the block size
+// there quadruples per-launch diagonal work and removes one level from the
+// off-diagonal GEMM stage. The wider tile is only used when its 64x64 LDS
+// stage fits (element size <= 8 bytes, i.e. everything but double complex).
+inline rocblas_int rocblas_trtri_block_size(rocblas_handle handle, size_t elem_size)
+{
+    if(handle->getArchMajor() == 9 && handle->getArchMajorMinor() >= 94
+       && elem_size <= sizeof(double))
+        return 2 * ROCBLAS_TRTRI_NB;
+    return ROCBLAS_TRTRI_NB;
+}
+
 template <typename U, typename V>
 inline rocblas_status rocblas_trtri_arg_check(rocblas_handle   handle,
                                               rocblas_fill     uplo,
@@ -86,10 +86,11 @@ rocblas_status rocblas_internal_trtri_template(rocblas_handle   handle,
     }
 }
 
-ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
-    rocblas_internal_trtri_temp_elements(rocblas_int n, rocblas_int batch_count)
+static size_t rocblas_trtri_temp_elements_for_nb(rocblas_int NB,
+                                                 rocblas_int n,
+                                                 rocblas_int batch_count)
 {
-    rocblas_int IB   = ROCBLAS_TRTRI_NB * 2;
+    rocblas_int IB   = NB * 2;
     size_t      size = 0;
     if(n > IB && batch_count > 0)
     {
@@ -127,6 +128,16 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
     return size;
 }
 
+ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
+    rocblas_internal_trtri_temp_elements(rocblas_int n, rocblas_int batch_count)
+{
+    // cover both diagonal-block sizes; rocblas_trtri_block_size selects
+    // between them per architecture and element size at dispatch time
+    size_t size    = rocblas_trtri_temp_elements_for_nb(ROCBLAS_TRTRI_NB, n, batch_count);
+    size_t size_2x = rocblas_trtri_temp_elements_for_nb(2 * ROCBLAS_TRTRI_NB, n, batch_count);
+    return size > size_2x ? size : size_2x;
+}
+
 #define TRTRI_TEMPLATE_PARAMS                                                                   \
     handle, uplo, diag, n, A, offset_A, lda, stride_A, sub_stride_A, invA, offset_invA, ldinvA, \
         stride_invA, sub_stride_invA, batch_count, sub_batch_count, w_C_tmp
@@ -151,6 +162,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                     rocblas_int      sub_batch_count,
                                     T*               w_C_tmp)
 {
+    if(rocblas_trtri_block_size(handle, sizeof(T)) == 2 * ROCBLAS_TRTRI_NB)
+        return rocblas_internal_trtri_template<2 * ROCBLAS_TRTRI_NB, false, T>(
+            TRTRI_TEMPLATE_PARAMS);
     return rocblas_internal_trtri_template<ROCBLAS_TRTRI_NB, false, T>(TRTRI_TEMPLATE_PARAMS);
 }
 
@@ -174,6 +188,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                             rocblas_int      sub_batch_count,
                                             T* const*        w_C_tmp)
 {
+    if(rocblas_trtri_block_size(handle, sizeof(T)) == 2 * ROCBLAS_TRTRI_NB)
+        return rocblas_internal_trtri_template<2 * ROCBLAS_TRTRI_NB, true, T>(
+            TRTRI_TEMPLATE_PARAMS);
     return rocblas_internal_trtri_template<ROCBLAS_TRTRI_NB, true, T>(TRTRI_TEMPLATE_PARAMS);
 }
 
@@ -26,6 +26,7 @@
 #include "rocblas_block_sizes.h"
 #include "rocblas_gemm.hpp"
 #include "rocblas_trtri.hpp"
+#include "stage_scheduler.hpp"
 
 /*
     Invert the IB by IB diagonal blocks of A of size n by n, where n is divisible by IB
@@ -168,46 +169,58 @@ rocblas_status rocblas_trtri_trsm_template(rocblas_handle   handle,
 
         */
 
-        // invert IB * IB diagonal blocks of A and write the result of invA11 and invA22 in invA
-
-        ROCBLAS_LAUNCH_KERNEL((rocblas_trtri_trsm_kernel<NB, IB, IBD, T>),
-                              grid,
-                              threads,
-                              0,
-                              handle->get_stream(),
-                              uplo,
-                              diag,
-                              A,
-                              offset_Ain,
-                              lda,
-                              stride_A,
-                              invA,
-                              offset_invAin,
-                              stride_invA);
-
-        static constexpr size_t sub_blockSize = 128;
-        size_t tri_elements_to_zero           = rocblas_num_non_tri_elements(NB) * sub_blocks;
-        size_t num_sub_blocks = (tri_elements_to_zero + sub_blockSize - 1) / sub_blockSize;
-
-        dim3 grid_fill(num_sub_blocks, batch_count);
-        dim3 threads_fill(sub_blockSize);
-        ROCBLAS_LAUNCH_KERNEL_GRID(grid_fill,
-                                   (rocblas_trtri_fill<sub_blockSize, T>),
-                                   grid_fill,
-                                   threads_fill,
-                                   0,
-                                   handle->get_stream(),
-                                   handle,
-                                   uplo == rocblas_fill_lower ? rocblas_fill_upper
-                                                              : rocblas_fill_lower,
-                                   NB,
-                                   rocblas_num_non_tri_elements(NB),
-                                   NB,
-                                   NB * NB,
-                                   invA,
-                                   offset_invAin,
-                                   stride_invA,
-                                   sub_blocks);
+        {
+            // The IB-diagonal inversions and the opposite-triangle fill write
+            // disjoint parts of invA, so they run as independent stages on
+            // the internal stream pool; the gemm combines below only start
+            // once the scheduler joins both behind the bound stream.
+            rocblas_internal_stage_scheduler sched(handle);
+
+            // invert IB * IB diagonal blocks of A and write the result of invA11 and invA22 in invA
+
+            sched.begin_stage(0, {});
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trtri_trsm_kernel<NB, IB, IBD, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  uplo,
+                                  diag,
+                                  A,
+                                  offset_Ain,
+                                  lda,
+                                  stride_A,
+                                  invA,
+                                  offset_invAin,
+                                  stride_invA);
+            sched.end_stage(0);
+
+            static constexpr size_t sub_blockSize = 128;
+            size_t tri_elements_to_zero           = rocblas_num_non_tri_elements(NB) * sub_blocks;
+            size_t num_sub_blocks = (tri_elements_to_zero + sub_blockSize - 1) / sub_blockSize;
+
+            dim3 grid_fill(num_sub_blocks, batch_count);
+            dim3 threads_fill(sub_blockSize);
+            sched.begin_stage(1, {});
+            ROCBLAS_LAUNCH_KERNEL_GRID(grid_fill,
+                                       (rocblas_trtri_fill<sub_blockSize, T>),
+                                       grid_fill,
+                                       threads_fill,
+                                       0,
+                                       handle->get_stream(),
+                                       handle,
+                                       uplo == rocblas_fill_lower ? rocblas_fill_upper
+                                                                  : rocblas_fill_lower,
+                                       NB,
+                                       rocblas_num_non_tri_elements(NB),
+                                       NB,
+                                       NB * NB,
+                                       invA,
+                                       offset_invAin,
+                                       stride_invA,
+                                       sub_blocks);
+            sched.end_stage(1);
+        }
 
         constexpr rocblas_int JB              = IB * 4;
         rocblas_stride        sub_stride_A    = NB * size_t(lda) + NB;
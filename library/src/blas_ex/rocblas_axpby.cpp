@@ -0,0 +1,839 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Fused scal + axpy: y = alpha * x + beta * y in one pass. The separate
+// rocblas_scal / rocblas_axpy sequence streams y from HBM twice; fusing the
+// two-term update halves memory traffic on this common solver update step.
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_axpby_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpby_name<float>[] = "rocblas_saxpby";
+    template <>
+    constexpr char rocblas_axpby_name<double>[] = "rocblas_daxpby";
+    template <>
+    constexpr char rocblas_axpby_name<rocblas_float_complex>[] = "rocblas_caxpby";
+    template <>
+    constexpr char rocblas_axpby_name<rocblas_double_complex>[] = "rocblas_zaxpby";
+
+    template <typename>
+    constexpr char rocblas_axpby_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpby_batched_name<float>[] = "rocblas_saxpby_batched";
+    template <>
+    constexpr char rocblas_axpby_batched_name<double>[] = "rocblas_daxpby_batched";
+    template <>
+    constexpr char rocblas_axpby_batched_name<rocblas_float_complex>[] = "rocblas_caxpby_batched";
+    template <>
+    constexpr char rocblas_axpby_batched_name<rocblas_double_complex>[] = "rocblas_zaxpby_batched";
+
+    template <typename>
+    constexpr char rocblas_axpby_sb_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpby_sb_name<float>[] = "rocblas_saxpby_strided_batched";
+    template <>
+    constexpr char rocblas_axpby_sb_name<double>[] = "rocblas_daxpby_strided_batched";
+    template <>
+    constexpr char rocblas_axpby_sb_name<rocblas_float_complex>[]
+        = "rocblas_caxpby_strided_batched";
+    template <>
+    constexpr char rocblas_axpby_sb_name<rocblas_double_complex>[]
+        = "rocblas_zaxpby_strided_batched";
+
+    //!
+    //! @brief General kernel (batched, strided batched) of axpby.
+    //!
+    template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+    ROCBLAS_KERNEL(NB)
+    rocblas_axpby_kernel(rocblas_int n,
+                         Ta          alpha_device_host,
+                         Ta          beta_device_host,
+                         Tx __restrict__ x,
+                         rocblas_stride offset_x,
+                         rocblas_int    incx,
+                         rocblas_stride stride_x,
+                         Ty __restrict__ y,
+                         rocblas_stride offset_y,
+                         rocblas_int    incy,
+                         rocblas_stride stride_y)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+
+        int64_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+        if(tid < n)
+        {
+            auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
+            auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
+
+            *ty = Tex(alpha) * Tex(*tx) + Tex(beta) * Tex(*ty);
+        }
+    }
+
+    template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+    rocblas_status rocblas_internal_axpby_launcher(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const Ta*      alpha,
+                                                   const Ta*      beta,
+                                                   Tx             x,
+                                                   rocblas_stride offset_x,
+                                                   rocblas_int    incx,
+                                                   rocblas_stride stride_x,
+                                                   Ty             y,
+                                                   rocblas_stride offset_y,
+                                                   rocblas_int    incy,
+                                                   rocblas_stride stride_y,
+                                                   rocblas_int    batch_count)
+    {
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        int64_t shiftx = incx < 0 ? offset_x - int64_t(incx) * (n - 1) : offset_x;
+        int64_t shifty = incy < 0 ? offset_y - int64_t(incy) * (n - 1) : offset_y;
+
+        dim3 blocks((n - 1) / NB + 1, batch_count);
+        dim3 threads(NB);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpby_kernel<NB, Tex, const Ta*, Tx, Ty>),
+                                  blocks,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  alpha,
+                                  beta,
+                                  x,
+                                  shiftx,
+                                  incx,
+                                  stride_x,
+                                  y,
+                                  shifty,
+                                  incy,
+                                  stride_y);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpby_kernel<NB, Tex, Ta, Tx, Ty>),
+                                  blocks,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  *alpha,
+                                  *beta,
+                                  x,
+                                  shiftx,
+                                  incx,
+                                  stride_x,
+                                  y,
+                                  shifty,
+                                  incy,
+                                  stride_y);
+        }
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpby_impl(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      const T*       alpha,
+                                      const T*       beta,
+                                      const T*       x,
+                                      rocblas_int    incx,
+                                      rocblas_stride stridex,
+                                      T*             y,
+                                      rocblas_int    incy,
+                                      rocblas_stride stridey,
+                                      rocblas_int    batch_count,
+                                      const char*    name,
+                                      const char*    bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, alpha, beta, x, incx, y, incy, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f ",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      LOG_BENCH_SCALAR_VALUE(handle, beta),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, name, "N", n, "incx", incx, "incy", incy, "batch_count", batch_count);
+
+        if(n <= 0 || batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0 && *beta == 1)
+            return rocblas_status_success;
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_internal_axpby_launcher<ROCBLAS_AXPY_NB, T>(
+            handle, n, alpha, beta, x, 0, incx, stridex, y, 0, incy, stridey, batch_count);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpby_batched_impl(rocblas_handle  handle,
+                                              rocblas_int     n,
+                                              const T*        alpha,
+                                              const T*        beta,
+                                              const T* const* x,
+                                              rocblas_int     incx,
+                                              T* const*       y,
+                                              rocblas_int     incy,
+                                              rocblas_int     batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpby_batched_name<T>,
+                      n,
+                      alpha,
+                      beta,
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f axpby_batched -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      LOG_BENCH_SCALAR_VALUE(handle, beta),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_axpby_batched_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "batch_count",
+                        batch_count);
+
+        if(n <= 0 || batch_count <= 0)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0 && *beta == 1)
+            return rocblas_status_success;
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_internal_axpby_launcher<ROCBLAS_AXPY_NB, T>(
+            handle, n, alpha, beta, x, 0, incx, 0, y, 0, incy, 0, batch_count);
+    }
+
+    template <bool BATCHED, typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty>
+    rocblas_status rocblas_axpby_ex_typecasting(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const void*    alpha,
+                                                const void*    beta,
+                                                const void*    x,
+                                                rocblas_int    incx,
+                                                rocblas_stride stride_x,
+                                                void*          y,
+                                                rocblas_int    incy,
+                                                rocblas_stride stride_y,
+                                                rocblas_int    batch_count)
+    {
+        const Ta* alphat = (const Ta*)alpha;
+        const Ta* betat  = (const Ta*)beta;
+
+        if(!alphat || !betat)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alphat == 0 && *betat == 1)
+            return rocblas_status_success;
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        if(BATCHED)
+        {
+            return rocblas_internal_axpby_launcher<ROCBLAS_AXPY_NB, Tex>(handle,
+                                                                         n,
+                                                                         alphat,
+                                                                         betat,
+                                                                         (const Tx* const*)x,
+                                                                         0,
+                                                                         incx,
+                                                                         stride_x,
+                                                                         (Ty* const*)y,
+                                                                         0,
+                                                                         incy,
+                                                                         stride_y,
+                                                                         batch_count);
+        }
+        else
+        {
+            return rocblas_internal_axpby_launcher<ROCBLAS_AXPY_NB, Tex>(handle,
+                                                                         n,
+                                                                         alphat,
+                                                                         betat,
+                                                                         (const Tx*)x,
+                                                                         0,
+                                                                         incx,
+                                                                         stride_x,
+                                                                         (Ty*)y,
+                                                                         0,
+                                                                         incy,
+                                                                         stride_y,
+                                                                         batch_count);
+        }
+    }
+
+    // Same type combinations as axpy_ex; alpha_type covers both alpha and beta.
+    template <bool BATCHED>
+    rocblas_status rocblas_axpby_ex_template(rocblas_handle   handle,
+                                             rocblas_int      n,
+                                             const void*      alpha,
+                                             const void*      beta,
+                                             rocblas_datatype alpha_type,
+                                             const void*      x,
+                                             rocblas_datatype x_type,
+                                             rocblas_int      incx,
+                                             rocblas_stride   stride_x,
+                                             void*            y,
+                                             rocblas_datatype y_type,
+                                             rocblas_int      incy,
+                                             rocblas_stride   stride_y,
+                                             rocblas_int      batch_count,
+                                             rocblas_datatype execution_type)
+    {
+#define rocblas_axpby_ex_typecasting_PARAM \
+    handle, n, alpha, beta, x, incx, stride_x, y, incy, stride_y, batch_count
+
+        if(alpha_type == rocblas_datatype_f16_r && x_type == rocblas_datatype_f16_r
+           && y_type == rocblas_datatype_f16_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED,
+                                                rocblas_half,
+                                                rocblas_half,
+                                                rocblas_half,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_f16_r
+                && y_type == rocblas_datatype_f16_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED, float, rocblas_half, rocblas_half, float>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_bf16_r && x_type == rocblas_datatype_bf16_r
+                && y_type == rocblas_datatype_bf16_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED,
+                                                rocblas_bfloat16,
+                                                rocblas_bfloat16,
+                                                rocblas_bfloat16,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_bf16_r
+                && y_type == rocblas_datatype_bf16_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED,
+                                                float,
+                                                rocblas_bfloat16,
+                                                rocblas_bfloat16,
+                                                float>(rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f16_r && x_type == rocblas_datatype_f16_r
+                && y_type == rocblas_datatype_f16_r && execution_type == rocblas_datatype_f16_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED, rocblas_half>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_f32_r
+                && y_type == rocblas_datatype_f32_r && execution_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED, float>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f64_r && x_type == rocblas_datatype_f64_r
+                && y_type == rocblas_datatype_f64_r && execution_type == rocblas_datatype_f64_r)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED, double>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f32_c && x_type == rocblas_datatype_f32_c
+                && y_type == rocblas_datatype_f32_c && execution_type == rocblas_datatype_f32_c)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED, rocblas_float_complex>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        }
+        else if(alpha_type == rocblas_datatype_f64_c && x_type == rocblas_datatype_f64_c
+                && y_type == rocblas_datatype_f64_c && execution_type == rocblas_datatype_f64_c)
+        {
+            return rocblas_axpby_ex_typecasting<BATCHED, rocblas_double_complex>(
+                rocblas_axpby_ex_typecasting_PARAM);
+        }
+
+        return rocblas_status_not_implemented;
+#undef rocblas_axpby_ex_typecasting_PARAM
+    }
+
+    template <bool BATCHED>
+    rocblas_status rocblas_axpby_ex_impl(rocblas_handle   handle,
+                                         rocblas_int      n,
+                                         const void*      alpha,
+                                         const void*      beta,
+                                         rocblas_datatype alpha_type,
+                                         const void*      x,
+                                         rocblas_datatype x_type,
+                                         rocblas_int      incx,
+                                         rocblas_stride   stride_x,
+                                         void*            y,
+                                         rocblas_datatype y_type,
+                                         rocblas_int      incy,
+                                         rocblas_stride   stride_y,
+                                         rocblas_int      batch_count,
+                                         rocblas_datatype execution_type,
+                                         const char*      name,
+                                         const char*      bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto alpha_type_str = rocblas_datatype_string(alpha_type);
+            auto x_type_str     = rocblas_datatype_string(x_type);
+            auto y_type_str     = rocblas_datatype_string(y_type);
+            auto ex_type_str    = rocblas_datatype_string(execution_type);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                {
+                    rocblas_internal_ostream alphass, betass;
+                    if(log_trace_alpha_beta_ex(alpha_type, alpha, beta, alphass, betass)
+                       == rocblas_status_success)
+                    {
+                        log_trace(handle,
+                                  name,
+                                  n,
+                                  alphass.str(),
+                                  betass.str(),
+                                  alpha_type_str,
+                                  x,
+                                  x_type_str,
+                                  incx,
+                                  y,
+                                  y_type_str,
+                                  incy,
+                                  batch_count,
+                                  ex_type_str);
+                    }
+                }
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                {
+                    std::string alphas, betas;
+                    if(log_bench_alpha_beta_ex(alpha_type, alpha, beta, alphas, betas)
+                       == rocblas_status_success)
+                    {
+                        log_bench(handle,
+                                  ROCBLAS_API_BENCH " -f ",
+                                  bench_name,
+                                  "-n",
+                                  n,
+                                  alphas,
+                                  betas,
+                                  "--a_type",
+                                  alpha_type_str,
+                                  "--b_type",
+                                  x_type_str,
+                                  "--incx",
+                                  incx,
+                                  "--c_type",
+                                  y_type_str,
+                                  "--incy",
+                                  incy,
+                                  "--batch_count",
+                                  batch_count,
+                                  "--compute_type",
+                                  ex_type_str);
+                    }
+                }
+            }
+            else if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                log_trace(handle,
+                          name,
+                          n,
+                          alpha_type_str,
+                          x,
+                          x_type_str,
+                          incx,
+                          y,
+                          y_type_str,
+                          incy,
+                          batch_count,
+                          ex_type_str);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+            {
+                log_profile(handle,
+                            name,
+                            "N",
+                            n,
+                            "a_type",
+                            alpha_type_str,
+                            "b_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "c_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "batch_count",
+                            batch_count,
+                            "compute_type",
+                            ex_type_str);
+            }
+        }
+
+        if(n <= 0 || batch_count <= 0)
+            return rocblas_status_success;
+
+        return rocblas_axpby_ex_template<BATCHED>(handle,
+                                                  n,
+                                                  alpha,
+                                                  beta,
+                                                  alpha_type,
+                                                  x,
+                                                  x_type,
+                                                  incx,
+                                                  stride_x,
+                                                  y,
+                                                  y_type,
+                                                  incy,
+                                                  stride_y,
+                                                  batch_count,
+                                                  execution_type);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                              \
+    rocblas_status name_(rocblas_handle handle,                      \
+                         rocblas_int    n,                           \
+                         const T_*      alpha,                       \
+                         const T_*      beta,                        \
+                         const T_*      x,                           \
+                         rocblas_int    incx,                        \
+                         T_*            y,                           \
+                         rocblas_int    incy)                        \
+    try                                                              \
+    {                                                                \
+        return rocblas_axpby_impl(handle,                            \
+                                  n,                                 \
+                                  alpha,                             \
+                                  beta,                              \
+                                  x,                                 \
+                                  incx,                              \
+                                  0,                                 \
+                                  y,                                 \
+                                  incy,                              \
+                                  0,                                 \
+                                  1,                                 \
+                                  rocblas_axpby_name<T_>,            \
+                                  "axpby");                          \
+    }                                                                \
+    catch(...)                                                       \
+    {                                                                \
+        return exception_to_rocblas_status();                        \
+    }
+
+extern "C" {
+
+IMPL(rocblas_saxpby, float);
+IMPL(rocblas_daxpby, double);
+IMPL(rocblas_caxpby, rocblas_float_complex);
+IMPL(rocblas_zaxpby, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                              \
+    rocblas_status name_(rocblas_handle  handle,                     \
+                         rocblas_int     n,                          \
+                         const T_*       alpha,                      \
+                         const T_*       beta,                       \
+                         const T_* const x[],                        \
+                         rocblas_int     incx,                       \
+                         T_* const       y[],                        \
+                         rocblas_int     incy,                       \
+                         rocblas_int     batch_count)                \
+    try                                                              \
+    {                                                                \
+        return rocblas_axpby_batched_impl(                           \
+            handle, n, alpha, beta, x, incx, y, incy, batch_count);  \
+    }                                                                \
+    catch(...)                                                       \
+    {                                                                \
+        return exception_to_rocblas_status();                        \
+    }
+
+extern "C" {
+
+IMPL(rocblas_saxpby_batched, float);
+IMPL(rocblas_daxpby_batched, double);
+IMPL(rocblas_caxpby_batched, rocblas_float_complex);
+IMPL(rocblas_zaxpby_batched, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                              \
+    rocblas_status name_(rocblas_handle handle,                      \
+                         rocblas_int    n,                           \
+                         const T_*      alpha,                       \
+                         const T_*      beta,                        \
+                         const T_*      x,                           \
+                         rocblas_int    incx,                        \
+                         rocblas_stride stridex,                     \
+                         T_*            y,                           \
+                         rocblas_int    incy,                        \
+                         rocblas_stride stridey,                     \
+                         rocblas_int    batch_count)                 \
+    try                                                              \
+    {                                                                \
+        return rocblas_axpby_impl(handle,                            \
+                                  n,                                 \
+                                  alpha,                             \
+                                  beta,                              \
+                                  x,                                 \
+                                  incx,                              \
+                                  stridex,                           \
+                                  y,                                 \
+                                  incy,                              \
+                                  stridey,                           \
+                                  batch_count,                       \
+                                  rocblas_axpby_sb_name<T_>,         \
+                                  "axpby_strided_batched");          \
+    }                                                                \
+    catch(...)                                                       \
+    {                                                                \
+        return exception_to_rocblas_status();                        \
+    }
+
+extern "C" {
+
+IMPL(rocblas_saxpby_strided_batched, float);
+IMPL(rocblas_daxpby_strided_batched, double);
+IMPL(rocblas_caxpby_strided_batched, rocblas_float_complex);
+IMPL(rocblas_zaxpby_strided_batched, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
+
+extern "C" {
+
+rocblas_status rocblas_axpby_ex(rocblas_handle   handle,
+                                rocblas_int      n,
+                                const void*      alpha,
+                                const void*      beta,
+                                rocblas_datatype alpha_type,
+                                const void*      x,
+                                rocblas_datatype x_type,
+                                rocblas_int      incx,
+                                void*            y,
+                                rocblas_datatype y_type,
+                                rocblas_int      incy,
+                                rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<false>(handle,
+                                        n,
+                                        alpha,
+                                        beta,
+                                        alpha_type,
+                                        x,
+                                        x_type,
+                                        incx,
+                                        0,
+                                        y,
+                                        y_type,
+                                        incy,
+                                        0,
+                                        1,
+                                        execution_type,
+                                        "rocblas_axpby_ex",
+                                        "axpby_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_axpby_batched_ex(rocblas_handle   handle,
+                                        rocblas_int      n,
+                                        const void*      alpha,
+                                        const void*      beta,
+                                        rocblas_datatype alpha_type,
+                                        const void*      x,
+                                        rocblas_datatype x_type,
+                                        rocblas_int      incx,
+                                        void*            y,
+                                        rocblas_datatype y_type,
+                                        rocblas_int      incy,
+                                        rocblas_int      batch_count,
+                                        rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<true>(handle,
+                                       n,
+                                       alpha,
+                                       beta,
+                                       alpha_type,
+                                       x,
+                                       x_type,
+                                       incx,
+                                       0,
+                                       y,
+                                       y_type,
+                                       incy,
+                                       0,
+                                       batch_count,
+                                       execution_type,
+                                       "rocblas_axpby_batched_ex",
+                                       "axpby_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_axpby_strided_batched_ex(rocblas_handle   handle,
+                                                rocblas_int      n,
+                                                const void*      alpha,
+                                                const void*      beta,
+                                                rocblas_datatype alpha_type,
+                                                const void*      x,
+                                                rocblas_datatype x_type,
+                                                rocblas_int      incx,
+                                                rocblas_stride   stridex,
+                                                void*            y,
+                                                rocblas_datatype y_type,
+                                                rocblas_int      incy,
+                                                rocblas_stride   stridey,
+                                                rocblas_int      batch_count,
+                                                rocblas_datatype execution_type)
+try
+{
+    return rocblas_axpby_ex_impl<false>(handle,
+                                        n,
+                                        alpha,
+                                        beta,
+                                        alpha_type,
+                                        x,
+                                        x_type,
+                                        incx,
+                                        stridex,
+                                        y,
+                                        y_type,
+                                        incy,
+                                        stridey,
+                                        batch_count,
+                                        execution_type,
+                                        "rocblas_axpby_strided_batched_ex",
+                                        "axpby_strided_batched_ex");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,418 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Fused axpy + dot: y = alpha * x + y and result = dot(y, y) in one pass.
+// Iterative solvers (e.g. conjugate gradient) alternate axpy and dot over the
+// same vectors, streaming each vector from HBM twice per iteration; fusing
+// the update with the reduction halves memory traffic on that loop.
+
+#include "../blas1/rocblas_dot_kernels.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_axpy_dot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_name<float>[] = "rocblas_saxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<double>[] = "rocblas_daxpy_dot";
+
+    template <typename>
+    constexpr char rocblas_axpy_dot_sb_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_sb_name<float>[] = "rocblas_saxpy_dot_strided_batched";
+    template <>
+    constexpr char rocblas_axpy_dot_sb_name<double>[] = "rocblas_daxpy_dot_strided_batched";
+
+    // Each thread updates WIN strided elements of y and accumulates the
+    // partial sum of the squares of the updated values; the partial sums are
+    // reduced with the same two-kernel scheme as dot.
+    template <int NB, int WIN, typename Ta, typename T, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_axpy_dot_kernel(rocblas_int n,
+                            Ta          alpha_device_host,
+                            const T* __restrict__ xa,
+                            rocblas_stride shiftx,
+                            rocblas_int    incx,
+                            rocblas_stride stridex,
+                            T* __restrict__ ya,
+                            rocblas_stride shifty,
+                            rocblas_int    incy,
+                            rocblas_stride stridey,
+                            V* __restrict__ workspace,
+                            T* __restrict__ out)
+    {
+        const auto* x     = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+        auto*       y     = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+        auto        alpha = load_scalar(alpha_device_host);
+
+        int i   = blockIdx.x * blockDim.x + threadIdx.x;
+        int inc = blockDim.x * gridDim.x;
+
+        V sum = 0;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            T ynew                = alpha * x[i * int64_t(incx)] + y[i * int64_t(incy)];
+            y[i * int64_t(incy)] = ynew;
+            sum += V(ynew) * V(ynew);
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+
+        rocblas_dot_save_sum<false>(sum, workspace, out);
+    }
+
+    template <int NB, typename T>
+    rocblas_status rocblas_internal_axpy_dot_launcher(rocblas_handle handle,
+                                                      rocblas_int    n,
+                                                      const T*       alpha,
+                                                      const T*       x,
+                                                      rocblas_stride offsetx,
+                                                      rocblas_int    incx,
+                                                      rocblas_stride stridex,
+                                                      T*             y,
+                                                      rocblas_stride offsety,
+                                                      rocblas_int    incy,
+                                                      rocblas_stride stridey,
+                                                      rocblas_int    batch_count,
+                                                      T* __restrict__ results,
+                                                      T* __restrict__ workspace)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        int64_t shiftx = incx < 0 ? offsetx - int64_t(incx) * (n - 1) : offsetx;
+        int64_t shifty = incy < 0 ? offsety - int64_t(incy) * (n - 1) : offsety;
+
+        rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        dim3        grid(blocks, batch_count);
+        dim3        threads(NB);
+
+        T* output = results; // device mode output directly to results
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            size_t offset = size_t(batch_count) * blocks;
+            output        = workspace + offset;
+        }
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_dot_kernel<NB, WIN, const T*, T, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  alpha,
+                                  x,
+                                  shiftx,
+                                  incx,
+                                  stridex,
+                                  y,
+                                  shifty,
+                                  incy,
+                                  stridey,
+                                  workspace,
+                                  output);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_dot_kernel<NB, WIN, T, T, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  *alpha,
+                                  x,
+                                  shiftx,
+                                  incx,
+                                  stridex,
+                                  y,
+                                  shifty,
+                                  incy,
+                                  stridey,
+                                  workspace,
+                                  output);
+        }
+
+        if(blocks > 1) // if single block first kernel did all work
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
+                                  dim3(1, batch_count),
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  nullptr,
+                                  blocks,
+                                  workspace,
+                                  output);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
+                                               output,
+                                               sizeof(T) * batch_count,
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+        }
+
+        return rocblas_status_success;
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_impl(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       alpha,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         rocblas_stride stridex,
+                                         T*             y,
+                                         rocblas_int    incy,
+                                         rocblas_stride stridey,
+                                         rocblas_int    batch_count,
+                                         T*             results,
+                                         const char*    name,
+                                         const char*    bench_name)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                                   ROCBLAS_DOT_NB * WIN,
+                                                                   T>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, alpha, x, incx, y, incy, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f ",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, name, "N", n, "incx", incx, "incy", incy, "batch_count", batch_count);
+
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(n <= 0 || batch_count == 0)
+        {
+            if(!results)
+                return rocblas_status_invalid_pointer;
+            if(batch_count > 0)
+            {
+                if(rocblas_pointer_mode_device == handle->pointer_mode)
+                    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                        results, 0, batch_count * sizeof(T), handle->get_stream()));
+                else
+                    for(rocblas_int i = 0; i < batch_count; i++)
+                        results[i] = T(0);
+            }
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !x || !y || !results)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_internal_axpy_dot_launcher<ROCBLAS_DOT_NB>(handle,
+                                                                  n,
+                                                                  alpha,
+                                                                  x,
+                                                                  0,
+                                                                  incx,
+                                                                  stridex,
+                                                                  y,
+                                                                  0,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  results,
+                                                                  (T*)w_mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                 rocblas_int    n,
+                                 const float*   alpha,
+                                 const float*   x,
+                                 rocblas_int    incx,
+                                 float*         y,
+                                 rocblas_int    incy,
+                                 float*         result)
+try
+{
+    return rocblas_axpy_dot_impl(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 0,
+                                 y,
+                                 incy,
+                                 0,
+                                 1,
+                                 result,
+                                 rocblas_axpy_dot_name<float>,
+                                 "axpy_dot");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                 rocblas_int    n,
+                                 const double*  alpha,
+                                 const double*  x,
+                                 rocblas_int    incx,
+                                 double*        y,
+                                 rocblas_int    incy,
+                                 double*        result)
+try
+{
+    return rocblas_axpy_dot_impl(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 0,
+                                 y,
+                                 incy,
+                                 0,
+                                 1,
+                                 result,
+                                 rocblas_axpy_dot_name<double>,
+                                 "axpy_dot");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_saxpy_dot_strided_batched(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const float*   alpha,
+                                                 const float*   x,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 float*         y,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stridey,
+                                                 rocblas_int    batch_count,
+                                                 float*         results)
+try
+{
+    return rocblas_axpy_dot_impl(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batch_count,
+                                 results,
+                                 rocblas_axpy_dot_sb_name<float>,
+                                 "axpy_dot_strided_batched");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_daxpy_dot_strided_batched(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const double*  alpha,
+                                                 const double*  x,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 double*        y,
+                                                 rocblas_int    incy,
+                                                 rocblas_stride stridey,
+                                                 rocblas_int    batch_count,
+                                                 double*        results)
+try
+{
+    return rocblas_axpy_dot_impl(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batch_count,
+                                 results,
+                                 rocblas_axpy_dot_sb_name<double>,
+                                 "axpy_dot_strided_batched");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
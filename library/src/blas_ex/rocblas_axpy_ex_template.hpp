@@ -49,7 +49,7 @@ rocblas_status rocblas_axpy_ex_typecasting(rocblas_handle handle,
                                            rocblas_stride stride_y,
                                            API_INT        batch_count)
 {
-    auto check_numerics = handle->check_numerics;
+    auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
 
     const Ta* alphat = (const Ta*)alpha;
     if(handle->pointer_mode == rocblas_pointer_mode_host)
@@ -32,3 +32,5 @@ constexpr int k_zgemmt_threshold = 2732;
 //common for single, double and complex-float
 constexpr int n_gemmt_threshold = 1232;
 constexpr int k_gemmt_threshold = 932;
+// above this N the GEMM based path wins for any K > 0, all precisions
+constexpr int n_large_gemmt_threshold = 2048;
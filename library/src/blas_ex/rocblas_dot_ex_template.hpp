@@ -47,7 +47,7 @@ rocblas_status rocblas_dot_ex_typecasting(rocblas_handle __restrict__ handle,
                                           void* __restrict__ results,
                                           void* __restrict__ workspace)
 {
-    auto                            check_numerics = handle->check_numerics;
+    auto                            check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
     rocblas_status                  status         = rocblas_status_success;
     static constexpr rocblas_stride offset_0       = 0;
 
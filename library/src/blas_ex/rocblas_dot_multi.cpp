@@ -0,0 +1,298 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Multi-dot: results[i] = dot(x, y_i) for a strided family of k vectors in
+// one launch. Orthogonalization steps in Krylov methods issue k separate dot
+// calls against the same x, paying k launches, k finishing kernels, and k
+// full reads of x; here each block caches its x tile in registers and sweeps
+// all k vectors with it.
+
+#include "../blas1/rocblas_dot_kernels.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_dot_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_dot_multi_name<float>[] = "rocblas_sdot_multi";
+    template <>
+    constexpr char rocblas_dot_multi_name<double>[] = "rocblas_ddot_multi";
+
+    // Each block loads its x tile once into registers, then forms one
+    // partial sum per y vector; the partials are reduced per vector with the
+    // same second-stage kernel as dot.
+    template <int NB, int WIN, typename T, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_dot_multi_kernel(rocblas_int n,
+                             const T* __restrict__ x,
+                             rocblas_stride shiftx,
+                             rocblas_int    incx,
+                             const T* __restrict__ y,
+                             rocblas_stride shifty,
+                             rocblas_int    incy,
+                             rocblas_stride stridey,
+                             rocblas_int    k,
+                             V* __restrict__ workspace,
+                             T* __restrict__ out)
+    {
+        x += shiftx;
+
+        int i0  = blockIdx.x * blockDim.x + threadIdx.x;
+        int inc = blockDim.x * gridDim.x;
+
+        V xtile[WIN];
+        {
+            int i = i0;
+            for(int j = 0; j < WIN && i < n; j++, i += inc)
+                xtile[j] = V(x[i * int64_t(incx)]);
+        }
+
+        for(rocblas_int v = 0; v < k; v++)
+        {
+            const T* yv = y + shifty + v * stridey;
+
+            V   sum = 0;
+            int i   = i0;
+            for(int j = 0; j < WIN && i < n; j++, i += inc)
+                sum += xtile[j] * V(yv[i * int64_t(incy)]);
+
+            sum = rocblas_dot_block_reduce<NB>(sum);
+
+            if(threadIdx.x == 0)
+            {
+                if(gridDim.x == 1) // small N avoid second kernel
+                    out[v] = T(sum);
+                else
+                    workspace[blockIdx.x + size_t(v) * gridDim.x] = sum;
+            }
+            __syncthreads(); // the reduction buffer is reused for the next vector
+        }
+    }
+
+    template <int NB, typename T>
+    rocblas_status rocblas_internal_dot_multi_launcher(rocblas_handle handle,
+                                                       rocblas_int    n,
+                                                       const T*       x,
+                                                       rocblas_int    incx,
+                                                       const T*       y,
+                                                       rocblas_int    incy,
+                                                       rocblas_stride stridey,
+                                                       rocblas_int    k,
+                                                       T* __restrict__ results,
+                                                       T* __restrict__ workspace)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        int64_t shiftx = incx < 0 ? -int64_t(incx) * (n - 1) : 0;
+        int64_t shifty = incy < 0 ? -int64_t(incy) * (n - 1) : 0;
+
+        rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        dim3        grid(blocks);
+        dim3        threads(NB);
+
+        T* output = results; // device mode output directly to results
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            size_t offset = size_t(k) * blocks;
+            output        = workspace + offset;
+        }
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_dot_multi_kernel<NB, WIN, T, T>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              x,
+                              shiftx,
+                              incx,
+                              y,
+                              shifty,
+                              incy,
+                              stridey,
+                              k,
+                              workspace,
+                              output);
+
+        if(blocks > 1) // if single block first kernel did all work
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
+                                  dim3(1, k),
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  nullptr,
+                                  blocks,
+                                  workspace,
+                                  output);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[0],
+                                               output,
+                                               sizeof(T) * k,
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+        }
+
+        return rocblas_status_success;
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_dot_multi_impl(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          const T*       y,
+                                          rocblas_int    incy,
+                                          rocblas_stride stridey,
+                                          rocblas_int    k,
+                                          T*             results,
+                                          const char*    name)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes
+            = rocblas_reduction_kernel_workspace_size<rocblas_int, ROCBLAS_DOT_NB * WIN, T>(n, k);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || k <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, x, incx, y, incy, stridey, k);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f ",
+                      "dot_multi",
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--stride_y",
+                      stridey,
+                      "--batch_count",
+                      k);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(
+                handle, name, "N", n, "incx", incx, "incy", incy, "stride_y", stridey, "k", k);
+
+        if(k < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible.
+        if(n <= 0 || k == 0)
+        {
+            if(!results)
+                return rocblas_status_invalid_pointer;
+            if(k > 0)
+            {
+                if(rocblas_pointer_mode_device == handle->pointer_mode)
+                    RETURN_IF_HIP_ERROR(
+                        hipMemsetAsync(results, 0, k * sizeof(T), handle->get_stream()));
+                else
+                    for(rocblas_int i = 0; i < k; i++)
+                        results[i] = T(0);
+            }
+            return rocblas_status_success;
+        }
+
+        if(!x || !y || !results)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_internal_dot_multi_launcher<ROCBLAS_DOT_NB>(
+            handle, n, x, incx, y, incy, stridey, k, results, (T*)w_mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sdot_multi(rocblas_handle handle,
+                                  rocblas_int    n,
+                                  const float*   x,
+                                  rocblas_int    incx,
+                                  const float*   y,
+                                  rocblas_int    incy,
+                                  rocblas_stride stridey,
+                                  rocblas_int    k,
+                                  float*         results)
+try
+{
+    return rocblas_dot_multi_impl(
+        handle, n, x, incx, y, incy, stridey, k, results, rocblas_dot_multi_name<float>);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_ddot_multi(rocblas_handle handle,
+                                  rocblas_int    n,
+                                  const double*  x,
+                                  rocblas_int    incx,
+                                  const double*  y,
+                                  rocblas_int    incy,
+                                  rocblas_stride stridey,
+                                  rocblas_int    k,
+                                  double*        results)
+try
+{
+    return rocblas_dot_multi_impl(
+        handle, n, x, incx, y, incy, stridey, k, results, rocblas_dot_multi_name<double>);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
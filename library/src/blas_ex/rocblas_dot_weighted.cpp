@@ -0,0 +1,260 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Weighted dot: result = sum_i w[i] * x[i] * y[i], with the weight applied
+// inside the reduction kernel. Pipelines that need weighted or masked
+// reductions otherwise materialize the product w .* x in a temporary vector
+// and hand it to dot, paying an extra full-vector write and read; a 0/1
+// weight vector makes this a masked reduction, and y == x gives a masked or
+// weighted squared norm.
+
+#include "../blas1/rocblas_dot_kernels.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_dot_weighted_name[] = "unknown";
+    template <>
+    constexpr char rocblas_dot_weighted_name<float>[] = "rocblas_sdot_weighted";
+    template <>
+    constexpr char rocblas_dot_weighted_name<double>[] = "rocblas_ddot_weighted";
+
+    // Same first-stage shape as dot, with the weight folded into each term.
+    // WEIGHTED is a compile-time split so the unweighted fallback (w null)
+    // doesn't carry a per-element branch.
+    template <bool WEIGHTED, int NB, int WIN, typename T, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_dot_weighted_kernel(rocblas_int n,
+                                const T* __restrict__ x,
+                                rocblas_stride shiftx,
+                                rocblas_int    incx,
+                                const T* __restrict__ y,
+                                rocblas_stride shifty,
+                                rocblas_int    incy,
+                                const T* __restrict__ w,
+                                rocblas_stride shiftw,
+                                rocblas_int    incw,
+                                V* __restrict__ workspace,
+                                T* __restrict__ out)
+    {
+        x += shiftx;
+        y += shifty;
+        if(WEIGHTED)
+            w += shiftw;
+
+        int i0  = blockIdx.x * blockDim.x + threadIdx.x;
+        int inc = blockDim.x * gridDim.x;
+
+        V   sum = 0;
+        int i   = i0;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            V term = V(x[i * int64_t(incx)]) * V(y[i * int64_t(incy)]);
+            if(WEIGHTED)
+                term *= V(w[i * int64_t(incw)]);
+            sum += term;
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+
+        if(threadIdx.x == 0)
+        {
+            if(gridDim.x == 1) // small N avoid second kernel
+                out[0] = T(sum);
+            else
+                workspace[blockIdx.x] = sum;
+        }
+    }
+
+    template <int NB, typename T>
+    rocblas_status rocblas_internal_dot_weighted_launcher(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          const T*       x,
+                                                          rocblas_int    incx,
+                                                          const T*       y,
+                                                          rocblas_int    incy,
+                                                          const T*       w,
+                                                          rocblas_int    incw,
+                                                          T* __restrict__ result,
+                                                          T* __restrict__ workspace)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        int64_t shiftx = incx < 0 ? -int64_t(incx) * (n - 1) : 0;
+        int64_t shifty = incy < 0 ? -int64_t(incy) * (n - 1) : 0;
+        int64_t shiftw = incw < 0 ? -int64_t(incw) * (n - 1) : 0;
+
+        rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        dim3        grid(blocks);
+        dim3        threads(NB);
+
+        T* output = result; // device mode output directly to result
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            output = workspace + blocks;
+
+#define dot_weighted_KARGS                                                                    \
+    grid, threads, 0, handle->get_stream(), n, x, shiftx, incx, y, shifty, incy, w, shiftw,   \
+        incw, workspace, output
+
+        if(w)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_weighted_kernel<true, NB, WIN, T, T>),
+                                  dot_weighted_KARGS);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_weighted_kernel<false, NB, WIN, T, T>),
+                                  dot_weighted_KARGS);
+#undef dot_weighted_KARGS
+
+        if(blocks > 1) // if single block first kernel did all work
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
+                                  dim3(1),
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  nullptr,
+                                  blocks,
+                                  workspace,
+                                  output);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                result, output, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+        }
+
+        return rocblas_status_success;
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_dot_weighted_impl(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const T*       x,
+                                             rocblas_int    incx,
+                                             const T*       y,
+                                             rocblas_int    incy,
+                                             const T*       w,
+                                             rocblas_int    incw,
+                                             T*             result,
+                                             const char*    name)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes
+            = rocblas_reduction_kernel_workspace_size<rocblas_int, ROCBLAS_DOT_NB * WIN, T>(n, 1);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, x, incx, y, incy, w, incw);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "N", n, "incx", incx, "incy", incy, "incw", incw);
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(!result)
+                return rocblas_status_invalid_pointer;
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(result, 0, sizeof(T), handle->get_stream()));
+            else
+                *result = T(0);
+            return rocblas_status_success;
+        }
+
+        // w may be null: the weight then defaults to one and this is a plain dot
+        if(!x || !y || !result)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_internal_dot_weighted_launcher<ROCBLAS_DOT_NB>(
+            handle, n, x, incx, y, incy, w, incw, result, (T*)w_mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sdot_weighted(rocblas_handle handle,
+                                     rocblas_int    n,
+                                     const float*   x,
+                                     rocblas_int    incx,
+                                     const float*   y,
+                                     rocblas_int    incy,
+                                     const float*   w,
+                                     rocblas_int    incw,
+                                     float*         result)
+try
+{
+    return rocblas_dot_weighted_impl(
+        handle, n, x, incx, y, incy, w, incw, result, rocblas_dot_weighted_name<float>);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_ddot_weighted(rocblas_handle handle,
+                                     rocblas_int    n,
+                                     const double*  x,
+                                     rocblas_int    incx,
+                                     const double*  y,
+                                     rocblas_int    incy,
+                                     const double*  w,
+                                     rocblas_int    incw,
+                                     double*        result)
+try
+{
+    return rocblas_dot_weighted_impl(
+        handle, n, x, incx, y, incy, w, incw, result, rocblas_dot_weighted_name<double>);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_gemm_ex3.hpp"
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    // Scale-and-quantize kernel shared with the gemm_ex3 load path: each
+    // thread converts 4 consecutive elements through explicit_downcast and
+    // commits them as one 32-bit store when the destination group is aligned
+    // and full. Partial or unaligned groups fall back to byte stores.
+    template <int NB, bool SR, typename Ti, typename To, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_f8_convert_kernel(int64_t        n,
+                              V              scale_in,
+                              const Ti*      x,
+                              rocblas_stride stride_x,
+                              To*            y,
+                              rocblas_stride stride_y,
+                              uint32_t       seed)
+    {
+        int64_t base = 4 * (int64_t(blockIdx.x) * NB + threadIdx.x);
+        if(base >= n)
+            return;
+
+        float       scale = load_scalar(scale_in);
+        const Ti*   xb    = x + blockIdx.z * stride_x;
+        To*         yb    = y + blockIdx.z * stride_y;
+
+        if(base + 4 <= n && !(uintptr_t(yb + base) & 3))
+        {
+            union
+            {
+                uint32_t word;
+                To       bytes[4];
+            } pack;
+
+            for(int j = 0; j < 4; ++j)
+            {
+                float v       = scale * float(xb[base + j]);
+                pack.bytes[j] = explicit_downcast<To, float, SR>(
+                    v, SR ? prand_generator(base + j, seed, v) : 0);
+            }
+            *(uint32_t*)(yb + base) = pack.word;
+        }
+        else
+        {
+            int count = n - base < 4 ? int(n - base) : 4;
+            for(int j = 0; j < count; ++j)
+            {
+                float v      = scale * float(xb[base + j]);
+                yb[base + j] = explicit_downcast<To, float, SR>(
+                    v, SR ? prand_generator(base + j, seed, v) : 0);
+            }
+        }
+    }
+
+    template <typename Ti, typename To>
+    rocblas_status rocblas_f8_convert_launcher(rocblas_handle handle,
+                                               int64_t        n,
+                                               const float*   scale,
+                                               const void*    x,
+                                               rocblas_stride stride_x,
+                                               void*          y,
+                                               rocblas_stride stride_y,
+                                               rocblas_int    batch_count,
+                                               uint32_t       flags)
+    {
+        static constexpr int NB = 256;
+
+        hipStream_t stream = handle->get_stream();
+
+        int  blocks = int(((n - 1) / 4) / NB + 1);
+        dim3 grid(blocks, 1, batch_count);
+        dim3 threads(NB);
+
+        bool stochastic_rounding = flags & rocblas_gemm_flags_stochastic_rounding;
+
+        uint32_t seedA = 0, seedB = 0, seedC = 0, seedD = 0;
+        if(stochastic_rounding)
+            rocblas_gemm_ex3_sr_seeds(handle, seedA, seedB, seedC, seedD);
+
+#define F8_CONVERT_KERNEL_PARAM(SR_, scale_)                      \
+    (rocblas_f8_convert_kernel<NB, SR_, Ti, To>), grid, threads,  \
+        0, stream, n, scale_, (const Ti*)x, stride_x, (To*)y,     \
+        stride_y, seedA
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(stochastic_rounding)
+                ROCBLAS_LAUNCH_KERNEL(F8_CONVERT_KERNEL_PARAM(true, scale));
+            else
+                ROCBLAS_LAUNCH_KERNEL(F8_CONVERT_KERNEL_PARAM(false, scale));
+        }
+        else
+        {
+            if(stochastic_rounding)
+                ROCBLAS_LAUNCH_KERNEL(F8_CONVERT_KERNEL_PARAM(true, *scale));
+            else
+                ROCBLAS_LAUNCH_KERNEL(F8_CONVERT_KERNEL_PARAM(false, *scale));
+        }
+
+#undef F8_CONVERT_KERNEL_PARAM
+
+        return rocblas_status_success;
+    }
+
+    template <typename Ti>
+    rocblas_status rocblas_f8_convert_dispatch(rocblas_handle   handle,
+                                               int64_t          n,
+                                               const float*     scale,
+                                               const void*      x,
+                                               rocblas_stride   stride_x,
+                                               void*            y,
+                                               rocblas_datatype y_type,
+                                               rocblas_stride   stride_y,
+                                               rocblas_int      batch_count,
+                                               uint32_t         flags)
+    {
+        switch(y_type)
+        {
+        case rocblas_datatype_f8_r:
+            return rocblas_f8_convert_launcher<Ti, rocblas_f8>(
+                handle, n, scale, x, stride_x, y, stride_y, batch_count, flags);
+        case rocblas_datatype_bf8_r:
+            return rocblas_f8_convert_launcher<Ti, rocblas_bf8>(
+                handle, n, scale, x, stride_x, y, stride_y, batch_count, flags);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_f8_convert(rocblas_handle   handle,
+                                             int64_t          n,
+                                             const float*     scale,
+                                             const void*      x,
+                                             rocblas_datatype x_type,
+                                             rocblas_stride   stride_x,
+                                             void*            y,
+                                             rocblas_datatype y_type,
+                                             rocblas_stride   stride_y,
+                                             rocblas_int      batch_count,
+                                             uint32_t         flags)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_f8_convert", n, stride_x, stride_y, batch_count, flags);
+
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    if(!n || !batch_count)
+        return rocblas_status_success;
+
+    if(!scale || !x || !y)
+        return rocblas_status_invalid_pointer;
+
+    switch(x_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_f8_convert_dispatch<float>(
+            handle, n, scale, x, stride_x, y, y_type, stride_y, batch_count, flags);
+    case rocblas_datatype_f16_r:
+        return rocblas_f8_convert_dispatch<rocblas_half>(
+            handle, n, scale, x, stride_x, y, y_type, stride_y, batch_count, flags);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
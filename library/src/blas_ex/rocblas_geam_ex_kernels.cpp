@@ -111,7 +111,7 @@ rocblas_status rocblas_geam_ex_typecasting(rocblas_handle            handle,
                                            rocblas_int               batch_count,
                                            rocblas_geam_ex_operation geam_ex_op)
 {
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_ex);
     rocblas_status status         = rocblas_status_success;
     if(BATCHED)
     {
@@ -0,0 +1,364 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Min-plus geam with argmin tracking: the relaxation
+//     D(i,j) = min(beta * C(i,j), min_l(alpha * A(i,l) + alpha * B(l,j)))
+// of rocblas_geam_ex_operation_min_plus, additionally recording in an integer
+// matrix which l produced the winner (or -1 when the incumbent beta * C
+// survives). Shortest-path batches otherwise run a separate kernel per
+// relaxation step to recover predecessors, re-reading D and C; fusing the
+// bookkeeping into the update halves the memory traffic per step.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_geam_min_plus_argmin_name[] = "unknown";
+    template <>
+    constexpr char rocblas_geam_min_plus_argmin_name<float>[] = "rocblas_sgeam_min_plus_argmin";
+    template <>
+    constexpr char rocblas_geam_min_plus_argmin_name<double>[] = "rocblas_dgeam_min_plus_argmin";
+
+    template <bool TRANSA, bool TRANSB, int DIM_X, int DIM_Y, typename T, typename TScal>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_geam_min_plus_argmin_kernel(rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        TScal       alpha_in,
+                                        const T* __restrict__ A,
+                                        rocblas_int lda,
+                                        const T* __restrict__ B,
+                                        rocblas_int ldb,
+                                        TScal       beta_in,
+                                        const T* __restrict__ C,
+                                        rocblas_int ldc,
+                                        T* __restrict__ D,
+                                        rocblas_int ldd,
+                                        rocblas_int* __restrict__ argmin,
+                                        rocblas_int ldi)
+    {
+        rocblas_int tx = blockIdx.x * DIM_X + threadIdx.x;
+        rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx >= m || ty >= n)
+            return;
+
+        auto alpha = load_scalar(alpha_in);
+        auto beta  = load_scalar(beta_in);
+
+        T best;
+        rocblas_set_max_value(best);
+        rocblas_int best_l = -1;
+
+        if(k > 0 && !alpha)
+        {
+            // every candidate degenerates to zero; A and B may be null
+            best   = T(0);
+            best_l = 0;
+        }
+        else
+        {
+            for(rocblas_int l = 0; l < k; l++)
+            {
+                T av = TRANSA ? A[l + tx * size_t(lda)] : A[tx + l * size_t(lda)];
+                T bv = TRANSB ? B[ty + l * size_t(ldb)] : B[l + ty * size_t(ldb)];
+
+                // alpha scales each operand as in geam_ex; ties keep the lowest l
+                T cand = alpha * av + alpha * bv;
+                if(cand < best)
+                {
+                    best   = cand;
+                    best_l = l;
+                }
+            }
+        }
+
+        T incumbent = beta ? beta * C[tx + ty * size_t(ldc)] : T(0);
+
+        // the incumbent wins ties so a written index always marks a strict
+        // improvement, which callers use to detect convergence
+        if(k > 0 && best < incumbent)
+        {
+            D[tx + ty * size_t(ldd)]      = best;
+            argmin[tx + ty * size_t(ldi)] = best_l;
+        }
+        else
+        {
+            D[tx + ty * size_t(ldd)]      = incumbent;
+            argmin[tx + ty * size_t(ldi)] = -1;
+        }
+    }
+
+    template <typename T>
+    rocblas_status rocblas_geam_min_plus_argmin_impl(rocblas_handle    handle,
+                                                     rocblas_operation transA,
+                                                     rocblas_operation transB,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       k,
+                                                     const T*          alpha,
+                                                     const T*          A,
+                                                     rocblas_int       lda,
+                                                     const T*          B,
+                                                     rocblas_int       ldb,
+                                                     const T*          beta,
+                                                     const T*          C,
+                                                     rocblas_int       ldc,
+                                                     T*                D,
+                                                     rocblas_int       ldd,
+                                                     rocblas_int*      argmin,
+                                                     rocblas_int       ldi)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_geam_min_plus_argmin_name<T>,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc,
+                      D,
+                      ldd,
+                      argmin,
+                      ldi);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f geam_min_plus_argmin -r",
+                      rocblas_precision_string<T>,
+                      "--transposeA",
+                      rocblas_transpose_letter(transA),
+                      "--transposeB",
+                      rocblas_transpose_letter(transB),
+                      "-m",
+                      m,
+                      "-n",
+                      n,
+                      "-k",
+                      k,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--lda",
+                      lda,
+                      "--ldb",
+                      ldb,
+                      LOG_BENCH_SCALAR_VALUE(handle, beta),
+                      "--ldc",
+                      ldc,
+                      "--ldd",
+                      ldd,
+                      "--ldi",
+                      ldi);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_geam_min_plus_argmin_name<T>,
+                        "transA",
+                        rocblas_transpose_letter(transA),
+                        "transB",
+                        rocblas_transpose_letter(transB),
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "lda",
+                        lda,
+                        "ldb",
+                        ldb,
+                        "ldc",
+                        ldc,
+                        "ldd",
+                        ldd,
+                        "ldi",
+                        ldi);
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose)
+            return rocblas_status_invalid_value;
+        if(transB != rocblas_operation_none && transB != rocblas_operation_transpose)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || k < 0)
+            return rocblas_status_invalid_size;
+
+        if(ldc < m || ldd < m || ldi < m || lda < (transA == rocblas_operation_none ? m : k)
+           || ldb < (transB == rocblas_operation_none ? k : n))
+            return rocblas_status_invalid_size;
+
+        if(C == D && ldc != ldd)
+            return rocblas_status_invalid_size;
+
+        // quick return
+        // Note: k == 0 is not a quick return, D and argmin are still written
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!beta || !D || !argmin)
+            return rocblas_status_invalid_pointer;
+
+        if(k)
+        {
+            if(!alpha)
+                return rocblas_status_invalid_pointer;
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(*alpha && (!A || !B))
+                    return rocblas_status_invalid_pointer;
+            }
+        }
+
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 8;
+
+        dim3 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1);
+        dim3 threads(DIM_X, DIM_Y);
+
+#define geam_argmin_KARGS(alpha_, beta_)                                                 \
+    grid, threads, 0, handle->get_stream(), m, n, k, alpha_, A, lda, B, ldb, beta_, C,   \
+        ldc, D, ldd, argmin, ldi
+
+#define geam_argmin_LAUNCH(TRANSA_, TRANSB_, alpha_, beta_)                       \
+    ROCBLAS_LAUNCH_KERNEL(                                                        \
+        (rocblas_geam_min_plus_argmin_kernel<TRANSA_, TRANSB_, DIM_X, DIM_Y, T>), \
+        geam_argmin_KARGS(alpha_, beta_))
+
+#define geam_argmin_DISPATCH(alpha_, beta_)                    \
+    do                                                         \
+    {                                                          \
+        if(transA == rocblas_operation_none)                   \
+        {                                                      \
+            if(transB == rocblas_operation_none)               \
+                geam_argmin_LAUNCH(false, false, alpha_, beta_); \
+            else                                               \
+                geam_argmin_LAUNCH(false, true, alpha_, beta_);  \
+        }                                                      \
+        else                                                   \
+        {                                                      \
+            if(transB == rocblas_operation_none)               \
+                geam_argmin_LAUNCH(true, false, alpha_, beta_);  \
+            else                                               \
+                geam_argmin_LAUNCH(true, true, alpha_, beta_);   \
+        }                                                      \
+    } while(0)
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            geam_argmin_DISPATCH(alpha, beta);
+        }
+        else
+        {
+            geam_argmin_DISPATCH(k ? *alpha : T(0), *beta);
+        }
+
+#undef geam_argmin_DISPATCH
+#undef geam_argmin_LAUNCH
+#undef geam_argmin_KARGS
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sgeam_min_plus_argmin(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_operation transB,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const float*      alpha,
+                                             const float*      A,
+                                             rocblas_int       lda,
+                                             const float*      B,
+                                             rocblas_int       ldb,
+                                             const float*      beta,
+                                             const float*      C,
+                                             rocblas_int       ldc,
+                                             float*            D,
+                                             rocblas_int       ldd,
+                                             rocblas_int*      argmin,
+                                             rocblas_int       ldi)
+try
+{
+    return rocblas_geam_min_plus_argmin_impl(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, D, ldd, argmin, ldi);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dgeam_min_plus_argmin(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_operation transB,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const double*     alpha,
+                                             const double*     A,
+                                             rocblas_int       lda,
+                                             const double*     B,
+                                             rocblas_int       ldb,
+                                             const double*     beta,
+                                             const double*     C,
+                                             rocblas_int       ldc,
+                                             double*           D,
+                                             rocblas_int       ldd,
+                                             rocblas_int*      argmin,
+                                             rocblas_int       ldi)
+try
+{
+    return rocblas_geam_min_plus_argmin_impl(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, D, ldd, argmin, ldi);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
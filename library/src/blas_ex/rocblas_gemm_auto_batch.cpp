@@ -0,0 +1,327 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Auto-batching for concurrent same-shape gemm_ex calls. Server workloads
+// whose worker threads issue identical small GEMMs within microseconds of
+// each other pay one kernel launch per call; with auto-batching enabled
+// (rocblas_set_gemm_auto_batch) the first arrival for a shape becomes the
+// group leader and waits a bounded window for compatible calls, then
+// dispatches the whole group through rocblas_grouped_gemm_ex on its own
+// stream. Ordering is preserved with events: the leader's stream waits for
+// each member's prior work, and each member's stream waits for the grouped
+// launch before its call returns.
+
+#include "rocblas_gemm_auto_batch.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    // Everything two calls must agree on to share a grouped dispatch. Groups
+    // are looked up by memcmp, so the struct is zeroed before the fields are
+    // assigned and the scalars are compared as raw bytes of compute_type.
+    struct auto_batch_key
+    {
+        rocblas_operation trans_a;
+        rocblas_operation trans_b;
+        rocblas_int       m, n, k, lda, ldb, ldc, ldd;
+        rocblas_datatype  a_type, b_type, c_type, d_type, compute_type;
+        rocblas_gemm_algo algo;
+        int32_t           solution_index;
+        uint32_t          flags;
+        char              alpha[16];
+        char              beta[16];
+
+        bool operator<(const auto_batch_key& rhs) const
+        {
+            return memcmp(this, &rhs, sizeof(*this)) < 0;
+        }
+    };
+
+    struct auto_batch_group
+    {
+        auto_batch_key key;
+
+        std::vector<const void*> a, b, c;
+        std::vector<void*>       d;
+        std::vector<hipEvent_t>  ready; // one per member, marks its prior work
+
+        std::condition_variable cv;
+        bool                    closed   = false; // no longer accepting members
+        bool                    launched = false; // status and done_event valid
+        rocblas_status          status   = rocblas_status_success;
+        hipEvent_t              done_event = nullptr;
+
+        ~auto_batch_group()
+        {
+            // last member out; every hipStreamWaitEvent on it is enqueued
+            if(done_event)
+                (void)(hipEventDestroy)(done_event);
+        }
+    };
+
+    class rocblas_gemm_auto_batcher
+    {
+    public:
+        static rocblas_gemm_auto_batcher& instance()
+        {
+            static rocblas_gemm_auto_batcher batcher;
+            return batcher;
+        }
+
+        rocblas_status
+            run(rocblas_handle handle, const auto_batch_key& key, const void* a, const void* b, const void* c, void* d)
+        {
+            hipStream_t stream = handle->get_stream();
+
+            // Mark this call's position in its stream so the leader can wait
+            // for inputs produced there; without an event the call cannot be
+            // safely reordered onto another stream, so it runs inline.
+            hipEvent_t ready = nullptr;
+            if((hipEventCreateWithFlags)(&ready, hipEventDisableTiming) != hipSuccess)
+                return rocblas_status_continue;
+            if((hipEventRecord)(ready, stream) != hipSuccess)
+            {
+                (void)(hipEventDestroy)(ready);
+                return rocblas_status_continue;
+            }
+
+            std::shared_ptr<auto_batch_group> group;
+            bool                              leader = false;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                auto it = m_open.find(key);
+                if(it == m_open.end())
+                {
+                    group      = std::make_shared<auto_batch_group>();
+                    group->key = key;
+                    m_open.emplace(key, group);
+                    leader = true;
+                }
+                else
+                    group = it->second;
+
+                group->a.push_back(a);
+                group->b.push_back(b);
+                group->c.push_back(c);
+                group->d.push_back(d);
+                group->ready.push_back(ready);
+
+                if(!leader)
+                {
+                    if(rocblas_int(group->a.size()) >= handle->gemm_auto_batch_max_group)
+                    {
+                        group->closed = true;
+                        m_open.erase(key);
+                        group->cv.notify_all(); // wake the leader early
+                    }
+
+                    // wait for the leader to dispatch the group
+                    group->cv.wait(lock, [&] { return group->launched; });
+
+                    rocblas_status status = group->status;
+                    hipEvent_t     done   = group->done_event;
+                    lock.unlock();
+
+                    // order this member's stream after the grouped launch
+                    if(status == rocblas_status_success && done
+                       && (hipStreamWaitEvent)(stream, done, 0) != hipSuccess)
+                        status = rocblas_status_internal_error;
+                    return status;
+                }
+            }
+
+            // Leader: wait out the window (or an early close when the group
+            // fills), then take the group out of circulation and dispatch it.
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                group->cv.wait_for(lock,
+                                   std::chrono::microseconds(handle->gemm_auto_batch_window_us),
+                                   [&] { return group->closed; });
+                if(!group->closed)
+                {
+                    group->closed = true;
+                    m_open.erase(key);
+                }
+            }
+
+            rocblas_int    group_count = rocblas_int(group->a.size());
+            rocblas_status status      = rocblas_status_continue;
+            hipEvent_t     done        = nullptr;
+
+            if(group_count > 1)
+            {
+                // members are blocked on this group; convert anything thrown
+                // into a status they can all return
+                try
+                {
+                    status = dispatch(handle, *group, group_count, &done);
+                }
+                catch(...)
+                {
+                    status = exception_to_rocblas_status();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                group->launched   = true;
+                group->status     = status == rocblas_status_continue ? rocblas_status_success
+                                                                      : status;
+                group->done_event = done;
+            }
+            group->cv.notify_all();
+
+            // the waits issued in dispatch are enqueued; the markers can go
+            for(auto& ev : group->ready)
+                (void)(hipEventDestroy)(ev);
+            group->ready.clear();
+
+            return status;
+        }
+
+    private:
+        rocblas_status dispatch(rocblas_handle          handle,
+                                const auto_batch_group& group,
+                                rocblas_int             group_count,
+                                hipEvent_t*             done)
+        {
+            hipStream_t stream = handle->get_stream();
+
+            // order the grouped launch after every member's prior work
+            for(const auto& ev : group.ready)
+                RETURN_IF_HIP_ERROR((hipStreamWaitEvent)(stream, ev, 0));
+
+            const auto& key = group.key;
+
+            std::vector<rocblas_int> m(group_count, key.m), n(group_count, key.n),
+                k(group_count, key.k), lda(group_count, key.lda), ldb(group_count, key.ldb),
+                ldc(group_count, key.ldc), ldd(group_count, key.ldd);
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_grouped_gemm_ex(handle,
+                                                            key.trans_a,
+                                                            key.trans_b,
+                                                            group_count,
+                                                            m.data(),
+                                                            n.data(),
+                                                            k.data(),
+                                                            key.alpha,
+                                                            group.a.data(),
+                                                            key.a_type,
+                                                            lda.data(),
+                                                            group.b.data(),
+                                                            key.b_type,
+                                                            ldb.data(),
+                                                            key.beta,
+                                                            group.c.data(),
+                                                            key.c_type,
+                                                            ldc.data(),
+                                                            group.d.data(),
+                                                            key.d_type,
+                                                            ldd.data(),
+                                                            key.compute_type,
+                                                            key.algo,
+                                                            key.solution_index,
+                                                            key.flags));
+
+            RETURN_IF_HIP_ERROR((hipEventCreateWithFlags)(done, hipEventDisableTiming));
+            hipError_t hip_status = (hipEventRecord)(*done, stream);
+            if(hip_status != hipSuccess)
+            {
+                (void)(hipEventDestroy)(*done);
+                *done = nullptr;
+                return rocblas_internal_convert_hip_to_rocblas_status(hip_status);
+            }
+
+            return rocblas_status_success;
+        }
+
+        std::mutex m_mutex;
+        std::map<auto_batch_key, std::shared_ptr<auto_batch_group>> m_open;
+    };
+
+} // namespace
+
+rocblas_status rocblas_internal_gemm_auto_batch(rocblas_handle    handle,
+                                                rocblas_operation trans_a,
+                                                rocblas_operation trans_b,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const void*       alpha,
+                                                const void*       a,
+                                                rocblas_datatype  a_type,
+                                                rocblas_int       lda,
+                                                const void*       b,
+                                                rocblas_datatype  b_type,
+                                                rocblas_int       ldb,
+                                                const void*       beta,
+                                                const void*       c,
+                                                rocblas_datatype  c_type,
+                                                rocblas_int       ldc,
+                                                void*             d,
+                                                rocblas_datatype  d_type,
+                                                rocblas_int       ldd,
+                                                rocblas_datatype  compute_type,
+                                                rocblas_gemm_algo algo,
+                                                int32_t           solution_index,
+                                                uint32_t          flags)
+{
+    auto_batch_key key;
+    memset(&key, 0, sizeof(key));
+
+    key.trans_a        = trans_a;
+    key.trans_b        = trans_b;
+    key.m              = m;
+    key.n              = n;
+    key.k              = k;
+    key.lda            = lda;
+    key.ldb            = ldb;
+    key.ldc            = ldc;
+    key.ldd            = ldd;
+    key.a_type         = a_type;
+    key.b_type         = b_type;
+    key.c_type         = c_type;
+    key.d_type         = d_type;
+    key.compute_type   = compute_type;
+    key.algo           = algo;
+    key.solution_index = solution_index;
+    key.flags          = flags;
+
+    size_t scalar_size = rocblas_sizeof_datatype(compute_type);
+    if(!scalar_size || scalar_size > sizeof(key.alpha))
+        return rocblas_status_continue;
+    memcpy(key.alpha, alpha, scalar_size);
+    memcpy(key.beta, beta, scalar_size);
+
+    return rocblas_gemm_auto_batcher::instance().run(handle, key, a, b, c, d);
+}
@@ -62,7 +62,7 @@ try
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    if(handle->getArch() >= 940 && handle->getArch() < 1000)
+    if(handle->supportsFP8())
     {
 
         // Copy alpha and beta to host if on device
@@ -288,7 +288,9 @@ try
                                                        stride_d,
                                                        batch_count,
                                                        compute_type,
-                                                       flags);
+                                                       flags,
+                                                       algo,
+                                                       solution_index);
     }
     else
         return rocblas_status_arch_mismatch;
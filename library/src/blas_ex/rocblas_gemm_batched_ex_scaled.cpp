@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // Applies the per-batch scalars in a single pass over the output:
+    // D_i = alpha[i] * D_i + beta[i] * C_i. The gemm itself runs with
+    // alpha = 1, beta = 0, so this is the only read-modify-write of D.
+    template <int DIM_X, int DIM_Y, typename Tc, typename TcC, typename TcD>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_batched_scaled_epilogue_kernel(rocblas_int       m,
+                                                rocblas_int       n,
+                                                const Tc*         alpha_array,
+                                                const Tc*         beta_array,
+                                                const TcC* const* CP_array,
+                                                rocblas_int       ldc,
+                                                TcD* const*       DP_array,
+                                                rocblas_int       ldd)
+    {
+        rocblas_int tx = blockIdx.x * DIM_X + threadIdx.x;
+        rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx >= m || ty >= n)
+            return;
+
+        Tc alpha = alpha_array[blockIdx.z];
+        Tc beta  = beta_array[blockIdx.z];
+
+        auto*   D     = DP_array[blockIdx.z];
+        int64_t idx_d = ty * int64_t(ldd) + tx;
+
+        if(beta != Tc(0))
+        {
+            const auto* C = CP_array[blockIdx.z];
+            D[idx_d]      = TcD(alpha * Tc(D[idx_d]) + beta * Tc(C[ty * int64_t(ldc) + tx]));
+        }
+        else
+        {
+            D[idx_d] = TcD(alpha * Tc(D[idx_d]));
+        }
+    }
+
+    template <typename Tc, typename TcC, typename TcD>
+    rocblas_status rocblas_gemm_batched_scaled_epilogue(rocblas_handle handle,
+                                                        rocblas_int    m,
+                                                        rocblas_int    n,
+                                                        const void*    alpha_array,
+                                                        const void*    beta_array,
+                                                        const void*    c,
+                                                        rocblas_int    ldc,
+                                                        void*          d,
+                                                        rocblas_int    ldd,
+                                                        rocblas_int    batch_count)
+    {
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 32;
+
+        dim3 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1, batch_count);
+        dim3 threads(DIM_X, DIM_Y);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_scaled_epilogue_kernel<DIM_X, DIM_Y>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              m,
+                              n,
+                              (const Tc*)alpha_array,
+                              (const Tc*)beta_array,
+                              (const TcC* const*)c,
+                              ldc,
+                              (TcD* const*)d,
+                              ldd);
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_batched_ex_scaled_impl(rocblas_handle    handle,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       rocblas_int       k,
+                                                       const void*       alpha_array,
+                                                       const void*       a,
+                                                       rocblas_datatype  a_type,
+                                                       rocblas_int       lda,
+                                                       const void*       b,
+                                                       rocblas_datatype  b_type,
+                                                       rocblas_int       ldb,
+                                                       const void*       beta_array,
+                                                       const void*       c,
+                                                       rocblas_datatype  c_type,
+                                                       rocblas_int       ldc,
+                                                       void*             d,
+                                                       rocblas_datatype  d_type,
+                                                       rocblas_int       ldd,
+                                                       rocblas_int       batch_count,
+                                                       rocblas_datatype  compute_type,
+                                                       rocblas_gemm_algo algo,
+                                                       int32_t           solution_index,
+                                                       uint32_t          flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        const bool HPA = compute_type == rocblas_datatype_f32_r
+                         && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+
+        if(!HPA)
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!handle->is_device_memory_size_query())
+        {
+            if(handle->layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          "rocblas_gemm_batched_ex_scaled",
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          alpha_array,
+                          a,
+                          rocblas_datatype_string(a_type),
+                          lda,
+                          b,
+                          rocblas_datatype_string(b_type),
+                          ldb,
+                          beta_array,
+                          c,
+                          rocblas_datatype_string(c_type),
+                          ldc,
+                          d,
+                          rocblas_datatype_string(d_type),
+                          ldd,
+                          batch_count,
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+        }
+
+        if(trans_a != rocblas_operation_none && trans_a != rocblas_operation_transpose
+           && trans_a != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+           && trans_b != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(ldc < m || ldd < m || lda < (trans_a == rocblas_operation_none ? m : k)
+           || ldb < (trans_b == rocblas_operation_none ? k : n))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+
+        // alpha and beta are device arrays, so their values cannot be
+        // inspected here; all matrix arrays are required
+        if(!alpha_array || !beta_array || !c || !d || (k && (!a || !b)))
+            return rocblas_status_invalid_pointer;
+
+        // The gemm runs with host scalars alpha = 1, beta = 0; the per-batch
+        // device scalars are applied by the fused epilogue below
+        rocblas_union_t one{}, zero{};
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            one.h = rocblas_half(1.0f);
+            break;
+        case rocblas_datatype_f32_r:
+            one.s = 1.0f;
+            break;
+        case rocblas_datatype_f64_r:
+            one.d = 1.0;
+            break;
+        case rocblas_datatype_i32_r:
+            one.i = 1;
+            break;
+        case rocblas_datatype_f32_c:
+            one.c = rocblas_float_complex(1.0f);
+            break;
+        case rocblas_datatype_f64_c:
+            one.z = rocblas_double_complex(1.0);
+            break;
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        auto stride_a = rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m);
+        auto stride_b = rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k);
+        auto stride_c = rocblas_stride(ldc) * n;
+        auto stride_d = rocblas_stride(ldd) * n;
+
+        rocblas_status status = rocblas_gemm_ex_template<true>(handle,
+                                                               trans_a,
+                                                               trans_b,
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               &one,
+                                                               a,
+                                                               a_type,
+                                                               0,
+                                                               lda,
+                                                               stride_a,
+                                                               b,
+                                                               b_type,
+                                                               0,
+                                                               ldb,
+                                                               stride_b,
+                                                               &zero,
+                                                               c,
+                                                               c_type,
+                                                               0,
+                                                               ldc,
+                                                               stride_c,
+                                                               d,
+                                                               d_type,
+                                                               0,
+                                                               ldd,
+                                                               stride_d,
+                                                               batch_count,
+                                                               compute_type,
+                                                               algo,
+                                                               solution_index,
+                                                               flags);
+        if(status != rocblas_status_success)
+            return status;
+
+#define EPILOGUE_PARM handle, m, n, alpha_array, beta_array, c, ldc, d, ldd, batch_count
+
+        // The (c_type, d_type, compute_type) combinations below are exactly
+        // the projections of the combinations the gemm accepts, so a shape
+        // that survived the gemm always matches one of them
+        rocblas_status rb_status = rocblas_status_not_implemented;
+
+        if(compute_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r
+           && d_type == rocblas_datatype_f16_r)
+        {
+            rb_status = rocblas_gemm_batched_scaled_epilogue<rocblas_half,
+                                                             rocblas_half,
+                                                             rocblas_half>(EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_f32_r && c_type == rocblas_datatype_f16_r
+                && d_type == rocblas_datatype_f16_r)
+        {
+            rb_status = rocblas_gemm_batched_scaled_epilogue<float, rocblas_half, rocblas_half>(
+                EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_f32_r && c_type == rocblas_datatype_bf16_r
+                && d_type == rocblas_datatype_bf16_r)
+        {
+            rb_status
+                = rocblas_gemm_batched_scaled_epilogue<float, rocblas_bfloat16, rocblas_bfloat16>(
+                    EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_f32_r && c_type == rocblas_datatype_f32_r
+                && d_type == rocblas_datatype_f32_r)
+        {
+            rb_status = rocblas_gemm_batched_scaled_epilogue<float, float, float>(EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_f64_r && c_type == rocblas_datatype_f64_r
+                && d_type == rocblas_datatype_f64_r)
+        {
+            rb_status = rocblas_gemm_batched_scaled_epilogue<double, double, double>(EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_i32_r && c_type == rocblas_datatype_i32_r
+                && d_type == rocblas_datatype_i32_r)
+        {
+            rb_status
+                = rocblas_gemm_batched_scaled_epilogue<int32_t, int32_t, int32_t>(EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_f32_c && c_type == rocblas_datatype_f32_c
+                && d_type == rocblas_datatype_f32_c)
+        {
+            rb_status = rocblas_gemm_batched_scaled_epilogue<rocblas_float_complex,
+                                                             rocblas_float_complex,
+                                                             rocblas_float_complex>(EPILOGUE_PARM);
+        }
+        else if(compute_type == rocblas_datatype_f64_c && c_type == rocblas_datatype_f64_c
+                && d_type == rocblas_datatype_f64_c)
+        {
+            rb_status = rocblas_gemm_batched_scaled_epilogue<rocblas_double_complex,
+                                                             rocblas_double_complex,
+                                                             rocblas_double_complex>(EPILOGUE_PARM);
+        }
+
+#undef EPILOGUE_PARM
+
+        return rb_status;
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_batched_ex_scaled(rocblas_handle    handle,
+                                                         rocblas_operation trans_a,
+                                                         rocblas_operation trans_b,
+                                                         rocblas_int       m,
+                                                         rocblas_int       n,
+                                                         rocblas_int       k,
+                                                         const void*       alpha_array,
+                                                         const void*       a,
+                                                         rocblas_datatype  a_type,
+                                                         rocblas_int       lda,
+                                                         const void*       b,
+                                                         rocblas_datatype  b_type,
+                                                         rocblas_int       ldb,
+                                                         const void*       beta_array,
+                                                         const void*       c,
+                                                         rocblas_datatype  c_type,
+                                                         rocblas_int       ldc,
+                                                         void*             d,
+                                                         rocblas_datatype  d_type,
+                                                         rocblas_int       ldd,
+                                                         rocblas_int       batch_count,
+                                                         rocblas_datatype  compute_type,
+                                                         rocblas_gemm_algo algo,
+                                                         int32_t           solution_index,
+                                                         uint32_t          flags)
+try
+{
+    return rocblas_gemm_batched_ex_scaled_impl(handle,
+                                               trans_a,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha_array,
+                                               a,
+                                               a_type,
+                                               lda,
+                                               b,
+                                               b_type,
+                                               ldb,
+                                               beta_array,
+                                               c,
+                                               c_type,
+                                               ldc,
+                                               d,
+                                               d_type,
+                                               ldd,
+                                               batch_count,
+                                               compute_type,
+                                               algo,
+                                               solution_index,
+                                               flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// int8 gemm with a fused per-channel dequantize epilogue: the i32
+// accumulator matrix lives only in pooled library workspace and a single
+// pass scales it into the fp16/bf16/fp32 output, so the caller never
+// allocates or re-reads a 4-byte-per-element intermediate.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // D = alpha * scale[row] * W + beta * D in one pass over the i32 workspace
+    template <int DIM_X, int DIM_Y, typename TD>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_dequant_kernel(rocblas_int m,
+                                rocblas_int n,
+                                float       alpha,
+                                const int32_t* __restrict__ W,
+                                rocblas_int ldw,
+                                const float* __restrict__ scale,
+                                float beta,
+                                TD* __restrict__ D,
+                                rocblas_int ldd)
+    {
+        rocblas_int tx = blockIdx.x * DIM_X + threadIdx.x;
+        rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx >= m || ty >= n)
+            return;
+
+        float v = alpha * scale[tx] * float(W[ty * int64_t(ldw) + tx]);
+
+        int64_t idx = ty * int64_t(ldd) + tx;
+        if(beta != 0)
+            v += beta * float(D[idx]);
+
+        D[idx] = TD(v);
+    }
+
+    rocblas_status rocblas_gemm_dequant_launcher(rocblas_handle   handle,
+                                                 rocblas_int      m,
+                                                 rocblas_int      n,
+                                                 float            alpha,
+                                                 const int32_t*   workspace,
+                                                 const float*     scale,
+                                                 float            beta,
+                                                 void*            d,
+                                                 rocblas_datatype d_type,
+                                                 rocblas_int      ldd)
+    {
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 32;
+
+        dim3 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1);
+        dim3 threads(DIM_X, DIM_Y);
+
+#define DEQUANT_LAUNCH(TD_)                                             \
+    ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_dequant_kernel<DIM_X, DIM_Y, TD_>), \
+                          grid,                                         \
+                          threads,                                      \
+                          0,                                            \
+                          handle->get_stream(),                         \
+                          m,                                            \
+                          n,                                            \
+                          alpha,                                        \
+                          workspace,                                    \
+                          m,                                            \
+                          scale,                                        \
+                          beta,                                         \
+                          (TD_*)d,                                      \
+                          ldd)
+
+        if(d_type == rocblas_datatype_f16_r)
+            DEQUANT_LAUNCH(rocblas_half);
+        else if(d_type == rocblas_datatype_bf16_r)
+            DEQUANT_LAUNCH(rocblas_bfloat16);
+        else
+            DEQUANT_LAUNCH(float);
+
+#undef DEQUANT_LAUNCH
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_dequant_impl(rocblas_handle    handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const float*      alpha,
+                                             const void*       a,
+                                             rocblas_int       lda,
+                                             const void*       b,
+                                             rocblas_int       ldb,
+                                             const float*      scale,
+                                             const float*      beta,
+                                             void*             d,
+                                             rocblas_datatype  d_type,
+                                             rocblas_int       ldd)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(d_type != rocblas_datatype_f16_r && d_type != rocblas_datatype_bf16_r
+           && d_type != rocblas_datatype_f32_r)
+            return rocblas_status_not_implemented;
+
+        // i32 accumulator workspace, ld = m
+        size_t dev_bytes = size_t(m) * n * sizeof(int32_t);
+        if(handle->is_device_memory_size_query())
+        {
+            if(m <= 0 || n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_gemm_dequant",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      a,
+                      lda,
+                      b,
+                      ldb,
+                      scale,
+                      d,
+                      rocblas_datatype_string(d_type),
+                      ldd);
+
+        if(m < 0 || n < 0 || k < 0)
+            return rocblas_status_invalid_size;
+
+        rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : k;
+        rocblas_int num_rows_b = trans_b == rocblas_operation_none ? k : n;
+        if(lda < num_rows_a || ldb < num_rows_b || ldd < m)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !scale || !d || (k && (!a || !b)))
+            return rocblas_status_invalid_pointer;
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, rocblas_datatype_f32_r));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+        auto* workspace = (int32_t*)w_mem;
+
+        // i8 x i8 -> i32 into the workspace; scaling is all in the epilogue
+        static const int32_t i32_one = 1, i32_zero = 0;
+
+        rocblas_status status
+            = rocblas_gemm_ex_template<false>(handle,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              &i32_one,
+                                              a,
+                                              rocblas_datatype_i8_r,
+                                              0,
+                                              lda,
+                                              rocblas_stride(lda)
+                                                  * (trans_a == rocblas_operation_none ? k : m),
+                                              b,
+                                              rocblas_datatype_i8_r,
+                                              0,
+                                              ldb,
+                                              rocblas_stride(ldb)
+                                                  * (trans_b == rocblas_operation_none ? n : k),
+                                              &i32_zero,
+                                              workspace,
+                                              rocblas_datatype_i32_r,
+                                              0,
+                                              m,
+                                              rocblas_stride(m) * n,
+                                              workspace,
+                                              rocblas_datatype_i32_r,
+                                              0,
+                                              m,
+                                              rocblas_stride(m) * n,
+                                              1,
+                                              rocblas_datatype_i32_r,
+                                              rocblas_gemm_algo_standard,
+                                              0,
+                                              rocblas_gemm_flags_none);
+        if(status != rocblas_status_success)
+            return status;
+
+        return rocblas_gemm_dequant_launcher(
+            handle, m, n, alpha_h.s, workspace, scale, beta_h.s, d, d_type, ldd);
+    }
+}
+// namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemm_dequant(rocblas_handle    handle,
+                                    rocblas_operation trans_a,
+                                    rocblas_operation trans_b,
+                                    rocblas_int       m,
+                                    rocblas_int       n,
+                                    rocblas_int       k,
+                                    const float*      alpha,
+                                    const void*       a,
+                                    rocblas_int       lda,
+                                    const void*       b,
+                                    rocblas_int       ldb,
+                                    const float*      scale,
+                                    const float*      beta,
+                                    void*             d,
+                                    rocblas_datatype  d_type,
+                                    rocblas_int       ldd)
+try
+{
+    return rocblas_gemm_dequant_impl(
+        handle, trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, scale, beta, d, d_type, ldd);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -56,7 +56,7 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        if(handle->getArch() >= 940 && handle->getArch() < 1000)
+        if(handle->supportsFP8())
         {
             // Copy alpha and beta to host if on device
             rocblas_union_t alpha_h, beta_h;
@@ -282,7 +282,9 @@ namespace
                                                     stride_d,
                                                     batch_count,
                                                     compute_type,
-                                                    flags);
+                                                    flags,
+                                                    algo,
+                                                    solution_index);
         }
         else
             return rocblas_status_arch_mismatch;
@@ -344,3 +346,110 @@ catch(...)
 {
     return exception_to_rocblas_status();
 }
+
+#ifdef BUILD_WITH_TENSILE
+#include "rocblas_gemm_ex3_get_solutions.hpp"
+#endif
+
+// no 64-bit interface
+extern "C" rocblas_status rocblas_gemm_ex3_get_solutions(rocblas_handle      handle,
+                                                         rocblas_operation   trans_a,
+                                                         rocblas_operation   trans_b,
+                                                         rocblas_int         m,
+                                                         rocblas_int         n,
+                                                         rocblas_int         k,
+                                                         const void*         alpha,
+                                                         const void*         a,
+                                                         rocblas_datatype    a_type,
+                                                         rocblas_int         lda,
+                                                         const void*         b,
+                                                         rocblas_datatype    b_type,
+                                                         rocblas_int         ldb,
+                                                         const void*         beta,
+                                                         const void*         c,
+                                                         rocblas_datatype    c_type,
+                                                         rocblas_int         ldc,
+                                                         void*               d,
+                                                         rocblas_datatype    d_type,
+                                                         rocblas_int         ldd,
+                                                         rocblas_computetype compute_type,
+                                                         rocblas_gemm_algo   algo,
+                                                         uint32_t            flags,
+                                                         rocblas_int*        list_array,
+                                                         rocblas_int*        list_size)
+try
+{
+#ifdef BUILD_WITH_TENSILE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    auto validArgs = validateArgs(handle,
+                                  trans_a,
+                                  trans_b,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  a,
+                                  lda,
+                                  b,
+                                  ldb,
+                                  beta,
+                                  c,
+                                  c_type,
+                                  ldc,
+                                  d,
+                                  d_type,
+                                  ldd,
+                                  compute_type);
+
+    if(validArgs != rocblas_status_continue)
+        return validArgs;
+
+    rocblas_int batch_count = 1;
+
+    // TODO: These strides could be 0 ( {} ) instead of 1 ( {1} ) once Tensile is fixed
+    rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
+
+    return rocblas_gemm_ex3_get_solutions_template<false>(handle,
+                                                          trans_a,
+                                                          trans_b,
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          a,
+                                                          a_type,
+                                                          0,
+                                                          lda,
+                                                          stride_a,
+                                                          b,
+                                                          b_type,
+                                                          0,
+                                                          ldb,
+                                                          stride_b,
+                                                          beta,
+                                                          c,
+                                                          c_type,
+                                                          0,
+                                                          ldc,
+                                                          stride_c,
+                                                          d,
+                                                          d_type,
+                                                          0,
+                                                          ldd,
+                                                          stride_d,
+                                                          batch_count,
+                                                          compute_type,
+                                                          flags,
+                                                          CAN_SOLVE,
+                                                          list_array,
+                                                          list_size);
+#else
+    return rocblas_status_excluded_from_build;
+#endif
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
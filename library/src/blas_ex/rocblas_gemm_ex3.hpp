@@ -31,12 +31,12 @@
 #define EX_TYPECASTING_PARM                                                                    \
     handle, trans_a, trans_b, m, n, k, alpha, a, offsetAin, lda, stride_a, b, offsetBin, ldb,  \
         stride_b, beta, c, offsetCin, ldc, stride_c, d, offsetDin, ldd, stride_d, batch_count, \
-        rocblas_gemm_flags(flags)
+        rocblas_gemm_flags(flags), algo, solution_index
 
 #define EX_TEMPLATE_PARM                                                                           \
     handle, trans_a, trans_b, m, n, k, alpha, a, a_type, offsetAin, lda, stride_a, b, b_type,      \
         offsetBin, ldb, stride_b, beta, c, c_type, offsetCin, ldc, stride_c, d, d_type, offsetDin, \
-        ldd, stride_d, batch_count, compute_type, flags
+        ldd, stride_d, batch_count, compute_type, flags, algo, solution_index
 
 template <bool BATCHED>
 rocblas_status rocblas_gemm_ex3_template(rocblas_handle      handle,
@@ -69,7 +69,9 @@ rocblas_status rocblas_gemm_ex3_template(rocblas_handle      handle,
                                          rocblas_stride      stride_d,
                                          rocblas_int         batch_count,
                                          rocblas_computetype compute_type,
-                                         uint32_t            flags);
+                                         uint32_t            flags,
+                                         rocblas_gemm_algo   algo           = rocblas_gemm_algo_standard,
+                                         int32_t             solution_index = 0);
 
 /*
  *  Pseudo random number generator
@@ -119,6 +121,34 @@ ROCBLAS_KERNEL_ILF uint32_t prand_generator(int64_t tid, uint32_t seed, T val)
     return 0;
 }
 
+/*
+ *  Host-side seed derivation for the stochastic-rounding conversion kernels.
+ *  SR_SEED_A/B/C/D environment overrides pin individual streams; otherwise
+ *  the seeds derive from the handle's base seed (rocblas_set_stochastic_seed)
+ *  and a per-call counter, so each call on a handle rounds with a distinct
+ *  stream and a seeded handle reproduces the whole sequence.
+ */
+inline void rocblas_gemm_ex3_sr_seeds(
+    rocblas_handle handle, uint32_t& seedA, uint32_t& seedB, uint32_t& seedC, uint32_t& seedD)
+{
+    uint32_t base = handle->sr_seed
+                    + 0x9e3779b9u * handle->sr_call_count.fetch_add(1, std::memory_order_relaxed);
+
+    seedA = base;
+    seedB = base ^ 0x85ebca6bu;
+    seedC = base ^ 0xc2b2ae35u;
+    seedD = base ^ 0x27d4eb2fu;
+
+    if(const char* sr_seed_string = std::getenv("SR_SEED_A"))
+        seedA = std::strtol(sr_seed_string, NULL, 10);
+    if(const char* sr_seed_string = std::getenv("SR_SEED_B"))
+        seedB = std::strtol(sr_seed_string, NULL, 10);
+    if(const char* sr_seed_string = std::getenv("SR_SEED_C"))
+        seedC = std::strtol(sr_seed_string, NULL, 10);
+    if(const char* sr_seed_string = std::getenv("SR_SEED_D"))
+        seedD = std::strtol(sr_seed_string, NULL, 10);
+}
+
 /***************************************************************************************
     Quantization: New single matrix conversion routine
 ****************************************************************************************/
@@ -492,8 +522,12 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
                                  rocblas_int        ldd,
                                  rocblas_stride     stride_d,
                                  rocblas_int        batch_count,
-                                 rocblas_gemm_flags flags)
+                                 rocblas_gemm_flags flags,
+                                 rocblas_gemm_algo  algo,
+                                 int32_t            solution_index)
 {
+    // algo/solution_index only select Tensile kernels; the source-kernel
+    // fallback ignores them
     float alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
         rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
@@ -503,32 +537,9 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
         return rocblas_status_invalid_size;
 
     bool     stochastic_rounding = flags & rocblas_gemm_flags_stochastic_rounding;
-    uint32_t seedA = 0, seedB = 0, seedC = 0;
+    uint32_t seedA = 0, seedB = 0, seedC = 0, seedD = 0;
     if(stochastic_rounding)
-    {
-        std::random_device                      rd;
-        std::mt19937                            gen(rd());
-        std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFFFFFF);
-
-        const char* sr_seed_string_a = std::getenv("SR_SEED_A");
-        const char* sr_seed_string_b = std::getenv("SR_SEED_B");
-        const char* sr_seed_string_c = std::getenv("SR_SEED_C");
-
-        if(sr_seed_string_a != NULL)
-            seedA = std::strtol(sr_seed_string_a, NULL, 10);
-        else
-            seedA = distribution(gen);
-
-        if(sr_seed_string_b != NULL)
-            seedB = std::strtol(sr_seed_string_b, NULL, 10);
-        else
-            seedB = distribution(gen);
-
-        if(sr_seed_string_c != NULL)
-            seedC = std::strtol(sr_seed_string_c, NULL, 10);
-        else
-            seedC = distribution(gen);
-    }
+        rocblas_gemm_ex3_sr_seeds(handle, seedA, seedB, seedC, seedD);
 
     hipStream_t stream = handle->get_stream();
     const int   dim_m  = 16;
@@ -1511,7 +1522,9 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
                                  rocblas_int        ldd,
                                  rocblas_stride     stride_d,
                                  rocblas_int        batch_count,
-                                 rocblas_gemm_flags flags)
+                                 rocblas_gemm_flags flags,
+                                 rocblas_gemm_algo  algo,
+                                 int32_t            solution_index)
 {
     float alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
@@ -1549,10 +1562,6 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
 
     {
         // finding space for GSU
-        int32_t           solution_index = 0;
-        uint32_t          flag           = 0;
-        rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
-
         rocblas_start_device_memory_size_query(handle);
 
         rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
@@ -1586,7 +1595,9 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
                                          stride_d,
                                          batch_count,
                                          rocblas_compute_type_f32,
-                                         flags);
+                                         flags,
+                                         algo,
+                                         solution_index);
 
         rocblas_stop_device_memory_size_query(handle, &memsize);
         if(memsize)
@@ -1623,32 +1634,9 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
     const int   blk_n  = 32;
     const int   blk_k  = 32;
 
-    uint32_t seedA = 0, seedB = 0, seedC = 0;
+    uint32_t seedA = 0, seedB = 0, seedC = 0, seedD = 0;
     if(stochastic_rounding)
-    {
-        std::random_device                      rd;
-        std::mt19937                            gen(rd());
-        std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFFFFFF);
-
-        const char* sr_seed_string_a = std::getenv("SR_SEED_A");
-        const char* sr_seed_string_b = std::getenv("SR_SEED_B");
-        const char* sr_seed_string_c = std::getenv("SR_SEED_C");
-
-        if(sr_seed_string_a != NULL)
-            seedA = std::strtol(sr_seed_string_a, NULL, 10);
-        else
-            seedA = distribution(gen);
-
-        if(sr_seed_string_b != NULL)
-            seedB = std::strtol(sr_seed_string_b, NULL, 10);
-        else
-            seedB = distribution(gen);
-
-        if(sr_seed_string_c != NULL)
-            seedC = std::strtol(sr_seed_string_c, NULL, 10);
-        else
-            seedC = distribution(gen);
-    }
+        rocblas_gemm_ex3_sr_seeds(handle, seedA, seedB, seedC, seedD);
 
     // A conversion
     // clang-format off
@@ -2000,9 +1988,6 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
 
     //call gemm
 
-    int32_t           solution_index = 0;
-    rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
-
     status = rocblas_gemm_ex3_template<false>(handle,
                                            trans_a,
                                            trans_b,
@@ -2033,36 +2018,61 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
                                            stride_d,
                                            batch_count,
                                            rocblas_compute_type_f32,
-                                           flags);
+                                           flags,
+                                           algo,
+                                           solution_index);
 
     if(!To_is_final)
     {
         dim3 dimBlock(dim_m, dim_n, 1);
         dim3 dimGrid(((m - 1) / blk_m) + 1, ((n - 1) / blk_n) + 1, batch_count);
 
-
-        ROCBLAS_LAUNCH_KERNEL((general_conversion_kernel<To_expected,
-                                                        To,
-                                                        To,    // final output
-                                                        dim_m,
-                                                        dim_n,
-                                                        blk_m,
-                                                        blk_n,
-                                                        'N',
-                                                        false>),
-                                                        dimGrid,
-                                                        dimBlock,
-                                                        0,
-                                                        stream,
-                                                        m,
-                                                        n,
-                                                        (const To_expected*)w_mem_dTD, //rocblas_half
-                                                        (To*)d,
-                                                        ldd_new,
-                                                        ldd,
-                                                        stride_d,
-                                                        batch_count,
-                                                        seedA);
+        if(stochastic_rounding)
+            ROCBLAS_LAUNCH_KERNEL((general_conversion_kernel<To_expected,
+                                                            To,
+                                                            To,    // final output
+                                                            dim_m,
+                                                            dim_n,
+                                                            blk_m,
+                                                            blk_n,
+                                                            'N',
+                                                            true>),
+                                                            dimGrid,
+                                                            dimBlock,
+                                                            0,
+                                                            stream,
+                                                            m,
+                                                            n,
+                                                            (const To_expected*)w_mem_dTD, //rocblas_half
+                                                            (To*)d,
+                                                            ldd_new,
+                                                            ldd,
+                                                            stride_d,
+                                                            batch_count,
+                                                            seedD);
+        else if(!stochastic_rounding)
+            ROCBLAS_LAUNCH_KERNEL((general_conversion_kernel<To_expected,
+                                                            To,
+                                                            To,    // final output
+                                                            dim_m,
+                                                            dim_n,
+                                                            blk_m,
+                                                            blk_n,
+                                                            'N',
+                                                            false>),
+                                                            dimGrid,
+                                                            dimBlock,
+                                                            0,
+                                                            stream,
+                                                            m,
+                                                            n,
+                                                            (const To_expected*)w_mem_dTD, //rocblas_half
+                                                            (To*)d,
+                                                            ldd_new,
+                                                            ldd,
+                                                            stride_d,
+                                                            batch_count,
+                                                            seedD);
     }
 
         return status;
@@ -2099,7 +2109,9 @@ rocblas_status gemm_ex3_tensile(rocblas_handle     handle,
                                          rocblas_int        ldd,
                                          rocblas_stride     stride_d,
                                          rocblas_int        batch_count,
-                                         rocblas_gemm_flags flags)
+                                         rocblas_gemm_flags flags,
+                                         rocblas_gemm_algo  algo,
+                                         int32_t            solution_index)
 {
     RocblasContractionProblem<TiA, To, Tacc, TiB, TcA, TcB> problem{
         handle,   trans_a, trans_b,  m,        n,           k,        alpha,    a,
@@ -2107,7 +2119,7 @@ rocblas_status gemm_ex3_tensile(rocblas_handle     handle,
         offset_b, beta,    c,        nullptr,  ldc,         stride_c, offset_c, d,
         nullptr,  ldd,     stride_d, offset_d, batch_count, true,     flags};
 
-    return runContractionProblem(problem);
+    return runContractionProblem(problem, algo, solution_index);
 }
 
 template <bool BATCHED,
@@ -2142,13 +2154,15 @@ rocblas_status gemm_ex3_typecasting_tensile(rocblas_handle    handle,
                                            rocblas_int       ldd,
                                            rocblas_stride    stride_d,
                                            rocblas_int       batch_count,
-                                           rocblas_gemm_flags flags)
+                                           rocblas_gemm_flags flags,
+                                           rocblas_gemm_algo  algo,
+                                           int32_t            solution_index)
 {
     Tacc alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
         rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
 
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_gemm);
     rocblas_status status         = rocblas_status_success;
 
     if(!isAligned(a, sizeof(TiA)) || !isAligned(b, sizeof(TiB)) || !isAligned(c, sizeof(To))
@@ -2222,7 +2236,9 @@ rocblas_status gemm_ex3_typecasting_tensile(rocblas_handle    handle,
                                                                    ldd,
                                                                    stride_d,
                                                                    batch_count,
-                                                                   flags);
+                                                                   flags,
+                                                                   algo,
+                                                                   solution_index);
 
     if(check_numerics && !std::is_same_v<TiA, signed char> && !std::is_same_v<TiB, signed char>)
     {
@@ -2367,7 +2383,9 @@ rocblas_status rocblas_gemm_ex3_template(rocblas_handle      handle,
                                          rocblas_stride      stride_d,
                                          rocblas_int         batch_count,
                                          rocblas_computetype compute_type,
-                                         uint32_t            flags)
+                                         uint32_t            flags,
+                                         rocblas_gemm_algo   algo,
+                                         int32_t             solution_index)
 {
     // Note: k==0 is not an early exit, since C still needs to be multiplied by beta
     if(!m || !n || !batch_count)
@@ -2750,7 +2768,9 @@ rocblas_status rocblas_gemm_batched_ex3_typecasting(rocblas_handle      handle,
                                          rocblas_stride      stride_d,
                                          rocblas_int         batch_count,
                                          rocblas_computetype compute_type,
-                                         uint32_t            flags)
+                                         uint32_t            flags,
+                                         rocblas_gemm_algo   algo,
+                                         int32_t             solution_index)
 {
     rocblas_status rb_status = rocblas_status_not_implemented;
 
@@ -2820,7 +2840,9 @@ rocblas_status rocblas_gemm_batched_ex3_typecasting(rocblas_handle      handle,
                                                         stride_d,
                                                         1,
                                                         compute_type,
-                                                        flags);
+                                                        flags,
+                                                        algo,
+                                                        solution_index);
             if(rb_status!=rocblas_status_success)
                 return rb_status;
         }
@@ -2859,7 +2881,9 @@ rocblas_status rocblas_gemm_batched_ex3_typecasting(rocblas_handle      handle,
                                                         stride_d,
                                                         1,
                                                         compute_type,
-                                                        flags);
+                                                        flags,
+                                                        algo,
+                                                        solution_index);
             if(rb_status!=rocblas_status_success)
                 return rb_status;
         }
@@ -2900,7 +2924,9 @@ rocblas_status rocblas_gemm_batched_ex3_template(rocblas_handle      handle,
                                          rocblas_stride      stride_d,
                                          rocblas_int         batch_count,
                                          rocblas_computetype compute_type,
-                                         uint32_t            flags)
+                                         uint32_t            flags,
+                                         rocblas_gemm_algo   algo           = rocblas_gemm_algo_standard,
+                                         int32_t             solution_index = 0)
 {
     if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
     {
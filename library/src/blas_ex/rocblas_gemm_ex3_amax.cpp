@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    // Grid-stride absolute-max reduction over the gemm output. Partial block
+    // maxima are combined with atomicMax on the raw float bits, which is
+    // order-preserving for the non-negative absolute values, so the result
+    // is deterministic and needs no second reduction pass.
+    template <int NB, typename TD>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemm_ex3_amax_kernel(
+        rocblas_int m, rocblas_int n, const TD* D, rocblas_int ldd, float* amax)
+    {
+        __shared__ float red[NB];
+
+        int64_t total = int64_t(m) * n;
+        float   v     = 0.0f;
+
+        for(int64_t i = int64_t(blockIdx.x) * NB + threadIdx.x; i < total;
+            i += int64_t(gridDim.x) * NB)
+        {
+            int64_t row = i % m;
+            int64_t col = i / m;
+            v           = fmaxf(v, fabsf(float(D[col * int64_t(ldd) + row])));
+        }
+
+        red[threadIdx.x] = v;
+        __syncthreads();
+
+        for(int s = NB / 2; s > 0; s >>= 1)
+        {
+            if(threadIdx.x < s)
+                red[threadIdx.x] = fmaxf(red[threadIdx.x], red[threadIdx.x + s]);
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0)
+            atomicMax((unsigned int*)amax, __float_as_uint(red[0]));
+    }
+
+    template <typename TD>
+    rocblas_status rocblas_gemm_ex3_amax_launcher(rocblas_handle handle,
+                                                  rocblas_int    m,
+                                                  rocblas_int    n,
+                                                  const void*    d,
+                                                  rocblas_int    ldd,
+                                                  float*         amax)
+    {
+        static constexpr int NB         = 256;
+        static constexpr int max_blocks = 65536;
+
+        hipStream_t stream = handle->get_stream();
+
+        // 0.0f is all-zero bits, so the atomicMax accumulator can be cleared
+        // with a memset on the same stream
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(amax, 0, sizeof(float), stream));
+
+        int64_t total  = int64_t(m) * n;
+        int     blocks = int(std::min((total - 1) / NB + 1, int64_t(max_blocks)));
+
+        dim3 grid(blocks);
+        dim3 threads(NB);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_ex3_amax_kernel<NB>),
+                              grid,
+                              threads,
+                              0,
+                              stream,
+                              m,
+                              n,
+                              (const TD*)d,
+                              ldd,
+                              amax);
+
+        return rocblas_status_success;
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_ex3_amax(rocblas_handle      handle,
+                                                rocblas_operation   trans_a,
+                                                rocblas_operation   trans_b,
+                                                rocblas_int         m,
+                                                rocblas_int         n,
+                                                rocblas_int         k,
+                                                const void*         alpha,
+                                                const void*         a,
+                                                rocblas_datatype    a_type,
+                                                rocblas_int         lda,
+                                                const void*         b,
+                                                rocblas_datatype    b_type,
+                                                rocblas_int         ldb,
+                                                const void*         beta,
+                                                const void*         c,
+                                                rocblas_datatype    c_type,
+                                                rocblas_int         ldc,
+                                                void*               d,
+                                                rocblas_datatype    d_type,
+                                                rocblas_int         ldd,
+                                                rocblas_computetype compute_type,
+                                                rocblas_gemm_algo   algo,
+                                                int32_t             solution_index,
+                                                uint32_t            flags,
+                                                float*              amax)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_gemm_ex3_amax", m, n, k, amax);
+
+    rocblas_status status = rocblas_gemm_ex3(handle,
+                                             trans_a,
+                                             trans_b,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             a,
+                                             a_type,
+                                             lda,
+                                             b,
+                                             b_type,
+                                             ldb,
+                                             beta,
+                                             c,
+                                             c_type,
+                                             ldc,
+                                             d,
+                                             d_type,
+                                             ldd,
+                                             compute_type,
+                                             algo,
+                                             solution_index,
+                                             flags);
+    if(status != rocblas_status_success || handle->is_device_memory_size_query())
+        return status;
+
+    if(!amax)
+        return rocblas_status_invalid_pointer;
+
+    // the gemm quick-returns on empty sizes; the amax of an empty output is 0
+    if(!m || !n)
+        return rocblas_internal_convert_hip_to_rocblas_status(
+            hipMemsetAsync(amax, 0, sizeof(float), handle->get_stream()));
+
+    switch(d_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_gemm_ex3_amax_launcher<float>(handle, m, n, d, ldd, amax);
+    case rocblas_datatype_f16_r:
+        return rocblas_gemm_ex3_amax_launcher<rocblas_half>(handle, m, n, d, ldd, amax);
+    case rocblas_datatype_f8_r:
+        return rocblas_gemm_ex3_amax_launcher<rocblas_f8>(handle, m, n, d, ldd, amax);
+    case rocblas_datatype_bf8_r:
+        return rocblas_gemm_ex3_amax_launcher<rocblas_bf8>(handle, m, n, d, ldd, amax);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
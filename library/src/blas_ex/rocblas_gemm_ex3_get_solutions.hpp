@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#ifdef BUILD_WITH_TENSILE
+#include "../blas3/Tensile/gemm_tensile.hpp"
+#endif
+
+#include "../blas3/rocblas_gemm.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+
+// enumeration counterpart of gemm_ex3_tensile: builds the same contraction
+// problem and lists every solution that can solve it
+template <bool BATCHED,
+          typename TiA,
+          typename TiB = TiA,
+          typename To  = TiA,
+          typename TcA,
+          typename TcB,
+          typename Tacc>
+rocblas_status gemm_ex3_get_solutions_typecasting(rocblas_handle    handle,
+                                                  rocblas_operation trans_a,
+                                                  rocblas_operation trans_b,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const void*       alpha,
+                                                  const void*       a,
+                                                  rocblas_int       offsetAin,
+                                                  rocblas_int       lda,
+                                                  rocblas_stride    stride_a,
+                                                  const void*       b,
+                                                  rocblas_int       offsetBin,
+                                                  rocblas_int       ldb,
+                                                  rocblas_stride    stride_b,
+                                                  const void*       beta,
+                                                  const void*       c,
+                                                  rocblas_int       offsetCin,
+                                                  rocblas_int       ldc,
+                                                  rocblas_stride    stride_c,
+                                                  void*             d,
+                                                  rocblas_int       offsetDin,
+                                                  rocblas_int       ldd,
+                                                  rocblas_stride    stride_d,
+                                                  rocblas_int       batch_count,
+                                                  rocblas_gemm_flags flags,
+                                                  rocblas_tensile_get_solution_option option,
+                                                  rocblas_int*                        list_array,
+                                                  rocblas_int*                        list_size)
+{
+    RocblasContractionProblem<TiA, To, Tacc, TiB, TcA, TcB> problem{handle,
+                                                                    trans_a,
+                                                                    trans_b,
+                                                                    m,
+                                                                    n,
+                                                                    k,
+                                                                    (const Tacc*)alpha,
+                                                                    (const TiA*)a,
+                                                                    nullptr,
+                                                                    lda,
+                                                                    stride_a,
+                                                                    offsetAin,
+                                                                    (const TiB*)b,
+                                                                    nullptr,
+                                                                    ldb,
+                                                                    stride_b,
+                                                                    offsetBin,
+                                                                    (const Tacc*)beta,
+                                                                    (const To*)c,
+                                                                    nullptr,
+                                                                    ldc,
+                                                                    stride_c,
+                                                                    offsetCin,
+                                                                    (To*)d,
+                                                                    nullptr,
+                                                                    ldd,
+                                                                    stride_d,
+                                                                    offsetDin,
+                                                                    batch_count,
+                                                                    true,
+                                                                    rocblas_gemm_flags(flags)};
+
+    return getAllSolutions(problem, option, list_array, list_size);
+}
+
+// mirrors the direct Tensile dispatch of rocblas_gemm_ex3_template; type
+// combinations that are routed through the quantization path are not
+// enumerated, since those run a converted-type contraction internally
+template <bool BATCHED>
+rocblas_status rocblas_gemm_ex3_get_solutions_template(rocblas_handle      handle,
+                                                       rocblas_operation   trans_a,
+                                                       rocblas_operation   trans_b,
+                                                       rocblas_int         m,
+                                                       rocblas_int         n,
+                                                       rocblas_int         k,
+                                                       const void*         alpha,
+                                                       const void*         a,
+                                                       rocblas_datatype    a_type,
+                                                       rocblas_int         offsetAin,
+                                                       rocblas_int         lda,
+                                                       rocblas_stride      stride_a,
+                                                       const void*         b,
+                                                       rocblas_datatype    b_type,
+                                                       rocblas_int         offsetBin,
+                                                       rocblas_int         ldb,
+                                                       rocblas_stride      stride_b,
+                                                       const void*         beta,
+                                                       const void*         c,
+                                                       rocblas_datatype    c_type,
+                                                       rocblas_int         offsetCin,
+                                                       rocblas_int         ldc,
+                                                       rocblas_stride      stride_c,
+                                                       void*               d,
+                                                       rocblas_datatype    d_type,
+                                                       rocblas_int         offsetDin,
+                                                       rocblas_int         ldd,
+                                                       rocblas_stride      stride_d,
+                                                       rocblas_int         batch_count,
+                                                       rocblas_computetype compute_type,
+                                                       uint32_t            flags,
+                                                       rocblas_tensile_get_solution_option option,
+                                                       rocblas_int* list_array,
+                                                       rocblas_int* list_size)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    if(BATCHED)
+    {
+        stride_a = rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m);
+        stride_b = rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k);
+        stride_c = rocblas_stride(ldc) * n;
+        stride_d = rocblas_stride(ldd) * n;
+    }
+
+    rocblas_status rb_status = rocblas_status_not_implemented;
+
+#define EX3_GET_SOLS_PARM                                                                      \
+    handle, trans_a, trans_b, m, n, k, alpha, a, offsetAin, lda, stride_a, b, offsetBin, ldb,  \
+        stride_b, beta, c, offsetCin, ldc, stride_c, d, offsetDin, ldd, stride_d, batch_count, \
+        rocblas_gemm_flags(flags), option, list_array, list_size
+
+    if(compute_type != rocblas_compute_type_f32)
+        return rb_status;
+
+    if(a_type == rocblas_datatype_f8_r && b_type == rocblas_datatype_f8_r)
+    {
+        if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           float,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           rocblas_half,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_f8_r && d_type == rocblas_datatype_f8_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           rocblas_f8,
+                                                           float>(EX3_GET_SOLS_PARM);
+    }
+    else if(a_type == rocblas_datatype_bf8_r && b_type == rocblas_datatype_bf8_r)
+    {
+        if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           float,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           rocblas_half,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_bf8_r && d_type == rocblas_datatype_bf8_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           float>(EX3_GET_SOLS_PARM);
+    }
+    else if(a_type == rocblas_datatype_f8_r && b_type == rocblas_datatype_bf8_r)
+    {
+        if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           float,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           rocblas_half,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_bf8_r && d_type == rocblas_datatype_bf8_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           float>(EX3_GET_SOLS_PARM);
+    }
+    else if(a_type == rocblas_datatype_bf8_r && b_type == rocblas_datatype_f8_r)
+    {
+        if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           float,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           rocblas_half,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           float>(EX3_GET_SOLS_PARM);
+        else if(c_type == rocblas_datatype_bf8_r && d_type == rocblas_datatype_bf8_r)
+            rb_status = gemm_ex3_get_solutions_typecasting<BATCHED,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           rocblas_bf8,
+                                                           rocblas_bf8,
+                                                           rocblas_f8,
+                                                           float>(EX3_GET_SOLS_PARM);
+    }
+
+#undef EX3_GET_SOLS_PARM
+
+    return rb_status;
+}
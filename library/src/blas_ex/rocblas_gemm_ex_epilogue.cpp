@@ -0,0 +1,572 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    ROCBLAS_KERNEL_ILF float rocblas_gemm_epilogue_tanh(float x)
+    {
+        return tanhf(x);
+    }
+
+    ROCBLAS_KERNEL_ILF double rocblas_gemm_epilogue_tanh(double x)
+    {
+        return tanh(x);
+    }
+
+    // Applies bias and/or activation in a single pass over the output:
+    // D = act(D + bias). Runs after the gemm, so this is the only extra
+    // traffic over D regardless of how many epilogue pieces are enabled.
+    template <int DIM_X,
+              int DIM_Y,
+              rocblas_gemm_epilogue EPI,
+              typename Tc,
+              typename TD,
+              typename TPtr>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_ex_epilogue_kernel(rocblas_int    m,
+                                    rocblas_int    n,
+                                    TPtr           DP_array,
+                                    rocblas_int    ldd,
+                                    rocblas_stride stride_d,
+                                    const Tc*      bias,
+                                    rocblas_stride bias_stride)
+    {
+        rocblas_int tx = blockIdx.x * DIM_X + threadIdx.x;
+        rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx >= m || ty >= n)
+            return;
+
+        auto*   D   = load_ptr_batch(DP_array, blockIdx.z, 0, stride_d);
+        int64_t idx = ty * int64_t(ldd) + tx;
+
+        // activations are evaluated in float (double for double compute)
+        using Tact = std::conditional_t<
+            EPI == rocblas_gemm_epilogue_none,
+            Tc,
+            std::conditional_t<std::is_same_v<Tc, double>, double, float>>;
+
+        Tact v = Tact(Tc(D[idx]));
+
+        if(bias)
+            v += Tact(Tc(bias[blockIdx.z * bias_stride + tx]));
+
+        if constexpr(EPI == rocblas_gemm_epilogue_relu)
+        {
+            v = v > Tact(0) ? v : Tact(0);
+        }
+        else if constexpr(EPI == rocblas_gemm_epilogue_gelu)
+        {
+            // tanh approximation of gelu
+            v = Tact(0.5) * v
+                * (Tact(1)
+                   + rocblas_gemm_epilogue_tanh(Tact(0.7978845608028654)
+                                                * (v + Tact(0.044715) * v * v * v)));
+        }
+
+        D[idx] = TD(v);
+    }
+
+    template <rocblas_gemm_epilogue EPI, typename Tc, typename TD, bool BATCHED>
+    rocblas_status rocblas_gemm_ex_epilogue_launcher(rocblas_handle handle,
+                                                     rocblas_int    m,
+                                                     rocblas_int    n,
+                                                     void*          d,
+                                                     rocblas_int    ldd,
+                                                     rocblas_stride stride_d,
+                                                     const void*    bias,
+                                                     rocblas_stride bias_stride,
+                                                     rocblas_int    batch_count)
+    {
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 32;
+
+        dim3 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1, batch_count);
+        dim3 threads(DIM_X, DIM_Y);
+
+        using TPtr = std::conditional_t<BATCHED, TD* const*, TD*>;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_ex_epilogue_kernel<DIM_X, DIM_Y, EPI, Tc, TD>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              m,
+                              n,
+                              (TPtr)d,
+                              ldd,
+                              stride_d,
+                              (const Tc*)bias,
+                              bias_stride);
+
+        return rocblas_status_success;
+    }
+
+    template <typename Tc, typename TD, bool BATCHED>
+    rocblas_status rocblas_gemm_ex_epilogue_typed(rocblas_handle        handle,
+                                                  rocblas_int           m,
+                                                  rocblas_int           n,
+                                                  void*                 d,
+                                                  rocblas_int           ldd,
+                                                  rocblas_stride        stride_d,
+                                                  const void*           bias,
+                                                  rocblas_stride        bias_stride,
+                                                  rocblas_gemm_epilogue epilogue,
+                                                  rocblas_int           batch_count)
+    {
+        switch(epilogue)
+        {
+        case rocblas_gemm_epilogue_none:
+            return rocblas_gemm_ex_epilogue_launcher<rocblas_gemm_epilogue_none, Tc, TD, BATCHED>(
+                handle, m, n, d, ldd, stride_d, bias, bias_stride, batch_count);
+        case rocblas_gemm_epilogue_relu:
+            if constexpr(!rocblas_is_complex<Tc> && !std::is_same_v<Tc, int32_t>)
+                return rocblas_gemm_ex_epilogue_launcher<rocblas_gemm_epilogue_relu,
+                                                         Tc,
+                                                         TD,
+                                                         BATCHED>(
+                    handle, m, n, d, ldd, stride_d, bias, bias_stride, batch_count);
+            break;
+        case rocblas_gemm_epilogue_gelu:
+            if constexpr(!rocblas_is_complex<Tc> && !std::is_same_v<Tc, int32_t>)
+                return rocblas_gemm_ex_epilogue_launcher<rocblas_gemm_epilogue_gelu,
+                                                         Tc,
+                                                         TD,
+                                                         BATCHED>(
+                    handle, m, n, d, ldd, stride_d, bias, bias_stride, batch_count);
+            break;
+        }
+        return rocblas_status_not_implemented;
+    }
+
+    template <bool BATCHED>
+    rocblas_status rocblas_gemm_ex_epilogue_impl(rocblas_handle        handle,
+                                                 rocblas_operation     trans_a,
+                                                 rocblas_operation     trans_b,
+                                                 rocblas_int           m,
+                                                 rocblas_int           n,
+                                                 rocblas_int           k,
+                                                 const void*           alpha,
+                                                 const void*           a,
+                                                 rocblas_datatype      a_type,
+                                                 rocblas_int           lda,
+                                                 rocblas_stride        stride_a,
+                                                 const void*           b,
+                                                 rocblas_datatype      b_type,
+                                                 rocblas_int           ldb,
+                                                 rocblas_stride        stride_b,
+                                                 const void*           beta,
+                                                 const void*           c,
+                                                 rocblas_datatype      c_type,
+                                                 rocblas_int           ldc,
+                                                 rocblas_stride        stride_c,
+                                                 void*                 d,
+                                                 rocblas_datatype      d_type,
+                                                 rocblas_int           ldd,
+                                                 rocblas_stride        stride_d,
+                                                 rocblas_int           batch_count,
+                                                 rocblas_datatype      compute_type,
+                                                 rocblas_gemm_algo     algo,
+                                                 int32_t               solution_index,
+                                                 uint32_t              flags,
+                                                 const void*           bias,
+                                                 rocblas_stride        bias_stride,
+                                                 rocblas_gemm_epilogue epilogue,
+                                                 const char*           name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(epilogue != rocblas_gemm_epilogue_none && epilogue != rocblas_gemm_epilogue_relu
+           && epilogue != rocblas_gemm_epilogue_gelu)
+            return rocblas_status_invalid_value;
+
+        // activations are only defined for the real floating point compute types
+        if(epilogue != rocblas_gemm_epilogue_none
+           && (compute_type == rocblas_datatype_i32_r || compute_type == rocblas_datatype_f32_c
+               || compute_type == rocblas_datatype_f64_c))
+            return rocblas_status_not_implemented;
+
+        const bool HPA = compute_type == rocblas_datatype_f32_r
+                         && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+
+        if(!HPA)
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query())
+        {
+            if(handle->layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          name,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          a,
+                          rocblas_datatype_string(a_type),
+                          lda,
+                          b,
+                          rocblas_datatype_string(b_type),
+                          ldb,
+                          c,
+                          rocblas_datatype_string(c_type),
+                          ldc,
+                          d,
+                          rocblas_datatype_string(d_type),
+                          ldd,
+                          batch_count,
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags),
+                          bias,
+                          bias_stride,
+                          epilogue);
+        }
+
+        auto validArgs = rocblas_gemm_ex_arg_check(handle,
+                                                   trans_a,
+                                                   trans_b,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   a,
+                                                   lda,
+                                                   b,
+                                                   ldb,
+                                                   beta,
+                                                   c,
+                                                   c_type,
+                                                   ldc,
+                                                   d,
+                                                   d_type,
+                                                   ldd,
+                                                   compute_type,
+                                                   batch_count);
+
+        if(validArgs != rocblas_status_continue)
+        {
+            if(validArgs == rocblas_status_success)
+                RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return validArgs;
+        }
+
+        rocblas_status status = rocblas_gemm_ex_template<BATCHED>(handle,
+                                                                  trans_a,
+                                                                  trans_b,
+                                                                  m,
+                                                                  n,
+                                                                  k,
+                                                                  alpha,
+                                                                  a,
+                                                                  a_type,
+                                                                  0,
+                                                                  lda,
+                                                                  stride_a,
+                                                                  b,
+                                                                  b_type,
+                                                                  0,
+                                                                  ldb,
+                                                                  stride_b,
+                                                                  beta,
+                                                                  c,
+                                                                  c_type,
+                                                                  0,
+                                                                  ldc,
+                                                                  stride_c,
+                                                                  d,
+                                                                  d_type,
+                                                                  0,
+                                                                  ldd,
+                                                                  stride_d,
+                                                                  batch_count,
+                                                                  compute_type,
+                                                                  algo,
+                                                                  solution_index,
+                                                                  flags);
+        if(status != rocblas_status_success)
+            return status;
+
+        // nothing fused: the call degenerates to a plain gemm
+        if(!bias && epilogue == rocblas_gemm_epilogue_none)
+            return rocblas_status_success;
+
+#define EPILOGUE_PARM(Tc_, TD_)                                        \
+    rocblas_gemm_ex_epilogue_typed<Tc_, TD_, BATCHED>(                 \
+        handle, m, n, d, ldd, stride_d, bias, bias_stride, epilogue, batch_count)
+
+        // the (compute_type, d_type) pairs below are the projections of the
+        // type combinations the gemm accepts
+        rocblas_status rb_status = rocblas_status_not_implemented;
+
+        if(compute_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r)
+            rb_status = EPILOGUE_PARM(rocblas_half, rocblas_half);
+        else if(compute_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f16_r)
+            rb_status = EPILOGUE_PARM(float, rocblas_half);
+        else if(compute_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_bf16_r)
+            rb_status = EPILOGUE_PARM(float, rocblas_bfloat16);
+        else if(compute_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
+            rb_status = EPILOGUE_PARM(float, float);
+        else if(compute_type == rocblas_datatype_f64_r && d_type == rocblas_datatype_f64_r)
+            rb_status = EPILOGUE_PARM(double, double);
+        else if(compute_type == rocblas_datatype_i32_r && d_type == rocblas_datatype_i32_r)
+            rb_status = EPILOGUE_PARM(int32_t, int32_t);
+        else if(compute_type == rocblas_datatype_f32_c && d_type == rocblas_datatype_f32_c)
+            rb_status = EPILOGUE_PARM(rocblas_float_complex, rocblas_float_complex);
+        else if(compute_type == rocblas_datatype_f64_c && d_type == rocblas_datatype_f64_c)
+            rb_status = EPILOGUE_PARM(rocblas_double_complex, rocblas_double_complex);
+
+#undef EPILOGUE_PARM
+
+        return rb_status;
+    }
+}
+// namespace
+
+extern "C" {
+
+rocblas_status rocblas_gemm_ex_epilogue(rocblas_handle        handle,
+                                        rocblas_operation     trans_a,
+                                        rocblas_operation     trans_b,
+                                        rocblas_int           m,
+                                        rocblas_int           n,
+                                        rocblas_int           k,
+                                        const void*           alpha,
+                                        const void*           a,
+                                        rocblas_datatype      a_type,
+                                        rocblas_int           lda,
+                                        const void*           b,
+                                        rocblas_datatype      b_type,
+                                        rocblas_int           ldb,
+                                        const void*           beta,
+                                        const void*           c,
+                                        rocblas_datatype      c_type,
+                                        rocblas_int           ldc,
+                                        void*                 d,
+                                        rocblas_datatype      d_type,
+                                        rocblas_int           ldd,
+                                        rocblas_datatype      compute_type,
+                                        rocblas_gemm_algo     algo,
+                                        int32_t               solution_index,
+                                        uint32_t              flags,
+                                        const void*           bias,
+                                        rocblas_gemm_epilogue epilogue)
+try
+{
+    return rocblas_gemm_ex_epilogue_impl<false>(
+        handle,
+        trans_a,
+        trans_b,
+        m,
+        n,
+        k,
+        alpha,
+        a,
+        a_type,
+        lda,
+        rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m),
+        b,
+        b_type,
+        ldb,
+        rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k),
+        beta,
+        c,
+        c_type,
+        ldc,
+        rocblas_stride(ldc) * n,
+        d,
+        d_type,
+        ldd,
+        rocblas_stride(ldd) * n,
+        1,
+        compute_type,
+        algo,
+        solution_index,
+        flags,
+        bias,
+        0,
+        epilogue,
+        "rocblas_gemm_ex_epilogue");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_batched_ex_epilogue(rocblas_handle        handle,
+                                                rocblas_operation     trans_a,
+                                                rocblas_operation     trans_b,
+                                                rocblas_int           m,
+                                                rocblas_int           n,
+                                                rocblas_int           k,
+                                                const void*           alpha,
+                                                const void*           a,
+                                                rocblas_datatype      a_type,
+                                                rocblas_int           lda,
+                                                const void*           b,
+                                                rocblas_datatype      b_type,
+                                                rocblas_int           ldb,
+                                                const void*           beta,
+                                                const void*           c,
+                                                rocblas_datatype      c_type,
+                                                rocblas_int           ldc,
+                                                void*                 d,
+                                                rocblas_datatype      d_type,
+                                                rocblas_int           ldd,
+                                                rocblas_int           batch_count,
+                                                rocblas_datatype      compute_type,
+                                                rocblas_gemm_algo     algo,
+                                                int32_t               solution_index,
+                                                uint32_t              flags,
+                                                const void*           bias,
+                                                rocblas_stride        bias_stride,
+                                                rocblas_gemm_epilogue epilogue)
+try
+{
+    return rocblas_gemm_ex_epilogue_impl<true>(
+        handle,
+        trans_a,
+        trans_b,
+        m,
+        n,
+        k,
+        alpha,
+        a,
+        a_type,
+        lda,
+        rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m),
+        b,
+        b_type,
+        ldb,
+        rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k),
+        beta,
+        c,
+        c_type,
+        ldc,
+        rocblas_stride(ldc) * n,
+        d,
+        d_type,
+        ldd,
+        rocblas_stride(ldd) * n,
+        batch_count,
+        compute_type,
+        algo,
+        solution_index,
+        flags,
+        bias,
+        bias_stride,
+        epilogue,
+        "rocblas_gemm_batched_ex_epilogue");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_strided_batched_ex_epilogue(rocblas_handle        handle,
+                                                        rocblas_operation     trans_a,
+                                                        rocblas_operation     trans_b,
+                                                        rocblas_int           m,
+                                                        rocblas_int           n,
+                                                        rocblas_int           k,
+                                                        const void*           alpha,
+                                                        const void*           a,
+                                                        rocblas_datatype      a_type,
+                                                        rocblas_int           lda,
+                                                        rocblas_stride        stride_a,
+                                                        const void*           b,
+                                                        rocblas_datatype      b_type,
+                                                        rocblas_int           ldb,
+                                                        rocblas_stride        stride_b,
+                                                        const void*           beta,
+                                                        const void*           c,
+                                                        rocblas_datatype      c_type,
+                                                        rocblas_int           ldc,
+                                                        rocblas_stride        stride_c,
+                                                        void*                 d,
+                                                        rocblas_datatype      d_type,
+                                                        rocblas_int           ldd,
+                                                        rocblas_stride        stride_d,
+                                                        rocblas_int           batch_count,
+                                                        rocblas_datatype      compute_type,
+                                                        rocblas_gemm_algo     algo,
+                                                        int32_t               solution_index,
+                                                        uint32_t              flags,
+                                                        const void*           bias,
+                                                        rocblas_stride        bias_stride,
+                                                        rocblas_gemm_epilogue epilogue)
+try
+{
+    return rocblas_gemm_ex_epilogue_impl<false>(handle,
+                                                trans_a,
+                                                trans_b,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                a,
+                                                a_type,
+                                                lda,
+                                                stride_a,
+                                                b,
+                                                b_type,
+                                                ldb,
+                                                stride_b,
+                                                beta,
+                                                c,
+                                                c_type,
+                                                ldc,
+                                                stride_c,
+                                                d,
+                                                d_type,
+                                                ldd,
+                                                stride_d,
+                                                batch_count,
+                                                compute_type,
+                                                algo,
+                                                solution_index,
+                                                flags,
+                                                bias,
+                                                bias_stride,
+                                                epilogue,
+                                                "rocblas_gemm_strided_batched_ex_epilogue");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
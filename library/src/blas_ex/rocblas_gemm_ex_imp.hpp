@@ -23,9 +23,14 @@
 #include "handle.hpp"
 #include "rocblas.h"
 
+#include "cpu_overhead.hpp"
 #include "int64_helpers.hpp"
 #include "logging.hpp"
+#include "rocblas_gemm_auto_batch.hpp"
 #include "rocblas_gemm_ex.hpp"
+#include "rocblas_gemm_pack.hpp"
+#include "rocblas_gemm_split_refine.hpp"
+#include "tuning.hpp"
 #include "utility.hpp"
 
 namespace
@@ -59,10 +64,44 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        rocblas_internal_cpu_overhead_timer overhead_timer(handle,
+                                                           rocblas_internal_cpu_family_blas_ex);
+
+        // Operands repacked by rocblas_gemm_pack carry the library-preferred
+        // layout; fold that convention back into an ordinary trans/ld
+        // descriptor here so tuning lookup, validation and logging all see
+        // the orientation that actually runs
+        if(flags & rocblas_gemm_flags_packed_a)
+        {
+            trans_a = rocblas_gemm_packed_operation_a(trans_a);
+            lda     = k ? k : 1;
+        }
+        if(flags & rocblas_gemm_flags_packed_b)
+        {
+            trans_b = rocblas_gemm_packed_operation_b(trans_b);
+            ldb     = k ? k : 1;
+        }
+
+        // Out-of-band tuning: when the caller has not selected a solution, a
+        // shape match from ROCBLAS_TUNING_FILE supplies the solution index
+        // (and extra flags) recorded offline with the gemm_tune client
+        if(handle->tuning_table && algo == rocblas_gemm_algo_standard && solution_index == 0
+           && !(flags & rocblas_gemm_flags_split_f16))
+        {
+            if(auto* entry
+               = handle->tuning_table->find(trans_a, trans_b, m, n, k, a_type, compute_type))
+            {
+                algo           = rocblas_gemm_algo_solution_index;
+                solution_index = entry->solution_index;
+                flags |= entry->flags;
+            }
+        }
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
-        if(!HPA)
+        // the split-refine path sizes its own workspace below
+        if(!HPA && !(flags & rocblas_gemm_flags_split_f16))
             RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         // Copy alpha and beta to host if on device
@@ -252,6 +291,78 @@ namespace
             }
         }
 
+        // Split-and-correct f32 gemm (rocblas_gemm_flags_split_f16): three
+        // HPA f16 passes over f16 high/low splits of A and B, accumulated in
+        // f32. Validation and logging above already ran on the f32 problem.
+        if(flags & rocblas_gemm_flags_split_f16)
+        {
+            if(a_type != rocblas_datatype_f32_r || b_type != rocblas_datatype_f32_r
+               || c_type != rocblas_datatype_f32_r || d_type != rocblas_datatype_f32_r
+               || compute_type != rocblas_datatype_f32_r)
+                return rocblas_status_not_implemented;
+
+            if constexpr(std::is_same_v<API_INT, rocblas_int>)
+                return rocblas_internal_gemm_split_f16(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       a,
+                                                       lda,
+                                                       b,
+                                                       ldb,
+                                                       beta,
+                                                       c,
+                                                       ldc,
+                                                       d,
+                                                       ldd,
+                                                       algo,
+                                                       solution_index,
+                                                       flags);
+            else
+                return rocblas_status_not_implemented;
+        }
+
+        // Auto-batching (BLAS BETA, rocblas_set_gemm_auto_batch): try to fold
+        // this call into one grouped dispatch with concurrent same-shape
+        // calls; alpha and beta are already staged on the host above, so the
+        // group key can compare them by value
+        if constexpr(std::is_same_v<API_INT, rocblas_int>)
+        {
+            if(handle->gemm_auto_batch_window_us > 0 && !handle->get_solution_fitness_query()
+               && !handle->is_device_memory_size_query())
+            {
+                auto coalesced = rocblas_internal_gemm_auto_batch(handle,
+                                                                  trans_a,
+                                                                  trans_b,
+                                                                  m,
+                                                                  n,
+                                                                  k,
+                                                                  alpha,
+                                                                  a,
+                                                                  a_type,
+                                                                  lda,
+                                                                  b,
+                                                                  b_type,
+                                                                  ldb,
+                                                                  beta,
+                                                                  c,
+                                                                  c_type,
+                                                                  ldc,
+                                                                  d,
+                                                                  d_type,
+                                                                  ldd,
+                                                                  compute_type,
+                                                                  algo,
+                                                                  solution_index,
+                                                                  flags);
+                if(coalesced != rocblas_status_continue)
+                    return coalesced;
+            }
+        }
+
         API_INT batch_count = 1;
 
         // TODO: These strides could be 0 ( {} ) instead of 1 ( {1} ) once Tensile is fixed
@@ -165,7 +165,7 @@ rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
     RETURN_IF_ROCBLAS_ERROR(
         rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
 
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_gemm);
     rocblas_status status         = rocblas_status_success;
 
     // check alignment of pointers before casting
@@ -0,0 +1,273 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Descriptor-based gemm_ex entry for launch-rate-bound callers: validation,
+// packed-operand rewriting and tuning-table lookup happen once at descriptor
+// creation, and rocblas_gemm_ex_lite goes straight from the changed pointers
+// to the dispatch. Preconditions the full entry re-checks per call (host
+// alpha/beta, valid device pointers) are declared by the caller instead.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+
+#include "rocblas_gemm_ex.hpp"
+#include "rocblas_gemm_pack.hpp"
+#include "tuning.hpp"
+#include "utility.hpp"
+
+struct _rocblas_gemm_ex_lite_desc
+{
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    rocblas_int       m;
+    rocblas_int       n;
+    rocblas_int       k;
+    rocblas_datatype  a_type;
+    rocblas_int       lda;
+    rocblas_datatype  b_type;
+    rocblas_int       ldb;
+    rocblas_datatype  c_type;
+    rocblas_int       ldc;
+    rocblas_datatype  d_type;
+    rocblas_int       ldd;
+    rocblas_datatype  compute_type;
+    rocblas_gemm_algo algo;
+    int32_t           solution_index;
+    uint32_t          flags;
+    bool              quick_return; // m == 0 or n == 0, nothing to do per call
+    bool              hpa; // dispatch sizes its own workspace, skip the zero-size query
+};
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemm_ex_lite_create(rocblas_handle             handle,
+                                           rocblas_operation          trans_a,
+                                           rocblas_operation          trans_b,
+                                           rocblas_int                m,
+                                           rocblas_int                n,
+                                           rocblas_int                k,
+                                           rocblas_datatype           a_type,
+                                           rocblas_int                lda,
+                                           rocblas_datatype           b_type,
+                                           rocblas_int                ldb,
+                                           rocblas_datatype           c_type,
+                                           rocblas_int                ldc,
+                                           rocblas_datatype           d_type,
+                                           rocblas_int                ldd,
+                                           rocblas_datatype           compute_type,
+                                           int32_t                    solution_index,
+                                           uint32_t                   flags,
+                                           rocblas_gemm_ex_lite_desc* desc)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!desc)
+        return rocblas_status_invalid_pointer;
+
+    *desc = nullptr;
+
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_gemm_ex_lite_create",
+                  trans_a,
+                  trans_b,
+                  m,
+                  n,
+                  k,
+                  rocblas_datatype_string(a_type),
+                  lda,
+                  rocblas_datatype_string(b_type),
+                  ldb,
+                  rocblas_datatype_string(c_type),
+                  ldc,
+                  rocblas_datatype_string(d_type),
+                  ldd,
+                  rocblas_datatype_string(compute_type),
+                  solution_index,
+                  flags);
+
+    // same orientation rewrite the full entry applies for packed operands
+    if(flags & rocblas_gemm_flags_packed_a)
+    {
+        trans_a = rocblas_gemm_packed_operation_a(trans_a);
+        lda     = k ? k : 1;
+    }
+    if(flags & rocblas_gemm_flags_packed_b)
+    {
+        trans_b = rocblas_gemm_packed_operation_b(trans_b);
+        ldb     = k ? k : 1;
+    }
+
+    if(trans_a != rocblas_operation_none && trans_a != rocblas_operation_transpose
+       && trans_a != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+       && trans_b != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    if(m < 0 || n < 0 || k < 0)
+        return rocblas_status_invalid_size;
+
+    if(ldc < m || ldd < m || lda < (trans_a == rocblas_operation_none ? m : k)
+       || ldb < (trans_b == rocblas_operation_none ? k : n))
+        return rocblas_status_invalid_size;
+
+    rocblas_gemm_algo algo
+        = solution_index ? rocblas_gemm_algo_solution_index : rocblas_gemm_algo_standard;
+
+    // resolve the out-of-band tuning match once instead of per call
+    if(handle->tuning_table && algo == rocblas_gemm_algo_standard)
+    {
+        if(auto* entry
+           = handle->tuning_table->find(trans_a, trans_b, m, n, k, a_type, compute_type))
+        {
+            algo           = rocblas_gemm_algo_solution_index;
+            solution_index = entry->solution_index;
+            flags |= entry->flags;
+        }
+    }
+
+    auto* d = new _rocblas_gemm_ex_lite_desc;
+
+    d->trans_a        = trans_a;
+    d->trans_b        = trans_b;
+    d->m              = m;
+    d->n              = n;
+    d->k              = k;
+    d->a_type         = a_type;
+    d->lda            = lda;
+    d->b_type         = b_type;
+    d->ldb            = ldb;
+    d->c_type         = c_type;
+    d->ldc            = ldc;
+    d->d_type         = d_type;
+    d->ldd            = ldd;
+    d->compute_type   = compute_type;
+    d->algo           = algo;
+    d->solution_index = solution_index;
+    d->flags          = flags;
+    d->quick_return   = !m || !n;
+    d->hpa            = compute_type == rocblas_datatype_f32_r
+             && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+
+    *desc = d;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_ex_lite(rocblas_handle            handle,
+                                    rocblas_gemm_ex_lite_desc desc,
+                                    const void*               alpha,
+                                    const void*               a,
+                                    const void*               b,
+                                    const void*               beta,
+                                    const void*               c,
+                                    void*                     d)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!desc)
+        return rocblas_status_invalid_pointer;
+
+    if(!desc->hpa)
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if(desc->quick_return)
+    {
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        return rocblas_status_success;
+    }
+
+    // precondition declared at creation: alpha and beta are host pointers
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // TODO: These strides could be 0 ( {} ) instead of 1 ( {1} ) once Tensile is fixed
+    rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
+
+    return rocblas_gemm_ex_template<false>(handle,
+                                           desc->trans_a,
+                                           desc->trans_b,
+                                           desc->m,
+                                           desc->n,
+                                           desc->k,
+                                           alpha,
+                                           a,
+                                           desc->a_type,
+                                           0,
+                                           desc->lda,
+                                           stride_a,
+                                           b,
+                                           desc->b_type,
+                                           0,
+                                           desc->ldb,
+                                           stride_b,
+                                           beta,
+                                           c,
+                                           desc->c_type,
+                                           0,
+                                           desc->ldc,
+                                           stride_c,
+                                           d,
+                                           desc->d_type,
+                                           0,
+                                           desc->ldd,
+                                           stride_d,
+                                           1,
+                                           desc->compute_type,
+                                           desc->algo,
+                                           desc->solution_index,
+                                           desc->flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_ex_lite_destroy(rocblas_gemm_ex_lite_desc desc)
+try
+{
+    if(!desc)
+        return rocblas_status_invalid_pointer;
+
+    delete desc;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
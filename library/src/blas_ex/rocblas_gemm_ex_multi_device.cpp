@@ -0,0 +1,445 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+#include <vector>
+
+namespace
+{
+    // Number of D columns computed per pipeline stage on each device. While one
+    // stage's gemm runs on the handle's stream, the next stage's B/C columns are
+    // uploaded on the copy-in stream and the previous stage's D columns are
+    // fetched on the copy-out stream.
+    constexpr rocblas_int c_multi_device_chunk_n = 2048;
+
+    // Per-device state for one column-panel slice of the problem
+    struct rocblas_multi_device_slice
+    {
+        rocblas_handle handle     = nullptr;
+        rocblas_int    n_offset   = 0;
+        rocblas_int    n_cols     = 0;
+        void*          dev_a      = nullptr;
+        void*          dev_b      = nullptr;
+        void*          dev_c      = nullptr;
+        void*          dev_d      = nullptr;
+        hipStream_t    h2d_stream = nullptr;
+        hipStream_t    d2h_stream = nullptr;
+
+        std::vector<hipEvent_t> events;
+
+        hipEvent_t make_event()
+        {
+            hipEvent_t event;
+            THROW_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+            events.push_back(event);
+            return event;
+        }
+    };
+
+    // Uploads this device's share of the inputs, runs the chunked gemms, and
+    // fetches the results, all asynchronously; the caller synchronizes later.
+    // Must be called with the slice's device current.
+    rocblas_status rocblas_gemm_ex_multi_device_enqueue(rocblas_multi_device_slice& slice,
+                                                        rocblas_operation           trans_a,
+                                                        rocblas_operation           trans_b,
+                                                        rocblas_int                 m,
+                                                        rocblas_int                 k,
+                                                        const void*                 alpha,
+                                                        const void*                 a,
+                                                        rocblas_datatype            a_type,
+                                                        rocblas_int                 lda,
+                                                        const void*                 b,
+                                                        rocblas_datatype            b_type,
+                                                        rocblas_int                 ldb,
+                                                        const void*                 beta,
+                                                        const void*                 c,
+                                                        rocblas_datatype            c_type,
+                                                        rocblas_int                 ldc,
+                                                        void*                       d,
+                                                        rocblas_datatype            d_type,
+                                                        rocblas_int                 ldd,
+                                                        rocblas_datatype            compute_type,
+                                                        rocblas_gemm_algo           algo,
+                                                        int32_t                     solution_index,
+                                                        uint32_t                    flags)
+    {
+        const size_t a_elem = rocblas_sizeof_datatype(a_type);
+        const size_t b_elem = rocblas_sizeof_datatype(b_type);
+        const size_t c_elem = rocblas_sizeof_datatype(c_type);
+        const size_t d_elem = rocblas_sizeof_datatype(d_type);
+
+        const rocblas_int nn = slice.n_cols;
+        const rocblas_int j0 = slice.n_offset;
+
+        // A is shared by every column panel; its used portion is copied whole
+        const rocblas_int a_rows = trans_a == rocblas_operation_none ? m : k;
+        const rocblas_int a_cols = trans_a == rocblas_operation_none ? k : m;
+
+        // B panel: k x nn columns of B, or an nn x k row slice of op-ed B
+        const bool        b_by_cols = trans_b == rocblas_operation_none;
+        const rocblas_int b_rows    = b_by_cols ? k : nn;
+        const rocblas_int b_cols    = b_by_cols ? nn : k;
+        const char* b_host = static_cast<const char*>(b) + (b_by_cols ? j0 * size_t(ldb) : j0) * b_elem;
+
+        RETURN_IF_HIP_ERROR(hipMalloc(&slice.dev_a, size_t(a_rows) * a_cols * a_elem));
+        RETURN_IF_HIP_ERROR(hipMalloc(&slice.dev_b, size_t(b_rows) * b_cols * b_elem));
+        RETURN_IF_HIP_ERROR(hipMalloc(&slice.dev_c, size_t(m) * nn * c_elem));
+        RETURN_IF_HIP_ERROR(hipMalloc(&slice.dev_d, size_t(m) * nn * d_elem));
+        RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&slice.h2d_stream, hipStreamNonBlocking));
+        RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&slice.d2h_stream, hipStreamNonBlocking));
+
+        hipStream_t gemm_stream = slice.handle->get_stream();
+
+        if(a_rows && a_cols)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(slice.dev_a,
+                                                 a_rows * a_elem,
+                                                 a,
+                                                 size_t(lda) * a_elem,
+                                                 a_rows * a_elem,
+                                                 a_cols,
+                                                 hipMemcpyHostToDevice,
+                                                 slice.h2d_stream));
+            hipEvent_t a_uploaded = slice.make_event();
+            RETURN_IF_HIP_ERROR(hipEventRecord(a_uploaded, slice.h2d_stream));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(gemm_stream, a_uploaded, 0));
+        }
+
+        for(rocblas_int c0 = 0; c0 < nn; c0 += c_multi_device_chunk_n)
+        {
+            const rocblas_int cn = std::min(c_multi_device_chunk_n, nn - c0);
+
+            // device-side addresses of this chunk within the panel buffers
+            char*             b_chunk    = static_cast<char*>(slice.dev_b)
+                            + (b_by_cols ? c0 * size_t(k) : c0) * b_elem;
+            const rocblas_int b_chunk_ld = b_by_cols ? k : nn;
+            char*             c_chunk    = static_cast<char*>(slice.dev_c) + c0 * size_t(m) * c_elem;
+            char*             d_chunk    = static_cast<char*>(slice.dev_d) + c0 * size_t(m) * d_elem;
+
+            if(k)
+            {
+                // B chunk: cn columns when untransposed, cn rows otherwise
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(
+                    b_chunk,
+                    b_chunk_ld * b_elem,
+                    b_host + (b_by_cols ? c0 * size_t(ldb) : c0) * b_elem,
+                    size_t(ldb) * b_elem,
+                    (b_by_cols ? k : cn) * b_elem,
+                    b_by_cols ? cn : k,
+                    hipMemcpyHostToDevice,
+                    slice.h2d_stream));
+            }
+
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy2DAsync(c_chunk,
+                                 m * c_elem,
+                                 static_cast<const char*>(c) + (j0 + c0) * size_t(ldc) * c_elem,
+                                 size_t(ldc) * c_elem,
+                                 m * c_elem,
+                                 cn,
+                                 hipMemcpyHostToDevice,
+                                 slice.h2d_stream));
+
+            hipEvent_t chunk_uploaded = slice.make_event();
+            RETURN_IF_HIP_ERROR(hipEventRecord(chunk_uploaded, slice.h2d_stream));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(gemm_stream, chunk_uploaded, 0));
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_ex(slice.handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    cn,
+                                                    k,
+                                                    alpha,
+                                                    slice.dev_a,
+                                                    a_type,
+                                                    a_rows,
+                                                    b_chunk,
+                                                    b_type,
+                                                    b_chunk_ld,
+                                                    beta,
+                                                    c_chunk,
+                                                    c_type,
+                                                    m,
+                                                    d_chunk,
+                                                    d_type,
+                                                    m,
+                                                    compute_type,
+                                                    algo,
+                                                    solution_index,
+                                                    flags));
+
+            hipEvent_t chunk_computed = slice.make_event();
+            RETURN_IF_HIP_ERROR(hipEventRecord(chunk_computed, gemm_stream));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(slice.d2h_stream, chunk_computed, 0));
+
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy2DAsync(static_cast<char*>(d) + (j0 + c0) * size_t(ldd) * d_elem,
+                                 size_t(ldd) * d_elem,
+                                 d_chunk,
+                                 m * d_elem,
+                                 m * d_elem,
+                                 cn,
+                                 hipMemcpyDeviceToHost,
+                                 slice.d2h_stream));
+        }
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_ex_multi_device_impl(rocblas_handle*   handles,
+                                                     rocblas_int       handle_count,
+                                                     rocblas_operation trans_a,
+                                                     rocblas_operation trans_b,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       k,
+                                                     const void*       alpha,
+                                                     const void*       a,
+                                                     rocblas_datatype  a_type,
+                                                     rocblas_int       lda,
+                                                     const void*       b,
+                                                     rocblas_datatype  b_type,
+                                                     rocblas_int       ldb,
+                                                     const void*       beta,
+                                                     const void*       c,
+                                                     rocblas_datatype  c_type,
+                                                     rocblas_int       ldc,
+                                                     void*             d,
+                                                     rocblas_datatype  d_type,
+                                                     rocblas_int       ldd,
+                                                     rocblas_datatype  compute_type,
+                                                     rocblas_gemm_algo algo,
+                                                     int32_t           solution_index,
+                                                     uint32_t          flags)
+    {
+        if(!handles || handle_count < 1)
+            return rocblas_status_invalid_handle;
+        for(rocblas_int i = 0; i < handle_count; i++)
+            if(!handles[i])
+                return rocblas_status_invalid_handle;
+
+        // Workspace comes from hipMalloc on each device; the per-device gemms
+        // size their own workspace against their own handles
+        if(handles[0]->is_device_memory_size_query())
+            return rocblas_status_size_unchanged;
+
+        auto layer_mode = handles[0]->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handles[0],
+                      "rocblas_gemm_ex_multi_device",
+                      handle_count,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      rocblas_datatype_string(a_type),
+                      lda,
+                      rocblas_datatype_string(b_type),
+                      ldb,
+                      rocblas_datatype_string(c_type),
+                      ldc,
+                      rocblas_datatype_string(d_type),
+                      ldd,
+                      rocblas_datatype_string(compute_type),
+                      algo,
+                      solution_index,
+                      rocblas_gemm_flags(flags));
+
+        if(m < 0 || n < 0 || k < 0)
+            return rocblas_status_invalid_size;
+        if(!m || !n)
+            return rocblas_status_success;
+
+        // All pointers are host-side; alpha and beta are always read on the host
+        if(!alpha || !beta || !c || !d || (k && (!a || !b)))
+            return rocblas_status_invalid_pointer;
+
+        const rocblas_int a_rows = trans_a == rocblas_operation_none ? m : k;
+        const rocblas_int b_rows = trans_b == rocblas_operation_none ? k : n;
+        if(lda < std::max(1, a_rows) || ldb < std::max(1, b_rows) || ldc < m || ldd < m)
+            return rocblas_status_invalid_size;
+
+        if(!rocblas_sizeof_datatype(a_type) || !rocblas_sizeof_datatype(b_type)
+           || !rocblas_sizeof_datatype(c_type) || !rocblas_sizeof_datatype(d_type))
+            return rocblas_status_not_implemented;
+
+        std::vector<rocblas_multi_device_slice> slices(handle_count);
+
+        // Split D by column panels, spreading the remainder over the leaders
+        rocblas_int n_base = n / handle_count;
+        rocblas_int n_rem  = n % handle_count;
+        rocblas_int offset = 0;
+        for(rocblas_int i = 0; i < handle_count; i++)
+        {
+            slices[i].handle   = handles[i];
+            slices[i].n_offset = offset;
+            slices[i].n_cols   = n_base + (i < n_rem ? 1 : 0);
+            offset += slices[i].n_cols;
+        }
+
+        // Enqueue every slice before synchronizing any, so the devices upload
+        // and compute concurrently
+        rocblas_status status = rocblas_status_success;
+        for(rocblas_int i = 0; i < handle_count && status == rocblas_status_success; i++)
+        {
+            if(!slices[i].n_cols)
+                continue;
+
+            auto saved_device_id    = handles[i]->push_device_id();
+            auto saved_pointer_mode = handles[i]->push_pointer_mode(rocblas_pointer_mode_host);
+
+            // Convert any exception to a status here so that the release loop
+            // below still runs for the slices already enqueued
+            try
+            {
+                status = rocblas_gemm_ex_multi_device_enqueue(slices[i],
+                                                              trans_a,
+                                                              trans_b,
+                                                              m,
+                                                              k,
+                                                              alpha,
+                                                              a,
+                                                              a_type,
+                                                              lda,
+                                                              b,
+                                                              b_type,
+                                                              ldb,
+                                                              beta,
+                                                              c,
+                                                              c_type,
+                                                              ldc,
+                                                              d,
+                                                              d_type,
+                                                              ldd,
+                                                              compute_type,
+                                                              algo,
+                                                              solution_index,
+                                                              flags);
+            }
+            catch(...)
+            {
+                status = exception_to_rocblas_status();
+            }
+        }
+
+        // Synchronize and release every slice, even after a failure, so that no
+        // device is left with streams still referencing the freed buffers
+        for(rocblas_int i = 0; i < handle_count; i++)
+        {
+            auto& slice = slices[i];
+            if(!slice.handle || !slice.n_cols)
+                continue;
+
+            auto saved_device_id = slice.handle->push_device_id();
+
+            if(status == rocblas_status_success && slice.d2h_stream)
+            {
+                hipError_t sync_error = hipStreamSynchronize(slice.d2h_stream);
+                if(sync_error != hipSuccess)
+                    status = rocblas_internal_convert_hip_to_rocblas_status(sync_error);
+            }
+            PRINT_IF_HIP_ERROR(hipStreamSynchronize(slice.handle->get_stream()));
+
+            for(hipEvent_t event : slice.events)
+                PRINT_IF_HIP_ERROR(hipEventDestroy(event));
+            if(slice.h2d_stream)
+                PRINT_IF_HIP_ERROR(hipStreamDestroy(slice.h2d_stream));
+            if(slice.d2h_stream)
+                PRINT_IF_HIP_ERROR(hipStreamDestroy(slice.d2h_stream));
+            if(slice.dev_a)
+                PRINT_IF_HIP_ERROR(hipFree(slice.dev_a));
+            if(slice.dev_b)
+                PRINT_IF_HIP_ERROR(hipFree(slice.dev_b));
+            if(slice.dev_c)
+                PRINT_IF_HIP_ERROR(hipFree(slice.dev_c));
+            if(slice.dev_d)
+                PRINT_IF_HIP_ERROR(hipFree(slice.dev_d));
+        }
+
+        return status;
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_gemm_ex_multi_device(rocblas_handle*   handles,
+                                                       rocblas_int       handle_count,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       rocblas_int       k,
+                                                       const void*       alpha,
+                                                       const void*       a,
+                                                       rocblas_datatype  a_type,
+                                                       rocblas_int       lda,
+                                                       const void*       b,
+                                                       rocblas_datatype  b_type,
+                                                       rocblas_int       ldb,
+                                                       const void*       beta,
+                                                       const void*       c,
+                                                       rocblas_datatype  c_type,
+                                                       rocblas_int       ldc,
+                                                       void*             d,
+                                                       rocblas_datatype  d_type,
+                                                       rocblas_int       ldd,
+                                                       rocblas_datatype  compute_type,
+                                                       rocblas_gemm_algo algo,
+                                                       int32_t           solution_index,
+                                                       uint32_t          flags)
+try
+{
+    return rocblas_gemm_ex_multi_device_impl(handles,
+                                             handle_count,
+                                             trans_a,
+                                             trans_b,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             a,
+                                             a_type,
+                                             lda,
+                                             b,
+                                             b_type,
+                                             ldb,
+                                             beta,
+                                             c,
+                                             c_type,
+                                             ldc,
+                                             d,
+                                             d_type,
+                                             ldd,
+                                             compute_type,
+                                             algo,
+                                             solution_index,
+                                             flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
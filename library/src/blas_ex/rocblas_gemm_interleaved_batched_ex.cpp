@@ -0,0 +1,506 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    // In the interleaved layout the batch index is innermost: element (r, c)
+    // of batch instance i lives at M[(c * ld + r) * batch_count + i], so
+    // adjacent threads working on adjacent batch instances access adjacent
+    // memory locations.
+
+    // Layout conversion: one thread per element instance, with the batch
+    // index varying fastest across threads so the interleaved side of the
+    // copy is always coalesced.
+    template <int NB, bool INTERLEAVE, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemm_interleave_kernel(rocblas_int    rows,
+                                   rocblas_int    cols,
+                                   T*             strided_mat,
+                                   rocblas_int    ld_s,
+                                   rocblas_stride stride_s,
+                                   T*             interleaved_mat,
+                                   rocblas_int    ld_i,
+                                   rocblas_int    batch_count)
+    {
+        int64_t total = int64_t(rows) * cols * batch_count;
+        for(int64_t j = int64_t(blockIdx.x) * NB + threadIdx.x; j < total;
+            j += int64_t(gridDim.x) * NB)
+        {
+            int64_t i  = j % batch_count;
+            int64_t rc = j / batch_count;
+            int64_t r  = rc % rows;
+            int64_t c  = rc / rows;
+
+            int64_t strided     = i * stride_s + c * ld_s + r;
+            int64_t interleaved = (c * int64_t(ld_i) + r) * batch_count + i;
+
+            if(INTERLEAVE)
+                interleaved_mat[interleaved] = strided_mat[strided];
+            else
+                strided_mat[strided] = interleaved_mat[interleaved];
+        }
+    }
+
+    template <bool INTERLEAVE>
+    rocblas_status rocblas_gemm_interleave_launcher(rocblas_handle   handle,
+                                                    rocblas_datatype type,
+                                                    rocblas_int      rows,
+                                                    rocblas_int      cols,
+                                                    void*            strided_mat,
+                                                    rocblas_int      ld_s,
+                                                    rocblas_stride   stride_s,
+                                                    void*            interleaved_mat,
+                                                    rocblas_int      ld_i,
+                                                    rocblas_int      batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(rows < 0 || cols < 0 || batch_count < 0 || ld_s < rows || ld_i < rows)
+            return rocblas_status_invalid_size;
+
+        if(!rows || !cols || !batch_count)
+            return rocblas_status_success;
+
+        if(!strided_mat || !interleaved_mat)
+            return rocblas_status_invalid_pointer;
+
+        static constexpr int NB         = 256;
+        static constexpr int max_blocks = 65536;
+
+        int64_t total  = int64_t(rows) * cols * batch_count;
+        dim3    grid(int(std::min((total - 1) / NB + 1, int64_t(max_blocks))));
+        dim3    threads(NB);
+
+        hipStream_t stream = handle->get_stream();
+
+        // The copy only moves bits, so one kernel per element size serves all
+        // datatypes of that size
+#define INTERLEAVE_PARM \
+    rows, cols, (T*)strided_mat, ld_s, stride_s, (T*)interleaved_mat, ld_i, batch_count
+
+        switch(rocblas_sizeof_datatype(type))
+        {
+        case 1:
+        {
+            using T = uint8_t;
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleave_kernel<NB, INTERLEAVE, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVE_PARM);
+            break;
+        }
+        case 2:
+        {
+            using T = uint16_t;
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleave_kernel<NB, INTERLEAVE, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVE_PARM);
+            break;
+        }
+        case 4:
+        {
+            using T = uint32_t;
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleave_kernel<NB, INTERLEAVE, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVE_PARM);
+            break;
+        }
+        case 8:
+        {
+            using T = uint64_t;
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleave_kernel<NB, INTERLEAVE, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVE_PARM);
+            break;
+        }
+        case 16:
+        {
+            using T = rocblas_double_complex;
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleave_kernel<NB, INTERLEAVE, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVE_PARM);
+            break;
+        }
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+#undef INTERLEAVE_PARM
+
+        return rocblas_status_success;
+    }
+
+    // Largest matrix dimension served by the interleaved gemm kernel; it
+    // bounds the per-thread accumulator array
+    constexpr rocblas_int c_gemm_interleaved_max_dim = 16;
+
+    // One thread per (batch instance, output column): the thread accumulates
+    // a full column of D in registers, and adjacent threads work on adjacent
+    // batch instances, so every global access is coalesced. The accumulator
+    // loops run over the compile-time bound with a runtime guard so the
+    // array stays in registers.
+    template <int NB, typename Ti, typename Tex, typename To, typename U>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemm_interleaved_batched_kernel(rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            U                 alpha_device_host,
+                                            const Ti*         A,
+                                            rocblas_int       lda,
+                                            const Ti*         B,
+                                            rocblas_int       ldb,
+                                            U                 beta_device_host,
+                                            const To*         C,
+                                            rocblas_int       ldc,
+                                            To*               D,
+                                            rocblas_int       ldd,
+                                            rocblas_int       batch_count)
+    {
+        constexpr rocblas_int MAX = c_gemm_interleaved_max_dim;
+
+        int64_t i = int64_t(blockIdx.x) * NB + threadIdx.x; // batch instance
+        if(i >= batch_count)
+            return;
+
+        rocblas_int c = blockIdx.y; // output column
+
+        Tex alpha = load_scalar(alpha_device_host);
+        Tex beta  = load_scalar(beta_device_host);
+
+        Tex acc[MAX];
+        for(rocblas_int r = 0; r < MAX; ++r)
+            acc[r] = Tex(0);
+
+        if(alpha != Tex(0))
+        {
+            bool nta = trans_a == rocblas_operation_none;
+            bool ntb = trans_b == rocblas_operation_none;
+            for(rocblas_int l = 0; l < k; ++l)
+            {
+                int64_t idx_b = ntb ? int64_t(c) * ldb + l : int64_t(l) * ldb + c;
+                Tex     b_val = Tex(B[idx_b * batch_count + i]);
+                for(rocblas_int r = 0; r < MAX; ++r)
+                    if(r < m)
+                    {
+                        int64_t idx_a = nta ? int64_t(l) * lda + r : int64_t(r) * lda + l;
+                        acc[r] += Tex(A[idx_a * batch_count + i]) * b_val;
+                    }
+            }
+        }
+
+        for(rocblas_int r = 0; r < MAX; ++r)
+            if(r < m)
+            {
+                Tex v = alpha * acc[r];
+                if(beta != Tex(0))
+                    v += beta * Tex(C[(int64_t(c) * ldc + r) * batch_count + i]);
+                D[(int64_t(c) * ldd + r) * batch_count + i] = To(v);
+            }
+    }
+
+    template <typename Ti, typename Tex, typename To>
+    rocblas_status rocblas_gemm_interleaved_batched_launcher(rocblas_handle    handle,
+                                                             rocblas_operation trans_a,
+                                                             rocblas_operation trans_b,
+                                                             rocblas_int       m,
+                                                             rocblas_int       n,
+                                                             rocblas_int       k,
+                                                             const void*       alpha,
+                                                             const void*       a,
+                                                             rocblas_int       lda,
+                                                             const void*       b,
+                                                             rocblas_int       ldb,
+                                                             const void*       beta,
+                                                             const void*       c,
+                                                             rocblas_int       ldc,
+                                                             void*             d,
+                                                             rocblas_int       ldd,
+                                                             rocblas_int       batch_count)
+    {
+        static constexpr int NB = 256;
+
+        dim3 grid((batch_count - 1) / NB + 1, n);
+        dim3 threads(NB);
+
+        hipStream_t stream = handle->get_stream();
+
+#define INTERLEAVED_GEMM_PARM(alpha_, beta_)                                                 \
+    trans_a, trans_b, m, n, k, alpha_, (const Ti*)a, lda, (const Ti*)b, ldb, beta_, \
+        (const To*)c, ldc, (To*)d, ldd, batch_count
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleaved_batched_kernel<NB, Ti, Tex, To>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVED_GEMM_PARM((const Tex*)alpha, (const Tex*)beta));
+        }
+        else
+        {
+            if(!*(const Tex*)alpha && *(const Tex*)beta == Tex(1))
+                return rocblas_status_success;
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_interleaved_batched_kernel<NB, Ti, Tex, To>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  INTERLEAVED_GEMM_PARM(*(const Tex*)alpha, *(const Tex*)beta));
+        }
+
+#undef INTERLEAVED_GEMM_PARM
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_interleaved_batched_ex_impl(rocblas_handle    handle,
+                                                            rocblas_operation trans_a,
+                                                            rocblas_operation trans_b,
+                                                            rocblas_int       m,
+                                                            rocblas_int       n,
+                                                            rocblas_int       k,
+                                                            const void*       alpha,
+                                                            const void*       a,
+                                                            rocblas_datatype  a_type,
+                                                            rocblas_int       lda,
+                                                            const void*       b,
+                                                            rocblas_datatype  b_type,
+                                                            rocblas_int       ldb,
+                                                            const void*       beta,
+                                                            const void*       c,
+                                                            rocblas_datatype  c_type,
+                                                            rocblas_int       ldc,
+                                                            void*             d,
+                                                            rocblas_datatype  d_type,
+                                                            rocblas_int       ldd,
+                                                            rocblas_datatype  compute_type,
+                                                            rocblas_int       batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_gemm_interleaved_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      rocblas_datatype_string(a_type),
+                      lda,
+                      rocblas_datatype_string(b_type),
+                      ldb,
+                      rocblas_datatype_string(c_type),
+                      ldc,
+                      rocblas_datatype_string(d_type),
+                      ldd,
+                      rocblas_datatype_string(compute_type),
+                      batch_count);
+
+        if(trans_a != rocblas_operation_none && trans_a != rocblas_operation_transpose
+           && trans_a != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+           && trans_b != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        rocblas_int num_rows_a = trans_a == rocblas_operation_none ? m : k;
+        rocblas_int num_rows_b = trans_b == rocblas_operation_none ? k : n;
+
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < num_rows_a || ldb < num_rows_b
+           || ldc < m || ldd < m)
+            return rocblas_status_invalid_size;
+
+        // This path is specialized for very small matrices; the per-thread
+        // accumulator bound is a hard limit
+        if(m > c_gemm_interleaved_max_dim || n > c_gemm_interleaved_max_dim
+           || k > c_gemm_interleaved_max_dim)
+            return rocblas_status_not_implemented;
+
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta || !c || !d || (k && (!a || !b)))
+            return rocblas_status_invalid_pointer;
+
+        if(b_type != a_type || d_type != c_type)
+            return rocblas_status_not_implemented;
+
+#define INTERLEAVED_EX_PARM                                                                  \
+    handle, trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, d, ldd, \
+        batch_count
+
+        if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r
+           && compute_type == rocblas_datatype_f16_r)
+            return rocblas_gemm_interleaved_batched_launcher<rocblas_half,
+                                                             rocblas_half,
+                                                             rocblas_half>(INTERLEAVED_EX_PARM);
+        else if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r
+                && compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemm_interleaved_batched_launcher<rocblas_half, float, rocblas_half>(
+                INTERLEAVED_EX_PARM);
+        else if(a_type == rocblas_datatype_bf16_r && c_type == rocblas_datatype_bf16_r
+                && compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemm_interleaved_batched_launcher<rocblas_bfloat16,
+                                                             float,
+                                                             rocblas_bfloat16>(
+                INTERLEAVED_EX_PARM);
+        else if(a_type == rocblas_datatype_f32_r && c_type == rocblas_datatype_f32_r
+                && compute_type == rocblas_datatype_f32_r)
+            return rocblas_gemm_interleaved_batched_launcher<float, float, float>(
+                INTERLEAVED_EX_PARM);
+        else if(a_type == rocblas_datatype_f64_r && c_type == rocblas_datatype_f64_r
+                && compute_type == rocblas_datatype_f64_r)
+            return rocblas_gemm_interleaved_batched_launcher<double, double, double>(
+                INTERLEAVED_EX_PARM);
+
+#undef INTERLEAVED_EX_PARM
+
+        return rocblas_status_not_implemented;
+    }
+}
+// namespace
+
+extern "C" {
+
+rocblas_status rocblas_gemm_interleave_batched_matrix(rocblas_handle   handle,
+                                                      rocblas_datatype type,
+                                                      rocblas_int      rows,
+                                                      rocblas_int      cols,
+                                                      const void*      src,
+                                                      rocblas_int      ld,
+                                                      rocblas_stride   stride,
+                                                      void*            dst,
+                                                      rocblas_int      ld_i,
+                                                      rocblas_int      batch_count)
+try
+{
+    return rocblas_gemm_interleave_launcher<true>(
+        handle, type, rows, cols, (void*)src, ld, stride, dst, ld_i, batch_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_deinterleave_batched_matrix(rocblas_handle   handle,
+                                                        rocblas_datatype type,
+                                                        rocblas_int      rows,
+                                                        rocblas_int      cols,
+                                                        const void*      src,
+                                                        rocblas_int      ld_i,
+                                                        void*            dst,
+                                                        rocblas_int      ld,
+                                                        rocblas_stride   stride,
+                                                        rocblas_int      batch_count)
+try
+{
+    return rocblas_gemm_interleave_launcher<false>(
+        handle, type, rows, cols, dst, ld, stride, (void*)src, ld_i, batch_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_interleaved_batched_ex(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   const void*       alpha,
+                                                   const void*       a,
+                                                   rocblas_datatype  a_type,
+                                                   rocblas_int       lda,
+                                                   const void*       b,
+                                                   rocblas_datatype  b_type,
+                                                   rocblas_int       ldb,
+                                                   const void*       beta,
+                                                   const void*       c,
+                                                   rocblas_datatype  c_type,
+                                                   rocblas_int       ldc,
+                                                   void*             d,
+                                                   rocblas_datatype  d_type,
+                                                   rocblas_int       ldd,
+                                                   rocblas_datatype  compute_type,
+                                                   rocblas_int       batch_count)
+try
+{
+    return rocblas_gemm_interleaved_batched_ex_impl(handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    a,
+                                                    a_type,
+                                                    lda,
+                                                    b,
+                                                    b_type,
+                                                    ldb,
+                                                    beta,
+                                                    c,
+                                                    c_type,
+                                                    ldc,
+                                                    d,
+                                                    d_type,
+                                                    ldd,
+                                                    compute_type,
+                                                    batch_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,301 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// One-time repacking of a reused gemm operand into the library-preferred
+// layout (see rocblas_gemm_pack.hpp for the convention). Callers that run
+// many gemm_ex calls against the same A or B pay the layout conversion
+// once here and pass the packed buffer with a rocblas_gemm_flags_packed_*
+// flag afterwards, the way CPU BLAS pack APIs amortize weight reuse.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_pack.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // Tiled out-of-place transpose: src is rows x cols column-major, dst is
+    // cols x rows with tight leading dimension. Reads and writes are both
+    // coalesced through the padded LDS tile.
+    template <int TILE_DIM, bool CONJ, typename T>
+    ROCBLAS_KERNEL(TILE_DIM* TILE_DIM)
+    rocblas_gemm_pack_transpose_kernel(rocblas_int rows,
+                                       rocblas_int cols,
+                                       const T* __restrict__ src,
+                                       rocblas_int lds,
+                                       T* __restrict__ dst)
+    {
+        __shared__ T tile[TILE_DIM][TILE_DIM + 1];
+
+        rocblas_int i = blockIdx.x * TILE_DIM + threadIdx.x;
+        rocblas_int j = blockIdx.y * TILE_DIM + threadIdx.y;
+
+        if(i < rows && j < cols)
+            tile[threadIdx.y][threadIdx.x] = src[i + j * size_t(lds)];
+
+        __syncthreads();
+
+        // swapped block, so threadIdx.x again walks the contiguous dimension
+        rocblas_int di = blockIdx.y * TILE_DIM + threadIdx.x;
+        rocblas_int dj = blockIdx.x * TILE_DIM + threadIdx.y;
+
+        if(di < cols && dj < rows)
+        {
+            T v                        = tile[threadIdx.x][threadIdx.y];
+            dst[di + dj * size_t(cols)] = CONJ ? conj(v) : v;
+        }
+    }
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_gemm_pack_transpose(rocblas_handle handle,
+                                               rocblas_int    rows,
+                                               rocblas_int    cols,
+                                               const void*    src,
+                                               rocblas_int    lds,
+                                               void*          dst)
+    {
+        static constexpr int TILE_DIM = 32;
+
+        dim3 grid((rows - 1) / TILE_DIM + 1, (cols - 1) / TILE_DIM + 1);
+        dim3 threads(TILE_DIM, TILE_DIM);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_pack_transpose_kernel<TILE_DIM, CONJ, T>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              rows,
+                              cols,
+                              (const T*)src,
+                              lds,
+                              (T*)dst);
+
+        return rocblas_status_success;
+    }
+
+    bool rocblas_gemm_pack_type_supported(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_i8_r:
+        case rocblas_datatype_i32_r:
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_f64_c:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    rocblas_status rocblas_gemm_pack_size_impl(rocblas_handle            handle,
+                                               rocblas_gemm_pack_operand operand,
+                                               rocblas_operation         trans,
+                                               rocblas_int               m,
+                                               rocblas_int               n,
+                                               rocblas_int               k,
+                                               rocblas_datatype          type,
+                                               size_t*                   size)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!size)
+            return rocblas_status_invalid_pointer;
+
+        if(m < 0 || n < 0 || k < 0)
+            return rocblas_status_invalid_size;
+
+        if(!rocblas_gemm_pack_type_supported(type))
+            return rocblas_status_not_implemented;
+
+        // packed A is k x m, packed B is k x n, both with leading dimension k
+        bool is_a = operand == rocblas_gemm_pack_operand_a;
+        *size     = rocblas_sizeof_datatype(type) * size_t(k) * (is_a ? m : n);
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_gemm_pack_impl(rocblas_handle            handle,
+                                          rocblas_gemm_pack_operand operand,
+                                          rocblas_operation         trans,
+                                          rocblas_int               m,
+                                          rocblas_int               n,
+                                          rocblas_int               k,
+                                          rocblas_datatype          type,
+                                          const void*               a,
+                                          rocblas_int               lda,
+                                          void*                     packed)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_gemm_pack",
+                      operand == rocblas_gemm_pack_operand_a ? "A" : "B",
+                      trans,
+                      m,
+                      n,
+                      k,
+                      rocblas_datatype_string(type),
+                      a,
+                      lda,
+                      packed);
+
+        if(m < 0 || n < 0 || k < 0)
+            return rocblas_status_invalid_size;
+
+        if(!rocblas_gemm_pack_type_supported(type))
+            return rocblas_status_not_implemented;
+
+        bool is_a = operand == rocblas_gemm_pack_operand_a;
+
+        // dimensions of the operand as the caller stores it
+        bool        no_trans = trans == rocblas_operation_none;
+        rocblas_int rows_s   = no_trans ? (is_a ? m : k) : (is_a ? k : n);
+        rocblas_int cols_s   = no_trans ? (is_a ? k : m) : (is_a ? m : k);
+
+        if(lda < rows_s || lda < 1)
+            return rocblas_status_invalid_size;
+
+        if(!rows_s || !cols_s)
+            return rocblas_status_success;
+
+        if(!a || !packed)
+            return rocblas_status_invalid_pointer;
+
+        // A keeps a transpose-family orientation, so only a plain A needs its
+        // data transposed; B is consumed non-transposed, so transpose-family
+        // B is transposed here with any conjugation applied to the data
+        bool transpose_data = is_a ? no_trans : !no_trans;
+        bool conj_data      = !is_a && trans == rocblas_operation_conjugate_transpose;
+
+        if(!transpose_data)
+        {
+            // already in the packed orientation: tighten the leading dimension
+            size_t elsize = rocblas_sizeof_datatype(type);
+            if(lda == rows_s)
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(packed,
+                                                   a,
+                                                   elsize * rows_s * size_t(cols_s),
+                                                   hipMemcpyDeviceToDevice,
+                                                   handle->get_stream()));
+            else
+                RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(packed,
+                                                     elsize * rows_s,
+                                                     a,
+                                                     elsize * lda,
+                                                     elsize * rows_s,
+                                                     cols_s,
+                                                     hipMemcpyDeviceToDevice,
+                                                     handle->get_stream()));
+            return rocblas_status_success;
+        }
+
+#define PACK_TRANSPOSE(T_) \
+    rocblas_gemm_pack_transpose<false, T_>(handle, rows_s, cols_s, a, lda, packed)
+
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+            return PACK_TRANSPOSE(rocblas_half);
+        case rocblas_datatype_bf16_r:
+            return PACK_TRANSPOSE(rocblas_bfloat16);
+        case rocblas_datatype_f32_r:
+            return PACK_TRANSPOSE(float);
+        case rocblas_datatype_f64_r:
+            return PACK_TRANSPOSE(double);
+        case rocblas_datatype_i8_r:
+            return PACK_TRANSPOSE(int8_t);
+        case rocblas_datatype_i32_r:
+            return PACK_TRANSPOSE(int32_t);
+        case rocblas_datatype_f32_c:
+            return conj_data ? rocblas_gemm_pack_transpose<true, rocblas_float_complex>(
+                       handle, rows_s, cols_s, a, lda, packed)
+                             : PACK_TRANSPOSE(rocblas_float_complex);
+        case rocblas_datatype_f64_c:
+            return conj_data ? rocblas_gemm_pack_transpose<true, rocblas_double_complex>(
+                       handle, rows_s, cols_s, a, lda, packed)
+                             : PACK_TRANSPOSE(rocblas_double_complex);
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+#undef PACK_TRANSPOSE
+    }
+}
+// namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemm_pack_size(rocblas_handle            handle,
+                                      rocblas_gemm_pack_operand operand,
+                                      rocblas_operation         trans,
+                                      rocblas_int               m,
+                                      rocblas_int               n,
+                                      rocblas_int               k,
+                                      rocblas_datatype          type,
+                                      size_t*                   size)
+try
+{
+    return rocblas_gemm_pack_size_impl(handle, operand, trans, m, n, k, type, size);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_gemm_pack(rocblas_handle            handle,
+                                 rocblas_gemm_pack_operand operand,
+                                 rocblas_operation         trans,
+                                 rocblas_int               m,
+                                 rocblas_int               n,
+                                 rocblas_int               k,
+                                 rocblas_datatype          type,
+                                 const void*               a,
+                                 rocblas_int               lda,
+                                 void*                     packed)
+try
+{
+    return rocblas_gemm_pack_impl(handle, operand, trans, m, n, k, type, a, lda, packed);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,46 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+
+// Storage convention for rocblas_gemm_pack buffers. A packed operand is
+// always tight (leading dimension k) and kept in the orientation the gemm
+// pipeline prefers: A with its k dimension contiguous, consumed with a
+// transpose-family operation, and B plain column-major, consumed with no
+// transpose and any conjugation folded into the packed data at pack time.
+// rocblas_gemm_pack produces this layout and rocblas_gemm_ex re-derives it
+// through the same two helpers when a packed flag is set, so the producer
+// and consumer can never disagree on what the opaque buffer holds.
+
+inline rocblas_operation rocblas_gemm_packed_operation_a(rocblas_operation trans)
+{
+    // a plain matrix is stored transposed; conjugation stays a gemm-time
+    // operation so the packed data itself is never conjugated
+    return trans == rocblas_operation_none ? rocblas_operation_transpose : trans;
+}
+
+inline rocblas_operation rocblas_gemm_packed_operation_b(rocblas_operation)
+{
+    return rocblas_operation_none;
+}
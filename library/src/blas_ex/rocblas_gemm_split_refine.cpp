@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_gemm_split_refine.hpp"
+
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // hi = f16(v), lo = f16(v - f32(hi)): the low part carries the rounding
+    // residual, so f32(hi) + f32(lo) recovers v to roughly f16 precision
+    // squared. The split copies are written tightly (ld = rows) since they
+    // only feed the internal passes.
+    template <int DIM_X, int DIM_Y>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_split_f16_kernel(rocblas_int rows,
+                                  rocblas_int cols,
+                                  const float* __restrict__ A,
+                                  int64_t lda,
+                                  rocblas_half* __restrict__ hi,
+                                  rocblas_half* __restrict__ lo)
+    {
+        rocblas_int tx = blockIdx.x * DIM_X + threadIdx.x;
+        rocblas_int ty = blockIdx.y * DIM_Y + threadIdx.y;
+
+        if(tx < rows && ty < cols)
+        {
+            float        v = A[tx + ty * lda];
+            rocblas_half h = rocblas_half(v);
+            float        r = v - float(h);
+
+            size_t idx = tx + ty * size_t(rows);
+            hi[idx]    = h;
+            lo[idx]    = rocblas_half(r);
+        }
+    }
+
+    rocblas_status rocblas_gemm_split_launch(rocblas_handle handle,
+                                             rocblas_int    rows,
+                                             rocblas_int    cols,
+                                             const float*   A,
+                                             rocblas_int    lda,
+                                             rocblas_half*  hi,
+                                             rocblas_half*  lo)
+    {
+        static constexpr int DIM_X = 128;
+        static constexpr int DIM_Y = 8;
+
+        dim3 grid((rows - 1) / DIM_X + 1, (cols - 1) / DIM_Y + 1);
+        dim3 threads(DIM_X, DIM_Y);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_split_f16_kernel<DIM_X, DIM_Y>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              rows,
+                              cols,
+                              A,
+                              lda,
+                              hi,
+                              lo);
+
+        return rocblas_status_success;
+    }
+}
+
+rocblas_status rocblas_internal_gemm_split_f16(rocblas_handle    handle,
+                                               rocblas_operation trans_a,
+                                               rocblas_operation trans_b,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const void*       alpha,
+                                               const void*       a,
+                                               rocblas_int       lda,
+                                               const void*       b,
+                                               rocblas_int       ldb,
+                                               const void*       beta,
+                                               const void*       c,
+                                               rocblas_int       ldc,
+                                               void*             d,
+                                               rocblas_int       ldd,
+                                               rocblas_gemm_algo algo,
+                                               int32_t           solution_index,
+                                               uint32_t          flags)
+{
+    rocblas_int rows_a = trans_a == rocblas_operation_none ? m : k;
+    rocblas_int cols_a = trans_a == rocblas_operation_none ? k : m;
+    rocblas_int rows_b = trans_b == rocblas_operation_none ? k : n;
+    rocblas_int cols_b = trans_b == rocblas_operation_none ? n : k;
+
+    size_t elems_a = size_t(rows_a) * cols_a;
+    size_t elems_b = size_t(rows_b) * cols_b;
+    size_t bytes   = 2 * (elems_a + elems_b) * sizeof(rocblas_half);
+
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(bytes);
+
+    // the split-refine flag is consumed here; the remaining flags are
+    // forwarded to the internal f16 passes
+    uint32_t inner_flags = flags & ~rocblas_gemm_flags_split_f16;
+
+    // k == 0 degenerates to D = beta*C, a single ordinary pass
+    if(!k)
+        return rocblas_gemm_ex_template<false>(handle,
+                                               trans_a,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               a,
+                                               rocblas_datatype_f32_r,
+                                               0,
+                                               lda,
+                                               {1},
+                                               b,
+                                               rocblas_datatype_f32_r,
+                                               0,
+                                               ldb,
+                                               {1},
+                                               beta,
+                                               c,
+                                               rocblas_datatype_f32_r,
+                                               0,
+                                               ldc,
+                                               {1},
+                                               d,
+                                               rocblas_datatype_f32_r,
+                                               0,
+                                               ldd,
+                                               {1},
+                                               1,
+                                               rocblas_datatype_f32_r,
+                                               algo,
+                                               solution_index,
+                                               inner_flags);
+
+    auto w_mem = handle->device_malloc(bytes);
+    if(!w_mem)
+        return rocblas_status_memory_error;
+
+    auto* a_hi = (rocblas_half*)w_mem;
+    auto* a_lo = a_hi + elems_a;
+    auto* b_hi = a_lo + elems_a;
+    auto* b_lo = b_hi + elems_b;
+
+    RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_split_launch(
+        handle, rows_a, cols_a, (const float*)a, lda, a_hi, a_lo));
+    RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_split_launch(
+        handle, rows_b, cols_b, (const float*)b, ldb, b_hi, b_lo));
+
+    // pass 1: D = alpha*op(Ah)*op(Bh) + beta*C; passes 2 and 3 accumulate
+    // the cross products into D. The lo*lo term is below f32 resolution of
+    // the result and is dropped, as in the classic 3-pass scheme.
+    const float one = 1.0f;
+
+    const rocblas_half* pass_a[] = {a_hi, a_hi, a_lo};
+    const rocblas_half* pass_b[] = {b_hi, b_lo, b_hi};
+
+    for(int pass = 0; pass < 3; pass++)
+    {
+        RETURN_IF_ROCBLAS_ERROR(
+            rocblas_gemm_ex_template<false>(handle,
+                                            trans_a,
+                                            trans_b,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            pass_a[pass],
+                                            rocblas_datatype_f16_r,
+                                            0,
+                                            rows_a,
+                                            {1},
+                                            pass_b[pass],
+                                            rocblas_datatype_f16_r,
+                                            0,
+                                            rows_b,
+                                            {1},
+                                            pass ? (const void*)&one : beta,
+                                            pass ? (const void*)d : c,
+                                            rocblas_datatype_f32_r,
+                                            0,
+                                            pass ? ldd : ldc,
+                                            {1},
+                                            d,
+                                            rocblas_datatype_f32_r,
+                                            0,
+                                            ldd,
+                                            {1},
+                                            1,
+                                            rocblas_datatype_f32_r,
+                                            algo,
+                                            solution_index,
+                                            inner_flags));
+    }
+
+    return rocblas_status_success;
+}
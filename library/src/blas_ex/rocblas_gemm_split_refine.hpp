@@ -0,0 +1,50 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+
+// Split-and-correct f32 gemm (rocblas_gemm_flags_split_f16): A and B are
+// each split into an f16 high part and an f16 low part (the rounding
+// residual), and D = alpha*(Ah*Bh + Ah*Bl + Al*Bh) + beta*C is accumulated
+// in f32 through three HPA f16 gemm passes. Called from the gemm_ex entry
+// after validation with alpha and beta already staged on the host.
+rocblas_status rocblas_internal_gemm_split_f16(rocblas_handle    handle,
+                                               rocblas_operation trans_a,
+                                               rocblas_operation trans_b,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const void*       alpha,
+                                               const void*       a,
+                                               rocblas_int       lda,
+                                               const void*       b,
+                                               rocblas_int       ldb,
+                                               const void*       beta,
+                                               const void*       c,
+                                               rocblas_int       ldc,
+                                               void*             d,
+                                               rocblas_int       ldd,
+                                               rocblas_gemm_algo algo,
+                                               int32_t           solution_index,
+                                               uint32_t          flags);
@@ -26,6 +26,7 @@
 #include "logging.hpp"
 #include "rocblas_gemm_ex.hpp"
 #include "utility.hpp"
+#include <limits>
 
 namespace
 {
@@ -282,6 +283,21 @@ namespace
             return validArgs;
         }
 
+        // stride_a == 0 broadcasts one A panel across the batch; when the B and
+        // C/D panels are contiguous along columns of op(B) and C, the batch
+        // folds into a single GEMM of width n * batch_count, which keeps the
+        // shared A panel resident instead of re-streaming it per batch index
+        if(stride_a == 0 && batch_count > 1 && n > 0 && solution_index == 0
+           && stride_b
+                  == (trans_b == rocblas_operation_none ? rocblas_stride(ldb) * n
+                                                        : rocblas_stride(n))
+           && stride_c == rocblas_stride(ldc) * n && stride_d == rocblas_stride(ldd) * n
+           && rocblas_stride(n) * batch_count <= std::numeric_limits<API_INT>::max())
+        {
+            n           = API_INT(rocblas_stride(n) * batch_count);
+            batch_count = 1;
+        }
+
         return ROCBLAS_API(rocblas_gemm_ex_template)<false>(handle,
                                                             trans_a,
                                                             trans_b,
@@ -989,7 +989,8 @@ rocblas_status rocblas_internal_gemmt_launcher(rocblas_handle    handle,
     // GEMM based block recursive algorithm
     if((n >= n_zgemmt_threshold && k >= k_zgemmt_threshold && rocblas_is_complex_double)
        || (n >= n_gemmt_threshold && k >= k_gemmt_threshold
-           && (is_float || is_double || rocblas_is_complex_float)))
+           && (is_float || is_double || rocblas_is_complex_float))
+       || (n >= n_large_gemmt_threshold && k > 0))
     {
         // BATCHED is true for _batched and false for _strided_batched and non-batched
         constexpr bool BATCHED
@@ -0,0 +1,459 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Mixed-precision gemv: the fp16/bf16 input, fp32 accumulation kernel
+// instantiations already exist for the internal gemv launcher; this file
+// exposes them through a gemm_ex style type-dispatched public entry point so
+// mixed-precision matrix-vector products run through kernels shaped for
+// gemv rather than through rocblas_gemm_ex with n == 1.
+
+#include "../blas2/rocblas_gemv.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr char rocblas_gemv_ex_name[] = "rocblas_gemv_ex";
+
+    template <typename Ti, typename Tex, typename To>
+    rocblas_status rocblas_gemv_ex_typecasting(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               const void*       alpha,
+                                               const void*       A,
+                                               rocblas_int       lda,
+                                               const void*       x,
+                                               rocblas_int       incx,
+                                               const void*       beta,
+                                               void*             y,
+                                               rocblas_int       incy,
+                                               uint32_t          flags)
+    {
+        auto check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_ex);
+
+        rocblas_status arg_status = rocblas_internal_gemv_arg_check<rocblas_int>(handle,
+                                                                                 transA,
+                                                                                 m,
+                                                                                 n,
+                                                                                 (const Tex*)alpha,
+                                                                                 0,
+                                                                                 (const Ti*)A,
+                                                                                 0,
+                                                                                 lda,
+                                                                                 0,
+                                                                                 (const Ti*)x,
+                                                                                 0,
+                                                                                 incx,
+                                                                                 0,
+                                                                                 (const Tex*)beta,
+                                                                                 0,
+                                                                                 (To*)y,
+                                                                                 0,
+                                                                                 incy,
+                                                                                 0,
+                                                                                 1);
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+
+        // the workspace holds Tex partial sums, so it is sized for Tex
+        size_t dev_bytes = rocblas_internal_gemv_kernel_workspace_size<Tex>(transA, m, n, 1);
+
+        rocblas_status perf_status = rocblas_status_success;
+        auto           w_mem       = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            perf_status = rocblas_status_perf_degraded;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status gemv_check_numerics_status
+                = rocblas_gemv_check_numerics(rocblas_gemv_ex_name,
+                                              handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              (const Ti*)A,
+                                              0,
+                                              lda,
+                                              0,
+                                              (const Ti*)x,
+                                              0,
+                                              incx,
+                                              0,
+                                              (To*)y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(gemv_check_numerics_status != rocblas_status_success)
+                return gemv_check_numerics_status;
+        }
+
+        // as in rocblas_gemv_imp.hpp, the launcher is called directly since
+        // _template is not instantiated for mixed types
+        rocblas_status status = rocblas_internal_gemv_launcher<Ti, Tex, To>(handle,
+                                                                            transA,
+                                                                            m,
+                                                                            n,
+                                                                            (const Tex*)alpha,
+                                                                            0,
+                                                                            (const Ti*)A,
+                                                                            0,
+                                                                            lda,
+                                                                            0,
+                                                                            (const Ti*)x,
+                                                                            0,
+                                                                            incx,
+                                                                            0,
+                                                                            (const Tex*)beta,
+                                                                            0,
+                                                                            (To*)y,
+                                                                            0,
+                                                                            incy,
+                                                                            0,
+                                                                            1,
+                                                                            (Tex*)w_mem,
+                                                                            bool(flags
+                                                                                 & rocblas_gemm_flags_deterministic));
+
+        status = (status != rocblas_status_success) ? status : perf_status;
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status gemv_check_numerics_status
+                = rocblas_gemv_check_numerics(rocblas_gemv_ex_name,
+                                              handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              (const Ti*)A,
+                                              0,
+                                              lda,
+                                              0,
+                                              (const Ti*)x,
+                                              0,
+                                              incx,
+                                              0,
+                                              (To*)y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              check_numerics,
+                                              is_input);
+            if(gemv_check_numerics_status != rocblas_status_success)
+                return gemv_check_numerics_status;
+        }
+        return status;
+    }
+
+    rocblas_status rocblas_gemv_ex_impl(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        const void*       alpha,
+                                        const void*       A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        const void*       x,
+                                        rocblas_datatype  x_type,
+                                        rocblas_int       incx,
+                                        const void*       beta,
+                                        void*             y,
+                                        rocblas_datatype  y_type,
+                                        rocblas_int       incy,
+                                        rocblas_datatype  compute_type,
+                                        uint32_t          flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(handle->is_device_memory_size_query())
+        {
+            if(m <= 0 || n <= 0)
+                return rocblas_status_size_unchanged;
+
+            size_t dev_bytes = 0;
+            switch(compute_type)
+            {
+            case rocblas_datatype_f32_r:
+                dev_bytes = rocblas_internal_gemv_kernel_workspace_size<float>(transA, m, n, 1);
+                break;
+            case rocblas_datatype_f64_r:
+                dev_bytes = rocblas_internal_gemv_kernel_workspace_size<double>(transA, m, n, 1);
+                break;
+            case rocblas_datatype_f32_c:
+                dev_bytes = rocblas_internal_gemv_kernel_workspace_size<rocblas_float_complex>(
+                    transA, m, n, 1);
+                break;
+            case rocblas_datatype_f64_c:
+                dev_bytes = rocblas_internal_gemv_kernel_workspace_size<rocblas_double_complex>(
+                    transA, m, n, 1);
+                break;
+            default:
+                break;
+            }
+            return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto transA_letter = rocblas_transpose_letter(transA);
+            auto a_type_str    = rocblas_datatype_string(a_type);
+            auto x_type_str    = rocblas_datatype_string(x_type);
+            auto y_type_str    = rocblas_datatype_string(y_type);
+            auto ex_type_str   = rocblas_datatype_string(compute_type);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_host)
+            {
+                if(layer_mode & rocblas_layer_mode_log_trace)
+                {
+                    rocblas_internal_ostream alphass, betass;
+                    if(log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+                       == rocblas_status_success)
+                    {
+                        log_trace(handle,
+                                  rocblas_gemv_ex_name,
+                                  transA,
+                                  m,
+                                  n,
+                                  alphass.str(),
+                                  A,
+                                  a_type_str,
+                                  lda,
+                                  x,
+                                  x_type_str,
+                                  incx,
+                                  betass.str(),
+                                  y,
+                                  y_type_str,
+                                  incy,
+                                  ex_type_str,
+                                  flags);
+                    }
+                }
+
+                if(layer_mode & rocblas_layer_mode_log_bench)
+                {
+                    std::string alphas, betas;
+                    if(log_bench_alpha_beta_ex(compute_type, alpha, beta, alphas, betas)
+                       == rocblas_status_success)
+                    {
+                        log_bench(handle,
+                                  ROCBLAS_API_BENCH " -f gemv_ex",
+                                  "--transposeA",
+                                  transA_letter,
+                                  "-m",
+                                  m,
+                                  "-n",
+                                  n,
+                                  alphas,
+                                  "--a_type",
+                                  a_type_str,
+                                  "--lda",
+                                  lda,
+                                  "--b_type",
+                                  x_type_str,
+                                  "--incx",
+                                  incx,
+                                  betas,
+                                  "--c_type",
+                                  y_type_str,
+                                  "--incy",
+                                  incy,
+                                  "--compute_type",
+                                  ex_type_str,
+                                  "--flags",
+                                  flags);
+                    }
+                }
+            }
+            else if(layer_mode & rocblas_layer_mode_log_trace)
+            {
+                log_trace(handle,
+                          rocblas_gemv_ex_name,
+                          transA,
+                          m,
+                          n,
+                          A,
+                          a_type_str,
+                          lda,
+                          x,
+                          x_type_str,
+                          incx,
+                          y,
+                          y_type_str,
+                          incy,
+                          ex_type_str,
+                          flags);
+            }
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+            {
+                log_profile(handle,
+                            rocblas_gemv_ex_name,
+                            "transA",
+                            transA_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "a_type",
+                            a_type_str,
+                            "lda",
+                            lda,
+                            "b_type",
+                            x_type_str,
+                            "incx",
+                            incx,
+                            "c_type",
+                            y_type_str,
+                            "incy",
+                            incy,
+                            "compute_type",
+                            ex_type_str,
+                            "flags",
+                            flags);
+            }
+        }
+
+#define rocblas_gemv_ex_typecasting_PARAM \
+    handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, flags
+
+        if(a_type == rocblas_datatype_f16_r && x_type == rocblas_datatype_f16_r
+           && y_type == rocblas_datatype_f16_r && compute_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_gemv_ex_typecasting<rocblas_half, float, rocblas_half>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_f16_r && x_type == rocblas_datatype_f16_r
+                && y_type == rocblas_datatype_f32_r && compute_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_gemv_ex_typecasting<rocblas_half, float, float>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_bf16_r && x_type == rocblas_datatype_bf16_r
+                && y_type == rocblas_datatype_bf16_r && compute_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_gemv_ex_typecasting<rocblas_bfloat16, float, rocblas_bfloat16>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_bf16_r && x_type == rocblas_datatype_bf16_r
+                && y_type == rocblas_datatype_f32_r && compute_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_gemv_ex_typecasting<rocblas_bfloat16, float, float>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_f32_r && x_type == rocblas_datatype_f32_r
+                && y_type == rocblas_datatype_f32_r && compute_type == rocblas_datatype_f32_r)
+        {
+            return rocblas_gemv_ex_typecasting<float, float, float>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_f64_r && x_type == rocblas_datatype_f64_r
+                && y_type == rocblas_datatype_f64_r && compute_type == rocblas_datatype_f64_r)
+        {
+            return rocblas_gemv_ex_typecasting<double, double, double>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_f32_c && x_type == rocblas_datatype_f32_c
+                && y_type == rocblas_datatype_f32_c && compute_type == rocblas_datatype_f32_c)
+        {
+            return rocblas_gemv_ex_typecasting<rocblas_float_complex,
+                                               rocblas_float_complex,
+                                               rocblas_float_complex>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+        else if(a_type == rocblas_datatype_f64_c && x_type == rocblas_datatype_f64_c
+                && y_type == rocblas_datatype_f64_c && compute_type == rocblas_datatype_f64_c)
+        {
+            return rocblas_gemv_ex_typecasting<rocblas_double_complex,
+                                               rocblas_double_complex,
+                                               rocblas_double_complex>(
+                rocblas_gemv_ex_typecasting_PARAM);
+        }
+
+#undef rocblas_gemv_ex_typecasting_PARAM
+
+        return rocblas_status_not_implemented;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_gemv_ex(rocblas_handle    handle,
+                                          rocblas_operation trans,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          const void*       alpha,
+                                          const void*       A,
+                                          rocblas_datatype  a_type,
+                                          rocblas_int       lda,
+                                          const void*       x,
+                                          rocblas_datatype  x_type,
+                                          rocblas_int       incx,
+                                          const void*       beta,
+                                          void*             y,
+                                          rocblas_datatype  y_type,
+                                          rocblas_int       incy,
+                                          rocblas_datatype  compute_type,
+                                          uint32_t          flags)
+try
+{
+    return rocblas_gemv_ex_impl(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                a_type,
+                                lda,
+                                x,
+                                x_type,
+                                incx,
+                                beta,
+                                y,
+                                y_type,
+                                incy,
+                                compute_type,
+                                flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,469 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Fused multi-rank update: A += alpha * x * y^T for an m x k matrix x and an
+// n x k matrix y, i.e. k rank-1 (ger) updates applied in a single traversal
+// of A. Applying k consecutive ger calls streams A from HBM k times; the ger
+// update is pure bandwidth, so fusing the updates divides the A traffic by k.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_ger_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_multi_name<float>[] = "rocblas_sger_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<double>[] = "rocblas_dger_multi";
+
+    template <typename>
+    constexpr char rocblas_ger_multi_sb_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_multi_sb_name<float>[] = "rocblas_sger_multi_strided_batched";
+    template <>
+    constexpr char rocblas_ger_multi_sb_name<double>[] = "rocblas_dger_multi_strided_batched";
+
+    // Same block shape as the generic ger kernel; the update vectors are
+    // staged in LDS in chunks of KMAX columns and each thread accumulates its
+    // WIN elements of A in registers across all k updates, so A is read and
+    // written exactly once regardless of k.
+    template <rocblas_int DIM_X,
+              rocblas_int DIM_Y,
+              rocblas_int WIN,
+              rocblas_int KMAX,
+              typename Ta,
+              typename T>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_ger_multi_kernel(rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             Ta          alpha_device_host,
+                             const T* __restrict__ xa,
+                             int64_t        ldx,
+                             rocblas_stride stridex,
+                             const T* __restrict__ ya,
+                             int64_t        ldy,
+                             rocblas_stride stridey,
+                             T* __restrict__ Aa,
+                             int64_t        lda,
+                             rocblas_stride strideA)
+    {
+        __shared__ T xdata[KMAX][DIM_X];
+        __shared__ T ydata[KMAX][DIM_Y * WIN];
+
+        auto alpha = load_scalar(alpha_device_host);
+        if(!alpha)
+            return;
+
+        const T* __restrict__ x = load_ptr_batch(xa, blockIdx.z, 0, stridex);
+        const T* __restrict__ y = load_ptr_batch(ya, blockIdx.z, 0, stridey);
+        T* __restrict__ A       = load_ptr_batch(Aa, blockIdx.z, 0, strideA);
+
+        int tx    = blockIdx.x * blockDim.x + threadIdx.x;
+        int ty    = (blockIdx.y * blockDim.y + threadIdx.y) * WIN;
+        int ybase = blockIdx.y * DIM_Y * WIN;
+        int td    = threadIdx.y * DIM_X + threadIdx.x;
+
+        T acc[WIN] = {};
+
+        for(rocblas_int j0 = 0; j0 < k; j0 += KMAX)
+        {
+            rocblas_int kchunk = k - j0 < KMAX ? k - j0 : KMAX;
+
+            for(int j = threadIdx.y; j < kchunk; j += DIM_Y)
+                xdata[j][threadIdx.x] = tx < m ? x[tx + (j0 + j) * ldx] : T(0);
+
+            for(int idx = td; idx < DIM_Y * WIN * kchunk; idx += DIM_X * DIM_Y)
+            {
+                int j  = idx / (DIM_Y * WIN);
+                int yi = idx % (DIM_Y * WIN);
+                ydata[j][yi] = ybase + yi < n ? y[(ybase + yi) + (j0 + j) * ldy] : T(0);
+            }
+
+            __syncthreads();
+
+            if(tx < m)
+            {
+                for(int j = 0; j < kchunk; j++)
+                {
+                    T x_value = xdata[j][threadIdx.x];
+                    for(int i = 0; i < WIN; i++)
+                        acc[i] += x_value * ydata[j][threadIdx.y * WIN + i];
+                }
+            }
+
+            __syncthreads();
+        }
+
+        if(tx < m)
+        {
+            for(int i = 0; i < WIN; i++)
+            {
+                int yi = ty + i;
+                if(yi < n)
+                    A[tx + lda * yi] += alpha * acc[i];
+            }
+        }
+    }
+
+    template <typename T>
+    rocblas_status rocblas_internal_ger_multi_launcher(rocblas_handle handle,
+                                                       rocblas_int    m,
+                                                       rocblas_int    n,
+                                                       rocblas_int    k,
+                                                       const T*       alpha,
+                                                       const T*       x,
+                                                       rocblas_int    ldx,
+                                                       rocblas_stride stridex,
+                                                       const T*       y,
+                                                       rocblas_int    ldy,
+                                                       rocblas_stride stridey,
+                                                       T*             A,
+                                                       rocblas_int    lda,
+                                                       rocblas_stride strideA,
+                                                       rocblas_int    batch_count)
+    {
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 32;
+        static constexpr int WIN   = 2; // work item number of elements to process
+        static constexpr int KMAX  = 4; // rank-1 updates staged in LDS per pass
+
+        rocblas_int blocksX = (m - 1) / DIM_X + 1;
+        rocblas_int blocksY = (n - 1) / (DIM_Y * WIN) + 1;
+
+        dim3 ger_grid(blocksX, blocksY, batch_count);
+        dim3 ger_threads(DIM_X, DIM_Y);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_ger_multi_kernel<DIM_X, DIM_Y, WIN, KMAX, const T*, T>),
+                                  ger_grid,
+                                  ger_threads,
+                                  0,
+                                  handle->get_stream(),
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  x,
+                                  int64_t(ldx),
+                                  stridex,
+                                  y,
+                                  int64_t(ldy),
+                                  stridey,
+                                  A,
+                                  int64_t(lda),
+                                  strideA);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_ger_multi_kernel<DIM_X, DIM_Y, WIN, KMAX, T, T>),
+                                  ger_grid,
+                                  ger_threads,
+                                  0,
+                                  handle->get_stream(),
+                                  m,
+                                  n,
+                                  k,
+                                  *alpha,
+                                  x,
+                                  int64_t(ldx),
+                                  stridex,
+                                  y,
+                                  int64_t(ldy),
+                                  stridey,
+                                  A,
+                                  int64_t(lda),
+                                  strideA);
+        }
+
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_ger_multi_impl(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          rocblas_int    k,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    ldx,
+                                          rocblas_stride stridex,
+                                          const T*       y,
+                                          rocblas_int    ldy,
+                                          rocblas_stride stridey,
+                                          T*             A,
+                                          rocblas_int    lda,
+                                          rocblas_stride strideA,
+                                          rocblas_int    batch_count,
+                                          const char*    name,
+                                          const char*    bench_name)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, m, n, k, alpha, x, ldx, y, ldy, A, lda, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f ",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-m",
+                      m,
+                      "-n",
+                      n,
+                      "-k",
+                      k,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--ldx",
+                      ldx,
+                      "--ldy",
+                      ldy,
+                      "--lda",
+                      lda,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        name,
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "ldx",
+                        ldx,
+                        "ldy",
+                        ldy,
+                        "lda",
+                        lda,
+                        "batch_count",
+                        batch_count);
+
+        if(m < 0 || n < 0 || k < 0 || ldx < m || ldx < 1 || ldy < n || ldy < 1 || lda < m
+           || lda < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !k || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0)
+            return rocblas_status_success;
+
+        if(!x || !y || !A)
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_internal_ger_multi_launcher(handle,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   x,
+                                                   ldx,
+                                                   stridex,
+                                                   y,
+                                                   ldy,
+                                                   stridey,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_sger_multi(rocblas_handle handle,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  rocblas_int    k,
+                                  const float*   alpha,
+                                  const float*   x,
+                                  rocblas_int    ldx,
+                                  const float*   y,
+                                  rocblas_int    ldy,
+                                  float*         A,
+                                  rocblas_int    lda)
+try
+{
+    return rocblas_ger_multi_impl(handle,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  x,
+                                  ldx,
+                                  0,
+                                  y,
+                                  ldy,
+                                  0,
+                                  A,
+                                  lda,
+                                  0,
+                                  1,
+                                  rocblas_ger_multi_name<float>,
+                                  "ger_multi");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dger_multi(rocblas_handle handle,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  rocblas_int    k,
+                                  const double*  alpha,
+                                  const double*  x,
+                                  rocblas_int    ldx,
+                                  const double*  y,
+                                  rocblas_int    ldy,
+                                  double*        A,
+                                  rocblas_int    lda)
+try
+{
+    return rocblas_ger_multi_impl(handle,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  x,
+                                  ldx,
+                                  0,
+                                  y,
+                                  ldy,
+                                  0,
+                                  A,
+                                  lda,
+                                  0,
+                                  1,
+                                  rocblas_ger_multi_name<double>,
+                                  "ger_multi");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_sger_multi_strided_batched(rocblas_handle handle,
+                                                  rocblas_int    m,
+                                                  rocblas_int    n,
+                                                  rocblas_int    k,
+                                                  const float*   alpha,
+                                                  const float*   x,
+                                                  rocblas_int    ldx,
+                                                  rocblas_stride stridex,
+                                                  const float*   y,
+                                                  rocblas_int    ldy,
+                                                  rocblas_stride stridey,
+                                                  float*         A,
+                                                  rocblas_int    lda,
+                                                  rocblas_stride strideA,
+                                                  rocblas_int    batch_count)
+try
+{
+    return rocblas_ger_multi_impl(handle,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  x,
+                                  ldx,
+                                  stridex,
+                                  y,
+                                  ldy,
+                                  stridey,
+                                  A,
+                                  lda,
+                                  strideA,
+                                  batch_count,
+                                  rocblas_ger_multi_sb_name<float>,
+                                  "ger_multi_strided_batched");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dger_multi_strided_batched(rocblas_handle handle,
+                                                  rocblas_int    m,
+                                                  rocblas_int    n,
+                                                  rocblas_int    k,
+                                                  const double*  alpha,
+                                                  const double*  x,
+                                                  rocblas_int    ldx,
+                                                  rocblas_stride stridex,
+                                                  const double*  y,
+                                                  rocblas_int    ldy,
+                                                  rocblas_stride stridey,
+                                                  double*        A,
+                                                  rocblas_int    lda,
+                                                  rocblas_stride strideA,
+                                                  rocblas_int    batch_count)
+try
+{
+    return rocblas_ger_multi_impl(handle,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  x,
+                                  ldx,
+                                  stridex,
+                                  y,
+                                  ldy,
+                                  stridey,
+                                  A,
+                                  lda,
+                                  strideA,
+                                  batch_count,
+                                  rocblas_ger_multi_sb_name<double>,
+                                  "ger_multi_strided_batched");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
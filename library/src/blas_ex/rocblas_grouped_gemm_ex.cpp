@@ -0,0 +1,247 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    rocblas_status rocblas_grouped_gemm_ex_impl(rocblas_handle     handle,
+                                                rocblas_operation  trans_a,
+                                                rocblas_operation  trans_b,
+                                                rocblas_int        group_count,
+                                                const rocblas_int* m,
+                                                const rocblas_int* n,
+                                                const rocblas_int* k,
+                                                const void*        alpha,
+                                                const void* const* a,
+                                                rocblas_datatype   a_type,
+                                                const rocblas_int* lda,
+                                                const void* const* b,
+                                                rocblas_datatype   b_type,
+                                                const rocblas_int* ldb,
+                                                const void*        beta,
+                                                const void* const* c,
+                                                rocblas_datatype   c_type,
+                                                const rocblas_int* ldc,
+                                                void* const*       d,
+                                                rocblas_datatype   d_type,
+                                                const rocblas_int* ldd,
+                                                rocblas_datatype   compute_type,
+                                                rocblas_gemm_algo  algo,
+                                                int32_t            solution_index,
+                                                uint32_t           flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+        if(!group_count)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+
+        // The size/ld/pointer arrays are host-side, one entry per group
+        if(!m || !n || !k || !lda || !ldb || !ldc || !ldd || !a || !b || !c || !d)
+            return rocblas_status_invalid_pointer;
+
+        // Copy alpha and beta to host once for the whole group; individual
+        // problems all share the same scalars
+        rocblas_int max_k = 0;
+        for(rocblas_int i = 0; i < group_count; i++)
+            if(k[i] > max_k)
+                max_k = k[i];
+
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, max_k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query())
+        {
+            // Perform logging once for the whole group
+            auto layer_mode = handle->layer_mode;
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          "rocblas_grouped_gemm_ex",
+                          trans_a,
+                          trans_b,
+                          group_count,
+                          rocblas_datatype_string(a_type),
+                          rocblas_datatype_string(b_type),
+                          rocblas_datatype_string(c_type),
+                          rocblas_datatype_string(d_type),
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+        }
+
+        // Validate every member before dispatching any, so that a bad entry
+        // does not leave the group partially executed
+        for(rocblas_int i = 0; i < group_count; i++)
+        {
+            auto validArgs = rocblas_gemm_ex_arg_check(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m[i],
+                                                       n[i],
+                                                       k[i],
+                                                       alpha,
+                                                       a[i],
+                                                       lda[i],
+                                                       b[i],
+                                                       ldb[i],
+                                                       beta,
+                                                       c[i],
+                                                       c_type,
+                                                       ldc[i],
+                                                       d[i],
+                                                       d_type,
+                                                       ldd[i],
+                                                       compute_type);
+            if(validArgs != rocblas_status_continue && validArgs != rocblas_status_success)
+                return validArgs;
+        }
+
+        // TODO: These strides could be 0 ( {} ) instead of 1 ( {1} ) once Tensile is fixed
+        rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
+
+        // Dispatch the group members back-to-back on the stream. Per-shape
+        // solution selection is cached by the Tensile host, so only the first
+        // occurrence of each shape pays selection overhead.
+        for(rocblas_int i = 0; i < group_count; i++)
+        {
+            if(!m[i] || !n[i])
+                continue;
+
+            auto status = rocblas_gemm_ex_template<false>(handle,
+                                                          trans_a,
+                                                          trans_b,
+                                                          m[i],
+                                                          n[i],
+                                                          k[i],
+                                                          alpha,
+                                                          a[i],
+                                                          a_type,
+                                                          0,
+                                                          lda[i],
+                                                          stride_a,
+                                                          b[i],
+                                                          b_type,
+                                                          0,
+                                                          ldb[i],
+                                                          stride_b,
+                                                          beta,
+                                                          c[i],
+                                                          c_type,
+                                                          0,
+                                                          ldc[i],
+                                                          stride_c,
+                                                          d[i],
+                                                          d_type,
+                                                          0,
+                                                          ldd[i],
+                                                          stride_d,
+                                                          1,
+                                                          compute_type,
+                                                          algo,
+                                                          solution_index,
+                                                          flags);
+
+            // During a device memory size query every member must be visited
+            // so that the maximum workspace is accumulated
+            if(status != rocblas_status_success && status != rocblas_status_size_increased
+               && status != rocblas_status_size_unchanged)
+                return status;
+        }
+
+        if(handle->is_device_memory_size_query())
+            return rocblas_status_size_unchanged;
+
+        return rocblas_status_success;
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_grouped_gemm_ex(rocblas_handle     handle,
+                                                  rocblas_operation  trans_a,
+                                                  rocblas_operation  trans_b,
+                                                  rocblas_int        group_count,
+                                                  const rocblas_int* m,
+                                                  const rocblas_int* n,
+                                                  const rocblas_int* k,
+                                                  const void*        alpha,
+                                                  const void* const* a,
+                                                  rocblas_datatype   a_type,
+                                                  const rocblas_int* lda,
+                                                  const void* const* b,
+                                                  rocblas_datatype   b_type,
+                                                  const rocblas_int* ldb,
+                                                  const void*        beta,
+                                                  const void* const* c,
+                                                  rocblas_datatype   c_type,
+                                                  const rocblas_int* ldc,
+                                                  void* const*       d,
+                                                  rocblas_datatype   d_type,
+                                                  const rocblas_int* ldd,
+                                                  rocblas_datatype   compute_type,
+                                                  rocblas_gemm_algo  algo,
+                                                  int32_t            solution_index,
+                                                  uint32_t           flags)
+try
+{
+    return rocblas_grouped_gemm_ex_impl(handle,
+                                        trans_a,
+                                        trans_b,
+                                        group_count,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        a,
+                                        a_type,
+                                        lda,
+                                        b,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        c,
+                                        c_type,
+                                        ldc,
+                                        d,
+                                        d_type,
+                                        ldd,
+                                        compute_type,
+                                        algo,
+                                        solution_index,
+                                        flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
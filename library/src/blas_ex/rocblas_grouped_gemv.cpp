@@ -0,0 +1,304 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // One thread per output element, one grid row per group: each block reads
+    // its group's dimensions and pointers from the staged device metadata, so
+    // problems of different sizes run in a single launch with no padding.
+    // Groups whose output is shorter than the widest group simply retire their
+    // excess blocks at the bounds check.
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_grouped_gemv_kernel(bool transpose,
+                                const T* const* __restrict__ Aa,
+                                const rocblas_int* __restrict__ ms,
+                                const rocblas_int* __restrict__ ns,
+                                const rocblas_int* __restrict__ ldas,
+                                T alpha,
+                                const T* const* __restrict__ xa,
+                                rocblas_int incx,
+                                T           beta,
+                                T* const* __restrict__ ya,
+                                rocblas_int incy)
+    {
+        const rocblas_int g       = blockIdx.y;
+        const rocblas_int gm      = ms[g];
+        const rocblas_int gn      = ns[g];
+        const rocblas_int out_len = transpose ? gn : gm;
+        const rocblas_int in_len  = transpose ? gm : gn;
+
+        const int64_t out = int64_t(blockIdx.x) * NB + threadIdx.x;
+        if(out >= out_len)
+            return;
+
+        const T*      A   = Aa[g];
+        const int64_t lda = ldas[g];
+
+        // negative increments walk back from the far end, as in regular gemv
+        const T* x = xa[g];
+        T*       y = ya[g];
+        if(incx < 0)
+            x -= int64_t(incx) * (in_len - 1);
+        if(incy < 0)
+            y -= int64_t(incy) * (out_len - 1);
+
+        T res = 0;
+        if(alpha != 0)
+        {
+            if(!transpose)
+                for(int64_t j = 0; j < in_len; j++)
+                    res += A[out + j * lda] * x[j * incx];
+            else
+                for(int64_t i = 0; i < in_len; i++)
+                    res += A[i + out * lda] * x[i * incx];
+        }
+
+        T* ty = y + out * incy;
+        *ty   = beta ? alpha * res + beta * (*ty) : alpha * res;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_grouped_gemv_launcher(rocblas_handle     handle,
+                                                 rocblas_operation  trans,
+                                                 rocblas_int        group_count,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 T                  alpha,
+                                                 const void* const* a,
+                                                 const rocblas_int* lda,
+                                                 const void* const* x,
+                                                 rocblas_int        incx,
+                                                 T                  beta,
+                                                 void* const*       y,
+                                                 rocblas_int        incy)
+    {
+        static constexpr int NB = 256;
+
+        const bool transpose = trans != rocblas_operation_none;
+
+        // Stage the per-group pointers and dimensions into the pooled device
+        // workspace: [a][x][y][m][n][lda], pointers first for alignment
+        const size_t ptr_bytes = sizeof(void*) * group_count;
+        const size_t int_bytes = sizeof(rocblas_int) * group_count;
+        const size_t dev_bytes = 3 * ptr_bytes + 3 * int_bytes;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        std::vector<char> host_meta(dev_bytes);
+        memcpy(&host_meta[0], a, ptr_bytes);
+        memcpy(&host_meta[ptr_bytes], x, ptr_bytes);
+        memcpy(&host_meta[2 * ptr_bytes], y, ptr_bytes);
+        memcpy(&host_meta[3 * ptr_bytes], m, int_bytes);
+        memcpy(&host_meta[3 * ptr_bytes + int_bytes], n, int_bytes);
+        memcpy(&host_meta[3 * ptr_bytes + 2 * int_bytes], lda, int_bytes);
+
+        auto* dev_meta = (char*)(void*)w_mem;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dev_meta,
+                                           host_meta.data(),
+                                           dev_bytes,
+                                           hipMemcpyHostToDevice,
+                                           handle->get_stream()));
+        // the staging vector leaves scope on return, so the copy must be done
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+
+        auto* d_a   = (const T* const*)dev_meta;
+        auto* d_x   = (const T* const*)(dev_meta + ptr_bytes);
+        auto* d_y   = (T* const*)(dev_meta + 2 * ptr_bytes);
+        auto* d_m   = (const rocblas_int*)(dev_meta + 3 * ptr_bytes);
+        auto* d_n   = (const rocblas_int*)(dev_meta + 3 * ptr_bytes + int_bytes);
+        auto* d_lda = (const rocblas_int*)(dev_meta + 3 * ptr_bytes + 2 * int_bytes);
+
+        rocblas_int max_out = 0;
+        for(rocblas_int i = 0; i < group_count; i++)
+        {
+            rocblas_int out_len = transpose ? n[i] : m[i];
+            if(out_len > max_out)
+                max_out = out_len;
+        }
+        if(!max_out)
+            return rocblas_status_success;
+
+        // grid.y is limited to 65535, so very large group counts take a few
+        // launches, each still covering thousands of groups
+        for(rocblas_int g0 = 0; g0 < group_count; g0 += 65535)
+        {
+            rocblas_int groups = std::min(group_count - g0, 65535);
+
+            dim3 grid((max_out - 1) / NB + 1, groups);
+            dim3 threads(NB);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_grouped_gemv_kernel<NB, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  transpose,
+                                  d_a + g0,
+                                  d_m + g0,
+                                  d_n + g0,
+                                  d_lda + g0,
+                                  alpha,
+                                  d_x + g0,
+                                  incx,
+                                  beta,
+                                  d_y + g0,
+                                  incy);
+        }
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_grouped_gemv_impl(rocblas_handle     handle,
+                                             rocblas_operation  trans,
+                                             rocblas_int        group_count,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             const void*        alpha,
+                                             const void* const* a,
+                                             const rocblas_int* lda,
+                                             const void* const* x,
+                                             rocblas_int        incx,
+                                             const void*        beta,
+                                             void* const*       y,
+                                             rocblas_int        incy,
+                                             rocblas_datatype   type)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(type != rocblas_datatype_f32_r && type != rocblas_datatype_f64_r)
+            return rocblas_status_not_implemented;
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+
+        // per-group pointer and dimension staging in the pooled workspace
+        size_t dev_bytes = group_count * (3 * sizeof(void*) + 3 * sizeof(rocblas_int));
+        if(handle->is_device_memory_size_query())
+        {
+            if(group_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_grouped_gemv",
+                      trans,
+                      group_count,
+                      rocblas_datatype_string(type),
+                      incx,
+                      incy);
+
+        if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+           && trans != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(!group_count)
+            return rocblas_status_success;
+
+        // The size/ld/pointer arrays are host-side, one entry per group
+        if(!m || !n || !lda || !a || !x || !y || !alpha || !beta)
+            return rocblas_status_invalid_pointer;
+        if(!incx || !incy)
+            return rocblas_status_invalid_size;
+
+        // Validate every member before dispatching any, so that a bad entry
+        // does not leave the group partially executed
+        for(rocblas_int i = 0; i < group_count; i++)
+        {
+            if(m[i] < 0 || n[i] < 0 || lda[i] < m[i] || lda[i] < 1)
+                return rocblas_status_invalid_size;
+            if(m[i] && n[i] && (!a[i] || !x[i] || !y[i]))
+                return rocblas_status_invalid_pointer;
+        }
+
+        // Copy alpha and beta to host if on device; the groups share them
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, 1, type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(type == rocblas_datatype_f32_r)
+            return rocblas_grouped_gemv_launcher<float>(handle,
+                                                        trans,
+                                                        group_count,
+                                                        m,
+                                                        n,
+                                                        *(const float*)alpha,
+                                                        a,
+                                                        lda,
+                                                        x,
+                                                        incx,
+                                                        *(const float*)beta,
+                                                        y,
+                                                        incy);
+        else
+            return rocblas_grouped_gemv_launcher<double>(handle,
+                                                         trans,
+                                                         group_count,
+                                                         m,
+                                                         n,
+                                                         *(const double*)alpha,
+                                                         a,
+                                                         lda,
+                                                         x,
+                                                         incx,
+                                                         *(const double*)beta,
+                                                         y,
+                                                         incy);
+    }
+}
+
+extern "C" rocblas_status rocblas_grouped_gemv(rocblas_handle     handle,
+                                               rocblas_operation  trans,
+                                               rocblas_int        group_count,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               const void*        alpha,
+                                               const void* const* a,
+                                               const rocblas_int* lda,
+                                               const void* const* x,
+                                               rocblas_int        incx,
+                                               const void*        beta,
+                                               void* const*       y,
+                                               rocblas_int        incy,
+                                               rocblas_datatype   type)
+try
+{
+    return rocblas_grouped_gemv_impl(
+        handle, trans, group_count, m, n, alpha, a, lda, x, incx, beta, y, incy, type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
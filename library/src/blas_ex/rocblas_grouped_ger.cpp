@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // 2-D tile over the matrix, one grid plane per group. Per-group dimensions
+    // and pointers come from staged device metadata so groups of differing
+    // shapes share a single launch; tiles past a small group's edge retire at
+    // the bounds check.
+    template <int DIM_X, int DIM_Y, typename T>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_grouped_ger_kernel(const rocblas_int* __restrict__ ms,
+                               const rocblas_int* __restrict__ ns,
+                               T alpha,
+                               const T* const* __restrict__ xa,
+                               rocblas_int incx,
+                               const T* const* __restrict__ ya,
+                               rocblas_int incy,
+                               T* const* __restrict__ aa,
+                               const rocblas_int* __restrict__ ldas)
+    {
+        const rocblas_int g  = blockIdx.z;
+        const rocblas_int gm = ms[g];
+        const rocblas_int gn = ns[g];
+
+        const int64_t tx = int64_t(blockIdx.x) * DIM_X + threadIdx.x;
+        const int64_t ty = int64_t(blockIdx.y) * DIM_Y + threadIdx.y;
+        if(tx >= gm || ty >= gn)
+            return;
+
+        const T* x = xa[g];
+        const T* y = ya[g];
+        if(incx < 0)
+            x -= int64_t(incx) * (gm - 1);
+        if(incy < 0)
+            y -= int64_t(incy) * (gn - 1);
+
+        T*            A   = aa[g];
+        const int64_t lda = ldas[g];
+
+        A[tx + ty * lda] += alpha * x[tx * incx] * y[ty * incy];
+    }
+
+    template <typename T>
+    rocblas_status rocblas_grouped_ger_launcher(rocblas_handle     handle,
+                                                rocblas_int        group_count,
+                                                const rocblas_int* m,
+                                                const rocblas_int* n,
+                                                T                  alpha,
+                                                const void* const* x,
+                                                rocblas_int        incx,
+                                                const void* const* y,
+                                                rocblas_int        incy,
+                                                void* const*       a,
+                                                const rocblas_int* lda)
+    {
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 8;
+
+        if(alpha == 0)
+            return rocblas_status_success;
+
+        // Stage the per-group pointers and dimensions into the pooled device
+        // workspace: [x][y][a][m][n][lda], pointers first for alignment
+        const size_t ptr_bytes = sizeof(void*) * group_count;
+        const size_t int_bytes = sizeof(rocblas_int) * group_count;
+        const size_t dev_bytes = 3 * ptr_bytes + 3 * int_bytes;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        std::vector<char> host_meta(dev_bytes);
+        memcpy(&host_meta[0], x, ptr_bytes);
+        memcpy(&host_meta[ptr_bytes], y, ptr_bytes);
+        memcpy(&host_meta[2 * ptr_bytes], a, ptr_bytes);
+        memcpy(&host_meta[3 * ptr_bytes], m, int_bytes);
+        memcpy(&host_meta[3 * ptr_bytes + int_bytes], n, int_bytes);
+        memcpy(&host_meta[3 * ptr_bytes + 2 * int_bytes], lda, int_bytes);
+
+        auto* dev_meta = (char*)(void*)w_mem;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dev_meta,
+                                           host_meta.data(),
+                                           dev_bytes,
+                                           hipMemcpyHostToDevice,
+                                           handle->get_stream()));
+        // the staging vector leaves scope on return, so the copy must be done
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+
+        auto* d_x   = (const T* const*)dev_meta;
+        auto* d_y   = (const T* const*)(dev_meta + ptr_bytes);
+        auto* d_a   = (T* const*)(dev_meta + 2 * ptr_bytes);
+        auto* d_m   = (const rocblas_int*)(dev_meta + 3 * ptr_bytes);
+        auto* d_n   = (const rocblas_int*)(dev_meta + 3 * ptr_bytes + int_bytes);
+        auto* d_lda = (const rocblas_int*)(dev_meta + 3 * ptr_bytes + 2 * int_bytes);
+
+        rocblas_int max_m = 0, max_n = 0;
+        for(rocblas_int i = 0; i < group_count; i++)
+        {
+            if(m[i] > max_m)
+                max_m = m[i];
+            if(n[i] > max_n)
+                max_n = n[i];
+        }
+        if(!max_m || !max_n)
+            return rocblas_status_success;
+
+        // grid.z is limited to 65535, so very large group counts take a few
+        // launches, each still covering thousands of groups
+        for(rocblas_int g0 = 0; g0 < group_count; g0 += 65535)
+        {
+            rocblas_int groups = std::min(group_count - g0, 65535);
+
+            dim3 grid((max_m - 1) / DIM_X + 1, (max_n - 1) / DIM_Y + 1, groups);
+            dim3 threads(DIM_X, DIM_Y);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_grouped_ger_kernel<DIM_X, DIM_Y, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  d_m + g0,
+                                  d_n + g0,
+                                  alpha,
+                                  d_x + g0,
+                                  incx,
+                                  d_y + g0,
+                                  incy,
+                                  d_a + g0,
+                                  d_lda + g0);
+        }
+
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_grouped_ger_impl(rocblas_handle     handle,
+                                            rocblas_int        group_count,
+                                            const rocblas_int* m,
+                                            const rocblas_int* n,
+                                            const void*        alpha,
+                                            const void* const* x,
+                                            rocblas_int        incx,
+                                            const void* const* y,
+                                            rocblas_int        incy,
+                                            void* const*       a,
+                                            const rocblas_int* lda,
+                                            rocblas_datatype   type)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(type != rocblas_datatype_f32_r && type != rocblas_datatype_f64_r)
+            return rocblas_status_not_implemented;
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+
+        // per-group pointer and dimension staging in the pooled workspace
+        size_t dev_bytes = group_count * (3 * sizeof(void*) + 3 * sizeof(rocblas_int));
+        if(handle->is_device_memory_size_query())
+        {
+            if(group_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_grouped_ger",
+                      group_count,
+                      rocblas_datatype_string(type),
+                      incx,
+                      incy);
+
+        if(!group_count)
+            return rocblas_status_success;
+
+        // The size/ld/pointer arrays are host-side, one entry per group
+        if(!m || !n || !lda || !x || !y || !a || !alpha)
+            return rocblas_status_invalid_pointer;
+        if(!incx || !incy)
+            return rocblas_status_invalid_size;
+
+        // Validate every member before dispatching any, so that a bad entry
+        // does not leave the group partially executed
+        for(rocblas_int i = 0; i < group_count; i++)
+        {
+            if(m[i] < 0 || n[i] < 0 || lda[i] < m[i] || lda[i] < 1)
+                return rocblas_status_invalid_size;
+            if(m[i] && n[i] && (!x[i] || !y[i] || !a[i]))
+                return rocblas_status_invalid_pointer;
+        }
+
+        // Copy alpha to host if on device; the groups share it
+        const void*     beta = nullptr;
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, 1, type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(type == rocblas_datatype_f32_r)
+            return rocblas_grouped_ger_launcher<float>(
+                handle, group_count, m, n, *(const float*)alpha, x, incx, y, incy, a, lda);
+        else
+            return rocblas_grouped_ger_launcher<double>(
+                handle, group_count, m, n, *(const double*)alpha, x, incx, y, incy, a, lda);
+    }
+}
+
+extern "C" rocblas_status rocblas_grouped_ger(rocblas_handle     handle,
+                                              rocblas_int        group_count,
+                                              const rocblas_int* m,
+                                              const rocblas_int* n,
+                                              const void*        alpha,
+                                              const void* const* x,
+                                              rocblas_int        incx,
+                                              const void* const* y,
+                                              rocblas_int        incy,
+                                              void* const*       a,
+                                              const rocblas_int* lda,
+                                              rocblas_datatype   type)
+try
+{
+    return rocblas_grouped_ger_impl(
+        handle, group_count, m, n, alpha, x, incx, y, incy, a, lda, type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
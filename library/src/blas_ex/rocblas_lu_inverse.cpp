@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas3/rocblas_trmm.hpp"
+#include "blas3/rocblas_trtri.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    // trtri writes only the target triangle of its output, so after inverting
+    // U into invA the strictly lower part of invA still holds whatever the
+    // caller left there. It must be zero before the triangular multiply reads
+    // invA as a general matrix.
+    template <int DIM_X, int DIM_Y, typename T>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_zero_strictly_lower_kernel(rocblas_int    n,
+                                       T*             invA,
+                                       rocblas_int    ldinvA,
+                                       rocblas_stride stride_inva)
+    {
+        const int64_t tx = int64_t(blockIdx.x) * DIM_X + threadIdx.x;
+        const int64_t ty = int64_t(blockIdx.y) * DIM_Y + threadIdx.y;
+        if(tx >= n || ty >= n || tx <= ty)
+            return;
+
+        T* A                = invA + blockIdx.z * stride_inva;
+        A[tx + ty * ldinvA] = T(0);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_lu_inverse_launcher(rocblas_handle handle,
+                                               rocblas_int    n,
+                                               const T*       A,
+                                               rocblas_int    lda,
+                                               rocblas_stride stride_a,
+                                               T*             invA,
+                                               rocblas_int    ldinvA,
+                                               rocblas_stride stride_inva,
+                                               rocblas_int    batch_count)
+    {
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 8;
+
+        // [0] holds inv(L) (n x n per batch), [1] is the trtri scratch
+        size_t w_inv_bytes   = size_t(n) * n * batch_count * sizeof(T);
+        size_t w_trtri_bytes = rocblas_internal_trtri_temp_elements(n, batch_count) * sizeof(T);
+
+        auto w_mem = handle->device_malloc(w_inv_bytes, w_trtri_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        T* w_L   = (T*)w_mem[0];
+        T* w_tmp = (T*)w_mem[1];
+
+        // Stage 1: invA = inv(U) from the upper triangle of the LU factors
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_trtri_template<T>(handle,
+                                                                   rocblas_fill_upper,
+                                                                   rocblas_diagonal_non_unit,
+                                                                   n,
+                                                                   A,
+                                                                   0,
+                                                                   lda,
+                                                                   stride_a,
+                                                                   0,
+                                                                   invA,
+                                                                   0,
+                                                                   ldinvA,
+                                                                   stride_inva,
+                                                                   0,
+                                                                   batch_count,
+                                                                   1,
+                                                                   w_tmp));
+
+        // Stage 2: w_L = inv(L) from the unit lower triangle, kept on device
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_trtri_template<T>(handle,
+                                                                   rocblas_fill_lower,
+                                                                   rocblas_diagonal_unit,
+                                                                   n,
+                                                                   A,
+                                                                   0,
+                                                                   lda,
+                                                                   stride_a,
+                                                                   0,
+                                                                   w_L,
+                                                                   0,
+                                                                   n,
+                                                                   rocblas_stride(n) * n,
+                                                                   0,
+                                                                   batch_count,
+                                                                   1,
+                                                                   w_tmp));
+
+        // Stage 3: clear the strictly lower part of invA so it is exactly
+        // inv(U) when trmm reads it as a general matrix. grid.z is limited to
+        // 65535, so very large batches take a few launches.
+        for(rocblas_int b0 = 0; b0 < batch_count; b0 += 65535)
+        {
+            rocblas_int batches = std::min(batch_count - b0, 65535);
+
+            dim3 grid((n - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1, batches);
+            dim3 threads(DIM_X, DIM_Y);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_zero_strictly_lower_kernel<DIM_X, DIM_Y, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  invA + rocblas_stride(b0) * stride_inva,
+                                  ldinvA,
+                                  stride_inva);
+        }
+
+        // Stage 4: invA = inv(U) * inv(L), in place. diag is unit so trmm
+        // reads only the strictly lower part of w_L and its garbage upper
+        // triangle is never touched.
+        const T one(1);
+        return rocblas_internal_trmm_template<T>(handle,
+                                                 rocblas_side_right,
+                                                 rocblas_fill_lower,
+                                                 rocblas_operation_none,
+                                                 rocblas_diagonal_unit,
+                                                 n,
+                                                 n,
+                                                 &one,
+                                                 0,
+                                                 w_L,
+                                                 0,
+                                                 n,
+                                                 rocblas_stride(n) * n,
+                                                 invA,
+                                                 0,
+                                                 ldinvA,
+                                                 stride_inva,
+                                                 invA,
+                                                 0,
+                                                 ldinvA,
+                                                 stride_inva,
+                                                 batch_count);
+    }
+
+    rocblas_status rocblas_lu_inverse_impl(rocblas_handle   handle,
+                                           rocblas_int      n,
+                                           const void*      A,
+                                           rocblas_int      lda,
+                                           rocblas_stride   stride_a,
+                                           void*            invA,
+                                           rocblas_int      ldinvA,
+                                           rocblas_stride   stride_inva,
+                                           rocblas_int      batch_count,
+                                           rocblas_datatype type)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(type != rocblas_datatype_f32_r && type != rocblas_datatype_f64_r
+           && type != rocblas_datatype_f32_c && type != rocblas_datatype_f64_c)
+            return rocblas_status_not_implemented;
+
+        size_t elem_size = rocblas_sizeof_datatype(type);
+
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(
+                size_t(n) * n * batch_count * elem_size,
+                rocblas_internal_trtri_temp_elements(n, batch_count) * elem_size);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_lu_inverse_strided_batched",
+                      n,
+                      A,
+                      lda,
+                      stride_a,
+                      invA,
+                      ldinvA,
+                      stride_inva,
+                      batch_count,
+                      rocblas_datatype_string(type));
+
+        if(n < 0 || lda < n || lda < 1 || ldinvA < n || ldinvA < 1 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!A || !invA)
+            return rocblas_status_invalid_pointer;
+
+        // All four stages run in host pointer mode; the only scalar is a
+        // host-side one for the triangular multiply
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        switch(type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_lu_inverse_launcher<float>(handle,
+                                                      n,
+                                                      (const float*)A,
+                                                      lda,
+                                                      stride_a,
+                                                      (float*)invA,
+                                                      ldinvA,
+                                                      stride_inva,
+                                                      batch_count);
+        case rocblas_datatype_f64_r:
+            return rocblas_lu_inverse_launcher<double>(handle,
+                                                       n,
+                                                       (const double*)A,
+                                                       lda,
+                                                       stride_a,
+                                                       (double*)invA,
+                                                       ldinvA,
+                                                       stride_inva,
+                                                       batch_count);
+        case rocblas_datatype_f32_c:
+            return rocblas_lu_inverse_launcher<rocblas_float_complex>(
+                handle,
+                n,
+                (const rocblas_float_complex*)A,
+                lda,
+                stride_a,
+                (rocblas_float_complex*)invA,
+                ldinvA,
+                stride_inva,
+                batch_count);
+        case rocblas_datatype_f64_c:
+            return rocblas_lu_inverse_launcher<rocblas_double_complex>(
+                handle,
+                n,
+                (const rocblas_double_complex*)A,
+                lda,
+                stride_a,
+                (rocblas_double_complex*)invA,
+                ldinvA,
+                stride_inva,
+                batch_count);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+}
+
+extern "C" rocblas_status rocblas_lu_inverse_strided_batched(rocblas_handle   handle,
+                                                             rocblas_int      n,
+                                                             const void*      A,
+                                                             rocblas_int      lda,
+                                                             rocblas_stride   stride_a,
+                                                             void*            invA,
+                                                             rocblas_int      ldinvA,
+                                                             rocblas_stride   stride_inva,
+                                                             rocblas_int      batch_count,
+                                                             rocblas_datatype type)
+try
+{
+    return rocblas_lu_inverse_impl(
+        handle, n, A, lda, stride_a, invA, ldinvA, stride_inva, batch_count, type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
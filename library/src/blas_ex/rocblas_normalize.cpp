@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Fused normalize: x = x / ||x||_2 per vector. Separate nrm2 + scal calls
+// read each vector twice and synchronize in between to fetch the norm to the
+// host; here the norm stays on the device, the scaling stage reads it there,
+// and no synchronization is needed.
+
+#include "../blas1/rocblas_dot_kernels.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_normalize_name[] = "unknown";
+    template <>
+    constexpr char rocblas_normalize_name<float>[] = "rocblas_snormalize";
+    template <>
+    constexpr char rocblas_normalize_name<double>[] = "rocblas_dnormalize";
+
+    template <typename>
+    constexpr char rocblas_normalize_sb_name[] = "unknown";
+    template <>
+    constexpr char rocblas_normalize_sb_name<float>[] = "rocblas_snormalize_strided_batched";
+    template <>
+    constexpr char rocblas_normalize_sb_name<double>[] = "rocblas_dnormalize_strided_batched";
+
+    // Pass one: per-block partial sums of squares, reduced with the same
+    // two-kernel scheme as dot. The squared norms land in device memory
+    // where the scaling stage reads them.
+    template <int NB, int WIN, typename T, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_normalize_ssq_kernel(rocblas_int n,
+                                 const T* __restrict__ xa,
+                                 rocblas_stride shiftx,
+                                 rocblas_int    incx,
+                                 rocblas_stride stridex,
+                                 V* __restrict__ workspace,
+                                 V* __restrict__ out)
+    {
+        const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+
+        int i   = blockIdx.x * blockDim.x + threadIdx.x;
+        int inc = blockDim.x * gridDim.x;
+
+        V sum = 0;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            V v = V(x[i * int64_t(incx)]);
+            sum += v * v;
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+
+        rocblas_dot_save_sum<false>(sum, workspace, out);
+    }
+
+    // Pass two: scale by the reciprocal norm read from device memory. A
+    // zero vector has no direction and is left unchanged.
+    template <int NB, typename T, typename V>
+    ROCBLAS_KERNEL(NB)
+    rocblas_normalize_scal_kernel(rocblas_int n,
+                                  T* __restrict__ xa,
+                                  rocblas_stride shiftx,
+                                  rocblas_int    incx,
+                                  rocblas_stride stridex,
+                                  const V* __restrict__ ssq)
+    {
+        V s = ssq[blockIdx.y];
+        if(s <= V(0))
+            return;
+
+        auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+
+        V scale = V(1) / sqrt(s);
+
+        uint32_t i = blockIdx.x * NB + threadIdx.x;
+        if(i < n)
+            x[i * int64_t(incx)] = T(V(x[i * int64_t(incx)]) * scale);
+    }
+
+    template <int NB, typename T>
+    rocblas_status rocblas_internal_normalize_launcher(rocblas_handle handle,
+                                                       rocblas_int    n,
+                                                       T*             x,
+                                                       rocblas_stride offsetx,
+                                                       rocblas_int    incx,
+                                                       rocblas_stride stridex,
+                                                       rocblas_int    batch_count,
+                                                       T* __restrict__ workspace)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        int64_t shiftx = incx < 0 ? offsetx - int64_t(incx) * (n - 1) : offsetx;
+
+        rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        dim3        grid(blocks, batch_count);
+        dim3        threads(NB);
+
+        // squared norms live past the partial sums in the workspace
+        T* ssq = workspace + size_t(batch_count) * blocks;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_normalize_ssq_kernel<NB, WIN, T, T>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              x,
+                              shiftx,
+                              incx,
+                              stridex,
+                              workspace,
+                              ssq);
+
+        if(blocks > 1) // if single block first kernel did all work
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
+                                  dim3(1, batch_count),
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  nullptr,
+                                  blocks,
+                                  workspace,
+                                  ssq);
+
+        rocblas_int scal_blocks = (n - 1) / NB + 1;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_normalize_scal_kernel<NB, T, T>),
+                              dim3(scal_blocks, batch_count),
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              x,
+                              shiftx,
+                              incx,
+                              stridex,
+                              (const T*)ssq);
+
+        return rocblas_status_success;
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_normalize_impl(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          T*             x,
+                                          rocblas_int    incx,
+                                          rocblas_stride stridex,
+                                          rocblas_int    batch_count,
+                                          const char*    name,
+                                          const char*    bench_name)
+    {
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                                   ROCBLAS_DOT_NB * WIN,
+                                                                   T>(n, batch_count);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || incx <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, name, n, x, incx, batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f ",
+                      bench_name,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      "--incx",
+                      incx,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, name, "N", n, "incx", incx, "batch_count", batch_count);
+
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        // Quick return if possible; like scal, non-positive increments are a no-op.
+        if(n <= 0 || incx <= 0 || batch_count == 0)
+            return rocblas_status_success;
+
+        if(!x)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_internal_normalize_launcher<ROCBLAS_DOT_NB>(
+            handle, n, x, 0, incx, stridex, batch_count, (T*)w_mem);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_snormalize(rocblas_handle handle, rocblas_int n, float* x, rocblas_int incx)
+try
+{
+    return rocblas_normalize_impl(
+        handle, n, x, incx, 0, 1, rocblas_normalize_name<float>, "normalize");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dnormalize(rocblas_handle handle, rocblas_int n, double* x, rocblas_int incx)
+try
+{
+    return rocblas_normalize_impl(
+        handle, n, x, incx, 0, 1, rocblas_normalize_name<double>, "normalize");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_snormalize_strided_batched(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  float*         x,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stridex,
+                                                  rocblas_int    batch_count)
+try
+{
+    return rocblas_normalize_impl(handle,
+                                  n,
+                                  x,
+                                  incx,
+                                  stridex,
+                                  batch_count,
+                                  rocblas_normalize_sb_name<float>,
+                                  "normalize_strided_batched");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dnormalize_strided_batched(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  double*        x,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stridex,
+                                                  rocblas_int    batch_count)
+try
+{
+    return rocblas_normalize_impl(handle,
+                                  n,
+                                  x,
+                                  incx,
+                                  stridex,
+                                  batch_count,
+                                  rocblas_normalize_sb_name<double>,
+                                  "normalize_strided_batched");
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
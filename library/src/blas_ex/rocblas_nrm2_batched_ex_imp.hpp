@@ -142,7 +142,7 @@ namespace
             return rocblas_status_invalid_pointer;
         }
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
         {
             return rocblas_status_memory_error;
@@ -44,7 +44,7 @@ rocblas_status rocblas_nrm2_ex_typecasting(rocblas_handle handle,
                                            void*          results,
                                            void*          workspace)
 {
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
     rocblas_status status         = rocblas_status_success;
     if(ISBATCHED)
     {
@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+#ifdef BUILD_WITH_TENSILE
+#include "tensile_host.hpp"
+#endif
+
+namespace
+{
+#ifdef BUILD_WITH_TENSILE
+    template <typename Ti, typename To = Ti, typename Tc = To>
+    rocblas_status gemm_preload_typecasting(rocblas_handle    handle,
+                                            rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k)
+    {
+        // Host scalars so that problem construction can classify alpha/beta;
+        // generic values match the restrictions of typical calls
+        const Tc alpha = Tc(1);
+        const Tc beta  = Tc(0);
+
+        // Minimal legal leading dimensions; only the shape matters for
+        // selecting which code objects to load
+        const rocblas_int lda = std::max(1, trans_a == rocblas_operation_none ? m : k);
+        const rocblas_int ldb = std::max(1, trans_b == rocblas_operation_none ? k : n);
+        const rocblas_int ldc = std::max(1, m);
+
+        RocblasContractionProblem<Ti, To, Tc> problem{handle,
+                                                      trans_a,
+                                                      trans_b,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      &alpha,
+                                                      nullptr,
+                                                      nullptr,
+                                                      lda,
+                                                      rocblas_stride(lda)
+                                                          * (trans_a == rocblas_operation_none
+                                                                 ? k
+                                                                 : m),
+                                                      0,
+                                                      nullptr,
+                                                      nullptr,
+                                                      ldb,
+                                                      rocblas_stride(ldb)
+                                                          * (trans_b == rocblas_operation_none
+                                                                 ? n
+                                                                 : k),
+                                                      0,
+                                                      &beta,
+                                                      nullptr,
+                                                      nullptr,
+                                                      ldc,
+                                                      rocblas_stride(ldc) * n,
+                                                      0,
+                                                      nullptr,
+                                                      nullptr,
+                                                      ldc,
+                                                      rocblas_stride(ldc) * n,
+                                                      0,
+                                                      1,
+                                                      true,
+                                                      rocblas_gemm_flags_none};
+
+        return preloadContractionProblem(problem);
+    }
+#endif
+
+    rocblas_status rocblas_preload_gemm_impl(rocblas_handle    handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             rocblas_datatype  a_type,
+                                             rocblas_datatype  b_type,
+                                             rocblas_datatype  c_type,
+                                             rocblas_datatype  d_type,
+                                             rocblas_datatype  compute_type)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_preload_gemm",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      rocblas_datatype_string(a_type),
+                      rocblas_datatype_string(b_type),
+                      rocblas_datatype_string(c_type),
+                      rocblas_datatype_string(d_type),
+                      rocblas_datatype_string(compute_type));
+
+        if(m < 0 || n < 0 || k < 0)
+            return rocblas_status_invalid_size;
+        if(!m || !n)
+            return rocblas_status_success;
+
+#ifdef BUILD_WITH_TENSILE
+        rocblas_status rb_status = rocblas_status_not_implemented;
+
+#define PRELOAD_TYPECASTING_PARM handle, trans_a, trans_b, m, n, k
+
+        if(a_type == rocblas_datatype_f64_r && b_type == rocblas_datatype_f64_r
+           && c_type == rocblas_datatype_f64_r && d_type == rocblas_datatype_f64_r
+           && compute_type == rocblas_datatype_f64_r)
+        {
+            rb_status = gemm_preload_typecasting<double>(PRELOAD_TYPECASTING_PARM);
+        }
+        else if(a_type == rocblas_datatype_f32_r && b_type == rocblas_datatype_f32_r
+                && c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r
+                && compute_type == rocblas_datatype_f32_r)
+        {
+            rb_status = gemm_preload_typecasting<float>(PRELOAD_TYPECASTING_PARM);
+        }
+        else if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r)
+        {
+            if(c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r)
+            {
+                if(compute_type == rocblas_datatype_f16_r)
+                {
+                    rb_status = gemm_preload_typecasting<rocblas_half>(PRELOAD_TYPECASTING_PARM);
+                }
+                else if(compute_type == rocblas_datatype_f32_r)
+                {
+                    rb_status = gemm_preload_typecasting<rocblas_half, rocblas_half, float>(
+                        PRELOAD_TYPECASTING_PARM);
+                }
+            }
+            else if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r
+                    && compute_type == rocblas_datatype_f32_r)
+            {
+                rb_status = gemm_preload_typecasting<rocblas_half, float, float>(
+                    PRELOAD_TYPECASTING_PARM);
+            }
+        }
+        else if(a_type == rocblas_datatype_bf16_r && b_type == rocblas_datatype_bf16_r
+                && compute_type == rocblas_datatype_f32_r)
+        {
+            if(c_type == rocblas_datatype_bf16_r && d_type == rocblas_datatype_bf16_r)
+            {
+                rb_status = gemm_preload_typecasting<rocblas_bfloat16, rocblas_bfloat16, float>(
+                    PRELOAD_TYPECASTING_PARM);
+            }
+            else if(c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r)
+            {
+                rb_status = gemm_preload_typecasting<rocblas_bfloat16, float, float>(
+                    PRELOAD_TYPECASTING_PARM);
+            }
+        }
+        else if(a_type == rocblas_datatype_i8_r && b_type == rocblas_datatype_i8_r
+                && c_type == rocblas_datatype_i32_r && d_type == rocblas_datatype_i32_r
+                && compute_type == rocblas_datatype_i32_r)
+        {
+            rb_status = gemm_preload_typecasting<int8_t, int32_t>(PRELOAD_TYPECASTING_PARM);
+        }
+        else if(a_type == rocblas_datatype_f32_c && b_type == rocblas_datatype_f32_c
+                && c_type == rocblas_datatype_f32_c && d_type == rocblas_datatype_f32_c
+                && compute_type == rocblas_datatype_f32_c)
+        {
+            rb_status = gemm_preload_typecasting<rocblas_float_complex>(PRELOAD_TYPECASTING_PARM);
+        }
+        else if(a_type == rocblas_datatype_f64_c && b_type == rocblas_datatype_f64_c
+                && c_type == rocblas_datatype_f64_c && d_type == rocblas_datatype_f64_c
+                && compute_type == rocblas_datatype_f64_c)
+        {
+            rb_status = gemm_preload_typecasting<rocblas_double_complex>(PRELOAD_TYPECASTING_PARM);
+        }
+
+#undef PRELOAD_TYPECASTING_PARM
+
+        return rb_status;
+#else
+        // Source gemm kernels are compiled in; there is nothing to preload
+        return rocblas_status_success;
+#endif
+    }
+}
+// namespace
+
+extern "C" rocblas_status rocblas_preload_gemm(rocblas_handle    handle,
+                                               rocblas_operation trans_a,
+                                               rocblas_operation trans_b,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               rocblas_datatype  a_type,
+                                               rocblas_datatype  b_type,
+                                               rocblas_datatype  c_type,
+                                               rocblas_datatype  d_type,
+                                               rocblas_datatype  compute_type)
+try
+{
+    return rocblas_preload_gemm_impl(
+        handle, trans_a, trans_b, m, n, k, a_type, b_type, c_type, d_type, compute_type);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
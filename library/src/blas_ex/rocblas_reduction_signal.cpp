@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Stream-ordered completion signaling for device-pointer-mode reductions.
+// A dot or nrm2 call with rocblas_pointer_mode_device leaves its result in
+// device memory; learning on the host that the result is ready normally
+// costs a hipStreamSynchronize. reduction_signal instead enqueues a
+// single-thread kernel that writes 1 to a pinned host flag, so the flag
+// flips exactly when the preceding stream work has completed and the host
+// can poll it with one memory read.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    ROCBLAS_KERNEL(1)
+    rocblas_signal_flag_kernel(volatile rocblas_int* flag)
+    {
+        // runs only after all previously enqueued stream work has completed
+        *flag = 1;
+        __threadfence_system();
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_reduction_signal(rocblas_handle handle, rocblas_int* host_flag)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    auto layer_mode = handle->layer_mode;
+    if(layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_reduction_signal", (void*)host_flag);
+
+    if(!host_flag)
+        return rocblas_status_invalid_pointer;
+
+    // the flag must be pinned, device-mapped host memory so the device-side
+    // write below is host visible without any further synchronization
+    rocblas_int* device_flag = nullptr;
+    if(hipHostGetDevicePointer((void**)&device_flag, host_flag, 0) != hipSuccess)
+        return rocblas_status_invalid_pointer;
+
+    *(volatile rocblas_int*)host_flag = 0;
+
+    ROCBLAS_LAUNCH_KERNEL(
+        rocblas_signal_flag_kernel, dim3(1), dim3(1), 0, handle->get_stream(), device_flag);
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_reduction_poll(const rocblas_int* host_flag, bool* complete)
+try
+{
+    if(!host_flag || !complete)
+        return rocblas_status_invalid_pointer;
+
+    *complete = *(volatile const rocblas_int*)host_flag != 0;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -50,7 +50,7 @@ rocblas_status rocblas_rot_ex_typecasting(rocblas_handle handle,
     static constexpr rocblas_stride offset_0 = 0;
     static constexpr rocblas_stride stride_0 = 0;
 
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
     rocblas_status status         = rocblas_status_success;
 
     if(ISBATCHED)
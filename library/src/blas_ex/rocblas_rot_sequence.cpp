@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Fused Givens rotation sequence: applies rotations i = 0, ..., k-1 in
+// ascending order to the element pairs (x_i, x_i+1) of one vector. GMRES-style
+// solvers update the new Hessenberg column this way with k separate
+// rocblas_rot calls on single-element slices, paying k kernel launches for a
+// chain that touches k+1 values; here the whole chain runs in one launch with
+// each element read and written exactly once.
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_rot_sequence_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rot_sequence_name<float>[] = "rocblas_srot_sequence";
+    template <>
+    constexpr char rocblas_rot_sequence_name<double>[] = "rocblas_drot_sequence";
+
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_rot_sequence_kernel(rocblas_int k,
+                                T* __restrict__ x,
+                                rocblas_stride shiftx,
+                                rocblas_int    incx,
+                                const T* __restrict__ c,
+                                const T* __restrict__ s)
+    {
+        // Each rotation chains through the element it shares with the next
+        // one, so a single lane sweeps the vector carrying the updated
+        // shared element forward in a register.
+        if(threadIdx.x != 0)
+            return;
+
+        x += shiftx;
+
+        T xi = x[0];
+        for(rocblas_int i = 0; i < k; i++)
+        {
+            T xi1                = x[(i + 1) * int64_t(incx)];
+            x[i * int64_t(incx)] = c[i] * xi + s[i] * xi1;
+            xi                   = c[i] * xi1 - s[i] * xi;
+        }
+        x[k * int64_t(incx)] = xi;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_rot_sequence_impl(rocblas_handle handle,
+                                             rocblas_int    k,
+                                             T*             x,
+                                             rocblas_int    incx,
+                                             const T*       c,
+                                             const T*       s)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_rot_sequence_name<T>, k, x, incx, c, s);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f rot_sequence -r",
+                      rocblas_precision_string<T>,
+                      "-k",
+                      k,
+                      "--incx",
+                      incx);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_rot_sequence_name<T>, "K", k, "incx", incx);
+
+        if(k < 0)
+            return rocblas_status_invalid_size;
+        if(!k)
+            return rocblas_status_success;
+
+        if(!x || !c || !s)
+            return rocblas_status_invalid_pointer;
+
+        static constexpr int NB = 64;
+
+        // in case of negative inc shift pointer to end of data for negative
+        // indexing; the vector spans k + 1 elements
+        rocblas_stride shiftx = incx < 0 ? -int64_t(incx) * k : 0;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_rot_sequence_kernel<NB, T>),
+                              dim3(1),
+                              dim3(NB),
+                              0,
+                              handle->get_stream(),
+                              k,
+                              x,
+                              shiftx,
+                              incx,
+                              c,
+                              s);
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_srot_sequence(rocblas_handle handle,
+                                     rocblas_int    k,
+                                     float*         x,
+                                     rocblas_int    incx,
+                                     const float*   c,
+                                     const float*   s)
+try
+{
+    return rocblas_rot_sequence_impl(handle, k, x, incx, c, s);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_drot_sequence(rocblas_handle handle,
+                                     rocblas_int    k,
+                                     double*        x,
+                                     rocblas_int    incx,
+                                     const double*  c,
+                                     const double*  s)
+try
+{
+    return rocblas_rot_sequence_impl(handle, k, x, incx, c, s);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,247 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Fused batched Givens generation and application: for each batch the
+// rotation is constructed from (a_i, b_i) as in rotg_batched and immediately
+// applied to the vector pair (x_i, y_i) as in rot_batched. Batched
+// least-squares updates otherwise pay two launches and a global-memory
+// round-trip of c and s between them; here each batch is one block, the
+// rotation parameters stay in shared memory, and a, b, c, s are written back
+// as a side effect.
+
+#include "../blas1/rocblas_rotg_kernels.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_rotg_rot_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rotg_rot_batched_name<float>[] = "rocblas_srotg_rot_batched";
+    template <>
+    constexpr char rocblas_rotg_rot_batched_name<double>[] = "rocblas_drotg_rot_batched";
+
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_rotg_rot_batched_kernel(rocblas_int n,
+                                    T* const*   a,
+                                    T* const*   b,
+                                    T* const*   c,
+                                    T* const*   s,
+                                    T* const*   x,
+                                    rocblas_int incx,
+                                    rocblas_stride shiftx,
+                                    T* const*   y,
+                                    rocblas_int incy,
+                                    rocblas_stride shifty)
+    {
+        // One block per batch so the rotation generated below is visible to
+        // every thread that applies it without leaving the block.
+        uint32_t bid = blockIdx.x;
+
+        __shared__ T c_sh;
+        __shared__ T s_sh;
+
+        if(threadIdx.x == 0)
+        {
+            T av = *a[bid];
+            T bv = *b[bid];
+            T cv, sv;
+            rocblas_rotg_calc(av, bv, cv, sv);
+            *a[bid] = av;
+            *b[bid] = bv;
+            *c[bid] = cv;
+            *s[bid] = sv;
+            c_sh    = cv;
+            s_sh    = sv;
+        }
+        __syncthreads();
+
+        // n == 0 still generates a, b, c, s but has no vectors to touch
+        if(n <= 0)
+            return;
+
+        T cv = c_sh;
+        T sv = s_sh;
+
+        T* xb = x[bid] + shiftx;
+        T* yb = y[bid] + shifty;
+
+        for(int64_t tid = threadIdx.x; tid < n; tid += NB)
+        {
+            int64_t ix    = tid * incx;
+            int64_t iy    = tid * incy;
+            T       tempx = cv * xb[ix] + sv * yb[iy];
+            T       tempy = cv * yb[iy] - sv * xb[ix];
+            xb[ix]        = tempx;
+            yb[iy]        = tempy;
+        }
+    }
+
+    template <typename T>
+    rocblas_status rocblas_rotg_rot_batched_impl(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 T* const       a[],
+                                                 T* const       b[],
+                                                 T* const       c[],
+                                                 T* const       s[],
+                                                 T* const       x[],
+                                                 rocblas_int    incx,
+                                                 T* const       y[],
+                                                 rocblas_int    incy,
+                                                 rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_rotg_rot_batched_name<T>,
+                      n,
+                      a,
+                      b,
+                      c,
+                      s,
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      ROCBLAS_API_BENCH " -f rotg_rot_batched -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy,
+                      "--batch_count",
+                      batch_count);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_rotg_rot_batched_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "batch_count",
+                        batch_count);
+
+        if(n < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!batch_count)
+            return rocblas_status_success;
+
+        // a, b, c, s are still generated when n == 0, so only the vectors may
+        // be absent in that case.
+        if(!a || !b || !c || !s || (n > 0 && (!x || !y)))
+            return rocblas_status_invalid_pointer;
+
+        static constexpr int NB = 256;
+
+        // in case of negative inc shift pointer to end of data for negative indexing
+        rocblas_stride shiftx = incx < 0 ? int64_t(incx) * (1 - n) : 0;
+        rocblas_stride shifty = incy < 0 ? int64_t(incy) * (1 - n) : 0;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_rotg_rot_batched_kernel<NB, T>),
+                              dim3(batch_count),
+                              dim3(NB),
+                              0,
+                              handle->get_stream(),
+                              n,
+                              a,
+                              b,
+                              c,
+                              s,
+                              x,
+                              incx,
+                              shiftx,
+                              y,
+                              incy,
+                              shifty);
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_srotg_rot_batched(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         float* const   a[],
+                                         float* const   b[],
+                                         float* const   c[],
+                                         float* const   s[],
+                                         float* const   x[],
+                                         rocblas_int    incx,
+                                         float* const   y[],
+                                         rocblas_int    incy,
+                                         rocblas_int    batch_count)
+try
+{
+    return rocblas_rotg_rot_batched_impl(handle, n, a, b, c, s, x, incx, y, incy, batch_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_drotg_rot_batched(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         double* const  a[],
+                                         double* const  b[],
+                                         double* const  c[],
+                                         double* const  s[],
+                                         double* const  x[],
+                                         rocblas_int    incx,
+                                         double* const  y[],
+                                         rocblas_int    incy,
+                                         rocblas_int    batch_count)
+try
+{
+    return rocblas_rotg_rot_batched_impl(handle, n, a, b, c, s, x, incx, y, incy, batch_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
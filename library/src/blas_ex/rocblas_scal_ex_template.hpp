@@ -53,7 +53,7 @@ rocblas_status rocblas_scal_ex_typecasting(rocblas_handle handle,
     if(!x)
         return rocblas_status_invalid_pointer;
 
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_blas1);
     rocblas_status status         = rocblas_status_success;
 
     if(BATCHED)
@@ -184,6 +184,102 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m_64 || !n_64 || !batch_count_64 || !A)
         return rocblas_status_success;
 
+    //Quick return: this call was not selected by the 1-in-N call sampling
+    if(!handle->check_numerics_sample_call(is_input))
+        return rocblas_status_success;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    //Checking trans_a to transpose a matrix 'A'
+    int64_t rows_64 = trans_a == rocblas_operation_none ? m_64 : n_64;
+    int64_t cols_64 = trans_a == rocblas_operation_none ? n_64 : m_64;
+
+    //Column sampling: check every sample_stride-th column of a general matrix
+    //by widening the leading dimension. The sym/herm/tri kernel bounds rows
+    //and columns against each other, so those matrices are checked in full.
+    int64_t sample_stride = handle->check_numerics_stride;
+    if(sample_stride > 1 && matrix_type == rocblas_client_general_matrix)
+    {
+        cols_64 = (cols_64 - 1) / sample_stride + 1;
+        lda *= sample_stride;
+    }
+
+    auto launch_checks = [&](rocblas_check_numerics_t* d_abnormal_ptr) {
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        {
+            auto    a_ptr       = adjust_ptr_batch(A, b_base, stride_a);
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+            for(int64_t n_base = 0; n_base < cols_64; n_base += c_i64_grid_YZ_chunk)
+            {
+                int32_t n = int32_t(std::min(cols_64 - n_base, c_i64_grid_YZ_chunk));
+
+                rocblas_stride col_offset = offset_a + n_base * lda;
+
+                for(int64_t m_base = 0; m_base < rows_64; m_base += c_i64_grid_X_chunk)
+                {
+                    int32_t m = int32_t(std::min(rows_64 - m_base, c_i64_grid_X_chunk));
+
+                    rocblas_stride shift_a = col_offset + m_base;
+
+                    static constexpr int DIM_X    = 16;
+                    static constexpr int DIM_Y    = 16;
+                    rocblas_int          blocks_X = (m - 1) / DIM_X + 1;
+                    rocblas_int          blocks_Y = (n - 1) / DIM_Y + 1;
+
+                    dim3 blocks(blocks_X, blocks_Y, batch_count);
+                    dim3 threads(DIM_X, DIM_Y);
+
+                    if(matrix_type == rocblas_client_general_matrix)
+                    {
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_check_numerics_ge_matrix_kernel<DIM_X, DIM_Y>),
+                            blocks,
+                            threads,
+                            0,
+                            rocblas_stream,
+                            m,
+                            n,
+                            a_ptr,
+                            shift_a,
+                            lda,
+                            stride_a,
+                            d_abnormal_ptr);
+                    }
+                    else if(matrix_type == rocblas_client_symmetric_matrix
+                            || matrix_type == rocblas_client_hermitian_matrix
+                            || matrix_type == rocblas_client_triangular_matrix)
+                    {
+                        ROCBLAS_LAUNCH_KERNEL(
+                            (rocblas_check_numerics_sym_herm_tri_matrix_kernel<DIM_X, DIM_Y>),
+                            blocks,
+                            threads,
+                            0,
+                            rocblas_stream,
+                            uplo == rocblas_fill_upper,
+                            n,
+                            a_ptr,
+                            shift_a,
+                            lda,
+                            stride_a,
+                            d_abnormal_ptr);
+                    }
+                }
+            }
+        }
+    };
+
+    //Async mode accumulates into the handle's persistent flag block with no
+    //per-call copy-back or synchronization; poll rocblas_get_numerics_status
+    if(check_numerics & rocblas_check_numerics_mode_async)
+    {
+        rocblas_check_numerics_t* d_flags = handle->get_numerics_flags_device();
+        if(!d_flags)
+            return rocblas_status_memory_error;
+        launch_checks(d_flags);
+        return rocblas_status_success;
+    }
+
     //Creating structure host object
     rocblas_check_numerics_t h_abnormal;
 
@@ -199,8 +295,6 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_memory_error;
     }
 
-    hipStream_t rocblas_stream = handle->get_stream();
-
     //Transferring the rocblas_check_numerics_t structure from host to the device
     RETURN_IF_HIP_ERROR(hipMemcpyAsync((rocblas_check_numerics_t*)d_abnormal,
                                        &h_abnormal,
@@ -208,71 +302,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                        hipMemcpyHostToDevice,
                                        rocblas_stream));
 
-    //Checking trans_a to transpose a matrix 'A'
-    int64_t rows_64 = trans_a == rocblas_operation_none ? m_64 : n_64;
-    int64_t cols_64 = trans_a == rocblas_operation_none ? n_64 : m_64;
-
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-    {
-        auto    a_ptr       = adjust_ptr_batch(A, b_base, stride_a);
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-        for(int64_t n_base = 0; n_base < cols_64; n_base += c_i64_grid_YZ_chunk)
-        {
-            int32_t n = int32_t(std::min(cols_64 - n_base, c_i64_grid_YZ_chunk));
-
-            rocblas_stride col_offset = offset_a + n_base * lda;
-
-            for(int64_t m_base = 0; m_base < rows_64; m_base += c_i64_grid_X_chunk)
-            {
-                int32_t m = int32_t(std::min(rows_64 - m_base, c_i64_grid_X_chunk));
-
-                rocblas_stride shift_a = col_offset + m_base;
-
-                static constexpr int DIM_X    = 16;
-                static constexpr int DIM_Y    = 16;
-                rocblas_int          blocks_X = (m - 1) / DIM_X + 1;
-                rocblas_int          blocks_Y = (n - 1) / DIM_Y + 1;
-
-                dim3 blocks(blocks_X, blocks_Y, batch_count);
-                dim3 threads(DIM_X, DIM_Y);
-
-                if(matrix_type == rocblas_client_general_matrix)
-                {
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_check_numerics_ge_matrix_kernel<DIM_X, DIM_Y>),
-                                          blocks,
-                                          threads,
-                                          0,
-                                          rocblas_stream,
-                                          m,
-                                          n,
-                                          a_ptr,
-                                          shift_a,
-                                          lda,
-                                          stride_a,
-                                          (rocblas_check_numerics_t*)d_abnormal);
-                }
-                else if(matrix_type == rocblas_client_symmetric_matrix
-                        || matrix_type == rocblas_client_hermitian_matrix
-                        || matrix_type == rocblas_client_triangular_matrix)
-                {
-                    ROCBLAS_LAUNCH_KERNEL(
-                        (rocblas_check_numerics_sym_herm_tri_matrix_kernel<DIM_X, DIM_Y>),
-                        blocks,
-                        threads,
-                        0,
-                        rocblas_stream,
-                        uplo == rocblas_fill_upper,
-                        n,
-                        a_ptr,
-                        shift_a,
-                        lda,
-                        stride_a,
-                        (rocblas_check_numerics_t*)d_abnormal);
-                }
-            }
-        }
-    }
+    launch_checks((rocblas_check_numerics_t*)d_abnormal);
 
     //Transferring the rocblas_check_numerics_t structure from device to the host
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_abnormal,
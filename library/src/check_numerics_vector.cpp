@@ -183,12 +183,69 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
+    //Quick return: this call was not selected by the 1-in-N call sampling
+    if(!handle->check_numerics_sample_call(is_input))
+    {
+        return rocblas_status_success;
+    }
+
+    constexpr rocblas_int NB = 256;
+
+    size_t abs_inc = inc_x < 0 ? -inc_x : inc_x;
+
+    //Element sampling: check every sample_stride-th element of the vector
+    int64_t sample_stride = handle->check_numerics_stride;
+    if(sample_stride > 1)
+    {
+        n_64 = (n_64 - 1) / sample_stride + 1;
+        abs_inc *= sample_stride;
+    }
+
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    auto launch_checks = [&](rocblas_check_numerics_t* d_abnormal_ptr) {
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        {
+            auto    x_ptr       = adjust_ptr_batch(x, b_base, stride_x);
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
+            {
+                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
+
+                dim3 blocks((n - 1) / NB + 1, batch_count);
+                dim3 threads(NB);
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_check_numerics_vector_kernel<NB>),
+                                      blocks,
+                                      threads,
+                                      0,
+                                      rocblas_stream,
+                                      n,
+                                      x_ptr,
+                                      offset_x + abs_inc * n_base,
+                                      abs_inc,
+                                      stride_x,
+                                      d_abnormal_ptr);
+            }
+        }
+    };
+
+    //Async mode accumulates into the handle's persistent flag block with no
+    //per-call copy-back or synchronization; poll rocblas_get_numerics_status
+    if(check_numerics & rocblas_check_numerics_mode_async)
+    {
+        rocblas_check_numerics_t* d_flags = handle->get_numerics_flags_device();
+        if(!d_flags)
+            return rocblas_status_memory_error;
+        launch_checks(d_flags);
+        return rocblas_status_success;
+    }
+
     //Creating structure host object
     rocblas_check_numerics_t h_abnormal;
 
     //Allocating memory for device structure
-    auto        d_abnormal     = handle->device_malloc(sizeof(rocblas_check_numerics_t));
-    hipStream_t rocblas_stream = handle->get_stream();
+    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
     if(!d_abnormal)
     {
         rocblas_cerr << "rocBLAS internal error: No workspace memory available to allocate the "
@@ -204,34 +261,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                        sizeof(rocblas_check_numerics_t),
                                        hipMemcpyHostToDevice,
                                        rocblas_stream));
-    constexpr rocblas_int NB = 256;
-
-    size_t abs_inc = inc_x < 0 ? -inc_x : inc_x;
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-    {
-        auto    x_ptr       = adjust_ptr_batch(x, b_base, stride_x);
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-        for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
-        {
-            int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-            dim3 blocks((n - 1) / NB + 1, batch_count);
-            dim3 threads(NB);
-
-            ROCBLAS_LAUNCH_KERNEL((rocblas_check_numerics_vector_kernel<NB>),
-                                  blocks,
-                                  threads,
-                                  0,
-                                  rocblas_stream,
-                                  n,
-                                  x_ptr,
-                                  offset_x + abs_inc * n_base,
-                                  abs_inc,
-                                  stride_x,
-                                  (rocblas_check_numerics_t*)d_abnormal);
-        }
-    }
+    launch_checks((rocblas_check_numerics_t*)d_abnormal);
 
     //Transferring the rocblas_check_numerics_t structure from device to the host
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_abnormal,
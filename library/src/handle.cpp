@@ -20,8 +20,15 @@
  *
  * ************************************************************************ */
 #include "handle.hpp"
+#include "blas3/rocblas_gemm_persistent.hpp"
+#include "tuning.hpp"
+#include <condition_variable>
 #include <cstdarg>
+#include <deque>
 #include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
 
 #ifdef WIN32
 #include <windows.h>
@@ -157,6 +164,50 @@ static Processor getActiveArch(int deviceId)
     return static_cast<Processor>(0);
 }
 
+/*******************************************************************************
+ * Configure the device's default memory pool for stream-ordered allocation.
+ * Raising the release threshold keeps freed blocks inside the pool instead of
+ * returning them to the OS after each synchronize, and the reuse attributes
+ * let blocks freed on one stream satisfy allocations on another, so bursty
+ * alloc/free churn never goes back to the driver allocator.
+ ******************************************************************************/
+rocblas_status _rocblas_handle::configure_stream_order_pool()
+{
+// hipMemPool attributes are available alongside hipMallocAsync/hipFreeAsync
+#if HIP_VERSION >= 50300000
+    hipMemPool_t mem_pool;
+    hipError_t   hipStatus = hipDeviceGetDefaultMemPool(&mem_pool, device);
+    if(hipStatus != hipSuccess)
+        return rocblas_internal_convert_hip_to_rocblas_status(hipStatus);
+
+    // Hold everything by default; ROCBLAS_STREAM_ORDER_RELEASE_THRESHOLD
+    // overrides with a byte count (0 restores the release-everything default)
+    uint64_t    release_threshold = UINT64_MAX;
+    const char* threshold_env     = read_env("ROCBLAS_STREAM_ORDER_RELEASE_THRESHOLD");
+    if(threshold_env)
+        release_threshold = strtoull(threshold_env, nullptr, 0);
+
+    hipStatus
+        = hipMemPoolSetAttribute(mem_pool, hipMemPoolAttrReleaseThreshold, &release_threshold);
+    if(hipStatus != hipSuccess)
+        return rocblas_internal_convert_hip_to_rocblas_status(hipStatus);
+
+    int enable = 1;
+    for(auto attr : {hipMemPoolReuseFollowEventDependencies,
+                     hipMemPoolReuseAllowOpportunistic,
+                     hipMemPoolReuseAllowInternalDependencies})
+    {
+        hipStatus = hipMemPoolSetAttribute(mem_pool, attr, &enable);
+        if(hipStatus != hipSuccess)
+            return rocblas_internal_convert_hip_to_rocblas_status(hipStatus);
+    }
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
@@ -167,6 +218,43 @@ _rocblas_handle::_rocblas_handle()
     archMajor      = arch / 100; // this may need to switch to string handling in the future
     archMajorMinor = arch / 10;
 
+    // FP8 (gemm_ex3) capability is a pure function of arch; decide it once
+    // here instead of per call on the FP8 hot paths
+    supports_fp8 = arch >= 940 && arch < 1000;
+
+    // queried once here; used for CU-aware grid sizing in the dispatchers
+    if(hipDeviceGetAttribute(&cuCount, hipDeviceAttributeMultiprocessorCount, device)
+       != hipSuccess)
+        cuCount = 0;
+
+    // Optional high/low-priority internal streams for the stage scheduler.
+    // Lower numeric values mean higher priority; skipped entirely when the
+    // device exposes no priority range or creation fails, in which case the
+    // scheduler uses its default stream pool.
+    int least_priority = 0, greatest_priority = 0;
+    if(hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority) == hipSuccess
+       && least_priority != greatest_priority)
+    {
+        if(hipStreamCreateWithPriority(
+               &priority_streams[0], hipStreamNonBlocking, greatest_priority)
+               != hipSuccess
+           || hipStreamCreateWithPriority(
+                  &priority_streams[1], hipStreamNonBlocking, least_priority)
+                  != hipSuccess)
+        {
+            for(auto& priority_stream : priority_streams)
+            {
+                if(priority_stream)
+                    (void)(hipStreamDestroy)(priority_stream);
+                priority_stream = nullptr;
+            }
+        }
+    }
+
+    // default stochastic-rounding base seed; rocblas_set_stochastic_seed
+    // overrides it for reproducible runs
+    sr_seed = std::random_device{}();
+
     //ROCBLAS_STREAM_ORDER_ALLOC
     const char* stream_order_alloc_env = read_env("ROCBLAS_STREAM_ORDER_ALLOC");
 
@@ -222,6 +310,10 @@ _rocblas_handle::_rocblas_handle()
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
+        // Configure the pool up front so the warm-up block below (and all
+        // later workspace churn) is retained by the pool
+        THROW_IF_ROCBLAS_ERROR(configure_stream_order_pool());
+
         // The following allocation & free of device memory using hipMallocAsync/hipFreeAsync will allocate memory from
         // the OS and release it to default memory pool. Further allocation of memory using hipMallocAsync
         // will be from the memory pool and it will be faster.
@@ -238,6 +330,15 @@ _rocblas_handle::_rocblas_handle()
 #endif
     }
 
+    // Reserve the blas1 reduction scratch for the life of the handle; on
+    // failure the handle is still usable and reduction_malloc falls back to
+    // device_malloc
+    if((hipMalloc)(&reduction_workspace, reduction_workspace_size) != hipSuccess)
+        reduction_workspace = nullptr;
+
+    // Load the out-of-band GEMM tuning table (parsed once per process)
+    tuning_table = rocblas_tuning_table::instance();
+
     // Initialize logging
     init_logging();
 
@@ -289,13 +390,69 @@ _rocblas_handle::~_rocblas_handle()
             << std::endl;
         rocblas_abort();
     }
+    // Release the async numeric-check flag block, if ever created
+    if(numerics_flags_device)
+        (void)(hipFree)(numerics_flags_device);
+
+    // Release the stream-k work-unit counter, if ever created
+    if(streamk_counter)
+        (void)(hipFree)(streamk_counter);
+
+    // Release the reserved blas1 reduction scratch
+    if(reduction_workspace)
+        (void)(hipFree)(reduction_workspace);
+
+    // Tear down the kernel-launch timeline ring, if ever enabled
+    if(kernel_timeline)
+        rocblas_internal_timeline_release(this);
+
+    // Shut down the persistent GEMM kernel, if ever started
+    if(gemm_persistent)
+    {
+        rocblas_gemm_persistent_stop(gemm_persistent);
+        delete gemm_persistent;
+    }
+
+    // Release the priority stream pair, if created
+    for(auto& priority_stream : priority_streams)
+        if(priority_stream)
+            (void)(hipStreamDestroy)(priority_stream);
+
+    // Release the internal ILP64 chunk pipeline resources, if ever created
+    for(auto& chunk_stream : chunk_streams)
+        if(chunk_stream)
+            (void)(hipStreamDestroy)(chunk_stream);
+    for(auto& chunk_event : chunk_events)
+        if(chunk_event)
+            (void)(hipEventDestroy)(chunk_event);
+
+    // Release the stage scheduler events, if ever created
+    for(auto& stage_event : stage_events)
+        if(stage_event)
+            (void)(hipEventDestroy)(stage_event);
+
+    // Release the pinned reduction-result staging resources, if ever created
+    if(pinned_result_buffer)
+        (void)(hipHostFree)(pinned_result_buffer);
+    if(pinned_result_event)
+        (void)(hipEventDestroy)(pinned_result_event);
+    if(mapped_result_buffer)
+        (void)(hipHostFree)(mapped_result_buffer);
+
     // Free device memory unless it's user-owned
     if(device_memory_owner != rocblas_device_memory_ownership::user_owned)
     {
         hipError_t hipStatus;
         if(!stream_order_alloc)
         {
-            hipStatus = (hipFree)(device_memory);
+            if(user_free_fn)
+            {
+                if(device_memory)
+                    user_free_fn(device_memory, device_memory_size, user_alloc_data);
+                hipStatus = hipSuccess;
+            }
+            else
+                hipStatus = (hipFree)(device_memory);
             if(hipStatus != hipSuccess)
             {
                 rocblas_cerr
@@ -350,6 +507,16 @@ _rocblas_handle::~_rocblas_handle()
         }
     }
 
+    // Retire parked per-stream workspace partitions; pool_trim below returns
+    // them to the system along with any other pooled blocks
+    for(auto& entry : stream_workspace_map)
+        if(entry.second.memory)
+            pool_free(entry.second.memory, entry.second.size);
+    stream_workspace_map.clear();
+
+    // Release any pooled device memory blocks back to the system
+    pool_trim();
+
 #ifdef BUILD_WITH_HIPBLASLT
     if(hipblasLtHandle.unique())
     {
@@ -365,6 +532,124 @@ _rocblas_handle::~_rocblas_handle()
 #endif
 }
 
+/*******************************************************************************
+ * deferred destruction
+ ******************************************************************************/
+namespace
+{
+    // Background reaper for rocblas_destroy_handle_deferred. The destructor
+    // above synchronizes with the device and frees device memory, which
+    // stalls the calling thread for milliseconds; per-session architectures
+    // that churn short-lived handles queue the teardown here instead. The
+    // worker thread is started on first use and joined at process exit after
+    // draining whatever is still queued.
+    class rocblas_handle_reaper
+    {
+    public:
+        static rocblas_handle_reaper& instance()
+        {
+            static rocblas_handle_reaper reaper;
+            return reaper;
+        }
+
+        void enqueue(rocblas_handle handle, hipEvent_t drained)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queue.push_back({handle, drained});
+            }
+            m_cond.notify_one();
+        }
+
+    private:
+        struct entry
+        {
+            rocblas_handle handle;
+            hipEvent_t     drained;
+        };
+
+        rocblas_handle_reaper()
+            : m_worker([this] { run(); })
+        {
+        }
+
+        ~rocblas_handle_reaper()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_shutdown = true;
+            }
+            m_cond.notify_one();
+            m_worker.join();
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(true)
+            {
+                m_cond.wait(lock, [&] { return m_shutdown || !m_queue.empty(); });
+                if(m_queue.empty())
+                {
+                    if(m_shutdown)
+                        return;
+                    continue;
+                }
+                entry e = m_queue.front();
+                m_queue.pop_front();
+                lock.unlock();
+                reap(e);
+                lock.lock();
+            }
+        }
+
+        static void reap(const entry& e)
+        {
+            // Wait off the hot path for work submitted before the destroy
+            // call; a failure means the stream or device is already gone, in
+            // which case the teardown below is all that is left to do.
+            if(e.drained)
+            {
+                (void)(hipEventSynchronize)(e.drained);
+                (void)(hipEventDestroy)(e.drained);
+            }
+
+            // The destructor issues device-side frees, so run it with the
+            // handle's device active rather than the worker thread's default
+            // cppcheck-suppress unreadVariable
+            auto saved_device_id = e.handle->push_device_id();
+            delete e.handle;
+        }
+
+        std::mutex              m_mutex;
+        std::condition_variable m_cond;
+        std::deque<entry>       m_queue;
+        bool                    m_shutdown = false;
+        std::thread             m_worker;
+    };
+}
+
+rocblas_status rocblas_internal_handle_destroy_deferred(rocblas_handle handle)
+{
+    hipEvent_t drained = nullptr;
+
+    // Mark how far the handle's stream has progressed; the reaper waits on
+    // this instead of the caller, so work in flight when the handle dies is
+    // still covered. If the event cannot be set up, fall back to tearing the
+    // handle down synchronously, exactly as rocblas_destroy_handle would.
+    if((hipEventCreateWithFlags)(&drained, hipEventDisableTiming) != hipSuccess
+       || (hipEventRecord)(drained, handle->get_stream()) != hipSuccess)
+    {
+        if(drained)
+            (void)(hipEventDestroy)(drained);
+        delete handle;
+        return rocblas_status_success;
+    }
+
+    rocblas_handle_reaper::instance().enqueue(handle, drained);
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * helper for allocating device memory
  ******************************************************************************/
@@ -386,25 +671,170 @@ bool _rocblas_handle::device_allocator(size_t size)
         // cppcheck-suppress unreadVariable
         auto saved_device_id = push_device_id();
 
+        device_memory_realloc_count++;
+        ++rocblas_internal_device_malloc_stall_count();
+
+        // Retire the old block to the pool rather than freeing it, so that it
+        // can be handed back without a hipMalloc if a smaller workspace is
+        // requested again later.
+        if(device_memory)
+            pool_free(device_memory, device_memory_size);
+        device_memory      = nullptr;
         device_memory_size = 0;
 
         //Add an additional device memory on top of default size.
         //This is to support kernels requiring large workspace with numerical checking enabled.
         size_t total_size = size + getDefaultDeviceMemorySize();
 
-        if(!device_memory || (hipFree)(device_memory) == hipSuccess)
-        {
-            success = (hipMalloc)(&device_memory, total_size) == hipSuccess;
-            if(success)
-                device_memory_size = total_size;
-            else
-                device_memory = nullptr;
-        }
+        device_memory = pool_malloc(total_size);
+        success       = device_memory != nullptr;
+        if(success)
+            device_memory_size = total_size;
     }
     return success;
 }
 #endif
 
+/*******************************************************************************
+ * Size-class pooling of device memory blocks
+ ******************************************************************************/
+int _rocblas_handle::pool_size_class(size_t size)
+{
+    int c = 0;
+    while((size_t(1) << c) < size && c < POOL_SIZE_CLASSES - 1)
+        c++;
+    return c;
+}
+
+void* _rocblas_handle::pool_malloc(size_t& size)
+{
+    // User callbacks bypass the size-class pool entirely: the user's
+    // allocator does its own caching, and rounding up to a power of two
+    // here would only inflate its requests
+    if(user_alloc_fn)
+        return user_alloc_fn(size, user_alloc_data);
+
+    int c = pool_size_class(size);
+    size  = size_t(1) << c;
+
+    auto& free_list = device_memory_pool[c];
+    if(!free_list.empty())
+    {
+        pooled_block block = free_list.back();
+        free_list.pop_back();
+
+        // every block filed under class c holds at least 1 << c bytes;
+        // report the block's true size so the caller's accounting can
+        // never exceed the real allocation
+        size = block.size;
+
+        // order reuse behind any work the retiring stream still has in
+        // flight against the block; the block may now serve a different
+        // stream's workspace partition
+        if(block.drained)
+        {
+            if((hipStreamWaitEvent)(get_stream(), block.drained, 0) != hipSuccess)
+                (void)(hipDeviceSynchronize)();
+            (void)(hipEventDestroy)(block.drained);
+        }
+        return block.ptr;
+    }
+
+    void* ptr = nullptr;
+    if((hipMalloc)(&ptr, size) != hipSuccess)
+        return nullptr;
+    return ptr;
+}
+
+void _rocblas_handle::pool_free(void* ptr, size_t size)
+{
+    if(user_free_fn)
+    {
+        user_free_fn(ptr, size, user_alloc_data);
+        return;
+    }
+
+    // File under the largest class the block fully covers. Retired blocks
+    // are not always class-sized, and filing an undersized block under the
+    // rounded-up class would let a later pool_malloc report more bytes than
+    // the block really holds.
+    int c = pool_size_class(size);
+    if((size_t(1) << c) > size && c > 0)
+        c--;
+
+    // Fence the retiring stream so a reuse on another stream waits for any
+    // kernels still reading or writing the block; the hipFree this pooling
+    // replaced was device-synchronizing. If the fence cannot be recorded,
+    // free the block rather than pool it unordered.
+    hipEvent_t drained = nullptr;
+    if((hipEventCreateWithFlags)(&drained, hipEventDisableTiming) != hipSuccess
+       || (hipEventRecord)(drained, get_stream()) != hipSuccess)
+    {
+        if(drained)
+            (void)(hipEventDestroy)(drained);
+        (void)(hipFree)(ptr);
+        return;
+    }
+
+    device_memory_pool[c].push_back({ptr, size, drained});
+}
+
+void _rocblas_handle::pool_trim()
+{
+    for(auto& free_list : device_memory_pool)
+    {
+        for(auto& block : free_list)
+        {
+            if((hipFree)(block.ptr) != hipSuccess)
+            {
+                rocblas_cerr
+                    << "rocBLAS error during freeing of pooled device memory block"
+                    << std::endl;
+                rocblas_abort();
+            }
+            if(block.drained)
+                (void)(hipEventDestroy)(block.drained);
+        }
+        free_list.clear();
+    }
+}
+
+/*******************************************************************************
+ * Per-stream workspace partitions
+ ******************************************************************************/
+void _rocblas_handle::switch_stream_workspace(hipStream_t new_stream)
+{
+    if(new_stream == stream)
+        return;
+
+    // Only rocblas-managed, non-stream-ordered memory is partitioned;
+    // user-provided workspaces keep their single-block semantics, and
+    // stream-ordered allocations are already attributed to their stream
+    if(device_memory_owner != rocblas_device_memory_ownership::rocblas_managed
+       || stream_order_alloc)
+        return;
+
+    // Park the live partition under the outgoing stream
+    stream_workspace_map[stream] = {device_memory, device_memory_size, device_memory_in_use};
+
+    // Activate the incoming stream's partition; a first-time stream starts
+    // with no memory and grows on demand through device_allocator
+    auto it = stream_workspace_map.find(new_stream);
+    if(it != stream_workspace_map.end())
+    {
+        device_memory        = it->second.memory;
+        device_memory_size   = it->second.size;
+        device_memory_in_use = it->second.in_use;
+        stream_workspace_map.erase(it);
+    }
+    else
+    {
+        device_memory        = nullptr;
+        device_memory_size   = 0;
+        device_memory_in_use = 0;
+    }
+}
+
 /*******************************************************************************
  * start device memory size queries
  ******************************************************************************/
@@ -463,6 +893,73 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Get the device memory in-use high-water mark
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_device_memory_high_watermark(rocblas_handle handle,
+                                                                   size_t*        size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->device_memory_high_watermark;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the number of allocation-triggered reallocations of the managed memory
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_device_memory_realloc_count(rocblas_handle handle,
+                                                                  size_t*        count)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count)
+        return rocblas_status_invalid_pointer;
+    *count = handle->device_memory_realloc_count;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the number of failed device memory allocation attempts
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_device_memory_failed_alloc_count(rocblas_handle handle,
+                                                                       size_t*        count)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count)
+        return rocblas_status_invalid_pointer;
+    *count = handle->device_memory_failed_alloc_count;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Process-wide count of synchronizing device memory reallocations, summed over
+ * all handles (read by rocblas-bench --scaling)
+ ******************************************************************************/
+ROCBLAS_INTERNAL_EXPORT std::atomic<size_t>& rocblas_internal_device_malloc_stall_count()
+{
+    static std::atomic<size_t> count;
+    return count;
+}
+
 /*******************************************************************************
  * Free any allocated memory unless owned by user, and reset the handle to being
  * rocBLAS-managed
@@ -480,7 +977,15 @@ static rocblas_status free_existing_device_memory(rocblas_handle handle)
        && handle->device_memory_owner != rocblas_device_memory_ownership::user_owned)
     {
         if(!handle->stream_order_alloc)
-            RETURN_IF_HIP_ERROR((hipFree)(handle->device_memory));
+        {
+            // Memory allocated while user callbacks were installed is always
+            // returned through them
+            if(handle->user_free_fn)
+                handle->user_free_fn(
+                    handle->device_memory, handle->device_memory_size, handle->user_alloc_data);
+            else
+                RETURN_IF_HIP_ERROR((hipFree)(handle->device_memory));
+        }
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
@@ -494,6 +999,16 @@ static rocblas_status free_existing_device_memory(rocblas_handle handle)
     handle->device_memory       = nullptr;
     handle->device_memory_owner = rocblas_device_memory_ownership::rocblas_managed;
 
+    // Retire any parked per-stream workspace partitions as well
+    for(auto& entry : handle->stream_workspace_map)
+        if(entry.second.memory)
+            handle->pool_free(entry.second.memory, entry.second.size);
+    handle->stream_workspace_map.clear();
+
+    // The user is explicitly changing the memory scheme, so also release any
+    // pooled blocks rather than holding them for reuse
+    handle->pool_trim();
+
     return rocblas_status_success;
 }
 
@@ -524,7 +1039,15 @@ try
 
     hipError_t hipStatus;
     if(!handle->stream_order_alloc)
-        hipStatus = (hipMalloc)(&handle->device_memory, size);
+    {
+        if(handle->user_alloc_fn)
+        {
+            handle->device_memory = handle->user_alloc_fn(size, handle->user_alloc_data);
+            hipStatus             = handle->device_memory ? hipSuccess : hipErrorOutOfMemory;
+        }
+        else
+            hipStatus = (hipMalloc)(&handle->device_memory, size);
+    }
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
@@ -586,6 +1109,64 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Set user-provided device memory allocator callbacks
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_set_device_memory_callbacks(rocblas_handle                 handle,
+                                        rocblas_device_memory_alloc_fn alloc_fn,
+                                        rocblas_device_memory_free_fn  free_fn,
+                                        void*                          user_data)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // Both callbacks are installed together; passing both as nullptr restores
+    // the default allocator
+    if(!alloc_fn != !free_fn)
+        return rocblas_status_invalid_pointer;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    // Free any workspace and pooled blocks held from the outgoing allocator
+    // before switching, so every live block is owned by exactly one allocator
+    rocblas_status status = free_existing_device_memory(handle);
+    if(status != rocblas_status_success)
+        return status;
+
+    handle->user_alloc_fn   = alloc_fn;
+    handle->user_free_fn    = free_fn;
+    handle->user_alloc_data = user_data;
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Enable or disable stream-ordered device memory allocation
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_stream_order_memory_allocation(rocblas_handle handle,
+                                                                     bool           enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    return handle->set_stream_order_memory_allocation(enable);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Returns whether device memory is rocblas-managed
  ******************************************************************************/
@@ -818,6 +1399,7 @@ static auto open_log_stream(const char* environment_variable_name)
  ******************************************************************************/
 void _rocblas_handle::init_logging()
 {
+#ifndef ROCBLAS_FAST_DISPATCH
     // set layer_mode from value of environment variable ROCBLAS_LAYER
     const char* str_layer_mode = read_env("ROCBLAS_LAYER");
     if(str_layer_mode)
@@ -836,6 +1418,7 @@ void _rocblas_handle::init_logging()
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile_os = open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
     }
+#endif
 }
 
 /*******************************************************************************
@@ -878,11 +1461,98 @@ extern "C" rocblas_status rocblas_get_performance_metric(rocblas_handle
         return rocblas_status_invalid_pointer;
 }
 
+/*******************************************************************************
+ * Choose how many candidate solutions are timed when autotuning GEMM
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_autotune(rocblas_handle handle, rocblas_int top_n)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(top_n < 0)
+        return rocblas_status_invalid_value;
+
+    handle->gemm_autotune_top_n = top_n;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_get_gemm_autotune(rocblas_handle handle, rocblas_int* top_n)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!top_n)
+        return rocblas_status_invalid_pointer;
+
+    *top_n = handle->gemm_autotune_top_n;
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * Async numeric_check flag block
+ ******************************************************************************/
+rocblas_check_numerics_t* _rocblas_handle::get_numerics_flags_device()
+{
+    if(!numerics_flags_device)
+    {
+        if((hipMalloc)(&numerics_flags_device, sizeof(rocblas_check_numerics_t)) != hipSuccess)
+            return nullptr;
+        if((hipMemset)(numerics_flags_device, 0, sizeof(rocblas_check_numerics_t)) != hipSuccess)
+        {
+            (void)(hipFree)(numerics_flags_device);
+            numerics_flags_device = nullptr;
+        }
+    }
+    return numerics_flags_device;
+}
+
+/*******************************************************************************
+ * Stream-k source GEMM work-unit counter
+ ******************************************************************************/
+uint32_t* _rocblas_handle::get_streamk_counter()
+{
+    if(!streamk_counter)
+    {
+        if((hipMalloc)(&streamk_counter, sizeof(uint32_t)) != hipSuccess)
+            return nullptr;
+        if((hipMemset)(streamk_counter, 0, sizeof(uint32_t)) != hipSuccess)
+        {
+            (void)(hipFree)(streamk_counter);
+            streamk_counter = nullptr;
+        }
+    }
+    return streamk_counter;
+}
+
+/*******************************************************************************
+ * Persistent GEMM work queue
+ ******************************************************************************/
+rocblas_gemm_persistent_queue* _rocblas_handle::get_gemm_persistent_queue()
+{
+    if(!gemm_persistent_init)
+    {
+        gemm_persistent_init = true;
+
+        const char* env = read_env("ROCBLAS_GEMM_PERSISTENT");
+        if(env && strtol(env, nullptr, 0) > 0)
+        {
+            auto* q = new rocblas_gemm_persistent_queue;
+            if(rocblas_gemm_persistent_start(q) != rocblas_status_success)
+            {
+                rocblas_gemm_persistent_stop(q);
+                delete q;
+            }
+            else
+                gemm_persistent = q;
+        }
+    }
+    return gemm_persistent;
+}
+
 /*******************************************************************************
  * Numeric_check initialization
  ******************************************************************************/
 void _rocblas_handle::init_check_numerics()
 {
+#ifndef ROCBLAS_FAST_DISPATCH
     // set check_numerics from value of environment variable ROCBLAS_CHECK_NUMERICS
     const char* str_check_numerics_mode = read_env("ROCBLAS_CHECK_NUMERICS");
     if(str_check_numerics_mode)
@@ -890,4 +1560,33 @@ void _rocblas_handle::init_check_numerics()
         check_numerics
             = static_cast<rocblas_check_numerics_mode>(strtol(str_check_numerics_mode, 0, 0));
     }
+
+    // optional sampling so the checks can stay enabled in production:
+    // check only every Nth element (or column) of each operand
+    const char* str_check_numerics_stride = read_env("ROCBLAS_CHECK_NUMERICS_STRIDE");
+    if(str_check_numerics_stride)
+    {
+        int64_t stride = strtol(str_check_numerics_stride, 0, 0);
+        if(stride > 1)
+            check_numerics_stride = stride;
+    }
+
+    // optionally limit the checks to a mask of function families
+    const char* str_check_numerics_scope = read_env("ROCBLAS_CHECK_NUMERICS_SCOPE");
+    if(str_check_numerics_scope)
+    {
+        uint32_t scope = uint32_t(strtoul(str_check_numerics_scope, 0, 0));
+        if(scope)
+            check_numerics_scope = scope;
+    }
+
+    // and run the checks for only one call in every N
+    const char* str_check_numerics_rate = read_env("ROCBLAS_CHECK_NUMERICS_RATE");
+    if(str_check_numerics_rate)
+    {
+        int64_t rate = strtol(str_check_numerics_rate, 0, 0);
+        if(rate > 1)
+            check_numerics_rate = rate;
+    }
+#endif
 }
@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "handle.hpp"
+
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Host-side API-entry cost accounting (rocblas_get_cpu_overhead_stats):
+// instrumented entry points wrap themselves in a scope timer that charges
+// elapsed rdtsc ticks and a call count to their function family on the
+// handle. Two tick reads and two additions per call keep it cheap enough to
+// stay always on; conversion to wall time happens only when the stats are
+// read.
+
+// values mirror the public rocblas_cpu_overhead_family enum
+inline constexpr int rocblas_internal_cpu_family_blas1   = 0;
+inline constexpr int rocblas_internal_cpu_family_blas2   = 1;
+inline constexpr int rocblas_internal_cpu_family_blas3   = 2;
+inline constexpr int rocblas_internal_cpu_family_blas_ex = 3;
+
+inline uint64_t rocblas_internal_cpu_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    // tick unit is nanoseconds on architectures without a cheap TSC read
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count());
+#endif
+}
+
+// Ticks per microsecond, calibrated once per process against the steady
+// clock. Only called from the stats getter, never from the per-call path.
+inline double rocblas_internal_cpu_ticks_per_us()
+{
+    static const double rate = [] {
+#if defined(__x86_64__) || defined(__i386__)
+        using clock = std::chrono::steady_clock;
+
+        uint64_t t0 = rocblas_internal_cpu_ticks();
+        auto     c0 = clock::now();
+
+        // ~2 ms busy window; short enough for a stats call, long enough to
+        // dwarf the clock-read jitter
+        while(std::chrono::duration<double, std::micro>(clock::now() - c0).count() < 2000.0)
+        {
+        }
+
+        uint64_t t1 = rocblas_internal_cpu_ticks();
+        auto     c1 = clock::now();
+
+        return double(t1 - t0) / std::chrono::duration<double, std::micro>(c1 - c0).count();
+#else
+        return 1000.0; // ticks are nanoseconds
+#endif
+    }();
+    return rate;
+}
+
+class rocblas_internal_cpu_overhead_timer
+{
+public:
+    rocblas_internal_cpu_overhead_timer(rocblas_handle handle, int family)
+        : m_handle(handle)
+        , m_family(family)
+        , m_start(rocblas_internal_cpu_ticks())
+    {
+    }
+
+    ~rocblas_internal_cpu_overhead_timer()
+    {
+        m_handle->cpu_overhead_ticks[m_family] += rocblas_internal_cpu_ticks() - m_start;
+        m_handle->cpu_overhead_calls[m_family]++;
+    }
+
+private:
+    rocblas_handle m_handle;
+    int            m_family;
+    uint64_t       m_start;
+};
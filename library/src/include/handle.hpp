@@ -27,11 +27,15 @@
 #include "rocblas_ostream.hpp"
 #include "utility.hpp"
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
 #include <hip/hip_runtime.h>
+#include <map>
 #include <memory>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 #ifdef WIN32
 #include <stdio.h>
 #define STDOUT_FILENO _fileno(stdout)
@@ -47,6 +51,11 @@ typedef void* hipblasLtHandle_t;
 // forcing early cleanup
 extern "C" ROCBLAS_EXPORT void rocblas_shutdown();
 
+// Process-wide count of device_malloc requests which forced a synchronizing
+// reallocation of a handle's device memory block, summed over all handles.
+// Read by rocblas-bench --scaling to attribute multi-stream scaling losses.
+ROCBLAS_INTERNAL_EXPORT std::atomic<size_t>& rocblas_internal_device_malloc_stall_count();
+
 // Whether rocBLAS can reallocate device memory on demand, at the cost of only
 // allowing one allocation at a time, and at the cost of potential synchronization.
 // If this is 0, then stack-like allocation is allowed, but reallocation on demand
@@ -60,11 +69,40 @@ constexpr size_t roundup_device_memory_size(size_t size)
     return ((size + MIN_CHUNK_SIZE - 1) / MIN_CHUNK_SIZE) * MIN_CHUNK_SIZE;
 }
 
+// Alignment separating the read-mostly handle state every API call loads
+// (pointer_mode, layer_mode, atomics_mode, stream) from the per-call mutable
+// bookkeeping, so concurrent callers sharing a handle do not false-share a
+// cache line with the device memory allocator (see _rocblas_handle)
+constexpr size_t c_rocblas_cache_line_size = 64;
+
 // Empty base class for device memory allocation
 struct rocblas_device_malloc_base
 {
 };
 
+// One recorded operation of a deferred blas1 sequence (BLAS BETA,
+// rocblas_begin_sequence / rocblas_end_sequence). The descriptors are
+// uploaded as an array to device memory and replayed by one multi-op kernel,
+// so the layout is shared between the host recording side and the kernel.
+// For scal the vector lives in y and walks incx; negative increments are
+// folded into the pointers at record time.
+struct rocblas_blas1_seq_op
+{
+    enum rocblas_blas1_seq_kind : int32_t
+    {
+        scal,
+        axpy,
+        copy
+    } kind;
+    int32_t     is_double;
+    rocblas_int n;
+    rocblas_int incx;
+    rocblas_int incy;
+    double      alpha;
+    const void* x;
+    void*       y;
+};
+
 // enum representing state of rocBLAS device memory ownership
 enum class rocblas_device_memory_ownership
 {
@@ -103,6 +141,52 @@ enum class Processor : int
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
+// opt-in persistent GEMM work queue (blas3/rocblas_gemm_persistent.hpp)
+struct rocblas_gemm_persistent_queue;
+
+// shape-keyed GEMM tuning loaded from ROCBLAS_TUNING_FILE (tuning.hpp)
+class rocblas_tuning_table;
+
+// Opt-in per-kernel launch timeline (BLAS BETA, rocblas_set_kernel_timeline):
+// a fixed-size ring of hipEvent pairs recorded around each internal kernel
+// launch on the handle's stream, sampled in-process through
+// rocblas_get_kernel_timeline without attaching an external profiler
+struct rocblas_internal_kernel_timeline
+{
+    struct slot
+    {
+        const char* name   = nullptr; // static string from the launch macro
+        uint64_t    serial = 0; // launch number since the timeline was enabled
+        hipEvent_t  start  = nullptr;
+        hipEvent_t  stop   = nullptr;
+    };
+    std::vector<slot>     slots;
+    hipEvent_t            base = nullptr; // timestamps are reported relative to this
+    std::atomic<uint64_t> next{0}; // total launches recorded; slot index is next % size
+};
+
+// tears down a handle's timeline ring and removes it from the launch-macro
+// registry; defined with the rest of the timeline machinery in rocblas_auxiliary.cpp
+void rocblas_internal_timeline_release(rocblas_handle handle);
+
+// hands a handle to the background reaper for teardown once its stream has
+// drained, so the calling thread does not pay for the synchronization and
+// frees in the destructor; defined with the reaper in handle.cpp
+rocblas_status rocblas_internal_handle_destroy_deferred(rocblas_handle handle);
+
+// Opt-in per-call launch metrics (BLAS BETA, rocblas_set_call_metrics):
+// a snapshot of the most recent kernel launch the Tensile backend made on
+// this handle, sampled through rocblas_get_call_metrics so telemetry can
+// flag calls running below roofline without an external profiler
+struct rocblas_internal_call_metrics
+{
+    int32_t  solution_index = 0; // backend solution index of the launched kernel
+    uint32_t workgroup_size = 0; // threads per workgroup of the largest kernel
+    uint64_t workgroups     = 0; // workgroups launched across all kernels of the call
+    double   cu_occupancy   = 0; // launched workgroups over compute units, capped at 1
+    uint64_t bytes_estimate = 0; // operand bytes read and written implied by the shape
+};
+
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
@@ -233,11 +317,23 @@ public:
         return archMajor;
     }
 
+    // true when the device runs the gemm_ex3 float8 paths; decided once at
+    // handle creation so the FP8 hot paths skip per-call capability checks
+    bool supportsFP8()
+    {
+        return supports_fp8;
+    }
+
     int getArchMajorMinor()
     {
         return archMajorMinor;
     }
 
+    int getCUCount()
+    {
+        return cuCount;
+    }
+
     int getMaxSharedMemPerBlock()
     {
         int max_mem = -1;
@@ -310,19 +406,241 @@ public:
     hipEvent_t stopEvent  = nullptr;
 
     // default pointer_mode is on host
-    rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
-
+    //
+    // pointer_mode, layer_mode and atomics_mode are loaded at the top of
+    // every API call and written only by their set functions, so the group
+    // starts a cache line of its own and the line stays clean under
+    // concurrent callers
+    alignas(c_rocblas_cache_line_size) rocblas_pointer_mode pointer_mode
+        = rocblas_pointer_mode_host;
+
+#ifdef ROCBLAS_FAST_DISPATCH
+    // fast-dispatch build: the layer checks fold to constexpr false so the
+    // logging and numeric-check branches in every *_imp compile out entirely
+    static constexpr rocblas_layer_mode layer_mode = rocblas_layer_mode_none;
+#else
     // default logging_mode is no logging
     rocblas_layer_mode layer_mode = rocblas_layer_mode_none;
+#endif
 
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
+    // Caller tag recorded into the profile and bench logs (BLAS BETA,
+    // rocblas_set_call_tag); points at a process-lifetime interned string so
+    // profile aggregation keys holding it never dangle. nullptr when unset.
+    const char* call_tag = nullptr;
+
+    // Device-side execution predicate (BLAS BETA, rocblas_set_device_predicate):
+    // when non-null, the predicated blas1 kernels (axpy, dot, nrm2/asum) exit
+    // immediately if the word it points to reads zero, so graph-captured solver
+    // loops become no-ops once convergence has been flagged on the device
+    const rocblas_int* device_predicate = nullptr;
+
+    // Flush-to-zero policy (BLAS BETA, rocblas_set_flush_denorms): when set,
+    // launchers that carry FTZ kernel variants dispatch the flushing ones, so
+    // denormal inputs cannot cause data-dependent throughput cliffs
+    bool flush_denorms = false;
+
+    // Auto-batching of concurrent same-shape gemm_ex calls (BLAS BETA,
+    // rocblas_set_gemm_auto_batch): a call queues up to window microseconds
+    // for compatible calls from other handles and the group dispatches as one
+    // grouped launch; 0 disables. max_group bounds the group size.
+    rocblas_int gemm_auto_batch_window_us = 0;
+    rocblas_int gemm_auto_batch_max_group = 32;
+
+    // Hybrid host compute (BLAS BETA, rocblas_set_hybrid_host_compute):
+    // unit-stride host-pointer-mode blas1 calls with n at or below this
+    // threshold run on the CPU from a staged copy of the operands instead of
+    // launching a kernel; 0 (the default) disables the mode.
+    rocblas_int hybrid_host_threshold = 0;
+
+    // Deferred blas1 sequence recording (BLAS BETA, rocblas_begin_sequence):
+    // eligible scal/axpy/copy calls append a descriptor here instead of
+    // launching, and rocblas_end_sequence replays the list as one multi-op
+    // kernel. The vector also keeps the descriptors alive while the
+    // asynchronous upload to device memory is in flight, so it is only
+    // cleared by the next rocblas_begin_sequence.
+    std::vector<rocblas_blas1_seq_op> blas1_sequence;
+    bool                              blas1_sequence_recording = false;
+
+    // Stochastic-rounding seed state (gemm_ex3, rocblas_set_stochastic_seed):
+    // seeds for the SR conversion kernels derive from sr_seed plus a per-call
+    // counter, so repeated calls on one handle round with distinct streams and
+    // a seeded handle reproduces the whole sequence
+    uint32_t              sr_seed = 0;
+    std::atomic<uint32_t> sr_call_count{0};
+
+    // Kernel-launch timeline ring (BLAS BETA, rocblas_set_kernel_timeline);
+    // null unless instrumentation has been enabled on this handle
+    std::unique_ptr<rocblas_internal_kernel_timeline> kernel_timeline;
+
     // Selects the benchmark library to be used for solution selection
     rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
 
+    // Per-call launch metrics (BLAS BETA, rocblas_set_call_metrics); the
+    // Tensile backend overwrites the snapshot on every launch when enabled
+    bool                          collect_call_metrics = false;
+    rocblas_internal_call_metrics call_metrics;
+
+    // When > 0, the first occurrence of a GEMM shape times up to this many
+    // candidate solutions on the live stream and keeps the fastest for all
+    // subsequent calls (see rocblas_set_gemm_autotune)
+    rocblas_int gemm_autotune_top_n = 0;
+
+    // Shape-keyed GEMM tuning parsed from ROCBLAS_TUNING_FILE at handle
+    // creation (see tuning.hpp); nullptr when no file is configured
+    const rocblas_tuning_table* tuning_table = nullptr;
+
+    // Opt-in cache of device-resident alpha/beta values
+    // (rocblas_set_device_scalar_peek_mode). In device pointer mode the
+    // dispatch layer cannot see scalar values, so special-value fast paths
+    // (beta == 0, alpha == 0) are forfeited. When the user enables peeking
+    // and promises the scalars are stable between invalidations, the first
+    // readback of each scalar is cached keyed by (pointer, version) and
+    // later calls branch on the cached value with no stream synchronize.
+    bool     device_scalar_peek_enabled = false;
+    uint64_t device_scalar_cache_version = 0;
+
+    struct rocblas_device_scalar_cache_entry
+    {
+        const void* ptr     = nullptr;
+        uint64_t    version = 0;
+        size_t      size    = 0;
+        alignas(16) char value[16]; // holds up to rocblas_double_complex
+    };
+    static constexpr size_t c_device_scalar_cache_slots = 8;
+    rocblas_device_scalar_cache_entry device_scalar_cache[c_device_scalar_cache_slots];
+    size_t                            device_scalar_cache_next = 0;
+
+    // If peeking is enabled and a current cached copy of the device scalar
+    // at ptr exists, write it to value and return true
+    template <typename T>
+    bool try_peek_device_scalar(const T* ptr, T& value) const
+    {
+        static_assert(sizeof(T) <= 16, "scalar too large for the peek cache");
+        if(!device_scalar_peek_enabled || !ptr)
+            return false;
+        for(const auto& e : device_scalar_cache)
+            if(e.ptr == ptr && e.version == device_scalar_cache_version && e.size == sizeof(T))
+            {
+                std::memcpy(&value, e.value, sizeof(T));
+                return true;
+            }
+        return false;
+    }
+
+    // Record a value read back from the device scalar at ptr so later calls
+    // can peek it; no-op unless peeking is enabled
+    template <typename T>
+    void note_device_scalar(const T* ptr, const T& value)
+    {
+        static_assert(sizeof(T) <= 16, "scalar too large for the peek cache");
+        if(!device_scalar_peek_enabled || !ptr)
+            return;
+        auto& e = device_scalar_cache[device_scalar_cache_next];
+        device_scalar_cache_next = (device_scalar_cache_next + 1) % c_device_scalar_cache_slots;
+        e.ptr                    = ptr;
+        e.version                = device_scalar_cache_version;
+        e.size                   = sizeof(T);
+        std::memcpy(e.value, &value, sizeof(T));
+    }
+
+#ifdef ROCBLAS_FAST_DISPATCH
+    static constexpr rocblas_check_numerics_mode check_numerics
+        = rocblas_check_numerics_mode_no_check;
+#else
     // default check_numerics_mode is no numeric_check
     rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_no_check;
+#endif
+
+    // Function families the checks apply to (ROCBLAS_CHECK_NUMERICS_SCOPE or
+    // rocblas_set_check_numerics_mode); call sites outside the mask run clean
+    uint32_t check_numerics_scope = rocblas_check_numerics_scope_all;
+
+    // The check mode a call site in the given function family should honor
+    rocblas_check_numerics_mode check_numerics_for(uint32_t scope) const
+    {
+        return (check_numerics_scope & scope) ? check_numerics
+                                              : rocblas_check_numerics_mode_no_check;
+    }
+
+    // Sampling controls so numeric checks can stay enabled in production:
+    // check only every check_numerics_stride-th element (or column) of each
+    // operand (ROCBLAS_CHECK_NUMERICS_STRIDE), and run the checks for only
+    // one call in every check_numerics_rate (ROCBLAS_CHECK_NUMERICS_RATE)
+    int64_t check_numerics_stride = 1;
+    int64_t check_numerics_rate   = 1;
+
+    // Persistent device-side flags accumulated into by the async numeric
+    // check mode (rocblas_check_numerics_mode_async); lazily created by
+    // get_numerics_flags_device, polled and cleared by
+    // rocblas_get_numerics_status
+    rocblas_check_numerics_t* numerics_flags_device = nullptr;
+
+    // Lazily create the zeroed device-side flag block; nullptr on failure
+    rocblas_check_numerics_t* get_numerics_flags_device();
+
+    // Device-side work-unit counter for the stream-k source GEMM scheduling
+    // path (ROCBLAS_GEMM_SOURCE_STREAMK, see rocblas_gemm_source.hpp); reset
+    // on the stream before each stream-k launch
+    uint32_t* streamk_counter = nullptr;
+
+    // Lazily create the stream-k work-unit counter; nullptr on failure
+    uint32_t* get_streamk_counter();
+
+    // Persistent GEMM work queue, created on first use when
+    // ROCBLAS_GEMM_PERSISTENT is set; nullptr when the mode is off or the
+    // device cannot service it
+    rocblas_gemm_persistent_queue* get_gemm_persistent_queue();
+
+    // Permanently reserved device scratch for blas1 reductions, allocated at
+    // handle creation; nullptr if that allocation failed, in which case
+    // reduction_malloc falls back to device_malloc
+    static constexpr size_t reduction_workspace_size = 1 << 20;
+    void*                   reduction_workspace      = nullptr;
+
+    // Pinned staging buffer and completion event for host-pointer-mode
+    // reduction results (see rocblas_reduction_fetch_result in
+    // rocblas_reduction.hpp). Waiting on the event instead of the stream
+    // covers only the result copy, so work queued behind it keeps running.
+    // Lazily allocated on first host-mode reduction and grown as needed.
+    void*      pinned_result_buffer = nullptr;
+    size_t     pinned_result_size   = 0;
+    hipEvent_t pinned_result_event  = nullptr;
+
+    // Opt-in zero-copy result mode (rocblas_set_mapped_host_results): the
+    // finishing kernels of host-pointer-mode reductions write their scalars
+    // straight into mapped pinned host memory, removing the device-to-host
+    // copy entirely (see rocblas_reduction_mapped_output in
+    // rocblas_reduction.hpp). Lazily allocated on first use and grown as
+    // needed; mapped_result_device is the device-visible alias of the buffer.
+    bool   mapped_results       = false;
+    void*  mapped_result_buffer = nullptr;
+    void*  mapped_result_device = nullptr;
+    size_t mapped_result_size   = 0;
+
+    // Host-side API-entry overhead counters, one slot per function family
+    // (see cpu_overhead.hpp and rocblas_get_cpu_overhead_stats in
+    // rocblas-beta.h). Instrumented entry points accumulate rdtsc ticks and
+    // a call count here; conversion to microseconds happens at read time.
+    static constexpr int c_cpu_overhead_families                = 4;
+    uint64_t             cpu_overhead_ticks[c_cpu_overhead_families] = {};
+    uint64_t             cpu_overhead_calls[c_cpu_overhead_families] = {};
+
+    // Returns whether this check runs under the 1-in-N call sampling. A call
+    // checks its inputs before the computation and its outputs after, so an
+    // input check following an output check marks the next call; the decision
+    // is latched for the rest of the call
+    bool check_numerics_sample_call(bool is_input)
+    {
+        if(check_numerics_rate <= 1)
+            return true;
+        if(is_input && !check_numerics_last_was_input)
+            check_numerics_skip = (check_numerics_calls++ % check_numerics_rate) != 0;
+        check_numerics_last_was_input = is_input;
+        return !check_numerics_skip;
+    }
 
     // default math_mode is default_math
     rocblas_math_mode math_mode = rocblas_default_math;
@@ -338,13 +656,30 @@ public:
     friend rocblas_status(::rocblas_start_device_memory_size_query)(_rocblas_handle*);
     friend rocblas_status(::rocblas_stop_device_memory_size_query)(_rocblas_handle*, size_t*);
     friend rocblas_status(::rocblas_get_device_memory_size)(_rocblas_handle*, size_t*);
+    friend rocblas_status(::rocblas_get_device_memory_high_watermark)(_rocblas_handle*, size_t*);
+    friend rocblas_status(::rocblas_get_device_memory_realloc_count)(_rocblas_handle*, size_t*);
+    friend rocblas_status(::rocblas_get_device_memory_failed_alloc_count)(_rocblas_handle*,
+                                                                          size_t*);
     friend rocblas_status(::rocblas_set_device_memory_size)(_rocblas_handle*, size_t);
     friend rocblas_status(::free_existing_device_memory)(rocblas_handle);
     friend rocblas_status(::rocblas_set_workspace)(_rocblas_handle*, void*, size_t);
+    friend rocblas_status(::rocblas_set_device_memory_callbacks)(_rocblas_handle*,
+                                                                 rocblas_device_memory_alloc_fn,
+                                                                 rocblas_device_memory_free_fn,
+                                                                 void*);
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
 
+    // rebinds the handle between the user stream and the internal chunk
+    // streams while pipelining ILP64 chunk launches
+    friend class rocblas_internal_chunk_pipeline;
+
+    // rebinds the handle across the internal stream pool (priority pair or
+    // chunk streams) while overlapping independent stages of multi-kernel
+    // algorithms (see stage_scheduler.hpp)
+    friend class rocblas_internal_stage_scheduler;
+
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
     friend rocblas_status(::rocblas_set_performance_metric)(_rocblas_handle*,
@@ -369,11 +704,23 @@ public:
         return solution_fitness_query;
     }
 
-    void set_stream_order_memory_allocation(bool flag)
+    rocblas_status set_stream_order_memory_allocation(bool flag)
     {
+        if(flag)
+        {
+            rocblas_status status = configure_stream_order_pool();
+            if(status != rocblas_status_success)
+                return status;
+        }
         stream_order_alloc = flag;
+        return rocblas_status_success;
     }
 
+    // Configures the device's default memory pool (release threshold and
+    // cross-stream reuse) so that stream-ordered alloc/free cycles are
+    // served from the pool instead of the driver allocator
+    rocblas_status configure_stream_order_pool();
+
     // Sets the optimal size(s) of device memory for a kernel call
     // Maximum size is accumulated in device_memory_query_size
     // Returns rocblas_status_size_increased or rocblas_status_size_unchanged
@@ -449,8 +796,10 @@ private:
     static constexpr size_t DEFAULT_DEVICE_MEMORY_SIZE          = 32 * 1024 * 1024;
     static constexpr size_t DEFAULT_DEVICE_MEMORY_SIZE_EXTENDED = 128 * 1024 * 1024;
 
-    // Variables holding state of device memory allocation
-    void*                           device_memory              = nullptr;
+    // Variables holding state of device memory allocation; device_memory_in_use
+    // is rewritten by the RAII allocator on every call that borrows workspace,
+    // so the block starts its own cache line away from the read-mostly state
+    alignas(c_rocblas_cache_line_size) void* device_memory   = nullptr;
     size_t                          device_memory_size         = 0;
     size_t                          device_memory_in_use       = 0;
     bool                            device_memory_size_query   = false;
@@ -458,19 +807,121 @@ private:
     rocblas_device_memory_ownership device_memory_owner;
     size_t                          device_memory_query_size;
 
+    // Allocation telemetry: the largest device_memory_in_use seen so far, the
+    // number of allocation-triggered reallocations of the managed block, and
+    // the number of failed allocation attempts
+    size_t device_memory_high_watermark    = 0;
+    size_t device_memory_realloc_count     = 0;
+    size_t device_memory_failed_alloc_count = 0;
+
     bool stream_order_alloc = false;
 
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
-    // rocblas by default take the system default stream 0 users cannot create
-    hipStream_t stream = 0;
+    // rocblas by default take the system default stream 0 users cannot create;
+    // read on every call, so it gets a line the numeric-check counters below
+    // cannot dirty
+    alignas(c_rocblas_cache_line_size) hipStream_t stream = 0;
+
+    // State of the 1-in-N call sampling for numeric checks (see
+    // check_numerics_sample_call); mutated per sampled call
+    alignas(c_rocblas_cache_line_size) int64_t check_numerics_calls = 0;
+    bool    check_numerics_skip           = false;
+    bool    check_numerics_last_was_input = false;
+
+    // Internal streams and events used to pipeline independent ILP64 chunk
+    // launches across chunk boundaries (see rocblas_internal_chunk_pipeline
+    // in int64_helpers.hpp). Lazily created on first pipelined chunk loop.
+    hipStream_t chunk_streams[2] = {};
+    hipEvent_t  chunk_events[2]  = {};
+
+    // Optional priority stream pair for the internal stage scheduler: [0]
+    // runs at the device's highest stream priority for critical-path stages,
+    // [1] at the lowest for background stages, so internal bubbles of
+    // multi-stage algorithms never delay a latency-critical caller stream.
+    // Created at handle creation when the device exposes a priority range;
+    // both remain null otherwise and the scheduler falls back to the
+    // chunk_streams pool.
+    hipStream_t priority_streams[2] = {};
+
+    // Per-stage completion events for the internal stage scheduler (see
+    // rocblas_internal_stage_scheduler in stage_scheduler.hpp), which
+    // overlaps independent stages of multi-kernel algorithms across the
+    // chunk_streams pool. Lazily created on first scheduled stage.
+    static constexpr int c_num_stage_events             = 4;
+    hipEvent_t           stage_events[c_num_stage_events] = {};
+
+    // Persistent GEMM work queue (see get_gemm_persistent_queue)
+    rocblas_gemm_persistent_queue* gemm_persistent      = nullptr;
+    bool                           gemm_persistent_init = false;
 
 #if ROCBLAS_REALLOC_ON_DEMAND
     // Helper for device memory allocator
     bool ROCBLAS_EXPORT device_allocator(size_t size);
 #endif
 
+    // Pool of device memory blocks retained by the handle. Blocks retired by
+    // the reallocation path are kept on per-size-class free lists instead of
+    // being returned with hipFree, so workloads which alternate between
+    // small and large workspace needs stop paying hipMalloc/hipFree on the
+    // hot path. Retired blocks are not always class-sized (the initial
+    // rocblas-managed allocation is whatever size was configured), so each
+    // block carries its true byte size and is filed under the largest class
+    // it fully covers; it also carries an event recorded on the retiring
+    // stream so reuse on another stream orders behind any work still using
+    // the block. Class i holds blocks of at least 1 << i bytes.
+    struct pooled_block
+    {
+        void*      ptr     = nullptr;
+        size_t     size    = 0;
+        hipEvent_t drained = nullptr;
+    };
+    static constexpr int                                     POOL_SIZE_CLASSES = 48;
+    std::array<std::vector<pooled_block>, POOL_SIZE_CLASSES> device_memory_pool;
+
+    // Index of the smallest size class which can hold size bytes
+    static int pool_size_class(size_t size);
+
+    // Take a block from the pool, rounding size up to its size class and
+    // then to the true size of the pooled block returned; falls back to
+    // hipMalloc when the free list is empty
+    void* pool_malloc(size_t& size);
+
+    // Retire a block of a given byte size to the pool
+    void pool_free(void* ptr, size_t size);
+
+    // Free all pooled blocks back to the system
+    void pool_trim();
+
+    // User-provided device memory allocator callbacks (see
+    // rocblas_set_device_memory_callbacks). When installed, pool_malloc and
+    // pool_free route blocks through them instead of hipMalloc and the
+    // per-size-class free lists, so an application's own caching allocator
+    // owns the memory instead of a second pool growing beside it.
+    rocblas_device_memory_alloc_fn user_alloc_fn   = nullptr;
+    rocblas_device_memory_free_fn  user_free_fn    = nullptr;
+    void*                          user_alloc_data = nullptr;
+
+    // Per-stream workspace partitions. A handle rebound to another stream with
+    // rocblas_set_stream would otherwise serialize concurrent streams on the
+    // single workspace block. The live partition stays in device_memory /
+    // device_memory_size / device_memory_in_use; when the bound stream
+    // changes, the live partition is parked here under the outgoing stream and
+    // the incoming stream's partition (created empty on first use) is swapped
+    // in. Only rocblas-managed, non-stream-ordered memory is partitioned;
+    // user-provided workspaces keep their single-block semantics.
+    struct stream_workspace
+    {
+        void*  memory = nullptr;
+        size_t size   = 0;
+        size_t in_use = 0;
+    };
+    std::map<hipStream_t, stream_workspace> stream_workspace_map;
+
+    // Park the current stream's partition and activate new_stream's partition
+    void switch_stream_workspace(hipStream_t new_stream);
+
     // Device ID is created at handle creation time and remains in effect for the life of the handle.
     const int device;
 
@@ -479,6 +930,14 @@ private:
     int       archMajor;
     int       archMajorMinor;
 
+    // Compute-unit count is queried once at handle creation for CU-aware
+    // grid sizing in the dispatchers.
+    int cuCount = 0;
+
+    // Whether the device runs the gemm_ex3 float8 paths, derived from arch
+    // at handle creation.
+    bool supports_fp8 = false;
+
     // hipBLASLt handle is created at handle creation time and remains in effect for the life of the handle.
     std::shared_ptr<hipblasLtHandle_t> hipblasLtHandle;
     int                                hipblasltEnvVar = -1;
@@ -495,10 +954,33 @@ private:
         void*          dev_mem = nullptr;
         hipStream_t    stream_in_use;
         bool           success;
+        bool           stream_ordered = false;
 
     private:
         std::vector<void*> pointers; // Important: must come last
 
+        // Whether this allocation must use stream-ordered allocation. This is
+        // the case when the user opted in via stream_order_alloc, but also
+        // whenever the stream is capturing into a hipGraph and the request
+        // does not fit in the already-reserved block: the realloc-on-demand
+        // path would call the synchronizing hipMalloc/hipFree and invalidate
+        // the capture, while hipMallocAsync/hipFreeAsync are capture-legal.
+        // Callers who pre-reserve workspace at query time never take either
+        // allocation path during capture.
+        bool must_use_stream_order(size_t total)
+        {
+            if(handle->device_memory_owner != rocblas_device_memory_ownership::rocblas_managed)
+                return false;
+            if(handle->stream_order_alloc)
+                return true;
+#if HIP_VERSION >= 50300000
+            return total > handle->device_memory_size - handle->device_memory_in_use
+                   && handle->is_stream_in_capture_mode();
+#else
+            return false;
+#endif
+        }
+
         // Allocate one or more pointers to buffers of different sizes
         template <typename... Ss>
         decltype(pointers) allocate_pointers(Ss... sizes)
@@ -511,8 +993,8 @@ private:
             const size_t offsets[] = {(old = size, size += roundup_device_memory_size(sizes), old)...};
             char* addr = nullptr;
 
-            if(handle->stream_order_alloc &&
-                handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+            stream_ordered = must_use_stream_order(size);
+            if(stream_ordered)
             {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
@@ -524,6 +1006,7 @@ private:
                 if(hipStatus != hipSuccess)
                 {
                     success = false;
+                    handle->device_memory_failed_alloc_count++;
                     rocblas_cerr << " rocBLAS internal error: hipMallocAsync() failed to allocate memory of size : " << size << std::endl;
                     return decltype(pointers)(sizeof...(sizes));
                 }
@@ -540,11 +1023,17 @@ private:
                 // If allocation failed, return an array of nullptr's
                 // If total size is 0, return an array of nullptr's, but leave it marked as successful
                 if(!success || !size)
+                {
+                    if(!success)
+                        handle->device_memory_failed_alloc_count++;
                     return decltype(pointers)(sizeof...(sizes));
+                }
 
                 // We allocate the total amount needed, taking it from the available device memory.
                 addr = static_cast<char*>(handle->device_memory) + handle->device_memory_in_use;
                 handle->device_memory_in_use += size;
+                if(handle->device_memory_in_use > handle->device_memory_high_watermark)
+                    handle->device_memory_high_watermark = handle->device_memory_in_use;
             }
             // An array of pointers to all of the allocated arrays is formed.
             // If a size is 0, the corresponding pointer is nullptr
@@ -575,13 +1064,15 @@ private:
             , stream_in_use(handle->stream)
             , success(true)
         {
-            if(handle->stream_order_alloc &&
-                handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+            stream_ordered = must_use_stream_order(size);
+            if(stream_ordered)
             {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
                 bool status = hipMallocAsync(&dev_mem, size, stream_in_use) == hipSuccess ;
+                if(!status)
+                    handle->device_memory_failed_alloc_count++;
 
                 for(auto i= 0 ; i < count ; i++)
                     pointers.push_back(status ? dev_mem : nullptr);
@@ -600,7 +1091,13 @@ private:
             }
 
             if(success)
+            {
                 handle->device_memory_in_use += size;
+                if(handle->device_memory_in_use > handle->device_memory_high_watermark)
+                    handle->device_memory_high_watermark = handle->device_memory_in_use;
+            }
+            else
+                handle->device_memory_failed_alloc_count++;
             }
         }
 
@@ -618,6 +1115,7 @@ private:
             , dev_mem(other.dev_mem)
             , stream_in_use(other.stream_in_use)
             , success(other.success)
+            , stream_ordered(other.stream_ordered)
             , pointers(std::move(other.pointers))
         {
             other.success = false;
@@ -641,8 +1139,7 @@ private:
             // If success == false or size == 0, the destructor is a no-op
             if(success && size)
             {
-                if(handle->stream_order_alloc &&
-                    handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+                if(stream_ordered)
                 {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
@@ -774,6 +1271,24 @@ public:
         return result;
     }
 
+    // Workspace for blas1 reductions: served from the handle's permanently
+    // reserved reduction scratch when the request fits, so the dot / nrm2 /
+    // asum / iamax hot path performs no per-call workspace accounting (and
+    // can never trigger a synchronizing reallocation). This also makes
+    // fitting requests legal under hip stream capture; oversized requests
+    // fall back to device_malloc(), whose on-demand growth cannot run while
+    // capturing (pre-size the pool with rocblas_set_device_memory_size)
+    auto reduction_malloc(size_t size)
+    {
+        if(reduction_workspace && size <= reduction_workspace_size)
+        {
+            auto scratch = _device_malloc(this, size_t(0));
+            scratch[0]   = reduction_workspace;
+            return scratch;
+        }
+        return _device_malloc(this, size);
+    }
+
     // Allocate count pointers, reserving "size" total bytes
     auto device_malloc_count(size_t count, size_t size)
     {
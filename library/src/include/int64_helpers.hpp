@@ -25,6 +25,8 @@
 #include <cstdint>
 #include <rocblas.h>
 
+#include "handle.hpp"
+
 #if defined(ROCBLAS_INTERNAL_ILP64)
 #define ROCBLAS_API(_f) _f##_64
 #else
@@ -60,9 +62,13 @@ constexpr int64_t c_i32_min = int64_t(std::numeric_limits<int32_t>::min());
 
 constexpr int64_t c_ILP64_i32_max = c_i32_max;
 
+// Chunk sizes are kept multiples of 256, the largest block tile the int32
+// dispatchers launch (NB == 256 thread blocks, gemvn DIM_X * 4 row groups),
+// so interior chunks are made of whole tiles and only the final chunk of a
+// dimension can carry a partial tile.
 constexpr int64_t c_i64_grid_X_chunk = 1ULL << 28;
 constexpr int64_t c_i64_grid_YZ_chunk
-    = int64_t((std::numeric_limits<uint16_t>::max() & ~0xf)); // % 16 == 0
+    = int64_t((std::numeric_limits<uint16_t>::max() & ~0xff)); // % 256 == 0
 
 #else
 
@@ -115,3 +121,81 @@ __forceinline__ __device__ __host__ auto
 {
     return p + block;
 }
+
+// Pipelines independent ILP64 chunk launches across the handle's two internal
+// streams so chunked operations keep the device busy across chunk boundaries
+// instead of serializing every chunk on the bound stream.  The fork waits for
+// prior work on the bound stream and the destructor joins the bound stream
+// behind every chunk, so ordering against the caller's stream is preserved.
+//
+// Only for chunk loops whose chunks are independent and allocate no device
+// memory (workspace accounting is keyed by the bound stream).  Usage:
+//
+//     rocblas_internal_chunk_pipeline pipeline(handle, n_chunks);
+//     for each chunk
+//     {
+//         pipeline.next_chunk(); // rebinds the handle to the next stream
+//         launch chunk
+//     }
+class rocblas_internal_chunk_pipeline
+{
+public:
+    static constexpr int c_num_chunk_streams = 2;
+
+    rocblas_internal_chunk_pipeline(rocblas_handle handle, int64_t n_chunks)
+        : m_handle(handle)
+        , m_user_stream(handle->get_stream())
+    {
+        // a single chunk has nothing to overlap; under graph capture the
+        // internal streams would fork outside of the captured graph
+        if(n_chunks < 2 || m_handle->is_stream_in_capture_mode())
+            return;
+
+        for(int i = 0; i < c_num_chunk_streams; i++)
+        {
+            if(!m_handle->chunk_streams[i]
+               && (hipStreamCreateWithFlags(&m_handle->chunk_streams[i], hipStreamNonBlocking)
+                       != hipSuccess
+                   || hipEventCreateWithFlags(&m_handle->chunk_events[i], hipEventDisableTiming)
+                          != hipSuccess))
+                return; // fall back to sequential chunks on the bound stream
+        }
+
+        // fork: the internal streams wait for prior work on the bound stream
+        if(hipEventRecord(m_handle->chunk_events[0], m_user_stream) != hipSuccess)
+            return;
+        for(int i = 0; i < c_num_chunk_streams; i++)
+            if(hipStreamWaitEvent(m_handle->chunk_streams[i], m_handle->chunk_events[0], 0)
+               != hipSuccess)
+                return;
+
+        m_active = true;
+    }
+
+    // rebind the handle to the next internal stream, round-robin per chunk
+    void next_chunk()
+    {
+        if(m_active)
+            m_handle->stream = m_handle->chunk_streams[m_next++ % c_num_chunk_streams];
+    }
+
+    ~rocblas_internal_chunk_pipeline()
+    {
+        m_handle->stream = m_user_stream;
+        if(!m_active)
+            return;
+
+        // join: the bound stream waits for every chunk before later work
+        for(int i = 0; i < c_num_chunk_streams; i++)
+        {
+            if(hipEventRecord(m_handle->chunk_events[i], m_handle->chunk_streams[i]) == hipSuccess)
+                (void)hipStreamWaitEvent(m_user_stream, m_handle->chunk_events[i], 0);
+        }
+    }
+
+private:
+    rocblas_handle m_handle;
+    hipStream_t    m_user_stream;
+    int            m_next   = 0;
+    bool           m_active = false;
+};
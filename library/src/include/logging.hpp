@@ -25,6 +25,7 @@
 #include "handle.hpp"
 #include "rocblas_ostream.hpp"
 #include "tuple_helper.hpp"
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <iomanip>
@@ -43,52 +44,125 @@
 /************************************************************************************
  * Profile kernel arguments
  ************************************************************************************/
+
+// If ROCBLAS_PROFILE_FLUSH_PATH names a file, the profile is also flushed to it
+// incrementally while the process runs, so a crash only loses the entries
+// counted since the last flush. The file is opened once (append-only within the
+// run) and shared by every profile table.
+inline rocblas_internal_ostream* profile_flush_stream()
+{
+    static auto stream = []() -> std::unique_ptr<rocblas_internal_ostream> {
+        const char* path = getenv("ROCBLAS_PROFILE_FLUSH_PATH");
+        if(!path || !*path)
+            return nullptr;
+        return std::make_unique<rocblas_internal_ostream>(path);
+    }();
+    return stream.get();
+}
+
+// Number of profiled calls between incremental flushes (per profile table)
+inline size_t profile_flush_interval()
+{
+    static size_t interval = [] {
+        const char* env   = getenv("ROCBLAS_PROFILE_FLUSH_INTERVAL");
+        long        value = env ? strtol(env, nullptr, 0) : 0;
+        return value > 0 ? size_t(value) : size_t(10000);
+    }();
+    return interval;
+}
+
 template <typename TUP>
 class argument_profile
 {
     // Output stream
     mutable rocblas_internal_ostream os;
 
+    // Private duplicate of the shared incremental flush stream, if configured;
+    // each table buffers its own records and delivers them atomically
+    mutable std::unique_ptr<rocblas_internal_ostream> flush_os;
+
+    // Profiled calls since the last incremental flush
+    mutable std::atomic<size_t> since_flush{0};
+
     // Mutex for multithreaded access to table
     mutable std::shared_timed_mutex mutex;
 
+    // Counts for one argument tuple: total calls, and how many of them have
+    // already been written by an incremental flush
+    struct counts_t
+    {
+        size_t count   = 0;
+        size_t flushed = 0;
+    };
+
     // Table mapping argument tuples into counts
-    // size_t is used for the map target type since atomic types are not movable, and
+    // Plain size_t members are used since atomic types are not movable, and
     // the map elements will only be moved when we hold an exclusive lock to the map.
     std::unordered_map<TUP,
-                       size_t,
+                       counts_t,
                        typename tuple_helper::hash_t<TUP>,
                        typename tuple_helper::equal_t<TUP>>
         map;
 
+    // Append the per-entry deltas since the previous flush; entries which have
+    // not changed are skipped. Summing call_count per shape over the file (plus
+    // the final dump) reproduces the aggregate profile.
+    void flush_incremental() const
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(mutex);
+
+        for(auto& p : map)
+        {
+            size_t delta = p.second.count - p.second.flushed;
+            if(!delta)
+                continue;
+            *flush_os << "- ";
+            tuple_helper::print_tuple_pairs(
+                *flush_os, std::tuple_cat(p.first, std::make_tuple("call_count", delta)));
+            p.second.flushed = p.second.count;
+        }
+
+        flush_os->flush();
+    }
+
 public:
     // A tuple of arguments is looked up in an unordered map.
     // A count of the number of calls with these arguments is kept.
     // arg is assumed to be an rvalue for efficiency
     void operator()(TUP&& arg)
     {
+        bool found = false;
+
         { // Acquire a shared lock for reading map
             std::shared_lock<std::shared_timed_mutex> lock(mutex);
 
             // Look up the tuple in the map
             auto p = map.find(arg);
 
-            // If tuple already exists, atomically increment count and return
+            // If tuple already exists, atomically increment count
             if(p != map.end())
             {
-                __atomic_fetch_add(&p->second, 1, __ATOMIC_SEQ_CST);
-                return;
+                __atomic_fetch_add(&p->second.count, 1, __ATOMIC_SEQ_CST);
+                found = true;
             }
         } // Release shared lock
 
+        if(!found)
         { // Acquire an exclusive lock for modifying map
             std::lock_guard<std::shared_timed_mutex> lock(mutex);
 
-            // If doesn't already exist, insert tuple by moving arg and initializing count to 0.
+            // If doesn't already exist, insert tuple by moving arg and initializing counts.
             // Increment the count after searching for tuple and returning old or new match.
             // We hold a lock to the map, so we don't have to increment the count atomically.
-            map.emplace(std::move(arg), 0).first->second++;
+            map.emplace(std::move(arg), counts_t{}).first->second.count++;
         } // Release exclusive lock
+
+        // Periodically append the deltas since the previous flush, so a crash
+        // only loses the counts of the current interval
+        if(flush_os && (since_flush.fetch_add(1, std::memory_order_relaxed) + 1)
+                               % profile_flush_interval()
+                           == 0)
+            flush_incremental();
     }
 
     // Constructor
@@ -96,6 +170,8 @@ public:
     explicit argument_profile(rocblas_internal_ostream& os)
         : os(os.dup())
     {
+        if(auto* shared_flush_os = profile_flush_stream())
+            flush_os = std::make_unique<rocblas_internal_ostream>(shared_flush_os->dup());
     }
 
     // Dump the current profile
@@ -112,7 +188,7 @@ public:
         {
             os << "- ";
             tuple_helper::print_tuple_pairs(
-                os, std::tuple_cat(p.first, std::make_tuple("call_count", p.second)));
+                os, std::tuple_cat(p.first, std::make_tuple("call_count", p.second.count)));
         }
 
         // Flush out the dump
@@ -123,6 +199,9 @@ public:
     ~argument_profile()
     try
     {
+        // Complete the incremental file before the final aggregate dump
+        if(flush_os)
+            flush_incremental();
         dump();
     }
     catch(...)
@@ -131,6 +210,20 @@ public:
     }
 };
 
+// Aggregate one completed argument tuple into the profile for its tuple type
+template <typename Tuple>
+void log_profile_tuple(rocblas_handle handle, Tuple&& tup)
+{
+    // Set up profile
+    static argument_profile<std::decay_t<Tuple>> profile(*handle->log_profile_os);
+
+    // Add at_quick_exit handler in case the program exits early
+    static int aqe = at_quick_exit([] { profile.~argument_profile(); });
+
+    // Profile the tuple
+    profile(std::move(tup));
+}
+
 // if profile logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_profile) != 0
 // log_profile will call argument_profile to profile actual arguments,
@@ -138,18 +231,44 @@ public:
 template <typename... Ts>
 void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
 {
-    // Make a tuple with the arguments
-    auto tup = std::make_tuple(
-        "rocblas_function", func, "atomics_mode", handle->atomics_mode, std::forward<Ts>(xs)...);
-
-    // Set up profile
-    static argument_profile<decltype(tup)> profile(*handle->log_profile_os);
+    // If ROCBLAS_PROFILE_SAMPLE_RATE=N with N > 1, only every Nth call is
+    // profiled, keeping the map lookup and lock off the remaining calls;
+    // recorded call counts are then in units of sampled calls
+    static size_t sample_rate = [] {
+        const char* env   = getenv("ROCBLAS_PROFILE_SAMPLE_RATE");
+        long        value = env ? strtol(env, nullptr, 0) : 0;
+        return value > 1 ? size_t(value) : size_t(1);
+    }();
+
+    if(sample_rate > 1)
+    {
+        static std::atomic<size_t> calls{0};
+        if(calls.fetch_add(1, std::memory_order_relaxed) % sample_rate)
+            return;
+    }
 
-    // Add at_quick_exit handler in case the program exits early
-    static int aqe = at_quick_exit([] { profile.~argument_profile(); });
+    // A call tag set with rocblas_set_call_tag becomes part of the
+    // aggregation key, so the profile separates identical shapes issued by
+    // different pipeline stages; untagged calls keep the untagged format
+    if(handle->call_tag)
+    {
+        log_profile_tuple(handle,
+                          std::make_tuple("rocblas_function",
+                                          func,
+                                          "call_tag",
+                                          handle->call_tag,
+                                          "atomics_mode",
+                                          handle->atomics_mode,
+                                          std::forward<Ts>(xs)...));
+        return;
+    }
 
-    // Profile the tuple
-    profile(std::move(tup));
+    log_profile_tuple(handle,
+                      std::make_tuple("rocblas_function",
+                                      func,
+                                      "atomics_mode",
+                                      handle->atomics_mode,
+                                      std::forward<Ts>(xs)...));
 }
 
 /********************************************
@@ -181,10 +300,29 @@ void log_trace(rocblas_handle handle, Ts&&... xs)
 template <typename... Ts>
 void log_bench(rocblas_handle handle, Ts&&... xs)
 {
+    // a call tag is appended as a shell comment so the logged line still
+    // replays through rocblas-bench unchanged
     if(handle->atomics_mode == rocblas_atomics_not_allowed)
-        log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., "--atomics_not_allowed");
+    {
+        if(handle->call_tag)
+            log_arguments(*handle->log_bench_os,
+                          " ",
+                          std::forward<Ts>(xs)...,
+                          "--atomics_not_allowed",
+                          "#",
+                          handle->call_tag);
+        else
+            log_arguments(
+                *handle->log_bench_os, " ", std::forward<Ts>(xs)..., "--atomics_not_allowed");
+    }
     else
-        log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)...);
+    {
+        if(handle->call_tag)
+            log_arguments(
+                *handle->log_bench_os, " ", std::forward<Ts>(xs)..., "#", handle->call_tag);
+        else
+            log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)...);
+    }
 }
 
 /*************************************************
@@ -43,26 +43,51 @@
 
 #define ROCBLAS_KERNEL_ILF __device__ __attribute__((always_inline))
 
+// Opt-in per-handle kernel timeline instrumentation (rocblas_set_kernel_timeline,
+// rocblas_auxiliary.cpp). When no handle has a timeline enabled the cost per
+// launch is a single relaxed atomic load; when one does, hipEvents are recorded
+// around the launch and attributed to the handle whose stream matches the
+// launch stream. The helper macros pick the kernel name and stream out of the
+// fixed hipLaunchKernelGGL argument positions.
+bool rocblas_internal_timeline_active();
+void rocblas_internal_timeline_begin(const char* name, hipStream_t stream);
+void rocblas_internal_timeline_end(hipStream_t stream);
+
+#define ROCBLAS_INTERNAL_LAUNCH_NAME_(kernel_, ...) #kernel_
+#define ROCBLAS_INTERNAL_LAUNCH_STREAM_(kernel_, grid_, block_, shared_, stream_, ...) stream_
+
 // we ignore pre-existing hipGetLastError as all internal hip calls should be guarded and so an external error
-#define ROCBLAS_LAUNCH_KERNEL(...)                                                 \
-    do                                                                             \
-    {                                                                              \
-        hipError_t pre_status = hipPeekAtLastError();                              \
-        hipLaunchKernelGGL(__VA_ARGS__);                                           \
-        hipError_t status = hipPeekAtLastError();                                  \
-        if(status != hipSuccess && status != pre_status)                           \
-            return rocblas_internal_convert_hip_to_rocblas_status_and_log(status); \
+#define ROCBLAS_LAUNCH_KERNEL(...)                                                         \
+    do                                                                                     \
+    {                                                                                      \
+        hipError_t pre_status       = hipPeekAtLastError();                                \
+        const bool launch_timeline_ = rocblas_internal_timeline_active();                  \
+        if(launch_timeline_)                                                               \
+            rocblas_internal_timeline_begin(ROCBLAS_INTERNAL_LAUNCH_NAME_(__VA_ARGS__),    \
+                                            ROCBLAS_INTERNAL_LAUNCH_STREAM_(__VA_ARGS__)); \
+        hipLaunchKernelGGL(__VA_ARGS__);                                                   \
+        if(launch_timeline_)                                                               \
+            rocblas_internal_timeline_end(ROCBLAS_INTERNAL_LAUNCH_STREAM_(__VA_ARGS__));   \
+        hipError_t status = hipPeekAtLastError();                                          \
+        if(status != hipSuccess && status != pre_status)                                   \
+            return rocblas_internal_convert_hip_to_rocblas_status_and_log(status);         \
     } while(0)
 
-#define ROCBLAS_LAUNCH_KERNEL_GRID(grid_, ...)                                         \
-    do                                                                                 \
-    {                                                                                  \
-        if(grid_.x != 0 && grid_.y != 0 && grid_.z != 0)                               \
-        {                                                                              \
-            hipError_t pre_status = hipPeekAtLastError();                              \
-            hipLaunchKernelGGL(__VA_ARGS__);                                           \
-            hipError_t status = hipPeekAtLastError();                                  \
-            if(status != hipSuccess && status != pre_status)                           \
-                return rocblas_internal_convert_hip_to_rocblas_status_and_log(status); \
-        }                                                                              \
+#define ROCBLAS_LAUNCH_KERNEL_GRID(grid_, ...)                                                 \
+    do                                                                                         \
+    {                                                                                          \
+        if(grid_.x != 0 && grid_.y != 0 && grid_.z != 0)                                       \
+        {                                                                                      \
+            hipError_t pre_status       = hipPeekAtLastError();                                \
+            const bool launch_timeline_ = rocblas_internal_timeline_active();                  \
+            if(launch_timeline_)                                                               \
+                rocblas_internal_timeline_begin(ROCBLAS_INTERNAL_LAUNCH_NAME_(__VA_ARGS__),    \
+                                                ROCBLAS_INTERNAL_LAUNCH_STREAM_(__VA_ARGS__)); \
+            hipLaunchKernelGGL(__VA_ARGS__);                                                   \
+            if(launch_timeline_)                                                               \
+                rocblas_internal_timeline_end(ROCBLAS_INTERNAL_LAUNCH_STREAM_(__VA_ARGS__));   \
+            hipError_t status = hipPeekAtLastError();                                          \
+            if(status != hipSuccess && status != pre_status)                                   \
+                return rocblas_internal_convert_hip_to_rocblas_status_and_log(status);         \
+        }                                                                                      \
     } while(0)
@@ -24,6 +24,7 @@
 
 #include "rocblas.h"
 #include "utility.hpp"
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <condition_variable>
@@ -36,7 +37,6 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
-#include <queue>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -79,61 +79,72 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
      **************************************************************************/
     class worker
     {
-        // task_t represents a payload of data and a promise to finish
-        class task_t
+        // A record is a preformatted payload; the promise is only non-null for
+        // synchronous records (worker shutdown), which the sender waits on
+        struct record_t
         {
-            std::string        m_str;
-            std::promise<void> m_promise;
-
-        public:
-            // The task takes ownership of the string payload and promise
-            task_t(std::string&& str, std::promise<void>&& promise)
-                : m_str(std::move(str))
-                , m_promise(std::move(promise))
-            {
-            }
-
-            // Notify the future to wake up
-            void set_value()
-            {
-                m_promise.set_value();
-            }
+            std::string                         str;
+            std::shared_ptr<std::promise<void>> promise;
+        };
 
-            // Size of the string payload
-            size_t size() const
-            {
-                return m_str.size();
-            }
+        // Capacity of the bounded lock-free MPSC ring; must be a power of two
+        static constexpr size_t RING_SIZE = 1024;
 
-            // Data of the string payload
-            const char* data() const
-            {
-                return m_str.data();
-            }
+        // Each slot publishes its record through the sequence number, so
+        // producers never contend on a mutex on the logging hot path
+        struct ring_slot_t
+        {
+            record_t            rec;
+            std::atomic<size_t> seq;
         };
 
         // FILE is used for safety in the presence of signals
         FILE* m_file = nullptr;
 
+        // True when m_file is a popen() pipe to a compressor process and
+        // must be closed with pclose()
+        bool m_is_pipe = false;
+
         // This worker's thread
         std::thread m_thread;
 
-        // Condition variable for worker notification
+        // Condition variable used as a doorbell for an idle worker
         std::condition_variable m_cond;
 
-        // Mutex for this thread's queue
+        // Mutex only held by the worker while it waits for the doorbell
         std::mutex m_mutex;
 
-        // Queue of tasks
-        std::queue<task_t> m_queue;
+        // Lock-free MPSC ring buffer of records
+        std::unique_ptr<ring_slot_t[]> m_ring;
+
+        // Producers claim slots by advancing m_enqueue_pos with a CAS;
+        // m_dequeue_pos is owned by the single consumer thread
+        alignas(64) std::atomic<size_t> m_enqueue_pos{0};
+        alignas(64) size_t m_dequeue_pos = 0;
+
+        // Set when the worker thread exits, so senders stop queueing work
+        std::atomic<bool> m_exited{false};
+
+        // Claim a slot and publish a record; fails when the ring is full
+        bool try_enqueue(record_t&& rec);
 
-        // Worker thread which waits for and handles tasks sequentially
+        // Consumer-only: take the oldest published record, if any
+        bool dequeue(record_t& rec);
+
+        // Consumer-only: true when no published record is pending
+        bool ring_empty() const;
+
+        // Worker thread which waits for and handles records sequentially
         void thread_function();
 
     public:
         // Worker constructor creates a worker thread for a raw filehandle
         explicit worker(int fd);
 
+        // Worker constructor taking ownership of an already-open FILE; used
+        // for compressor pipes, which must be closed with pclose()
+        worker(FILE* file, bool is_pipe);
+
         // Send a string to be written
         void send(std::string);
 
@@ -190,6 +201,11 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
     // Get worker for file descriptor
     static std::shared_ptr<worker> get_worker(int fd);
 
+#ifndef WIN32
+    // Get worker streaming through a zstd compressor process into filename
+    static std::shared_ptr<worker> get_worker_for_compressed_file(const char* filename);
+#endif
+
     // Private explicit copy constructor duplicates the worker and starts a new buffer
     explicit rocblas_internal_ostream(const rocblas_internal_ostream& other)
         : m_worker_ptr(other.m_worker_ptr)
@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+// Mini-scheduler for the internal stages of a multi-kernel algorithm.
+// Stage dependencies are expressed with hipEvents across a small internal
+// stream pool, so stages with no dependency between them overlap on the
+// device instead of serializing back-to-back on the bound stream. The pool
+// is the handle's priority stream pair when the device supports stream
+// priorities (slot 0 elevated, slot 1 reduced, so stages marked background
+// yield the device to latency-critical streams), otherwise the same
+// non-priority pool rocblas_internal_chunk_pipeline uses.
+//
+// Stages must be enqueued in a valid sequential order (a topological order of
+// the dependency graph), and a stage's dependencies must have ended before it
+// begins. When the scheduler cannot activate (graph capture, or stream/event
+// creation failed) every stage simply runs in enqueue order on the bound
+// stream, which is then still correct.
+//
+// Only for stages which allocate no device memory (workspace accounting is
+// keyed by the bound stream). Usage:
+//
+//     rocblas_internal_stage_scheduler sched(handle);
+//     sched.begin_stage(0, {});     // rebinds the handle for the stage
+//     launch stage 0
+//     sched.end_stage(0);
+//     sched.begin_stage(1, {});     // no dependency on 0: may overlap it
+//     launch stage 1
+//     sched.end_stage(1);
+//     sched.begin_stage(2, {0, 1}); // waits for both before running
+//     launch stage 2
+//     sched.end_stage(2);
+//     // destructor restores the bound stream and joins it behind every stage
+class rocblas_internal_stage_scheduler
+{
+public:
+    static constexpr int c_num_stage_streams = 2;
+    static constexpr int c_max_stages        = _rocblas_handle::c_num_stage_events;
+
+    explicit rocblas_internal_stage_scheduler(rocblas_handle handle)
+        : m_handle(handle)
+        , m_user_stream(handle->get_stream())
+    {
+        // under graph capture the internal streams would fork outside of the
+        // captured graph
+        if(m_handle->is_stream_in_capture_mode())
+            return;
+
+        // prefer the handle's priority stream pair: slot 0 runs at elevated
+        // priority for the critical path and slot 1 at reduced priority, so
+        // background stages never steal the device from the bound stream
+        if(m_handle->priority_streams[0] && m_handle->priority_streams[1])
+        {
+            for(int i = 0; i < c_num_stage_streams; i++)
+                m_streams[i] = m_handle->priority_streams[i];
+        }
+        else
+        {
+            for(int i = 0; i < c_num_stage_streams; i++)
+            {
+                if(!m_handle->chunk_streams[i]
+                   && hipStreamCreateWithFlags(&m_handle->chunk_streams[i], hipStreamNonBlocking)
+                          != hipSuccess)
+                    return; // fall back to sequential stages on the bound stream
+                m_streams[i] = m_handle->chunk_streams[i];
+            }
+        }
+
+        for(int i = 0; i < c_num_stage_streams; i++)
+            if(!m_handle->chunk_events[i]
+               && hipEventCreateWithFlags(&m_handle->chunk_events[i], hipEventDisableTiming)
+                      != hipSuccess)
+                return;
+
+        for(int i = 0; i < c_max_stages; i++)
+            if(!m_handle->stage_events[i]
+               && hipEventCreateWithFlags(&m_handle->stage_events[i], hipEventDisableTiming)
+                      != hipSuccess)
+                return;
+
+        // fork: the internal streams wait for prior work on the bound stream
+        if(hipEventRecord(m_handle->chunk_events[0], m_user_stream) != hipSuccess)
+            return;
+        for(int i = 0; i < c_num_stage_streams; i++)
+            if(hipStreamWaitEvent(m_streams[i], m_handle->chunk_events[0], 0) != hipSuccess)
+                return;
+
+        m_active = true;
+    }
+
+    // Rebind the handle to the stage's internal stream after it waits for the
+    // completion events of the listed stages. Returns whether the scheduler
+    // is active; when inactive the handle stays on the bound stream. A
+    // background stage is pinned to slot 1, which runs at reduced priority
+    // when the handle's priority stream pair is available.
+    bool begin_stage(int stage, std::initializer_list<int> deps, bool background = false)
+    {
+        if(!m_active)
+            return false;
+
+        int slot                     = background ? 1 : stage % c_num_stage_streams;
+        m_slot[stage % c_max_stages] = slot;
+
+        hipStream_t stream = m_streams[slot];
+        for(int dep : deps)
+            (void)hipStreamWaitEvent(stream, m_handle->stage_events[dep % c_max_stages], 0);
+        m_handle->stream = stream;
+        return true;
+    }
+
+    // Record the stage's completion event so later stages can depend on it
+    void end_stage(int stage)
+    {
+        if(m_active)
+            (void)hipEventRecord(m_handle->stage_events[stage % c_max_stages],
+                                 m_streams[m_slot[stage % c_max_stages]]);
+    }
+
+    ~rocblas_internal_stage_scheduler()
+    {
+        m_handle->stream = m_user_stream;
+        if(!m_active)
+            return;
+
+        // join: the bound stream waits for every stage before later work
+        for(int i = 0; i < c_num_stage_streams; i++)
+        {
+            if(hipEventRecord(m_handle->chunk_events[i], m_streams[i]) == hipSuccess)
+                (void)hipStreamWaitEvent(m_user_stream, m_handle->chunk_events[i], 0);
+        }
+    }
+
+private:
+    rocblas_handle m_handle;
+    hipStream_t    m_user_stream;
+    hipStream_t    m_streams[c_num_stage_streams] = {};
+    int            m_slot[c_max_stages]           = {};
+    bool           m_active = false;
+};
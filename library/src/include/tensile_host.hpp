@@ -299,11 +299,32 @@ rocblas_status getAllSolutions(const RocblasContractionProblem<TiA, To, Tc, TiB,
                                rocblas_int* list_array,
                                rocblas_int* list_size);
 
+/*******************************************************************************
+ * preloadContractionProblem() loads and finalizes the code objects needed by  *
+ * a problem shape without executing anything, so that lazily loaded kernels   *
+ * can be warmed per shape instead of all at once via rocblas_initialize()     *
+ *******************************************************************************/
+template <typename TiA,
+          typename To,
+          typename Tc,
+          typename TiB = TiA,
+          typename TcA = TiA,
+          typename TcB = TiA>
+rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& problem);
+
 /***********************************************************************************
  * Whether Tensile has been initialized for at least one device (used for testing) *
  ***********************************************************************************/
 ROCBLAS_INTERNAL_EXPORT std::atomic_bool& rocblas_internal_tensile_is_initialized();
 
+/***********************************************************************************
+ * Count of acquisitions of the shared Tensile host locks (adapter initialization  *
+ * and the solution index cache) which found the lock already held and had to wait *
+ * (read by rocblas-bench --scaling to attribute multi-handle contention)          *
+ ***********************************************************************************/
+ROCBLAS_INTERNAL_EXPORT std::atomic<uint64_t>& rocblas_internal_lock_wait_count();
+
 /***********************************************************************************
  * Whether rocblas_initialize() is invoked to load all tensile kernels at startup  *
  ***********************************************************************************/
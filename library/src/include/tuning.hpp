@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/* Out-of-band GEMM tuning. ROCBLAS_TUNING_FILE names a file of shape entries,
+ * one per line, recording the best solution index found offline with the
+ * gemm_tune client:
+ *
+ *     # comments and blank lines are ignored
+ *     - {transA: N, transB: T, m: 1024, n: 64, k: 512, a_type: f16_r, compute_type: f32_r, solution_index: 271}
+ *     - {transA: N, transB: N, m: 4096, n: 4096, k: 64, a_type: f32_r, compute_type: f32_r, solution_index: 88, flags: 4}
+ *
+ * The file is parsed once, on first handle creation; gemm_ex consults the
+ * table for calls that have not selected a solution themselves and runs a
+ * matching shape with the recorded solution index (and any extra
+ * rocblas_gemm_flags bits). Unparseable lines are skipped.
+ */
+
+struct rocblas_tuning_entry
+{
+    int32_t  solution_index = 0;
+    uint32_t flags          = 0;
+};
+
+class rocblas_tuning_table
+{
+public:
+    // Shared table parsed from ROCBLAS_TUNING_FILE on first use; nullptr when
+    // the variable is unset or the file has no usable entries
+    static const rocblas_tuning_table* instance();
+
+    // nullptr when no entry matches the shape
+    const rocblas_tuning_entry* find(rocblas_operation transA,
+                                     rocblas_operation transB,
+                                     int64_t           m,
+                                     int64_t           n,
+                                     int64_t           k,
+                                     rocblas_datatype  a_type,
+                                     rocblas_datatype  compute_type) const;
+
+private:
+    rocblas_tuning_table() = default;
+
+    std::unordered_map<std::string, rocblas_tuning_entry> m_entries;
+};
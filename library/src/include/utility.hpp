@@ -30,6 +30,7 @@
 #include <hip/hip_runtime.h>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #pragma STDC CX_LIMITED_RANGE ON
 
@@ -38,6 +39,114 @@ typedef rocblas_half rocblas_half8 __attribute__((ext_vector_type(8)));
 typedef rocblas_half rocblas_half2 __attribute__((ext_vector_type(2)));
 typedef rocblas_half rocblas_half4 __attribute__((ext_vector_type(4)));
 
+// 128-bit float/double vectors for bandwidth-bound elementwise kernels
+typedef float  rocblas_float4 __attribute__((ext_vector_type(4)));
+typedef double rocblas_double2 __attribute__((ext_vector_type(2)));
+
+// 16-byte chunk of elements for unit-stride memory-movement kernels. The
+// alignment lets the compiler move the whole chunk with a single 128-bit
+// load/store when the underlying pointers are 16-byte aligned.
+template <typename T>
+struct alignas(16) rocblas_chunk16
+{
+    T data[16 / sizeof(T)];
+};
+
+__forceinline__ __device__ __host__ bool rocblas_is_16B_aligned(const void* ptr)
+{
+    return (reinterpret_cast<size_t>(ptr) & 15) == 0;
+}
+
+// Outputs at least this large cannot be retained by L2 anyway, so write-once
+// kernels store them with nontemporal hints (see rocblas_store below),
+// keeping the cache for the operands of following calls. 8 MiB covers the
+// L2 of current targets.
+constexpr size_t c_rocblas_stream_store_min_bytes = size_t(8) << 20;
+
+// Nontemporal store for write-once kernel outputs. The builtin only accepts
+// types that lower to plain scalar/vector stores, so composite element types
+// (complex, half, the chunk wrappers above) are routed through same-size
+// unsigned words.
+typedef uint32_t rocblas_uint4 __attribute__((ext_vector_type(4)));
+
+template <typename T>
+__forceinline__ __device__ void rocblas_nontemporal_store(T val, T* dst)
+{
+    if constexpr(std::is_arithmetic_v<T>)
+        __builtin_nontemporal_store(val, dst);
+    else if constexpr(sizeof(T) == 16 && alignof(T) == 16)
+    {
+        rocblas_uint4 w;
+        __builtin_memcpy(&w, &val, sizeof(w));
+        __builtin_nontemporal_store(w, (rocblas_uint4*)dst);
+    }
+    else if constexpr(sizeof(T) == 16)
+    {
+        // 16-byte type only guaranteed 8-byte alignment (complex double)
+        uint64_t w[2];
+        __builtin_memcpy(w, &val, sizeof(w));
+        __builtin_nontemporal_store(w[0], (uint64_t*)dst);
+        __builtin_nontemporal_store(w[1], (uint64_t*)dst + 1);
+    }
+    else if constexpr(sizeof(T) == 8)
+    {
+        uint64_t w;
+        __builtin_memcpy(&w, &val, sizeof(w));
+        __builtin_nontemporal_store(w, (uint64_t*)dst);
+    }
+    else if constexpr(sizeof(T) == 4)
+    {
+        uint32_t w;
+        __builtin_memcpy(&w, &val, sizeof(w));
+        __builtin_nontemporal_store(w, (uint32_t*)dst);
+    }
+    else
+    {
+        static_assert(sizeof(T) == 2, "unsupported element size for streaming store");
+        uint16_t w;
+        __builtin_memcpy(&w, &val, sizeof(w));
+        __builtin_nontemporal_store(w, (uint16_t*)dst);
+    }
+}
+
+// Store with a compile-time streaming knob for kernels templated on whether
+// their output is write-once and larger than c_rocblas_stream_store_min_bytes
+template <bool STREAM, typename T>
+__forceinline__ __device__ void rocblas_store(T val, T* dst)
+{
+    if constexpr(STREAM)
+        rocblas_nontemporal_store(val, dst);
+    else
+        *dst = val;
+}
+
+// Predicated (masked) accesses for vector-width tails. The loops have a
+// compile-time trip count, so the compiler fully unrolls them and folds the
+// per-element bound into the lane's exec mask instead of emitting the
+// count-dependent backward branch a runtime-bounded cleanup loop costs every
+// wavefront touching the tail. With count == CHUNK the predicates fold away
+// and the accesses match a plain unrolled scalar path, so a single masked
+// group also serves as the fallback for unaligned full groups. Lanes past
+// count load a zero so the compute over the full register set stays defined.
+template <int CHUNK, typename T>
+__forceinline__ __device__ void rocblas_masked_load(const T* __restrict__ src,
+                                                    int count,
+                                                    T (&vals)[CHUNK])
+{
+    for(int j = 0; j < CHUNK; ++j)
+        vals[j] = j < count ? src[j] : T(0);
+}
+
+template <int CHUNK, typename T>
+__forceinline__ __device__ void rocblas_masked_store(const T (&vals)[CHUNK],
+                                                     int count,
+                                                     T* __restrict__ dst)
+{
+    for(int j = 0; j < CHUNK; ++j)
+        if(j < count)
+            dst[j] = vals[j];
+}
+
 #ifndef GOOGLE_TEST
 extern "C" __device__ rocblas_half2 llvm_fma_v2f16(rocblas_half2,
                                                    rocblas_half2,
@@ -49,6 +158,157 @@ __device__ inline rocblas_half2
     return llvm_fma_v2f16(multiplier, multiplicand, addend);
 }
 
+typedef float rocblas_float2 __attribute__((ext_vector_type(2)));
+
+extern "C" __device__ rocblas_float2 llvm_fma_v2f32(rocblas_float2,
+                                                    rocblas_float2,
+                                                    rocblas_float2) __asm("llvm.fma.v2f32");
+
+extern "C" __device__ rocblas_double2 llvm_fma_v2f64(rocblas_double2,
+                                                     rocblas_double2,
+                                                     rocblas_double2) __asm("llvm.fma.v2f64");
+
+// Multiply-add a * b + c for the inner loops of the blas1/blas2 family. For
+// the complex types the four real multiply-adds are evaluated as two packed
+// two-lane FMAs over {real, imag} registers (v_pk_fma_f32 / paired v_fma_f64
+// on gfx9) instead of the scalar real/imag interleaved sequence the plain
+// expression compiles to; for other types this is just the plain expression.
+template <typename Ta, typename Tb, typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__forceinline__ __device__ __host__ T rocblas_cmadd(Ta a, Tb b, T c)
+{
+    return c + a * b;
+}
+
+__forceinline__ __device__ rocblas_float_complex rocblas_cmadd(rocblas_float_complex a,
+                                                               rocblas_float_complex b,
+                                                               rocblas_float_complex c)
+{
+    rocblas_float2 t = llvm_fma_v2f32(rocblas_float2{a.real(), a.real()},
+                                      rocblas_float2{b.real(), b.imag()},
+                                      rocblas_float2{c.real(), c.imag()});
+    t                = llvm_fma_v2f32(
+        rocblas_float2{-a.imag(), a.imag()}, rocblas_float2{b.imag(), b.real()}, t);
+    return rocblas_float_complex{t.x, t.y};
+}
+
+__forceinline__ __device__ rocblas_double_complex rocblas_cmadd(rocblas_double_complex a,
+                                                                rocblas_double_complex b,
+                                                                rocblas_double_complex c)
+{
+    rocblas_double2 t = llvm_fma_v2f64(rocblas_double2{a.real(), a.real()},
+                                       rocblas_double2{b.real(), b.imag()},
+                                       rocblas_double2{c.real(), c.imag()});
+    t                 = llvm_fma_v2f64(
+        rocblas_double2{-a.imag(), a.imag()}, rocblas_double2{b.imag(), b.real()}, t);
+    return rocblas_double_complex{t.x, t.y};
+}
+
+// Flush a denormal value to a zero of the same sign. Used by the FTZ kernel
+// variants selected through rocblas_set_flush_denorms: flushing the loaded
+// operands and results keeps the arithmetic out of the hardware's slow
+// denormal paths, trading the denormal range for data-independent throughput.
+__forceinline__ __device__ rocblas_half rocblas_flush_denorm(rocblas_half v)
+{
+    union
+    {
+        rocblas_half h;
+        uint16_t     u;
+    } t = {v};
+    if(!(t.u & 0x7c00))
+        t.u &= 0x8000;
+    return t.h;
+}
+
+// two packed half lanes, for the rocblas_half2 kernels
+__forceinline__ __device__ rocblas_half2 rocblas_flush_denorm(rocblas_half2 v)
+{
+    union
+    {
+        rocblas_half2 value;
+        uint32_t      data;
+    } t = {v};
+    if(!(t.data & 0x00007c00))
+        t.data &= 0xffff8000;
+    if(!(t.data & 0x7c000000))
+        t.data &= 0x8000ffff;
+    return t.value;
+}
+
+__forceinline__ __device__ rocblas_bfloat16 rocblas_flush_denorm(rocblas_bfloat16 v)
+{
+    if(!(v.data & 0x7f80))
+        v.data &= 0x8000;
+    return v;
+}
+
+__forceinline__ __device__ float rocblas_flush_denorm(float v)
+{
+    union
+    {
+        float    f;
+        uint32_t u;
+    } t = {v};
+    if(!(t.u & 0x7f800000))
+        t.u &= 0x80000000;
+    return t.f;
+}
+
+__forceinline__ __device__ double rocblas_flush_denorm(double v)
+{
+    union
+    {
+        double   d;
+        uint64_t u;
+    } t = {v};
+    if(!(t.u & 0x7ff0000000000000ull))
+        t.u &= 0x8000000000000000ull;
+    return t.d;
+}
+
+__forceinline__ __device__ rocblas_float_complex rocblas_flush_denorm(rocblas_float_complex v)
+{
+    return {rocblas_flush_denorm(v.real()), rocblas_flush_denorm(v.imag())};
+}
+
+__forceinline__ __device__ rocblas_double_complex rocblas_flush_denorm(rocblas_double_complex v)
+{
+    return {rocblas_flush_denorm(v.real()), rocblas_flush_denorm(v.imag())};
+}
+
+// compile-time-selected flush: compiles to nothing in the FTZ=false variants
+template <bool FTZ, typename T>
+__forceinline__ __device__ T rocblas_ftz(T v)
+{
+    if constexpr(FTZ)
+        return rocblas_flush_denorm(v);
+    else
+        return v;
+}
+
+// Map a linear index over the n*(n+1)/2 stored elements of a packed
+// triangular matrix back to its (row, col) coordinates, for kernels which
+// launch one thread per stored element instead of masking out half of an
+// n x n grid. The packed layouts are col*(col+1)/2 + row (upper, row <= col)
+// and col*(2n - col + 1)/2 + row - col (lower, row >= col); the lower case
+// reuses the upper inverse on the reversed sequence. The double sqrt is only
+// a first guess; the fixup loops make the outer coordinate exact.
+__forceinline__ __device__ void rocblas_packed_triangle_coords(
+    bool is_upper, rocblas_int n, int64_t pid, rocblas_int& row, rocblas_int& col)
+{
+    if(!is_upper)
+        pid = int64_t(n) * (n + 1) / 2 - 1 - pid;
+
+    rocblas_int c = rocblas_int((sqrt(8.0 * double(pid) + 1.0) - 1.0) * 0.5);
+    while(int64_t(c) * (c + 1) / 2 > pid)
+        c--;
+    while(int64_t(c + 1) * (c + 2) / 2 <= pid)
+        c++;
+    rocblas_int r = rocblas_int(pid - int64_t(c) * (c + 1) / 2);
+
+    row = is_upper ? r : n - 1 - r;
+    col = is_upper ? c : n - 1 - c;
+}
+
 // Conjugate a value. For most types, simply return argument; for
 // rocblas_float_complex and rocblas_double_complex, return std::conj(z)
 template <typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
@@ -183,6 +443,44 @@ __forceinline__ __device__ __host__ T*
 }
 // clang-format on
 
+// Host-side detection of a strided batch hiding behind a batched pointer
+// array: copies the device pointer array down and checks whether every
+// pointer sits a fixed element stride from the first. Batched kernels
+// re-dereference the pointer array in every workgroup — an extra dependent
+// load per tile — so large batches that are really strided win by switching
+// to strided addressing. The check costs a small copy plus a stream
+// synchronize, hence the minimum batch count below; callers must also skip
+// it while the stream is capturing a graph.
+constexpr rocblas_int c_batch_stride_detect_min_batch = 512;
+
+template <typename T>
+inline bool rocblas_internal_uniform_batch_stride(
+    hipStream_t stream, T* const* ptr_array, rocblas_int batch_count, T*& base, rocblas_stride& stride)
+{
+    std::vector<T*> ptrs(batch_count);
+    if(hipMemcpyAsync(ptrs.data(),
+                      ptr_array,
+                      sizeof(T*) * batch_count,
+                      hipMemcpyDeviceToHost,
+                      stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return false;
+
+    ptrdiff_t byte_stride
+        = batch_count > 1 ? (const char*)ptrs[1] - (const char*)ptrs[0] : ptrdiff_t(0);
+    if(byte_stride % ptrdiff_t(sizeof(T)))
+        return false;
+
+    for(rocblas_int b = 2; b < batch_count; b++)
+        if((const char*)ptrs[b] - (const char*)ptrs[0] != b * byte_stride)
+            return false;
+
+    base   = ptrs[0];
+    stride = byte_stride / ptrdiff_t(sizeof(T));
+    return true;
+}
+
 /*******************************************************************************
  * \brief convert hipError_t to rocblas_status
  ******************************************************************************/
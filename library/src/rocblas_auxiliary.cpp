@@ -20,13 +20,27 @@
  *
  *
  * ************************************************************************ */
+#define ROCBLAS_BETA_FEATURES_API // for the kernel-timeline entry struct
+
+#include "check_numerics_vector.hpp"
+#include "cpu_overhead.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas-auxiliary.h"
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 /* ============================================================================================ */
 
@@ -120,6 +134,438 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief bind a device-side execution predicate to the handle (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_device_predicate(rocblas_handle     handle,
+                                                       const rocblas_int* device_predicate)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_device_predicate", (const void*)device_predicate);
+    handle->device_predicate = device_predicate;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set the base seed for stochastic-rounding conversions (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_stochastic_seed(rocblas_handle handle, uint32_t seed)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_stochastic_seed", seed);
+    handle->sr_seed = seed;
+    handle->sr_call_count.store(0, std::memory_order_relaxed);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief tag subsequent calls in the profile and bench logs (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_call_tag(rocblas_handle handle, const char* tag)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_call_tag", tag && *tag ? tag : "(cleared)");
+
+    if(!tag || !*tag)
+    {
+        handle->call_tag = nullptr;
+        return rocblas_status_success;
+    }
+
+    // Tags are interned for the life of the process: the profile keeps the
+    // pointer in aggregation keys which outlive both the caller's string and
+    // possibly the handle, including during static destruction when the
+    // profile is dumped, so the intern table is deliberately never destroyed.
+    static std::mutex mutex;
+    static auto&      tags = *new std::vector<std::unique_ptr<std::string>>;
+
+    std::lock_guard<std::mutex> guard(mutex);
+    for(auto& t : tags)
+    {
+        if(*t == tag)
+        {
+            handle->call_tag = t->c_str();
+            return rocblas_status_success;
+        }
+    }
+    tags.push_back(std::make_unique<std::string>(tag));
+    handle->call_tag = tags.back()->c_str();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Kernel-launch timeline instrumentation (BLAS BETA). The launch macros in
+ * macros.hpp call the three rocblas_internal_timeline_* hooks below around
+ * every internal kernel launch; when no handle has a timeline enabled the
+ * active() fast path is a single relaxed atomic load.
+ ******************************************************************************/
+
+namespace
+{
+    // handles with an active timeline; typically zero or one entries
+    std::atomic<int>            timeline_handle_count{0};
+    std::mutex                  timeline_mutex;
+    std::vector<rocblas_handle> timeline_handles;
+
+    // slot of the launch in flight between begin() and end() on this thread
+    thread_local rocblas_internal_kernel_timeline::slot* timeline_pending = nullptr;
+
+    // destroys the ring's events and detaches it from the handle;
+    // timeline_mutex must be held
+    void timeline_destroy(rocblas_handle handle)
+    {
+        auto& tl = *handle->kernel_timeline;
+        for(auto& slot : tl.slots)
+        {
+            if(slot.start)
+                (void)(hipEventDestroy)(slot.start);
+            if(slot.stop)
+                (void)(hipEventDestroy)(slot.stop);
+        }
+        if(tl.base)
+            (void)(hipEventDestroy)(tl.base);
+        handle->kernel_timeline.reset();
+    }
+}
+
+bool rocblas_internal_timeline_active()
+{
+    return timeline_handle_count.load(std::memory_order_relaxed) != 0;
+}
+
+void rocblas_internal_timeline_begin(const char* name, hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(timeline_mutex);
+    timeline_pending = nullptr;
+    for(auto handle : timeline_handles)
+    {
+        if(handle->get_stream() != stream)
+            continue;
+
+        auto&    tl     = *handle->kernel_timeline;
+        uint64_t serial = tl.next.fetch_add(1, std::memory_order_relaxed);
+        auto&    slot   = tl.slots[serial % tl.slots.size()];
+        slot.name       = name;
+        slot.serial     = serial;
+        if(hipEventRecord(slot.start, stream) == hipSuccess)
+            timeline_pending = &slot;
+        return;
+    }
+}
+
+void rocblas_internal_timeline_end(hipStream_t stream)
+{
+    if(timeline_pending)
+    {
+        (void)hipEventRecord(timeline_pending->stop, stream);
+        timeline_pending = nullptr;
+    }
+}
+
+void rocblas_internal_timeline_release(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(timeline_mutex);
+    auto it = std::find(timeline_handles.begin(), timeline_handles.end(), handle);
+    if(it != timeline_handles.end())
+    {
+        timeline_handles.erase(it);
+        timeline_handle_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+    timeline_destroy(handle);
+}
+
+/*******************************************************************************
+ * ! \brief enable or disable the per-kernel launch timeline (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_kernel_timeline(rocblas_handle handle, uint32_t depth)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_kernel_timeline", depth);
+
+    // drop any existing ring before resizing or disabling
+    if(handle->kernel_timeline)
+        rocblas_internal_timeline_release(handle);
+    if(!depth)
+        return rocblas_status_success;
+
+    auto tl = std::make_unique<rocblas_internal_kernel_timeline>();
+    tl->slots.resize(depth);
+
+    hipError_t status = hipEventCreate(&tl->base);
+    for(auto& slot : tl->slots)
+    {
+        if(status == hipSuccess)
+            status = hipEventCreate(&slot.start);
+        if(status == hipSuccess)
+            status = hipEventCreate(&slot.stop);
+    }
+    // all timestamps are reported relative to this point on the handle's stream
+    if(status == hipSuccess)
+        status = hipEventRecord(tl->base, handle->get_stream());
+
+    if(status != hipSuccess)
+    {
+        handle->kernel_timeline = std::move(tl);
+        std::lock_guard<std::mutex> lock(timeline_mutex);
+        timeline_destroy(handle);
+        return rocblas_internal_convert_hip_to_rocblas_status_and_log(status);
+    }
+
+    handle->kernel_timeline = std::move(tl);
+    std::lock_guard<std::mutex> lock(timeline_mutex);
+    timeline_handles.push_back(handle);
+    timeline_handle_count.fetch_add(1, std::memory_order_relaxed);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief sample the completed entries of the kernel timeline (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_kernel_timeline(rocblas_handle                 handle,
+                                                      uint32_t*                      count,
+                                                      rocblas_kernel_timeline_entry* timeline)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count)
+        return rocblas_status_invalid_pointer;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_kernel_timeline", (const void*)count, (const void*)timeline);
+
+    if(!handle->kernel_timeline)
+    {
+        *count = 0;
+        return rocblas_status_success;
+    }
+
+    uint32_t capacity = timeline ? *count : std::numeric_limits<uint32_t>::max();
+    uint32_t written  = 0;
+
+    std::lock_guard<std::mutex> lock(timeline_mutex);
+
+    auto&    tl    = *handle->kernel_timeline;
+    uint64_t total = tl.next.load(std::memory_order_relaxed);
+    uint64_t depth = tl.slots.size();
+    uint64_t first = total > depth ? total - depth : 0;
+
+    for(uint64_t serial = first; serial < total && written < capacity; serial++)
+    {
+        auto& slot = tl.slots[serial % depth];
+
+        // events complete in stream order, so the first still-running stop
+        // event ends the sample
+        if(hipEventQuery(slot.stop) != hipSuccess)
+            break;
+
+        if(timeline)
+        {
+            float start_ms = 0, duration_ms = 0;
+            (void)hipEventElapsedTime(&start_ms, tl.base, slot.start);
+            (void)hipEventElapsedTime(&duration_ms, slot.start, slot.stop);
+            timeline[written] = {slot.name, slot.serial, start_ms, duration_ms};
+        }
+        written++;
+    }
+
+    *count = written;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief enable or disable per-call launch metrics collection (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_call_metrics(rocblas_handle handle, uint32_t enable)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_call_metrics", enable);
+
+    handle->collect_call_metrics = enable != 0;
+    handle->call_metrics         = {};
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief sample the launch metrics of the most recent call (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_call_metrics(rocblas_handle        handle,
+                                                   rocblas_call_metrics* metrics)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!metrics)
+        return rocblas_status_invalid_pointer;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_call_metrics", (const void*)metrics);
+
+    const auto& m = handle->call_metrics;
+
+    metrics->solution_index = m.solution_index;
+    metrics->workgroup_size = m.workgroup_size;
+    metrics->workgroups     = m.workgroups;
+    metrics->cu_occupancy   = m.cu_occupancy;
+    metrics->bytes_estimate = m.bytes_estimate;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief sample the handle's host-side overhead counters (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_cpu_overhead_stats(rocblas_handle              handle,
+                                                         rocblas_cpu_overhead_family family,
+                                                         uint64_t*                   call_count,
+                                                         double*                     total_us)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!call_count || !total_us)
+        return rocblas_status_invalid_pointer;
+    if(family < rocblas_cpu_overhead_blas1 || family > rocblas_cpu_overhead_blas_ex)
+        return rocblas_status_invalid_value;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_get_cpu_overhead_stats",
+                  family,
+                  (const void*)call_count,
+                  (const void*)total_us);
+
+    *call_count = handle->cpu_overhead_calls[family];
+    *total_us   = double(handle->cpu_overhead_ticks[family]) / rocblas_internal_cpu_ticks_per_us();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set the handle's flush-to-zero policy (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_flush_denorms(rocblas_handle handle, uint32_t flush)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_flush_denorms", flush);
+    handle->flush_denorms = flush != 0;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set the handle's zero-copy result policy (BLAS BETA)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_mapped_host_results(rocblas_handle handle, uint32_t enable)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_mapped_host_results", enable);
+    handle->mapped_results = enable != 0;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief poll and clear the accumulated async numeric-check status
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_numerics_status(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_numerics_status");
+
+    // nothing accumulated if no async check ever ran on this handle
+    if(!handle->numerics_flags_device)
+        return rocblas_status_success;
+
+    rocblas_check_numerics_t h_abnormal;
+    hipStream_t              stream = handle->get_stream();
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_abnormal,
+                                       handle->numerics_flags_device,
+                                       sizeof(rocblas_check_numerics_t),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // clear so the next poll covers the following interval
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+        handle->numerics_flags_device, 0, sizeof(rocblas_check_numerics_t), stream));
+
+    return rocblas_check_numerics_abnormal_struct(
+        "rocblas_get_numerics_status", handle->check_numerics, false, &h_abnormal);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief get math mode
  ******************************************************************************/
@@ -182,6 +628,86 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief set the numerical checking mode per handle, limited to a mask of
+ * function families, so only the calls needing protection pay for it
+ * (overrides the ROCBLAS_CHECK_NUMERICS environment configuration)
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_check_numerics_mode(rocblas_handle              handle,
+                                                          rocblas_check_numerics_mode mode,
+                                                          uint32_t                    scope)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_check_numerics_mode", mode, scope);
+
+#ifdef ROCBLAS_FAST_DISPATCH
+    // the checks are compiled out in this configuration
+    return mode == rocblas_check_numerics_mode_no_check ? rocblas_status_success
+                                                        : rocblas_status_not_implemented;
+#else
+    handle->check_numerics       = mode;
+    handle->check_numerics_scope = scope ? scope : rocblas_check_numerics_scope_all;
+    return rocblas_status_success;
+#endif
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief opt in to (or out of) caching of device-resident alpha/beta values
+ * so dispatch can branch on them without a per-call synchronize; the caller
+ * promises the scalars do not change between invalidations
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_device_scalar_peek_mode(rocblas_handle handle,
+                                                              rocblas_int    enable)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_device_scalar_peek_mode", enable);
+
+    handle->device_scalar_peek_enabled = enable != 0;
+    // entries cached under a previous enablement must not survive re-enabling
+    handle->device_scalar_cache_version++;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief discard all cached device scalar values; must be called after the
+ * application rewrites any device memory holding a previously-seen scalar
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_invalidate_device_scalar_cache(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_invalidate_device_scalar_cache");
+
+    handle->device_scalar_cache_version++;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief create rocblas handle called before any rocblas library routines
  ******************************************************************************/
@@ -226,6 +752,54 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ *! \brief release rocblas handle without blocking the caller: teardown is
+ *   queued to a background reaper once work on the handle's stream completes
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_destroy_handle_deferred(rocblas_handle handle)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_destroy_handle_deferred");
+
+    return rocblas_internal_handle_destroy_deferred(handle);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief enable or disable auto-batching of concurrent same-shape gemm_ex
+ *   calls on this handle; window_us of 0 disables
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_auto_batch(rocblas_handle handle,
+                                                      rocblas_int    window_us,
+                                                      rocblas_int    max_group)
+try
+{
+    // If handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(window_us < 0 || max_group < 1)
+        return rocblas_status_invalid_value;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_gemm_auto_batch", window_us, max_group);
+
+    handle->gemm_auto_batch_window_us = window_us;
+    handle->gemm_auto_batch_max_group = max_group;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  *! \brief   set rocblas stream used for all subsequent library function calls.
  *   If not set, all hip kernels will take the default NULL stream.
@@ -256,45 +830,471 @@ try
             return rocblas_status_invalid_value;
     }
 
-    // Stream capture does not allow use of hipStreamQuery
-    // If the current stream or new stream is in capture mode, skip use of hipStreamQuery()
-    if((handle->stream == 0 || !handle->is_stream_in_capture_mode())
-       && stream_status == hipStreamCaptureStatusNone)
+    // Stream capture does not allow use of hipStreamQuery
+    // If the current stream or new stream is in capture mode, skip use of hipStreamQuery()
+    if((handle->stream == 0 || !handle->is_stream_in_capture_mode())
+       && stream_status == hipStreamCaptureStatusNone)
+    {
+        // The new stream must be valid
+        if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidHandle)
+            return rocblas_status_invalid_value;
+    }
+
+    // Swap in the workspace partition belonging to the new stream, so one
+    // handle can serve concurrent streams without false serialization on a
+    // single workspace block
+    handle->switch_stream_workspace(stream);
+
+    // Set the new stream
+    handle->stream = stream;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   get rocblas stream used for all subsequent library function calls.
+ *   If not set, all hip kernels will take the default NULL stream.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream_id)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream_id)
+        return rocblas_status_invalid_pointer;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_stream", *stream_id);
+    *stream_id = handle->get_stream();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+namespace
+{
+    // Pinned staging pool for the blocking set/get transfer routines. A straight
+    // hipMemcpy from pageable host memory serializes the runtime's pinning copy
+    // with the PCIe DMA; staging through two pinned chunks lets the host-side
+    // memcpy of one chunk overlap the DMA of the other, approaching pinned-path
+    // bandwidth without the application managing registration.
+    constexpr size_t c_staging_chunk_size = 4 * 1024 * 1024;
+
+    // below this the plain hipMemcpy path wins; there is nothing to overlap
+    constexpr size_t c_staging_min_transfer = 2 * c_staging_chunk_size;
+
+    class rocblas_pinned_staging_pool
+    {
+        void*      m_buffer[2] = {};
+        hipEvent_t m_event[2]  = {};
+        bool       m_tried     = false;
+        std::mutex m_mutex;
+
+        rocblas_pinned_staging_pool() = default;
+
+    public:
+        ~rocblas_pinned_staging_pool()
+        {
+            for(int i = 0; i < 2; i++)
+            {
+                if(m_buffer[i])
+                    PRINT_IF_HIP_ERROR((hipHostFree)(m_buffer[i]));
+                if(m_event[i])
+                    PRINT_IF_HIP_ERROR(hipEventDestroy(m_event[i]));
+            }
+        }
+
+        static rocblas_pinned_staging_pool& instance()
+        {
+            static rocblas_pinned_staging_pool pool;
+            return pool;
+        }
+
+        // The pool is shared by all threads; transfers hold the lock end to end.
+        std::unique_lock<std::mutex> lock()
+        {
+            return std::unique_lock<std::mutex>(m_mutex);
+        }
+
+        // Lazily allocates the pinned buffers; returns false if pinning failed,
+        // in which case callers fall back to the plain hipMemcpy path.
+        bool acquire()
+        {
+            if(!m_tried)
+            {
+                m_tried = true;
+                for(int i = 0; i < 2; i++)
+                {
+                    if((hipHostMalloc)(&m_buffer[i], c_staging_chunk_size, hipHostMallocDefault)
+                           != hipSuccess
+                       || hipEventCreateWithFlags(&m_event[i], hipEventDisableTiming) != hipSuccess)
+                    {
+                        for(int j = 0; j < 2; j++)
+                        {
+                            if(m_buffer[j])
+                                PRINT_IF_HIP_ERROR((hipHostFree)(m_buffer[j]));
+                            if(m_event[j])
+                                PRINT_IF_HIP_ERROR(hipEventDestroy(m_event[j]));
+                            m_buffer[j] = nullptr;
+                            m_event[j]  = nullptr;
+                        }
+                        break;
+                    }
+                }
+            }
+            return m_buffer[0] != nullptr;
+        }
+
+        char* buffer(int i)
+        {
+            return static_cast<char*>(m_buffer[i]);
+        }
+
+        hipEvent_t event(int i)
+        {
+            return m_event[i];
+        }
+    };
+
+    // true when ptr refers to pageable (unregistered) host memory
+    bool rocblas_is_pageable_host_ptr(const void* ptr)
+    {
+        hipPointerAttribute_t attribute;
+        if(hipPointerGetAttributes(&attribute, ptr) != hipSuccess)
+            return true;
+        return attribute.hostPointer == nullptr && attribute.devicePointer == nullptr;
+    }
+
+    // gate for the staged path; width bounds the column packing in the 2D case
+    bool rocblas_use_staged_copy(const void* host_ptr, size_t total_bytes, size_t width = 0)
+    {
+        return total_bytes >= c_staging_min_transfer && width <= c_staging_chunk_size
+               && rocblas_is_pageable_host_ptr(host_ptr);
+    }
+
+    // blocking chunked contiguous copy through the pinned pool; the legacy null
+    // stream keeps ordering identical to the hipMemcpy it replaces
+    hipError_t rocblas_staged_copy(void* dst, const void* src, size_t bytes, hipMemcpyKind kind)
+    {
+        auto& pool = rocblas_pinned_staging_pool::instance();
+        auto  guard{pool.lock()};
+        if(!pool.acquire())
+            return hipErrorOutOfMemory;
+
+        hipError_t err     = hipSuccess;
+        int        buf     = 0;
+        bool       used[2] = {};
+
+        if(kind == hipMemcpyHostToDevice)
+        {
+            for(size_t offset = 0; offset < bytes && err == hipSuccess;
+                offset += c_staging_chunk_size, buf ^= 1)
+            {
+                size_t nb = std::min(c_staging_chunk_size, bytes - offset);
+                // previous DMA out of this buffer must drain before repacking it
+                if(used[buf])
+                    err = hipEventSynchronize(pool.event(buf));
+                if(err != hipSuccess)
+                    break;
+                memcpy(pool.buffer(buf), static_cast<const char*>(src) + offset, nb);
+                err = hipMemcpyAsync(
+                    static_cast<char*>(dst) + offset, pool.buffer(buf), nb, kind, 0);
+                if(err == hipSuccess)
+                    err = hipEventRecord(pool.event(buf), 0);
+                used[buf] = true;
+            }
+            for(int i = 0; i < 2 && err == hipSuccess; i++)
+                if(used[i])
+                    err = hipEventSynchronize(pool.event(i));
+        }
+        else
+        {
+            struct
+            {
+                size_t offset, nb;
+            } pending[2] = {};
+
+            for(size_t offset = 0; offset < bytes && err == hipSuccess;
+                offset += c_staging_chunk_size, buf ^= 1)
+            {
+                size_t nb = std::min(c_staging_chunk_size, bytes - offset);
+                if(used[buf])
+                {
+                    err = hipEventSynchronize(pool.event(buf));
+                    if(err != hipSuccess)
+                        break;
+                    memcpy(static_cast<char*>(dst) + pending[buf].offset,
+                           pool.buffer(buf),
+                           pending[buf].nb);
+                    used[buf] = false;
+                }
+                err = hipMemcpyAsync(
+                    pool.buffer(buf), static_cast<const char*>(src) + offset, nb, kind, 0);
+                if(err == hipSuccess)
+                    err = hipEventRecord(pool.event(buf), 0);
+                pending[buf] = {offset, nb};
+                used[buf]    = true;
+            }
+            for(int i = 0; i < 2 && err == hipSuccess; i++)
+            {
+                if(used[i])
+                {
+                    err = hipEventSynchronize(pool.event(i));
+                    if(err == hipSuccess)
+                        memcpy(static_cast<char*>(dst) + pending[i].offset,
+                               pool.buffer(i),
+                               pending[i].nb);
+                }
+            }
+        }
+        return err;
+    }
+
+    // strided variant: whole columns of width bytes are packed into (unpacked
+    // out of) the staging buffers so each DMA moves one contiguous chunk
+    hipError_t rocblas_staged_copy_2d(void*         dst,
+                                      size_t        dpitch,
+                                      const void*   src,
+                                      size_t        spitch,
+                                      size_t        width,
+                                      int64_t       height,
+                                      hipMemcpyKind kind)
+    {
+        auto& pool = rocblas_pinned_staging_pool::instance();
+        auto  guard{pool.lock()};
+        if(!pool.acquire())
+            return hipErrorOutOfMemory;
+
+        int64_t cols_per_chunk = int64_t(c_staging_chunk_size / width);
+
+        hipError_t err     = hipSuccess;
+        int        buf     = 0;
+        bool       used[2] = {};
+
+        if(kind == hipMemcpyHostToDevice)
+        {
+            for(int64_t col = 0; col < height && err == hipSuccess;
+                col += cols_per_chunk, buf ^= 1)
+            {
+                int64_t nc = std::min(cols_per_chunk, height - col);
+                if(used[buf])
+                    err = hipEventSynchronize(pool.event(buf));
+                if(err != hipSuccess)
+                    break;
+                for(int64_t c = 0; c < nc; c++)
+                    memcpy(pool.buffer(buf) + c * width,
+                           static_cast<const char*>(src) + (col + c) * spitch,
+                           width);
+                err = hipMemcpy2DAsync(static_cast<char*>(dst) + col * dpitch,
+                                       dpitch,
+                                       pool.buffer(buf),
+                                       width,
+                                       width,
+                                       nc,
+                                       kind,
+                                       0);
+                if(err == hipSuccess)
+                    err = hipEventRecord(pool.event(buf), 0);
+                used[buf] = true;
+            }
+            for(int i = 0; i < 2 && err == hipSuccess; i++)
+                if(used[i])
+                    err = hipEventSynchronize(pool.event(i));
+        }
+        else
+        {
+            struct
+            {
+                int64_t col, nc;
+            } pending[2] = {};
+
+            for(int64_t col = 0; col < height && err == hipSuccess;
+                col += cols_per_chunk, buf ^= 1)
+            {
+                int64_t nc = std::min(cols_per_chunk, height - col);
+                if(used[buf])
+                {
+                    err = hipEventSynchronize(pool.event(buf));
+                    if(err != hipSuccess)
+                        break;
+                    for(int64_t c = 0; c < pending[buf].nc; c++)
+                        memcpy(static_cast<char*>(dst) + (pending[buf].col + c) * dpitch,
+                               pool.buffer(buf) + c * width,
+                               width);
+                    used[buf] = false;
+                }
+                err = hipMemcpy2DAsync(pool.buffer(buf),
+                                       width,
+                                       static_cast<const char*>(src) + col * spitch,
+                                       spitch,
+                                       width,
+                                       nc,
+                                       kind,
+                                       0);
+                if(err == hipSuccess)
+                    err = hipEventRecord(pool.event(buf), 0);
+                pending[buf] = {col, nc};
+                used[buf]    = true;
+            }
+            for(int i = 0; i < 2 && err == hipSuccess; i++)
+            {
+                if(used[i])
+                {
+                    err = hipEventSynchronize(pool.event(i));
+                    if(err == hipSuccess)
+                        for(int64_t c = 0; c < pending[i].nc; c++)
+                            memcpy(static_cast<char*>(dst) + (pending[i].col + c) * dpitch,
+                                   pool.buffer(i) + c * width,
+                                   width);
+                }
+            }
+        }
+        return err;
+    }
+
+    // Registration cache for the async set/get transfer routines. An async copy
+    // involving pageable host memory degrades to a staged synchronous-speed
+    // transfer inside the runtime, so the first time a sufficiently large
+    // pageable range is seen it is hipHostRegister'ed and remembered; long-lived
+    // application staging buffers then get DMA-speed transfers on every later
+    // call without being allocated through hipHostMalloc. The cache is capped
+    // and evicts least recently used ranges. As with any registration cache,
+    // an entry pins the application's pages until it is evicted or the process
+    // exits.
+    constexpr size_t c_host_reg_min_bytes   = 256 * 1024;
+    constexpr size_t c_host_reg_page        = 4096;
+    constexpr size_t c_host_reg_max_entries = 64;
+
+    const size_t c_host_reg_byte_limit = [] {
+        // 256 MB unless overridden
+        constexpr size_t HOST_REG_CACHE_BYTE_LIMIT = 256 * 1024 * 1024;
+        size_t           limit;
+        const char*      env = getenv("ROCBLAS_INTERNAL_HOST_REG_CACHE_LIMIT");
+        return env && sscanf(env, "%zu", &limit) == 1 ? limit : HOST_REG_CACHE_BYTE_LIMIT;
+    }();
+
+    class rocblas_host_registration_cache
+    {
+        struct entry
+        {
+            uintptr_t base;
+            size_t    bytes;
+            uint64_t  tick;
+        };
+
+        std::vector<entry> m_entries;
+        size_t             m_total = 0;
+        uint64_t           m_tick  = 0;
+        std::mutex         m_mutex;
+
+        rocblas_host_registration_cache() = default;
+
+    public:
+        ~rocblas_host_registration_cache()
+        {
+            for(auto& e : m_entries)
+                PRINT_IF_HIP_ERROR(hipHostUnregister(reinterpret_cast<void*>(e.base)));
+        }
+
+        static rocblas_host_registration_cache& instance()
+        {
+            static rocblas_host_registration_cache cache;
+            return cache;
+        }
+
+        // Best effort: returns with the page-rounded range registered when
+        // possible; on any failure the caller's copy simply takes the slower
+        // pageable path.
+        void ensure_registered(const void* ptr, size_t bytes)
+        {
+            if(bytes < c_host_reg_min_bytes || bytes > c_host_reg_byte_limit)
+                return;
+
+            uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+            uintptr_t base = addr & ~(c_host_reg_page - 1);
+            size_t    len  = ((addr + bytes + c_host_reg_page - 1) & ~(c_host_reg_page - 1)) - base;
+
+            std::lock_guard<std::mutex> guard(m_mutex);
+
+            for(auto& e : m_entries)
+            {
+                if(base >= e.base && base + len <= e.base + e.bytes)
+                {
+                    e.tick = ++m_tick;
+                    return;
+                }
+            }
+
+            // memory already pinned by the application needs no registration
+            if(!rocblas_is_pageable_host_ptr(ptr))
+                return;
+
+            // evict least recently used ranges to make room
+            while(!m_entries.empty()
+                  && (m_entries.size() >= c_host_reg_max_entries
+                      || m_total + len > c_host_reg_byte_limit))
+            {
+                auto lru = std::min_element(m_entries.begin(),
+                                            m_entries.end(),
+                                            [](const entry& a, const entry& b) {
+                                                return a.tick < b.tick;
+                                            });
+                PRINT_IF_HIP_ERROR(hipHostUnregister(reinterpret_cast<void*>(lru->base)));
+                m_total -= lru->bytes;
+                m_entries.erase(lru);
+            }
+
+            // fails on a range partially overlapping an existing registration;
+            // that is fine, the copy falls back to the pageable path
+            if(hipHostRegister(reinterpret_cast<void*>(base), len, hipHostRegisterDefault)
+               == hipSuccess)
+            {
+                m_entries.push_back({base, len, ++m_tick});
+                m_total += len;
+            }
+        }
+    };
+
+    // Best-effort direct peer mapping between two devices, attempted once per
+    // ordered pair. With the mapping in place the peer copies below run as
+    // direct DMA over the inter-GPU link (xGMI where available); without it
+    // the runtime stages them through host memory, which still works but at
+    // host-link bandwidth.
+    void rocblas_ensure_peer_access(int dst_device, int src_device)
     {
-        // The new stream must be valid
-        if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidHandle)
-            return rocblas_status_invalid_value;
+        if(dst_device == src_device)
+            return;
+
+        static std::mutex                     mutex;
+        static std::vector<std::pair<int, int>> tried;
+
+        std::lock_guard<std::mutex> guard(mutex);
+        if(std::find(tried.begin(), tried.end(), std::make_pair(dst_device, src_device))
+           != tried.end())
+            return;
+        tried.push_back({dst_device, src_device});
+
+        int can_access = 0;
+        if(hipDeviceCanAccessPeer(&can_access, dst_device, src_device) != hipSuccess
+           || !can_access)
+            return;
+
+        int saved_device;
+        if(hipGetDevice(&saved_device) != hipSuccess)
+            return;
+        if(hipSetDevice(dst_device) == hipSuccess)
+        {
+            hipError_t err = hipDeviceEnablePeerAccess(src_device, 0);
+            if(err != hipSuccess && err != hipErrorPeerAccessAlreadyEnabled)
+                PRINT_IF_HIP_ERROR(err);
+        }
+        PRINT_IF_HIP_ERROR(hipSetDevice(saved_device));
     }
-
-    // Set the new stream
-    handle->stream = stream;
-    return rocblas_status_success;
-}
-catch(...)
-{
-    return exception_to_rocblas_status();
-}
-
-/*******************************************************************************
- *! \brief   get rocblas stream used for all subsequent library function calls.
- *   If not set, all hip kernels will take the default NULL stream.
- ******************************************************************************/
-extern "C" rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream_id)
-try
-{
-    // if handle not valid
-    if(!handle)
-        return rocblas_status_invalid_handle;
-    if(!stream_id)
-        return rocblas_status_invalid_pointer;
-    if(handle->layer_mode & rocblas_layer_mode_log_trace)
-        log_trace(handle, "rocblas_get_stream", *stream_id);
-    *stream_id = handle->get_stream();
-    return rocblas_status_success;
-}
-catch(...)
-{
-    return exception_to_rocblas_status();
 }
 
 /*******************************************************************************
@@ -317,7 +1317,10 @@ try
 
     if(incx == 1 && incy == 1) // contiguous host vector -> contiguous device vector
     {
-        PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, elem_size_u64 * n, hipMemcpyHostToDevice));
+        size_t bytes_to_copy = elem_size_u64 * n;
+        if(!rocblas_use_staged_copy(x_h, bytes_to_copy)
+           || rocblas_staged_copy(y_d, x_h, bytes_to_copy, hipMemcpyHostToDevice) != hipSuccess)
+            PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, bytes_to_copy, hipMemcpyHostToDevice));
     }
     else // either non-contiguous host vector or non-contiguous device vector
     {
@@ -366,7 +1369,10 @@ try
 
     if(incx == 1 && incy == 1) // congiguous device vector -> congiguous host vector
     {
-        PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, elem_size_u64 * n, hipMemcpyDeviceToHost));
+        size_t bytes_to_copy = elem_size_u64 * n;
+        if(!rocblas_use_staged_copy(y_h, bytes_to_copy)
+           || rocblas_staged_copy(y_h, x_d, bytes_to_copy, hipMemcpyDeviceToHost) != hipSuccess)
+            PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, bytes_to_copy, hipMemcpyDeviceToHost));
     }
     else
     {
@@ -418,6 +1424,11 @@ try
 
     size_t elem_size_u64 = size_t(elem_size);
 
+    // best-effort pinning of large pageable source ranges so the copy below
+    // can run as true async DMA
+    rocblas_host_registration_cache::instance().ensure_registered(
+        x_h, elem_size_u64 * ((n - 1) * incx + 1));
+
     if(incx == 1 && incy == 1) // contiguous host vector -> contiguous device vector
     {
         PRINT_IF_HIP_ERROR(
@@ -475,6 +1486,11 @@ try
 
     size_t elem_size_u64 = size_t(elem_size);
 
+    // best-effort pinning of large pageable destination ranges so the copy
+    // below can run as true async DMA
+    rocblas_host_registration_cache::instance().ensure_registered(
+        y_h, elem_size_u64 * ((n - 1) * incy + 1));
+
     if(incx == 1 && incy == 1) // congiguous device vector -> congiguous host vector
     {
         PRINT_IF_HIP_ERROR(
@@ -566,18 +1582,30 @@ try
     if(lda == rows && ldb == rows)
     {
         size_t bytes_to_copy = elem_size_u64 * rows * cols;
-        PRINT_IF_HIP_ERROR(hipMemcpy(b_d, a_h, bytes_to_copy, hipMemcpyHostToDevice));
+        if(!rocblas_use_staged_copy(a_h, bytes_to_copy)
+           || rocblas_staged_copy(b_d, a_h, bytes_to_copy, hipMemcpyHostToDevice) != hipSuccess)
+            PRINT_IF_HIP_ERROR(hipMemcpy(b_d, a_h, bytes_to_copy, hipMemcpyHostToDevice));
     }
     else
     {
         // width is column vector in matrix
-        PRINT_IF_HIP_ERROR(hipMemcpy2D(b_d,
-                                       elem_size_u64 * ldb,
-                                       a_h,
-                                       elem_size_u64 * lda,
-                                       elem_size_u64 * rows,
-                                       cols,
-                                       hipMemcpyHostToDevice));
+        size_t width = elem_size_u64 * rows;
+        if(!rocblas_use_staged_copy(a_h, width * cols, width)
+           || rocblas_staged_copy_2d(b_d,
+                                     elem_size_u64 * ldb,
+                                     a_h,
+                                     elem_size_u64 * lda,
+                                     width,
+                                     cols,
+                                     hipMemcpyHostToDevice)
+                  != hipSuccess)
+            PRINT_IF_HIP_ERROR(hipMemcpy2D(b_d,
+                                           elem_size_u64 * ldb,
+                                           a_h,
+                                           elem_size_u64 * lda,
+                                           width,
+                                           cols,
+                                           hipMemcpyHostToDevice));
     }
     return rocblas_status_success;
 }
@@ -625,18 +1653,30 @@ try
     if(lda == rows && ldb == rows)
     {
         size_t bytes_to_copy = elem_size_u64 * rows * cols;
-        PRINT_IF_HIP_ERROR(hipMemcpy(b_h, a_d, bytes_to_copy, hipMemcpyDeviceToHost));
+        if(!rocblas_use_staged_copy(b_h, bytes_to_copy)
+           || rocblas_staged_copy(b_h, a_d, bytes_to_copy, hipMemcpyDeviceToHost) != hipSuccess)
+            PRINT_IF_HIP_ERROR(hipMemcpy(b_h, a_d, bytes_to_copy, hipMemcpyDeviceToHost));
     }
     else
     {
         // width is column vector in matrix
-        PRINT_IF_HIP_ERROR(hipMemcpy2D(b_h,
-                                       elem_size_u64 * ldb,
-                                       a_d,
-                                       elem_size_u64 * lda,
-                                       elem_size_u64 * rows,
-                                       cols,
-                                       hipMemcpyDeviceToHost));
+        size_t width = elem_size_u64 * rows;
+        if(!rocblas_use_staged_copy(b_h, width * cols, width)
+           || rocblas_staged_copy_2d(b_h,
+                                     elem_size_u64 * ldb,
+                                     a_d,
+                                     elem_size_u64 * lda,
+                                     width,
+                                     cols,
+                                     hipMemcpyDeviceToHost)
+                  != hipSuccess)
+            PRINT_IF_HIP_ERROR(hipMemcpy2D(b_h,
+                                           elem_size_u64 * ldb,
+                                           a_d,
+                                           elem_size_u64 * lda,
+                                           width,
+                                           cols,
+                                           hipMemcpyDeviceToHost));
     }
     return rocblas_status_success;
 }
@@ -680,6 +1720,11 @@ try
 
     size_t elem_size_u64(elem_size);
 
+    // best-effort pinning of large pageable source ranges so the copy below
+    // can run as true async DMA
+    rocblas_host_registration_cache::instance().ensure_registered(
+        a_h, elem_size_u64 * (size_t(lda) * (cols - 1) + rows));
+
     // contiguous host matrix -> contiguous device matrix
     if(lda == rows && ldb == rows)
     {
@@ -742,6 +1787,11 @@ try
 
     size_t elem_size_u64(elem_size);
 
+    // best-effort pinning of large pageable destination ranges so the copy
+    // below can run as true async DMA
+    rocblas_host_registration_cache::instance().ensure_registered(
+        b_h, elem_size_u64 * (size_t(ldb) * (cols - 1) + rows));
+
     // contiguous host matrix -> contiguous device matrix
     if(lda == rows && ldb == rows)
     {
@@ -779,7 +1829,711 @@ extern "C" rocblas_status rocblas_get_matrix_async(rocblas_int rows,
     return rocblas_get_matrix_async_64(rows, cols, elem_size, a_d, lda, b_h, ldb, stream);
 }
 
+namespace
+{
+    // default chunk size for the streaming get_matrix variant; large enough
+    // to keep the copy engine at full DMA rate, small enough that host
+    // processing of the first chunk starts well before the transfer ends
+    constexpr size_t c_get_matrix_chunk_bytes = size_t(64) << 20;
+
+    // heap context handed to hipLaunchHostFunc for each completed chunk; the
+    // trampoline owns and frees it
+    struct rocblas_matrix_chunk_ctx
+    {
+        rocblas_matrix_chunk_fn callback;
+        void*                   user_data;
+        int64_t                 first_col;
+        int64_t                 chunk_cols;
+    };
+
+    void rocblas_matrix_chunk_trampoline(void* arg)
+    {
+        std::unique_ptr<rocblas_matrix_chunk_ctx> ctx(
+            static_cast<rocblas_matrix_chunk_ctx*>(arg));
+        ctx->callback(ctx->first_col, ctx->chunk_cols, ctx->user_data);
+    }
+}
+
+/*******************************************************************************
+ *! \brief   copies void* matrix a_d on device to void* matrix b_h on host as a
+     pipeline of column chunks on the stream, invoking callback on the host as
+     each chunk's data lands, so downstream host processing overlaps the rest
+     of the transfer instead of waiting for all of it
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_matrix_async_chunked(int64_t                 rows,
+                                                           int64_t                 cols,
+                                                           int64_t                 elem_size,
+                                                           const void*             a_d,
+                                                           int64_t                 lda,
+                                                           void*                   b_h,
+                                                           int64_t                 ldb,
+                                                           int64_t                 chunk_cols,
+                                                           rocblas_matrix_chunk_fn callback,
+                                                           void*                   user_data,
+                                                           hipStream_t             stream)
+try
+{
+    if(rows == 0 || cols == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb || elem_size <= 0
+       || chunk_cols < 0)
+        return rocblas_status_invalid_size;
+    if(!a_d || !b_h)
+        return rocblas_status_invalid_pointer;
+
+    size_t elem_size_u64(elem_size);
+    size_t col_bytes = elem_size_u64 * rows;
+
+    // best-effort pinning of large pageable destination ranges so the copies
+    // below can run as true async DMA
+    rocblas_host_registration_cache::instance().ensure_registered(
+        b_h, elem_size_u64 * (size_t(ldb) * (cols - 1) + rows));
+
+    if(!chunk_cols)
+        chunk_cols = std::max(int64_t(1), int64_t(c_get_matrix_chunk_bytes / col_bytes));
+
+    bool contiguous = lda == rows && ldb == rows;
+
+    for(int64_t col = 0; col < cols; col += chunk_cols)
+    {
+        int64_t nc = std::min(chunk_cols, cols - col);
+
+        if(contiguous)
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(static_cast<char*>(b_h) + col * col_bytes,
+                                               static_cast<const char*>(a_d) + col * col_bytes,
+                                               col_bytes * nc,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        else
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(static_cast<char*>(b_h)
+                                                     + col * elem_size_u64 * ldb,
+                                                 elem_size_u64 * ldb,
+                                                 static_cast<const char*>(a_d)
+                                                     + col * elem_size_u64 * lda,
+                                                 elem_size_u64 * lda,
+                                                 col_bytes,
+                                                 nc,
+                                                 hipMemcpyDeviceToHost,
+                                                 stream));
+
+        if(callback)
+        {
+            auto* ctx = new rocblas_matrix_chunk_ctx{callback, user_data, col, nc};
+
+            hipError_t err = hipLaunchHostFunc(stream, rocblas_matrix_chunk_trampoline, ctx);
+            if(err != hipSuccess)
+            {
+                delete ctx;
+                return rocblas_internal_convert_hip_to_rocblas_status(err);
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies a strided batch of void* matrices a_d on device device_a to
+     void* matrices b_d on device device_b, coalescing the per-matrix peer
+     copies into as few transfers as the layouts allow. Matrices have size
+     rows * cols with element size elem_size.
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_copy_matrix_device_to_device_strided_batched(int64_t        rows,
+                                                         int64_t        cols,
+                                                         int64_t        elem_size,
+                                                         const void*    a_d,
+                                                         int            device_a,
+                                                         int64_t        lda,
+                                                         rocblas_stride stride_a,
+                                                         void*          b_d,
+                                                         int            device_b,
+                                                         int64_t        ldb,
+                                                         rocblas_stride stride_b,
+                                                         int64_t        batch_count,
+                                                         hipStream_t    stream)
+try
+{
+    if(rows == 0 || cols == 0 || batch_count == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || batch_count < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb
+       || elem_size <= 0)
+        return rocblas_status_invalid_size;
+    if(!a_d || !b_d)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_ensure_peer_access(device_b, device_a);
+
+    size_t elem_size_u64 = size_t(elem_size);
+    size_t matrix_bytes  = elem_size_u64 * rows * cols;
+
+    // whole batch contiguous on both sides: a single transfer moves everything
+    if(lda == rows && ldb == rows
+       && (batch_count == 1
+           || (stride_a == int64_t(rows) * cols && stride_b == int64_t(rows) * cols)))
+    {
+        PRINT_IF_HIP_ERROR(hipMemcpyPeerAsync(
+            b_d, device_b, a_d, device_a, matrix_bytes * batch_count, stream));
+    }
+    // packed matrices at (possibly padded) batch strides: one pitched transfer
+    // with the batch as its height
+    else if(lda == rows && ldb == rows && stride_a >= int64_t(rows) * cols
+            && stride_b >= int64_t(rows) * cols)
+    {
+        PRINT_IF_HIP_ERROR(hipMemcpy2DAsync(b_d,
+                                            elem_size_u64 * stride_b,
+                                            a_d,
+                                            elem_size_u64 * stride_a,
+                                            matrix_bytes,
+                                            batch_count,
+                                            hipMemcpyDeviceToDevice,
+                                            stream));
+    }
+    // pitched matrices laid out back to back: one 3D transfer with the batch
+    // as its depth
+    else if(stride_a == int64_t(lda) * cols && stride_b == int64_t(ldb) * cols)
+    {
+        hipMemcpy3DParms parms = {};
+        parms.srcPtr           = make_hipPitchedPtr(
+            const_cast<void*>(a_d), elem_size_u64 * lda, elem_size_u64 * rows, size_t(cols));
+        parms.dstPtr
+            = make_hipPitchedPtr(b_d, elem_size_u64 * ldb, elem_size_u64 * rows, size_t(cols));
+        parms.extent = make_hipExtent(elem_size_u64 * rows, size_t(cols), size_t(batch_count));
+        parms.kind   = hipMemcpyDeviceToDevice;
+        PRINT_IF_HIP_ERROR(hipMemcpy3DAsync(&parms, stream));
+    }
+    // irregular strides: one pitched transfer per matrix
+    else
+    {
+        for(int64_t b = 0; b < batch_count; b++)
+            PRINT_IF_HIP_ERROR(
+                hipMemcpy2DAsync(static_cast<char*>(b_d) + elem_size * stride_b * b,
+                                 elem_size_u64 * ldb,
+                                 static_cast<const char*>(a_d) + elem_size * stride_a * b,
+                                 elem_size_u64 * lda,
+                                 elem_size_u64 * rows,
+                                 cols,
+                                 hipMemcpyDeviceToDevice,
+                                 stream));
+    }
+    return rocblas_status_success;
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   copies void* matrix a_d on device device_a to void* matrix b_d on
+     device device_b. Matrices have size rows * cols with element size
+     elem_size.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_copy_matrix_device_to_device(int64_t     rows,
+                                                               int64_t     cols,
+                                                               int64_t     elem_size,
+                                                               const void* a_d,
+                                                               int         device_a,
+                                                               int64_t     lda,
+                                                               void*       b_d,
+                                                               int         device_b,
+                                                               int64_t     ldb,
+                                                               hipStream_t stream)
+{
+    return rocblas_copy_matrix_device_to_device_strided_batched(
+        rows, cols, elem_size, a_d, device_a, lda, 0, b_d, device_b, ldb, 0, 1, stream);
+}
+
+/*******************************************************************************
+ * Build a device array of batch pointers over strided storage, on-stream.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_make_batch_pointers(rocblas_handle handle,
+                                                      void*          base,
+                                                      rocblas_stride stride_bytes,
+                                                      rocblas_int    batch_count,
+                                                      void**         pointers)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_make_batch_pointers", base, stride_bytes, batch_count, pointers);
+
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!batch_count)
+        return rocblas_status_success;
+    if(!base || !pointers)
+        return rocblas_status_invalid_pointer;
+
+    return setup_device_pointer_array(
+        handle->get_stream(), (char*)base, stride_bytes, (char**)pointers, batch_count);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 // Convert rocblas_status to string
+namespace
+{
+    // One record of a deploy-time manifest: the rocblas-bench tokens that
+    // log_bench emits, e.g. "./rocblas-bench -f trsm -r f64_r --side L -m 64 -n 64"
+    struct rocblas_manifest_record
+    {
+        std::string                    function;
+        std::string                    precision = "f32_r";
+        std::map<std::string, int64_t> dims;
+        std::map<std::string, char>    opts;
+
+        int64_t dim(const char* name, int64_t fallback) const
+        {
+            auto it = dims.find(name);
+            return it == dims.end() ? fallback : it->second;
+        }
+
+        char opt(const char* name, char fallback) const
+        {
+            auto it = opts.find(name);
+            return it == opts.end() ? fallback : it->second;
+        }
+    };
+
+    // Returns false for lines carrying no "-f <function>" (blanks, comments,
+    // stray text); unrecognized flag values are simply ignored
+    bool rocblas_parse_manifest_line(std::string line, rocblas_manifest_record& record)
+    {
+        // call tags ride along as trailing shell comments (rocblas_set_call_tag)
+        auto hash = line.find('#');
+        if(hash != std::string::npos)
+            line.erase(hash);
+
+        std::istringstream tokens(line);
+        std::string        flag;
+
+        record = {};
+        while(tokens >> flag)
+        {
+            auto name_pos = flag.find_first_not_of('-');
+            if(flag[0] != '-' || name_pos == std::string::npos)
+                continue; // program name or stray token
+
+            std::string value;
+            if(!(tokens >> value))
+                break;
+
+            std::string name = flag.substr(name_pos);
+            if(name == "f")
+                record.function = value;
+            else if(name == "r")
+                record.precision = value;
+            else
+            {
+                char*   end = nullptr;
+                int64_t v   = strtoll(value.c_str(), &end, 10);
+                if(end && !*end)
+                    record.dims[name] = v;
+                else if(value.size() == 1)
+                    record.opts[name] = value[0];
+            }
+        }
+        return !record.function.empty();
+    }
+
+    // Device operands for replaying a manifest record. All null while a
+    // device memory size query is active (every supported entry point answers
+    // the query before dereferencing or validating its data pointers); the
+    // warmup path supplies zero-filled scratch so the calls actually run.
+    struct rocblas_manifest_operands
+    {
+        void* a      = nullptr;
+        void* b      = nullptr;
+        void* x      = nullptr;
+        void* y      = nullptr;
+        void* result = nullptr;
+    };
+
+    // Replay one manifest record against the entry point it names. Scalars
+    // are host pointers to one, so callers replaying for real must hold host
+    // pointer mode on the handle.
+    rocblas_status rocblas_manifest_replay(rocblas_handle                  handle,
+                                           const rocblas_manifest_record&  record,
+                                           const rocblas_manifest_operands& ops)
+    {
+        bool is_double = record.precision == "f64_r";
+        if(!is_double && record.precision != "f32_r")
+            return rocblas_status_not_implemented;
+
+        rocblas_int n    = rocblas_int(record.dim("n", 0));
+        rocblas_int m    = rocblas_int(record.dim("m", 0));
+        rocblas_int incx = rocblas_int(record.dim("incx", 1));
+        rocblas_int incy = rocblas_int(record.dim("incy", 1));
+
+        char              transA_letter = record.opt("transposeA", 'N');
+        rocblas_operation transA        = transA_letter == 'T'
+                                              ? rocblas_operation_transpose
+                                              : transA_letter == 'C'
+                                                    ? rocblas_operation_conjugate_transpose
+                                                    : rocblas_operation_none;
+
+        rocblas_fill uplo = record.opt("uplo", 'U') == 'L' ? rocblas_fill_lower : rocblas_fill_upper;
+        rocblas_side side = record.opt("side", 'L') == 'R' ? rocblas_side_right : rocblas_side_left;
+        rocblas_diagonal diag
+            = record.opt("diag", 'N') == 'U' ? rocblas_diagonal_unit : rocblas_diagonal_non_unit;
+
+        static const float  one_s = 1.0f;
+        static const double one_d = 1.0;
+
+        if(record.function == "dot")
+            return is_double ? rocblas_ddot(handle, n, (const double*)ops.x, incx,
+                                            (const double*)ops.y, incy, (double*)ops.result)
+                             : rocblas_sdot(handle, n, (const float*)ops.x, incx,
+                                            (const float*)ops.y, incy, (float*)ops.result);
+
+        if(record.function == "nrm2")
+            return is_double
+                       ? rocblas_dnrm2(handle, n, (const double*)ops.x, incx, (double*)ops.result)
+                       : rocblas_snrm2(handle, n, (const float*)ops.x, incx, (float*)ops.result);
+
+        if(record.function == "asum")
+            return is_double
+                       ? rocblas_dasum(handle, n, (const double*)ops.x, incx, (double*)ops.result)
+                       : rocblas_sasum(handle, n, (const float*)ops.x, incx, (float*)ops.result);
+
+        if(record.function == "gemv")
+        {
+            rocblas_int lda = rocblas_int(record.dim("lda", m > 0 ? m : 1));
+            return is_double
+                       ? rocblas_dgemv(handle, transA, m, n, &one_d, (const double*)ops.a, lda,
+                                       (const double*)ops.x, incx, &one_d, (double*)ops.y, incy)
+                       : rocblas_sgemv(handle, transA, m, n, &one_s, (const float*)ops.a, lda,
+                                       (const float*)ops.x, incx, &one_s, (float*)ops.y, incy);
+        }
+
+        if(record.function == "symv")
+        {
+            rocblas_int lda = rocblas_int(record.dim("lda", n > 0 ? n : 1));
+            return is_double
+                       ? rocblas_dsymv(handle, uplo, n, &one_d, (const double*)ops.a, lda,
+                                       (const double*)ops.x, incx, &one_d, (double*)ops.y, incy)
+                       : rocblas_ssymv(handle, uplo, n, &one_s, (const float*)ops.a, lda,
+                                       (const float*)ops.x, incx, &one_s, (float*)ops.y, incy);
+        }
+
+        if(record.function == "trsv")
+        {
+            rocblas_int lda = rocblas_int(record.dim("lda", n > 0 ? n : 1));
+            return is_double ? rocblas_dtrsv(handle, uplo, transA, diag, n, (const double*)ops.a,
+                                             lda, (double*)ops.x, incx)
+                             : rocblas_strsv(handle, uplo, transA, diag, n, (const float*)ops.a,
+                                             lda, (float*)ops.x, incx);
+        }
+
+        if(record.function == "trsm")
+        {
+            rocblas_int k   = side == rocblas_side_left ? m : n;
+            rocblas_int lda = rocblas_int(record.dim("lda", k > 0 ? k : 1));
+            rocblas_int ldb = rocblas_int(record.dim("ldb", m > 0 ? m : 1));
+            return is_double
+                       ? rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, &one_d,
+                                       (const double*)ops.a, lda, (double*)ops.b, ldb)
+                       : rocblas_strsm(handle, side, uplo, transA, diag, m, n, &one_s,
+                                       (const float*)ops.a, lda, (float*)ops.b, ldb);
+        }
+
+        return rocblas_status_not_implemented;
+    }
+
+    // Replay while a device memory size query is active on the handle; null
+    // operands suffice since the query is answered before they are touched
+    rocblas_status rocblas_manifest_size_query(rocblas_handle                 handle,
+                                               const rocblas_manifest_record& record)
+    {
+        return rocblas_manifest_replay(handle, record, {});
+    }
+
+    // Device operand byte counts a manifest record dereferences, so warmup
+    // can run it against library-owned scratch instead of user data
+    struct rocblas_manifest_operand_sizes
+    {
+        size_t a = 0;
+        size_t b = 0;
+        size_t x = 0;
+        size_t y = 0;
+    };
+
+    rocblas_manifest_operand_sizes
+        rocblas_manifest_operand_bytes(const rocblas_manifest_record& record)
+    {
+        rocblas_manifest_operand_sizes sizes;
+
+        size_t elem = record.precision == "f64_r" ? sizeof(double) : sizeof(float);
+
+        auto vec = [&](int64_t len, const char* inc_name) {
+            int64_t inc = record.dim(inc_name, 1);
+            if(inc < 0)
+                inc = -inc;
+            return elem * size_t(len > 0 ? len : 1) * size_t(inc > 0 ? inc : 1);
+        };
+
+        int64_t n = record.dim("n", 0);
+        int64_t m = record.dim("m", 0);
+
+        bool    transposed = record.opt("transposeA", 'N') != 'N';
+        int64_t x_len      = transposed ? m : n;
+        int64_t y_len      = transposed ? n : m;
+
+        if(record.function == "dot")
+        {
+            sizes.x = vec(n, "incx");
+            sizes.y = vec(n, "incy");
+        }
+        else if(record.function == "nrm2" || record.function == "asum")
+        {
+            sizes.x = vec(n, "incx");
+        }
+        else if(record.function == "gemv")
+        {
+            int64_t lda = record.dim("lda", m > 0 ? m : 1);
+            sizes.a     = elem * size_t(lda > 0 ? lda : 1) * size_t(n > 0 ? n : 1);
+            sizes.x     = vec(x_len, "incx");
+            sizes.y     = vec(y_len, "incy");
+        }
+        else if(record.function == "symv")
+        {
+            int64_t lda = record.dim("lda", n > 0 ? n : 1);
+            sizes.a     = elem * size_t(lda > 0 ? lda : 1) * size_t(n > 0 ? n : 1);
+            sizes.x     = vec(n, "incx");
+            sizes.y     = vec(n, "incy");
+        }
+        else if(record.function == "trsv")
+        {
+            int64_t lda = record.dim("lda", n > 0 ? n : 1);
+            sizes.a     = elem * size_t(lda > 0 ? lda : 1) * size_t(n > 0 ? n : 1);
+            sizes.x     = vec(n, "incx");
+        }
+        else if(record.function == "trsm")
+        {
+            int64_t k   = record.opt("side", 'L') == 'R' ? n : m;
+            int64_t lda = record.dim("lda", k > 0 ? k : 1);
+            int64_t ldb = record.dim("ldb", m > 0 ? m : 1);
+            sizes.a     = elem * size_t(lda > 0 ? lda : 1) * size_t(k > 0 ? k : 1);
+            sizes.b     = elem * size_t(ldb > 0 ? ldb : 1) * size_t(n > 0 ? n : 1);
+        }
+
+        return sizes;
+    }
+
+    // hipMalloc holder for warmup scratch; plain hipMalloc rather than the
+    // handle's pool so operand scratch does not inflate the workspace
+    // reservation being measured
+    struct rocblas_manifest_scratch
+    {
+        void* ptr = nullptr;
+
+        hipError_t alloc(size_t bytes, hipStream_t stream)
+        {
+            if(!bytes)
+                return hipSuccess;
+            hipError_t err = hipMalloc(&ptr, bytes);
+            if(err != hipSuccess)
+                return err;
+            return hipMemsetAsync(ptr, 0, bytes, stream);
+        }
+
+        ~rocblas_manifest_scratch()
+        {
+            if(ptr)
+                (void)hipFree(ptr);
+        }
+    };
+
+} // namespace
+
+/*******************************************************************************
+ * ! rief BLAS BETA API: size the device memory workspace once from a
+ * manifest of rocblas-bench records so no allocation happens at serve time
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_reserve_for_manifest(rocblas_handle handle,
+                                                       const char*    manifest_file)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!manifest_file)
+        return rocblas_status_invalid_pointer;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_reserve_for_manifest", manifest_file);
+
+    std::ifstream manifest(manifest_file);
+    if(!manifest)
+        return rocblas_status_invalid_value;
+
+    size_t      high_water = 0;
+    std::string line;
+    while(std::getline(manifest, line))
+    {
+        rocblas_manifest_record record;
+        if(!rocblas_parse_manifest_line(std::move(line), record))
+            continue;
+
+        rocblas_status status = rocblas_start_device_memory_size_query(handle);
+        if(status != rocblas_status_success)
+            return status;
+
+        status = rocblas_manifest_size_query(handle, record);
+
+        size_t         size        = 0;
+        rocblas_status stop_status = rocblas_stop_device_memory_size_query(handle, &size);
+
+        // A record the query machinery cannot size (unknown function or
+        // precision) breaks the zero-allocation guarantee, so it is an error
+        // rather than a silent skip
+        if(status != rocblas_status_size_increased && status != rocblas_status_size_unchanged
+           && status != rocblas_status_success)
+            return status;
+        if(stop_status != rocblas_status_success)
+            return stop_status;
+
+        if(size > high_water)
+            high_water = size;
+    }
+
+    // a manifest of workspace-free calls needs no reservation
+    if(!high_water)
+        return rocblas_status_success;
+
+    return rocblas_set_device_memory_size(handle, high_water);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief BLAS BETA API: run every manifest record once against zero-filled
+ * scratch operands so all lazy initialization (workspace growth, code-object
+ * load, solution selection) happens in a dedicated, measured warmup phase
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_warmup_from_manifest(rocblas_handle handle,
+                                                       const char*    manifest_file)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!manifest_file)
+        return rocblas_status_invalid_pointer;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_warmup_from_manifest", manifest_file);
+
+    std::ifstream manifest(manifest_file);
+    if(!manifest)
+        return rocblas_status_invalid_value;
+
+    hipStream_t stream = handle->get_stream();
+
+    auto now = [] { return std::chrono::steady_clock::now(); };
+    auto us  = [](auto t0, auto t1) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+    };
+
+    size_t         high_water   = 0;
+    rocblas_status first_failed = rocblas_status_success;
+    std::string    line;
+    while(std::getline(manifest, line))
+    {
+        rocblas_manifest_record record;
+        if(!rocblas_parse_manifest_line(std::move(line), record))
+            continue;
+
+        // step 1: workspace size query, as rocblas_reserve_for_manifest does
+        auto           t0     = now();
+        rocblas_status status = rocblas_start_device_memory_size_query(handle);
+        if(status != rocblas_status_success)
+            return status;
+
+        status = rocblas_manifest_size_query(handle, record);
+
+        size_t         size        = 0;
+        rocblas_status stop_status = rocblas_stop_device_memory_size_query(handle, &size);
+        if(stop_status != rocblas_status_success)
+            return stop_status;
+
+        bool sized = status == rocblas_status_size_increased
+                     || status == rocblas_status_size_unchanged
+                     || status == rocblas_status_success;
+        if(sized)
+            status = rocblas_status_success;
+        auto t1 = now();
+
+        // step 2: grow the workspace to this record's needs up front, so the
+        // execution step below never pays an allocation
+        int64_t reserve_us = 0;
+        if(sized && size > high_water)
+        {
+            status = rocblas_set_device_memory_size(handle, size);
+            if(status == rocblas_status_success)
+                high_water = size;
+            auto t2    = now();
+            reserve_us = us(t1, t2);
+        }
+
+        // step 3: execute against zero-filled scratch; the synchronized first
+        // call pays lazy code-object load and solution selection
+        int64_t exec_us = 0;
+        if(sized && status == rocblas_status_success)
+        {
+            auto sizes = rocblas_manifest_operand_bytes(record);
+
+            rocblas_manifest_scratch a, b, x, y;
+            RETURN_IF_HIP_ERROR(a.alloc(sizes.a, stream));
+            RETURN_IF_HIP_ERROR(b.alloc(sizes.b, stream));
+            RETURN_IF_HIP_ERROR(x.alloc(sizes.x, stream));
+            RETURN_IF_HIP_ERROR(y.alloc(sizes.y, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            double result = 0;
+
+            rocblas_manifest_operands ops;
+            ops.a      = a.ptr;
+            ops.b      = b.ptr;
+            ops.x      = x.ptr;
+            ops.y      = y.ptr;
+            ops.result = &result;
+
+            auto t3 = now();
+            {
+                auto saved_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+                status          = rocblas_manifest_replay(handle, record, ops);
+            }
+            if(status == rocblas_status_success)
+                RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+            exec_us = us(t3, now());
+        }
+
+        rocblas_cout << "rocblas-warmup,-f," << record.function << ",-r," << record.precision
+                     << ",size-query-us," << us(t0, t1) << ",reserve-us," << reserve_us
+                     << ",exec-us," << exec_us << ",status," << rocblas_status_to_string(status)
+                     << std::endl;
+
+        // keep warming the remaining records, but report the first failure
+        if(status != rocblas_status_success && first_failed == rocblas_status_success)
+            first_failed = status;
+    }
+
+    return first_failed;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 extern "C" const char* rocblas_status_to_string(rocblas_status status)
 {
 #define CASE(x) \
@@ -24,9 +24,13 @@
 static void rocblas_abort_once [[noreturn]] ();
 
 #include "rocblas_ostream.hpp"
+#include <chrono>
 #include <csignal>
+#include <cstdlib>
+#include <cstring>
 #include <fcntl.h>
 #include <iostream>
+#include <thread>
 #include <type_traits>
 #ifdef WIN32
 #include <io.h>
@@ -159,9 +163,74 @@ rocblas_internal_ostream::rocblas_internal_ostream(int fd)
     }
 }
 
+#ifndef WIN32
+// Get worker which streams its records through a zstd compressor process
+// writing to filename; keyed in the worker map by the pipe's device/inode so
+// clear_workers() and rocblas_abort() shut the compressor down with the rest
+std::shared_ptr<rocblas_internal_ostream::worker>
+    rocblas_internal_ostream::get_worker_for_compressed_file(const char* filename)
+{
+    // Single-quote the filename for the shell, splicing in any embedded quote
+    std::string quoted = "'";
+    for(const char* p = filename; *p; ++p)
+        if(*p == '\'')
+            quoted += "'\\''";
+        else
+            quoted += *p;
+    quoted += "'";
+
+    // popen() only forks the shell, so it succeeds even when no zstd binary
+    // exists, and the first worker write into the dead pipe would then raise
+    // SIGPIPE in the host application; probe for the compressor first so a
+    // missing binary reports failure here and the caller can fall back
+    if(system("zstd --version > /dev/null 2>&1") != 0)
+        return nullptr;
+
+    std::string cmd  = "zstd -q -f -o " + quoted + " -";
+    FILE*       file = popen(cmd.c_str(), "w");
+    if(!file)
+        return nullptr;
+
+    struct stat statbuf;
+    if(fstat(fileno(file), &statbuf))
+    {
+        perror("Error executing fstat()");
+        pclose(file);
+        return nullptr;
+    }
+    file_id_t file_id{statbuf.st_dev, statbuf.st_ino};
+
+    // Lock the map from file_id -> std::shared_ptr<rocblas_internal_ostream::worker>
+    std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
+
+    auto& worker_ptr = worker_map().emplace(file_id, nullptr).first->second;
+    if(!worker_ptr)
+        worker_ptr = std::make_shared<worker>(file, true);
+    return worker_ptr;
+}
+#endif
+
 // Construct rocblas_internal_ostream from a filename opened for writing with truncation
 rocblas_internal_ostream::rocblas_internal_ostream(const char* filename)
 {
+#ifndef WIN32
+    // A ".zst" suffix streams the log through a zstd compressor process, so
+    // always-on tracing writes roughly a tenth of the bytes and stops
+    // perturbing the job it is measuring
+    size_t len = strlen(filename);
+    if(len > 4 && !strcmp(filename + len - 4, ".zst"))
+    {
+        m_worker_ptr = get_worker_for_compressed_file(filename);
+        if(m_worker_ptr)
+            return;
+
+        // Fall back to writing the file uncompressed, e.g. when no zstd
+        // binary is installed
+        std::cerr << "Warning: cannot open compressed stream to " << filename
+                  << "; writing uncompressed" << std::endl;
+    }
+#endif
+
     int fd       = OPEN(filename);
     m_worker_ptr = get_worker(fd);
     if(!m_worker_ptr)
@@ -216,103 +285,176 @@ std::ostream& rocblas_internal_ostream::yaml_off(std::ostream& os)
  * rocblas_internal_ostream::worker functions handle logging in a single thread *
  ***********************************************************************/
 
-// Send a string to the worker thread for this stream's device/inode
-// Empty strings tell the worker thread to exit
+// Claim a ring slot with a CAS on the enqueue position and publish the record
+// through the slot's sequence number. Returns false when the ring is full.
+bool rocblas_internal_ostream::worker::try_enqueue(record_t&& rec)
+{
+    size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        ring_slot_t& slot = m_ring[pos & (RING_SIZE - 1)];
+        size_t       seq  = slot.seq.load(std::memory_order_acquire);
+        intptr_t     dif  = intptr_t(seq) - intptr_t(pos);
+        if(dif == 0)
+        {
+            if(m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.rec = std::move(rec);
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if(dif < 0)
+        {
+            // The slot still holds an unconsumed record
+            return false;
+        }
+        else
+        {
+            // Another producer claimed this slot; reload the enqueue position
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// Consumer-only: take the oldest published record, if any
+bool rocblas_internal_ostream::worker::dequeue(record_t& rec)
+{
+    ring_slot_t& slot = m_ring[m_dequeue_pos & (RING_SIZE - 1)];
+    size_t       seq  = slot.seq.load(std::memory_order_acquire);
+    if(intptr_t(seq) - intptr_t(m_dequeue_pos + 1) < 0)
+        return false; // ring empty
+    rec = std::move(slot.rec);
+    slot.seq.store(m_dequeue_pos + RING_SIZE, std::memory_order_release);
+    ++m_dequeue_pos;
+    return true;
+}
+
+// Consumer-only: true when no published record is pending
+bool rocblas_internal_ostream::worker::ring_empty() const
+{
+    const ring_slot_t& slot = m_ring[m_dequeue_pos & (RING_SIZE - 1)];
+    return intptr_t(slot.seq.load(std::memory_order_acquire)) - intptr_t(m_dequeue_pos + 1) < 0;
+}
+
+// Send a string to the worker thread for this stream's device/inode.
+// The hot path only publishes the record into the lock-free ring and returns;
+// formatting already happened in the caller's string buffer, and the worker
+// thread does the file I/O. Empty strings tell the worker thread to exit, and
+// are the only records the sender waits on.
 void rocblas_internal_ostream::worker::send(std::string str)
 {
-    // Create a promise to wait for the operation to complete
-    std::promise<void> promise;
+    bool sync = str.empty();
 
-    // The future indicating when the operation has completed
-    auto future = promise.get_future();
+    record_t rec{std::move(str), sync ? std::make_shared<std::promise<void>>() : nullptr};
 
-#ifdef WIN32
-    // Passing an empty string will make the worker thread exit.
-    // The below flag will be used to handle worker thread exit condition for Windows
-    bool empty_string = str.empty();
-#endif
+    std::future<void> future;
+    if(sync)
+        future = rec.promise->get_future();
 
-    // task_t consists of string and promise
-    // std::move transfers ownership of str and promise to task
-    task_t worker_task(std::move(str), std::move(promise));
+    // Don't queue records that nobody will consume
+    if(m_exited.load(std::memory_order_acquire))
+        return;
 
-    // Submit the task to the worker assigned to this device/inode
-    // Hold mutex for as short as possible, to reduce contention
+    // Back-pressure: when the ring is full, nudge the worker and retry
+    while(!try_enqueue(std::move(rec)))
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.push(std::move(worker_task));
-
-        // no lock needed for notification but keeping here
         m_cond.notify_one();
+        if(m_exited.load(std::memory_order_acquire))
+            return;
+        std::this_thread::yield();
     }
 
-// Wait for the task to be completed, to ensure flushed IO
+    // Doorbell for an idle worker. If this races with the worker going to
+    // sleep, its timed wait bounds the added latency.
+    m_cond.notify_one();
+
+    if(sync)
+    {
 #ifdef WIN32
-    if(empty_string)
         // Occassionaly this thread is not getting the promise set by the 'worker' thread during exit condition.
         // Added a timed wait to exit after one second, if we do not get the promise from worker thread.
         future.wait_for(std::chrono::seconds(1));
-    else
-        future.get();
 #else
-    future.get();
+        // The shared promise keeps the timed wait safe if the worker exits on
+        // a write error without consuming this record
+        while(future.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready)
+            if(m_exited.load(std::memory_order_acquire))
+                break;
 #endif
+    }
 }
 
 // Worker thread which serializes data to be written to a device/inode
 void rocblas_internal_ostream::worker::thread_function()
 {
+#ifndef WIN32
+    // Writes can race with a compressor process dying (or any pipe reader
+    // closing); block SIGPIPE on this thread so they fail with EPIPE and hit
+    // the ferror() path below instead of killing the host application
+    sigset_t sigpipe_mask;
+    sigemptyset(&sigpipe_mask);
+    sigaddset(&sigpipe_mask, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigpipe_mask, nullptr);
+#endif
+
     // Clear any errors in the FILE
     clearerr(m_file);
 
-    // Lock the mutex in preparation for cond.wait
+    // Lock the mutex in preparation for cond.wait_for
     std::unique_lock<std::mutex> lock(m_mutex);
 
-    while(true)
+    bool exiting = false;
+    while(!exiting)
     {
-        // Wait for any data, ignoring spurious wakeups, locks lock on continue
-        m_cond.wait(lock, [&] { return !m_queue.empty(); });
+        // Sleep only while the ring is empty; the timed wait bounds the delay
+        // when a producer's doorbell races with this thread going to sleep
+        m_cond.wait_for(lock, std::chrono::milliseconds(10), [&] { return !ring_empty(); });
 
-        // With the mutex locked, get and pop data from the front of queue
-        task_t task = std::move(m_queue.front());
-        m_queue.pop();
-
-        // Temporarily unlock queue mutex, unblocking other threads
+        // The mutex only serves the doorbell; the ring itself is lock-free
         lock.unlock();
 
-        // An empty message indicates the closing of the stream
-        if(!task.size())
+        record_t rec;
+        while(!exiting && dequeue(rec))
         {
-            // Tell future to wake up
-            task.set_value();
-            break;
+            // An empty message indicates the closing of the stream
+            if(!rec.str.size())
+            {
+                exiting = true;
+            }
+            else
+            {
+                // Write the data
+                fwrite(rec.str.data(), 1, rec.str.size(), m_file);
+
+                // Detect any error and flush the C FILE stream
+                if(ferror(m_file) || fflush(m_file))
+                {
+                    perror("Error writing log file");
+                    exiting = true;
+                }
+            }
+
+            // Tell any waiting future to wake up
+            if(rec.promise)
+                rec.promise->set_value();
         }
 
-        // Write the data
-        fwrite(task.data(), 1, task.size(), m_file);
-
-        // Detect any error and flush the C FILE stream
-        if(ferror(m_file) || fflush(m_file))
-        {
-            perror("Error writing log file");
-
-            // Tell future to wake up
-            task.set_value();
-            break;
-        }
-
-        // Promise that the data has been written
-        task.set_value();
-
-        // Re-lock the mutex in preparation for cond.wait
-        lock.lock();
+        if(!exiting)
+            lock.lock();
     }
+
+    // Unblock senders queued behind the exit; their data is discarded
+    m_exited.store(true, std::memory_order_release);
+    record_t rec;
+    while(dequeue(rec))
+        if(rec.promise)
+            rec.promise->set_value();
 }
 
-// Constructor creates a worker thread from a file descriptor
-rocblas_internal_ostream::worker::worker(int fd)
+// Duplicate a file descriptor and open a FILE on the duplicate (RAII)
+static FILE* rocblas_fdopen_dup(int fd)
 {
-    // The worker duplicates the file descriptor (RAII)
 #ifdef WIN32
     fd = _dup(fd);
 #else
@@ -320,11 +462,32 @@ rocblas_internal_ostream::worker::worker(int fd)
 #endif
 
     // If the dup fails or fdopen fails, print error and abort
-    if(fd == -1 || !(m_file = FDOPEN(fd, "a")))
+    FILE* file;
+    if(fd == -1 || !(file = FDOPEN(fd, "a")))
     {
         perror("fdopen() error");
         rocblas_abort();
     }
+    return file;
+}
+
+// Constructor creates a worker thread from a file descriptor
+rocblas_internal_ostream::worker::worker(int fd)
+    : worker(rocblas_fdopen_dup(fd), false)
+{
+}
+
+// Constructor creates a worker thread writing to an already-open FILE, whose
+// ownership it takes; is_pipe selects pclose() over fclose() at teardown
+rocblas_internal_ostream::worker::worker(FILE* file, bool is_pipe)
+    : m_file(file)
+    , m_is_pipe(is_pipe)
+{
+    // The ring slots start out empty, with each sequence number one cycle
+    // behind its first enqueue position
+    m_ring.reset(new ring_slot_t[RING_SIZE]);
+    for(size_t i = 0; i < RING_SIZE; ++i)
+        m_ring[i].seq.store(i, std::memory_order_relaxed);
 
     // Create a worker thread, capturing *this
     m_thread = std::thread([=] { thread_function(); });
@@ -338,7 +501,15 @@ rocblas_internal_ostream::worker::~worker()
     // Tell worker thread to exit, by sending it an empty string
     send({});
 
-    // Close the FILE
+    // Close the FILE; closing a compressor pipe delivers EOF, letting the
+    // process finish its final zstd frame before pclose() reaps it
     if(m_file)
-        fclose(m_file);
+    {
+#ifndef WIN32
+        if(m_is_pipe)
+            pclose(m_file);
+        else
+#endif
+            fclose(m_file);
+    }
 }
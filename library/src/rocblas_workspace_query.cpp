@@ -0,0 +1,353 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Direct workspace-size queries. These compute, without a handle and without
+// invoking the function, the same byte counts the device memory size query
+// mechanism would report, rounded the way the handle's allocator rounds them.
+// A pipeline can take the maximum (or sum, for concurrently live workspaces)
+// across its calls and pass it to rocblas_set_device_memory_size once, so no
+// call reallocates at runtime.
+
+#include "blas1/rocblas_dot.hpp"
+#include "blas1/rocblas_reduction.hpp"
+#include "blas3/rocblas_trsm.hpp"
+#include "handle.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+
+namespace
+{
+    template <typename T>
+    rocblas_status rocblas_trsm_workspace_size_typed(rocblas_side      side,
+                                                     rocblas_operation transA,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     rocblas_int       batch_count,
+                                                     bool              batched,
+                                                     size_t*           size)
+    {
+        // no user-supplied invA; matches what the _impl functions allocate
+        size_t w_x_tmp_size, w_x_tmp_arr_size, w_invA_size, w_invA_arr_size, w_x_tmp_size_backup;
+
+        rocblas_status status;
+        if(batched)
+            status = rocblas_internal_trsm_batched_workspace_size<T>(side,
+                                                                     transA,
+                                                                     m,
+                                                                     n,
+                                                                     batch_count,
+                                                                     0,
+                                                                     &w_x_tmp_size,
+                                                                     &w_x_tmp_arr_size,
+                                                                     &w_invA_size,
+                                                                     &w_invA_arr_size,
+                                                                     &w_x_tmp_size_backup);
+        else
+            status = rocblas_internal_trsm_workspace_size<T>(side,
+                                                             transA,
+                                                             m,
+                                                             n,
+                                                             batch_count,
+                                                             0,
+                                                             &w_x_tmp_size,
+                                                             &w_x_tmp_arr_size,
+                                                             &w_invA_size,
+                                                             &w_invA_arr_size,
+                                                             &w_x_tmp_size_backup);
+
+        // continue indicates no workspace is needed for this shape
+        if(status == rocblas_status_continue)
+        {
+            *size = 0;
+            return rocblas_status_success;
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        // sum with per-chunk rounding, as the handle's allocator does
+        *size = roundup_device_memory_size(w_x_tmp_size)
+                + roundup_device_memory_size(w_x_tmp_arr_size)
+                + roundup_device_memory_size(w_invA_size)
+                + roundup_device_memory_size(w_invA_arr_size);
+        return rocblas_status_success;
+    }
+
+    rocblas_status rocblas_trsm_workspace_size_impl(rocblas_side      side,
+                                                    rocblas_operation transA,
+                                                    rocblas_int       m,
+                                                    rocblas_int       n,
+                                                    rocblas_int       batch_count,
+                                                    bool              batched,
+                                                    rocblas_datatype  type,
+                                                    size_t*           size)
+    {
+        if(!size)
+            return rocblas_status_invalid_pointer;
+        if(m < 0 || n < 0 || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        switch(type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_trsm_workspace_size_typed<float>(
+                side, transA, m, n, batch_count, batched, size);
+        case rocblas_datatype_f64_r:
+            return rocblas_trsm_workspace_size_typed<double>(
+                side, transA, m, n, batch_count, batched, size);
+        case rocblas_datatype_f32_c:
+            return rocblas_trsm_workspace_size_typed<rocblas_float_complex>(
+                side, transA, m, n, batch_count, batched, size);
+        case rocblas_datatype_f64_c:
+            return rocblas_trsm_workspace_size_typed<rocblas_double_complex>(
+                side, transA, m, n, batch_count, batched, size);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+}
+
+extern "C" {
+
+rocblas_status rocblas_trsm_workspace_size(rocblas_side      side,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       batch_count,
+                                           rocblas_datatype  type,
+                                           size_t*           size)
+try
+{
+    return rocblas_trsm_workspace_size_impl(side, transA, m, n, batch_count, false, type, size);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_trsm_batched_workspace_size(rocblas_side      side,
+                                                   rocblas_operation transA,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       batch_count,
+                                                   rocblas_datatype  type,
+                                                   size_t*           size)
+try
+{
+    return rocblas_trsm_workspace_size_impl(side, transA, m, n, batch_count, true, type, size);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_trsv_workspace_size(rocblas_int n, rocblas_int batch_count, size_t* size)
+try
+{
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // trsv keeps one completed-sections counter per batch instance,
+    // independent of datatype; see rocblas_trsv_arg_check
+    *size = roundup_device_memory_size(sizeof(rocblas_int) * batch_count);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_dot_workspace_size(rocblas_int      n,
+                                          rocblas_int      batch_count,
+                                          rocblas_datatype type,
+                                          size_t*          size)
+try
+{
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // NB and the partial-sum type per datatype must match rocblas_dot_impl
+    size_t bytes;
+    switch(type)
+    {
+    case rocblas_datatype_f16_r:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                        ROCBLAS_DOT_NB * rocblas_dot_WIN(2),
+                                                        rocblas_half>(n, batch_count);
+        break;
+    case rocblas_datatype_bf16_r:
+        // bf16 dot accumulates partial sums in float
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                        ROCBLAS_DOT_NB * rocblas_dot_WIN(2),
+                                                        float>(n, batch_count);
+        break;
+    case rocblas_datatype_f32_r:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                        ROCBLAS_DOT_NB * rocblas_dot_WIN(4),
+                                                        float>(n, batch_count);
+        break;
+    case rocblas_datatype_f64_r:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                        ROCBLAS_DOT_NB * rocblas_dot_WIN(8),
+                                                        double>(n, batch_count);
+        break;
+    case rocblas_datatype_f32_c:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                        ROCBLAS_DOT_NB * rocblas_dot_WIN(8),
+                                                        rocblas_float_complex>(n, batch_count);
+        break;
+    case rocblas_datatype_f64_c:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int,
+                                                        ROCBLAS_DOT_NB * rocblas_dot_WIN(16),
+                                                        rocblas_double_complex>(n, batch_count);
+        break;
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+    *size = roundup_device_memory_size(bytes);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_asum_workspace_size(rocblas_int      n,
+                                           rocblas_int      batch_count,
+                                           rocblas_datatype type,
+                                           size_t*          size)
+try
+{
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // asum reduces in the real type of the input
+    size_t bytes;
+    switch(type)
+    {
+    case rocblas_datatype_f32_r:
+    case rocblas_datatype_f32_c:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, ROCBLAS_ASUM_NB, float>(
+            n, batch_count);
+        break;
+    case rocblas_datatype_f64_r:
+    case rocblas_datatype_f64_c:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, ROCBLAS_ASUM_NB, double>(
+            n, batch_count);
+        break;
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+    *size = roundup_device_memory_size(bytes);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_nrm2_workspace_size(rocblas_int      n,
+                                           rocblas_int      batch_count,
+                                           rocblas_datatype type,
+                                           size_t*          size)
+try
+{
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // nrm2 reduces in the real type of the input
+    size_t bytes;
+    switch(type)
+    {
+    case rocblas_datatype_f32_r:
+    case rocblas_datatype_f32_c:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, ROCBLAS_NRM2_NB, float>(
+            n, batch_count);
+        break;
+    case rocblas_datatype_f64_r:
+    case rocblas_datatype_f64_c:
+        bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, ROCBLAS_NRM2_NB, double>(
+            n, batch_count);
+        break;
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+    *size = roundup_device_memory_size(bytes);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_iamax_workspace_size(rocblas_int      n,
+                                            rocblas_int      batch_count,
+                                            rocblas_datatype type,
+                                            size_t*          size)
+try
+{
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // iamax and iamin reduce index/value pairs keyed on the real type
+    size_t bytes;
+    switch(type)
+    {
+    case rocblas_datatype_f32_r:
+    case rocblas_datatype_f32_c:
+        bytes = rocblas_reduction_kernel_workspace_size_chunked<rocblas_int,
+                                                                ROCBLAS_IAMAX_NB,
+                                                                rocblas_index_value_t<float>>(
+            n, batch_count);
+        break;
+    case rocblas_datatype_f64_r:
+    case rocblas_datatype_f64_c:
+        bytes = rocblas_reduction_kernel_workspace_size_chunked<rocblas_int,
+                                                                ROCBLAS_IAMAX_NB,
+                                                                rocblas_index_value_t<double>>(
+            n, batch_count);
+        break;
+    default:
+        return rocblas_status_not_implemented;
+    }
+
+    *size = roundup_device_memory_size(bytes);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -96,6 +96,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher_64(rocblas_handle handle,
                                   dim3(NB),
                                   0,
                                   handle->get_stream(),
+                                  handle->device_predicate,
                                   n_passes,
                                   partial_results,
                                   output);
@@ -158,6 +159,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher_64(rocblas_handle handle,
                                   dim3(NB),
                                   0,
                                   handle->get_stream(),
+                                  handle->device_predicate,
                                   n_passes,
                                   partial_results,
                                   output);
@@ -33,8 +33,15 @@
 // rocblas_reduction_kernel_part2_64 gathers all the partial results in workspace and finishes the final reduction;
 template <bool is_finalize, int NB, typename FINALIZE, typename To, typename Tr>
 ROCBLAS_KERNEL(NB)
-rocblas_reduction_kernel_part2_64(rocblas_int nblocks, To* workspace, Tr* result)
+rocblas_reduction_kernel_part2_64(const rocblas_int* __restrict__ predicate,
+                                  rocblas_int nblocks,
+                                  To*         workspace,
+                                  Tr*         result)
 {
+    // device-side execution predicate (rocblas_set_device_predicate)
+    if(predicate && !*predicate)
+        return;
+
     rocblas_int tx = threadIdx.x;
     To          sum;
 
@@ -80,7 +87,9 @@ rocblas_status rocblas_internal_asum_nrm2_kernel_launcher(rocblas_handle handle,
 {
     // param REDUCE is always SUM for these kernels so not passed on
 
-    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
+    // part1 grid-strides, so the pass-one fanout is tuned to the part's CU
+    // count rather than the full n/NB split
+    rocblas_int blocks = rocblas_reduction_kernel_tuned_block_count(handle, n, NB);
 
     //Calling the original rocblas_reduction_kernel_part1 kernel in rocbblas_asum_nrm2_kernels.hpp
     ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part1<API_INT, NB, FETCH>),
@@ -88,6 +97,7 @@ rocblas_status rocblas_internal_asum_nrm2_kernel_launcher(rocblas_handle handle,
                           NB,
                           0,
                           handle->get_stream(),
+                          handle->device_predicate,
                           n,
                           blocks,
                           x,
@@ -101,6 +111,7 @@ rocblas_status rocblas_internal_asum_nrm2_kernel_launcher(rocblas_handle handle,
                           NB,
                           0,
                           handle->get_stream(),
+                          handle->device_predicate,
                           blocks,
                           workspace,
                           result);
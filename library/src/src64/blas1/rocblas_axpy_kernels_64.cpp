@@ -48,6 +48,68 @@ rocblas_status rocblas_internal_axpy_launcher_64(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // For lengths beyond one chunk, a single grid-stride launch per batch
+    // chunk avoids the per-chunk launch gaps and tail restarts at every
+    // chunk boundary; 64-bit indexing costs nothing on this memory-bound
+    // kernel
+    if(n > c_i64_grid_X_chunk)
+    {
+        int32_t blocks = int32_t(std::min((n - 1) / NB + 1, c_i32_max));
+
+        // negative increments walk back from the far end of the full vector
+        int64_t shiftx = offset_x + (incx < 0 ? -incx * (n - 1) : 0);
+        int64_t shifty = offset_y + (incy < 0 ? -incy * (n - 1) : 0);
+
+        for(int64_t b = 0; b < batch_count; b += c_i64_grid_YZ_chunk)
+        {
+            auto    x_ptr         = adjust_ptr_batch(x, b, stride_x);
+            auto    y_ptr         = adjust_ptr_batch(y, b, stride_y);
+            int32_t batch_count32 = int32_t(std::min(batch_count - b, c_i64_grid_YZ_chunk));
+
+            dim3 grid(blocks, batch_count32);
+            dim3 threads(NB);
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_64<NB, Tex>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      handle->device_predicate,
+                                      n,
+                                      alpha + b * stride_alpha,
+                                      stride_alpha,
+                                      x_ptr,
+                                      shiftx,
+                                      incx,
+                                      stride_x,
+                                      y_ptr,
+                                      shifty,
+                                      incy,
+                                      stride_y);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_64<NB, Tex>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      handle->device_predicate,
+                                      n,
+                                      *alpha,
+                                      stride_alpha,
+                                      x_ptr,
+                                      shiftx,
+                                      incx,
+                                      stride_x,
+                                      y_ptr,
+                                      shifty,
+                                      incy,
+                                      stride_y);
+        }
+
+        return rocblas_status_success;
+    }
+
     if(incx < c_i32_max && incy < c_i32_max && incx > c_i32_min && incy > c_i32_min)
     {
         // increments can fit in int32_t
@@ -123,6 +185,7 @@ rocblas_status rocblas_internal_axpy_launcher_64(rocblas_handle handle,
                                           threads,
                                           0,
                                           handle->get_stream(),
+                                          handle->device_predicate,
                                           n32,
                                           alpha + b * stride_alpha,
                                           stride_alpha,
@@ -140,6 +203,7 @@ rocblas_status rocblas_internal_axpy_launcher_64(rocblas_handle handle,
                                           threads,
                                           0,
                                           handle->get_stream(),
+                                          handle->device_predicate,
                                           n32,
                                           *alpha,
                                           stride_alpha,
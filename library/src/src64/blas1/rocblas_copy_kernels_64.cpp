@@ -45,6 +45,46 @@ rocblas_status rocblas_internal_copy_launcher_64(rocblas_handle handle,
 
     bool increments_32bit = std::abs(incx_64) <= c_i32_max && std::abs(incy_64) < c_i32_max;
 
+    // For lengths beyond one chunk, a single grid-stride launch per batch
+    // chunk avoids the per-chunk launch gaps and tail restarts at every
+    // chunk boundary; 64-bit indexing costs nothing on this memory-bound
+    // kernel
+    if(n_64 > c_i64_grid_X_chunk)
+    {
+        int32_t blocks = int32_t(std::min((n_64 - 1) / NB + 1, c_i32_max));
+
+        // negative increments walk back from the far end of the full vector
+        int64_t shiftx = offsetx + (incx_64 < 0 ? -incx_64 * (n_64 - 1) : 0);
+        int64_t shifty = offsety + (incy_64 < 0 ? -incy_64 * (n_64 - 1) : 0);
+
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        {
+            auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
+            auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+            dim3 grid(blocks, batch_count);
+            dim3 threads(NB);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_copy_kernel_64<T, U>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n_64,
+                                  x_ptr,
+                                  shiftx,
+                                  incx_64,
+                                  stridex,
+                                  y_ptr,
+                                  shifty,
+                                  incy_64,
+                                  stridey);
+        }
+
+        return rocblas_status_success;
+    }
+
     for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
     {
         auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
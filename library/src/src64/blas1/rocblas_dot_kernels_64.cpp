@@ -142,6 +142,7 @@ rocblas_status rocblas_internal_dot_launcher_64(rocblas_handle __restrict__ hand
                                   dim3(NB),
                                   0,
                                   handle->get_stream(),
+                                  handle->device_predicate,
                                   n_passes,
                                   partial_results,
                                   output);
@@ -235,6 +236,7 @@ rocblas_status rocblas_internal_dot_launcher_64(rocblas_handle __restrict__ hand
                                       dim3(NB),
                                       0,
                                       handle->get_stream(),
+                                      handle->device_predicate,
                                       n_passes,
                                       partial_results,
                                       output);
@@ -80,6 +80,12 @@ rocblas_status rocblas_internal_iamax_iamin_launcher_64(rocblas_handle handle,
                                                         Tr*            results)
 {
 
+    // Host pointer mode synchronizes to return the index and cannot be
+    // captured; the device pointer chunk loop below is all stream-legal work
+    if(handle->pointer_mode != rocblas_pointer_mode_device
+       && handle->is_stream_in_capture_mode())
+        return rocblas_status_not_implemented;
+
     int64_t n_passes = (n_64 - 1) / c_i64_grid_X_chunk + 1;
 
     for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
@@ -45,6 +45,60 @@ rocblas_status rocblas_internal_scal_launcher_64(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // For lengths beyond one chunk, a single grid-stride launch per batch
+    // chunk avoids the per-chunk launch gaps and tail restarts at every
+    // chunk boundary; 64-bit indexing costs nothing on this memory-bound
+    // kernel
+    if(n_64 > c_i64_grid_X_chunk)
+    {
+        int32_t blocks = int32_t(std::min((n_64 - 1) / NB + 1, c_i32_max));
+
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        {
+            auto    x_ptr       = adjust_ptr_batch(x, b_base, stride_x);
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+            dim3 grid(blocks, batch_count);
+            dim3 threads(NB);
+
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel_64<NB, T, Tex>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      n_64,
+                                      alpha + b_base * stride_alpha,
+                                      stride_alpha,
+                                      x_ptr,
+                                      offset_x,
+                                      incx_64,
+                                      stride_x);
+            else // single alpha is on host
+                ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel_64<NB, T, Tex>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      n_64,
+                                      *alpha,
+                                      stride_alpha,
+                                      x_ptr,
+                                      offset_x,
+                                      incx_64,
+                                      stride_x);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // chunks scale disjoint ranges of x, so they are pipelined across the
+    // handle's internal streams to overlap chunk boundaries
+    int64_t n_chunks = ((n_64 - 1) / c_i64_grid_X_chunk + 1)
+                       * ((batch_count_64 - 1) / c_i64_grid_YZ_chunk + 1);
+
+    rocblas_internal_chunk_pipeline pipeline(handle, n_chunks);
+
     if(incx_64 <= c_ILP64_i32_max)
     {
         for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
@@ -54,6 +108,8 @@ rocblas_status rocblas_internal_scal_launcher_64(rocblas_handle handle,
 
             for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
             {
+                pipeline.next_chunk();
+
                 int32_t n         = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
                 auto    alpha_ptr = rocblas_pointer_mode_device == handle->pointer_mode
                                         ? alpha + n_base * stride_alpha
@@ -85,6 +141,8 @@ rocblas_status rocblas_internal_scal_launcher_64(rocblas_handle handle,
 
             for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
             {
+                pipeline.next_chunk();
+
                 int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
 
                 int  blocks = (n - 1) / NB + 1;
@@ -125,7 +125,8 @@ rocblas_status rocblas_internal_gemm_64(rocblas_handle    handle,
                 if(!source_dims_supported)
                     return rocblas_status_invalid_size;
 
-                status = rocblas_gemm_source_solution_64<BATCHED>(trans_a,
+                status = rocblas_gemm_source_solution_64<BATCHED>(handle,
+                                                                  trans_a,
                                                                   trans_b,
                                                                   m_64,
                                                                   n_64,
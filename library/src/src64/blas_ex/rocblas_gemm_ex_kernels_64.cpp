@@ -25,6 +25,7 @@
 
 #include "rocblas_gemm_ex_64.hpp"
 
+#include "blas3/rocblas_gemm_persistent.hpp"
 #include "blas3/rocblas_gemm_source.hpp"
 #include "blas_ex/rocblas_gemm_ex.hpp" // int32 API called
 
@@ -73,7 +74,7 @@ rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle
         alpha   = &alpha_h;
     }
 
-    auto           check_numerics = handle->check_numerics;
+    auto           check_numerics = handle->check_numerics_for(rocblas_check_numerics_scope_gemm);
     rocblas_status status         = rocblas_status_success;
 
     // check alignment of pointers before casting
@@ -122,7 +123,47 @@ rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle
     if(!source_dims_supported)
         return rocblas_status_invalid_size;
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    // opt-in persistent kernel mode (ROCBLAS_GEMM_PERSISTENT): enqueue the job
+    // for the resident kernel instead of launching, removing the per-call
+    // launch from the critical path of repeated small GEMMs
+    bool persistent_done = false;
+    if constexpr(!BATCHED && std::is_same_v<Ti, float> && std::is_same_v<To, float>
+                 && std::is_same_v<TScal, float>)
+    {
+        if(batch_count_64 == 1 && k_64 > 0 && *(const float*)alpha != 0 && m_64 <= c_i32_max
+           && n_64 <= c_i32_max && k_64 <= c_i32_max
+           && trans_a != rocblas_operation_conjugate_transpose
+           && trans_b != rocblas_operation_conjugate_transpose
+           && !handle->is_stream_in_capture_mode())
+        {
+            if(auto* queue = handle->get_gemm_persistent_queue())
+            {
+                rocblas_gemm_persistent_job job;
+                job.A       = (const float*)a + offsetAin;
+                job.B       = (const float*)b + offsetBin;
+                job.C       = (const float*)c + offsetCin;
+                job.D       = (float*)d + offsetDin;
+                job.lda     = lda_64;
+                job.ldb     = ldb_64;
+                job.ldc     = ldc_64;
+                job.ldd     = ldd_64;
+                job.m       = int32_t(m_64);
+                job.n       = int32_t(n_64);
+                job.k       = int32_t(k_64);
+                job.trans_a = trans_a == rocblas_operation_none ? 'N' : 'T';
+                job.trans_b = trans_b == rocblas_operation_none ? 'N' : 'T';
+                job.alpha   = *(const float*)alpha;
+                job.beta    = *(const float*)beta;
+
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_gemm_persistent_enqueue(queue, job, rocblas_stream));
+                persistent_done = true;
+            }
+        }
+    }
+
+    for(int64_t b_base = 0; !persistent_done && b_base < batch_count_64;
+        b_base += c_i64_grid_YZ_chunk)
     {
         int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
 
@@ -136,7 +177,8 @@ rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle
         auto C_ptr = adjust_ptr_batch((Tc)c, b_base, stride_c);
         auto D_ptr = adjust_ptr_batch((Td)d, b_base, stride_d);
 
-        status = rocblas_gemm_source_solution_64<BATCHED>(trans_a,
+        status = rocblas_gemm_source_solution_64<BATCHED>(handle,
+                                                          trans_a,
                                                           trans_b,
                                                           m_64,
                                                           n_64,
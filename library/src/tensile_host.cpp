@@ -45,16 +45,21 @@
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <array>
 #include <atomic>
 #include <complex>
 #include <exception>
+#include <fstream>
 #include <future>
 #include <iomanip>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #ifdef WIN32
@@ -65,9 +70,12 @@
 #include <libloaderapi.h>
 #define ROCBLAS_LIB_PATH "C:/hipSDK/rocblas/bin"
 #else
+#include <fcntl.h>
 #include <glob.h>
 #include <libgen.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #define ROCBLAS_LIB_PATH "/opt/rocm/lib"
 #endif
@@ -486,9 +494,10 @@ namespace
             tensileProblem.setArithmeticUnit(Tensile::ArithmeticUnit::VALU);
         }
 
-        // Pass atomics mode to Tensile interface
-        tensileProblem.setDeterministicMode(prob.handle->atomics_mode
-                                            == rocblas_atomics_not_allowed);
+        // Pass atomics mode to Tensile interface; the per-call flag forces
+        // deterministic solution selection regardless of the handle mode
+        tensileProblem.setDeterministicMode(prob.handle->atomics_mode == rocblas_atomics_not_allowed
+                                            || (prob.flags & rocblas_gemm_flags_deterministic));
 
         // set batch mode
         tensileProblem.setStridedBatched(prob.strided_batch);
@@ -498,8 +507,10 @@ namespace
         //If flag is set use CUEfficiency performance metric
         if(prob.flags & rocblas_gemm_flags_use_cu_efficiency)
             tensileProblem.setPerformanceMetric(Tensile::PerformanceMetric::CUEfficiency);
-        //Otherwise use handle to determine metric
-        else if(metric != rocblas_default_performance_metric)
+        //Otherwise use handle to determine metric. The measured metric keeps
+        //Tensile's default heuristic as its baseline and re-ranks afterwards.
+        else if(metric == rocblas_cu_efficiency_performance_metric
+                || metric == rocblas_device_efficiency_performance_metric)
             tensileProblem.setPerformanceMetric(performanceMetricMap(metric));
 
         if(std::is_same<TiA, float>() && prob.handle->math_mode == rocblas_xf32_xdl_math_op)
@@ -689,6 +700,31 @@ namespace
 #endif
         }
 
+#ifndef WIN32
+        /**********************************************************************
+         * MapLibraryFile() maps the master library file read-only and asks   *
+         * the kernel to fault it in ahead of the parser. The mapping is kept *
+         * for the life of the process, so the metadata is demand-paged from  *
+         * the shared page cache and concurrent processes on a node reuse one *
+         * cached copy instead of each reading the whole file                 *
+         **********************************************************************/
+        static void MapLibraryFile(const std::string& libraryPath)
+        {
+            int fd = open(libraryPath.c_str(), O_RDONLY);
+            if(fd < 0)
+                return;
+            struct stat sb;
+            if(!fstat(fd, &sb) && sb.st_size > 0)
+            {
+                void* map = mmap(nullptr, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                if(map != MAP_FAILED)
+                    madvise(map, sb.st_size, MADV_WILLNEED);
+                // the mapping is intentionally left in place
+            }
+            close(fd);
+        }
+#endif
+
         /*********************************************************************
          * Initialize adapter and library according to environment variables *
          * and default paths based on librocblas.so location and GPU         *
@@ -726,7 +762,46 @@ namespace
                 const char* env = getenv("ROCBLAS_TENSILE_LIBPATH");
                 if(env)
                 {
-                    base_path = env;
+                    // ROCBLAS_TENSILE_LIBPATH may hold several roots separated
+                    // by ':' (';' on Windows). A deployment can then split the
+                    // Tensile payload into per-architecture packages and mount
+                    // only the package matching the node's GPU next to a
+                    // payload-free base image; the first root holding this
+                    // architecture's library files is used, so other
+                    // architectures' kernels are never shipped or mapped.
+#ifdef WIN32
+                    constexpr char separator = ';';
+#else
+                    constexpr char separator = ':';
+#endif
+                    std::istringstream roots(env);
+                    std::string        candidate;
+                    bool               found = false;
+                    while(!found && std::getline(roots, candidate, separator))
+                    {
+                        if(candidate.empty())
+                            continue;
+                        if(base_path.empty())
+                            base_path = candidate; // fallback: first root given
+                        std::string probe = candidate;
+                        if(TestPath(probe + "/" + processor))
+                            probe += "/" + processor;
+                        for(const char* stem : {"/TensileLibrary_lazy_", "/TensileLibrary_"})
+                        {
+#ifdef TENSILE_YAML
+                            if(TestPath(probe + stem + processor + ".yaml"))
+#else
+                            if(TestPath(probe + stem + processor + ".dat"))
+#endif
+                            {
+                                base_path = candidate;
+                                found     = true;
+                                break;
+                            }
+                        }
+                    }
+                    if(base_path.empty())
+                        base_path = env;
                 }
                 else
                 {
@@ -846,6 +921,43 @@ namespace
             else
                 tensile_lazy_load_enabled = true;
 
+#ifndef WIN32
+            // Warm the page cache underneath the asynchronous metadata parse
+            // below, so a cold start overlaps disk I/O with the rest of
+            // initialization instead of stalling inside the parser
+            static int map_once = [&] {
+                MapLibraryFile(tensileLibraryPath);
+                return 0;
+            }();
+
+            // Optionally pre-fault this architecture's code objects as well.
+            // The read-only mappings are backed by the node-wide page cache,
+            // so with several processes per node only the first pays the disk
+            // I/O and the rest load near-instantly. Off by default because it
+            // eagerly reads objects that lazy loading might never touch.
+            if(getenv("ROCBLAS_PRELOAD_CODE_OBJECTS"))
+            {
+                static int map_co_once = [&] {
+                    std::string co_dir = path + "/*" + processor + "*co";
+                    glob_t      co_glob{};
+                    if(!glob(co_dir.c_str(), GLOB_NOSORT, nullptr, &co_glob))
+                    {
+                        for(size_t i = 0; i < co_glob.gl_pathc; ++i)
+                        {
+                            std::string cofile = co_glob.gl_pathv[i];
+                            if(!skip_xnack.empty() && cofile.find(skip_xnack) != std::string::npos)
+                                continue;
+                            if(cofile.find("Experimental") != std::string::npos)
+                                continue;
+                            MapLibraryFile(cofile);
+                        }
+                    }
+                    globfree(&co_glob);
+                    return 0;
+                }();
+            }
+#endif
+
             //Supports multi architecture configuration in lazy library loading mode
             static int initialize_once = [&] {
                 hipDeviceProp_t prop;
@@ -1028,7 +1140,12 @@ namespace
         if(!adapter)
         {
             // Lock so that only one thread performs initialization of the adapter
-            std::lock_guard<std::mutex> lock(a.mutex);
+            std::unique_lock<std::mutex> lock(a.mutex, std::try_to_lock);
+            if(!lock.owns_lock())
+            {
+                ++rocblas_internal_lock_wait_count();
+                lock.lock();
+            }
 
             adapter = a.adapter.load(std::memory_order_relaxed);
             if(!adapter)
@@ -1066,6 +1183,338 @@ namespace
         rocblas_abort();
     }
 
+    /**************************************************************************
+     * Persistent cache of winning solution indices, keyed by problem shape,  *
+     * types, transposes and architecture. Enabled by setting the             *
+     * ROCBLAS_TENSILE_SOLUTION_CACHE_PATH environment variable to a file     *
+     * path. The file is loaded once per process, and newly selected winners  *
+     * are appended, so that subsequent processes skip solution selection     *
+     * for problems they have already seen.                                   *
+     **************************************************************************/
+    class SolutionIndexCache
+    {
+        std::unordered_map<std::string, int> map;
+        std::mutex                           guard;
+        std::string                          path;
+        bool                                 enabled = false;
+
+        SolutionIndexCache()
+        {
+            const char* env = getenv("ROCBLAS_TENSILE_SOLUTION_CACHE_PATH");
+            if(!env || !*env)
+                return;
+            path    = env;
+            enabled = true;
+            std::ifstream in(path);
+            std::string   key;
+            int           index;
+            while(in >> key >> index)
+                map.emplace(key, index);
+        }
+
+    public:
+        // Cache is a singleton, to be shared by all handles in the process
+        static SolutionIndexCache& instance()
+        {
+            static SolutionIndexCache cache;
+            return cache;
+        }
+
+        bool is_enabled() const
+        {
+            return enabled;
+        }
+
+        // Returns the cached solution index, or -1 if the key has not been seen
+        int lookup(const std::string& key)
+        {
+            std::unique_lock<std::mutex> lock(guard, std::try_to_lock);
+            if(!lock.owns_lock())
+            {
+                ++rocblas_internal_lock_wait_count();
+                lock.lock();
+            }
+            auto it = map.find(key);
+            return it == map.end() ? -1 : it->second;
+        }
+
+        // Records a winning solution index, appending it to the backing file
+        // so that it survives process restarts
+        void record(const std::string& key, int index)
+        {
+            std::unique_lock<std::mutex> lock(guard, std::try_to_lock);
+            if(!lock.owns_lock())
+            {
+                ++rocblas_internal_lock_wait_count();
+                lock.lock();
+            }
+            if(!map.emplace(key, index).second)
+                return;
+            // The in-memory table also serves autotuned winners when no
+            // backing file is configured
+            if(!enabled)
+                return;
+            std::ofstream out(path, std::ios::app);
+            if(out)
+                out << key << ' ' << index << '\n';
+        }
+    };
+
+    // Build the cache key for a contraction problem. Only properties which
+    // affect solution selection are included; pointers and scalars are not.
+    template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+    std::string
+        solution_cache_key(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob)
+    {
+        std::ostringstream key;
+        key << rocblas_internal_get_arch_name() << '_' << rocblas_precision_string<TiA> << '_'
+            << rocblas_precision_string<TiB> << '_' << rocblas_precision_string<To> << '_'
+            << rocblas_precision_string<Tc> << '_' << rocblas_transpose_letter(prob.trans_a)
+            << rocblas_transpose_letter(prob.trans_b) << '_' << prob.m << '_' << prob.n << '_'
+            << prob.k << '_' << prob.col_stride_a << '_' << prob.col_stride_b << '_'
+            << prob.col_stride_c << '_' << prob.col_stride_d << '_' << prob.batch_count << '_'
+            << prob.strided_batch;
+        return key.str();
+    }
+
+    /**************************************************************************
+     * Online measured solution re-ranking, used by the measured performance  *
+     * metric (see rocblas_set_performance_metric). Each shape accumulates an *
+     * exponentially weighted average of the achieved time of every solution  *
+     * it has dispatched. Calls normally run the empirically fastest known    *
+     * solution; unsampled candidates are tried first and a periodic refresh  *
+     * re-times the candidates round-robin, so the ranking tracks what the    *
+     * hardware actually delivers rather than the heuristic's prediction.     *
+     * Measurements ride on the live launch with events and are harvested on  *
+     * a later call for the same shape, so no call synchronizes the stream.   *
+     **************************************************************************/
+    class MeasuredSolutionTable
+    {
+        struct Candidate
+        {
+            int    index   = -1;
+            float  ewma_ms = 0;
+            size_t samples = 0;
+        };
+
+        struct Entry
+        {
+            std::vector<Candidate> candidates;
+            uint32_t               calls = 0;
+            // at most one in-flight measurement per shape
+            hipEvent_t start   = nullptr;
+            hipEvent_t stop    = nullptr;
+            int        pending = -1;
+        };
+
+        std::unordered_map<std::string, Entry> map;
+        std::mutex                             guard;
+
+        static constexpr uint32_t c_refresh_period = 16;
+        static constexpr float    c_ewma_alpha     = 0.25f;
+
+        // Fold a completed measurement into its candidate's average. A launch
+        // that failed before recording drops the measurement on the floor.
+        void harvest(Entry& e)
+        {
+            if(e.pending < 0 || hipEventQuery(e.stop) != hipSuccess)
+                return;
+            float ms = 0;
+            if(hipEventElapsedTime(&ms, e.start, e.stop) == hipSuccess && ms > 0)
+            {
+                for(auto& c : e.candidates)
+                    if(c.index == e.pending)
+                    {
+                        c.ewma_ms = c.samples ? c.ewma_ms + c_ewma_alpha * (ms - c.ewma_ms) : ms;
+                        ++c.samples;
+                        break;
+                    }
+            }
+            e.pending = -1;
+        }
+
+    public:
+        static constexpr size_t c_max_candidates = 4;
+        static constexpr size_t c_max_entries    = 4096;
+
+        // Table is a singleton shared by all handles in the process. It is
+        // deliberately leaked: the HIP runtime may be gone before static
+        // destructors run, so the entries' events must not be destroyed then.
+        static MeasuredSolutionTable& instance()
+        {
+            static auto* table = new MeasuredSolutionTable;
+            return *table;
+        }
+
+        // Select the solution index to run for this call, or -1 to keep the
+        // caller's pick. enumerate is invoked only the first time a shape is
+        // seen and returns candidate indices, the heuristic pick first. When
+        // this call should be timed, measure_start/stop are set to the events
+        // to launch with; the result is harvested on a later call.
+        template <typename ENUM>
+        int select(const std::string& key,
+                   ENUM&&             enumerate,
+                   hipEvent_t&        measure_start,
+                   hipEvent_t&        measure_stop)
+        {
+            std::lock_guard<std::mutex> lock(guard);
+
+            auto it = map.find(key);
+            if(it == map.end())
+            {
+                // bound the table so pathological shape churn cannot grow it
+                // (or its events) without limit
+                if(map.size() >= c_max_entries)
+                    return -1;
+                Entry e;
+                for(int index : enumerate())
+                {
+                    Candidate c;
+                    c.index = index;
+                    e.candidates.push_back(c);
+                    if(e.candidates.size() >= c_max_candidates)
+                        break;
+                }
+                if(e.candidates.empty())
+                    return -1;
+                it = map.emplace(key, std::move(e)).first;
+            }
+
+            Entry& e = it->second;
+            ++e.calls;
+            harvest(e);
+
+            if(e.pending < 0)
+            {
+                // measure unsampled candidates first, then refresh round-robin
+                Candidate* m = nullptr;
+                for(auto& c : e.candidates)
+                    if(!c.samples)
+                    {
+                        m = &c;
+                        break;
+                    }
+                if(!m && e.calls % c_refresh_period == 0)
+                    m = &e.candidates[(e.calls / c_refresh_period) % e.candidates.size()];
+                if(m)
+                {
+                    if(!e.start && hipEventCreate(&e.start) != hipSuccess)
+                        e.start = nullptr;
+                    if(!e.stop && hipEventCreate(&e.stop) != hipSuccess)
+                        e.stop = nullptr;
+                    if(e.start && e.stop)
+                    {
+                        e.pending     = m->index;
+                        measure_start = e.start;
+                        measure_stop  = e.stop;
+                        return m->index;
+                    }
+                }
+            }
+
+            // dispatch the empirically fastest; until something has been
+            // measured, stay on the first (heuristic) candidate
+            const Candidate* best = nullptr;
+            for(const auto& c : e.candidates)
+                if(c.samples && (!best || c.ewma_ms < best->ewma_ms))
+                    best = &c;
+            return best ? best->index : e.candidates.front().index;
+        }
+    };
+
+#ifdef BUILD_WITH_HIPBLASLT
+    /**************************************************************************
+     * Measured routing between the Tensile and hipBLASLt backends. Enabled  *
+     * by pointing ROCBLAS_BACKEND_ROUTING_PATH at a file. The key embeds    *
+     * the architecture name, so one file can serve a mixed fleet. The first *
+     * time a problem is seen both backends are timed once and the winner is *
+     * appended, so later calls and processes route on the measurement.      *
+     **************************************************************************/
+    class BackendRoutingTable
+    {
+        std::unordered_map<std::string, int> map; // 0 = Tensile, 1 = hipBLASLt
+        std::mutex                           guard;
+        std::string                          path;
+        bool                                 enabled = false;
+
+        BackendRoutingTable()
+        {
+            const char* env = getenv("ROCBLAS_BACKEND_ROUTING_PATH");
+            if(!env || !*env)
+                return;
+            path    = env;
+            enabled = true;
+            std::ifstream in(path);
+            std::string   key;
+            int           backend;
+            float         tensile_ms, hipblaslt_ms;
+            while(in >> key >> backend >> tensile_ms >> hipblaslt_ms)
+                map.emplace(key, backend);
+        }
+
+    public:
+        // Table is a singleton, to be shared by all handles in the process
+        static BackendRoutingTable& instance()
+        {
+            static BackendRoutingTable table;
+            return table;
+        }
+
+        bool is_enabled() const
+        {
+            return enabled;
+        }
+
+        // Returns the routed backend, or -1 if the key has not been measured
+        int lookup(const std::string& key)
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            auto                        it = map.find(key);
+            return it == map.end() ? -1 : it->second;
+        }
+
+        // Records a measured winner, appending both timings so the file can
+        // be inspected or regenerated by offline tuning
+        void record(const std::string& key, int backend, float tensile_ms, float hipblaslt_ms)
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            if(!map.emplace(key, backend).second)
+                return;
+            std::ofstream out(path, std::ios::app);
+            if(out)
+                out << key << ' ' << backend << ' ' << tensile_ms << ' ' << hipblaslt_ms
+                    << '\n';
+        }
+    };
+
+    // Times a backend call with events on the handle's stream. If the events
+    // cannot be set up the call still runs, reported with an infinite time.
+    template <typename CALL>
+    rocblas_status time_backend_call(rocblas_handle handle, float& ms, CALL&& call)
+    {
+        ms = std::numeric_limits<float>::infinity();
+
+        hipEvent_t start, stop;
+        if(hipEventCreate(&start) != hipSuccess)
+            return call();
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            hipEventDestroy(start);
+            return call();
+        }
+
+        hipEventRecord(start, handle->get_stream());
+        rocblas_status status = call();
+        hipEventRecord(stop, handle->get_stream());
+        if(hipEventSynchronize(stop) == hipSuccess)
+            hipEventElapsedTime(&ms, start, stop);
+
+        hipEventDestroy(start);
+        hipEventDestroy(stop);
+        return status;
+    }
+#endif
+
     /**************************************************************************
     * We normally print error messages only once, to avoid excessive logging *
     **************************************************************************/
@@ -1107,6 +1556,10 @@ bool useHipBLASLt(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& p
 {
 #ifdef BUILD_WITH_HIPBLASLT
     bool problemSpecific = true; // On supported architectures use hipBLASLT on all problems.
+    // hipBLASLt has no deterministic mode, so calls flagged per-call
+    // deterministic stay on Tensile, which honors it in solution selection
+    if(prob.flags & rocblas_gemm_flags_deterministic)
+        problemSpecific = false;
     return prob.handle->useHipBLASLt(problemSpecific);
 #else
     return false;
@@ -1114,40 +1567,120 @@ bool useHipBLASLt(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& p
 }
 
 /******************************************************************************
- * runContractionProblem calls Tensile to run a contraction problem described *
- * by RocblasContractionProblem                                               *
+ * autotuneSolution times candidate solutions for a problem on the handle's  *
+ * stream and returns the fastest one. It runs once per shape when autotune  *
+ * is enabled on the handle (see rocblas_set_gemm_autotune); the winner is   *
+ * cached by the caller so subsequent calls dispatch directly.               *
  ******************************************************************************/
 template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
-rocblas_status
-    runContractionProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
-                          rocblas_gemm_algo                                            algo,
-                          int32_t solution_index)
+std::shared_ptr<Tensile::ContractionSolution>
+    autotuneSolution(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                     Tensile::ContractionProblem&                                  tensile_prob,
+                     Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>&  library,
+                     const Tensile::Hardware&                                      hardware,
+                     Tensile::hip::SolutionAdapter&                                adapter,
+                     std::shared_ptr<Tensile::ContractionSolution>                 heuristic)
 {
-#ifdef BUILD_WITH_HIPBLASLT
-    if(useHipBLASLt(prob))
+    auto handle = prob.handle;
+
+    // The heuristic winner is always among the timed candidates
+    std::vector<std::shared_ptr<Tensile::ContractionSolution>> candidates{heuristic};
+    for(const auto& s : library.findAllSolutions(tensile_prob, hardware))
+        if(s && s->index != heuristic->index)
+            candidates.push_back(s);
+
+    hipEvent_t start = nullptr;
+    hipEvent_t stop  = nullptr;
+    if(hipEventCreate(&start) != hipSuccess || hipEventCreate(&stop) != hipSuccess)
+        return heuristic;
+
+    auto        best    = heuristic;
+    float       best_ms = std::numeric_limits<float>::max();
+    rocblas_int timed   = 0;
+
+    for(const auto& s : candidates)
     {
-        try
+        if(timed >= handle->gemm_autotune_top_n)
+            break;
+        if(!s->canSolve(tensile_prob, hardware))
+            continue;
+
+        size_t workspace_size = s->requiredWorkspaceSize(tensile_prob, hardware);
+        auto   gsu_malloc     = handle->gsu_malloc_by_size(workspace_size);
+        auto   kernels        = s->solve(tensile_prob, GetTensileInputs(prob), hardware);
+
+        // One warm-up launch to populate caches, then one timed launch
+        if(adapter.launchKernels(kernels, handle->get_stream(), nullptr, nullptr) != hipSuccess)
+            continue;
+        if(adapter.launchKernels(kernels, handle->get_stream(), start, stop) != hipSuccess)
+            continue;
+        if(hipEventSynchronize(stop) != hipSuccess)
+            break;
+
+        float ms = 0;
+        if(hipEventElapsedTime(&ms, start, stop) != hipSuccess)
+            break;
+
+        ++timed;
+        if(ms < best_ms)
         {
-            rocblas_internal_ostream msg;
-            auto hipblasltResult = runContractionProblemHipBlasLT(prob, algo, solution_index);
-
-            if(hipblasltResult == rocblas_status_success
-               || (algo == rocblas_gemm_algo_solution_index && solution_index > 0))
-            {
-                return hipblasltResult;
-            }
-        }
-        catch(...)
-        {
-            rocblas_internal_ostream msg;
-            print_once(msg << "\nrocBLAS warning: hipBlasLT exception encountered. ");
+            best_ms = ms;
+            best    = s;
         }
+    }
 
-        rocblas_internal_ostream msg;
-        print_once(msg << "\nrocBLAS warning: hipBlasLT failed, falling back to tensile. ");
+    hipEventDestroy(start);
+    hipEventDestroy(stop);
+    return best;
+}
+
+/******************************************************************************
+ * recordCallMetrics snapshots the launch shape of the chosen solution and a  *
+ * roofline byte estimate into the handle (rocblas_set_call_metrics)          *
+ ******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+void recordCallMetrics(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                       int32_t                                                      solution_index,
+                       const std::vector<Tensile::KernelInvocation>&                kernels)
+{
+    auto& metrics          = prob.handle->call_metrics;
+    metrics                = {};
+    metrics.solution_index = solution_index;
+
+    for(const auto& k : kernels)
+    {
+        metrics.workgroups += uint64_t(k.numWorkGroups.x) * k.numWorkGroups.y * k.numWorkGroups.z;
+
+        uint32_t workgroup_size
+            = uint32_t(k.workGroupSize.x * k.workGroupSize.y * k.workGroupSize.z);
+        if(workgroup_size > metrics.workgroup_size)
+            metrics.workgroup_size = workgroup_size;
     }
-#endif
 
+    int cu_count = prob.handle->getCUCount();
+    if(cu_count > 0)
+        metrics.cu_occupancy
+            = metrics.workgroups < uint64_t(cu_count) ? double(metrics.workgroups) / cu_count : 1.0;
+
+    // Minimum operand traffic for general alpha/beta: A, B, and C read once,
+    // D written once, per batch instance
+    uint64_t d_bytes = uint64_t(prob.m) * prob.n * sizeof(To);
+    metrics.bytes_estimate
+        = (uint64_t(prob.m) * prob.k * sizeof(TiA) + uint64_t(prob.k) * prob.n * sizeof(TiB)
+           + 2 * d_bytes)
+          * prob.batch_count;
+}
+
+/******************************************************************************
+ * runContractionProblemTensile calls Tensile to run a contraction problem    *
+ * described by RocblasContractionProblem                                     *
+ ******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+rocblas_status runContractionProblemTensile(
+    const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+    rocblas_gemm_algo                                            algo,
+    int32_t                                                      solution_index)
+{
     rocblas_status                                status = rocblas_status_internal_error;
     std::shared_ptr<Tensile::ContractionSolution> solution;
 
@@ -1165,6 +1698,17 @@ rocblas_status
         auto  handle        = prob.handle;
         auto* fitness_query = handle->get_solution_fitness_query();
 
+        // The measured metric re-ranks selection from live timings, so the
+        // per-thread memo must not pin the first answer. User-supplied start/
+        // stop events take precedence over measurement events at launch.
+        rocblas_performance_metric metric = rocblas_default_performance_metric;
+        rocblas_get_performance_metric(handle, &metric);
+        bool measured_metric = metric == rocblas_measured_performance_metric && !fitness_query
+                               && !handle->is_device_memory_size_query() && !handle->startEvent;
+
+        hipEvent_t measure_start = nullptr;
+        hipEvent_t measure_stop  = nullptr;
+
         if(algo == rocblas_gemm_algo_solution_index && solution_index > 0)
         {
             solution = library->getSolutionByIndex(solution_index - 1);
@@ -1177,7 +1721,139 @@ rocblas_status
         }
         else
         {
-            solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+            // Memoized dispatch: at high call rates of identical shapes,
+            // walking Tensile's selection on every call is measurable CPU
+            // launch latency. Each thread and template instantiation keeps its
+            // own table from the numeric shape to the resolved solution, so
+            // lookups are lock-free and the key needs no type information.
+            using SolutionMemoKey = std::array<int64_t, 12>;
+            struct SolutionMemoHash
+            {
+                size_t operator()(const SolutionMemoKey& key) const
+                {
+                    size_t h = 0x811c9dc5;
+                    for(int64_t v : key)
+                        h = (h ^ size_t(v)) * 0x01000193;
+                    return h;
+                }
+            };
+            thread_local std::unordered_map<SolutionMemoKey,
+                                            std::shared_ptr<Tensile::ContractionSolution>,
+                                            SolutionMemoHash>
+                solution_memo;
+
+            SolutionMemoKey memo_key{handle->getDevice(),
+                                     int64_t(prob.trans_a),
+                                     int64_t(prob.trans_b),
+                                     int64_t(prob.m),
+                                     int64_t(prob.n),
+                                     int64_t(prob.k),
+                                     int64_t(prob.col_stride_a),
+                                     int64_t(prob.col_stride_b),
+                                     int64_t(prob.col_stride_c),
+                                     int64_t(prob.col_stride_d),
+                                     int64_t(prob.batch_count),
+                                     int64_t(prob.strided_batch)};
+
+            bool use_memo = !fitness_query && !measured_metric;
+            if(use_memo)
+            {
+                auto it = solution_memo.find(memo_key);
+                if(it != solution_memo.end())
+                    solution = it->second;
+            }
+
+            if(!solution)
+            {
+                // Consult the solution cache before paying for selection. Both
+                // the persistent cache and autotuned winners are recorded
+                // here. A cached solution which can no longer solve the
+                // problem (e.g. after a library update) falls through to
+                // normal selection below.
+                std::string cache_key;
+                if(!fitness_query
+                   && (SolutionIndexCache::instance().is_enabled()
+                       || handle->gemm_autotune_top_n > 0))
+                {
+                    cache_key        = solution_cache_key(prob);
+                    int cached_index = SolutionIndexCache::instance().lookup(cache_key);
+                    if(cached_index >= 0)
+                    {
+                        solution = library->getSolutionByIndex(cached_index);
+                        // load solution if not already loaded
+                        if(!solution)
+                        {
+                            library->findAllSolutions(tensile_prob, *hardware);
+                            solution = library->getSolutionByIndex(cached_index);
+                        }
+                        if(solution && !solution->canSolve(tensile_prob, *hardware))
+                            solution.reset();
+                    }
+                }
+
+                if(!solution)
+                {
+                    solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+
+                    // On the first occurrence of a shape with autotuning
+                    // enabled, time up to top_n candidates on the live stream
+                    // and keep the fastest. Replaying candidates is only safe
+                    // when C and D do not alias (gemm_ex); in-place problems
+                    // keep the heuristic pick. The winner is recorded
+                    // alongside persistent entries.
+                    if(solution && handle->gemm_autotune_top_n > 0 && !fitness_query
+                       && !handle->is_device_memory_size_query() && prob.C != prob.D)
+                    {
+                        solution = autotuneSolution(
+                            prob, tensile_prob, *library, *hardware, adapter, solution);
+                    }
+
+                    if(solution && !cache_key.empty())
+                        SolutionIndexCache::instance().record(cache_key, solution->index);
+                }
+
+                if(solution && use_memo)
+                {
+                    // bound the table so pathological shape churn cannot grow
+                    // it without limit
+                    if(solution_memo.size() >= 4096)
+                        solution_memo.clear();
+                    solution_memo.emplace(memo_key, solution);
+                }
+            }
+
+            // Measured metric: consult the live-timing table, which may pick
+            // a different candidate than the heuristic, and may ask for this
+            // launch to be timed
+            if(solution && measured_metric)
+            {
+                int chosen = MeasuredSolutionTable::instance().select(
+                    solution_cache_key(prob),
+                    [&] {
+                        std::vector<int> indices{solution->index};
+                        for(const auto& s : library->findAllSolutions(tensile_prob, *hardware))
+                            if(s && s->index != solution->index
+                               && indices.size() < MeasuredSolutionTable::c_max_candidates
+                               && s->canSolve(tensile_prob, *hardware))
+                                indices.push_back(s->index);
+                        return indices;
+                    },
+                    measure_start,
+                    measure_stop);
+
+                if(chosen >= 0 && chosen != solution->index)
+                {
+                    auto s = library->getSolutionByIndex(chosen);
+                    // load solution if not already loaded
+                    if(!s)
+                    {
+                        library->findAllSolutions(tensile_prob, *hardware);
+                        s = library->getSolutionByIndex(chosen);
+                    }
+                    if(s && s->canSolve(tensile_prob, *hardware))
+                        solution = s;
+                }
+            }
         }
 
         if(!solution && fallbackTensileProblem(tensile_prob))
@@ -1220,11 +1896,16 @@ rocblas_status
                 {
                     if(!(prob.flags & rocblas_gemm_flags_check_solution_index))
                     {
+                        auto kernels = solution->solve(tensile_prob, GetTensileInputs(prob), *hardware);
+
+                        if(handle->collect_call_metrics)
+                            recordCallMetrics(prob, solution->index, kernels);
+
                         hipError_t hip_status = adapter.launchKernels(
-                            solution->solve(tensile_prob, GetTensileInputs(prob), *hardware),
+                            kernels,
                             handle->get_stream(),
-                            handle->startEvent,
-                            handle->stopEvent);
+                            measure_start ? measure_start : handle->startEvent,
+                            measure_stop ? measure_stop : handle->stopEvent);
                         if(hip_status != hipSuccess)
                             status = rocblas_internal_convert_hip_to_rocblas_status(hip_status);
                         else
@@ -1258,6 +1939,100 @@ rocblas_status
     return status;
 }
 
+/******************************************************************************
+ * runContractionProblem picks a backend for a contraction problem described  *
+ * by RocblasContractionProblem and runs it                                   *
+ ******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+rocblas_status
+    runContractionProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                          rocblas_gemm_algo                                            algo,
+                          int32_t solution_index)
+{
+#ifdef BUILD_WITH_HIPBLASLT
+    if(useHipBLASLt(prob))
+    {
+        // With a routing table configured, pick the backend from per-problem
+        // measurements instead of the static architecture rule. Forced
+        // solution indices keep their explicit backend, and in-place problems
+        // (C == D) cannot be probed twice, so both use the default path below.
+        auto& routing = BackendRoutingTable::instance();
+        if(routing.is_enabled() && algo != rocblas_gemm_algo_solution_index
+           && !prob.handle->is_device_memory_size_query())
+        {
+            const auto key     = solution_cache_key(prob);
+            int        backend = routing.lookup(key);
+            if(backend == 0)
+                return runContractionProblemTensile(prob, algo, solution_index);
+            if(backend < 0 && prob.C != prob.D)
+            {
+                // One-time probe: run and time each backend once on the live
+                // stream. C and D do not alias, so the second run simply
+                // rewrites D and its result stands.
+                float          hipblaslt_ms     = std::numeric_limits<float>::infinity();
+                rocblas_status hipblaslt_status = rocblas_status_internal_error;
+                try
+                {
+                    hipblaslt_status = time_backend_call(prob.handle, hipblaslt_ms, [&] {
+                        return runContractionProblemHipBlasLT(prob, algo, solution_index);
+                    });
+                }
+                catch(...)
+                {
+                    rocblas_internal_ostream msg;
+                    print_once(msg << "\nrocBLAS warning: hipBlasLT exception encountered. ");
+                }
+                if(hipblaslt_status != rocblas_status_success)
+                    hipblaslt_ms = std::numeric_limits<float>::infinity();
+
+                float          tensile_ms;
+                rocblas_status tensile_status = time_backend_call(prob.handle, tensile_ms, [&] {
+                    return runContractionProblemTensile(prob, algo, solution_index);
+                });
+                if(tensile_status != rocblas_status_success)
+                    tensile_ms = std::numeric_limits<float>::infinity();
+
+                if(tensile_status == rocblas_status_success
+                   || hipblaslt_status == rocblas_status_success)
+                    routing.record(
+                        key, hipblaslt_ms < tensile_ms ? 1 : 0, tensile_ms, hipblaslt_ms);
+
+                // D holds the Tensile result unless only hipBLASLt succeeded,
+                // in which case the failed Tensile pass never launched
+                if(tensile_status != rocblas_status_success
+                   && hipblaslt_status == rocblas_status_success)
+                    return hipblaslt_status;
+                return tensile_status;
+            }
+            // backend == 1 (or an unprobeable miss) continues with the
+            // default hipBLASLt-first path, which falls back on failure
+        }
+
+        try
+        {
+            rocblas_internal_ostream msg;
+            auto hipblasltResult = runContractionProblemHipBlasLT(prob, algo, solution_index);
+
+            if(hipblasltResult == rocblas_status_success
+               || (algo == rocblas_gemm_algo_solution_index && solution_index > 0))
+            {
+                return hipblasltResult;
+            }
+        }
+        catch(...)
+        {
+            rocblas_internal_ostream msg;
+            print_once(msg << "\nrocBLAS warning: hipBlasLT exception encountered. ");
+        }
+
+        rocblas_internal_ostream msg;
+        print_once(msg << "\nrocBLAS warning: hipBlasLT failed, falling back to tensile. ");
+    }
+#endif
+
+    return runContractionProblemTensile(prob, algo, solution_index);
+}
+
 template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
 rocblas_status getAllSolutions(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
                                rocblas_tensile_get_solution_option                          option,
@@ -1331,14 +2106,82 @@ rocblas_status getAllSolutions(const RocblasContractionProblem<TiA, To, Tc, TiB,
     return status;
 }
 
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob)
+{
+    rocblas_status status = rocblas_status_internal_error;
+    try
+    {
+        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
+        std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
+        std::shared_ptr<Tensile::Hardware>                                           hardware;
+
+        get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
+
+        hardware          = Tensile::hip::GetDevice(*deviceProp);
+        auto tensile_prob = ConstructTensileProblem(prob);
+
+        // Matching the problem against a lazily loaded placeholder library pulls
+        // in that library's metadata and its code object file; nothing is
+        // launched, so this is the whole first-call load cost and nothing more
+        auto solution = library->findBestSolution(tensile_prob, *hardware);
+
+        if(!solution && fallbackTensileProblem(tensile_prob))
+            solution = library->findBestSolution(tensile_prob, *hardware);
+
+        if(!solution)
+            return rocblas_status_not_implemented;
+
+        // Seed the solution cache so the first real call also skips selection
+        if(SolutionIndexCache::instance().is_enabled() || prob.handle->gemm_autotune_top_n > 0)
+            SolutionIndexCache::instance().record(solution_cache_key(prob), solution->index);
+
+        status = rocblas_status_success;
+    }
+    catch(const std::exception& e)
+    {
+        rocblas_internal_ostream msg;
+        print_once(msg << "\nrocBLAS error: exception thrown while preloading " << prob
+                       << e.what());
+    }
+    catch(...)
+    {
+        rocblas_internal_ostream msg;
+        print_once(msg << "\nrocBLAS error: unknown exception thrown while preloading " << prob);
+    }
+    return status;
+}
+
 /***************************************************************
- * ! \brief  Initialize rocBLAS for the current HIP device, to *
- * avoid costly startup time at the first call on that device. *
+ * ! \brief  Initialize rocBLAS for every HIP device, to avoid *
+ * costly startup time at the first call on each device.       *
  ***************************************************************/
 extern "C" void rocblas_initialize()
 {
     rocblas_initialize_called() = true;
-    get_library_and_adapter();
+
+    // One future per device: the adapters guard themselves with per-device
+    // mutexes and only the shared metadata parse is common, so all devices'
+    // code objects load concurrently and a multi-worker startup pays roughly
+    // one device's initialization time instead of one per device in sequence.
+    int count = 0;
+    if(hipGetDeviceCount(&count) != hipSuccess || count <= 1)
+    {
+        get_library_and_adapter();
+        return;
+    }
+
+    std::vector<std::future<void>> ftr_init;
+    ftr_init.reserve(count);
+    for(int devId = 0; devId < count; devId++)
+        ftr_init.emplace_back(std::async(std::launch::async, [devId] {
+            // the device selection is thread-local, so the caller's is untouched
+            if(hipSetDevice(devId) == hipSuccess)
+                get_library_and_adapter(nullptr, nullptr, devId);
+        }));
+    for(auto& ftr : ftr_init)
+        ftr.get();
 }
 
 /******************************************************************************
@@ -1559,6 +2402,123 @@ template rocblas_status getAllSolutions(const RocblasContractionProblem<int8_t,
                                         rocblas_int*                        list_array,
                                         rocblas_int*                        list_size);
 
+// EX3 types
+template rocblas_status getAllSolutions(const RocblasContractionProblem<rocblas_f8, float, float>&,
+                                        rocblas_tensile_get_solution_option option,
+                                        rocblas_int*                        list_array,
+                                        rocblas_int*                        list_size);
+
+template rocblas_status
+    getAllSolutions(const RocblasContractionProblem<rocblas_f8, rocblas_half, float>&,
+                    rocblas_tensile_get_solution_option option,
+                    rocblas_int*                        list_array,
+                    rocblas_int*                        list_size);
+
+template rocblas_status
+    getAllSolutions(const RocblasContractionProblem<rocblas_f8, rocblas_f8, float>&,
+                    rocblas_tensile_get_solution_option option,
+                    rocblas_int*                        list_array,
+                    rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(const RocblasContractionProblem<rocblas_bf8, float, float>&,
+                                        rocblas_tensile_get_solution_option option,
+                                        rocblas_int*                        list_array,
+                                        rocblas_int*                        list_size);
+
+template rocblas_status
+    getAllSolutions(const RocblasContractionProblem<rocblas_bf8, rocblas_half, float>&,
+                    rocblas_tensile_get_solution_option option,
+                    rocblas_int*                        list_array,
+                    rocblas_int*                        list_size);
+
+template rocblas_status
+    getAllSolutions(const RocblasContractionProblem<rocblas_bf8, rocblas_bf8, float>&,
+                    rocblas_tensile_get_solution_option option,
+                    rocblas_int*                        list_array,
+                    rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(
+    const RocblasContractionProblem<rocblas_f8, float, float, rocblas_bf8, rocblas_f8, rocblas_bf8>&,
+    rocblas_tensile_get_solution_option option,
+    rocblas_int*                        list_array,
+    rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(const RocblasContractionProblem<rocblas_f8,
+                                                                        rocblas_half,
+                                                                        float,
+                                                                        rocblas_bf8,
+                                                                        rocblas_f8,
+                                                                        rocblas_bf8>&,
+                                        rocblas_tensile_get_solution_option option,
+                                        rocblas_int*                        list_array,
+                                        rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(
+    const RocblasContractionProblem<rocblas_bf8, float, float, rocblas_f8, rocblas_bf8, rocblas_f8>&,
+    rocblas_tensile_get_solution_option option,
+    rocblas_int*                        list_array,
+    rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(const RocblasContractionProblem<rocblas_bf8,
+                                                                        rocblas_half,
+                                                                        float,
+                                                                        rocblas_f8,
+                                                                        rocblas_bf8,
+                                                                        rocblas_f8>&,
+                                        rocblas_tensile_get_solution_option option,
+                                        rocblas_int*                        list_array,
+                                        rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(const RocblasContractionProblem<rocblas_f8,
+                                                                        rocblas_bf8,
+                                                                        float,
+                                                                        rocblas_bf8,
+                                                                        rocblas_f8,
+                                                                        rocblas_bf8>&,
+                                        rocblas_tensile_get_solution_option option,
+                                        rocblas_int*                        list_array,
+                                        rocblas_int*                        list_size);
+
+template rocblas_status getAllSolutions(const RocblasContractionProblem<rocblas_bf8,
+                                                                        rocblas_bf8,
+                                                                        float,
+                                                                        rocblas_f8,
+                                                                        rocblas_bf8,
+                                                                        rocblas_f8>&,
+                                        rocblas_tensile_get_solution_option option,
+                                        rocblas_int*                        list_array,
+                                        rocblas_int*                        list_size);
+
+// ********** preload explicits ********
+// Non-HPA/GEMM types
+template rocblas_status preloadContractionProblem(const RocblasContractionProblem<rocblas_half>&);
+
+template rocblas_status preloadContractionProblem(const RocblasContractionProblem<float>&);
+
+template rocblas_status preloadContractionProblem(const RocblasContractionProblem<double>&);
+
+template rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<rocblas_float_complex>&);
+
+template rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<rocblas_double_complex>&);
+
+// HPA types
+template rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<rocblas_half, rocblas_half, float>&);
+
+template rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<rocblas_half, float, float>&);
+
+template rocblas_status preloadContractionProblem(
+    const RocblasContractionProblem<rocblas_bfloat16, rocblas_bfloat16, float>&);
+
+template rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<rocblas_bfloat16, float, float>&);
+
+template rocblas_status
+    preloadContractionProblem(const RocblasContractionProblem<int8_t, int32_t, int32_t>&);
+
 /***********************************************************************************
  * Whether Tensile has been initialized for at least one device (used for testing) *
  ***********************************************************************************/
@@ -1568,6 +2528,16 @@ ROCBLAS_INTERNAL_EXPORT std::atomic_bool& rocblas_internal_tensile_is_initialize
     return init;
 }
 
+/***********************************************************************************
+ * Count of acquisitions of the shared Tensile host locks (adapter initialization  *
+ * and the solution index cache) which found the lock already held and had to wait *
+ ***********************************************************************************/
+ROCBLAS_INTERNAL_EXPORT std::atomic<uint64_t>& rocblas_internal_lock_wait_count()
+{
+    static std::atomic<uint64_t> count;
+    return count;
+}
+
 /***********************************************************************************
  * Whether rocblas_initialize() is invoked to load all tensile kernels at startup  *
  ***********************************************************************************/
@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "tuning.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    // shape key shared by the loader and the per-call lookup
+    std::string rocblas_tuning_key(rocblas_operation transA,
+                                   rocblas_operation transB,
+                                   int64_t           m,
+                                   int64_t           n,
+                                   int64_t           k,
+                                   rocblas_datatype  a_type,
+                                   rocblas_datatype  compute_type)
+    {
+        char buf[96];
+        snprintf(buf,
+                 sizeof(buf),
+                 "%d:%d:%lld:%lld:%lld:%d:%d",
+                 int(transA),
+                 int(transB),
+                 (long long)m,
+                 (long long)n,
+                 (long long)k,
+                 int(a_type),
+                 int(compute_type));
+        return buf;
+    }
+
+    bool rocblas_tuning_parse_operation(const std::string& s, rocblas_operation& op)
+    {
+        if(s == "N")
+            op = rocblas_operation_none;
+        else if(s == "T")
+            op = rocblas_operation_transpose;
+        else if(s == "C")
+            op = rocblas_operation_conjugate_transpose;
+        else
+            return false;
+        return true;
+    }
+
+    // inverse of rocblas_datatype_string for the types gemm_ex accepts
+    bool rocblas_tuning_parse_datatype(const std::string& s, rocblas_datatype& type)
+    {
+        if(s == "f16_r")
+            type = rocblas_datatype_f16_r;
+        else if(s == "f32_r")
+            type = rocblas_datatype_f32_r;
+        else if(s == "f64_r")
+            type = rocblas_datatype_f64_r;
+        else if(s == "bf16_r")
+            type = rocblas_datatype_bf16_r;
+        else if(s == "f32_c")
+            type = rocblas_datatype_f32_c;
+        else if(s == "f64_c")
+            type = rocblas_datatype_f64_c;
+        else if(s == "i8_r")
+            type = rocblas_datatype_i8_r;
+        else if(s == "i32_r")
+            type = rocblas_datatype_i32_r;
+        else
+            return false;
+        return true;
+    }
+
+    std::string rocblas_tuning_trim(const std::string& s)
+    {
+        size_t b = s.find_first_not_of(" \t\r");
+        size_t e = s.find_last_not_of(" \t\r");
+        return b == std::string::npos ? "" : s.substr(b, e - b + 1);
+    }
+
+    // parses one "- {key: value, ...}" line; returns false when any required
+    // field is missing or malformed
+    bool rocblas_tuning_parse_line(const std::string&    line,
+                                   std::string&          key,
+                                   rocblas_tuning_entry& entry)
+    {
+        size_t open  = line.find('{');
+        size_t close = line.find('}');
+        if(open == std::string::npos || close == std::string::npos || close < open)
+            return false;
+
+        rocblas_operation transA{}, transB{};
+        int64_t           m = -1, n = -1, k = -1;
+        rocblas_datatype  a_type{}, compute_type{};
+        bool have_transA = false, have_transB = false, have_a_type = false,
+             have_compute_type = false, have_solution = false;
+
+        entry = rocblas_tuning_entry{};
+
+        std::istringstream fields(line.substr(open + 1, close - open - 1));
+        std::string        field;
+        while(std::getline(fields, field, ','))
+        {
+            size_t colon = field.find(':');
+            if(colon == std::string::npos)
+                return false;
+            std::string name  = rocblas_tuning_trim(field.substr(0, colon));
+            std::string value = rocblas_tuning_trim(field.substr(colon + 1));
+            if(name.empty() || value.empty())
+                return false;
+
+            if(name == "transA")
+                have_transA = rocblas_tuning_parse_operation(value, transA);
+            else if(name == "transB")
+                have_transB = rocblas_tuning_parse_operation(value, transB);
+            else if(name == "m")
+                m = strtoll(value.c_str(), nullptr, 10);
+            else if(name == "n")
+                n = strtoll(value.c_str(), nullptr, 10);
+            else if(name == "k")
+                k = strtoll(value.c_str(), nullptr, 10);
+            else if(name == "a_type")
+                have_a_type = rocblas_tuning_parse_datatype(value, a_type);
+            else if(name == "compute_type")
+                have_compute_type = rocblas_tuning_parse_datatype(value, compute_type);
+            else if(name == "solution_index")
+            {
+                entry.solution_index = int32_t(strtol(value.c_str(), nullptr, 10));
+                have_solution        = entry.solution_index > 0;
+            }
+            else if(name == "flags")
+                entry.flags = uint32_t(strtoul(value.c_str(), nullptr, 10));
+            // unknown fields are ignored for forward compatibility
+        }
+
+        if(!have_transA || !have_transB || !have_a_type || !have_compute_type || !have_solution
+           || m < 0 || n < 0 || k < 0)
+            return false;
+
+        key = rocblas_tuning_key(transA, transB, m, n, k, a_type, compute_type);
+        return true;
+    }
+}
+
+const rocblas_tuning_table* rocblas_tuning_table::instance()
+{
+    static const rocblas_tuning_table* table = []() -> const rocblas_tuning_table* {
+        const char* path = getenv("ROCBLAS_TUNING_FILE");
+        if(!path || !*path)
+            return nullptr;
+
+        std::ifstream file(path);
+        if(!file)
+            return nullptr;
+
+        auto*       t = new rocblas_tuning_table;
+        std::string line;
+        while(std::getline(file, line))
+        {
+            std::string trimmed = rocblas_tuning_trim(line);
+            if(trimmed.empty() || trimmed[0] == '#')
+                continue;
+
+            std::string          key;
+            rocblas_tuning_entry entry;
+            if(rocblas_tuning_parse_line(trimmed, key, entry))
+                t->m_entries[key] = entry;
+        }
+
+        if(t->m_entries.empty())
+        {
+            delete t;
+            return nullptr;
+        }
+        return t; // lives for the process, shared by all handles
+    }();
+    return table;
+}
+
+const rocblas_tuning_entry* rocblas_tuning_table::find(rocblas_operation transA,
+                                                       rocblas_operation transB,
+                                                       int64_t           m,
+                                                       int64_t           n,
+                                                       int64_t           k,
+                                                       rocblas_datatype  a_type,
+                                                       rocblas_datatype  compute_type) const
+{
+    auto it = m_entries.find(rocblas_tuning_key(transA, transB, m, n, k, a_type, compute_type));
+    return it == m_entries.end() ? nullptr : &it->second;
+}